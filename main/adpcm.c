@@ -0,0 +1,68 @@
+/**
+ * @file adpcm.c
+ * @brief IMA-ADPCM block decoder
+ */
+
+#include "adpcm.h"
+
+static const int16_t step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+void adpcm_decode(const uint8_t *data, uint32_t first, size_t count, int8_t *out)
+{
+    uint32_t block = first / ADPCM_BLOCK_SAMPLES;
+    uint32_t skip = first % ADPCM_BLOCK_SAMPLES;
+
+    while (count > 0) {
+        const uint8_t *b = data + (size_t)block * ADPCM_BLOCK_BYTES;
+        int32_t predictor = (int16_t)(b[0] | (b[1] << 8));
+        int32_t index = b[2];
+        const uint8_t *nibbles = b + ADPCM_BLOCK_HEADER_BYTES;
+
+        if (index > 88) index = 88;
+
+        uint32_t end = skip + count;
+        if (end > ADPCM_BLOCK_SAMPLES) end = ADPCM_BLOCK_SAMPLES;
+
+        for (uint32_t i = 0; i < end; i++) {
+            uint8_t code = (i & 1) ? (nibbles[i >> 1] >> 4) : (nibbles[i >> 1] & 0x0F);
+            int32_t step = step_table[index];
+
+            // diff = (code + 0.5) * step / 4, built from shifts
+            int32_t diff = step >> 3;
+            if (code & 4) diff += step;
+            if (code & 2) diff += step >> 1;
+            if (code & 1) diff += step >> 2;
+            predictor += (code & 8) ? -diff : diff;
+            if (predictor > 32767) predictor = 32767;
+            if (predictor < -32768) predictor = -32768;
+
+            index += index_table[code & 7];
+            if (index < 0) index = 0;
+            if (index > 88) index = 88;
+
+            if (i >= skip) {
+                *out++ = (int8_t)(predictor >> 8);
+            }
+        }
+
+        count -= end - skip;
+        skip = 0;
+        block++;
+    }
+}
+
+size_t adpcm_encoded_bytes(uint32_t sample_count)
+{
+    uint32_t rest = sample_count % ADPCM_BLOCK_SAMPLES;
+    return (size_t)(sample_count / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES +
+           (rest ? ADPCM_BLOCK_HEADER_BYTES + (rest + 1) / 2 : 0);
+}
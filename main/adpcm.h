@@ -0,0 +1,50 @@
+/**
+ * @file adpcm.h
+ * @brief IMA-ADPCM decoder for compressed sound assets
+ *
+ * Clips are stored as independent blocks of ADPCM_BLOCK_SAMPLES samples,
+ * each with its own predictor state, so playback can start or loop at any
+ * block without decoding from the top:
+ *
+ *   int16_t predictor (little endian)   decoder state before sample 0
+ *   uint8_t step_index                  0-88
+ *   uint8_t reserved                    0
+ *   uint8_t nibbles[ADPCM_BLOCK_SAMPLES / 2]
+ *                                       sample 2k in the low nibble,
+ *                                       sample 2k+1 in the high nibble
+ *
+ * The last block may be short. tools/adpcm-encode.js converts the 8-bit
+ * sample headers into this format (about 0.52x the size).
+ */
+
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ADPCM_BLOCK_SAMPLES         256
+#define ADPCM_BLOCK_HEADER_BYTES    4
+#define ADPCM_BLOCK_BYTES           (ADPCM_BLOCK_HEADER_BYTES + ADPCM_BLOCK_SAMPLES / 2)
+
+/**
+ * @brief Decode a range of samples to the mixer's 8-bit format
+ *
+ * Starting on a block boundary is cheapest; otherwise the leading part of
+ * the first block is decoded and discarded.
+ *
+ * @param data Encoded clip
+ * @param first Index of the first sample to decode
+ * @param count Number of samples (must not run past the clip)
+ * @param out Decoded signed 8-bit samples
+ */
+void adpcm_decode(const uint8_t *data, uint32_t first, size_t count, int8_t *out);
+
+/**
+ * @brief Encoded size of a clip
+ * @param sample_count Decoded sample count
+ * @return Bytes, including a short final block
+ */
+size_t adpcm_encoded_bytes(uint32_t sample_count);
+
+#endif // ADPCM_H
@@ -0,0 +1,141 @@
+/**
+ * @file audio_dsp.c
+ * @brief Master bus EQ (esp-dsp biquads) and look-ahead limiter
+ */
+
+#include "audio_dsp.h"
+#include "config.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+#include "dsps_biquad.h"
+#include "dsps_biquad_gen.h"
+#include "esp_log.h"
+
+static const char *TAG = "AUDIO_DSP";
+
+_Static_assert(AUDIO_BLOCK_FRAMES % AUDIO_DSP_LOOKAHEAD_FRAMES == 0,
+               "AUDIO_DSP_LOOKAHEAD_FRAMES must divide AUDIO_BLOCK_FRAMES");
+
+// Published once per second of audio
+#define GAIN_WINDOW_FRAMES  AUDIO_SAMPLE_RATE
+
+typedef struct {
+    float coef[5];              // b0, b1, b2, a1, a2
+    float w[2];                 // Filter state
+    bool enabled;
+} biquad_t;
+
+static biquad_t hpf;
+static biquad_t shelf;
+
+// Limiter (mixer task only)
+static float delay[AUDIO_DSP_LOOKAHEAD_FRAMES];    // Chunk held back for look-ahead
+static float delay_need = 1.0f;     // Gain the held chunk requires
+static float gain = 1.0f;           // Gain at the end of the last chunk out
+static float release_coef;          // Share of the way back to 1.0 per chunk
+
+static float window_min = 1.0f;
+static uint32_t window_frames = 0;
+static volatile uint8_t gain_min_pct = 100;
+
+/**
+ * @brief Gain that brings a chunk's peak down to the ceiling
+ */
+static inline float required_gain(const float *x, size_t n)
+{
+    float peak = 0.0f;
+    for (size_t i = 0; i < n; i++) {
+        float a = fabsf(x[i]);
+        if (a > peak) peak = a;
+    }
+    return peak > AUDIO_DSP_CEILING ? AUDIO_DSP_CEILING / peak : 1.0f;
+}
+
+/**
+ * @brief Push one chunk in, get the previous chunk out limited
+ *
+ * The ramp for the held chunk ends at the lower of its own and the
+ * incoming chunk's required gain (after release), and starts at a gain
+ * already below its own requirement, so the whole ramp is too.
+ */
+static void limit_chunk(float *x)
+{
+    float in[AUDIO_DSP_LOOKAHEAD_FRAMES];
+    memcpy(in, x, sizeof(in));
+    float next_need = required_gain(in, AUDIO_DSP_LOOKAHEAD_FRAMES);
+
+    float target = gain + (1.0f - gain) * release_coef;
+    if (target > delay_need) target = delay_need;
+    if (target > next_need) target = next_need;
+
+    float g = gain;
+    float step = (target - gain) / AUDIO_DSP_LOOKAHEAD_FRAMES;
+    for (size_t i = 0; i < AUDIO_DSP_LOOKAHEAD_FRAMES; i++) {
+        g += step;
+        x[i] = delay[i] * g;
+    }
+
+    gain = target;
+    delay_need = next_need;
+    memcpy(delay, in, sizeof(delay));
+    if (gain < window_min) window_min = gain;
+}
+
+void audio_dsp_init(void)
+{
+    const float rate = (float)AUDIO_SAMPLE_RATE;
+
+    hpf.enabled = AUDIO_DSP_HPF_HZ > 0;
+    if (hpf.enabled) {
+        dsps_biquad_gen_hpf_f32(hpf.coef, AUDIO_DSP_HPF_HZ / rate, 0.707f);
+    }
+    shelf.enabled = AUDIO_DSP_SHELF_HZ > 0;
+    if (shelf.enabled) {
+        dsps_biquad_gen_highShelf_f32(shelf.coef, AUDIO_DSP_SHELF_HZ / rate, AUDIO_DSP_SHELF_DB, 0.707f);
+    }
+
+    float chunk_ms = AUDIO_DSP_LOOKAHEAD_FRAMES * 1000.0f / rate;
+    release_coef = 1.0f - expf(-chunk_ms / AUDIO_DSP_RELEASE_MS);
+
+    audio_dsp_reset();
+    ESP_LOGI(TAG, "Master DSP: HPF %d Hz, shelf %d Hz %+.1f dB, limit %d (%d-frame look-ahead)",
+             AUDIO_DSP_HPF_HZ, AUDIO_DSP_SHELF_HZ, (double)AUDIO_DSP_SHELF_DB,
+             AUDIO_DSP_CEILING, AUDIO_DSP_LOOKAHEAD_FRAMES);
+}
+
+void audio_dsp_reset(void)
+{
+    memset(hpf.w, 0, sizeof(hpf.w));
+    memset(shelf.w, 0, sizeof(shelf.w));
+    memset(delay, 0, sizeof(delay));
+    delay_need = 1.0f;
+    gain = 1.0f;
+}
+
+void audio_dsp_process(float *buf, size_t n)
+{
+    if (hpf.enabled) {
+        dsps_biquad_f32(buf, buf, (int)n, hpf.coef, hpf.w);
+    }
+    if (shelf.enabled) {
+        dsps_biquad_f32(buf, buf, (int)n, shelf.coef, shelf.w);
+    }
+
+    for (size_t off = 0; off < n; off += AUDIO_DSP_LOOKAHEAD_FRAMES) {
+        limit_chunk(buf + off);
+    }
+
+    window_frames += n;
+    if (window_frames >= GAIN_WINDOW_FRAMES) {
+        gain_min_pct = (uint8_t)lrintf(window_min * 100.0f);
+        window_min = gain;
+        window_frames = 0;
+    }
+}
+
+uint8_t audio_dsp_get_gain_min_pct(void)
+{
+    return gain_min_pct;
+}
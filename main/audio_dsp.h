@@ -0,0 +1,56 @@
+/**
+ * @file audio_dsp.h
+ * @brief Master bus post-processing: speaker EQ biquads and a look-ahead limiter
+ *
+ * Runs on the summed mixer block (AUDIO_DSP_ENABLE) in place of the hard
+ * clamp, so layered engine, effect and UI gains above full scale are
+ * turned down smoothly instead of clipping:
+ *
+ *   sum -> high-pass -> high shelf -> limiter (one chunk of look-ahead) -> int16
+ *
+ * The biquads are esp-dsp's (the ESP32-S3 build uses its vector
+ * implementation). The limiter works on AUDIO_DSP_LOOKAHEAD_FRAMES chunks:
+ * each chunk is held back one chunk while the next one's peak is measured,
+ * and the gain ramps linearly across it to the lower of both chunks'
+ * required gains, so no output sample exceeds the ceiling. Release is
+ * exponential per chunk.
+ *
+ * Mixer task only. Cost is PERF_STAGE_AUDIO_DSP.
+ */
+
+#ifndef AUDIO_DSP_H
+#define AUDIO_DSP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Compute the filter coefficients and clear all state
+ */
+void audio_dsp_init(void);
+
+/**
+ * @brief Clear the filter and look-ahead state
+ *
+ * Called when the mixer stops streaming, so the next sound starts from
+ * silence instead of the tail of the last one.
+ */
+void audio_dsp_reset(void);
+
+/**
+ * @brief Filter and limit one block in place
+ *
+ * Output is delayed by AUDIO_DSP_LOOKAHEAD_FRAMES and lies within
+ * +-AUDIO_DSP_CEILING.
+ * @param buf Samples on the int16 scale (may exceed it on input)
+ * @param n Frames, a multiple of AUDIO_DSP_LOOKAHEAD_FRAMES
+ */
+void audio_dsp_process(float *buf, size_t n);
+
+/**
+ * @brief Lowest limiter gain over the last second
+ * @return Percent (100 = not limiting)
+ */
+uint8_t audio_dsp_get_gain_min_pct(void);
+
+#endif // AUDIO_DSP_H
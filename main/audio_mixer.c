@@ -0,0 +1,369 @@
+/**
+ * @file audio_mixer.c
+ * @brief Single-owner audio mixer for the I2S output
+ *
+ * Each block the mixer asks engine_sound and sound for their buses, sums
+ * them with a ramped ducking gain on engine + effects, saturates once (or
+ * runs the master DSP with AUDIO_DSP_ENABLE) and writes the block to I2S. When no source is active it sleeps until woken
+ * (or AUDIO_IDLE_WAIT_MS), letting the DMA auto-clear output silence.
+ */
+
+#include "audio_mixer.h"
+#include "audio_dsp.h"
+#include "config.h"
+#include "sound.h"
+#include "engine_sound.h"
+#include "perf.h"
+#include "power.h"
+#include "health.h"
+#include "timeline.h"
+
+#include <math.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/i2s_std.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+
+static const char *TAG = "AUDIO_MIX";
+
+// I2S channel created by sound_init()
+extern i2s_chan_handle_t tx_handle;
+
+static TaskHandle_t mixer_task_handle = NULL;
+
+// Audio queued ahead of the DAC once the DMA ring is full
+#define DMA_QUEUED_US   ((uint32_t)((uint64_t)AUDIO_DMA_DESC_NUM * AUDIO_DMA_FRAME_NUM * 1000000 / AUDIO_SAMPLE_RATE))
+
+// Audio length of one block
+#define BLOCK_US        ((uint32_t)((uint64_t)AUDIO_BLOCK_FRAMES * 1000000 / AUDIO_SAMPLE_RATE))
+
+// Minimum DMA fill is published per window, like the perf stages
+#define FILL_WINDOW_US  1000000
+
+// Statistics (written by the mixer task, read by anyone)
+static volatile uint32_t dma_empty_events = 0;  // Raw DMA send-queue overflows (ISR)
+static volatile uint32_t dma_sent_count = 0;    // DMA buffers finished sending (ISR)
+static volatile uint8_t dma_fill_last = 0;
+static volatile uint8_t dma_fill_min = AUDIO_DMA_DESC_NUM;
+static volatile uint32_t underrun_count = 0;
+static volatile uint32_t latency_last_us = 0;
+static volatile uint32_t latency_max_us = 0;
+
+// Bus accumulators (mixer task only)
+static int32_t engine_bus[AUDIO_BLOCK_FRAMES];
+static int32_t effects_bus[AUDIO_BLOCK_FRAMES];
+static int32_t ui_bus[AUDIO_BLOCK_FRAMES];
+
+// Output block handed to i2s_channel_write() (mixer task only)
+static DMA_ATTR int16_t out_block[AUDIO_BLOCK_FRAMES * AUDIO_FRAME_BYTES / sizeof(int16_t)];
+
+#if AUDIO_DSP_ENABLE
+// Unclamped master bus for the EQ and limiter (mixer task only)
+static float dsp_block[AUDIO_BLOCK_FRAMES];
+#endif
+
+/**
+ * @brief Sum the buses into output frames
+ *
+ * The engine + effects gain ramps linearly from duck_from to duck_to
+ * across the block so ducking never steps audibly. With AUDIO_DSP_ENABLE
+ * the sum goes through the EQ and limiter before it is saturated, so the
+ * clamp only catches float rounding.
+ */
+static void mix_buses(int16_t *out, size_t n, int32_t duck_from, int32_t duck_to)
+{
+    int32_t gain_q16 = duck_from << 8;
+    int32_t step_q16 = ((duck_to - duck_from) << 8) / (int32_t)n;
+
+#if AUDIO_DSP_ENABLE
+    for (size_t i = 0; i < n; i++) {
+        dsp_block[i] = (float)((((engine_bus[i] + effects_bus[i]) * (int64_t)gain_q16) >> 16) + ui_bus[i]);
+        gain_q16 += step_q16;
+    }
+
+    uint32_t dsp_cycles = perf_cycles();
+    audio_dsp_process(dsp_block, n);
+    perf_stage_end(PERF_STAGE_AUDIO_DSP, dsp_cycles);
+
+    for (size_t i = 0; i < n; i++) {
+        int32_t mix = (int32_t)lrintf(dsp_block[i]);
+        if (mix > 32767) mix = 32767;
+        if (mix < -32768) mix = -32768;
+        sound_put_frame(out, i, (int16_t)mix);
+    }
+#else
+    for (size_t i = 0; i < n; i++) {
+        int32_t mix = (((engine_bus[i] + effects_bus[i]) * (int64_t)gain_q16) >> 16) + ui_bus[i];
+        if (mix > 32767) mix = 32767;
+        if (mix < -32768) mix = -32768;
+        sound_put_frame(out, i, (int16_t)mix);
+        gain_q16 += step_q16;
+    }
+#endif
+}
+
+/**
+ * @brief I2S send-queue overflow: the DMA ran out of written data (ISR)
+ *
+ * Also fires while the mixer idles on purpose, so the task only counts
+ * events that happen while it is streaming as underruns.
+ */
+static IRAM_ATTR bool on_dma_empty(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    dma_empty_events++;
+    return false;
+}
+
+/**
+ * @brief A DMA buffer finished sending (ISR)
+ *
+ * Buffers of auto-cleared silence are counted too; the task resynchronises
+ * its queued count whenever this runs ahead of what it wrote.
+ */
+static IRAM_ATTR bool on_dma_sent(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    TIMELINE_ISR_ENTER(TIMELINE_ISR_I2S_SENT);
+    dma_sent_count++;
+    TIMELINE_ISR_EXIT(TIMELINE_ISR_I2S_SENT);
+    return false;
+}
+
+/**
+ * @brief DMA fill tracking (mixer task only)
+ */
+typedef struct {
+    uint32_t queued;            // Blocks written, in dma_sent_count terms
+    uint32_t warmup;            // Blocks left before fill counts toward the minimum
+    uint8_t window_min;
+    uint32_t window_start_us;
+} fill_tracker_t;
+
+/**
+ * @brief Sample the DMA fill just before writing a block
+ * @param start true for the first block after idling (ring assumed empty)
+ */
+static void track_fill(fill_tracker_t *t, bool start)
+{
+    uint32_t sent = dma_sent_count;
+    if (start) {
+        t->queued = sent;
+        t->warmup = AUDIO_DMA_DESC_NUM;     // Ring is refilling, not starving
+    }
+
+    int32_t fill = (int32_t)(t->queued - sent);
+    if (fill < 0) {
+        // Ran dry (silence was sent): nothing of ours is queued
+        t->queued = sent;
+        fill = 0;
+    }
+    if (fill > AUDIO_DMA_DESC_NUM) fill = AUDIO_DMA_DESC_NUM;
+    dma_fill_last = (uint8_t)fill;
+
+    if (t->warmup > 0) {
+        t->warmup--;
+    } else if (fill < t->window_min) {
+        t->window_min = (uint8_t)fill;
+    }
+
+    uint32_t now = (uint32_t)esp_timer_get_time();
+    if (now - t->window_start_us >= FILL_WINDOW_US) {
+        dma_fill_min = t->window_min;
+        t->window_min = AUDIO_DMA_DESC_NUM;
+        t->window_start_us = now;
+    }
+}
+
+/**
+ * @brief Record a throttle-to-audio latency sample
+ * @param mark_us esp_timer timestamp of the demand change
+ *
+ * Called once the block reflecting the change is queued; it reaches the
+ * DAC after the rest of the (full) DMA ring has played.
+ */
+static void record_latency(uint32_t mark_us)
+{
+    uint32_t us = ((uint32_t)esp_timer_get_time() - mark_us) + DMA_QUEUED_US;
+    latency_last_us = us;
+    if (us > latency_max_us) latency_max_us = us;
+}
+
+/**
+ * @brief Mixer task: render, mix and write one block per iteration
+ */
+static void audio_mixer_task(void *arg)
+{
+    int32_t duck_q8 = 256;
+    size_t bytes_written;
+    uint32_t error_count = 0;
+    bool streaming = false;         // Previous iteration wrote a block
+    uint32_t empty_seen = 0;
+    fill_tracker_t fill = { .window_min = AUDIO_DMA_DESC_NUM };
+
+    while (true) {
+        // The idle wait is the longest this loop sleeps between blocks
+        health_beat(HEALTH_TASK_AUDIO, AUDIO_IDLE_WAIT_MS * 1000);
+        TIMELINE_MARK_BEGIN(TIMELINE_MARK_MIXER);
+        uint32_t mix_cycles = perf_cycles();
+
+        memset(engine_bus, 0, sizeof(engine_bus));
+        memset(effects_bus, 0, sizeof(effects_bus));
+        memset(ui_bus, 0, sizeof(ui_bus));
+
+        bool engine_active = engine_sound_render(engine_bus, effects_bus, AUDIO_BLOCK_FRAMES);
+        uint32_t latency_mark = engine_sound_take_latency_mark();
+        uint32_t ui_cycles = perf_cycles();
+        bool ui_active = sound_render(ui_bus, AUDIO_BLOCK_FRAMES);
+        if (ui_active) {
+            perf_stage_end(PERF_STAGE_AUDIO_UI, ui_cycles);
+        }
+
+        if (!engine_active && !ui_active) {
+            // Nothing to play: sleep until a source wakes us, at low clock
+            duck_q8 = 256;
+#if AUDIO_DSP_ENABLE
+            if (streaming) {
+                audio_dsp_reset();
+            }
+#endif
+            streaming = false;
+            TIMELINE_MARK_END(TIMELINE_MARK_MIXER);
+            power_hold(POWER_LOCK_AUDIO, false);
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(AUDIO_IDLE_WAIT_MS));
+            continue;
+        }
+        power_hold(POWER_LOCK_AUDIO, true);
+
+        // Duck immediately when UI audio starts, recover gradually after it ends
+        int32_t duck_next = duck_q8;
+        if (ui_active) {
+            duck_next = AUDIO_DUCK_GAIN_Q8;
+        } else if (duck_q8 < 256) {
+            duck_next = duck_q8 + (AUDIO_DUCK_RELEASE_Q8 * AUDIO_BLOCK_FRAMES) / 512;
+            if (duck_next > 256) duck_next = 256;
+        }
+        mix_buses(out_block, AUDIO_BLOCK_FRAMES, duck_q8, duck_next);
+        duck_q8 = duck_next;
+
+        perf_stage_end(PERF_STAGE_AUDIO_MIX, mix_cycles);
+        TIMELINE_MARK_END(TIMELINE_MARK_MIXER);
+
+        // DMA went empty since the last block while we were streaming
+        uint32_t empty_now = dma_empty_events;
+        if (streaming && empty_now != empty_seen) {
+            underrun_count += empty_now - empty_seen;
+        }
+        empty_seen = empty_now;
+        track_fill(&fill, !streaming);
+        streaming = true;
+
+        esp_err_t ret = i2s_channel_write(tx_handle, out_block,
+                                          AUDIO_BLOCK_FRAMES * AUDIO_FRAME_BYTES,
+                                          &bytes_written, pdMS_TO_TICKS(500));
+        if (ret != ESP_OK) {
+            // Only log occasionally to avoid flooding
+            if (++error_count % 100 == 1) {
+                ESP_LOGW(TAG, "I2S write error: %s (count=%lu)", esp_err_to_name(ret), error_count);
+            }
+            vTaskDelay(pdMS_TO_TICKS(5));  // Brief delay on error
+        } else {
+            fill.queued++;
+            if (latency_mark != 0) {
+                record_latency(latency_mark);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+esp_err_t audio_mixer_init(void)
+{
+    if (mixer_task_handle != NULL) {
+        return ESP_OK;
+    }
+    if (tx_handle == NULL) {
+        ESP_LOGE(TAG, "I2S channel not initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+#if AUDIO_DSP_ENABLE
+    audio_dsp_init();
+#endif
+
+    // Event callbacks can only be registered on a disabled channel
+    i2s_event_callbacks_t callbacks = {
+        .on_sent = on_dma_sent,
+        .on_send_q_ovf = on_dma_empty,
+    };
+    i2s_channel_disable(tx_handle);
+    esp_err_t err = i2s_channel_register_event_callback(tx_handle, &callbacks, NULL);
+    i2s_channel_enable(tx_handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Underrun / DMA fill tracking unavailable: %s", esp_err_to_name(err));
+    }
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        audio_mixer_task,
+        "audio_mix",
+        AUDIO_MIXER_TASK_STACK_SIZE,
+        NULL,
+        AUDIO_MIXER_TASK_PRIORITY,
+        &mixer_task_handle,
+        AUDIO_MIXER_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create mixer task");
+        mixer_task_handle = NULL;
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "Audio mixer started (%d Hz, %d-frame blocks, %s profile, %lums buffered%s)",
+             AUDIO_SAMPLE_RATE, AUDIO_BLOCK_FRAMES,
+             AUDIO_LOW_LATENCY ? "low-latency" : "standard",
+             (unsigned long)(DMA_QUEUED_US / 1000), AUDIO_DSP_ENABLE ? ", master DSP" : "");
+    return ESP_OK;
+}
+
+void audio_mixer_wake(void)
+{
+    if (mixer_task_handle != NULL) {
+        xTaskNotifyGive(mixer_task_handle);
+    }
+}
+
+void audio_mixer_get_stats(audio_mixer_stats_t *stats)
+{
+    stats->low_latency = AUDIO_LOW_LATENCY;
+    stats->buffered_us = DMA_QUEUED_US;
+    stats->underruns = underrun_count;
+    stats->latency_us = latency_last_us;
+    stats->latency_max_us = latency_max_us;
+    stats->block_us = BLOCK_US;
+    stats->dma_buffers = AUDIO_DMA_DESC_NUM;
+    stats->dma_fill = dma_fill_last;
+    stats->dma_fill_min = dma_fill_min;
+
+    perf_stage_summary_t mix;
+    perf_get_stage(PERF_STAGE_AUDIO_MIX, &mix);
+    uint32_t load = mix.avg_us * 100 / BLOCK_US;
+    uint32_t load_max = mix.max_us * 100 / BLOCK_US;
+    stats->load_pct = load > 255 ? 255 : (uint8_t)load;
+    stats->load_max_pct = load_max > 255 ? 255 : (uint8_t)load_max;
+
+    stats->dsp = AUDIO_DSP_ENABLE;
+#if AUDIO_DSP_ENABLE
+    perf_stage_summary_t dsp;
+    perf_get_stage(PERF_STAGE_AUDIO_DSP, &dsp);
+    uint32_t dsp_load = dsp.avg_us * 100 / BLOCK_US;
+    stats->dsp_load_pct = dsp_load > 255 ? 255 : (uint8_t)dsp_load;
+    stats->limit_gain_min_pct = audio_dsp_get_gain_min_pct();
+#else
+    stats->dsp_load_pct = 0;
+    stats->limit_gain_min_pct = 100;
+#endif
+}
@@ -0,0 +1,75 @@
+/**
+ * @file audio_mixer.h
+ * @brief Single-owner audio mixer for the I2S output
+ *
+ * One task renders every audio source block by block and is the only
+ * writer to the I2S channel:
+ * - engine bus:  engine layers (idle/rev/knock/jake, start, shutdown)
+ * - effects bus: engine effect voices (air brake, horn, beeps, ...)
+ * - UI bus:      queued chimes, beeps and menu prompts from sound.c
+ *
+ * Engine and effects are ducked while the UI bus is active, so prompts
+ * stay intelligible without cutting the engine out.
+ */
+
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Mixer buffering and latency statistics
+ */
+typedef struct {
+    bool low_latency;           // AUDIO_LOW_LATENCY profile active
+    uint32_t buffered_us;       // Audio queued ahead of the DAC by the DMA ring
+    uint32_t underruns;         // DMA ran dry while the mixer was streaming
+    uint32_t latency_us;        // Last throttle-to-audio latency
+    uint32_t latency_max_us;    // Worst throttle-to-audio latency since boot
+    uint32_t block_us;          // Audio duration of one mixer block
+    uint8_t dma_buffers;        // DMA ring size in blocks
+    uint8_t dma_fill;           // Blocks still queued in DMA at the last write
+    uint8_t dma_fill_min;       // Lowest fill at write time over the last second
+    uint8_t load_pct;           // Average block render time / block_us (last second)
+    uint8_t load_max_pct;       // Slowest block render time / block_us (last second)
+    bool dsp;                   // AUDIO_DSP_ENABLE master EQ + limiter active
+    uint8_t dsp_load_pct;       // Average master DSP time / block_us (part of load_pct)
+    uint8_t limit_gain_min_pct; // Lowest limiter gain over the last second (100 = not limiting)
+} audio_mixer_stats_t;
+
+/**
+ * @brief Start the mixer task
+ *
+ * Call after sound_init() (which creates the I2S channel) and
+ * engine_sound_init().
+ * @return ESP_OK on success
+ */
+esp_err_t audio_mixer_init(void);
+
+/**
+ * @brief Wake the mixer if it is idle
+ *
+ * Called by sources when they have something new to play, so playback
+ * starts at the next block instead of after the idle wait. Safe to call
+ * from any task, and before audio_mixer_init().
+ */
+void audio_mixer_wake(void);
+
+/**
+ * @brief Get buffering / underrun / latency / load statistics
+ *
+ * The DMA fill at write time is how much audio was left to play when the
+ * next block arrived: it falling towards zero means the mixer is close to
+ * missing its deadline. Per-layer render cost is in the perf stages
+ * (PERF_STAGE_AUDIO_*).
+ *
+ * Latency runs from a large RPM demand change in engine_sound_update()
+ * to when the block reflecting it reaches the DAC (write time plus the
+ * audio already queued in DMA).
+ * @param stats Filled with current values
+ */
+void audio_mixer_get_stats(audio_mixer_stats_t *stats);
+
+#endif // AUDIO_MIXER_H
@@ -0,0 +1,398 @@
+/**
+ * @file battery.c
+ * @brief Pack voltage/current sensing on ADC continuous mode (DMA)
+ *
+ * The conversion-done callback only wakes the task. The task drains every
+ * completed frame, sums the raw results per channel and converts the two
+ * means with the curve-fitting calibration, so the ADC calibration and
+ * filters run ~40 times a second whatever the sample rate. Pack voltage
+ * and current are then filtered per frame (EWMA, BATTERY_FILTER_SHIFT).
+ */
+
+#include "battery.h"
+#include "config.h"
+#include "tuning.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <string.h>
+#if BATTERY_ENABLED
+#include "esp_adc/adc_continuous.h"
+#include "esp_adc/adc_cali.h"
+#include "esp_adc/adc_cali_scheme.h"
+#endif
+
+static const char *TAG = "BATTERY";
+
+#define BATTERY_SETTLE_FRAMES   16      // Frames before cells are detected and alerts armed
+#define BATTERY_MIN_PACK_MV     2500    // Below this no pack is connected (USB power)
+#define BATTERY_CHANNELS        2       // Voltage, current
+
+static portMUX_TYPE battery_lock = portMUX_INITIALIZER_UNLOCKED;
+static battery_status_t status;
+static volatile battery_level_t level = BATTERY_LEVEL_UNKNOWN;
+
+#if BATTERY_ENABLED
+
+#define FRAME_BYTES             (BATTERY_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES)
+
+static adc_continuous_handle_t adc_handle = NULL;
+static adc_cali_handle_t cali[BATTERY_CHANNELS];
+static adc_channel_t adc_channel[BATTERY_CHANNELS];
+static int channel_count = 1;
+static TaskHandle_t battery_task_handle = NULL;
+static volatile uint32_t overflows = 0;
+static uint8_t frame_buf[FRAME_BYTES];
+
+// Filter state (battery task only)
+static int32_t pack_q4 = 0;             // Pack mV x16
+static int32_t rest_q4 = 0;             // Resting pack mV x16
+static int32_t current_q4 = 0;          // mA x16
+static int64_t used_ma_ms = 0;
+static int64_t last_frame_us = 0;
+static uint32_t settle_frames = 0;
+static battery_level_t pending_level = BATTERY_LEVEL_UNKNOWN;
+static int64_t pending_since_us = 0;
+
+/**
+ * @brief Conversion frame done (ISR): wake the task
+ */
+static bool IRAM_ATTR conv_done_callback(adc_continuous_handle_t handle,
+                                         const adc_continuous_evt_data_t *edata, void *user_data)
+{
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(battery_task_handle, &woken);
+    return woken == pdTRUE;
+}
+
+/**
+ * @brief Driver pool full (ISR): the task fell behind by a whole pool
+ */
+static bool IRAM_ATTR pool_ovf_callback(adc_continuous_handle_t handle,
+                                        const adc_continuous_evt_data_t *edata, void *user_data)
+{
+    overflows++;
+    return false;
+}
+
+/**
+ * @brief Mean of one frame's results (mV at the pin) per channel
+ * @return false if a channel had no samples
+ */
+static bool frame_means_mv(const uint8_t *buf, uint32_t len, int mv[BATTERY_CHANNELS])
+{
+    uint32_t sum[BATTERY_CHANNELS] = {0};
+    uint32_t count[BATTERY_CHANNELS] = {0};
+
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= len; i += SOC_ADC_DIGI_RESULT_BYTES) {
+        const adc_digi_output_data_t *p = (const adc_digi_output_data_t *)&buf[i];
+        for (int c = 0; c < channel_count; c++) {
+            if (p->type2.channel == adc_channel[c]) {
+                sum[c] += p->type2.data;
+                count[c]++;
+                break;
+            }
+        }
+    }
+
+    for (int c = 0; c < channel_count; c++) {
+        if (count[c] == 0) {
+            return false;
+        }
+        int raw = (int)((sum[c] + count[c] / 2) / count[c]);
+        if (cali[c] == NULL || adc_cali_raw_to_voltage(cali[c], raw, &mv[c]) != ESP_OK) {
+            mv[c] = (raw * 3100) / ((1 << SOC_ADC_DIGI_MAX_BITWIDTH) - 1);   // Uncalibrated, 12dB
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Level for a cell voltage, with hysteresis against the current one
+ */
+static battery_level_t level_for(uint16_t cell_mv, battery_level_t current)
+{
+    uint16_t low = BATTERY_LOW_CELL_MV;
+    uint16_t critical = BATTERY_CRITICAL_CELL_MV;
+
+    // Leaving a level needs the hysteresis on top of its threshold
+    if (current == BATTERY_LEVEL_CRITICAL) critical += BATTERY_HYSTERESIS_MV;
+    if (current >= BATTERY_LEVEL_LOW) low += BATTERY_HYSTERESIS_MV;
+
+    if (cell_mv < critical) return BATTERY_LEVEL_CRITICAL;
+    if (cell_mv < low) return BATTERY_LEVEL_LOW;
+    return BATTERY_LEVEL_OK;
+}
+
+/**
+ * @brief Filter one frame and update alerts, sag gain and the status
+ */
+static void process_frame(const int mv[BATTERY_CHANNELS], int64_t now)
+{
+    int32_t pack_mv = (int32_t)(((int64_t)mv[0] * BATTERY_DIVIDER_X1000) / 1000);
+    int32_t dt_ms = last_frame_us ? (int32_t)((now - last_frame_us) / 1000) : 0;
+    last_frame_us = now;
+
+    // Seed the filters on the first frame and after a pack is plugged in
+    if (settle_frames == 0) {
+        pack_q4 = pack_mv * 16;
+        rest_q4 = pack_q4;
+    } else {
+        pack_q4 += (pack_mv * 16 - pack_q4) >> BATTERY_FILTER_SHIFT;
+    }
+
+    // Resting voltage: follows rises at once, sags only slowly
+    if (pack_q4 > rest_q4) {
+        rest_q4 = pack_q4;
+    } else {
+        rest_q4 -= (rest_q4 - pack_q4) >> BATTERY_REST_DECAY_SHIFT;
+    }
+
+    int32_t current_ma = 0;
+    if (channel_count > 1) {
+        int32_t ma = ((mv[1] - BATTERY_CURRENT_OFFSET_MV) * 1000) / BATTERY_CURRENT_MV_PER_A;
+        current_q4 += (ma * 16 - current_q4) >> BATTERY_FILTER_SHIFT;
+        current_ma = current_q4 / 16;
+        if (current_ma > 0) {
+            used_ma_ms += (int64_t)current_ma * dt_ms;
+        }
+    }
+
+    bool connected = (pack_q4 / 16) >= BATTERY_MIN_PACK_MV;
+    if (!connected) {
+        settle_frames = 0;
+    } else if (settle_frames < BATTERY_SETTLE_FRAMES) {
+        settle_frames++;
+    }
+    bool settled = connected && settle_frames >= BATTERY_SETTLE_FRAMES;
+
+    uint16_t pack = (uint16_t)(pack_q4 / 16);
+    uint16_t rest = (uint16_t)(rest_q4 / 16);
+    uint8_t cells = status.cells;
+    if (!settled) {
+        cells = BATTERY_CELLS;
+    } else if (cells == 0) {
+        cells = (uint8_t)(pack / BATTERY_CELL_DETECT_MV + 1);
+        ESP_LOGI(TAG, "Pack %umV: %uS", pack, cells);
+    }
+    uint16_t cell_mv = cells ? pack / cells : 0;
+
+    // Alerts: a level must hold for BATTERY_ALERT_HOLD_MS before it's taken
+    battery_level_t new_level = level;
+    if (!settled || cells == 0) {
+        new_level = BATTERY_LEVEL_UNKNOWN;
+        pending_level = BATTERY_LEVEL_UNKNOWN;
+    } else {
+        battery_level_t target = level_for(cell_mv, level);
+        if (level == BATTERY_LEVEL_UNKNOWN) {
+            new_level = BATTERY_LEVEL_OK;
+        }
+        if (target != new_level) {
+            if (target != pending_level) {
+                pending_level = target;
+                pending_since_us = now;
+            } else if (now - pending_since_us >= (int64_t)BATTERY_ALERT_HOLD_MS * 1000) {
+                new_level = target;
+            }
+        } else {
+            pending_level = new_level;
+        }
+    }
+    if (new_level != level && new_level > BATTERY_LEVEL_OK) {
+        ESP_LOGW(TAG, "%s: %umV (%umV/cell)",
+                 new_level == BATTERY_LEVEL_CRITICAL ? "Critical" : "Low", pack, cell_mv);
+    }
+
+    // Sag gain: resting / present voltage
+    int32_t gain_q16 = 1 << 16;
+#if BATTERY_SAG_COMP_ENABLED
+    if (settled && pack > 0) {
+        gain_q16 = (int32_t)(((int64_t)rest << 16) / pack);
+        int32_t max_q16 = (BATTERY_SAG_MAX_GAIN_PCT << 16) / 100;
+        if (gain_q16 > max_q16) gain_q16 = max_q16;
+        if (gain_q16 < (1 << 16)) gain_q16 = 1 << 16;
+    }
+#endif
+    tuning_set_supply_gain_q16(gain_q16);
+
+    portENTER_CRITICAL(&battery_lock);
+    status.level = new_level;
+    status.cells = cells;
+    status.pack_mv = pack;
+    status.cell_mv = cell_mv;
+    status.rest_mv = rest;
+    status.current_ma = current_ma;
+    status.used_mah = (uint32_t)(used_ma_ms / 3600000);
+    status.sag_gain_pct = (uint16_t)((gain_q16 * 100 + (1 << 15)) >> 16);
+    status.frames++;
+    status.overflows = overflows;
+    portEXIT_CRITICAL(&battery_lock);
+    level = new_level;
+}
+
+/**
+ * @brief Battery task: one pass per completed DMA frame
+ */
+static void battery_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Drain every frame the driver holds (more than one if we were late)
+        uint32_t len = 0;
+        while (adc_continuous_read(adc_handle, frame_buf, FRAME_BYTES, &len, 0) == ESP_OK) {
+            int mv[BATTERY_CHANNELS] = {0};
+            if (frame_means_mv(frame_buf, len, mv)) {
+                process_frame(mv, esp_timer_get_time());
+            }
+        }
+    }
+}
+
+/**
+ * @brief Find the ADC1 channel of a pin and set up its calibration
+ */
+static esp_err_t setup_channel(int index, int gpio, adc_digi_pattern_config_t *pattern)
+{
+    adc_unit_t unit;
+    esp_err_t ret = adc_continuous_io_to_channel(gpio, &unit, &adc_channel[index]);
+    if (ret != ESP_OK || unit != ADC_UNIT_1) {
+        ESP_LOGE(TAG, "GPIO %d is not an ADC1 pin", gpio);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *pattern = (adc_digi_pattern_config_t){
+        .atten = ADC_ATTEN_DB_12,
+        .channel = adc_channel[index] & 0x7,
+        .unit = ADC_UNIT_1,
+        .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+    };
+
+    adc_cali_curve_fitting_config_t cali_config = {
+        .unit_id = ADC_UNIT_1,
+        .chan = adc_channel[index],
+        .atten = ADC_ATTEN_DB_12,
+        .bitwidth = SOC_ADC_DIGI_MAX_BITWIDTH,
+    };
+    cali[index] = NULL;
+    if (adc_cali_create_scheme_curve_fitting(&cali_config, &cali[index]) != ESP_OK) {
+        ESP_LOGW(TAG, "GPIO %d: no eFuse calibration, readings uncalibrated", gpio);
+        cali[index] = NULL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t battery_init(void)
+{
+    memset(&status, 0, sizeof(status));
+    status.cells = BATTERY_CELLS;
+    status.sag_gain_pct = 100;
+
+    adc_digi_pattern_config_t pattern[BATTERY_CHANNELS];
+    esp_err_t ret = setup_channel(0, PIN_BATTERY_VOLTAGE, &pattern[0]);
+#if BATTERY_CURRENT_ENABLED
+    if (ret == ESP_OK) {
+        ret = setup_channel(1, PIN_BATTERY_CURRENT, &pattern[1]);
+        channel_count = 2;
+    }
+#endif
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    adc_continuous_handle_cfg_t handle_config = {
+        .max_store_buf_size = FRAME_BYTES * 4,
+        .conv_frame_size = FRAME_BYTES,
+    };
+    ret = adc_continuous_new_handle(&handle_config, &adc_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "ADC handle failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    adc_continuous_config_t adc_config = {
+        .pattern_num = channel_count,
+        .adc_pattern = pattern,
+        .sample_freq_hz = BATTERY_SAMPLE_HZ,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+    };
+    ret = adc_continuous_config(adc_handle, &adc_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "ADC config failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    // The task must exist before the first frame completes
+    if (xTaskCreatePinnedToCore(battery_task, "battery", BATTERY_TASK_STACK_SIZE, NULL,
+                                BATTERY_TASK_PRIORITY, &battery_task_handle,
+                                BATTERY_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create battery task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    adc_continuous_evt_cbs_t callbacks = {
+        .on_conv_done = conv_done_callback,
+        .on_pool_ovf = pool_ovf_callback,
+    };
+    ret = adc_continuous_register_event_callbacks(adc_handle, &callbacks, NULL);
+    if (ret == ESP_OK) {
+        ret = adc_continuous_start(adc_handle);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "ADC start failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    status.present = true;
+    status.current_present = channel_count > 1;
+    ESP_LOGI(TAG, "Sensing on GPIO %d%s, %d conversions/s, %d per frame",
+             PIN_BATTERY_VOLTAGE, channel_count > 1 ? " + current" : "",
+             BATTERY_SAMPLE_HZ, BATTERY_FRAME_SAMPLES);
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t battery_init(void)
+{
+    memset(&status, 0, sizeof(status));
+    status.sag_gain_pct = 100;
+    ESP_LOGI(TAG, "Battery sensing disabled (pins used by the PWM receiver)");
+    return ESP_OK;
+}
+
+#endif // BATTERY_ENABLED
+
+void battery_get_status(battery_status_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&battery_lock);
+    memcpy(out, &status, sizeof(*out));
+    portEXIT_CRITICAL(&battery_lock);
+}
+
+battery_level_t battery_get_level(void)
+{
+    return level;
+}
+
+int battery_to_json(char *buf, size_t len)
+{
+    static const char *level_names[] = { "unknown", "ok", "low", "critical" };
+    battery_status_t st;
+    battery_get_status(&st);
+
+    return snprintf(buf, len,
+        "{\"present\":%s,\"level\":\"%s\",\"cells\":%u,\"packMv\":%u,\"cellMv\":%u,"
+        "\"restMv\":%u,\"current\":%s,\"currentMa\":%ld,\"usedMah\":%lu,\"sagGainPct\":%u,"
+        "\"frames\":%lu,\"overflows\":%lu}",
+        st.present ? "true" : "false", level_names[st.level], st.cells, st.pack_mv, st.cell_mv,
+        st.rest_mv, st.current_present ? "true" : "false", (long)st.current_ma,
+        (unsigned long)st.used_mah, st.sag_gain_pct,
+        (unsigned long)st.frames, (unsigned long)st.overflows);
+}
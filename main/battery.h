@@ -0,0 +1,77 @@
+/**
+ * @file battery.h
+ * @brief Pack voltage/current sensing on ADC continuous mode (DMA)
+ *
+ * The ADC converts the divider (and the optional shunt amplifier) into DMA
+ * frames of BATTERY_FRAME_SAMPLES conversions without the CPU. When a frame
+ * completes, the battery task averages it per channel, converts the means
+ * to millivolts once and filters them, so the cost is per frame rather than
+ * per sample. Each frame updates the level alerts and the ESC sag gain
+ * (tuning_set_supply_gain_q16()).
+ */
+
+#ifndef BATTERY_H
+#define BATTERY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/**
+ * @brief Pack level
+ */
+typedef enum {
+    BATTERY_LEVEL_UNKNOWN = 0,  // No sensing, or not settled yet
+    BATTERY_LEVEL_OK,
+    BATTERY_LEVEL_LOW,          // Below BATTERY_LOW_CELL_MV per cell
+    BATTERY_LEVEL_CRITICAL,     // Below BATTERY_CRITICAL_CELL_MV per cell
+} battery_level_t;
+
+/**
+ * @brief Battery readings (all filtered)
+ */
+typedef struct {
+    bool present;               // Sensing running
+    bool current_present;       // Shunt channel fitted
+    battery_level_t level;
+    uint8_t cells;              // Configured or detected
+    uint16_t pack_mv;
+    uint16_t cell_mv;           // pack_mv / cells
+    uint16_t rest_mv;           // Resting voltage (sag reference)
+    int32_t current_ma;         // Positive = discharge
+    uint32_t used_mah;          // Drawn since boot
+    uint16_t sag_gain_pct;      // ESC gain applied (100 = none)
+    uint32_t frames;            // DMA frames processed
+    uint32_t overflows;         // Frames dropped by the driver (task late)
+} battery_status_t;
+
+/**
+ * @brief Start the ADC and the battery task
+ *
+ * Does nothing (ESP_OK, not present) when BATTERY_ENABLED is 0.
+ * @return ESP_OK on success
+ */
+esp_err_t battery_init(void);
+
+/**
+ * @brief Get the latest readings
+ * @param status Pointer to status structure to fill
+ */
+void battery_get_status(battery_status_t *status);
+
+/**
+ * @brief Get the pack level (cheap, for per-tick checks)
+ * @return Current level
+ */
+battery_level_t battery_get_level(void);
+
+/**
+ * @brief Format the readings as a JSON object
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Characters written (as snprintf)
+ */
+int battery_to_json(char *buf, size_t len);
+
+#endif // BATTERY_H
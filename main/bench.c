@@ -0,0 +1,377 @@
+/**
+ * @file bench.c
+ * @brief On-device benchmark of the control and audio hot paths
+ */
+
+#include "bench.h"
+#include "config.h"
+#include "version.h"
+#include "tuning.h"
+#include "engine_sound.h"
+#include "adpcm.h"
+#include "sounds/sound_profiles.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "esp_system.h"
+#include "esp_chip_info.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+
+static const char *TAG = "BENCH";
+
+static bool bench_running = false;
+
+// Control loop samples, taken by the control task while armed
+static portMUX_TYPE control_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t control_wanted = 0;
+static uint32_t control_count = 0;
+static uint32_t control_min = 0;
+static uint32_t control_max = 0;
+static uint64_t control_sum = 0;
+
+void bench_measure(bench_fn_t fn, void *arg, uint32_t runs, bench_stat_t *stat)
+{
+    uint32_t min = UINT32_MAX, max = 0;
+    uint64_t sum = 0;
+
+    fn(arg);    // Warm-up: caches and first-call paths
+    for (uint32_t i = 0; i < runs; i++) {
+        uint32_t start = esp_cpu_get_cycle_count();
+        fn(arg);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        sum += cycles;
+        if (cycles < min) min = cycles;
+        if (cycles > max) max = cycles;
+    }
+
+    stat->runs = runs;
+    stat->min_cycles = runs ? min : 0;
+    stat->avg_cycles = runs ? (uint32_t)(sum / runs) : 0;
+    stat->max_cycles = max;
+}
+
+void bench_control_sample(uint32_t cycles)
+{
+    if (control_wanted == 0) {
+        return;
+    }
+
+    portENTER_CRITICAL(&control_lock);
+    if (control_wanted > 0) {
+        control_wanted--;
+        control_count++;
+        control_sum += cycles;
+        if (cycles < control_min) control_min = cycles;
+        if (cycles > control_max) control_max = cycles;
+    }
+    portEXIT_CRITICAL(&control_lock);
+}
+
+/**
+ * @brief Collect control loop passes from the control task
+ * @param stat Receives the passes seen before BENCH_CONTROL_TIMEOUT_MS
+ */
+static void bench_control(bench_stat_t *stat)
+{
+    portENTER_CRITICAL(&control_lock);
+    control_count = 0;
+    control_sum = 0;
+    control_min = UINT32_MAX;
+    control_max = 0;
+    control_wanted = BENCH_CONTROL_PASSES;
+    portEXIT_CRITICAL(&control_lock);
+
+    for (int waited = 0; control_wanted > 0 && waited < BENCH_CONTROL_TIMEOUT_MS; waited += 10) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    portENTER_CRITICAL(&control_lock);
+    control_wanted = 0;
+    stat->runs = control_count;
+    stat->min_cycles = control_count ? control_min : 0;
+    stat->avg_cycles = control_count ? (uint32_t)(control_sum / control_count) : 0;
+    stat->max_cycles = control_max;
+    portEXIT_CRITICAL(&control_lock);
+}
+
+/**
+ * @brief Every servo across the stick range with the reference calculation
+ */
+static void bench_servo_calc(void *arg)
+{
+    volatile uint16_t sink;
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        for (int16_t pos = -1000; pos <= 1000; pos += 100) {
+            sink = tuning_calc_servo_pulse(i, pos);
+        }
+    }
+    (void)sink;
+}
+
+/**
+ * @brief Same sweep through the compiled tables (what the control loop runs)
+ */
+static void bench_servo_lut(void *arg)
+{
+    volatile uint16_t sink;
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        for (int16_t pos = -1000; pos <= 1000; pos += 100) {
+            sink = tuning_lut_servo_pulse(STEER_MODE_ALL_AXLE, i, pos);
+        }
+    }
+    (void)sink;
+}
+
+#define BENCH_SERVO_CALLS   (SERVO_COUNT * 21)
+
+typedef struct {
+    const uint32_t *words;
+    size_t count;
+} bench_read_ctx_t;
+
+/**
+ * @brief Sum a block word by word (one load per 4 sample bytes)
+ */
+static void bench_read(void *arg)
+{
+    const bench_read_ctx_t *ctx = arg;
+    const volatile uint32_t *p = ctx->words;
+    uint32_t sum = 0;
+    for (size_t i = 0; i < ctx->count; i++) {
+        sum += p[i];
+    }
+    volatile uint32_t sink = sum;
+    (void)sink;
+}
+
+/**
+ * @brief Largest engine layer of the first built-in profile, as stored in flash
+ * @param bytes Receives the stored size
+ */
+static const int8_t *bench_flash_layer(size_t *bytes)
+{
+    const sound_profile_def_t *p = sound_profiles_get(SOUND_PROFILE_DEFAULT);
+    const sound_sample_t *layers[] = { &p->idle, &p->rev, &p->start, &p->knock };
+    const int8_t *best = NULL;
+    *bytes = 0;
+
+    for (int i = 0; i < 4; i++) {
+        if (layers[i]->samples == NULL) continue;
+        size_t n = layers[i]->format == SOUND_FORMAT_IMA_ADPCM ?
+                   adpcm_encoded_bytes(layers[i]->sample_count) : layers[i]->sample_count;
+        if (n > *bytes) {
+            *bytes = n;
+            best = layers[i]->samples;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Time word reads over a block of memory
+ * @param src Block to read (any alignment; the aligned part is read)
+ * @param bytes Block size
+ * @param stat Receives cycles per pass
+ * @return Bytes read per pass
+ */
+static size_t bench_read_block(const void *src, size_t bytes, bench_stat_t *stat)
+{
+    uintptr_t start = ((uintptr_t)src + 3) & ~(uintptr_t)3;
+    uintptr_t end = ((uintptr_t)src + bytes) & ~(uintptr_t)3;
+    bench_read_ctx_t ctx = {
+        .words = (const uint32_t *)start,
+        .count = end > start ? (end - start) / 4 : 0,
+    };
+    bench_measure(bench_read, &ctx, 8, stat);
+    return ctx.count * 4;
+}
+
+/**
+ * @brief Time reads from a heap copy of the flash layer
+ * @param caps Heap capabilities of the copy (internal SRAM or PSRAM)
+ * @return Bytes read per pass, 0 when no such memory is free
+ */
+static size_t bench_read_heap(const int8_t *flash, size_t bytes, uint32_t caps, bench_stat_t *stat)
+{
+    void *copy = NULL;
+    while (bytes >= 4096 && (copy = heap_caps_malloc(bytes, caps)) == NULL) {
+        bytes /= 2;
+    }
+    if (copy == NULL) {
+        memset(stat, 0, sizeof(*stat));
+        return 0;
+    }
+    memcpy(copy, flash, bytes);
+    size_t read = bench_read_block(copy, bytes, stat);
+    heap_caps_free(copy);
+    return read;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+/**
+ * @brief snprintf at buf + len, never past the end
+ * @return New length (clamped to size - 1)
+ */
+static int append(char *buf, size_t size, int len, const char *fmt, ...)
+{
+    if (len >= (int)size - 1) {
+        return len;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + len, size - len, fmt, ap);
+    va_end(ap);
+    len += n > 0 ? n : 0;
+    return len < (int)size ? len : (int)size - 1;
+}
+
+/**
+ * @brief Format a stat as "runs/min/avg/max" cycles plus the average in ns
+ * @param calls Calls per run (per-call figures are reported)
+ */
+static int append_stat(char *buf, size_t size, int len, const bench_stat_t *s,
+                       uint32_t calls, uint32_t mhz)
+{
+    uint32_t avg = s->avg_cycles / calls;
+    return append(buf, size, len,
+                  "\"runs\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu,\"avgNs\":%lu",
+                  (unsigned long)s->runs, (unsigned long)(s->min_cycles / calls),
+                  (unsigned long)avg, (unsigned long)(s->max_cycles / calls),
+                  (unsigned long)((uint64_t)avg * 1000 / mhz));
+}
+
+/**
+ * @brief Format a read test as bytes, cycles and MB/s
+ */
+static int append_read(char *buf, size_t size, int len, const char *name,
+                       size_t bytes, const bench_stat_t *s, uint32_t mhz)
+{
+    uint32_t mbps = s->avg_cycles ? (uint32_t)((uint64_t)bytes * mhz / s->avg_cycles) : 0;
+    return append(buf, size, len, "\"%s\":{\"bytes\":%u,\"cycles\":%lu,\"mbps\":%lu}",
+                  name, (unsigned)bytes, (unsigned long)s->avg_cycles, (unsigned long)mbps);
+}
+
+static esp_err_t bench_report(bench_fn_t status_fn, char *buf, size_t size)
+{
+    uint32_t mhz = esp_rom_get_cpu_ticks_per_us();
+    if (mhz == 0) mhz = 1;
+
+    esp_chip_info_t chip;
+    esp_chip_info(&chip);
+    size_t psram_bytes = heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+
+    int len = append(buf, size, 0,
+        "{\"board\":{\"chip\":\"%s\",\"rev\":%u,\"cores\":%u,\"cpuMhz\":%lu,"
+        "\"psramBytes\":%u,\"heapFree\":%lu"
+#if defined(CONFIG_ESPTOOLPY_FLASHFREQ) && defined(CONFIG_ESPTOOLPY_FLASHMODE)
+        ",\"flash\":\"" CONFIG_ESPTOOLPY_FLASHMODE " " CONFIG_ESPTOOLPY_FLASHFREQ "\""
+#endif
+        "},\"fw\":{\"version\":\"%s\",\"build\":\"%s\",\"git\":\"%s\",\"idf\":\"%s\"}",
+        CONFIG_IDF_TARGET, chip.revision, chip.cores, (unsigned long)mhz,
+        (unsigned)psram_bytes, (unsigned long)esp_get_free_heap_size(),
+        FW_VERSION, FW_BUILD_DATE, FW_GIT_HASH, esp_get_idf_version());
+
+    // Control loop pass (real ticks in the control task)
+    bench_stat_t stat;
+    bench_control(&stat);
+    len = append(buf, size, len, ",\"control\":{");
+    len = append_stat(buf, size, len, &stat, 1, mhz);
+
+    // Servo pulse: reference calculation vs compiled table, per call
+    bench_measure(bench_servo_calc, NULL, BENCH_RUNS, &stat);
+    len = append(buf, size, len, "},\"servoPulse\":{");
+    len = append_stat(buf, size, len, &stat, BENCH_SERVO_CALLS, mhz);
+    bench_measure(bench_servo_lut, NULL, BENCH_RUNS, &stat);
+    len = append(buf, size, len, "},\"servoLut\":{");
+    len = append_stat(buf, size, len, &stat, BENCH_SERVO_CALLS, mhz);
+    len = append(buf, size, len, "}");
+
+    // Web status update build
+    if (status_fn) {
+        bench_measure(status_fn, NULL, BENCH_RUNS, &stat);
+        len = append(buf, size, len, ",\"status\":{");
+        len = append_stat(buf, size, len, &stat, 1, mhz);
+        len = append(buf, size, len, "}");
+    }
+
+    // Engine mixing, every profile with and without effects
+    int32_t *acc = heap_caps_malloc(BENCH_MIX_FRAMES * sizeof(int32_t),
+                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (acc == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t err = ESP_OK;
+    len = append(buf, size, len, ",\"mix\":[");
+    int count = sound_profiles_count();
+    bool first = true;
+    for (int i = 0; i < count * 2 && err == ESP_OK; i++) {
+        sound_profile_t profile = (sound_profile_t)(i / 2);
+        bool effects = i & 1;
+        if (!sound_profiles_is_available(profile)) continue;
+        err = engine_sound_bench_mix(profile, effects, acc, BENCH_MIX_FRAMES,
+                                     BENCH_MIX_RUNS, &stat);
+        if (err == ESP_OK) {
+            len = append(buf, size, len, "%s{\"profile\":\"%s\",\"effects\":%s,\"frames\":%d,",
+                         first ? "" : ",", sound_profiles_get_name(profile),
+                         effects ? "true" : "false", BENCH_MIX_FRAMES);
+            len = append_stat(buf, size, len, &stat, 1, mhz);
+            len = append(buf, size, len, "}");
+            first = false;
+        }
+    }
+    heap_caps_free(acc);
+    if (err != ESP_OK) {
+        return err;
+    }
+    len = append(buf, size, len, "]");
+
+    // Sample reads: flash (through the cache) vs SRAM vs PSRAM copies
+    size_t layer_bytes;
+    const int8_t *layer = bench_flash_layer(&layer_bytes);
+    if (layer_bytes > BENCH_READ_BYTES) layer_bytes = BENCH_READ_BYTES;
+    if (layer != NULL) {
+        size_t bytes = bench_read_block(layer, layer_bytes, &stat);
+        len = append(buf, size, len, ",\"read\":{");
+        len = append_read(buf, size, len, "flash", bytes, &stat, mhz);
+        bytes = bench_read_heap(layer, layer_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, &stat);
+        len = append(buf, size, len, ",");
+        len = append_read(buf, size, len, "sram", bytes, &stat, mhz);
+        if (psram_bytes > 0) {
+            bytes = bench_read_heap(layer, layer_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, &stat);
+            len = append(buf, size, len, ",");
+            len = append_read(buf, size, len, "psram", bytes, &stat, mhz);
+        }
+        len = append(buf, size, len, "}");
+    }
+
+    append(buf, size, len, "}");
+    return ESP_OK;
+}
+
+esp_err_t bench_run(bench_fn_t status_fn, char *buf, size_t len)
+{
+    if (!tuning_is_motor_stopped() || engine_sound_get_state() != ENGINE_OFF) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (__atomic_exchange_n(&bench_running, true, __ATOMIC_SEQ_CST)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ESP_LOGI(TAG, "Benchmark started");
+    esp_err_t err = bench_report(status_fn, buf, len);
+    ESP_LOGI(TAG, "Benchmark %s", err == ESP_OK ? "done" : esp_err_to_name(err));
+
+    __atomic_store_n(&bench_running, false, __ATOMIC_SEQ_CST);
+    return err;
+}
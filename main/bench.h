@@ -0,0 +1,66 @@
+/**
+ * @file bench.h
+ * @brief On-device benchmark of the control and audio hot paths
+ *
+ * Times one control loop pass, engine mixing (every profile, with and
+ * without effects), the web status build, servo pulse calculation and
+ * flash/RAM/PSRAM sample reads with the CPU cycle counter, and reports
+ * them as JSON together with the chip, memory and firmware they ran on,
+ * so boards and firmware versions can be compared.
+ *
+ * Only runs with the motor stopped and the engine sound off. The control
+ * pass is measured by the control task itself on its next ticks; every
+ * other stage runs in the caller's task.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/**
+ * @brief Cycle counts of one benchmarked stage
+ */
+typedef struct {
+    uint32_t runs;
+    uint32_t min_cycles;
+    uint32_t avg_cycles;
+    uint32_t max_cycles;
+} bench_stat_t;
+
+/**
+ * @brief Function under test
+ * @param arg Context passed to bench_measure()
+ */
+typedef void (*bench_fn_t)(void *arg);
+
+/**
+ * @brief Time a function over a number of runs
+ * @param fn Function under test
+ * @param arg Context passed to fn
+ * @param runs Number of timed calls (one untimed warm-up call comes first)
+ * @param stat Receives min/avg/max cycles per call
+ */
+void bench_measure(bench_fn_t fn, void *arg, uint32_t runs, bench_stat_t *stat);
+
+/**
+ * @brief Record the cycles of one control loop pass (control task)
+ *
+ * Returns at once unless bench_run() is waiting for control samples.
+ * @param cycles Cycle count of the pass
+ */
+void bench_control_sample(uint32_t cycles);
+
+/**
+ * @brief Run the whole suite and format the report
+ * @param status_fn Builds one web status update (timed as "status"), or NULL
+ * @param buf Output buffer for the JSON report
+ * @param len Buffer size
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if the motor or engine is running
+ *         or a run is already in progress, ESP_ERR_NO_MEM
+ */
+esp_err_t bench_run(bench_fn_t status_fn, char *buf, size_t len);
+
+#endif // BENCH_H
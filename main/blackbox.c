@@ -0,0 +1,409 @@
+/**
+ * @file blackbox.c
+ * @brief Failsafe black box implementation
+ *
+ * Slot layout: blackbox_header_t at offset 0, records from offset
+ * BLACKBOX_RECORD_OFFSET. A slot is erased before the snapshot window is
+ * chosen and its magic is written last, so a save cut short by a reset
+ * leaves an empty slot rather than a bad event.
+ */
+
+#include "blackbox.h"
+#include "config.h"
+#include "tuning.h"
+#include "perf.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_attr.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "BLACKBOX";
+
+#define BLACKBOX_PARTITION_LABEL    "blackbox"
+#define BLACKBOX_PARTITION_SUBTYPE  0x42
+#define BLACKBOX_RECORD_OFFSET      64      // Room for the header to grow
+#define BLACKBOX_COPY_CHUNK         16      // Records copied per flash write
+#define BLACKBOX_RTC_MAGIC          0x52425452  // "RTBR"
+
+_Static_assert(sizeof(blackbox_header_t) == 32, "black box header layout changed: bump BLACKBOX_VERSION");
+_Static_assert(BLACKBOX_RECORD_OFFSET >= sizeof(blackbox_header_t), "header overlaps records");
+_Static_assert(BLACKBOX_RECORD_OFFSET + BLACKBOX_RECORDS * sizeof(trace_record_t) <= BLACKBOX_SLOT_SIZE,
+               "BLACKBOX_RECORDS do not fit a slot");
+_Static_assert(BLACKBOX_RTC_RECORDS <= BLACKBOX_RECORDS, "RTC ring larger than a slot");
+_Static_assert(BLACKBOX_SLOT_SIZE % 4096 == 0, "slots must be whole flash sectors");
+
+// Survives panics, watchdog resets and (usually) brownouts; garbage after power-on
+typedef struct {
+    uint32_t magic;
+    uint32_t head;              // Records written since boot
+    trace_record_t records[BLACKBOX_RTC_RECORDS];
+} rtc_ring_t;
+
+static RTC_NOINIT_ATTR rtc_ring_t rtc_ring;
+
+static const esp_partition_t *part = NULL;
+static int slot_count = 0;
+static blackbox_header_t slots[BLACKBOX_SLOTS];     // Cached headers, magic 0 if empty
+static uint32_t next_seq = 1;
+static SemaphoreHandle_t slots_mutex = NULL;
+static TaskHandle_t writer_task = NULL;
+
+// Crash snapshot rescued from RTC memory, saved by the writer task
+static trace_record_t *crash_records = NULL;
+static size_t crash_count = 0;
+static uint8_t crash_cause = 0;
+
+// Control task -> writer
+static volatile uint8_t pending_cause = 0;
+static volatile int64_t pending_us = 0;
+static int64_t last_trigger_us = 0;         // Control task only
+
+static void blackbox_task(void *arg);
+
+// ============================================================================
+// SLOTS
+// ============================================================================
+
+static bool header_valid(const blackbox_header_t *h)
+{
+    return h->magic == BLACKBOX_MAGIC && h->version == BLACKBOX_VERSION &&
+           h->record_size == sizeof(trace_record_t) && h->count <= BLACKBOX_RECORDS;
+}
+
+/**
+ * @brief Slot to overwrite next: the first empty one, else the oldest
+ */
+static int pick_slot(void)
+{
+    int oldest = 0;
+    for (int i = 0; i < slot_count; i++) {
+        if (slots[i].magic != BLACKBOX_MAGIC) {
+            return i;
+        }
+        if (slots[i].seq < slots[oldest].seq) {
+            oldest = i;
+        }
+    }
+    return oldest;
+}
+
+static void scan_slots(void)
+{
+    for (int i = 0; i < slot_count; i++) {
+        blackbox_header_t h;
+        if (esp_partition_read(part, (size_t)i * BLACKBOX_SLOT_SIZE, &h, sizeof(h)) != ESP_OK ||
+            !header_valid(&h)) {
+            memset(&h, 0, sizeof(h));
+        } else if (h.seq >= next_seq) {
+            next_seq = h.seq + 1;
+        }
+        slots[i] = h;
+    }
+}
+
+/**
+ * @brief Erase a slot and drop it from the cache (writer task)
+ */
+static esp_err_t slot_erase(int slot)
+{
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+    memset(&slots[slot], 0, sizeof(slots[slot]));
+    xSemaphoreGive(slots_mutex);
+
+    perf_flash_begin();
+    esp_err_t err = esp_partition_erase_range(part, (size_t)slot * BLACKBOX_SLOT_SIZE, BLACKBOX_SLOT_SIZE);
+    perf_flash_end();
+    return err;
+}
+
+/**
+ * @brief Write the header of a filled slot, magic last (writer task)
+ */
+static esp_err_t slot_commit(int slot, blackbox_header_t *h)
+{
+    size_t base = (size_t)slot * BLACKBOX_SLOT_SIZE;
+    uint32_t magic = h->magic;
+
+    h->magic = 0xFFFFFFFF;      // Erased flash: left for the final write
+    perf_flash_begin();
+    esp_err_t err = esp_partition_write(part, base, h, sizeof(*h));
+    h->magic = magic;
+    if (err == ESP_OK) {
+        err = esp_partition_write(part, base, &magic, sizeof(magic));
+    }
+    perf_flash_end();
+    if (err == ESP_OK) {
+        xSemaphoreTake(slots_mutex, portMAX_DELAY);
+        slots[slot] = *h;
+        xSemaphoreGive(slots_mutex);
+    }
+    return err;
+}
+
+static void header_fill(blackbox_header_t *h, uint8_t cause, uint32_t uptime_ms, uint32_t count, uint32_t crc)
+{
+    *h = (blackbox_header_t){
+        .magic = BLACKBOX_MAGIC,
+        .version = BLACKBOX_VERSION,
+        .record_size = sizeof(trace_record_t),
+        .seq = next_seq++,
+        .cause = cause,
+        .rate_hz = tuning_get_config()->control.loop_rate_hz,
+        .uptime_ms = uptime_ms,
+        .count = count,
+        .crc32 = crc,
+    };
+}
+
+// ============================================================================
+// SAVING
+// ============================================================================
+
+/**
+ * @brief Save the snapshot rescued from RTC memory at boot
+ */
+static void save_crash(void)
+{
+    int slot = pick_slot();
+    size_t bytes = crash_count * sizeof(trace_record_t);
+    esp_err_t err = slot_erase(slot);
+    if (err == ESP_OK) {
+        perf_flash_begin();
+        err = esp_partition_write(part, (size_t)slot * BLACKBOX_SLOT_SIZE + BLACKBOX_RECORD_OFFSET,
+                                  crash_records, bytes);
+        perf_flash_end();
+    }
+    if (err == ESP_OK) {
+        blackbox_header_t h;
+        header_fill(&h, crash_cause, crash_records[crash_count - 1].t_us / 1000, crash_count,
+                    esp_rom_crc32_le(0, (const uint8_t *)crash_records, bytes));
+        err = slot_commit(slot, &h);
+    }
+
+    if (err == ESP_OK) {
+        ESP_LOGW(TAG, "Saved %u records from before the %s reset to slot %d",
+                 (unsigned)crash_count, blackbox_cause_name(crash_cause), slot);
+    } else {
+        ESP_LOGE(TAG, "Failed to save crash snapshot: %s", esp_err_to_name(err));
+    }
+    free(crash_records);
+    crash_records = NULL;
+    crash_count = 0;
+}
+
+/**
+ * @brief Save the flight recorder around a trigger
+ *
+ * The slot is erased while the post-trigger window runs, so only the
+ * record writes remain once the window closes and the records are still
+ * well inside even the small internal-RAM ring.
+ */
+static void save_trigger(uint8_t cause, int64_t trigger_us)
+{
+    int slot = pick_slot();
+    esp_err_t err = slot_erase(slot);
+
+    int64_t wait_ms = BLACKBOX_POST_TRIGGER_MS - (esp_timer_get_time() - trigger_us) / 1000;
+    if (wait_ms > 0) {
+        vTaskDelay(pdMS_TO_TICKS(wait_ms));
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to erase slot %d: %s", slot, esp_err_to_name(err));
+        return;
+    }
+
+    uint32_t end = trace_head();
+    uint32_t count = end < BLACKBOX_RECORDS ? end : BLACKBOX_RECORDS;
+    uint32_t start = end - count;
+    size_t offset = (size_t)slot * BLACKBOX_SLOT_SIZE + BLACKBOX_RECORD_OFFSET;
+    uint32_t crc = 0;
+    trace_record_t chunk[BLACKBOX_COPY_CHUNK];
+
+    if (count == 0) {
+        return;
+    }
+    for (uint32_t done = 0; done < count && err == ESP_OK; ) {
+        uint32_t n = count - done < BLACKBOX_COPY_CHUNK ? count - done : BLACKBOX_COPY_CHUNK;
+        if (!trace_copy(start + done, chunk, n)) {
+            err = ESP_ERR_INVALID_STATE;    // Overtaken by the recorder
+            break;
+        }
+        crc = esp_rom_crc32_le(crc, (const uint8_t *)chunk, n * sizeof(trace_record_t));
+        perf_flash_begin();
+        err = esp_partition_write(part, offset, chunk, n * sizeof(trace_record_t));
+        perf_flash_end();
+        offset += n * sizeof(trace_record_t);
+        done += n;
+    }
+    if (err == ESP_OK) {
+        blackbox_header_t h;
+        header_fill(&h, cause, trigger_us / 1000, count, crc);
+        err = slot_commit(slot, &h);
+    }
+
+    if (err == ESP_OK) {
+        ESP_LOGW(TAG, "Saved %u records around %s to slot %d", (unsigned)count,
+                 blackbox_cause_name(cause), slot);
+    } else {
+        ESP_LOGE(TAG, "Failed to save %s snapshot: %s", blackbox_cause_name(cause), esp_err_to_name(err));
+    }
+}
+
+static void blackbox_task(void *arg)
+{
+    (void)arg;
+
+    if (crash_records) {
+        save_crash();
+    }
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint8_t cause = pending_cause;
+        int64_t trigger_us = pending_us;
+        pending_cause = 0;
+        if (cause) {
+            save_trigger(cause, trigger_us);
+        }
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Copy the RTC ring out if the last reset was a crash, then restart it
+ */
+static void rescue_rtc_ring(void)
+{
+    uint8_t cause = 0;
+    switch (esp_reset_reason()) {
+        case ESP_RST_PANIC:     cause = BLACKBOX_CAUSE_PANIC;    break;
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:       cause = BLACKBOX_CAUSE_WATCHDOG; break;
+        case ESP_RST_BROWNOUT:  cause = BLACKBOX_CAUSE_BROWNOUT; break;
+        default:                break;
+    }
+
+    uint32_t head = rtc_ring.head;
+    size_t count = head < BLACKBOX_RTC_RECORDS ? head : BLACKBOX_RTC_RECORDS;
+    if (cause && rtc_ring.magic == BLACKBOX_RTC_MAGIC && count > 0) {
+        crash_records = malloc(count * sizeof(trace_record_t));
+        if (crash_records) {
+            for (size_t i = 0; i < count; i++) {
+                crash_records[i] = rtc_ring.records[(head - count + i) % BLACKBOX_RTC_RECORDS];
+            }
+            crash_count = count;
+            crash_cause = cause;
+        }
+    }
+
+    rtc_ring.head = 0;
+    rtc_ring.magic = BLACKBOX_RTC_MAGIC;
+}
+
+esp_err_t blackbox_init(void)
+{
+    rescue_rtc_ring();
+
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, BLACKBOX_PARTITION_SUBTYPE,
+                                    BLACKBOX_PARTITION_LABEL);
+    if (!part) {
+        ESP_LOGW(TAG, "No blackbox partition, black box disabled");
+        free(crash_records);
+        crash_records = NULL;
+        return ESP_ERR_NOT_FOUND;
+    }
+    slot_count = part->size / BLACKBOX_SLOT_SIZE;
+    if (slot_count > BLACKBOX_SLOTS) {
+        slot_count = BLACKBOX_SLOTS;
+    }
+
+    slots_mutex = xSemaphoreCreateMutex();
+    if (!slots_mutex) {
+        return ESP_ERR_NO_MEM;
+    }
+    scan_slots();
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        blackbox_task,
+        "blackbox",
+        BLACKBOX_TASK_STACK_SIZE,
+        NULL,
+        BLACKBOX_TASK_PRIORITY,
+        &writer_task,
+        BLACKBOX_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create black box task");
+        return ESP_FAIL;
+    }
+
+    int stored = 0;
+    for (int i = 0; i < slot_count; i++) {
+        stored += slots[i].magic == BLACKBOX_MAGIC;
+    }
+    ESP_LOGI(TAG, "Black box: %d of %d events stored", stored, slot_count);
+    return ESP_OK;
+}
+
+void blackbox_mirror(const trace_record_t *record)
+{
+    uint32_t head = rtc_ring.head;
+    rtc_ring.records[head % BLACKBOX_RTC_RECORDS] = *record;
+    rtc_ring.head = head + 1;
+}
+
+void blackbox_trigger(blackbox_cause_t cause)
+{
+    int64_t now = esp_timer_get_time();
+    if (!writer_task || pending_cause ||
+        (last_trigger_us && now - last_trigger_us < (int64_t)BLACKBOX_MIN_INTERVAL_MS * 1000)) {
+        return;
+    }
+
+    last_trigger_us = now;
+    pending_us = now;
+    pending_cause = cause;
+    xTaskNotifyGive(writer_task);
+}
+
+bool blackbox_get_event(int slot, blackbox_header_t *header)
+{
+    if (!part || slot < 0 || slot >= slot_count) {
+        return false;
+    }
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+    *header = slots[slot];
+    xSemaphoreGive(slots_mutex);
+    return header->magic == BLACKBOX_MAGIC;
+}
+
+esp_err_t blackbox_read(int slot, size_t first, trace_record_t *out, size_t count)
+{
+    if (!part || slot < 0 || slot >= slot_count || first + count > BLACKBOX_RECORDS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return esp_partition_read(part, (size_t)slot * BLACKBOX_SLOT_SIZE + BLACKBOX_RECORD_OFFSET +
+                              first * sizeof(trace_record_t), out, count * sizeof(trace_record_t));
+}
+
+const char *blackbox_cause_name(uint8_t cause)
+{
+    switch (cause) {
+        case BLACKBOX_CAUSE_FAILSAFE: return "failsafe";
+        case BLACKBOX_CAUSE_PANIC:    return "panic";
+        case BLACKBOX_CAUSE_WATCHDOG: return "watchdog";
+        case BLACKBOX_CAUSE_BROWNOUT: return "brownout";
+        default:                      return "unknown";
+    }
+}
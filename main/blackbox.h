@@ -0,0 +1,91 @@
+/**
+ * @file blackbox.h
+ * @brief Failsafe black box: flight recorder snapshots that survive reboot
+ *
+ * On failsafe the last BLACKBOX_RECORDS ticks of the flight recorder are
+ * written to the "blackbox" flash partition by a low-priority task. Panics,
+ * watchdog resets and brownouts can't write flash, so the control task also
+ * mirrors every tick into a small RTC memory ring that survives warm resets;
+ * it is saved at the next boot. The newest BLACKBOX_SLOTS events are kept.
+ */
+
+#ifndef BLACKBOX_H
+#define BLACKBOX_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "trace.h"
+
+#define BLACKBOX_MAGIC          0x584F4242  // "BBOX"
+#define BLACKBOX_VERSION        1
+
+/**
+ * @brief What froze a snapshot
+ */
+typedef enum {
+    BLACKBOX_CAUSE_FAILSAFE = 1,    // RC signal lost
+    BLACKBOX_CAUSE_PANIC,           // Reset by a panic (from the RTC ring)
+    BLACKBOX_CAUSE_WATCHDOG,        // Reset by a task or interrupt watchdog
+    BLACKBOX_CAUSE_BROWNOUT,        // Reset by the brownout detector
+} blackbox_cause_t;
+
+/**
+ * @brief Stored event (head of a flash slot, followed by the records)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;             // BLACKBOX_MAGIC, written last
+    uint16_t version;           // BLACKBOX_VERSION
+    uint16_t record_size;       // sizeof(trace_record_t)
+    uint32_t seq;               // Event number, increasing across reboots
+    uint8_t cause;              // blackbox_cause_t
+    uint8_t reserved;
+    uint16_t rate_hz;           // Control loop rate when saved
+    uint32_t uptime_ms;         // Uptime when frozen (for resets: when saved at boot)
+    uint32_t count;             // Records that follow
+    uint32_t crc32;             // CRC-32 of the records
+    uint32_t reserved2;
+} blackbox_header_t;
+
+/**
+ * @brief Find stored events, save an RTC snapshot left by a crash, start the writer
+ * Call after trace_init() and tuning_init().
+ */
+esp_err_t blackbox_init(void);
+
+/**
+ * @brief Mirror a tick into the RTC ring (control task only, never blocks)
+ */
+void blackbox_mirror(const trace_record_t *record);
+
+/**
+ * @brief Ask for a snapshot of the flight recorder (control task, never blocks)
+ *
+ * The writer waits BLACKBOX_POST_TRIGGER_MS so the snapshot also shows the
+ * moments after the event. Triggers within BLACKBOX_MIN_INTERVAL_MS of the
+ * last saved one are ignored, so a flapping link can't wear out the flash.
+ */
+void blackbox_trigger(blackbox_cause_t cause);
+
+/**
+ * @brief Get a stored event's header
+ * @param slot 0..BLACKBOX_SLOTS-1
+ * @return false if the slot is empty or invalid
+ */
+bool blackbox_get_event(int slot, blackbox_header_t *header);
+
+/**
+ * @brief Read records of a stored event
+ * @param slot Slot of an event returned by blackbox_get_event()
+ * @param first Index of the first record
+ * @param out Destination for count records
+ */
+esp_err_t blackbox_read(int slot, size_t first, trace_record_t *out, size_t count);
+
+/**
+ * @brief Name of a cause for logs and the web UI
+ */
+const char *blackbox_cause_name(uint8_t cause);
+
+#endif // BLACKBOX_H
@@ -2,7 +2,11 @@
  * @file calibration.c
  * @brief RC calibration system implementation
  *
- * Manual per-channel calibration with step-by-step user control.
+ * Manual per-channel calibration with step-by-step user control, and an
+ * all-channel mode driven by the stick movements alone. Values come from the
+ * rc_input calibration capture, which sees every pulse: a center is the
+ * short-term mean of a still stick and an endpoint is the furthest pulse
+ * reached during its step.
  */
 
 #include "calibration.h"
@@ -10,6 +14,7 @@
 #include "nvs_storage.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include <stdio.h>
 #include <string.h>
 
 static const char *TAG = "CALIBRATION";
@@ -33,6 +38,67 @@ static uint16_t cal_recorded_center = 1500;
 static uint16_t cal_recorded_min = 1000;
 static uint16_t cal_recorded_max = 2000;
 
+// All-channel mode
+static bool cal_all = false;
+static uint8_t cal_active_mask = 0;         // Channels with signal when centers were taken
+static uint8_t cal_stable_mask = 0;
+static uint8_t cal_swept_mask = 0;
+static uint32_t cal_stable_since_ms = 0;    // 0 = not settled
+static uint16_t cal_auto_center[RC_CHANNEL_COUNT];
+static char cal_message_buf[48];
+
+static uint32_t cal_now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Whether a capture shows a stick held still
+ */
+static bool capture_stable(const rc_cal_capture_t *c)
+{
+    return c->count >= CAL_STABLE_MIN_PULSES && c->jitter_us <= CAL_STABLE_JITTER_US;
+}
+
+/**
+ * @brief Captured pulse furthest from a center (endpoint of a step)
+ */
+static uint16_t capture_extreme(const rc_cal_capture_t *c, uint16_t center)
+{
+    int below = (int)center - (int)c->min_us;
+    int above = (int)c->max_us - (int)center;
+    return (below > above) ? c->min_us : c->max_us;
+}
+
+/**
+ * @brief Track how long the settle condition has held
+ * @return true once it has held for CAL_STABLE_HOLD_MS
+ */
+static bool settled_for_hold(bool settled)
+{
+    if (!settled) {
+        cal_stable_since_ms = 0;
+        return false;
+    }
+    uint32_t now = cal_now_ms();
+    if (cal_stable_since_ms == 0) {
+        cal_stable_since_ms = now ? now : 1;
+        return false;
+    }
+    return (now - cal_stable_since_ms) >= CAL_STABLE_HOLD_MS;
+}
+
+/**
+ * @brief Save calibration data after a completed calibration
+ */
+static esp_err_t save_calibration(void)
+{
+    cal_data.calibrated = true;
+    cal_data.magic = CALIBRATION_MAGIC;
+    cal_data.version = CALIBRATION_VERSION;
+    return nvs_storage_save_deferred(NVS_BLOB_CALIBRATION, &cal_data, sizeof(calibration_data_t));
+}
+
 esp_err_t calibration_init(calibration_data_t *data)
 {
     ESP_LOGI(TAG, "Initializing calibration system...");
@@ -79,46 +145,179 @@ esp_err_t calibration_start_channel(rc_channel_t channel)
 
     ESP_LOGI(TAG, "Starting calibration for %s", channel_names[channel]);
 
+    cal_all = false;
     cal_channel = channel;
     cal_step = CAL_STEP_CENTER;
     cal_message = "Center the stick, then press Next";
     cal_recorded_center = 1500;
     cal_recorded_min = 1000;
     cal_recorded_max = 2000;
+    rc_input_cal_capture_start(1u << channel);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Take all-channel centers and start capturing the sweep
+ */
+static void auto_begin_sweep(void)
+{
+    cal_active_mask = 0;
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        rc_cal_capture_t c;
+        rc_input_cal_capture_get((rc_channel_t)i, &c);
+        if (c.count == 0) {
+            continue;
+        }
+        cal_auto_center[i] = c.recent_us;
+        cal_active_mask |= (uint8_t)(1u << i);
+        ESP_LOGI(TAG, "  %s center recorded: %d us (jitter %d us)",
+                 channel_names[i], c.recent_us, c.jitter_us);
+    }
+
+    rc_input_cal_capture_start(cal_active_mask);
+    cal_swept_mask = 0;
+    cal_stable_since_ms = 0;
+    cal_step = CAL_STEP_AUTO_SWEEP;
+    cal_message = "Move every stick and switch to both ends, then let go";
+}
+
+/**
+ * @brief Apply the swept channels and save (all-channel mode)
+ */
+static esp_err_t auto_finish(void)
+{
+    int applied = 0;
+
+    rc_input_cal_capture_start(0);
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        if (!(cal_swept_mask & (1u << i))) {
+            continue;
+        }
+        rc_cal_capture_t c;
+        rc_input_cal_capture_get((rc_channel_t)i, &c);
+
+        // Switches and non-centering knobs rest near an end: use the midpoint
+        uint16_t center = cal_auto_center[i];
+        uint16_t quarter = (c.max_us - c.min_us) / 4;
+        if (center < c.min_us + quarter || center > c.max_us - quarter) {
+            center = (c.min_us + c.max_us) / 2;
+        }
+
+        cal_data.channels[i].min = c.min_us;
+        cal_data.channels[i].center = center;
+        cal_data.channels[i].max = c.max_us;
+        cal_data.channels[i].deadzone = DEFAULT_DEADZONE_US;
+        applied++;
+        ESP_LOGI(TAG, "  %s: %d / %d / %d", channel_names[i], c.min_us, center, c.max_us);
+    }
+
+    if (applied == 0) {
+        cal_step = CAL_STEP_IDLE;
+        cal_all = false;
+        cal_message = "No channels were moved";
+        return ESP_OK;
+    }
+
+    if (save_calibration() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save calibration!");
+        cal_step = CAL_STEP_IDLE;
+        cal_all = false;
+        cal_message = "Failed to save";
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "Calibration saved: %d channels", applied);
+    snprintf(cal_message_buf, sizeof(cal_message_buf), "Calibration complete! (%d channels)", applied);
+    cal_message = cal_message_buf;
+    cal_step = CAL_STEP_COMPLETE;
+    return ESP_OK;
+}
+
+esp_err_t calibration_start_all(void)
+{
+    if (cal_step != CAL_STEP_IDLE && cal_step != CAL_STEP_COMPLETE) {
+        ESP_LOGW(TAG, "Calibration already in progress");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    int count = rc_input_get_channel_count();
+    if (count > RC_CHANNEL_COUNT) {
+        count = RC_CHANNEL_COUNT;
+    }
+
+    ESP_LOGI(TAG, "Starting calibration for all channels");
+
+    cal_all = true;
+    cal_channel = -1;
+    cal_step = CAL_STEP_AUTO_CENTER;
+    cal_message = "Leave all sticks centered";
+    cal_stable_mask = 0;
+    cal_swept_mask = 0;
+    cal_stable_since_ms = 0;
+    memset(cal_auto_center, 0, sizeof(cal_auto_center));
+    rc_input_cal_capture_start((1u << count) - 1);
 
     return ESP_OK;
 }
 
 esp_err_t calibration_confirm_step(void)
 {
+    if (cal_all) {
+        switch (cal_step) {
+            case CAL_STEP_AUTO_CENTER:
+                auto_begin_sweep();
+                return ESP_OK;
+            case CAL_STEP_AUTO_SWEEP:
+                return auto_finish();
+            case CAL_STEP_COMPLETE:
+                cal_step = CAL_STEP_IDLE;
+                cal_all = false;
+                cal_message = "Not calibrating";
+                return ESP_OK;
+            default:
+                return ESP_ERR_INVALID_STATE;
+        }
+    }
+
     if (cal_step == CAL_STEP_IDLE || cal_channel < 0) {
         return ESP_ERR_INVALID_STATE;
     }
 
+    rc_cal_capture_t capture;
+    rc_input_cal_capture_get((rc_channel_t)cal_channel, &capture);
+
     switch (cal_step) {
         case CAL_STEP_CENTER:
-            // Record center value
-            cal_recorded_center = cal_current_pulse;
+            // Record center as the short-term mean of the held stick
+            cal_recorded_center = capture.count ? capture.recent_us : cal_current_pulse;
+            if (!capture_stable(&capture)) {
+                ESP_LOGW(TAG, "  %s still moving (jitter %d us, %lu pulses)",
+                         channel_names[cal_channel], capture.jitter_us, (unsigned long)capture.count);
+            }
             ESP_LOGI(TAG, "  %s center recorded: %d us",
                      channel_names[cal_channel], cal_recorded_center);
 
+            rc_input_cal_capture_start(1u << cal_channel);
             cal_step = CAL_STEP_MIN;
             cal_message = "Move to MIN position, then press Next";
             break;
 
         case CAL_STEP_MIN:
-            // Record min value
-            cal_recorded_min = cal_current_pulse;
+            // Record the furthest pulse reached during this step
+            cal_recorded_min = capture.count ? capture_extreme(&capture, cal_recorded_center) : cal_current_pulse;
             ESP_LOGI(TAG, "  %s min recorded: %d us",
                      channel_names[cal_channel], cal_recorded_min);
 
+            rc_input_cal_capture_start(1u << cal_channel);
             cal_step = CAL_STEP_MAX;
             cal_message = "Move to MAX position, then press Next";
             break;
 
         case CAL_STEP_MAX:
-            // Record max value
-            cal_recorded_max = cal_current_pulse;
+            // Record the furthest pulse reached during this step
+            cal_recorded_max = capture.count ? capture_extreme(&capture, cal_recorded_center) : cal_current_pulse;
+            rc_input_cal_capture_start(0);
             ESP_LOGI(TAG, "  %s max recorded: %d us",
                      channel_names[cal_channel], cal_recorded_max);
 
@@ -136,14 +335,8 @@ esp_err_t calibration_confirm_step(void)
             cal_data.channels[cal_channel].max = cal_recorded_max;
             cal_data.channels[cal_channel].deadzone = DEFAULT_DEADZONE_US;
 
-            // Mark as calibrated
-            cal_data.calibrated = true;
-            cal_data.magic = CALIBRATION_MAGIC;
-            cal_data.version = CALIBRATION_VERSION;
-
-            // Save to NVS
-            esp_err_t ret = nvs_save_calibration(&cal_data);
-            if (ret == ESP_OK) {
+            // Mark as calibrated and save to NVS
+            if (save_calibration() == ESP_OK) {
                 ESP_LOGI(TAG, "Calibration saved: %s = %d / %d / %d",
                          channel_names[cal_channel],
                          cal_recorded_min, cal_recorded_center, cal_recorded_max);
@@ -178,7 +371,9 @@ esp_err_t calibration_cancel(void)
     }
 
     ESP_LOGW(TAG, "Calibration cancelled");
+    rc_input_cal_capture_start(0);
     cal_step = CAL_STEP_IDLE;
+    cal_all = false;
     cal_channel = -1;
     cal_message = "Calibration cancelled";
 
@@ -196,6 +391,53 @@ esp_err_t calibration_update(void)
         }
     }
 
+    if (!cal_all || (cal_step != CAL_STEP_AUTO_CENTER && cal_step != CAL_STEP_AUTO_SWEEP)) {
+        return ESP_OK;
+    }
+
+    rc_cal_capture_t c[RC_CHANNEL_COUNT];
+    uint8_t present = 0;
+    cal_stable_mask = 0;
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        rc_input_cal_capture_get((rc_channel_t)i, &c[i]);
+        if (c[i].count > 0) {
+            present |= (uint8_t)(1u << i);
+        }
+        if (capture_stable(&c[i])) {
+            cal_stable_mask |= (uint8_t)(1u << i);
+        }
+    }
+    const uint8_t drive_mask = (1u << RC_CH_THROTTLE) | (1u << RC_CH_STEERING);
+
+    if (cal_step == CAL_STEP_AUTO_CENTER) {
+        // Every channel with signal (throttle and steering at least) held still
+        bool settled = (present & drive_mask) == drive_mask && (cal_stable_mask & present) == present;
+        if (settled_for_hold(settled)) {
+            auto_begin_sweep();
+        }
+        return ESP_OK;
+    }
+
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        if ((cal_active_mask & (1u << i)) && c[i].count > 0 &&
+            c[i].max_us - c[i].min_us >= CAL_MIN_SWEEP_US) {
+            cal_swept_mask |= (uint8_t)(1u << i);
+        }
+    }
+
+    // Done once throttle and steering were swept and are back, still, at center
+    bool settled = (cal_swept_mask & drive_mask) == drive_mask;
+    for (int i = 0; settled && i < RC_CHANNEL_COUNT; i++) {
+        if (!(drive_mask & (1u << i))) {
+            continue;
+        }
+        int off = (int)c[i].recent_us - (int)cal_auto_center[i];
+        settled = (cal_stable_mask & (1u << i)) && off <= CAL_CENTER_RETURN_US && off >= -CAL_CENTER_RETURN_US;
+    }
+    if (settled_for_hold(settled)) {
+        auto_finish();
+    }
+
     return ESP_OK;
 }
 
@@ -212,6 +454,13 @@ esp_err_t calibration_get_status(calibration_status_t *status)
     status->recorded_min = cal_recorded_min;
     status->recorded_max = cal_recorded_max;
     status->message = cal_message;
+    status->all_channels = cal_all;
+    status->stable_mask = cal_stable_mask;
+    status->swept_mask = cal_swept_mask;
+    memcpy(status->auto_center, cal_auto_center, sizeof(status->auto_center));
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        rc_input_cal_capture_get((rc_channel_t)i, &status->capture[i]);
+    }
 
     return ESP_OK;
 }
@@ -240,7 +489,7 @@ esp_err_t calibration_set_reversed(rc_channel_t channel, bool reversed)
     cal_data.channels[channel].reversed = reversed;
 
     // Save to NVS
-    esp_err_t ret = nvs_save_calibration(&cal_data);
+    esp_err_t ret = nvs_storage_save_deferred(NVS_BLOB_CALIBRATION, &cal_data, sizeof(calibration_data_t));
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "%s reversed = %d", channel_names[channel], reversed);
     }
@@ -263,7 +512,7 @@ esp_err_t calibration_clear_channel(rc_channel_t channel)
     cal_data.channels[channel].deadzone = DEFAULT_DEADZONE_US;
     cal_data.channels[channel].reversed = false;
 
-    return nvs_save_calibration(&cal_data);
+    return nvs_storage_save_deferred(NVS_BLOB_CALIBRATION, &cal_data, sizeof(calibration_data_t));
 }
 
 esp_err_t calibration_clear(void)
@@ -272,7 +521,9 @@ esp_err_t calibration_clear(void)
 
     nvs_clear_calibration();
     nvs_get_default_calibration(&cal_data);
+    rc_input_cal_capture_start(0);
     cal_step = CAL_STEP_IDLE;
+    cal_all = false;
     cal_channel = -1;
 
     return ESP_OK;
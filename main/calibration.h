@@ -2,7 +2,10 @@
  * @file calibration.h
  * @brief RC calibration system interface
  *
- * Provides manual per-channel calibration with step-by-step user control.
+ * Provides manual per-channel calibration with step-by-step user control,
+ * and an all-channel mode that finds centers and endpoints by itself. Both
+ * read the ISR-rate capture in rc_input, so recorded values come from every
+ * pulse of the step rather than the last one polled.
  */
 
 #ifndef CALIBRATION_H
@@ -10,6 +13,7 @@
 
 #include "config.h"
 #include "esp_err.h"
+#include "rc_input.h"
 
 /**
  * @brief Calibration step states (manual per-channel)
@@ -20,6 +24,8 @@ typedef enum {
     CAL_STEP_MIN,           // Waiting for user to move to min and confirm
     CAL_STEP_MAX,           // Waiting for user to move to max and confirm
     CAL_STEP_COMPLETE,      // Channel calibration complete
+    CAL_STEP_AUTO_CENTER,   // All channels: waiting for every stick to settle
+    CAL_STEP_AUTO_SWEEP,    // All channels: waiting for sweeps and return to center
 } calibration_step_t;
 
 /**
@@ -33,6 +39,11 @@ typedef struct {
     uint16_t recorded_min;      // Recorded min value (if past that step)
     uint16_t recorded_max;      // Recorded max value (if past that step)
     const char *message;        // Human-readable status message
+    bool all_channels;          // All-channel mode (channel is -1)
+    uint8_t stable_mask;        // Channels currently held still
+    uint8_t swept_mask;         // Channels swept far enough (all-channel mode)
+    uint16_t auto_center[RC_CHANNEL_COUNT];     // Centers found (all-channel mode)
+    rc_cal_capture_t capture[RC_CHANNEL_COUNT]; // Live capture per channel
 } calibration_status_t;
 
 /**
@@ -49,9 +60,21 @@ esp_err_t calibration_init(calibration_data_t *data);
  */
 esp_err_t calibration_start_channel(rc_channel_t channel);
 
+/**
+ * @brief Start calibrating every channel at once
+ *
+ * Records all centers once the sticks have been still for
+ * CAL_STABLE_HOLD_MS, then endpoints while the user sweeps every stick and
+ * switch, and saves when throttle and steering are back at center.
+ * Channels that were never swept keep their calibration.
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if already calibrating
+ */
+esp_err_t calibration_start_all(void);
+
 /**
  * @brief Confirm current step and move to next
- * Records the current value and advances to next step.
+ * Records the captured value and advances to next step. In all-channel
+ * mode this finishes the sweep early with the channels swept so far.
  * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not calibrating
  */
 esp_err_t calibration_confirm_step(void);
@@ -63,7 +86,9 @@ esp_err_t calibration_confirm_step(void);
 esp_err_t calibration_cancel(void);
 
 /**
- * @brief Update calibration (call from main loop to update current_pulse)
+ * @brief Update calibration (call from main loop while calibrating)
+ *
+ * Refreshes current_pulse and advances the all-channel steps.
  * @return ESP_OK on success
  */
 esp_err_t calibration_update(void);
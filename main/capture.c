@@ -0,0 +1,71 @@
+/**
+ * @file capture.c
+ * @brief Per-tick control loop capture ring implementation
+ */
+
+#include "capture.h"
+
+_Static_assert((CAPTURE_RING_SIZE & (CAPTURE_RING_SIZE - 1)) == 0,
+               "CAPTURE_RING_SIZE must be a power of two");
+_Static_assert(sizeof(capture_sample_t) == 18 + 2 * SERVO_COUNT, "capture sample layout must match decodeCapture() in web/app.js");
+
+// Single producer (control task), single consumer (housekeeping task)
+static capture_sample_t ring[CAPTURE_RING_SIZE];
+static uint32_t ring_head = 0;          // Written by the producer only
+static uint32_t ring_tail = 0;          // Written by the consumer only
+static volatile uint32_t dropped = 0;
+static volatile bool enabled = false;
+
+void capture_set_enabled(bool on)
+{
+    enabled = on;
+}
+
+bool capture_is_enabled(void)
+{
+    return enabled;
+}
+
+bool capture_record(const capture_sample_t *sample)
+{
+    uint32_t head = ring_head;
+    uint32_t tail = __atomic_load_n(&ring_tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= CAPTURE_RING_SIZE) {
+        dropped++;
+        return false;
+    }
+
+    ring[head & (CAPTURE_RING_SIZE - 1)] = *sample;
+    __atomic_store_n(&ring_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+size_t capture_available(void)
+{
+    return __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE) - ring_tail;
+}
+
+size_t capture_read(capture_sample_t *out, size_t max)
+{
+    uint32_t tail = ring_tail;
+    uint32_t head = __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE);
+    size_t n = 0;
+
+    while (n < max && tail != head) {
+        out[n++] = ring[tail & (CAPTURE_RING_SIZE - 1)];
+        tail++;
+    }
+    __atomic_store_n(&ring_tail, tail, __ATOMIC_RELEASE);
+    return n;
+}
+
+void capture_discard(void)
+{
+    __atomic_store_n(&ring_tail, __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+uint32_t capture_get_dropped(void)
+{
+    return dropped;
+}
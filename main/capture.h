@@ -0,0 +1,75 @@
+/**
+ * @file capture.h
+ * @brief Per-tick control loop capture for live graphing
+ *
+ * While a web client asks for it, the control task records one sample per
+ * tick into a lock-free ring; the housekeeping task drains it in batches
+ * for the WebSocket. The producer never blocks: a full ring drops the
+ * sample and counts it.
+ */
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "config.h"
+
+#define CAPTURE_FLAG_BRAKING    (1 << 0)
+#define CAPTURE_FLAG_NEUTRAL    (1 << 1)
+
+/**
+ * @brief One control tick (wire format, little endian, 18 + 2 * SERVO_COUNT bytes)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t t_us;              // esp_timer time, low 32 bits
+    int16_t throttle;           // Calibrated stick input (-1000..1000)
+    int16_t steering;
+    int16_t velocity;           // Simulated velocity
+    int16_t steer;              // Steering after expo, speed reduction and smoothing
+    uint16_t esc_pulse;         // Final output pulses (us)
+    uint16_t servo_pulse[SERVO_COUNT];  // 0 while the servo test drives them
+    uint16_t rpm;
+    uint8_t gear;
+    uint8_t flags;              // CAPTURE_FLAG_*
+} capture_sample_t;
+
+/**
+ * @brief Start or stop per-tick recording
+ */
+void capture_set_enabled(bool enabled);
+
+/**
+ * @brief Check whether the control task should record samples
+ */
+bool capture_is_enabled(void);
+
+/**
+ * @brief Record a sample (control task only, never blocks)
+ * @return false if the ring was full and the sample was dropped
+ */
+bool capture_record(const capture_sample_t *sample);
+
+/**
+ * @brief Number of samples waiting to be read
+ */
+size_t capture_available(void);
+
+/**
+ * @brief Take up to max of the oldest samples (single consumer)
+ * @return Number of samples copied
+ */
+size_t capture_read(capture_sample_t *out, size_t max);
+
+/**
+ * @brief Drop every waiting sample (single consumer)
+ */
+void capture_discard(void);
+
+/**
+ * @brief Total samples dropped because the ring was full
+ */
+uint32_t capture_get_dropped(void);
+
+#endif // CAPTURE_H
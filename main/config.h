@@ -33,13 +33,21 @@
 // ESC Output Pin
 #define PIN_ESC             12  // Main drive motor ESC
 
-// Servo Output Pins (4 servos for 8x8 steering - one per axle)
-// Axle numbering: 1=front, 2, 3, 4=rear
-// Axles 1-2 steer together, Axles 3-4 steer together
+// Servo Output Pins (one servo per axle, AXLE_COUNT of them)
+// Axle numbering: 1=front ... AXLE_COUNT=rear
 #define PIN_SERVO_AXLE_1    8   // Axle 1 (front) steering servo
 #define PIN_SERVO_AXLE_2    9   // Axle 2 steering servo
 #define PIN_SERVO_AXLE_3    10  // Axle 3 steering servo
-#define PIN_SERVO_AXLE_4    11  // Axle 4 (rear) steering servo
+#define PIN_SERVO_AXLE_4    11  // Axle 4 steering servo
+#define PIN_SERVO_AXLE_5    15  // Axle 5 steering servo (10x10 only)
+
+// Auxiliary outputs (-1 = not fitted). The channel each one is driven by
+// (MCPWM group or LEDC) is set in pwm_output.c's channel map
+#define PIN_ESC_2           -1  // Second drive ESC
+#define PIN_WINCH           -1  // Winch ESC / continuous servo
+#define PIN_GEARBOX_SERVO   -1  // Gearbox shift servo
+#define PIN_LIGHT_SERVO_1   -1  // Light bar / pop-up light servos
+#define PIN_LIGHT_SERVO_2   -1
 
 // Status LED (RGB WS2812 on ESP32-S3 Mini)
 #define PIN_STATUS_LED      21  // RGB LED on ESP32-S3 Mini
@@ -51,6 +59,17 @@
 #define PIN_I2S_DOUT        44  // Data out (RX pin on ESP32-S3-Zero)
 // Note: SD pin should be tied to 3.3V to enable amp (or use GPIO for mute control)
 
+// Addressable light strip (WS2812 chain for headlights, tail/brake,
+// reverse lights, indicators and beacons; segment layout in lights.c)
+#define LIGHTS_ENABLED      1
+#define PIN_LIGHT_STRIP     14
+
+// Audio frame layout: 1 = mono slot mode (the I2S peripheral sends each
+// sample on both slots), 2 = interleaved stereo written by software.
+// A single MAX98357A only needs mono, which halves buffers and DMA traffic.
+#define AUDIO_CHANNELS      1
+#define AUDIO_FRAME_BYTES   (sizeof(int16_t) * AUDIO_CHANNELS)
+
 // ============================================================================
 // RC SIGNAL PARAMETERS
 // ============================================================================
@@ -71,6 +90,68 @@
 // Signal loss timeout
 #define RC_SIGNAL_TIMEOUT_MS    250     // Time before declaring signal lost
 
+// Capture ISR pulse filtering (PWM backend)
+// Median-of-3 rejects single-frame spikes at the cost of one frame of delay
+// on genuine steps, so it is off by default; enable it when /api/rc/stats
+// shows glitches. A glitch is a pulse this far from both neighbours while
+// they agree with each other (counted with the filter off too)
+#define RC_MEDIAN_FILTER_ENABLED    0
+#define RC_GLITCH_THRESHOLD_US      100
+
+// RC input backend selection
+// PWM:  one wire per channel on MCPWM capture (6 channels, 50Hz)
+// SBUS/IBUS/CRSF: single-wire serial receiver on PIN_RC_SERIAL (up to 16 ch)
+// PPM:  sum signal on PIN_RC_PPM decoded by RMT RX (frees both MCPWM capture timers)
+// ESPNOW: digital frames from a paired ESP32 transmitter over WiFi (no receiver)
+#define RC_BACKEND_PWM          0
+#define RC_BACKEND_SBUS         1
+#define RC_BACKEND_IBUS         2
+#define RC_BACKEND_CRSF         3
+#define RC_BACKEND_PPM          4
+#define RC_BACKEND_ESPNOW       5
+#define RC_INPUT_BACKEND        RC_BACKEND_PWM
+
+// Serial receiver input (used when RC_INPUT_BACKEND != RC_BACKEND_PWM)
+#define PIN_RC_SERIAL           PIN_RC_THROTTLE  // Reuses channel 1 input pin
+#define RC_SERIAL_UART_NUM      1               // UART peripheral index
+#define RC_MAX_CHANNELS         16              // Channels carried by serial protocols
+
+// PPM sum-signal input (used when RC_INPUT_BACKEND == RC_BACKEND_PPM)
+#define PIN_RC_PPM              PIN_RC_THROTTLE  // Reuses channel 1 input pin
+#define RC_PPM_SYNC_MIN_US      3000            // Gap longer than this ends a frame
+
+// ESP-NOW input (used when RC_INPUT_BACKEND == RC_BACKEND_ESPNOW)
+// WiFi stays on; the transmitter sends on the AP channel (or the router's
+// channel while STA is connected). All-zero MAC = pair with the first
+// transmitter heard after boot.
+#define RC_ESPNOW_PEER_MAC      {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+#define RC_ESPNOW_TELEMETRY_HZ  10              // Link stats sent back to the transmitter
+
+// ============================================================================
+// ESC OUTPUT PROTOCOL
+// ============================================================================
+
+// Drive ESC (PIN_ESC) protocol
+// PWM:      servo pulse from the MCPWM ESC timer at the tuned ESC rate
+// DSHOT300/600: digital frames from RMT TX, one per control tick, so a
+//           throttle change reaches the ESC within the tick (no PWM period
+//           to wait for, no endpoint calibration)
+#define ESC_PROTOCOL_PWM        0
+#define ESC_PROTOCOL_DSHOT300   1
+#define ESC_PROTOCOL_DSHOT600   2
+#define ESC_PROTOCOL            ESC_PROTOCOL_PWM
+
+// DShot options (used when ESC_PROTOCOL != ESC_PROTOCOL_PWM)
+// Bidirectional DShot: the ESC answers every frame with the motor's eRPM on
+// the same wire (RMT RX), which then drives the vehicle model instead of the
+// throttle-derived velocity. The ESC firmware must have it enabled
+// (BLHeli_32, AM32, Bluejay).
+#define ESC_DSHOT_BIDIR         1
+#define ESC_DSHOT_3D            1       // 3D mode: forward and reverse either side of neutral
+#define ESC_MOTOR_POLES         4       // Magnet poles (RPM = eRPM / (poles / 2))
+#define ESC_MOTOR_MAX_RPM       12000   // Motor RPM at full speed (velocity 1000)
+#define ESC_TELEMETRY_TIMEOUT_MS 50     // eRPM older than this is ignored
+
 // ============================================================================
 // SERVO PARAMETERS
 // ============================================================================
@@ -119,42 +200,344 @@ typedef struct {
 // Default calibration values
 #define DEFAULT_DEADZONE_US     20  // 20us deadzone around center
 
+// Calibration capture (see rc_input_cal_capture_start)
+// A stick counts as held still once its short-term jitter stays at or below
+// CAL_STABLE_JITTER_US for CAL_STABLE_HOLD_MS; a channel counts as swept once
+// it has travelled CAL_MIN_SWEEP_US end to end
+#define CAL_STABLE_JITTER_US    4
+#define CAL_STABLE_MIN_PULSES   16
+#define CAL_STABLE_HOLD_MS      500
+#define CAL_MIN_SWEEP_US        300
+#define CAL_CENTER_RETURN_US    40  // Sticks back within this of center end the sweep
+
 // ============================================================================
 // STEERING MODES
 // ============================================================================
 
 typedef enum {
-    STEER_MODE_FRONT = 0,       // Axles 1-2 steer, 3-4 fixed (like a car)
-    STEER_MODE_REAR,            // Axles 3-4 steer, 1-2 fixed
-    STEER_MODE_ALL_AXLE,        // All axles steer (1-2 opposite to 3-4)
+    STEER_MODE_FRONT = 0,       // Front group steers, rest fixed (like a car)
+    STEER_MODE_REAR,            // Rear group steers, rest fixed
+    STEER_MODE_ALL_AXLE,        // Front and rear groups steer opposite
     STEER_MODE_CRAB,            // All axles steer same direction (crab walk)
     STEER_MODE_COUNT            // Number of steering modes
 } steering_mode_t;
 
+// Steered axles, one servo each: 2 = 4x4, 3 = 6x6, 4 = 8x8, 5 = 10x10.
+// The steering modes act on axle groups (see steering_geometry.c), so only
+// the per-axle lists below change with it. Tunings, presets, traces and the
+// web frames are laid out for the count they were built with.
+#define AXLE_COUNT              4
+#define AXLE_COUNT_MAX          5
+
+typedef enum {
+    AXLE_GROUP_FRONT = 0,       // Steers in front, all-axle and crab modes
+    AXLE_GROUP_FIXED,           // Only steers in crab mode (e.g. a 6x6 middle axle)
+    AXLE_GROUP_REAR,            // Steers (reversed) in rear and all-axle modes, and in crab
+    AXLE_GROUP_COUNT
+} axle_group_t;
+
+// Per-axle lists, front to rear, AXLE_COUNT entries each
+#if AXLE_COUNT == 2
+#define AXLE_GROUPS             { AXLE_GROUP_FRONT, AXLE_GROUP_REAR }
+#define TUNING_DEFAULT_AXLE_RATIOS    { 100, 100 }
+#define TUNING_DEFAULT_AXLE_POS_MM    { 0, 290 }
+#elif AXLE_COUNT == 3
+#define AXLE_GROUPS             { AXLE_GROUP_FRONT, AXLE_GROUP_FIXED, AXLE_GROUP_REAR }
+#define TUNING_DEFAULT_AXLE_RATIOS    { 100, 100, 100 }
+#define TUNING_DEFAULT_AXLE_POS_MM    { 0, 250, 375 }
+#elif AXLE_COUNT == 4
+#define AXLE_GROUPS             { AXLE_GROUP_FRONT, AXLE_GROUP_FRONT, AXLE_GROUP_REAR, AXLE_GROUP_REAR }
+#define TUNING_DEFAULT_AXLE_RATIOS    { 100, 70, 70, 100 }
+#define TUNING_DEFAULT_AXLE_POS_MM    { 0, 125, 290, 415 }
+#elif AXLE_COUNT == 5
+#define AXLE_GROUPS             { AXLE_GROUP_FRONT, AXLE_GROUP_FRONT, AXLE_GROUP_FIXED, AXLE_GROUP_REAR, AXLE_GROUP_REAR }
+#define TUNING_DEFAULT_AXLE_RATIOS    { 100, 70, 100, 70, 100 }
+#define TUNING_DEFAULT_AXLE_POS_MM    { 0, 125, 250, 375, 500 }
+#else
+#error "AXLE_COUNT must be 2 to AXLE_COUNT_MAX"
+#endif
+
+// Stored tunings and presets of a build with another axle count have another
+// layout; tagging their magic makes them load as defaults rather than be
+// migrated field by field at the wrong offsets. 0 for the default 4 axles.
+#define AXLE_COUNT_MAGIC_TAG    ((uint32_t)(AXLE_COUNT ^ 4) << 24)
+
+// Mode button: 1 = apply a single press as soon as it is released, then
+// move straight on to Crab/Rear if a second or third press follows. The
+// mode sound plays once the sequence ends, for the final mode. 0 = wait
+// for the sequence to end before changing mode at all. (The host replay
+// test also builds with it on.)
+#ifndef MODE_SWITCH_SPECULATIVE
+#define MODE_SWITCH_SPECULATIVE     0
+#endif
+
 // ============================================================================
 // SYSTEM PARAMETERS
 // ============================================================================
 
-// Main loop timing
-#define MAIN_LOOP_PERIOD_MS     10  // 100Hz main loop
+// Control loop timing. The loop is driven by an esp_timer at a runtime
+// selectable rate (tuning_config_t.control.loop_rate_hz).
+#define CONTROL_RATE_MIN_HZ         100
+#define CONTROL_RATE_MAX_HZ         500
+#define CONTROL_RATE_DEFAULT_HZ     100
+#define CONTROL_WAKE_TIMEOUT_MS     50  // Run anyway if no tick/frame arrives
+
+// Physics (realistic throttle/steering, engine sound fades) is tuned in
+// "per reference tick" units and scaled by the measured dt, so feel does
+// not change with the loop rate. dt is clamped to CONTROL_DT_MAX_US.
+#define PHYSICS_REF_DT_US           10000
+#define CONTROL_DT_MAX_US           40000
+
+// Event-driven control: also wake the control loop as soon as a new
+// throttle+steering frame has been captured instead of waiting for the
+// next timer tick.
+#define CONTROL_LOOP_EVENT_DRIVEN   1
+
+// Task layout: the control path (RC -> mixing -> PWM) runs in its own task,
+// pinned to the core that does not host WiFi/lwIP, above engine audio (5).
+// LED, auto-WiFi and web status run in a low-priority housekeeping task.
+//
+//   Core 1: RC decoder (11) > control (10) > audio mixer (5)
+//   Core 0: WiFi (23), esp_timer (22), lwIP (18), health monitor (6),
+//           httpd (5), battery (3), housekeeping and lights (2), NVS/black
+//           box/UDP log/stats and sound profile loader (1)
+//
+// WiFi, lwIP and esp_timer are pinned in sdkconfig.defaults; the rest here.
+// Network bursts then only delay core 0, which /api/perf's tickToLoop
+// (timer tick due -> control running) shows.
+#define CONTROL_TASK_PRIORITY       10
+#define CONTROL_TASK_CORE           1
+#define CONTROL_TASK_STACK_SIZE     4096
+#define HOUSEKEEPING_TASK_PRIORITY  2
+#define HOUSEKEEPING_TASK_CORE      0
+#define HOUSEKEEPING_TASK_STACK_SIZE 5120  // Web status frame is built on this stack
+#define HOUSEKEEPING_PERIOD_MS      10  // LED animations are tick-based at 10ms
+#define HTTPD_TASK_PRIORITY         5   // Web server and WebSocket sends (ESP-IDF default)
+#define HTTPD_TASK_CORE             0   // With WiFi/lwIP, off the control core
+#define AUDIO_INIT_TASK_PRIORITY    1   // Boot only: loads the sound chain next to app_main()
+#define AUDIO_INIT_TASK_STACK_SIZE  4096
+#define NVS_WRITER_TASK_PRIORITY    1   // Deferred config writes (below housekeeping)
+#define NVS_WRITER_TASK_CORE        0
+#define NVS_WRITER_TASK_STACK_SIZE  3072
+#define NVS_WRITER_POLL_MS          250 // How often pending writes are checked
+#define BLACKBOX_TASK_PRIORITY      1   // Black box saves (same level as the NVS writer)
+#define BLACKBOX_TASK_CORE          0
+#define BLACKBOX_TASK_STACK_SIZE    3072
+#define UDP_LOG_TASK_PRIORITY       1   // Sends buffered log lines (never in the logging task)
+#define UDP_LOG_TASK_CORE           0
+#define UDP_LOG_TASK_STACK_SIZE     3072
+#define UDP_LOG_FLUSH_MS            50  // Buffered lines are sent this often, batched per datagram
+#define UDP_LOG_RING_LINES          64  // Lines buffered between flushes (power of 2), extra lines are dropped
+#define UDP_LOG_LINE_MAX            160 // Longer lines are truncated
+#define UDP_LOG_DATAGRAM_MAX        1400    // Stays under the WiFi MTU
+#define UDP_TELEMETRY_RING          64  // Ticks buffered between flushes (power of 2, >= CONTROL_RATE_MAX_HZ * UDP_LOG_FLUSH_MS)
+#define UDP_TELEMETRY_TIMEOUT_MS    5000    // Stop streaming if the host hasn't renewed its subscription
+#define TASK_STATS_TASK_PRIORITY    1   // Run-time stats collector (below housekeeping)
+#define TASK_STATS_TASK_CORE        0
+#define TASK_STATS_TASK_STACK_SIZE  3072
+#define TASK_STATS_PERIOD_MS        1000
+#define TASK_STATS_MAX_TASKS        32  // ESP-IDF, WiFi/lwIP and ours, with room to spare
+#define TASK_STATS_STACK_WARN_BYTES 512 // Log once when a task's free stack drops below this
+#define TASK_STATS_HEAP_SLOTS       64  // Heap operation counters, by task number
+#define LIGHTS_TASK_PRIORITY        2   // Light strip frames (same level as housekeeping)
+#define LIGHTS_TASK_CORE            0
+#define LIGHTS_TASK_STACK_SIZE      3072
+#define PRESET_TASK_PRIORITY        1   // Builds preset lookup tables off the control task
+#define PRESET_TASK_CORE            0
+#define PRESET_TASK_STACK_SIZE      3072
+#define STRESS_TASK_PRIORITY        1   // Stress test background load (flash, UI sounds, sampling)
+#define STRESS_TASK_CORE            0
+#define STRESS_TASK_STACK_SIZE      3072
+#define HEALTH_TASK_PRIORITY        6   // Stall monitor: above httpd and the tasks it watches on core 0
+#define HEALTH_TASK_CORE            0   // Off the control core, so a control stall is seen
+#define HEALTH_TASK_STACK_SIZE      3072
+#define LIGHTS_PIXEL_COUNT          150 // Pixels on the strip (frame time ~30us per pixel)
+#define LIGHTS_FPS                  60
+#define LIGHTS_BRIGHTNESS_PCT       40  // Global scale, limits strip current
+#define LIGHTS_INDICATOR_THRESHOLD  500 // Steering beyond this (of +/-1000) blinks that side
+#define LIGHTS_INDICATOR_HOLD_MS    800 // Keep blinking this long after steering returns
+#define NVS_DEFER_QUIET_MS          2000    // Commit once a blob stops changing for this long...
+#define NVS_DEFER_MAX_MS            30000   // ...with the motor stopped, or after this regardless
+#define PERF_LOG_INTERVAL_MS        5000 // Stage profile line to UDP log (WiFi on)
+#define PERF_BOOT_MARKS             16  // Boot milestones kept for /api/perf and the info frame
+#define BENCH_RUNS                  200 // Timed calls per /api/bench stage
+#define BENCH_MIX_RUNS              20  // Timed blocks per profile/effects mix
+#define BENCH_MIX_FRAMES            512 // Frames per benchmarked mix block
+#define BENCH_CONTROL_PASSES        50  // Control loop passes sampled from the control task
+#define BENCH_CONTROL_TIMEOUT_MS    2000    // Give up on control samples (calibrating, stalled)
+#define BENCH_READ_BYTES            (64 * 1024) // Sample bytes read per memory read test
+#define STRESS_RATE_MIN_HZ          10  // Synthetic RC frame rate limits for /api/stress
+#define STRESS_RATE_MAX_HZ          500
+#define STRESS_DURATION_MAX_S       600
+#define STRESS_FLASH_CHUNK          4096    // Bytes per erase + write in the inactive OTA slot
+#define STRESS_UI_SOUND_MS          500     // UI tone interval with sound load (exercises ducking)
+#define RC_BOOT_WAIT_MS             1000    // Longest wait for the receiver's first frame at boot
+#define CAPTURE_RING_SIZE           256 // Capture samples buffered between housekeeping ticks (power of 2)
+#define TUNING_LIVE_QUEUE_LEN       32  // Live web UI edits waiting for the next control tick (power of 2)
+#define TUNING_HANDOFF_TIMEOUT_MS   500 // Longest tuning_set_config() waits for the control task to take a config
+#define PRESET_COUNT                4   // Tuning + sound presets held in RAM (menu prompts exist for 4)
+#define PRESET_NAME_LEN             16  // Including the terminator
+#define PRESET_AUX_CHANNEL          -1  // RC channel whose 3-position switch picks presets 0-2 (-1 = off)
+#define TRACE_RECORDS_SPIRAM        16384   // Flight recorder records in PSRAM (~164 s at 100Hz, 576 KB)
+#define TRACE_RECORDS_INTERNAL      512     // Fallback without PSRAM (~5 s at 100Hz, 18 KB)
+#define BLACKBOX_RECORDS            300     // Flight recorder ticks saved per failsafe event (~3 s at 100Hz)
+#define BLACKBOX_RTC_RECORDS        96      // Ticks kept in RTC memory for crash resets (~1 s at 100Hz)
+#define BLACKBOX_SLOTS              4       // Events kept in the blackbox partition
+#define BLACKBOX_SLOT_SIZE          0x4000  // Flash per event (sector multiple)
+#define BLACKBOX_POST_TRIGGER_MS    500     // Keep recording this long after a failsafe before saving
+#define BLACKBOX_MIN_INTERVAL_MS    10000   // Ignore failsafe triggers this soon after a save
+
+// Degraded mode: when loops keep missing deadlines, housekeeping sheds
+// non-critical work (LED animation, then status frame, then servo test
+// polling) one step per bad window until timing recovers.
+#define DEADLINE_WINDOW_MS          1000
+#define DEADLINE_MISS_THRESHOLD     5   // Misses per window to escalate
+#define DEADLINE_RECOVER_WINDOWS    3   // Clean windows to step back down
+
+// Task health: the control, housekeeping, audio, lights, UDP log and httpd
+// tasks beat once per loop with their current period. A gap longer than
+// HEALTH_LATE_PERIODS periods is a stall and is logged; longer stalls shed
+// load, put the car in failsafe (control only) or reset the board (control,
+// housekeeping and audio). The task watchdog stays as the last resort.
+#define HEALTH_CHECK_MS             10  // Monitor period
+#define HEALTH_LATE_PERIODS         4   // Beats this many periods apart are a stall
+#define HEALTH_LATE_MIN_MS          20  // Floor for fast loops (tick jitter is not a stall)
+#define HEALTH_SHED_MS              100 // A stall this long counts as a window of deadline misses
+#define HEALTH_FAILSAFE_MS          100 // Control stall: ESC to neutral, servos held (> a flash sector erase)
+#define HEALTH_RECOVER_MS           500 // Control beating normally this long before failsafe lifts
+#define HEALTH_RESET_MS             3000    // Stall that resets the board (below the 5s TWDT)
+#define HEALTH_WEB_PROBE_MS         250 // No-op job queued to the httpd task this often
+
+// Timeline tracing (CONFIG_CRAWLER_TIMELINE in menuconfig, off by default):
+// 12-byte events in internal RAM. At CONTROL_RATE_MAX_HZ (500 Hz) each
+// control tick logs 4 events (its marks plus the switch in and out), 2 per
+// ms; RC capture edges, servo TEZ at the output rate, low-latency mixer
+// blocks and WiFi/httpd switches with the web UI open add about 4 more, so
+// the ring holds roughly the last 0.6 s (longer at slower control rates).
+#define TIMELINE_EVENTS             4096    // Power of 2 (48 KB)
+#define TIMELINE_POST_TRIGGER       1024    // Events kept after the deadline miss that froze an armed ring (~170 ms)
+
+// Input decoder tasks (PPM/serial) feed the control task, so they run
+// just above it on the same core
+#define RC_DECODER_TASK_PRIORITY    (CONTROL_TASK_PRIORITY + 1)
+
+// Audio mixer: one task owns the I2S channel and sums the engine, effects
+// and UI buses each block. Engine and effects are ducked while a UI sound
+// (menu prompt, chime, beep) plays.
+#define AUDIO_SAMPLE_RATE           22050   // Matches the 8-bit source samples
+
+// Buffering profile. Standard queues 8 x 512 frames in DMA (~186ms) and
+// rides out long flash-cache / WiFi stalls; low latency queues 4 x 128
+// frames (~23ms) so throttle changes are heard sooner, at the cost of
+// underruns (see audio_mixer_get_stats()) if the mixer is held off.
+#define AUDIO_LOW_LATENCY           0
+#if AUDIO_LOW_LATENCY
+#define AUDIO_BLOCK_FRAMES          128     // Frames mixed per block (~6ms)
+#define AUDIO_DMA_DESC_NUM          4
+#else
+#define AUDIO_BLOCK_FRAMES          512     // Frames mixed per block (~23ms)
+#define AUDIO_DMA_DESC_NUM          8
+#endif
+#define AUDIO_DMA_FRAME_NUM         AUDIO_BLOCK_FRAMES  // One block per DMA buffer
+#define AUDIO_RAMP_FRAMES           32      // Engine pitch ramp step within a block
+#define AUDIO_RPM_STEP_FRAMES       2048    // Period update_rpm()'s rates are tuned for
+#define AUDIO_MIXER_TASK_PRIORITY   5
+#define AUDIO_MIXER_TASK_CORE       1
+#define AUDIO_MIXER_TASK_STACK_SIZE 4096
+#define SOUND_LOADER_TASK_PRIORITY  1       // Caches the next sound profile in the background
+#define SOUND_LOADER_TASK_CORE      0
+#define SOUND_LOADER_TASK_STACK_SIZE 3072
+#define ENGINE_PROFILE_XFADE_MS     300     // Crossfade between sound profiles
+#define ENGINE_MUTE_FADE_MS         150     // Engine fade while the menu speaks
+#define AUDIO_IDLE_WAIT_MS          50      // Sleep between checks when nothing plays
+#define AUDIO_DUCK_GAIN_Q8          90      // Engine/effects gain under UI sounds (256 = 1.0)
+#define AUDIO_DUCK_RELEASE_Q8       48      // Gain recovered per 512 frames after UI ends
+#define ENGINE_SAMPLE_CACHE_MAX_BYTES (64 * 1024)   // RAM copy of the profile's loop layers
+#define UI_SOUND_CACHE_MAX_BYTES    (64 * 1024)     // Recorded UI cues (first come, first cached)
+
+// Master bus DSP (audio_dsp.c, esp-dsp): speaker EQ and a look-ahead
+// limiter in place of the hard clamp. Stacked layer volumes reach 250%
+// (ENGINE_FULL_VOLUME_PCT), which clips harshly on small speakers; the
+// limiter turns peaks down one chunk ahead instead. Delays audio by one
+// chunk; cost is PERF_STAGE_AUDIO_DSP (dspLoadPct in /api/perf).
+#define AUDIO_DSP_ENABLE            0
+#define AUDIO_DSP_HPF_HZ            150     // Speaker high-pass, 0 = off (small speakers can't move below)
+#define AUDIO_DSP_SHELF_HZ          3000    // High shelf corner, 0 = off
+#define AUDIO_DSP_SHELF_DB          3.0f    // High shelf gain
+#define AUDIO_DSP_CEILING           29205   // Limiter ceiling (-1 dBFS)
+#define AUDIO_DSP_LOOKAHEAD_FRAMES  32      // Look-ahead chunk (~1.5ms), divides AUDIO_BLOCK_FRAMES
+#define AUDIO_DSP_RELEASE_MS        100     // Limiter recovery time constant
+
+// Power management (needs CONFIG_PM_ENABLE; light sleep also needs
+// CONFIG_FREERTOS_USE_TICKLESS_IDLE). The control task keeps full clock
+// while sticks are off center, the engine is on or the vehicle rolls, and
+// for POWER_PARK_DELAY_MS after; the mixer while it renders; WiFi while on.
+#define POWER_MAX_CPU_MHZ           240
+#define POWER_MIN_CPU_MHZ           80      // APB clock: MCPWM/RMT timing is unaffected
+#define POWER_LIGHT_SLEEP           1       // Only reached when no driver holds the APB clock
+#define POWER_ACTIVE_DEADBAND       50      // Stick offset (of +/-1000) that counts as driving
+#define POWER_PARK_DELAY_MS         3000    // Stay at full clock this long after the last activity
+// Chip current estimate from the full-clock residency (ESP32-S3 typicals,
+// excludes servos, ESC, lights and the audio amplifier)
+#define POWER_EST_FULL_MA           45
+#define POWER_EST_MIN_MA            22
+#define POWER_EST_WIFI_MA           60      // Added while WiFi is on (AP beacons + RX)
+
+// Battery sensing: ADC1 continuous mode (DMA) on the pack divider and an
+// optional current-shunt amplifier. The pins are the AUX3/AUX4 receiver
+// inputs, so sensing needs a single-wire backend (serial, PPM, ESP-NOW).
+// Samples are averaged per DMA frame; the CPU only runs once per frame.
+#define BATTERY_ENABLED             (RC_INPUT_BACKEND != RC_BACKEND_PWM)
+#define PIN_BATTERY_VOLTAGE         PIN_RC_AUX4     // ADC1 channel 0
+#define PIN_BATTERY_CURRENT         PIN_RC_AUX3     // ADC1 channel 1
+#define BATTERY_CURRENT_ENABLED     0               // Shunt amplifier fitted on PIN_BATTERY_CURRENT
+#define BATTERY_DIVIDER_X1000       11000           // Pack mV per ADC mV x1000 (100k/10k divider)
+#define BATTERY_CURRENT_OFFSET_MV   0               // Amplifier output at 0A
+#define BATTERY_CURRENT_MV_PER_A    40              // Amplifier gain (e.g. 1mR shunt x 40)
+#define BATTERY_SAMPLE_HZ           20000           // Conversions per second, all channels
+#define BATTERY_FRAME_SAMPLES       512             // Conversions per DMA frame (~39 frames/s)
+#define BATTERY_FILTER_SHIFT        3               // EWMA weight 1/8 per frame (~0.2s)
+#define BATTERY_CELLS               0               // LiPo cells, 0 = detect at boot
+#define BATTERY_CELL_DETECT_MV      4350            // Highest cell voltage counted as one cell
+#define BATTERY_LOW_CELL_MV         3500            // Low alert (LED + prompt)
+#define BATTERY_CRITICAL_CELL_MV    3300            // Critical alert, prompt repeats
+#define BATTERY_HYSTERESIS_MV       100             // Per cell, to clear an alert
+#define BATTERY_ALERT_HOLD_MS       3000            // Below a threshold this long before alerting
+#define BATTERY_ALERT_REPEAT_MS     30000           // Critical prompt interval
+// Sag compensation: the ESC command is scaled by resting / present pack
+// voltage, so throttle response holds up while the pack sags under load.
+// The resting voltage follows rises at once and drops with a ~25s lag.
+#define BATTERY_SAG_COMP_ENABLED    1
+#define BATTERY_SAG_MAX_GAIN_PCT    125             // Largest throttle boost
+#define BATTERY_REST_DECAY_SHIFT    10              // Resting voltage drop weight per frame
+#define BATTERY_TASK_PRIORITY       3               // Above housekeeping, once per DMA frame
+#define BATTERY_TASK_CORE           0
+#define BATTERY_TASK_STACK_SIZE     3072
 
 // Failsafe values (used when signal is lost)
 #define FAILSAFE_THROTTLE_US    1500    // Neutral throttle
 #define FAILSAFE_STEERING_US    1500    // Centered steering
 
+// Output deadline: with no output frame committed for this long, the ESC
+// timer interrupt forces the motor outputs to neutral on its own (checked
+// once per ESC period, so the pulse changes within one more period)
+#define OUTPUT_DEADLINE_MS      50
+
 // NVS namespace for storing calibration
 #define NVS_NAMESPACE           "crawler_cfg"
 #define NVS_KEY_CALIBRATION     "calibration"
 #define NVS_KEY_WIFI_STA        "wifi_sta"
+#define NVS_KEY_WIFI_CACHE      "wifi_cache"
 #define NVS_KEY_TUNING          "tuning"
 #define NVS_KEY_SOUND           "sound"
+#define NVS_KEY_PRESETS         "presets"
 
 // ============================================================================
 // TUNING CONFIGURATION
 // ============================================================================
 
 // Number of steering servos (one per axle)
-#define SERVO_COUNT             4
+#define SERVO_COUNT             AXLE_COUNT
 
 // Per-servo tuning: endpoints, subtrim, trim, reverse
 typedef struct {
@@ -167,7 +550,7 @@ typedef struct {
 
 // Steering geometry settings
 typedef struct {
-    uint8_t axle_ratio[4];       // Steering ratio for each axle (0-100%)
+    uint8_t axle_ratio[SERVO_COUNT];  // Steering ratio for each axle (0-100%)
     uint8_t all_axle_rear_ratio; // Rear axle ratio in all-axle mode (0-100%)
     uint8_t expo;                // Steering expo curve (0-100%, 0=linear)
     uint8_t speed_steering;      // Speed-dependent steering reduction (0-100%, 0=disabled)
@@ -175,6 +558,11 @@ typedef struct {
     bool realistic_enabled;      // Enable weighted/slow steering motion
     uint8_t responsiveness;      // Steering speed (0=very slow/heavy, 100=instant)
     uint8_t return_rate;         // Center return speed (0=slow, 100=fast)
+    uint8_t predict_ms;          // Steering extrapolation between RC frames (0=off, max STEER_PREDICT_MAX_MS)
+    // Turning-center geometry (replaces the axle ratios when enabled)
+    bool geometry_enabled;       // Axle angles from axle positions instead of ratios
+    uint8_t max_angle_deg;       // Wheel angle of the outermost steered axle at full lock
+    uint16_t axle_pos_mm[SERVO_COUNT];  // Axle positions from axle 1 (front to rear, increasing)
 } steering_tuning_t;
 
 // ESC/Motor tuning settings
@@ -190,6 +578,17 @@ typedef struct {
     uint16_t motor_cutoff;      // ESC motor cutoff threshold (0-1000, ESC stops below this)
 } esc_tuning_t;
 
+// Output frame rate per MCPWM group (digital servos accept >50Hz)
+typedef struct {
+    uint16_t esc_rate_hz;       // ESC PWM frame rate (group 0)
+    uint16_t servo_rate_hz;     // Steering servo PWM frame rate (group 1)
+} output_tuning_t;
+
+// Control loop settings
+typedef struct {
+    uint16_t loop_rate_hz;      // Control loop rate (CONTROL_RATE_MIN_HZ..MAX_HZ)
+} control_tuning_t;
+
 // Complete tuning configuration
 typedef struct {
     uint32_t magic;             // Magic number to verify valid data
@@ -197,26 +596,43 @@ typedef struct {
     servo_tuning_t servos[SERVO_COUNT];
     steering_tuning_t steering;
     esc_tuning_t esc;
+    output_tuning_t output;
+    control_tuning_t control;
 } tuning_config_t;
 
-#define TUNING_MAGIC            0x54554E45  // "TUNE" in hex
-#define TUNING_VERSION          9           // Added realistic steering
+#define TUNING_MAGIC            (0x54554E45 ^ AXLE_COUNT_MAGIC_TAG)  // "TUNE" in hex
+#define TUNING_VERSION          13          // Added steering prediction (new fields: see tuning_fields in tuning.c)
+
+// Output rate limits. The frame period must leave at least
+// OUTPUT_MIN_FRAME_GAP_US of low time after the longest pulse.
+#define OUTPUT_RATE_MIN_HZ      50
+#define OUTPUT_RATE_MAX_HZ      560
+#define OUTPUT_MIN_FRAME_GAP_US 300
+
+// Steering prediction: the extrapolation never runs further ahead than
+// the last RC frame interval or STEER_PREDICT_MAX_MS, and stops for frames
+// more than STEER_PREDICT_MAX_GAP_MS apart (dropped frames, not motion)
+#define STEER_PREDICT_MAX_MS    40
+#define STEER_PREDICT_MAX_GAP_MS 60
+
+// Turning-center geometry limits (outside them the axle ratios are used)
+#define GEOMETRY_MIN_ANGLE_DEG  5
+#define GEOMETRY_MAX_ANGLE_DEG  45
 
 // Default tuning values
 #define TUNING_DEFAULT_SERVO_MIN        1000
 #define TUNING_DEFAULT_SERVO_MAX        2000
 #define TUNING_DEFAULT_SUBTRIM          0
 #define TUNING_DEFAULT_TRIM             0
-#define TUNING_DEFAULT_AXLE1_RATIO      100
-#define TUNING_DEFAULT_AXLE2_RATIO      70
-#define TUNING_DEFAULT_AXLE3_RATIO      70
-#define TUNING_DEFAULT_AXLE4_RATIO      100
 #define TUNING_DEFAULT_ALL_AXLE_REAR    80
 #define TUNING_DEFAULT_EXPO             0
 #define TUNING_DEFAULT_SPEED_STEERING   0       // 0=disabled, 100=max reduction at full throttle
 #define TUNING_DEFAULT_REALISTIC_STEER  false   // Default to instant steering response
 #define TUNING_DEFAULT_RESPONSIVENESS   50      // Medium responsiveness (0=slow/heavy, 100=instant)
 #define TUNING_DEFAULT_RETURN_RATE      70      // Fairly fast return to center
+#define TUNING_DEFAULT_STEER_PREDICT_MS 0       // Servos step with each RC frame
+#define TUNING_DEFAULT_GEOMETRY         false   // Axle ratios until positions are measured
+#define TUNING_DEFAULT_MAX_ANGLE_DEG    30
 #define TUNING_DEFAULT_FWD_LIMIT        100
 #define TUNING_DEFAULT_REV_LIMIT        100
 #define TUNING_DEFAULT_ESC_DEADZONE     30
@@ -224,6 +640,9 @@ typedef struct {
 #define TUNING_DEFAULT_COAST_RATE       50      // Medium coast speed (0=fast stop, 100=slow coast)
 #define TUNING_DEFAULT_BRAKE_FORCE      50      // Medium brake strength (0=weak, 100=instant stop)
 #define TUNING_DEFAULT_MOTOR_CUTOFF     150     // ESC deadband threshold (~15% of 1000)
+#define TUNING_DEFAULT_ESC_RATE_HZ      RC_PWM_FREQ_HZ  // Analog ESCs expect 50Hz
+#define TUNING_DEFAULT_SERVO_RATE_HZ    RC_PWM_FREQ_HZ  // Safe for analog servos
+#define TUNING_DEFAULT_LOOP_RATE_HZ     CONTROL_RATE_DEFAULT_HZ
 
 // ============================================================================
 // WIFI STATION MODE CONFIGURATION
@@ -244,6 +663,18 @@ typedef struct {
 
 #define CRAWLER_WIFI_MAGIC      0x57494649  // "WIFI" in hex
 
+// Access point the STA last connected to, for a fast reconnect that skips
+// the all-channel scan. The DHCP lease itself is kept by lwIP
+// (CONFIG_LWIP_DHCP_RESTORE_LAST_IP).
+typedef struct {
+    uint32_t magic;                             // Magic number to verify valid data
+    char ssid[WIFI_STA_SSID_MAX_LEN + 1];       // Network this entry belongs to
+    uint8_t bssid[6];                           // Access point MAC
+    uint8_t channel;                            // Primary channel (0 = no entry)
+} crawler_wifi_cache_t;
+
+#define CRAWLER_WIFI_CACHE_MAGIC 0x57494643 // "WIFC" in hex
+
 // ============================================================================
 // MCPWM CONFIGURATION
 // ============================================================================
@@ -257,6 +688,12 @@ typedef struct {
 
 // Timer resolution
 #define MCPWM_TIMER_RESOLUTION_HZ   1000000  // 1MHz = 1us resolution
+
+// Output channels (ESC, axle servos and the auxiliary outputs). Each MCPWM
+// group drives up to 6 from its shared timer; LEDC drives up to 8, each
+// LEDC timer serving the channels that share a rate and resolution
+#define OUTPUT_CHANNEL_MAX          16
+#define OUTPUT_MCPWM_GROUP_CHANNELS 6       // 3 operators x 2 generators
 #define MCPWM_CAPTURE_RESOLUTION_HZ 80000000 // 80MHz APB clock (both ESP32 and ESP32-S3)
 
 #endif // CONFIG_H
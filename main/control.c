@@ -0,0 +1,311 @@
+/**
+ * @file control.c
+ * @brief One control tick: RC frame -> modes, mixing, failsafe -> outputs
+ */
+
+#include "control.h"
+#include "config.h"
+#include "tuning.h"
+#include "preset.h"
+#include "pwm_output.h"
+#include "dshot.h"
+#include "web_server.h"
+#include "engine_sound.h"
+#include "vehicle.h"
+#include "mode_switch.h"
+#include "menu.h"
+#include "perf.h"
+#include "health.h"
+#include "capture.h"
+#include "trace.h"
+#include "blackbox.h"
+#include "udp_log.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "CONTROL";
+
+// Owned by the control task
+static app_state_t app_state = APP_STATE_INIT;
+static steering_mode_t current_steering_mode = STEER_MODE_FRONT;
+
+app_state_t control_get_state(void)
+{
+    return app_state;
+}
+
+void control_set_state(app_state_t state)
+{
+    app_state = state;
+}
+
+steering_mode_t control_get_steering_mode(void)
+{
+    return current_steering_mode;
+}
+
+/**
+ * @brief Append this tick to the flight recorder (and the telemetry stream)
+ * @param flags TRACE_FLAG_* known to the caller
+ */
+static void trace_tick(const rc_frame_t *frame, const vehicle_state_t *vehicle,
+                       const output_frame_t *out, int16_t steer,
+                       throttle_mode_t throttle_mode, uint8_t flags)
+{
+    trace_record_t rec = {
+        .t_us = (uint32_t)esp_timer_get_time(),
+        .velocity = vehicle->velocity,
+        .steer = steer,
+        .esc_pulse = out->esc_pulse,
+        .rpm = vehicle->rpm,
+        .gear = vehicle->gear,
+        .modes = (uint8_t)((current_steering_mode & 0x03) | ((throttle_mode & 0x03) << 2)),
+        .flags = flags |
+                 (vehicle->braking ? TRACE_FLAG_BRAKING : 0) |
+                 (menu_is_active() ? TRACE_FLAG_MENU : 0) |
+                 (web_server_is_servo_test_active() ? TRACE_FLAG_SERVO_TEST : 0),
+    };
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        rec.input[i] = frame->ch[i].value;
+    }
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        rec.servo_pulse[i] = out->servo_pulse[i];
+    }
+    trace_record(&rec);
+    blackbox_mirror(&rec);
+    udp_log_telemetry(&rec);
+}
+
+void control_process(const rc_frame_t *frame)
+{
+    perf_mark_loop_entry(rc_input_get_frame_edge_us());
+
+    // Get RC input
+    const rc_channel_data_t throttle_data = frame->ch[RC_CH_THROTTLE];
+    const rc_channel_data_t steering_data = frame->ch[RC_CH_STEERING];
+    const rc_channel_data_t aux1_data = frame->ch[RC_CH_AUX1];  // Horn button
+    const rc_channel_data_t aux2_data = frame->ch[RC_CH_AUX2];  // Mode switch button
+    const rc_channel_data_t aux3_data = frame->ch[RC_CH_AUX3];
+    const rc_channel_data_t aux4_data = frame->ch[RC_CH_AUX4];
+
+    bool signal_lost = throttle_data.signal_lost || steering_data.signal_lost;
+
+    // Get button states
+    bool aux1_pressed = (aux1_data.value > 400);  // Horn / Menu confirm
+    bool aux2_pressed = (aux2_data.value > 400);  // Mode switch / Menu navigate
+
+    // Update menu state machine (handles AUX2 when menu is active)
+    menu_update(aux2_pressed);
+
+    // AUX1 - Horn or Menu Confirm
+    // When menu is active, AUX1 is used for menu confirmation
+    // When menu is inactive, AUX1 is the horn button
+    if (menu_is_active()) {
+        menu_handle_confirm(aux1_pressed);
+        engine_sound_set_horn(false);  // No horn while in menu
+    } else {
+        engine_sound_set_horn(aux1_pressed);
+    }
+
+    // AUX3 - Throttle Mode (3-position switch)
+    // SWAPPED: Was AUX4, now AUX3
+    // Low (<-400): Direct pass-through
+    // Center (-400 to 400): Neutral - rev engine but no ESC output
+    // High (>400): Realistic throttle physics
+    static throttle_mode_t prev_throttle_mode = THROTTLE_MODE_DIRECT;
+    throttle_mode_t throttle_mode;
+    if (aux3_data.value > 400) {
+        throttle_mode = THROTTLE_MODE_REALISTIC;
+    } else if (aux3_data.value > -400) {
+        throttle_mode = THROTTLE_MODE_NEUTRAL;
+    } else {
+        throttle_mode = THROTTLE_MODE_DIRECT;
+    }
+    if (throttle_mode != prev_throttle_mode) {
+        ESP_LOGI(TAG, "Throttle mode: %d (aux3=%d)", throttle_mode, aux3_data.value);
+        prev_throttle_mode = throttle_mode;
+    }
+    tuning_set_throttle_mode(throttle_mode);
+
+#if PRESET_AUX_CHANNEL >= 0
+    // Preset switch (tables are swapped in by tuning_live_apply next tick)
+    if (!signal_lost) {
+        preset_aux_update(frame->ch[PRESET_AUX_CHANNEL].value);
+    }
+#endif
+
+    // AUX4 - Engine On/Off (momentary button)
+    // SWAPPED: Was AUX3 (complex state machine), now simple single-press toggle
+    static bool aux4_was_pressed = false;
+    bool aux4_pressed = (aux4_data.value > 400);
+    if (aux4_pressed && !aux4_was_pressed) {
+        // Rising edge - toggle engine
+        if (engine_sound_get_state() == ENGINE_OFF) {
+            ESP_LOGI(TAG, "Engine start (AUX4)");
+            engine_sound_start();
+        } else {
+            ESP_LOGI(TAG, "Engine stop (AUX4)");
+            engine_sound_stop();
+        }
+    }
+    aux4_was_pressed = aux4_pressed;
+
+    // Check for signal loss (or a stall of this loop the health monitor
+    // caught, which holds failsafe until the loop keeps time again)
+    bool stall_hold = health_failsafe_active();
+    if (signal_lost || stall_hold) {
+        if (app_state != APP_STATE_FAILSAFE) {
+            ESP_LOGW(TAG, "%s! Entering failsafe mode", signal_lost ? "Signal lost" : "Control loop stalled");
+            app_state = APP_STATE_FAILSAFE;
+            menu_force_exit();  // Exit menu on signal loss
+            esc_set_neutral();
+            servo_center_all();
+            tuning_reset_realistic_throttle();  // Reset simulated velocity
+            tuning_reset_realistic_steering();  // Reset steering positions
+            tuning_reset_steering_prediction();
+            blackbox_trigger(BLACKBOX_CAUSE_FAILSAFE);
+        }
+
+        // Vehicle is at rest in failsafe
+        const vehicle_input_t failsafe_in = {
+            .engine_running = engine_sound_get_state() == ENGINE_RUNNING,
+        };
+        const vehicle_state_t *vehicle = vehicle_update(&failsafe_in);
+
+        // ESC held at neutral (keeps a DShot ESC fed with frames)
+        output_frame_t failsafe_out = { .esc_pulse = FAILSAFE_THROTTLE_US, .update_esc = true };
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            failsafe_out.servo_pulse[i] = servo_get_pulse((servo_id_t)i);
+        }
+        pwm_output_commit(&failsafe_out);
+        trace_tick(frame, vehicle, &failsafe_out, 0, throttle_mode, TRACE_FLAG_FAILSAFE);
+        return;
+    }
+
+    // Recover from failsafe
+    if (app_state == APP_STATE_FAILSAFE) {
+        ESP_LOGI(TAG, "Failsafe cleared, resuming operation");
+        app_state = APP_STATE_RUNNING;
+    }
+
+    // Outputs for this tick are collected and committed together at the end
+    output_frame_t out = {0};
+
+    // Apply throttle to ESC with tuning (limits, subtrim, deadzone, reverse)
+    // Skip ESC output in neutral mode (rev engine sound only)
+    out.update_esc = true;
+    if (!tuning_is_neutral_mode()) {
+        out.esc_pulse = tuning_lut_esc_pulse(throttle_data.value);
+    } else {
+        out.esc_pulse = FAILSAFE_THROTTLE_US;
+    }
+
+    // Advance the shared vehicle model once for this tick (after the ESC
+    // table ran the realistic throttle physics)
+    // In realistic mode: use simulated velocity for natural physics
+    // In direct/neutral mode: use throttle directly as pseudo-velocity for effects
+    vehicle_input_t vehicle_in = {
+        .throttle = throttle_data.value,
+        .engine_running = engine_sound_get_state() == ENGINE_RUNNING,
+    };
+    if (throttle_mode == THROTTLE_MODE_REALISTIC) {
+        vehicle_in.velocity = tuning_get_simulated_velocity();
+        vehicle_in.braking = tuning_is_braking();
+        vehicle_in.direction = tuning_get_last_direction();
+    } else {
+        // Use throttle as velocity - this makes effects work in all modes
+        vehicle_in.velocity = throttle_data.value;
+        vehicle_in.direction = (throttle_data.value > 0) - (throttle_data.value < 0);
+    }
+    // With bidirectional DShot the model follows the measured motor speed
+    // whenever the ESC is being driven
+    if (!tuning_is_neutral_mode()) {
+        dshot_get_velocity(&vehicle_in.velocity);
+    }
+    const vehicle_state_t *vehicle = vehicle_update(&vehicle_in);
+
+    // Engine sound follows the vehicle state
+    engine_sound_update(vehicle);
+
+    // Fill in between RC frames (pass-through unless prediction is on),
+    // then apply the steering expo curve
+    int16_t steer = tuning_predict_steering(steering_data.value, rc_input_get_frame_edge_us(),
+                                            (uint32_t)esp_timer_get_time());
+    steer = tuning_lut_expo(steer);
+
+    // Apply speed-dependent steering reduction
+    steer = tuning_apply_speed_steering(steer, vehicle->velocity);
+
+    // Update mode switch with button state (AUX2 = Channel 3 momentary button)
+    // Priority: UI override > mode switch button
+    steering_mode_t new_mode;
+    uint8_t ui_mode;
+    bool ui_mode_forced = web_server_get_mode_override(&ui_mode);
+
+    if (ui_mode_forced) {
+        // UI has selected a mode - update mode_switch to stay in sync
+        mode_switch_set_mode((steering_mode_t)ui_mode);
+        new_mode = (steering_mode_t)ui_mode;
+    } else {
+        // RC: Use momentary button on Channel 3 (AUX2)
+        // Single press: Toggle between Front and All-Axle
+        // Double press: Crab mode
+        // Triple press: Rear mode
+        // In Crab/Rear: Single press returns to last normal mode
+        bool mode_btn_pressed = (aux2_data.value > 400);
+        mode_switch_update(mode_btn_pressed);
+        new_mode = mode_switch_get_mode();
+    }
+
+    // Log mode changes
+    if (new_mode != current_steering_mode) {
+        const char *mode_names[] = {"Front", "Rear", "All-Axle", "Crab"};
+        ESP_LOGI(TAG, "Steering mode: %s", mode_names[new_mode]);
+        current_steering_mode = new_mode;
+    }
+
+    // Apply realistic steering if enabled (smooth interpolation of input)
+    // This must happen BEFORE applying ratios - like a mechanical linkage,
+    // all axles follow one smoothed steering input proportionally
+    int16_t smoothed_steer = steer;
+    if (tuning_is_realistic_steering_enabled()) {
+        smoothed_steer = tuning_apply_realistic_steering(steer);
+    }
+
+    // Set servo positions from the compiled tables (mode mix, axle ratios,
+    // endpoints, subtrim, trim, reverse are all folded in at config time)
+    // In servo test mode the web UI's jog positions are latched instead
+    if (!web_server_is_servo_test_active()) {
+        out.update_servos = true;
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            out.servo_pulse[i] = tuning_lut_servo_pulse(current_steering_mode, i, smoothed_steer);
+        }
+    } else {
+        out.update_servos = web_server_get_servo_jog(out.servo_pulse);
+    }
+
+    // ESC + all axles latch on the same PWM period
+    pwm_output_commit(&out);
+
+    // Per-tick trace for the web UI's live graph
+    if (capture_is_enabled()) {
+        capture_sample_t sample = {
+            .t_us = (uint32_t)esp_timer_get_time(),
+            .throttle = throttle_data.value,
+            .steering = steering_data.value,
+            .velocity = vehicle->velocity,
+            .steer = smoothed_steer,
+            .esc_pulse = out.esc_pulse,
+            .rpm = vehicle->rpm,
+            .gear = vehicle->gear,
+            .flags = (vehicle->braking ? CAPTURE_FLAG_BRAKING : 0) |
+                     (tuning_is_neutral_mode() ? CAPTURE_FLAG_NEUTRAL : 0),
+        };
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            sample.servo_pulse[i] = out.servo_pulse[i];
+        }
+        capture_record(&sample);
+    }
+
+    trace_tick(frame, vehicle, &out, smoothed_steer, throttle_mode, ui_mode_forced ? TRACE_FLAG_UI_MODE : 0);
+}
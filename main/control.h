@@ -0,0 +1,49 @@
+/**
+ * @file control.h
+ * @brief One control tick: RC frame -> modes, mixing, failsafe -> outputs
+ *
+ * Everything the control task does with a calibrated frame once it is not
+ * calibrating: buttons and switches, menu, failsafe, the vehicle model and
+ * engine sound demand, steering mode, compiled output tables, the output
+ * commit, and the capture/flight recorder record. Kept apart from the task
+ * so tools/host-replay can run it against recorded traces.
+ */
+
+#ifndef CONTROL_H
+#define CONTROL_H
+
+#include "config.h"
+#include "rc_input.h"
+
+/**
+ * @brief Application state
+ */
+typedef enum {
+    APP_STATE_INIT,
+    APP_STATE_CALIBRATING,
+    APP_STATE_RUNNING,
+    APP_STATE_FAILSAFE
+} app_state_t;
+
+/**
+ * @brief Process RC input and update outputs (control task only)
+ * @param frame Calibrated RC frame for this tick
+ */
+void control_process(const rc_frame_t *frame);
+
+/**
+ * @brief Get the application state
+ */
+app_state_t control_get_state(void);
+
+/**
+ * @brief Set the application state (calibration start/end, boot)
+ */
+void control_set_state(app_state_t state);
+
+/**
+ * @brief Get the steering mode applied on the last tick
+ */
+steering_mode_t control_get_steering_mode(void);
+
+#endif // CONTROL_H
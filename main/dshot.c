@@ -0,0 +1,318 @@
+/**
+ * @file dshot.c
+ * @brief DShot300/600 drive ESC output on RMT with bidirectional eRPM telemetry
+ *
+ * A frame is 16 bits MSB first: 11-bit throttle, telemetry request bit and
+ * a 4-bit checksum (inverted for bidirectional DShot). The RMT bytes
+ * encoder turns each bit into one symbol with a 3/4 (one) or 3/8 (zero)
+ * duty high time.
+ *
+ * Bidirectional replies come back about 30us after the frame: a start bit
+ * and 20 GCR bits at 5/4 of the frame bit rate, where every edge is a one.
+ * The receiver is armed just before each frame, so a capture holds our own
+ * frame, the turnaround gap and the reply; the receive-done ISR skips to
+ * the gap and decodes the rest.
+ */
+
+#include "dshot.h"
+#include "driver/rmt_tx.h"
+#include "driver/rmt_rx.h"
+#include "driver/gpio.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "DSHOT";
+
+#define DSHOT_RESOLUTION_HZ     40000000    // 25ns per tick (TX and RX)
+#define DSHOT_MEM_SYMBOLS       48          // One RMT memory block on ESP32-S3
+#define DSHOT_RX_GLITCH_NS      100
+#define DSHOT_RX_IDLE_NS        60000       // Longer than the turnaround: one capture per frame
+
+#if ESC_PROTOCOL == ESC_PROTOCOL_DSHOT600
+#define DSHOT_BITRATE           600000
+#else
+#define DSHOT_BITRATE           300000
+#endif
+
+#define DSHOT_BIT_TICKS         (DSHOT_RESOLUTION_HZ / DSHOT_BITRATE)
+#define DSHOT_T1H_TICKS         (DSHOT_BIT_TICKS * 3 / 4)
+#define DSHOT_T0H_TICKS         (DSHOT_BIT_TICKS * 3 / 8)
+
+// Reply: start bit + 20 GCR bits at 5/4 of the frame bit rate. GCR never
+// has more than two zeros in a row, so a run longer than a few bits is the
+// gap between our frame and the reply.
+#define DSHOT_REPLY_BITS        21
+#define DSHOT_REPLY_BIT_TICKS   (DSHOT_BIT_TICKS * 4 / 5)
+#define DSHOT_REPLY_GAP_TICKS   (DSHOT_REPLY_BIT_TICKS * 6)
+
+// Throttle values (1-47 are ESC commands)
+#define DSHOT_THROTTLE_MIN      48
+#define DSHOT_THROTTLE_MAX      2047
+#define DSHOT_3D_FORWARD_MIN    1048        // 3D: 48-1047 reverse, 1048-2047 forward
+
+static rmt_channel_handle_t tx_channel = NULL;
+static rmt_encoder_handle_t encoder = NULL;
+static uint8_t tx_frame[2];                 // Read by the encoder until the frame is out
+static int8_t last_direction = 1;           // Direction of the last non-zero throttle
+
+#if ESC_DSHOT_BIDIR
+static rmt_channel_handle_t rx_channel = NULL;
+static rmt_symbol_word_t rx_symbols[DSHOT_MEM_SYMBOLS];
+
+static const rmt_receive_config_t rx_config = {
+    .signal_range_min_ns = DSHOT_RX_GLITCH_NS,
+    .signal_range_max_ns = DSHOT_RX_IDLE_NS,
+};
+
+// Latest valid reply, written by the receive-done ISR
+static volatile uint32_t reply_erpm = 0;
+static volatile uint32_t reply_time_us = 0;
+static volatile bool have_reply = false;
+
+// GCR quintet -> nibble + 1 (0 = not a GCR code)
+static const DRAM_ATTR uint8_t gcr_nibble[32] = {
+    [0x19] = 0x0 + 1, [0x1B] = 0x1 + 1, [0x12] = 0x2 + 1, [0x13] = 0x3 + 1,
+    [0x1D] = 0x4 + 1, [0x15] = 0x5 + 1, [0x16] = 0x6 + 1, [0x17] = 0x7 + 1,
+    [0x1A] = 0x8 + 1, [0x09] = 0x9 + 1, [0x0A] = 0xA + 1, [0x0B] = 0xB + 1,
+    [0x1E] = 0xC + 1, [0x0D] = 0xD + 1, [0x0E] = 0xE + 1, [0x0F] = 0xF + 1,
+};
+
+/**
+ * @brief Decode the reply in a capture
+ * @return eRPM (0 = motor stopped), -1 if there is no valid reply
+ */
+static int32_t IRAM_ATTR decode_reply(const rmt_symbol_word_t *symbols, size_t count)
+{
+    uint32_t gcr = 0;
+    int pos = -1;   // Reply bit at the end of the current run, -1 before the gap
+
+    // Each run ends at an edge, and each edge in the reply is a one
+    for (size_t i = 0; i < count * 2; i++) {
+        uint32_t ticks = (i & 1) ? symbols[i / 2].duration1 : symbols[i / 2].duration0;
+        if (ticks == 0) {
+            break;  // End of capture
+        }
+        if (pos < 0) {
+            if (ticks >= DSHOT_REPLY_GAP_TICKS) {
+                pos = 0;
+            }
+            continue;
+        }
+        pos += (ticks + DSHOT_REPLY_BIT_TICKS / 2) / DSHOT_REPLY_BIT_TICKS;
+        if (pos >= DSHOT_REPLY_BITS) {
+            break;
+        }
+        gcr |= 1u << (DSHOT_REPLY_BITS - 1 - pos);
+    }
+    if (pos < 0) {
+        return -1;
+    }
+
+    // 20 GCR bits -> 16 bits: 3-bit exponent, 9-bit period mantissa, checksum
+    uint32_t value = 0;
+    for (int shift = 15; shift >= 0; shift -= 5) {
+        uint8_t nibble = gcr_nibble[(gcr >> shift) & 0x1F];
+        if (nibble == 0) {
+            return -1;
+        }
+        value = (value << 4) | (nibble - 1);
+    }
+    if (((value ^ (value >> 4) ^ (value >> 8) ^ (value >> 12)) & 0x0F) != 0x0F) {
+        return -1;
+    }
+
+    value >>= 4;
+    if (value == 0x0FFF) {
+        return 0;   // Longest period: motor stopped
+    }
+    uint32_t period_us = (value & 0x1FF) << (value >> 9);
+    if (period_us == 0) {
+        return -1;
+    }
+    return (int32_t)(60000000u / period_us);
+}
+
+/**
+ * @brief RMT receive-done callback (one per frame, reply or not)
+ */
+static bool IRAM_ATTR rx_done_callback(rmt_channel_handle_t channel,
+                                       const rmt_rx_done_event_data_t *edata,
+                                       void *user_data)
+{
+    int32_t erpm = decode_reply(edata->received_symbols, edata->num_symbols);
+    if (erpm >= 0) {
+        reply_erpm = (uint32_t)erpm;
+        reply_time_us = (uint32_t)esp_timer_get_time();
+        have_reply = true;
+    }
+    return false;
+}
+#endif
+
+/**
+ * @brief DShot throttle value for an ESC pulse width
+ */
+static uint16_t throttle_of(uint16_t pulse_us)
+{
+    if (pulse_us < RC_DEFAULT_MIN_US) pulse_us = RC_DEFAULT_MIN_US;
+    if (pulse_us > RC_DEFAULT_MAX_US) pulse_us = RC_DEFAULT_MAX_US;
+
+#if ESC_DSHOT_3D
+    if (pulse_us > RC_DEFAULT_CENTER_US) {
+        last_direction = 1;
+        return DSHOT_3D_FORWARD_MIN + (uint32_t)(pulse_us - RC_DEFAULT_CENTER_US) *
+               (DSHOT_THROTTLE_MAX - DSHOT_3D_FORWARD_MIN) / (RC_DEFAULT_MAX_US - RC_DEFAULT_CENTER_US);
+    }
+    if (pulse_us < RC_DEFAULT_CENTER_US) {
+        last_direction = -1;
+        return DSHOT_THROTTLE_MIN + (uint32_t)(RC_DEFAULT_CENTER_US - pulse_us) *
+               (DSHOT_3D_FORWARD_MIN - 1 - DSHOT_THROTTLE_MIN) / (RC_DEFAULT_CENTER_US - RC_DEFAULT_MIN_US);
+    }
+    return 0;
+#else
+    if (pulse_us == RC_DEFAULT_MIN_US) {
+        return 0;
+    }
+    return DSHOT_THROTTLE_MIN + (uint32_t)(pulse_us - RC_DEFAULT_MIN_US) *
+           (DSHOT_THROTTLE_MAX - DSHOT_THROTTLE_MIN) / (RC_DEFAULT_MAX_US - RC_DEFAULT_MIN_US);
+#endif
+}
+
+/**
+ * @brief Frame for a throttle value (telemetry request bit clear)
+ */
+static uint16_t frame_of(uint16_t throttle)
+{
+    uint16_t value = throttle << 1;
+    uint16_t crc = value ^ (value >> 4) ^ (value >> 8);
+#if ESC_DSHOT_BIDIR
+    crc = ~crc;
+#endif
+    return (uint16_t)((value << 4) | (crc & 0x0F));
+}
+
+esp_err_t dshot_init(int gpio)
+{
+    esp_err_t ret;
+
+#if ESC_DSHOT_BIDIR
+    // Receiver first: the transmitter loops its output back onto this pin
+    rmt_rx_channel_config_t rx_chan_config = {
+        .gpio_num = gpio,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = DSHOT_RESOLUTION_HZ,
+        .mem_block_symbols = DSHOT_MEM_SYMBOLS,
+    };
+    ret = rmt_new_rx_channel(&rx_chan_config, &rx_channel);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create RMT RX channel: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    rmt_rx_event_callbacks_t callbacks = {
+        .on_recv_done = rx_done_callback,
+    };
+    ESP_ERROR_CHECK(rmt_rx_register_event_callbacks(rx_channel, &callbacks, NULL));
+    ESP_ERROR_CHECK(rmt_enable(rx_channel));
+#endif
+
+    rmt_tx_channel_config_t tx_chan_config = {
+        .gpio_num = gpio,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = DSHOT_RESOLUTION_HZ,
+        .mem_block_symbols = DSHOT_MEM_SYMBOLS,
+        .trans_queue_depth = 2,
+#if ESC_DSHOT_BIDIR
+        .flags.invert_out = 1,      // Line idles high
+        .flags.io_loop_back = 1,    // Receiver listens to the same pin
+        .flags.io_od_mode = 1,      // Released between frames for the ESC to reply
+#endif
+    };
+    ret = rmt_new_tx_channel(&tx_chan_config, &tx_channel);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create RMT TX channel: %s", esp_err_to_name(ret));
+#if ESC_DSHOT_BIDIR
+        rmt_disable(rx_channel);
+        rmt_del_channel(rx_channel);
+        rx_channel = NULL;
+#endif
+        return ret;
+    }
+
+    rmt_bytes_encoder_config_t encoder_config = {
+        .bit0 = {
+            .level0 = 1, .duration0 = DSHOT_T0H_TICKS,
+            .level1 = 0, .duration1 = DSHOT_BIT_TICKS - DSHOT_T0H_TICKS,
+        },
+        .bit1 = {
+            .level0 = 1, .duration0 = DSHOT_T1H_TICKS,
+            .level1 = 0, .duration1 = DSHOT_BIT_TICKS - DSHOT_T1H_TICKS,
+        },
+        .flags.msb_first = 1,
+    };
+    ESP_ERROR_CHECK(rmt_new_bytes_encoder(&encoder_config, &encoder));
+    ESP_ERROR_CHECK(rmt_enable(tx_channel));
+
+#if ESC_DSHOT_BIDIR
+    gpio_pullup_en(gpio);
+#endif
+
+    ESP_LOGI(TAG, "DShot%d on GPIO %d%s%s", DSHOT_BITRATE / 1000, gpio,
+             ESC_DSHOT_3D ? ", 3D" : "", ESC_DSHOT_BIDIR ? ", eRPM telemetry" : "");
+    return ESP_OK;
+}
+
+esp_err_t dshot_write(uint16_t pulse_us)
+{
+    if (tx_channel == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint16_t frame = frame_of(throttle_of(pulse_us));
+    tx_frame[0] = (uint8_t)(frame >> 8);
+    tx_frame[1] = (uint8_t)frame;
+
+#if ESC_DSHOT_BIDIR
+    // Fails only if the last capture is still open (the ESC is still
+    // replying); that frame then goes without a reading
+    rmt_receive(rx_channel, rx_symbols, sizeof(rx_symbols), &rx_config);
+#endif
+
+    static const rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+    };
+    return rmt_transmit(tx_channel, encoder, tx_frame, sizeof(tx_frame), &transmit_config);
+}
+
+bool dshot_get_rpm(uint32_t *rpm)
+{
+#if ESC_DSHOT_BIDIR
+    if (!have_reply) {
+        return false;
+    }
+    uint32_t at = reply_time_us;
+    uint32_t erpm = reply_erpm;
+    if ((uint32_t)esp_timer_get_time() - at > ESC_TELEMETRY_TIMEOUT_MS * 1000u) {
+        return false;
+    }
+    *rpm = erpm / (ESC_MOTOR_POLES / 2);
+    return true;
+#else
+    (void)rpm;
+    return false;
+#endif
+}
+
+bool dshot_get_velocity(int16_t *velocity)
+{
+    uint32_t rpm;
+    if (!dshot_get_rpm(&rpm)) {
+        return false;
+    }
+    uint32_t speed = rpm * 1000u / ESC_MOTOR_MAX_RPM;
+    if (speed > 1000) {
+        speed = 1000;
+    }
+    *velocity = (int16_t)(last_direction < 0 ? -(int32_t)speed : (int32_t)speed);
+    return true;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file dshot.h
+ * @brief DShot300/600 drive ESC output on RMT with bidirectional eRPM telemetry
+ *
+ * Each frame carries an 11-bit throttle value and a checksum, sent by the
+ * RMT transmitter from a fixed symbol table, so the ESC gets a new throttle
+ * every control tick with no PWM period to wait for and no endpoints to
+ * calibrate. With ESC_DSHOT_BIDIR the line is inverted and the ESC answers
+ * each frame with its eRPM on the same wire; the reply is captured by an
+ * RMT receiver and decoded in its receive-done interrupt.
+ *
+ * Used by pwm_output.c for OUTPUT_FN_ESC when ESC_PROTOCOL selects DShot.
+ */
+
+#ifndef DSHOT_H
+#define DSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "esp_err.h"
+
+/**
+ * @brief Set up RMT TX (and RX for telemetry) on a pin
+ * @param gpio ESC signal pin
+ * @return ESP_OK, or the RMT driver error (no free channel)
+ */
+esp_err_t dshot_init(int gpio);
+
+/**
+ * @brief Send one frame for an ESC pulse width
+ *
+ * The pulse is mapped onto the DShot throttle range: with ESC_DSHOT_3D,
+ * RC_DEFAULT_CENTER_US is stop and either side runs forward or reverse;
+ * otherwise RC_DEFAULT_MIN_US..MAX_US runs stop to full. With telemetry,
+ * the receiver is armed for the reply first.
+ * @param pulse_us ESC pulse width (us)
+ * @return ESP_OK, ESP_ERR_INVALID_STATE before dshot_init()
+ */
+esp_err_t dshot_write(uint16_t pulse_us);
+
+/**
+ * @brief Latest measured motor RPM
+ * @param rpm Receives the motor RPM (eRPM / pole pairs)
+ * @return false without telemetry, or if no valid reply arrived within
+ *         ESC_TELEMETRY_TIMEOUT_MS
+ */
+bool dshot_get_rpm(uint32_t *rpm);
+
+/**
+ * @brief Measured motor speed on the vehicle velocity scale
+ *
+ * ESC_MOTOR_MAX_RPM is velocity 1000; the sign is the direction last
+ * commanded (eRPM carries no direction).
+ * @param velocity Receives -1000..1000, left unchanged on false
+ * @return false when dshot_get_rpm() has nothing
+ */
+bool dshot_get_velocity(int16_t *velocity);
+
+#endif // DSHOT_H
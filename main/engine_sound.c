@@ -10,8 +10,8 @@
  * - Engine start sound
  * - Jake brake sound
  *
- * The engine sound runs in a dedicated FreeRTOS task, mixing
- * samples at variable rates to simulate RPM changes.
+ * The audio mixer task calls engine_sound_render() once per block,
+ * mixing samples at variable rates to simulate RPM changes.
  */
 
 #include "engine_sound.h"
@@ -19,6 +19,11 @@
 #include "sound.h"
 #include "nvs_storage.h"
 #include "tuning.h"
+#include "audio_mixer.h"
+#include "adpcm.h"
+#include "resample.h"
+#include "sound_pack.h"
+#include "perf.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -26,28 +31,70 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
-#include "driver/i2s_std.h"
 #include "esp_log.h"
 #include "esp_timer.h"
-#include "esp_task_wdt.h"
 #include "esp_random.h"
+#include "esp_heap_caps.h"
 
 // Sound profiles system
 #include "sounds/sound_profiles.h"
 
-// Sound effect samples
+// Sound effect samples (selected under Kconfig "Crawler sound content")
+#if CONFIG_CRAWLER_SOUND_AIR_BRAKE
 #include "sounds/effects/air_brake.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_REVERSE_BEEP
 #include "sounds/effects/reverse_beep.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_GEAR_SHIFT
 #include "sounds/effects/gear_shift.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_WASTEGATE
 #include "sounds/effects/wastegate.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_TRUCK
 #include "sounds/effects/truck_horn.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_MANTGE
 #include "sounds/effects/mantge_horn.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_CUCARACHA
 #include "sounds/effects/la_cucaracha.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_2TONE
 #include "sounds/effects/horn_2tone.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_DIXIE
 #include "sounds/effects/horn_dixie.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_PETERBILT
 #include "sounds/effects/horn_peterbilt.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_OUTLAW
 #include "sounds/effects/horn_outlaw.h"
+#endif
+#if CONFIG_CRAWLER_SOUND_MODE_SWITCH
 #include "sounds/mode_switch_sound.h"
+#endif
+
+// First compiled-in horn: the default (Truck when none is, for sound packs)
+#if CONFIG_CRAWLER_SOUND_HORN_TRUCK || !(CONFIG_CRAWLER_SOUND_HORN_MANTGE || CONFIG_CRAWLER_SOUND_HORN_CUCARACHA || \
+    CONFIG_CRAWLER_SOUND_HORN_2TONE || CONFIG_CRAWLER_SOUND_HORN_DIXIE || CONFIG_CRAWLER_SOUND_HORN_PETERBILT || \
+    CONFIG_CRAWLER_SOUND_HORN_OUTLAW)
+#define HORN_TYPE_DEFAULT       HORN_TYPE_TRUCK
+#elif CONFIG_CRAWLER_SOUND_HORN_MANTGE
+#define HORN_TYPE_DEFAULT       HORN_TYPE_MANTGE
+#elif CONFIG_CRAWLER_SOUND_HORN_CUCARACHA
+#define HORN_TYPE_DEFAULT       HORN_TYPE_CUCARACHA
+#elif CONFIG_CRAWLER_SOUND_HORN_2TONE
+#define HORN_TYPE_DEFAULT       HORN_TYPE_2TONE
+#elif CONFIG_CRAWLER_SOUND_HORN_DIXIE
+#define HORN_TYPE_DEFAULT       HORN_TYPE_DIXIE
+#elif CONFIG_CRAWLER_SOUND_HORN_PETERBILT
+#define HORN_TYPE_DEFAULT       HORN_TYPE_PETERBILT
+#else
+#define HORN_TYPE_DEFAULT       HORN_TYPE_OUTLAW
+#endif
 
 static const char *TAG = "ENGINE_SND";
 
@@ -55,19 +102,18 @@ static const char *TAG = "ENGINE_SND";
 static const sound_profile_def_t *current_profile = NULL;
 
 // Audio parameters - use 22050 Hz to match source samples
-#define ENGINE_SAMPLE_RATE      22050
 #define ENGINE_BITS_PER_SAMPLE  16
-#define ENGINE_BUFFER_SIZE      512   // Match sound.c DMA frame size
+#define AUDIO_BLOCK_FRAMES      512   // Match sound.c DMA frame size
 
-// RPM parameters
-#define IDLE_RPM                100     // Base idle RPM (normalized scale)
-#define MAX_RPM                 500     // Maximum RPM (normalized scale)
+// RPM parameters (normalized scale, shared with the vehicle model)
+#define IDLE_RPM                VEHICLE_IDLE_RPM
+#define MAX_RPM                 VEHICLE_MAX_RPM
 
 // Default configuration for CAT 3408
 static engine_sound_config_t config = {
     .magic = SOUND_CONFIG_MAGIC,
     .version = SOUND_CONFIG_VERSION,
-    .profile = SOUND_PROFILE_CAT_3408,
+    .profile = SOUND_PROFILE_DEFAULT,
     .master_volume_level1 = 100,    // Normal volume
     .master_volume_level2 = 50,     // Quiet mode (half volume)
     .active_volume_level = 0,       // Start on level 1
@@ -98,7 +144,7 @@ static engine_sound_config_t config = {
     .wastegate_volume = 70,
     // Horn settings
     .horn_enabled = true,
-    .horn_type = HORN_TYPE_TRUCK,
+    .horn_type = HORN_TYPE_DEFAULT,
     .horn_volume = 80,
     // Mode switch sound settings
     .mode_switch_sound_enabled = true,
@@ -108,31 +154,28 @@ static engine_sound_config_t config = {
 // Engine state
 static engine_state_t engine_state = ENGINE_OFF;
 static bool engine_enabled = false;
-static bool engine_task_running = false;
-static TaskHandle_t engine_task_handle = NULL;
+static bool engine_initialized = false;
+static bool bench_active = false;               // engine_sound_bench_mix() running
+static uint32_t start_sample_idx = 0;           // Start sound playback index
+static uint32_t start_sample_frac = 0;          // 16-bit fraction past it (native-rate clips)
+
+// Throttle-to-audio latency probe: set by engine_sound_update() on a
+// large target change, handed to the mixer by the first block after it
+#define LATENCY_PROBE_RPM_STEP  40
+static uint32_t latency_taken_us = 0;           // Mixer task only
 static SemaphoreHandle_t engine_mutex = NULL;
 
 // RPM tracking
-static volatile uint16_t current_rpm = IDLE_RPM;
-static volatile uint16_t target_rpm = IDLE_RPM;
-static volatile bool jake_brake_active = false;
+static volatile uint16_t current_rpm = IDLE_RPM;    // Written by the mixer
+static uint16_t target_rpm = IDLE_RPM;              // Control task demand
+static bool jake_brake_active = false;              // Control task demand
 
 // Shutdown state (for gradual engine stop)
 static volatile uint8_t shutdown_attenuation = 1;    // Volume divider (1 = full, higher = quieter)
 static volatile uint16_t shutdown_speed_pct = 100;   // Speed percentage (100 = normal, higher = slower)
 
-// Transmission simulation (3-speed automatic)
-// Gear ratios (x10): reverse, 1st, 2nd, 3rd - based on GM Turbo HydraMatic 400
-static const int16_t gear_ratios[4] = {10, 25, 15, 10};  // 1.0, 2.5, 1.5, 1.0
-static volatile uint8_t current_gear = 1;                 // Current gear (0=reverse, 1-3=forward)
-static volatile int16_t engine_load = 0;                  // 0-180 (throttle - rpm difference)
-static volatile int16_t vehicle_speed = 0;                // 0-500 normalized vehicle speed
+// Throttle tracking (the transmission itself is modelled in vehicle.c)
 static volatile int16_t last_throttle = 0;                // For wastegate detection
-static int64_t last_upshift_time = 0;                     // Shift lockout timer
-static int64_t last_downshift_time = 0;                   // Shift lockout timer
-
-// Clutch engaging point - below this speed, RPM follows throttle not speed
-#define CLUTCH_ENGAGING_POINT   80
 
 // Throttle-dependent volume (like reference project - smooth fading)
 // Volume ranges from idle to full throttle - increased for more output
@@ -142,48 +185,72 @@ static int64_t last_downshift_time = 0;                   // Shift lockout timer
 #define REV_FULL_VOLUME_PCT     220     // Rev volume at full throttle
 
 static volatile int16_t current_throttle_faded = 0;    // Smoothed throttle for volume
-static volatile int16_t throttle_dependent_volume = ENGINE_IDLE_VOLUME_PCT;
-static volatile int16_t throttle_dependent_rev_volume = REV_IDLE_VOLUME_PCT;
+static int16_t throttle_dependent_volume = ENGINE_IDLE_VOLUME_PCT;
+static int16_t throttle_dependent_rev_volume = REV_IDLE_VOLUME_PCT;
 
 // Gear shift effect (brief power cut and RPM drop like real automatic)
-static volatile bool gear_shift_trigger = false;
-static volatile uint8_t prev_gear = 1;
-static volatile int64_t gear_shift_start_time = 0;
-static volatile uint8_t gear_shift_attenuation = 0;  // 0-100, current shift effect intensity
-static volatile bool rpm_settled_after_upshift = true;  // Must see low RPM before next upshift
+static uint8_t gear_shift_seq = 0;                   // Last vehicle shift_seq seen (control task)
+static int64_t gear_shift_start_time = 0;            // Mixer task only
+static uint8_t gear_shift_attenuation = 0;           // 0-100, current shift effect intensity
 
 #define GEAR_SHIFT_DURATION_MS  200   // Duration of shift effect
 
-// Sample playback positions (using fixed-point for sub-sample accuracy)
-// Format: 16.16 fixed point (upper 16 bits = integer, lower 16 bits = fraction)
-static uint32_t idle_sample_pos = 0;
-static uint32_t rev_sample_pos = 0;
-static uint32_t knock_sample_pos = 0;
-static uint32_t jake_sample_pos = 0;
-
-// Sound effect playback state
-static bool air_brake_trigger = false;
-static uint32_t air_brake_sample_pos = 0;
-
-static bool reverse_beep_playing = false;
-static uint32_t reverse_beep_sample_pos = 0;
+// Granular engine voices
+#define SYNTH_GRAIN_VOICES      6       // Overlapping grains (~4 needed at max RPM)
 
-static bool gear_shift_sound_trigger = false;
-static uint32_t gear_shift_sound_sample_pos = 0;
+typedef struct {
+    const int8_t *grain;
+    uint32_t pos;                       // 16.16
+    uint32_t inc;                       // 16.16
+    int32_t vol;
+    bool active;
+} synth_grain_t;
 
-
-static bool wastegate_trigger = false;
-static uint32_t wastegate_sample_pos = 0;
+/**
+ * @brief Loop layer playback of one profile (mixer task only)
+ *
+ * Positions are 16.16 fixed point (upper 16 bits = integer, lower 16 bits =
+ * fraction). There are two sets so the outgoing profile keeps playing from
+ * its own positions while the incoming one fades in.
+ */
+typedef struct {
+    const sound_profile_def_t *profile;
+    uint32_t idle_pos;
+    uint32_t rev_pos;
+    uint32_t knock_pos;
+    uint32_t jake_pos;
+    uint8_t fire_slice;                 // Idle loop slice of the last firing
+    uint8_t fire_slot;                  // Firing order slot of the last firing
+    uint8_t knock_accent;               // Accent of the knock playing (percent)
+    synth_grain_t grains[SYNTH_GRAIN_VOICES];
+    uint32_t synth_phase;               // Firing phase, wraps at each firing
+    uint8_t synth_cylinder;             // Firing slot of the next grain
+} engine_layers_t;
+
+static engine_layers_t layer_sets[2];
+static volatile int live_set = 0;               // Set playing the current profile
+static engine_layers_t *lay = &layer_sets[0];   // Set the mix kernels render
+
+// Profile hot-swap: the loader task caches the next profile and hands it
+// over here; the mixer crossfades it in over ENGINE_PROFILE_XFADE_MS
+#define XFADE_FRAMES    ((uint32_t)((uint64_t)ENGINE_PROFILE_XFADE_MS * AUDIO_SAMPLE_RATE / 1000))
+
+static const sound_profile_def_t *volatile incoming_profile = NULL;
+static volatile bool xfade_active = false;
+static uint32_t xfade_pos = 0;                  // Frames of the crossfade rendered
+static int32_t xfade_bus[AUDIO_BLOCK_FRAMES];   // Incoming profile's engine bus
+static TaskHandle_t loader_task_handle = NULL;
+static volatile int requested_profile = -1;     // Latest engine_sound_set_profile(), -1 = none
+
+// Menu mute: the engine keeps running, its bus fades to silence
+static volatile bool engine_muted = false;
+
+// Wastegate trigger tracking
 static int64_t wastegate_lockout_time = 0;  // Cooldown timer
 static int16_t prev_throttle_for_wastegate = 0;  // Track throttle changes
 
-// Mode switch sound (air shift sound for steering mode changes)
-static bool mode_switch_trigger = false;
-static uint32_t mode_switch_sample_pos = 0;
-
-// Horn sound (looping while button held)
+// Horn button state (the horn voice only plays while this is held)
 static bool horn_active = false;
-static uint32_t horn_sample_pos = 0;
 
 // ============================================================================
 // SOUND EFFECT VARIATION SYSTEM
@@ -204,23 +271,6 @@ static uint32_t horn_sample_pos = 0;
 #define ATTACK_MAX_SAMPLES      882     // ~40ms maximum attack
 #define ATTACK_RANGE            (ATTACK_MAX_SAMPLES - ATTACK_MIN_SAMPLES)
 
-// Per-effect variation state (set when effect triggers)
-static uint32_t air_brake_pitch_increment = 0x10000;
-static int8_t air_brake_volume_variation = 0;
-static uint16_t air_brake_attack_samples = ATTACK_MIN_SAMPLES;
-
-static uint32_t gear_shift_pitch_increment = 0x10000;
-static int8_t gear_shift_volume_variation = 0;
-static uint16_t gear_shift_attack_samples = ATTACK_MIN_SAMPLES;
-
-static uint32_t wastegate_pitch_increment = 0x10000;
-static int8_t wastegate_volume_variation = 0;
-static uint16_t wastegate_attack_samples = ATTACK_MIN_SAMPLES;
-
-static uint32_t mode_switch_pitch_increment = 0x10000;
-static int8_t mode_switch_volume_variation = 0;
-static uint16_t mode_switch_attack_samples = ATTACK_MIN_SAMPLES;
-
 /**
  * @brief Generate random pitch increment with variation
  *
@@ -269,70 +319,283 @@ static inline uint16_t calc_attack_envelope(uint32_t sample_pos, uint16_t attack
     return (uint16_t)((sample_pos * 256) / attack_samples);
 }
 
-// I2S handle (shared with sound.c - we'll get it from there)
-extern i2s_chan_handle_t tx_handle;
-
 /**
- * @brief Get the currently active master volume
+ * @brief Playback increment of a clip on the output bus
  *
- * Returns volume from level 1 or level 2 based on active_volume_level setting.
- * This is used for all volume calculations in the engine sound system.
+ * Clips are stored at their own sample_rate (long effects at 11025 or
+ * 16000 Hz to save flash), so the pitch increment is scaled by
+ * rate / AUDIO_SAMPLE_RATE: 0x10000 plays any clip at its recorded pitch.
  */
-static inline uint8_t get_master_volume(void)
-{
-    return config.active_volume_level == 0 ?
-           config.master_volume_level1 : config.master_volume_level2;
+static inline uint32_t clip_increment(uint32_t increment, uint32_t sample_rate) {
+    return resample_scale(increment, sample_rate, AUDIO_SAMPLE_RATE);
 }
 
+// ============================================================================
+// EFFECT VOICE POOL
+// Every sound effect is a voice: a clip, loop bounds, pitch increment and
+// attack envelope. Active voices are tracked in a bitmask, so the mixer
+// only touches effects that are actually playing. Adding an effect is one
+// voice_id_t entry plus one voice_descs[] row.
+// ============================================================================
+
 /**
- * @brief Get sample from idle sound with interpolation
+ * @brief Effect voices
  */
-static inline int16_t get_idle_sample(uint32_t pos_fixed) {
-    uint32_t idx = pos_fixed >> 16;
-    if (idx >= current_profile->idle.sample_count) {
-        idle_sample_pos = 0;
-        idx = 0;
+typedef enum {
+    VOICE_AIR_BRAKE = 0,        // One-shot release after stop
+    VOICE_REVERSE_BEEP,         // Loops while reversing
+    VOICE_GEAR_SHIFT,           // One-shot clunk on gear change
+    VOICE_WASTEGATE,            // One-shot blowoff after throttle drop
+    VOICE_MODE_SWITCH,          // One-shot air shift on steering mode change
+    VOICE_HORN,                 // Loops within its loop region while held
+    VOICE_COUNT
+} voice_id_t;
+
+#define VOICE_BIT(id)           (1u << (id))
+#define VOICE_MASK_ALL          (VOICE_BIT(VOICE_COUNT) - 1)
+
+#define VOICE_MAX_SAMPLES       RESAMPLE_MAX_SAMPLES
+
+/**
+ * @brief Playback state of one voice
+ */
+typedef struct {
+    const int8_t *samples;
+    sound_format_t format;      // PCM8 or IMA-ADPCM blocks
+    uint32_t loop_begin;        // Loop restart point (looping voices)
+    uint32_t end;               // One past the last sample played
+    bool loop;
+    uint32_t pos;               // 16.16 read position
+    uint32_t increment;         // 16.16 pitch increment
+    int8_t volume_variation;    // Added to the configured volume percentage
+    uint16_t attack_samples;    // Attack ramp length (0 = none)
+    uint8_t serial;             // Bumped on every start, detects restarts mid-block
+} voice_t;
+
+/**
+ * @brief Static per-voice settings, read from the sound config
+ */
+typedef struct {
+    const bool *enabled;        // Voice stops when this goes false
+    const uint8_t *volume;      // Volume percentage (0-100)
+    bool varied;                // Apply per-trigger volume variation (clamped 10-100)
+    bool rpm_scaled;            // Scale 50-100% with RPM
+} voice_desc_t;
+
+static const voice_desc_t voice_descs[VOICE_COUNT] = {
+    [VOICE_AIR_BRAKE]    = { &config.air_brake_enabled,         &config.air_brake_volume,    true,  false },
+    [VOICE_REVERSE_BEEP] = { &config.reverse_beep_enabled,      &config.reverse_beep_volume, false, false },
+    [VOICE_GEAR_SHIFT]   = { &config.gear_shift_enabled,        &config.gear_shift_volume,   true,  false },
+    [VOICE_WASTEGATE]    = { &config.wastegate_enabled,         &config.wastegate_volume,    true,  true  },
+    [VOICE_MODE_SWITCH]  = { &config.mode_switch_sound_enabled, &config.mode_switch_volume,  true,  false },
+    [VOICE_HORN]         = { &config.horn_enabled,              &config.horn_volume,         false, false },
+};
+
+/**
+ * @brief Horn clip and loop region
+ *
+ * Lengths are referenced rather than copied because the sample headers
+ * define them as const variables (not constant expressions).
+ */
+typedef struct {
+    const signed char *samples;
+    const unsigned int *loop_begin;
+    const unsigned int *loop_end;
+    const unsigned int *sample_rate;
+    sound_format_t format;      // Omitted (PCM8) unless the header is ADPCM
+    const char *pack_name;      // Replacement clip name in the sound pack
+    const char *name;           // Display name
+} horn_clip_t;
+
+// Built-in clip, or only the sound pack name when compiled out (samples NULL)
+#define HORN_CLIP(var, pack, label) \
+    { var##Samples, &var##LoopBegin, &var##LoopEnd, &var##SampleRate, SOUND_FORMAT_PCM8, pack, label }
+#define HORN_PACK_ONLY(pack, label)     { .pack_name = pack, .name = label }
+
+static const horn_clip_t horn_clips[HORN_TYPE_COUNT] = {
+#if CONFIG_CRAWLER_SOUND_HORN_TRUCK
+    [HORN_TYPE_TRUCK]     = HORN_CLIP(truckHorn, "horn_truck", "Truck"),
+#else
+    [HORN_TYPE_TRUCK]     = HORN_PACK_ONLY("horn_truck", "Truck"),
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_MANTGE
+    [HORN_TYPE_MANTGE]    = HORN_CLIP(mantgeHorn, "horn_mantge", "MAN TGE"),
+#else
+    [HORN_TYPE_MANTGE]    = HORN_PACK_ONLY("horn_mantge", "MAN TGE"),
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_CUCARACHA
+    [HORN_TYPE_CUCARACHA] = HORN_CLIP(cucaracha, "horn_cucaracha", "La Cucaracha"),
+#else
+    [HORN_TYPE_CUCARACHA] = HORN_PACK_ONLY("horn_cucaracha", "La Cucaracha"),
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_2TONE
+    [HORN_TYPE_2TONE]     = HORN_CLIP(horn2Tone, "horn_2tone", "2-Tone"),
+#else
+    [HORN_TYPE_2TONE]     = HORN_PACK_ONLY("horn_2tone", "2-Tone"),
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_DIXIE
+    [HORN_TYPE_DIXIE]     = HORN_CLIP(hornDixie, "horn_dixie", "Dixie"),
+#else
+    [HORN_TYPE_DIXIE]     = HORN_PACK_ONLY("horn_dixie", "Dixie"),
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_PETERBILT
+    [HORN_TYPE_PETERBILT] = HORN_CLIP(hornPeterbilt, "horn_peterbilt", "Peterbilt"),
+#else
+    [HORN_TYPE_PETERBILT] = HORN_PACK_ONLY("horn_peterbilt", "Peterbilt"),
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_OUTLAW
+    [HORN_TYPE_OUTLAW]    = HORN_CLIP(hornOutlaw, "horn_outlaw", "Outlaw"),
+#else
+    [HORN_TYPE_OUTLAW]    = HORN_PACK_ONLY("horn_outlaw", "Outlaw"),
+#endif
+};
+
+// Voices are started from the control path and advanced by the engine
+// sound task; voice_lock guards the pool and the active mask
+static voice_t voices[VOICE_COUNT];
+static volatile uint32_t voice_active_mask = 0;
+static portMUX_TYPE voice_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief (Re)start a voice from the beginning of its clip
+ *
+ * increment and attack_samples are at the output rate; both are converted
+ * to steps through a clip recorded at sample_rate.
+ */
+static void voice_start(voice_id_t id, const int8_t *samples, sound_format_t format,
+                        uint32_t sample_rate, uint32_t loop_begin, uint32_t end, bool loop,
+                        uint32_t increment, int8_t volume_variation, uint16_t attack_samples) {
+    if (end > VOICE_MAX_SAMPLES) end = VOICE_MAX_SAMPLES;
+    if (loop_begin >= end) loop_begin = 0;
+    increment = clip_increment(increment, sample_rate);
+    if (sample_rate != 0 && sample_rate < AUDIO_SAMPLE_RATE) {
+        // Same attack time in fewer clip samples (never longer, so it stays
+        // inside one ADPCM window)
+        attack_samples = (uint16_t)(((uint32_t)attack_samples * sample_rate) / AUDIO_SAMPLE_RATE);
     }
-    // 8-bit to 16-bit conversion
-    return ((int16_t)current_profile->idle.samples[idx]) << 8;
+
+    taskENTER_CRITICAL(&voice_lock);
+    voice_t *v = &voices[id];
+    v->samples = samples;
+    v->format = format;
+    v->loop_begin = loop_begin;
+    v->end = end;
+    v->loop = loop;
+    v->pos = 0;
+    v->increment = increment;
+    v->volume_variation = volume_variation;
+    v->attack_samples = attack_samples;
+    v->serial++;
+    voice_active_mask |= VOICE_BIT(id);
+    taskEXIT_CRITICAL(&voice_lock);
 }
 
 /**
- * @brief Get sample from rev sound with interpolation
+ * @brief Start a one-shot voice with random pitch, volume and attack
+ * @return Attack length chosen for this instance (samples)
  */
-static inline int16_t get_rev_sample(uint32_t pos_fixed) {
-    uint32_t idx = pos_fixed >> 16;
-    if (idx >= current_profile->rev.sample_count) {
-        rev_sample_pos = 0;
-        idx = 0;
-    }
-    return ((int16_t)current_profile->rev.samples[idx]) << 8;
+static uint16_t voice_start_oneshot(voice_id_t id, const signed char *samples, uint32_t count,
+                                    uint32_t sample_rate) {
+    uint16_t attack = generate_random_attack_samples();
+    voice_start(id, samples, SOUND_FORMAT_PCM8, sample_rate, 0, count, false,
+                generate_random_pitch_increment(), generate_random_volume_variation(), attack);
+    return attack;
 }
 
 /**
- * @brief Get sample from knock sound
+ * @brief Start a one-shot voice from a profile clip (any format)
+ * @return Attack length chosen for this instance (samples)
  */
-static inline int16_t get_knock_sample(uint32_t pos_fixed) {
-    uint32_t idx = pos_fixed >> 16;
-    if (idx >= current_profile->knock.sample_count) {
-        return 0;  // Knock is one-shot
+static uint16_t voice_start_clip(voice_id_t id, const sound_sample_t *clip) {
+    uint16_t attack = generate_random_attack_samples();
+    voice_start(id, clip->samples, clip->format, clip->sample_rate, 0, clip->sample_count, false,
+                generate_random_pitch_increment(), generate_random_volume_variation(), attack);
+    return attack;
+}
+
+/**
+ * @brief Start a looping voice at normal pitch
+ */
+static void voice_start_loop(voice_id_t id, const signed char *samples, sound_format_t format,
+                             uint32_t sample_rate, uint32_t loop_begin, uint32_t loop_end) {
+    voice_start(id, samples, format, sample_rate, loop_begin, loop_end, true, 0x10000, 0, 0);
+}
+
+/**
+ * @brief Stop a voice (no-op if idle)
+ */
+static void voice_stop(voice_id_t id) {
+    taskENTER_CRITICAL(&voice_lock);
+    voice_active_mask &= ~VOICE_BIT(id);
+    taskEXIT_CRITICAL(&voice_lock);
+}
+
+/**
+ * @brief Check whether a voice is playing
+ */
+static inline bool voice_is_active(voice_id_t id) {
+    return (voice_active_mask & VOICE_BIT(id)) != 0;
+}
+
+/**
+ * @brief First compiled-in horn, or HORN_TYPE_COUNT if there is none
+ */
+static horn_type_t first_builtin_horn(void) {
+    horn_type_t type = 0;
+    while (type < HORN_TYPE_COUNT && horn_clips[type].samples == NULL) {
+        type++;
     }
-    return ((int16_t)current_profile->knock.samples[idx]) << 8;
+    return type;
 }
 
 /**
- * @brief Get sample from jake brake sound
+ * @brief Start the horn voice with the configured horn type
+ *
+ * A sound pack clip wins; a horn that is neither in the pack nor compiled
+ * in plays the first compiled-in horn (silent if there is none).
  */
-static inline int16_t get_jake_sample(uint32_t pos_fixed) {
-    if (!current_profile->has_jake_brake) {
-        return 0;
+static void voice_start_horn(void) {
+    horn_type_t type = config.horn_type < HORN_TYPE_COUNT ? config.horn_type : HORN_TYPE_TRUCK;
+    const horn_clip_t *clip = &horn_clips[type];
+    sound_pack_clip_t pack_clip;
+    if (sound_pack_find(clip->pack_name, &pack_clip)) {
+        voice_start_loop(VOICE_HORN, pack_clip.sample.samples, pack_clip.sample.format,
+                         pack_clip.sample.sample_rate, pack_clip.loop_begin, pack_clip.loop_end);
+        return;
     }
-    uint32_t idx = pos_fixed >> 16;
-    if (idx >= current_profile->jake_brake.sample_count) {
-        jake_sample_pos = 0;
-        idx = 0;
+    if (clip->samples == NULL) {
+        type = first_builtin_horn();
+        if (type == HORN_TYPE_COUNT) {
+            return;
+        }
+        clip = &horn_clips[type];
+    }
+    voice_start_loop(VOICE_HORN, clip->samples, clip->format, *clip->sample_rate,
+                     *clip->loop_begin, *clip->loop_end);
+}
+
+/**
+ * @brief Start the mode switch voice (engine running only; otherwise sound.c beeps)
+ */
+static void voice_start_mode_switch(void) {
+#if CONFIG_CRAWLER_SOUND_MODE_SWITCH
+    if (engine_state == ENGINE_RUNNING) {
+        voice_start_oneshot(VOICE_MODE_SWITCH, modeSwitchSamples, modeSwitchSampleCount,
+                            modeSwitchSampleRate);
     }
-    return ((int16_t)current_profile->jake_brake.samples[idx]) << 8;
+#endif
+}
+
+/**
+ * @brief Get the currently active master volume
+ *
+ * Returns volume from level 1 or level 2 based on active_volume_level setting.
+ * This is used for all volume calculations in the engine sound system.
+ */
+static inline uint8_t get_master_volume(void)
+{
+    return config.active_volume_level == 0 ?
+           config.master_volume_level1 : config.master_volume_level2;
 }
 
 /**
@@ -402,355 +665,1065 @@ static inline uint8_t calc_rev_proportion(uint16_t rpm) {
     return (uint8_t)((pos * 100) / range);
 }
 
-// Knock timing state
-static uint32_t last_knock_pos = 0;
-static uint8_t knock_counter = 0;
+// ============================================================================
+// LOOP SAMPLE CACHE
+// The idle, rev, knock and jake brake layers are read on every output
+// sample, so they are copied out of flash into RAM when a profile is
+// loaded; under WiFi/httpd/SPIFFS load flash cache misses stall the mixer.
+// One-shot clips (start, effects, horns) stay in flash.
+// ============================================================================
+
+// Two slots: the render may still read the old copy until the swap is seen.
+// Both are reserved once at init, so a profile switch never touches the heap.
+static sound_profile_def_t cached_profiles[2];
+static int8_t *cache_mem[2] = { NULL, NULL };
+static bool cache_psram[2] = { false, false };
+static uint32_t cache_capacity = 0;     // Bytes per slot
+static int cache_slot = 0;
+static engine_sound_cache_info_t cache_info;
 
 /**
- * @brief Check if knock should trigger
+ * @brief Stored size of a clip in bytes
+ */
+static uint32_t sample_bytes(const sound_sample_t *sample) {
+    if (sample->format == SOUND_FORMAT_IMA_ADPCM) {
+        return adpcm_encoded_bytes(sample->sample_count);
+    }
+    return sample->sample_count;
+}
+
+/**
+ * @brief Choose the loop layers of a profile that fit in a slot
+ *
+ * Layers are taken in order of how often they are read.
+ *
+ * @param layers idle, rev, knock and jake brake
+ * @param limit Slot size in bytes
+ * @param cached Set per layer when it fits
+ * @return Bytes the chosen layers take
+ */
+static uint32_t profile_cache_plan(sound_sample_t *const layers[4], uint32_t limit, bool cached[4]) {
+    uint32_t total = 0;
+    for (int i = 0; i < 4; i++) {
+        uint32_t bytes = layers[i]->samples ? sample_bytes(layers[i]) : 0;
+        cached[i] = bytes > 0 && total + bytes <= limit;
+        if (cached[i]) {
+            total += bytes;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Reserve both cache slots for the largest profile (once)
+ *
+ * Sized over the built-in and sound pack profiles present at boot, within
+ * ENGINE_SAMPLE_CACHE_MAX_BYTES. Internal RAM first, PSRAM as a fallback.
+ */
+static void profile_cache_reserve(void) {
+    if (cache_mem[0] != NULL) {
+        return;
+    }
+
+    uint32_t largest = 0;
+    for (int p = 0; p < sound_profiles_count(); p++) {
+        if (!sound_profiles_is_available(p)) continue;
+        sound_profile_def_t def = *sound_profiles_get(p);
+        sound_sample_t *layers[] = { &def.idle, &def.rev, &def.knock, &def.jake_brake };
+        bool cached[4];
+        uint32_t bytes = profile_cache_plan(layers, ENGINE_SAMPLE_CACHE_MAX_BYTES, cached);
+        if (bytes > largest) largest = bytes;
+    }
+    if (largest == 0) {
+        return;
+    }
+
+    for (int slot = 0; slot < 2; slot++) {
+        cache_mem[slot] = heap_caps_malloc(largest, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        cache_psram[slot] = false;
+        if (cache_mem[slot] == NULL) {
+            cache_mem[slot] = heap_caps_malloc(largest, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+            cache_psram[slot] = (cache_mem[slot] != NULL);
+        }
+    }
+    if (cache_mem[0] == NULL || cache_mem[1] == NULL) {
+        ESP_LOGW(TAG, "No memory for 2x %lu byte sample cache, playing from flash",
+                 (unsigned long)largest);
+        free(cache_mem[0]);
+        free(cache_mem[1]);
+        cache_mem[0] = cache_mem[1] = NULL;
+        return;
+    }
+    cache_capacity = largest;
+}
+
+/**
+ * @brief Build a copy of a profile with its loop layers in RAM
+ *
+ * Fills the free slot. Layers that do not fit in it (or when no slot
+ * could be reserved) keep pointing at flash.
+ *
+ * @return Profile to publish as current_profile
+ */
+static const sound_profile_def_t *profile_cache_load(const sound_profile_def_t *src) {
+    int slot = cache_slot ^ 1;
+    sound_profile_def_t *dst = &cached_profiles[slot];
+    sound_sample_t *layers[] = { &dst->idle, &dst->rev, &dst->knock, &dst->jake_brake };
+    bool cached[4];
+
+    *dst = *src;
+    uint32_t total = profile_cache_plan(layers, cache_mem[slot] ? cache_capacity : 0, cached);
+    uint32_t flash_bytes = 0;
+
+    int8_t *p = cache_mem[slot];
+    for (int i = 0; i < 4; i++) {
+        uint32_t bytes = layers[i]->samples ? sample_bytes(layers[i]) : 0;
+        if (cached[i]) {
+            memcpy(p, layers[i]->samples, bytes);
+            layers[i]->samples = p;
+            p += bytes;
+        } else {
+            flash_bytes += bytes;
+        }
+    }
+
+    cache_info.bytes = total;
+    cache_info.flash_bytes = flash_bytes;
+    cache_info.psram = total > 0 && cache_psram[slot];
+    cache_slot = slot;
+
+    ESP_LOGI(TAG, "Sample cache: %lu bytes in %s, %lu bytes left in flash",
+             (unsigned long)total, cache_info.psram ? "PSRAM" : "SRAM", (unsigned long)flash_bytes);
+    return dst;
+}
+
+/**
+ * @brief Point a layer set at a profile, every loop from its start
+ */
+static void layers_reset(engine_layers_t *set, const sound_profile_def_t *profile) {
+    memset(set, 0, sizeof(*set));
+    set->profile = profile;
+    set->knock_accent = 100;
+}
+
+/**
+ * @brief Profile loader task: cache the requested profile, hand it to the mixer
+ *
+ * Copying the loop layers out of flash takes milliseconds, so it is done
+ * here rather than by the caller (the menu runs in the control task) or
+ * the mixer. A slot is only refilled once the mixer has finished fading
+ * out the profile in it; requests made meanwhile collapse into the latest.
+ */
+static void profile_loader_task(void *arg) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (incoming_profile != NULL || xfade_active) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        int profile = __atomic_exchange_n(&requested_profile, -1, __ATOMIC_SEQ_CST);
+        if (profile < 0) {
+            continue;
+        }
+
+        xSemaphoreTake(engine_mutex, portMAX_DELAY);
+        const sound_profile_def_t *cached = profile_cache_load(sound_profiles_get(profile));
+        current_profile = cached;
+        config.knock_interval = cached->cylinder_count;
+        __atomic_store_n(&incoming_profile, cached, __ATOMIC_SEQ_CST);
+        xSemaphoreGive(engine_mutex);
+
+        audio_mixer_wake();
+        ESP_LOGI(TAG, "Switching to profile: %s", cached->name);
+    }
+}
+
+/**
+ * @brief Take over a profile handed in by the loader (mixer task)
+ *
+ * While the loops play (running or winding down) the new profile fades in
+ * from the start of its loops; with the engine off it replaces the old one
+ * at once. A start sound is left to finish first.
+ */
+static void profile_swap_check(void) {
+    bool loops_playing = engine_initialized &&
+                         ((engine_state == ENGINE_RUNNING && engine_enabled) || engine_state == ENGINE_STOPPING);
+    if (xfade_active && !loops_playing) {
+        // Stopped mid-fade: nothing left to fade
+        live_set ^= 1;
+        xfade_active = false;
+    }
+
+    const sound_profile_def_t *next = incoming_profile;
+    if (next == NULL || xfade_active || engine_state == ENGINE_STARTING) {
+        return;
+    }
+
+    int other = live_set ^ 1;
+    layers_reset(&layer_sets[other], next);
+    if (loops_playing) {
+        xfade_pos = 0;
+        xfade_active = true;
+    } else {
+        live_set = other;
+    }
+    __atomic_store_n(&incoming_profile, NULL, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Blend the incoming profile's bus into the engine bus (mixer task)
+ *
+ * Gains follow 1-t^2 (out) and 1-(1-t)^2 (in), which keeps the level of
+ * two unrelated engine loops close to constant through the fade. The
+ * incoming set becomes the live one when the fade completes.
+ */
+static void xfade_blend(int32_t *engine_bus, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        int32_t t = xfade_pos < XFADE_FRAMES ? (int32_t)((xfade_pos << 15) / XFADE_FRAMES) : 32768;
+        int32_t u = 32768 - t;
+        int32_t gain_out = 32768 - ((t * t) >> 15);
+        int32_t gain_in = 32768 - ((u * u) >> 15);
+        engine_bus[i] = (int32_t)(((int64_t)engine_bus[i] * gain_out +
+                                   (int64_t)xfade_bus[i] * gain_in) >> 15);
+        xfade_pos++;
+    }
+    if (xfade_pos >= XFADE_FRAMES) {
+        live_set ^= 1;
+        xfade_active = false;
+    }
+}
+
+/**
+ * @brief Fade the engine bus toward silence while muted (mixer task)
  *
- * Knock triggers once per cylinder firing, synchronized with idle loop.
- * For V8: 8 knocks per full idle sample loop.
+ * The engine keeps running underneath, so unmuting picks up where it is.
+ */
+static void apply_mute(int32_t *engine_bus, size_t n) {
+    static int32_t gain_q8 = 256;
+    int32_t target = engine_muted ? 0 : 256;
+    if (gain_q8 == target && target == 256) {
+        return;
+    }
+
+    int32_t step = (int32_t)((256 * n * 1000) / ((uint32_t)ENGINE_MUTE_FADE_MS * AUDIO_SAMPLE_RATE)) + 1;
+    int32_t next = target > gain_q8 ? gain_q8 + step : gain_q8 - step;
+    if ((target > gain_q8 && next > target) || (target < gain_q8 && next < target)) {
+        next = target;
+    }
+
+    // Ramp across the block so the gain never steps audibly
+    int32_t gain_q16 = gain_q8 << 8;
+    int32_t step_q16 = ((next - gain_q8) << 8) / (int32_t)n;
+    for (size_t i = 0; i < n; i++) {
+        engine_bus[i] = (int32_t)(((int64_t)engine_bus[i] * gain_q16) >> 16);
+        gain_q16 += step_q16;
+    }
+    gain_q8 = next;
+}
+
+// ============================================================================
+// Parameter channel (control task -> mixer)
+// ============================================================================
+
+/**
+ * @brief Engine parameters as one coherent set
+ *
+ * Every packet carries the full state, so a dropped packet only loses an
+ * intermediate step; events are sequence numbers so they cannot be lost.
+ */
+typedef struct {
+    uint32_t timestamp_us;      // esp_timer time the packet was produced
+    uint16_t target_rpm;
+    int16_t idle_volume_pct;    // Throttle-dependent engine volume
+    int16_t rev_volume_pct;     // Throttle-dependent rev volume
+    bool jake_brake;
+    bool latency_probe;         // timestamp_us marks a large demand change
+    uint8_t shift_seq;          // Gear shift counter
+} engine_params_t;
+
+#define PARAM_RING_SIZE     16  // Power of two; ~160ms of 100Hz control updates
+
+// Single-producer (engine_sound_update) / single-consumer (mixer) ring
+static engine_params_t param_ring[PARAM_RING_SIZE];
+static uint32_t param_head = 0;         // Written by the producer only
+static uint32_t param_tail = 0;         // Written by the consumer only
+static uint32_t param_drops = 0;        // Packets dropped on a full ring
+static bool latency_probe_pending = false;  // Producer: probe not yet published
+
+// Parameters applied to the current / previous block (mixer task only)
+static engine_params_t params = {
+    .target_rpm = IDLE_RPM,
+    .idle_volume_pct = ENGINE_IDLE_VOLUME_PCT,
+    .rev_volume_pct = REV_IDLE_VOLUME_PCT,
+};
+static uint8_t applied_shift_seq = 0;
+
+/**
+ * @brief Publish a parameter packet (producer side, never blocks)
+ * @return false if the ring was full and the packet was dropped
  */
-static inline bool should_trigger_knock(uint16_t rpm) {
-    if (rpm < config.knock_start_point) {
+static bool param_push(const engine_params_t *packet) {
+    uint32_t head = param_head;
+    uint32_t tail = __atomic_load_n(&param_tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= PARAM_RING_SIZE) {
+        // Only log occasionally (mixer stalled or not running)
+        if (++param_drops % 100 == 1) {
+            ESP_LOGW(TAG, "Parameter ring full (dropped=%lu)", param_drops);
+        }
         return false;
     }
 
-    // Calculate knock interval in samples
-    uint32_t idle_idx = idle_sample_pos >> 16;
-    uint32_t knock_interval = current_profile->idle.sample_count / config.knock_interval;
+    param_ring[head & (PARAM_RING_SIZE - 1)] = *packet;
+    __atomic_store_n(&param_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
 
-    // Check if we've crossed a knock boundary
-    uint32_t current_knock_num = idle_idx / knock_interval;
-    uint32_t last_knock_num = last_knock_pos / knock_interval;
+/**
+ * @brief Take the oldest parameter packet (consumer side)
+ * @return false if the ring is empty
+ */
+static bool param_pop(engine_params_t *packet) {
+    uint32_t tail = param_tail;
+    uint32_t head = __atomic_load_n(&param_head, __ATOMIC_ACQUIRE);
 
-    if (current_knock_num != last_knock_num) {
-        last_knock_pos = idle_idx;
-        knock_counter++;
-        return true;
+    if (tail == head) {
+        return false;
     }
 
-    return false;
+    *packet = param_ring[tail & (PARAM_RING_SIZE - 1)];
+    __atomic_store_n(&param_tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Apply everything published since the last block (block boundary)
+ *
+ * The newest packet becomes the block's target; the layer gains ramp to
+ * it from where the previous block ended.
+ */
+static void params_consume(void) {
+    engine_params_t packet;
+
+    while (param_pop(&packet)) {
+        if (packet.latency_probe && latency_taken_us == 0) {
+            latency_taken_us = packet.timestamp_us | 1;  // Never 0
+        }
+        params = packet;
+    }
+
+    // Gear shift effect (brief power cut)
+    if (params.shift_seq != applied_shift_seq) {
+        applied_shift_seq = params.shift_seq;
+        gear_shift_start_time = esp_timer_get_time() / 1000;
+        gear_shift_attenuation = 100;  // Start at max attenuation
+    }
+}
+
+/**
+ * @brief Publish the control task's current demand (producer side)
+ * @param latency_probe Mark this packet for the latency probe
+ * @return false if the packet was dropped
+ */
+static bool publish_params(bool latency_probe) {
+    engine_params_t packet = {
+        .timestamp_us = (uint32_t)esp_timer_get_time(),
+        .target_rpm = target_rpm,
+        .idle_volume_pct = throttle_dependent_volume,
+        .rev_volume_pct = throttle_dependent_rev_volume,
+        .jake_brake = jake_brake_active,
+        .latency_probe = latency_probe,
+        .shift_seq = gear_shift_seq,
+    };
+    return param_push(&packet);
 }
 
 /**
  * @brief Update RPM with acceleration/deceleration smoothing
+ * @param frames Audio frames elapsed since the last update
+ */
+static void update_rpm(size_t frames) {
+    // Rates are per AUDIO_RPM_STEP_FRAMES; the remainder carries to the next
+    // block so the response is the same for any block size
+    static uint32_t rpm_residue = 0;
+    int32_t diff = (int32_t)params.target_rpm - (int32_t)current_rpm;
+
+    if (diff == 0) {
+        rpm_residue = 0;
+    } else {
+        int32_t distance = abs(diff);
+        int32_t rate = distance / 10;
+        int32_t min_rate = (diff > 0) ? config.acceleration : config.deceleration;
+        if (rate < min_rate) rate = min_rate;
+
+        rpm_residue += rate * frames;
+        int32_t step = rpm_residue / AUDIO_RPM_STEP_FRAMES;
+        rpm_residue %= AUDIO_RPM_STEP_FRAMES;
+        if (step > distance) step = distance;
+
+        // Accelerating / decelerating towards target
+        current_rpm = (diff > 0) ? current_rpm + step : current_rpm - step;
+    }
+
+    // Clamp RPM
+    if (current_rpm < IDLE_RPM) current_rpm = IDLE_RPM;
+    uint16_t max = (IDLE_RPM * config.max_rpm_percentage) / 100;
+    if (current_rpm > max) current_rpm = max;
+}
+
+// ============================================================================
+// BLOCK MIXER KERNELS
+// Each layer is rendered across the whole buffer into a 32-bit mono
+// accumulator, then the block is saturated and written out once. Loop and
+// end-of-clip checks are resolved once per stretch instead of per sample,
+// so the inner loops are just gather, multiply and add.
+//
+// Gains are linear ramps set up once per block from the layer's gain at the
+// end of the last block to its gain at the end of this one, so volume
+// changes never step between blocks. A steady gain (step 0) takes the plain
+// multiply loop.
+// ============================================================================
+
+// Ramp gains are Q12: an int8 sample times the loudest layer gain stays well
+// inside 32 bits, and the step resolves a change of 1 across 4096 samples
+#define GAIN_FRAC_BITS  12
+
+typedef struct {
+    int32_t gain;       // Gain at the next output sample (Q12)
+    int32_t step;       // Added per output sample (Q12)
+} gain_ramp_t;
+
+static uint16_t knock_offsets[AUDIO_BLOCK_FRAMES];      // Firing offsets in the current span
+
+/**
+ * @brief A gain that stays at vol
+ */
+static inline gain_ramp_t gain_const(int32_t vol) {
+    return (gain_ramp_t){ .gain = vol << GAIN_FRAC_BITS, .step = 0 };
+}
+
+/**
+ * @brief A gain moving from `from` to `to` over n samples
+ *
+ * The step truncates toward zero, so the ramp never overshoots `to`.
+ */
+static inline gain_ramp_t gain_ramp(int32_t from, int32_t to, size_t n) {
+    return (gain_ramp_t){
+        .gain = from << GAIN_FRAC_BITS,
+        .step = n ? ((to - from) << GAIN_FRAC_BITS) / (int32_t)n : 0,
+    };
+}
+
+/**
+ * @brief Move a ramp on by n samples without rendering them
+ */
+static inline void gain_skip(gain_ramp_t *g, size_t n) {
+    g->gain += g->step * (int32_t)n;
+}
+
+/**
+ * @brief Accumulate a stretch of resampled 8-bit clip with no loop or end inside
+ * @param pos Playback position (16.16), updated
+ * @param g Gain, moved on by run samples
+ */
+static inline void mix_run(int32_t *restrict out, size_t run, const int8_t *restrict samples,
+                           uint32_t *pos, uint32_t inc, gain_ramp_t *g) {
+    uint32_t p = *pos;
+    if (g->step == 0) {
+        const int32_t vol = g->gain >> GAIN_FRAC_BITS;
+        for (size_t k = 0; k < run; k++) {
+            out[k] += samples[p >> 16] * vol;
+            p += inc;
+        }
+    } else {
+        int32_t gain = g->gain;
+        const int32_t step = g->step;
+        for (size_t k = 0; k < run; k++) {
+            out[k] += (samples[p >> 16] * gain) >> GAIN_FRAC_BITS;
+            gain += step;
+            p += inc;
+        }
+        g->gain = gain;
+    }
+    *pos = p;
+}
+
+/**
+ * @brief Accumulate a looping 8-bit clip resampled by a 16.16 increment
+ *
+ * @param acc Accumulator (n samples)
+ * @param n Number of output samples
+ * @param samples Clip data
+ * @param loop_begin First sample of the loop region
+ * @param loop_end One past the last sample of the loop region
+ * @param pos Playback position (16.16), updated
+ * @param inc Playback increment (16.16)
+ * @param gain Gain (sample * gain lands in the 16-bit output range)
+ */
+static void mix_loop_layer(int32_t *restrict acc, size_t n, const int8_t *restrict samples,
+                           uint32_t loop_begin, uint32_t loop_end, uint32_t *pos,
+                           uint32_t inc, gain_ramp_t gain) {
+    const uint32_t end_fixed = loop_end << 16;
+    uint32_t p = *pos;
+    size_t i = 0;
+
+    if (p >= end_fixed) {
+        p = loop_begin << 16;
+    }
+    while (i < n) {
+        size_t run = resample_steps_to(p, end_fixed, inc, n - i);
+        mix_run(acc + i, run, samples, &p, inc, &gain);
+        i += run;
+        if (p >= end_fixed) {
+            p = loop_begin << 16;
+        }
+    }
+    *pos = p;
+}
+
+/**
+ * @brief Accumulate a one-shot 8-bit clip with a linear attack ramp
+ *
+ * The attack region is rendered separately so the rest of the clip runs
+ * without the per-sample envelope.
+ * @param attack_samples Attack length in source samples (0 = none)
+ * @return true while the clip has samples left
+ */
+static bool mix_oneshot_layer(int32_t *restrict acc, size_t n, const int8_t *restrict samples,
+                              uint32_t count, uint32_t *pos, uint32_t inc, gain_ramp_t gain,
+                              uint16_t attack_samples) {
+    const uint32_t end_fixed = count << 16;
+    const uint32_t attack_fixed = (uint32_t)attack_samples << 16;
+    uint32_t p = *pos;
+    size_t i = 0;
+
+    if (p < attack_fixed && p < end_fixed) {
+        size_t run = resample_steps_to(p, attack_fixed < end_fixed ? attack_fixed : end_fixed, inc, n);
+        for (size_t k = 0; k < run; k++) {
+            uint32_t idx = p >> 16;
+            int32_t envelope = calc_attack_envelope(idx, attack_samples);
+            acc[k] += (samples[idx] * (gain.gain >> GAIN_FRAC_BITS) * envelope) >> 8;
+            gain.gain += gain.step;
+            p += inc;
+        }
+        i = run;
+    }
+    if (i < n && p < end_fixed) {
+        size_t run = resample_steps_to(p, end_fixed, inc, n - i);
+        mix_run(acc + i, run, samples, &p, inc, &gain);
+    }
+    *pos = p;
+    return p < end_fixed;
+}
+
+// IMA-ADPCM decode window: aligned groups of blocks, decoded on demand.
+// Wider than ATTACK_MAX_SAMPLES so attack envelopes never straddle windows.
+#define ADPCM_WINDOW_SAMPLES    (4 * ADPCM_BLOCK_SAMPLES)
+static int8_t adpcm_window[ADPCM_WINDOW_SAMPLES];
+
+/**
+ * @brief Accumulate an IMA-ADPCM clip through the decode window
+ *
+ * Each run decodes just the blocks it will read into adpcm_window, then
+ * hands the window to the PCM one-shot kernel with a rebased position.
+ * Runs stop at window and clip ends, so the kernel never wraps; loops are
+ * handled here.
+ * @param loop true to restart at loop_begin when reaching count
+ * @return true while the clip has samples left (always true when looping)
+ */
+static bool mix_adpcm_layer(int32_t *restrict acc, size_t n, const uint8_t *data,
+                            uint32_t count, bool loop, uint32_t loop_begin,
+                            uint32_t *pos, uint32_t inc, gain_ramp_t gain, uint16_t attack_samples) {
+    const uint32_t end_fixed = count << 16;
+    uint32_t p = *pos;
+    size_t i = 0;
+
+    while (i < n) {
+        if (p >= end_fixed) {
+            if (!loop) break;
+            p = loop_begin << 16;
+        }
+
+        uint32_t win_start = (p >> 16) & ~(ADPCM_WINDOW_SAMPLES - 1);
+        uint32_t win_end = win_start + ADPCM_WINDOW_SAMPLES;
+        if (win_end > count) win_end = count;
+
+        // Decode the blocks between the run's first and last read
+        size_t run = resample_steps_to(p, win_end << 16, inc, n - i);
+        uint32_t first = (p >> 16) & ~(ADPCM_BLOCK_SAMPLES - 1);
+        uint32_t last = (p + inc * (uint32_t)(run - 1)) >> 16;
+        adpcm_decode(data, first, last + 1 - first, adpcm_window + (first - win_start));
+
+        uint32_t rel = p - (win_start << 16);
+        mix_oneshot_layer(acc + i, run, adpcm_window, win_end - win_start, &rel, inc, gain,
+                          win_start == 0 ? attack_samples : 0);
+        gain_skip(&gain, run);
+        p = rel + (win_start << 16);
+        i += run;
+    }
+    if (loop && p >= end_fixed) {
+        p = loop_begin << 16;
+    }
+    *pos = p;
+    return loop || p < end_fixed;
+}
+
+/**
+ * @brief Accumulate a looping profile clip in either format
+ */
+static void mix_clip_loop(int32_t *restrict acc, size_t n, const sound_sample_t *clip,
+                          uint32_t *pos, uint32_t inc, gain_ramp_t gain) {
+    if (clip->format == SOUND_FORMAT_IMA_ADPCM) {
+        mix_adpcm_layer(acc, n, (const uint8_t *)clip->samples, clip->sample_count, true, 0,
+                        pos, inc, gain, 0);
+    } else {
+        mix_loop_layer(acc, n, clip->samples, 0, clip->sample_count, pos, inc, gain);
+    }
+}
+
+// ============================================================================
+// FIRING SCHEDULER
+// The idle loop is one engine cycle: cylinders fire as the idle read
+// position enters each of firing_cylinders() equal slices of it. Firings
+// are found by stepping from slice boundary to slice boundary at the
+// current increment, so the cost is per firing, not per sample.
+// ============================================================================
+
+// config.v8_mode on a profile without its own firing table: Caterpillar 3408
+// order, with cylinders 3 and 8 (the 4th and 8th firings) sharing a manifold
+static const sound_firing_def_t v8_firing = {
+    .order = { 1, 2, 7, 3, 4, 5, 6, 8 },
+    .accent = { 100, 100, 200, 100, 100, 100, 100, 200 },
+};
+
+/**
+ * @brief Firing slots per engine cycle
+ */
+static inline uint8_t firing_cylinders(void) {
+    uint8_t cylinders = config.knock_interval;
+    if (cylinders == 0 || cylinders > SOUND_MAX_CYLINDERS) {
+        cylinders = SOUND_MAX_CYLINDERS;
+    }
+    return cylinders;
+}
+
+/**
+ * @brief Knock accent of a firing slot (percent of the base knock)
+ */
+static uint8_t firing_accent(uint8_t slot) {
+    const sound_firing_def_t *firing = lay->profile->firing;
+    if (firing == NULL) {
+        if (!config.v8_mode) {
+            return 100;
+        }
+        firing = &v8_firing;
+    }
+    uint8_t cylinder = firing->order[slot];
+    return (cylinder >= 1 && cylinder <= SOUND_MAX_CYLINDERS) ? firing->accent[cylinder - 1] : 100;
+}
+
+/**
+ * @brief Find the firings in the next n samples of the idle loop
+ *
+ * Follows the idle read position exactly as mix_loop_layer() will advance
+ * it (including the wrap back to 0) without reading any samples.
+ * @param inc Idle playback increment (16.16)
+ * @param enabled Whether RPM is above the knock start point; when not,
+ *                the slice is tracked so knock resumes on the next firing
+ * @param offsets Receives the output offsets of the firings
+ * @return Number of firings
+ */
+static size_t firing_schedule(size_t n, uint32_t inc, bool enabled, uint16_t *offsets) {
+    const uint32_t count = lay->profile->idle.sample_count;
+    const uint32_t end_fixed = count << 16;
+    const uint8_t cylinders = firing_cylinders();
+    const uint32_t interval = count / cylinders;
+    uint32_t p = lay->idle_pos;
+    size_t firings = 0;
+    size_t i = 0;
+
+    if (interval == 0) {
+        return 0;
+    }
+    if (!enabled) {
+        uint32_t slice = ((p >= end_fixed) ? 0 : p >> 16) / interval;
+        lay->fire_slice = (uint8_t)(slice < cylinders ? slice : cylinders - 1);
+        return 0;
+    }
+    while (i < n) {
+        if (p >= end_fixed) {
+            p = 0;
+        }
+        // The remainder of an uneven split belongs to the last slice
+        uint32_t slice = (p >> 16) / interval;
+        if (slice >= cylinders) {
+            slice = cylinders - 1;
+        }
+        if (slice != lay->fire_slice) {
+            lay->fire_slice = (uint8_t)slice;
+            offsets[firings++] = (uint16_t)i;
+        }
+
+        uint32_t limit = (slice + 1 < cylinders) ? ((slice + 1) * interval) << 16 : end_fixed;
+        size_t run = resample_steps_to(p, limit, inc, n - i);
+        p += inc * (uint32_t)run;
+        i += run;
+    }
+    return firings;
+}
+
+/**
+ * @brief Accumulate the knock overlay, restarting it at each firing
+ *
+ * Each knock keeps the accent of the cylinder that fired it.
+ */
+static void mix_knock_layer(int32_t *restrict acc, size_t n, gain_ramp_t knock_gain,
+                            const uint16_t *offsets, size_t firings) {
+    size_t start = 0;
+
+    for (size_t t = 0; t <= firings; t++) {
+        size_t end = (t < firings) ? offsets[t] : n;
+        if (end > start) {
+            // Base knock is a quarter of knock_volume, scaled by the accent
+            int32_t accent = lay->knock_accent;
+            gain_ramp_t gain = { knock_gain.gain * accent / 400, knock_gain.step * accent / 400 };
+            mix_oneshot_layer(acc + start, end - start, lay->profile->knock.samples,
+                              lay->profile->knock.sample_count, &lay->knock_pos,
+                              clip_increment(0x10000, lay->profile->knock.sample_rate), gain, 0);
+            gain_skip(&knock_gain, end - start);
+        }
+        if (t < firings) {
+            lay->fire_slot = (uint8_t)((lay->fire_slot + 1) % firing_cylinders());
+            lay->knock_accent = firing_accent(lay->fire_slot);
+            lay->knock_pos = 0;  // Start new knock
+            start = end;
+        }
+    }
+}
+
+/**
+ * @brief Start a grain for the next cylinder in the firing order
+ */
+static void synth_fire(const sound_synth_def_t *synth, uint32_t grain_inc, int32_t vol) {
+    uint8_t cylinders = firing_cylinders();
+    uint8_t slot = lay->synth_cylinder % cylinders;
+    lay->synth_cylinder = (slot + 1) % cylinders;
+
+    // Half the knock layer's accent on top of the grain's own firing gain
+    int32_t gain = synth->firing_gain[slot] ? synth->firing_gain[slot] : 200;
+    gain = gain * (100 + firing_accent(slot)) / 200;
+
+    // Reuse a free voice, else steal the one furthest into its grain
+    synth_grain_t *g = &lay->grains[0];
+    for (int i = 0; i < SYNTH_GRAIN_VOICES; i++) {
+        if (!lay->grains[i].active) {
+            g = &lay->grains[i];
+            break;
+        }
+        if (lay->grains[i].pos > g->pos) {
+            g = &lay->grains[i];
+        }
+    }
+    g->grain = synth->grains + (uint32_t)(slot % synth->grain_count) * synth->grain_length;
+    g->pos = 0;
+    g->inc = grain_inc;
+    g->vol = (vol * gain) >> 8;
+    g->active = true;
+}
+
+/**
+ * @brief Accumulate the granular engine
+ *
+ * One grain starts per cylinder firing; the firing rate and grain pitch
+ * follow the engine speed continuously, so there is no loop to stretch.
+ * Output between firings is plain grain playback through the one-shot
+ * kernel.
+ * Each grain keeps the gain it was fired with.
+ * @param speed_q8 Engine speed relative to idle (256 = idle RPM)
+ * @param gain Gain
+ */
+static void mix_synth_layer(int32_t *restrict acc, size_t n, uint32_t speed_q8, gain_ramp_t gain) {
+    const sound_synth_def_t *synth = lay->profile->synth;
+
+    // Firing phase step per output sample (2^32 = one firing interval)
+    uint32_t phase_inc = (uint32_t)(((uint64_t)synth->idle_firing_hz_x10 * speed_q8 << 32) /
+                                    (10ULL * 256 * AUDIO_SAMPLE_RATE));
+    int32_t over_idle = (int32_t)speed_q8 - 256;
+    if (over_idle < 0) over_idle = 0;
+    uint32_t grain_inc = resample_increment(synth->grain_rate, AUDIO_SAMPLE_RATE);
+    grain_inc += (uint32_t)(((uint64_t)grain_inc * over_idle * synth->grain_pitch_pct) / (256 * 100));
+
+    size_t i = 0;
+    while (i < n) {
+        // Run to the next firing (phase wrap) or the end of the block
+        size_t run = n - i;
+        if (phase_inc > 0) {
+            uint64_t to_wrap = (1ULL << 32) - lay->synth_phase;
+            uint64_t steps = (to_wrap + phase_inc - 1) / phase_inc;
+            if (steps < run) run = (size_t)steps;
+        }
+
+        for (int v = 0; v < SYNTH_GRAIN_VOICES; v++) {
+            synth_grain_t *g = &lay->grains[v];
+            if (g->active && !mix_oneshot_layer(acc + i, run, g->grain, synth->grain_length,
+                                                &g->pos, g->inc, gain_const(g->vol), 0)) {
+                g->active = false;
+            }
+        }
+
+        uint32_t before = lay->synth_phase;
+        lay->synth_phase += phase_inc * (uint32_t)run;
+        gain_skip(&gain, run);
+        i += run;
+        if (phase_inc > 0 && (uint64_t)before + (uint64_t)phase_inc * run >= (1ULL << 32)) {
+            // Fired: jitter the next interval by up to jitter_pct
+            lay->synth_phase = (uint32_t)(((uint64_t)(esp_random() % 101) * synth->jitter_pct << 32) /
+                                     (100 * 100));
+            synth_fire(synth, grain_inc, gain.gain >> GAIN_FRAC_BITS);
+        }
+    }
+}
+
+/**
+ * @brief Apply random variation to an effect volume percentage
+ * @return Volume percentage clamped to 10-100
+ */
+static inline int32_t varied_effect_volume(int32_t volume, int8_t variation) {
+    int32_t vol_adjusted = volume + variation;
+    if (vol_adjusted < 10) vol_adjusted = 10;  // Minimum 10%
+    if (vol_adjusted > 100) vol_adjusted = 100;
+    return vol_adjusted;
+}
+
+/**
+ * @brief Accumulate the active voices selected by mask
+ *
+ * Voice state is copied out under voice_lock, mixed without it, and
+ * written back only for voices that were not restarted in the meantime.
+ * Cost is proportional to the number of active voices.
+ */
+static void mix_voices(int32_t *restrict acc, size_t n, uint32_t mask) {
+    voice_t local[VOICE_COUNT];
+    uint32_t active, finished = 0;
+
+    taskENTER_CRITICAL(&voice_lock);
+    active = voice_active_mask & mask;
+    for (uint32_t m = active; m != 0; m &= m - 1) {
+        int id = __builtin_ctz(m);
+        local[id] = voices[id];
+    }
+    taskEXIT_CRITICAL(&voice_lock);
+
+    for (uint32_t m = active; m != 0; m &= m - 1) {
+        int id = __builtin_ctz(m);
+        const voice_desc_t *desc = &voice_descs[id];
+        voice_t *v = &local[id];
+
+        if (!*desc->enabled) {
+            finished |= VOICE_BIT(id);
+            continue;
+        }
+
+        int32_t vol = *desc->volume;
+        if (desc->varied) {
+            vol = varied_effect_volume(vol, v->volume_variation);
+        }
+        if (desc->rpm_scaled) {
+            // Louder at higher RPM (50-100%)
+            vol = (vol * (50 + (current_rpm * 50 / MAX_RPM))) / 100;
+        }
+        gain_ramp_t gain = gain_const((vol * get_master_volume()) / 100);
+
+        if (v->format == SOUND_FORMAT_IMA_ADPCM) {
+            if (!mix_adpcm_layer(acc, n, (const uint8_t *)v->samples, v->end, v->loop,
+                                 v->loop_begin, &v->pos, v->increment, gain, v->attack_samples)) {
+                finished |= VOICE_BIT(id);
+            }
+        } else if (v->loop) {
+            mix_loop_layer(acc, n, v->samples, v->loop_begin, v->end, &v->pos, v->increment, gain);
+        } else if (!mix_oneshot_layer(acc, n, v->samples, v->end, &v->pos, v->increment, gain,
+                                      v->attack_samples)) {
+            finished |= VOICE_BIT(id);
+        }
+    }
+
+    taskENTER_CRITICAL(&voice_lock);
+    for (uint32_t m = active; m != 0; m &= m - 1) {
+        int id = __builtin_ctz(m);
+        if (voices[id].serial == local[id].serial) {
+            voices[id].pos = local[id].pos;
+            if (finished & VOICE_BIT(id)) {
+                voice_active_mask &= ~VOICE_BIT(id);
+            }
+        }
+    }
+    taskEXIT_CRITICAL(&voice_lock);
+}
+
+/**
+ * @brief Mix the selected effect voices, timing effects and horn apart
+ *
+ * Each stage is only recorded for blocks where it had voices to mix, so
+ * the profiler shows what an effect costs while it plays.
+ */
+static void mix_effects_timed(int32_t *restrict acc, size_t n, uint32_t mask) {
+    const uint32_t horn = VOICE_BIT(VOICE_HORN);
+    uint32_t active = voice_active_mask & mask;
+
+    if (active & ~horn) {
+        uint32_t start = perf_cycles();
+        mix_voices(acc, n, mask & ~horn);
+        perf_stage_end(PERF_STAGE_AUDIO_EFFECTS, start);
+    }
+    if (active & horn) {
+        uint32_t start = perf_cycles();
+        mix_voices(acc, n, horn);
+        perf_stage_end(PERF_STAGE_AUDIO_HORN, start);
+    }
+}
+
+/**
+ * @brief Engine layer gains at one instant
+ */
+typedef struct {
+    int32_t idle;
+    int32_t rev;
+    int32_t knock;
+    int32_t jake;
+} engine_gains_t;
+
+/**
+ * @brief Engine layer ramps across a block
  */
-static void update_rpm(void) {
-    if (current_rpm < target_rpm) {
-        // Accelerating
-        int16_t delta = (target_rpm - current_rpm) / 10;
-        if (delta < config.acceleration) delta = config.acceleration;
-        current_rpm += delta;
-        if (current_rpm > target_rpm) current_rpm = target_rpm;
-    } else if (current_rpm > target_rpm) {
-        // Decelerating
-        int16_t delta = (current_rpm - target_rpm) / 10;
-        if (delta < config.deceleration) delta = config.deceleration;
-        current_rpm -= delta;
-        if (current_rpm < target_rpm) current_rpm = target_rpm;
-    }
+typedef struct {
+    gain_ramp_t idle;
+    gain_ramp_t rev;
+    gain_ramp_t knock;
+    gain_ramp_t jake;
+} engine_ramps_t;
 
-    // Clamp RPM
-    if (current_rpm < IDLE_RPM) current_rpm = IDLE_RPM;
-    uint16_t max = (IDLE_RPM * config.max_rpm_percentage) / 100;
-    if (current_rpm > max) current_rpm = max;
-}
+static engine_gains_t block_gains;      // Gains at the end of the previous block (mixer task)
 
 /**
- * @brief Mix engine sound samples
+ * @brief Engine layer gains for an RPM and throttle-dependent volumes
  *
  * Uses crossfade approach like reference project:
  * - Idle proportion decreases from 90% to 0% as RPM increases
  * - Rev proportion increases from 0% to 100% as RPM increases
  * - Total proportion is always ~100% (crossfade, not pure layering)
  * - Volume is throttle-dependent (louder at higher throttle)
+ *
+ * @param rpm Engine RPM
+ * @param idle_pct Throttle-dependent engine volume
+ * @param rev_pct Throttle-dependent rev volume
  */
-static void mix_engine_samples(int16_t *buffer, size_t num_samples) {
-    uint32_t increment = calc_sample_increment(current_rpm);
-
+static engine_gains_t engine_gains(uint16_t rpm, int32_t idle_pct, int32_t rev_pct) {
     // Get crossfade proportions (like reference: a1Multi and 100-a1Multi)
-    uint8_t idle_prop = calc_idle_proportion(current_rpm);  // 0-90%
+    uint8_t idle_prop = calc_idle_proportion(rpm);  // 0-90%
     uint8_t rev_prop = 100 - idle_prop;                     // Inverse for crossfade
 
     // Apply throttle-dependent volume (key to natural sound!)
     // This makes the engine louder when accelerating, quieter when coasting
-    int32_t idle_vol = (config.idle_volume * get_master_volume() * throttle_dependent_volume) / 10000;
-    int32_t rev_vol = (config.rev_volume * get_master_volume() * throttle_dependent_rev_volume) / 10000;
-    int32_t knock_vol = (config.knock_volume * get_master_volume() * throttle_dependent_volume) / 10000;
-    int32_t jake_vol = jake_brake_active ?
-                       (180 * get_master_volume()) / 100 : 0;  // Jake brake volume
+    engine_gains_t g = {
+        .idle = (config.idle_volume * get_master_volume() * idle_pct) / 10000,
+        .rev = (config.rev_volume * get_master_volume() * rev_pct) / 10000,
+        .knock = (config.knock_volume * get_master_volume() * idle_pct) / 10000,
+        .jake = (params.jake_brake && rpm > 150) ?
+                (180 * get_master_volume()) / 100 : 0,  // Jake brake volume
+    };
 
     // Apply crossfade proportions
-    idle_vol = (idle_vol * idle_prop) / 100;
-    rev_vol = (rev_vol * rev_prop) / 100;
+    g.idle = (g.idle * idle_prop) / 100;
+    g.rev = (g.rev * rev_prop) / 100;
 
     // Apply gear shift attenuation (brief power cut during shift)
     if (gear_shift_attenuation > 0) {
         // Reduce volume during shift (up to 50% reduction at peak)
         int32_t shift_factor = 100 - (gear_shift_attenuation / 2);
-        idle_vol = (idle_vol * shift_factor) / 100;
-        rev_vol = (rev_vol * shift_factor) / 100;
+        g.idle = (g.idle * shift_factor) / 100;
+        g.rev = (g.rev * shift_factor) / 100;
     }
+    return g;
+}
 
-    for (size_t i = 0; i < num_samples; i++) {
-        int32_t mix = 0;
-
-        // Get idle sample - LAYER (add) not crossfade
-        int16_t idle_sample = get_idle_sample(idle_sample_pos);
-        mix += ((int32_t)idle_sample * idle_vol) >> 8;
-
-        // Get rev sample - LAYER on top of idle
-        int16_t rev_sample = get_rev_sample(rev_sample_pos);
-        mix += ((int32_t)rev_sample * rev_vol) >> 8;
-
-        // Advance sample positions
-        idle_sample_pos += increment;
-        if ((idle_sample_pos >> 16) >= current_profile->idle.sample_count) {
-            idle_sample_pos = 0;
-            last_knock_pos = 0;  // Reset knock tracking on loop
-        }
-
-        rev_sample_pos += increment;
-        if ((rev_sample_pos >> 16) >= current_profile->rev.sample_count) {
-            rev_sample_pos = 0;
-        }
-
-        // Diesel knock overlay - check once per sample
-        if (should_trigger_knock(current_rpm)) {
-            knock_sample_pos = 0;  // Start new knock
-        }
-
-        // Play knock sample if active
-        if ((knock_sample_pos >> 16) < current_profile->knock.sample_count) {
-            int16_t knock_sample = get_knock_sample(knock_sample_pos);
-
-            // V8 mode: pulses 4 and 8 are louder (cylinders sharing manifold)
-            int32_t knock_volume = knock_vol / 4;  // Base knock quieter
-            if (config.v8_mode) {
-                uint8_t pulse = knock_counter % 8;
-                if (pulse == 3 || pulse == 7) {
-                    // Louder knock for paired cylinders
-                    knock_volume = knock_vol / 2;
-                }
-            }
-
-            mix += ((int32_t)knock_sample * knock_volume) >> 8;
-            knock_sample_pos += 0x10000;  // Normal speed for knock
-        }
-
-        // Jake brake sound when decelerating
-        if (jake_brake_active && current_rpm > 150 && current_profile->has_jake_brake) {
-            int16_t jake_sample = get_jake_sample(jake_sample_pos);
-            mix += ((int32_t)jake_sample * jake_vol) >> 8;
-            jake_sample_pos += increment;
-            if ((jake_sample_pos >> 16) >= current_profile->jake_brake.sample_count) {
-                jake_sample_pos = 0;
-            }
-        }
-
-        // =====================================================================
-        // SOUND EFFECTS MIXING
-        // =====================================================================
-
-        // Air brake release sound (one-shot, triggered after stop)
-        if (air_brake_trigger && config.air_brake_enabled) {
-            uint32_t idx = air_brake_sample_pos >> 16;
-            if (idx < effect_airBrakeSampleCount) {
-                int16_t sample = ((int16_t)effect_airBrakeSamples[idx]) << 8;
-                // Apply volume with random variation
-                int32_t vol_adjusted = config.air_brake_volume + air_brake_volume_variation;
-                if (vol_adjusted < 10) vol_adjusted = 10;  // Minimum 10%
-                if (vol_adjusted > 100) vol_adjusted = 100;
-                int32_t vol = (vol_adjusted * get_master_volume()) / 100;
-                // Apply attack envelope
-                uint16_t envelope = calc_attack_envelope(idx, air_brake_attack_samples);
-                int32_t sample_out = (((int32_t)sample * vol) >> 8) * envelope >> 8;
-                mix += sample_out;
-                air_brake_sample_pos += air_brake_pitch_increment;  // Variable pitch
-            } else {
-                air_brake_trigger = false;
-                air_brake_sample_pos = 0;
-            }
-        }
-
-        // Reversing beep sound (looping while in reverse)
-        if (reverse_beep_playing && config.reverse_beep_enabled) {
-            uint32_t idx = reverse_beep_sample_pos >> 16;
-            if (idx < effect_reverseBeepSampleCount) {
-                int16_t sample = ((int16_t)effect_reverseBeepSamples[idx]) << 8;
-                int32_t vol = (config.reverse_beep_volume * get_master_volume()) / 100;
-                mix += ((int32_t)sample * vol) >> 8;
-                reverse_beep_sample_pos += 0x10000;  // Normal rate
-            } else {
-                reverse_beep_sample_pos = 0;  // Loop
-            }
-        }
-
-        // Gear shift clunk sound (one-shot on gear change)
-        // Use profile-specific sound if available, otherwise generic fallback
-        if (gear_shift_sound_trigger && config.gear_shift_enabled) {
-            const signed char *shift_samples;
-            uint32_t shift_count;
-
-            // Profile-based effect lookup with generic fallback
-            if (current_profile->shifting.samples != NULL) {
-                shift_samples = (const signed char*)current_profile->shifting.samples;
-                shift_count = current_profile->shifting.sample_count;
-            } else {
-                shift_samples = effect_gearShiftSamples;
-                shift_count = effect_gearShiftSampleCount;
-            }
-
-            uint32_t idx = gear_shift_sound_sample_pos >> 16;
-            if (idx < shift_count) {
-                int16_t sample = ((int16_t)shift_samples[idx]) << 8;
-                // Apply volume with random variation
-                int32_t vol_adjusted = config.gear_shift_volume + gear_shift_volume_variation;
-                if (vol_adjusted < 10) vol_adjusted = 10;  // Minimum 10%
-                if (vol_adjusted > 100) vol_adjusted = 100;
-                int32_t vol = (vol_adjusted * get_master_volume()) / 100;
-                // Apply attack envelope
-                uint16_t envelope = calc_attack_envelope(idx, gear_shift_attack_samples);
-                int32_t sample_out = (((int32_t)sample * vol) >> 8) * envelope >> 8;
-                mix += sample_out;
-                gear_shift_sound_sample_pos += gear_shift_pitch_increment;  // Variable pitch
-            } else {
-                gear_shift_sound_trigger = false;
-                gear_shift_sound_sample_pos = 0;
-            }
-        }
+/**
+ * @brief Ramps from one set of gains to another over n samples
+ */
+static engine_ramps_t engine_ramps(const engine_gains_t *from, const engine_gains_t *to, size_t n) {
+    return (engine_ramps_t){
+        .idle = gain_ramp(from->idle, to->idle, n),
+        .rev = gain_ramp(from->rev, to->rev, n),
+        .knock = gain_ramp(from->knock, to->knock, n),
+        .jake = gain_ramp(from->jake, to->jake, n),
+    };
+}
 
-        // Wastegate/blowoff sound (one-shot after rapid throttle drop)
-        // Use profile-specific sound if available, otherwise generic fallback
-        if (wastegate_trigger && config.wastegate_enabled) {
-            const signed char *wg_samples;
-            uint32_t wg_count;
-
-            // Profile-based effect lookup with generic fallback
-            if (current_profile->wastegate.samples != NULL) {
-                wg_samples = (const signed char*)current_profile->wastegate.samples;
-                wg_count = current_profile->wastegate.sample_count;
-            } else {
-                wg_samples = effect_wastegateSamples;
-                wg_count = effect_wastegateSampleCount;
-            }
+/**
+ * @brief Mix engine sound samples at one pitch
+ *
+ * @param rpm Engine RPM for this span
+ * @param ramps Layer gains, moved on by num_samples
+ * @param acc Engine bus accumulator
+ * @param num_samples Samples to mix (at most AUDIO_BLOCK_FRAMES)
+ */
+static void mix_engine_samples(uint16_t rpm, engine_ramps_t *ramps, int32_t *acc, size_t num_samples) {
+    const sound_profile_def_t *prof = lay->profile;
+    uint32_t increment = calc_sample_increment(rpm);
+
+    // Granular profiles build the whole engine from firing grains
+    if (lay->profile->synth) {
+        gain_ramp_t sum = {
+            ramps->idle.gain + ramps->rev.gain, ramps->idle.step + ramps->rev.step
+        };
+        mix_synth_layer(acc, num_samples, ((uint32_t)rpm << 8) / IDLE_RPM, sum);
+    } else {
+        uint32_t idle_inc = clip_increment(increment, prof->idle.sample_rate);
 
-            uint32_t idx = wastegate_sample_pos >> 16;
-            if (idx < wg_count) {
-                int16_t sample = ((int16_t)wg_samples[idx]) << 8;
-                // RPM-dependent wastegate volume (louder at higher RPM) + random variation
-                int32_t rpm_vol = 50 + (current_rpm * 50 / MAX_RPM);  // 50-100%
-                int32_t vol_adjusted = config.wastegate_volume + wastegate_volume_variation;
-                if (vol_adjusted < 10) vol_adjusted = 10;  // Minimum 10%
-                if (vol_adjusted > 100) vol_adjusted = 100;
-                int32_t vol = (vol_adjusted * rpm_vol * get_master_volume()) / 10000;
-                // Apply attack envelope
-                uint16_t envelope = calc_attack_envelope(idx, wastegate_attack_samples);
-                int32_t sample_out = (((int32_t)sample * vol) >> 8) * envelope >> 8;
-                mix += sample_out;
-                wastegate_sample_pos += wastegate_pitch_increment;  // Variable pitch
-            } else {
-                wastegate_trigger = false;
-                wastegate_sample_pos = 0;
-            }
-        }
+        // Cylinder firings in this span, before the idle loop moves on
+        size_t firings = firing_schedule(num_samples, idle_inc, rpm >= config.knock_start_point,
+                                         knock_offsets);
 
-        // Mode switch sound (one-shot air shift sound for steering mode changes)
-        if (mode_switch_trigger && config.mode_switch_sound_enabled) {
-            uint32_t idx = mode_switch_sample_pos >> 16;
-            if (idx < modeSwitchSampleCount) {
-                int16_t sample = ((int16_t)modeSwitchSamples[idx]) << 8;
-                // Apply volume with random variation
-                int32_t vol_adjusted = config.mode_switch_volume + mode_switch_volume_variation;
-                if (vol_adjusted < 10) vol_adjusted = 10;  // Minimum 10%
-                if (vol_adjusted > 100) vol_adjusted = 100;
-                int32_t vol = (vol_adjusted * get_master_volume()) / 100;
-                // Apply attack envelope
-                uint16_t envelope = calc_attack_envelope(idx, mode_switch_attack_samples);
-                int32_t sample_out = (((int32_t)sample * vol) >> 8) * envelope >> 8;
-                mix += sample_out;
-                mode_switch_sample_pos += mode_switch_pitch_increment;  // Variable pitch
-            } else {
-                mode_switch_trigger = false;
-                mode_switch_sample_pos = 0;
-            }
-        }
+        // Idle and rev - LAYER (add) not crossfade
+        mix_loop_layer(acc, num_samples, prof->idle.samples, 0,
+                       prof->idle.sample_count, &lay->idle_pos, idle_inc, ramps->idle);
+        mix_clip_loop(acc, num_samples, &prof->rev, &lay->rev_pos,
+                      clip_increment(increment, prof->rev.sample_rate), ramps->rev);
 
-        // Horn sound (looping while button held)
-        if (horn_active && config.horn_enabled) {
-            const signed char *horn_samples;
-            uint32_t horn_count, horn_loop_begin, horn_loop_end;
-
-            // Select horn type
-            switch (config.horn_type) {
-                case HORN_TYPE_MANTGE:
-                    horn_samples = mantgeHornSamples;
-                    horn_count = mantgeHornSampleCount;
-                    horn_loop_begin = mantgeHornLoopBegin;
-                    horn_loop_end = mantgeHornLoopEnd;
-                    break;
-                case HORN_TYPE_CUCARACHA:
-                    horn_samples = cucarachaSamples;
-                    horn_count = cucarachaSampleCount;
-                    horn_loop_begin = cucarachaLoopBegin;
-                    horn_loop_end = cucarachaLoopEnd;
-                    break;
-                case HORN_TYPE_2TONE:
-                    horn_samples = horn2ToneSamples;
-                    horn_count = horn2ToneSampleCount;
-                    horn_loop_begin = horn2ToneLoopBegin;
-                    horn_loop_end = horn2ToneLoopEnd;
-                    break;
-                case HORN_TYPE_DIXIE:
-                    horn_samples = hornDixieSamples;
-                    horn_count = hornDixieSampleCount;
-                    horn_loop_begin = hornDixieLoopBegin;
-                    horn_loop_end = hornDixieLoopEnd;
-                    break;
-                case HORN_TYPE_PETERBILT:
-                    horn_samples = hornPeterbiltSamples;
-                    horn_count = hornPeterbiltSampleCount;
-                    horn_loop_begin = hornPeterbiltLoopBegin;
-                    horn_loop_end = hornPeterbiltLoopEnd;
-                    break;
-                case HORN_TYPE_OUTLAW:
-                    horn_samples = hornOutlawSamples;
-                    horn_count = hornOutlawSampleCount;
-                    horn_loop_begin = hornOutlawLoopBegin;
-                    horn_loop_end = hornOutlawLoopEnd;
-                    break;
-                default:  // HORN_TYPE_TRUCK
-                    horn_samples = truckHornSamples;
-                    horn_count = truckHornSampleCount;
-                    horn_loop_begin = truckHornLoopBegin;
-                    horn_loop_end = truckHornLoopEnd;
-                    break;
-            }
+        // Diesel knock overlay
+        mix_knock_layer(acc, num_samples, ramps->knock, knock_offsets, firings);
 
-            uint32_t idx = horn_sample_pos >> 16;
-            if (idx < horn_count) {
-                int16_t sample = ((int16_t)horn_samples[idx]) << 8;
-                int32_t vol = (config.horn_volume * get_master_volume()) / 100;
-                mix += ((int32_t)sample * vol) >> 8;
-                horn_sample_pos += 0x10000;  // Normal rate
-
-                // Loop within the loop region
-                uint32_t next_idx = horn_sample_pos >> 16;
-                if (next_idx >= horn_loop_end) {
-                    horn_sample_pos = horn_loop_begin << 16;
-                }
-            }
+        // Jake brake sound when decelerating (rendered while it fades out too)
+        if (prof->has_jake_brake && (ramps->jake.gain > 0 || ramps->jake.step > 0)) {
+            mix_clip_loop(acc, num_samples, &prof->jake_brake, &lay->jake_pos,
+                          clip_increment(increment, prof->jake_brake.sample_rate), ramps->jake);
         }
+    }
 
-        // Clamp to 16-bit range
-        if (mix > 32767) mix = 32767;
-        if (mix < -32768) mix = -32768;
+    gain_skip(&ramps->idle, num_samples);
+    gain_skip(&ramps->rev, num_samples);
+    gain_skip(&ramps->knock, num_samples);
+    gain_skip(&ramps->jake, num_samples);
+}
 
-        // Stereo output
-        buffer[i * 2] = (int16_t)mix;
-        buffer[i * 2 + 1] = (int16_t)mix;
+/**
+ * @brief Mix a running engine block into acc with the current layer set
+ *
+ * Layer gains ramp linearly from `from` to `to` across the block; pitch
+ * is stepped toward to_rpm every AUDIO_RAMP_FRAMES.
+ * @param from_rpm RPM at the end of the previous block
+ * @param to_rpm RPM at the end of this block
+ * @param from Gains at the end of the previous block
+ * @param to Gains at the end of this block
+ */
+static void mix_engine_block(int32_t *acc, size_t num_samples, uint16_t from_rpm, uint16_t to_rpm,
+                             const engine_gains_t *from, const engine_gains_t *to) {
+    int32_t rpm_delta = (int32_t)to_rpm - (int32_t)from_rpm;
+    engine_ramps_t ramps = engine_ramps(from, to, num_samples);
+    for (size_t off = 0; off < num_samples; off += AUDIO_RAMP_FRAMES) {
+        size_t len = num_samples - off;
+        if (len > AUDIO_RAMP_FRAMES) len = AUDIO_RAMP_FRAMES;
+        int32_t t = (int32_t)(off + len);
+        mix_engine_samples(from_rpm + (rpm_delta * t) / (int32_t)num_samples, &ramps, acc + off, len);
     }
 }
 
@@ -759,292 +1732,227 @@ static void mix_engine_samples(int16_t *buffer, size_t num_samples) {
  *
  * Similar to reference project: gradually attenuate volume and slow down pitch
  * to simulate engine winding down.
+ * @param gain Idle gain, ramping across the block
  */
-static void mix_shutdown_samples(int16_t *buffer, size_t num_samples) {
+static void mix_shutdown_samples(int32_t *acc, size_t num_samples, gain_ramp_t gain) {
     // Calculate slowed-down sample increment
     // As shutdown_speed_pct increases (100 -> 500), playback gets slower
-    uint32_t base_increment = calc_sample_increment(IDLE_RPM);
+    uint32_t base_increment = clip_increment(calc_sample_increment(IDLE_RPM),
+                                             lay->profile->idle.sample_rate);
     uint32_t increment = (base_increment * 100) / shutdown_speed_pct;
 
-    // Base volume with shutdown attenuation
-    int32_t idle_vol = (config.idle_volume * get_master_volume()) / 100;
-    idle_vol = idle_vol / shutdown_attenuation;
+    if (lay->profile->synth) {
+        mix_synth_layer(acc, num_samples, (256 * 100) / shutdown_speed_pct, gain);
+        return;
+    }
 
-    for (size_t i = 0; i < num_samples; i++) {
-        // Get idle sample only (no rev, no knock during shutdown)
-        int16_t idle_sample = get_idle_sample(idle_sample_pos);
-        int32_t mix = ((int32_t)idle_sample * idle_vol) >> 8;
+    // Idle sample only (no rev, no knock during shutdown)
+    mix_loop_layer(acc, num_samples, lay->profile->idle.samples, 0,
+                   lay->profile->idle.sample_count, &lay->idle_pos, increment, gain);
+}
 
-        // Advance sample position (slowed down)
-        idle_sample_pos += increment;
-        if ((idle_sample_pos >> 16) >= current_profile->idle.sample_count) {
-            idle_sample_pos = 0;
+/**
+ * @brief Mix the next block of a start sound stored below or above the output rate
+ *
+ * The position is start_sample_idx plus a 16-bit fraction, rebased every
+ * run, so long start sounds stay clear of the 16.16 position limit.
+ */
+static bool mix_start_resampled(int32_t *acc, size_t n, const sound_sample_t *start,
+                                uint32_t inc, int32_t vol) {
+    size_t i = 0;
+
+    while (i < n && start_sample_idx < start->sample_count) {
+        uint32_t avail = start->sample_count - start_sample_idx;
+        const int8_t *src = start->samples + start_sample_idx;
+        if (start->format == SOUND_FORMAT_IMA_ADPCM) {
+            // Only the samples the rest of this block reads (+1 to interpolate)
+            uint32_t need = (uint32_t)((start_sample_frac + (uint64_t)(n - i) * inc) >> 16) + 2;
+            if (avail > need) avail = need;
+            if (avail > ADPCM_WINDOW_SAMPLES) avail = ADPCM_WINDOW_SAMPLES;
+            adpcm_decode((const uint8_t *)start->samples, start_sample_idx, avail, adpcm_window);
+            src = adpcm_window;
+        } else if (avail > RESAMPLE_MAX_SAMPLES) {
+            avail = RESAMPLE_MAX_SAMPLES;
         }
 
-        // Clamp to 16-bit range
-        if (mix > 32767) mix = 32767;
-        if (mix < -32768) mix = -32768;
-
-        // Stereo output
-        buffer[i * 2] = (int16_t)mix;
-        buffer[i * 2 + 1] = (int16_t)mix;
+        uint32_t rel = start_sample_frac;
+        i += resample_mix_lerp8(acc + i, n - i, src, avail, &rel, inc, vol);
+        start_sample_idx += rel >> 16;
+        start_sample_frac = rel & 0xFFFF;
     }
+    return start_sample_idx >= start->sample_count;
 }
 
 /**
- * @brief Play engine start sound
+ * @brief Mix the next block of the engine start sound
  *
  * Note: Uses simple integer index instead of fixed-point to avoid overflow
- * with long start sounds (the start sound plays at normal speed anyway).
+ * with long start sounds. Clips at the output rate are copied sample for
+ * sample; others go through mix_start_resampled().
+ * @return true once the whole start sound has been mixed
  */
-static esp_err_t play_start_sound(void) {
-    ESP_LOGI(TAG, "Playing engine start sound (%lu samples)", current_profile->start.sample_count);
-
-    int16_t *buffer = heap_caps_malloc(ENGINE_BUFFER_SIZE * sizeof(int16_t) * 2, MALLOC_CAP_DMA);
-    if (!buffer) {
-        ESP_LOGE(TAG, "Failed to allocate start sound buffer");
-        return ESP_ERR_NO_MEM;
-    }
-
-    uint32_t sample_idx = 0;  // Simple integer index (no fixed-point needed)
-    size_t bytes_written;
+static bool mix_start_samples(int32_t *acc, size_t num_samples) {
+    const sound_sample_t *start = &lay->profile->start;
+    uint32_t sample_count = start->sample_count;
     int32_t vol = (config.start_volume * get_master_volume()) / 100;
-    uint32_t sample_count = current_profile->start.sample_count;
-
-    while (sample_idx < sample_count) {
-        for (size_t i = 0; i < ENGINE_BUFFER_SIZE; i++) {
-            int16_t sample;
-            if (sample_idx < sample_count) {
-                // 8-bit to 16-bit conversion
-                sample = ((int16_t)current_profile->start.samples[sample_idx]) << 8;
-                sample_idx++;
-            } else {
-                // Past end - output silence
-                sample = 0;
-            }
+    uint32_t inc = clip_increment(0x10000, start->sample_rate);
 
-            int32_t scaled = ((int32_t)sample * vol) >> 8;
-            buffer[i * 2] = (int16_t)scaled;
-            buffer[i * 2 + 1] = (int16_t)scaled;
-        }
-
-        esp_err_t ret = i2s_channel_write(tx_handle, buffer,
-                                          ENGINE_BUFFER_SIZE * sizeof(int16_t) * 2,
-                                          &bytes_written, pdMS_TO_TICKS(500));
-        if (ret != ESP_OK) {
-            // Timeout during start sound is less critical, just continue
-            vTaskDelay(pdMS_TO_TICKS(5));
-        }
+    if (inc != 0x10000) {
+        return mix_start_resampled(acc, num_samples, start, inc, vol);
+    }
 
-        // Feed watchdog - start sound can be several seconds long
-        esp_task_wdt_reset();
+    size_t n = num_samples;
+    if (start_sample_idx + n > sample_count) {
+        n = sample_count - start_sample_idx;
+    }
 
-        // Check for abort
-        if (engine_state != ENGINE_STARTING) {
-            break;
-        }
+    const int8_t *src = start->samples + start_sample_idx;
+    if (start->format == SOUND_FORMAT_IMA_ADPCM) {
+        // Sequential chunks of at most AUDIO_BLOCK_FRAMES (<= ADPCM_WINDOW_SAMPLES)
+        adpcm_decode((const uint8_t *)start->samples, start_sample_idx, n,
+                     adpcm_window);
+        src = adpcm_window;
+    }
+    for (size_t i = 0; i < n; i++) {
+        // 8-bit to 16-bit conversion
+        acc[i] += (((int32_t)src[i] << 8) * vol) >> 8;
     }
+    start_sample_idx += n;
 
-    free(buffer);
-    return ESP_OK;
+    return start_sample_idx >= sample_count;
 }
 
 /**
- * @brief Engine sound task
+ * @brief Per-block engine state update and render (mixer task)
+ */
+/**
+ * @brief Render one block (see engine_sound_render())
  */
-static void engine_sound_task(void *arg) {
-    ESP_LOGI(TAG, "Engine sound task started");
+static bool render_block(int32_t *engine_bus, int32_t *effects_bus, size_t num_samples) {
+    static uint16_t block_rpm = IDLE_RPM;   // RPM at the end of the previous block
+    static int64_t last_shutdown_update = 0;
 
-    // Wait for sound.c to finish any playback (like boot chime)
-    while (sound_is_playing()) {
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
-    ESP_LOGI(TAG, "Sound system free, engine task ready");
+    // Before the init check, so a profile handed over is never left waiting
+    profile_swap_check();
 
-    int16_t *buffer = heap_caps_malloc(ENGINE_BUFFER_SIZE * sizeof(int16_t) * 2, MALLOC_CAP_DMA);
-    if (!buffer) {
-        ESP_LOGE(TAG, "Failed to allocate engine sound buffer");
-        engine_task_running = false;
-        vTaskDelete(NULL);
-        return;
+    if (!engine_initialized) {
+        return false;
     }
 
-    size_t bytes_written;
-    uint32_t rpm_update_counter = 0;
-
-    static int64_t last_shutdown_update = 0;
-
-    while (engine_task_running) {
-        // Wait if sound.c is playing something
-        if (sound_is_playing()) {
-            vTaskDelay(pdMS_TO_TICKS(10));
-            continue;
+    // Drain the parameter channel every block, so it never backs up
+    params_consume();
+
+    uint32_t engine_cycles = perf_cycles();
+
+    // The kernels are only pointed at a layer set while the engine plays
+    // (engine_sound_bench_mix() borrows them while it is off)
+    if (engine_state == ENGINE_STARTING) {
+        lay = &layer_sets[live_set];
+        bool done = mix_start_samples(engine_bus, num_samples);
+        apply_mute(engine_bus, num_samples);
+        perf_stage_end(PERF_STAGE_AUDIO_ENGINE, engine_cycles);
+        if (done && engine_state == ENGINE_STARTING) {
+            // Transition to running
+            current_rpm = IDLE_RPM;
+            params.target_rpm = IDLE_RPM;
+            block_rpm = IDLE_RPM;
+            block_gains = engine_gains(IDLE_RPM, params.idle_volume_pct, params.rev_volume_pct);
+            engine_state = ENGINE_RUNNING;
+            ESP_LOGI(TAG, "Engine started (gear 1)");
         }
+        return true;
+    }
 
-        if (engine_state == ENGINE_RUNNING && engine_enabled) {
-            // Update RPM every few iterations for smoother transitions
-            if (++rpm_update_counter >= 4) {
-                rpm_update_counter = 0;
-                update_rpm();
+    if (engine_state == ENGINE_RUNNING && engine_enabled) {
+        // Update RPM every block, then ramp pitch to it across the block
+        uint16_t from_rpm = block_rpm;
+        update_rpm(num_samples);
+        block_rpm = current_rpm;
+
+        // Fade out gear shift effect over GEAR_SHIFT_DURATION_MS
+        if (gear_shift_attenuation > 0) {
+            int64_t elapsed = esp_timer_get_time() / 1000 - gear_shift_start_time;
+            if (elapsed >= GEAR_SHIFT_DURATION_MS) {
+                gear_shift_attenuation = 0;
+            } else {
+                // Linear fade from 100 to 0
+                gear_shift_attenuation = 100 - (uint8_t)((elapsed * 100) / GEAR_SHIFT_DURATION_MS);
             }
+        }
 
-            // Process gear shift effect
-            int64_t now_ms = esp_timer_get_time() / 1000;
-            if (gear_shift_trigger) {
-                gear_shift_trigger = false;
-                gear_shift_start_time = now_ms;
-                gear_shift_attenuation = 100;  // Start at max attenuation
-            }
+        // Layer gains ramp from where the last block ended
+        engine_gains_t from_gains = block_gains;
+        block_gains = engine_gains(block_rpm, params.idle_volume_pct, params.rev_volume_pct);
+
+        lay = &layer_sets[live_set];
+        mix_engine_block(engine_bus, num_samples, from_rpm, block_rpm, &from_gains, &block_gains);
+        if (xfade_active) {
+            // Incoming profile from the start of its loops, then blended in
+            memset(xfade_bus, 0, num_samples * sizeof(int32_t));
+            lay = &layer_sets[live_set ^ 1];
+            mix_engine_block(xfade_bus, num_samples, from_rpm, block_rpm, &from_gains, &block_gains);
+            xfade_blend(engine_bus, num_samples);
+        }
+        apply_mute(engine_bus, num_samples);
+        perf_stage_end(PERF_STAGE_AUDIO_ENGINE, engine_cycles);
 
-            // Fade out gear shift effect over GEAR_SHIFT_DURATION_MS
-            if (gear_shift_attenuation > 0) {
-                int64_t elapsed = now_ms - gear_shift_start_time;
-                if (elapsed >= GEAR_SHIFT_DURATION_MS) {
-                    gear_shift_attenuation = 0;
-                } else {
-                    // Linear fade from 100 to 0
-                    gear_shift_attenuation = 100 - (uint8_t)((elapsed * 100) / GEAR_SHIFT_DURATION_MS);
-                }
-            }
+        // Sound effects (only active voices cost anything)
+        mix_effects_timed(effects_bus, num_samples, VOICE_MASK_ALL);
+        return true;
+    }
 
-            // Mix and output engine sound
-            mix_engine_samples(buffer, ENGINE_BUFFER_SIZE);
-
-            esp_err_t ret = i2s_channel_write(tx_handle, buffer,
-                                              ENGINE_BUFFER_SIZE * sizeof(int16_t) * 2,
-                                              &bytes_written, pdMS_TO_TICKS(500));
-            if (ret != ESP_OK) {
-                // Only log occasionally to avoid flooding
-                static uint32_t error_count = 0;
-                if (++error_count % 100 == 1) {
-                    ESP_LOGW(TAG, "I2S write error: %s (count=%lu)", esp_err_to_name(ret), error_count);
-                }
-                vTaskDelay(pdMS_TO_TICKS(5));  // Brief delay on error
-            }
-        } else if (engine_state == ENGINE_STOPPING) {
-            // Gradual engine shutdown with fade-out and slow-down
-            int64_t now = esp_timer_get_time() / 1000;
-
-            // Update shutdown parameters every 100ms
-            if (now - last_shutdown_update > 100) {
-                last_shutdown_update = now;
-                shutdown_attenuation++;      // Reduce volume
-                shutdown_speed_pct += 15;    // Slow down pitch
-            }
+    if (engine_state == ENGINE_STOPPING) {
+        // Gradual engine shutdown with fade-out and slow-down
+        int64_t now = esp_timer_get_time() / 1000;
 
-            // Check if shutdown is complete
-            if (shutdown_attenuation >= 40 || shutdown_speed_pct >= 400) {
-                ESP_LOGI(TAG, "Engine stopped");
-                engine_state = ENGINE_OFF;
-                current_rpm = IDLE_RPM;
-                // Reset shutdown state for next time
-                shutdown_attenuation = 1;
-                shutdown_speed_pct = 100;
-                continue;
-            }
+        // Update shutdown parameters every 100ms
+        if (now - last_shutdown_update > 100) {
+            last_shutdown_update = now;
+            shutdown_attenuation++;      // Reduce volume
+            shutdown_speed_pct += 15;    // Slow down pitch
+        }
 
-            // Mix shutdown sound (fading out and slowing down)
-            mix_shutdown_samples(buffer, ENGINE_BUFFER_SIZE);
+        // Check if shutdown is complete
+        if (shutdown_attenuation >= 40 || shutdown_speed_pct >= 400) {
+            ESP_LOGI(TAG, "Engine stopped");
+            engine_state = ENGINE_OFF;
+            current_rpm = IDLE_RPM;
+            // Reset shutdown state for next time
+            shutdown_attenuation = 1;
+            shutdown_speed_pct = 100;
+            return false;
+        }
 
-            esp_err_t ret = i2s_channel_write(tx_handle, buffer,
-                                              ENGINE_BUFFER_SIZE * sizeof(int16_t) * 2,
-                                              &bytes_written, pdMS_TO_TICKS(500));
-            if (ret != ESP_OK) {
-                vTaskDelay(pdMS_TO_TICKS(5));
-            }
-        } else {
-            // Engine not running
-            // But still allow horn to play!
-            if (horn_active && config.horn_enabled) {
-                // Mix horn-only audio
-                const signed char *horn_samples;
-                uint32_t horn_count, horn_loop_begin, horn_loop_end;
-
-                // Select horn type
-                switch (config.horn_type) {
-                    case HORN_TYPE_MANTGE:
-                        horn_samples = mantgeHornSamples;
-                        horn_count = mantgeHornSampleCount;
-                        horn_loop_begin = mantgeHornLoopBegin;
-                        horn_loop_end = mantgeHornLoopEnd;
-                        break;
-                    case HORN_TYPE_CUCARACHA:
-                        horn_samples = cucarachaSamples;
-                        horn_count = cucarachaSampleCount;
-                        horn_loop_begin = cucarachaLoopBegin;
-                        horn_loop_end = cucarachaLoopEnd;
-                        break;
-                    case HORN_TYPE_2TONE:
-                        horn_samples = horn2ToneSamples;
-                        horn_count = horn2ToneSampleCount;
-                        horn_loop_begin = horn2ToneLoopBegin;
-                        horn_loop_end = horn2ToneLoopEnd;
-                        break;
-                    case HORN_TYPE_DIXIE:
-                        horn_samples = hornDixieSamples;
-                        horn_count = hornDixieSampleCount;
-                        horn_loop_begin = hornDixieLoopBegin;
-                        horn_loop_end = hornDixieLoopEnd;
-                        break;
-                    case HORN_TYPE_PETERBILT:
-                        horn_samples = hornPeterbiltSamples;
-                        horn_count = hornPeterbiltSampleCount;
-                        horn_loop_begin = hornPeterbiltLoopBegin;
-                        horn_loop_end = hornPeterbiltLoopEnd;
-                        break;
-                    case HORN_TYPE_OUTLAW:
-                        horn_samples = hornOutlawSamples;
-                        horn_count = hornOutlawSampleCount;
-                        horn_loop_begin = hornOutlawLoopBegin;
-                        horn_loop_end = hornOutlawLoopEnd;
-                        break;
-                    default:  // HORN_TYPE_TRUCK
-                        horn_samples = truckHornSamples;
-                        horn_count = truckHornSampleCount;
-                        horn_loop_begin = truckHornLoopBegin;
-                        horn_loop_end = truckHornLoopEnd;
-                        break;
-                }
-
-                // Generate horn samples into buffer
-                int32_t vol = (config.horn_volume * get_master_volume()) / 100;
-                for (size_t i = 0; i < ENGINE_BUFFER_SIZE; i++) {
-                    uint32_t idx = horn_sample_pos >> 16;
-                    int32_t mix = 0;
-                    if (idx < horn_count) {
-                        int16_t sample = ((int16_t)horn_samples[idx]) << 8;
-                        mix = ((int32_t)sample * vol) >> 8;
-                        horn_sample_pos += 0x10000;
-
-                        // Loop within the loop region
-                        uint32_t next_idx = horn_sample_pos >> 16;
-                        if (next_idx >= horn_loop_end) {
-                            horn_sample_pos = horn_loop_begin << 16;
-                        }
-                    }
-                    // Clamp to 16-bit range
-                    if (mix > 32767) mix = 32767;
-                    if (mix < -32768) mix = -32768;
-                    buffer[i * 2] = (int16_t)mix;
-                    buffer[i * 2 + 1] = (int16_t)mix;
-                }
-
-                esp_err_t ret = i2s_channel_write(tx_handle, buffer,
-                                                  ENGINE_BUFFER_SIZE * sizeof(int16_t) * 2,
-                                                  &bytes_written, pdMS_TO_TICKS(500));
-                if (ret != ESP_OK) {
-                    vTaskDelay(pdMS_TO_TICKS(5));
-                }
-            } else {
-                // No horn, just wait
-                vTaskDelay(pdMS_TO_TICKS(50));
-            }
+        // Mix shutdown sound (fading out and slowing down), ramping from the
+        // idle gain the last block ended on
+        int32_t shutdown_gain = (config.idle_volume * get_master_volume()) / 100 / shutdown_attenuation;
+        gain_ramp_t gain = gain_ramp(block_gains.idle, shutdown_gain, num_samples);
+        block_gains = (engine_gains_t){ .idle = shutdown_gain };
+
+        lay = &layer_sets[live_set];
+        mix_shutdown_samples(engine_bus, num_samples, gain);
+        if (xfade_active) {
+            memset(xfade_bus, 0, num_samples * sizeof(int32_t));
+            lay = &layer_sets[live_set ^ 1];
+            mix_shutdown_samples(xfade_bus, num_samples, gain);
+            xfade_blend(engine_bus, num_samples);
         }
+        apply_mute(engine_bus, num_samples);
+        perf_stage_end(PERF_STAGE_AUDIO_ENGINE, engine_cycles);
+        return true;
+    }
+
+    // Engine not running, but still allow horn to play!
+    if (voice_is_active(VOICE_HORN)) {
+        mix_effects_timed(effects_bus, num_samples, VOICE_BIT(VOICE_HORN));
+        return true;
     }
 
-    free(buffer);
-    ESP_LOGI(TAG, "Engine sound task stopped");
-    vTaskDelete(NULL);
+    return false;
+}
+
+bool engine_sound_render(int32_t *engine_bus, int32_t *effects_bus, size_t num_samples) {
+    return render_block(engine_bus, effects_bus, num_samples);
 }
 
 // ============================================================================
@@ -1060,7 +1968,7 @@ static void sound_config_get_defaults(engine_sound_config_t *cfg)
 
     cfg->magic = SOUND_CONFIG_MAGIC;
     cfg->version = SOUND_CONFIG_VERSION;
-    cfg->profile = SOUND_PROFILE_CAT_3408;
+    cfg->profile = SOUND_PROFILE_DEFAULT;
     cfg->master_volume_level1 = 100;    // Normal volume
     cfg->master_volume_level2 = 50;     // Quiet mode
     cfg->active_volume_level = 0;       // Start on level 1
@@ -1089,15 +1997,14 @@ static void sound_config_get_defaults(engine_sound_config_t *cfg)
     cfg->wastegate_enabled = true;
     cfg->wastegate_volume = 70;
     cfg->horn_enabled = true;
-    cfg->horn_type = HORN_TYPE_TRUCK;
+    cfg->horn_type = HORN_TYPE_DEFAULT;
     cfg->horn_volume = 80;
     cfg->mode_switch_sound_enabled = true;
     cfg->mode_switch_volume = 80;
 }
 
 /**
- * @brief Migrate sound config from old version to new version
- * Preserves all compatible settings, only new fields get defaults
+ * @brief Fix-ups after the field copy of an older sound config
  *
  * Version history:
  *   v1: Original config with single master_volume field
@@ -1105,63 +2012,75 @@ static void sound_config_get_defaults(engine_sound_config_t *cfg)
  *       - Struct layout changed: fields after master_volume shifted by 2 bytes
  *   v3: Added configurable volume presets (volume_preset_low/medium/high)
  *       - Struct layout changed: new fields added before idle_volume
+ *
+ * Because of the layout changes only the profile and volume levels survive
+ * from v1/v2; everything else keeps its default.
  */
-static void sound_config_migrate(engine_sound_config_t *old_config, uint32_t old_version)
+static void sound_config_upgrade(void *cfg, uint32_t from_version)
 {
-    ESP_LOGI(TAG, "Migrating sound config from v%lu to v%d", (unsigned long)old_version, SOUND_CONFIG_VERSION);
-
-    // Get fresh defaults for new version
-    engine_sound_config_t new_config;
-    sound_config_get_defaults(&new_config);
-
-    // Preserve profile selection (same offset in all versions)
-    new_config.profile = old_config->profile;
-
-    if (old_version == 1) {
-        // v1 → v2 migration:
-        // - Old struct had single master_volume at offset of new master_volume_level1
-        // - All fields after that have shifted by 2 bytes, so they can't be trusted
-        // - We preserve the old master_volume as level1, set level2 to half that
-        // - All other settings reset to defaults (struct layout incompatible)
-
-        // The old master_volume is now at the position of master_volume_level1
-        uint8_t old_master_volume = old_config->master_volume_level1;
-        new_config.master_volume_level1 = old_master_volume;
-        new_config.master_volume_level2 = old_master_volume / 2;  // Quiet mode = half
-        new_config.active_volume_level = 0;  // Start on level 1
+    engine_sound_config_t *c = cfg;
 
+    if (from_version == 1) {
+        // v1's master_volume sits where master_volume_level1 is now
+        c->master_volume_level2 = c->master_volume_level1 / 2;  // Quiet mode = half
+        c->active_volume_level = 0;
         ESP_LOGI(TAG, "v1->v2: old master_volume=%d -> level1=%d, level2=%d",
-                 old_master_volume, new_config.master_volume_level1, new_config.master_volume_level2);
-    }
-
-    if (old_version >= 2) {
-        // v2 → v3 migration:
-        // - Preserve all v2 fields that are still at same offsets
-        // - New volume_preset fields get defaults
-        new_config.master_volume_level1 = old_config->master_volume_level1;
-        new_config.master_volume_level2 = old_config->master_volume_level2;
-        new_config.active_volume_level = old_config->active_volume_level;
-        // Note: All fields after idle_volume have shifted by 3 bytes in v3
-        // Since struct layout changed, we keep defaults for everything else
-        // Volume presets get default values (20, 100, 170)
-
-        ESP_LOGI(TAG, "v2->v3: preserving volume levels, adding preset defaults");
+                 c->master_volume_level1, c->master_volume_level1, c->master_volume_level2);
     }
+}
 
-    // Copy migrated config back
-    memcpy(old_config, &new_config, sizeof(engine_sound_config_t));
-    old_config->magic = SOUND_CONFIG_MAGIC;
-    old_config->version = SOUND_CONFIG_VERSION;
+// Fields kept when a sound config of an older version is loaded
+static const nvs_field_t sound_config_fields[] = {
+    NVS_FIELD(engine_sound_config_t, profile, 1),
+    NVS_FIELD(engine_sound_config_t, master_volume_level1, 1),
+    NVS_FIELD(engine_sound_config_t, master_volume_level2, 2),
+    NVS_FIELD(engine_sound_config_t, active_volume_level, 2),
+    NVS_FIELD(engine_sound_config_t, volume_preset_low, 3),
+    NVS_FIELD(engine_sound_config_t, volume_preset_medium, 3),
+    NVS_FIELD(engine_sound_config_t, volume_preset_high, 3),
+    NVS_FIELD(engine_sound_config_t, idle_volume, 3),
+    NVS_FIELD(engine_sound_config_t, rev_volume, 3),
+    NVS_FIELD(engine_sound_config_t, knock_volume, 3),
+    NVS_FIELD(engine_sound_config_t, start_volume, 3),
+    NVS_FIELD(engine_sound_config_t, max_rpm_percentage, 3),
+    NVS_FIELD(engine_sound_config_t, acceleration, 3),
+    NVS_FIELD(engine_sound_config_t, deceleration, 3),
+    NVS_FIELD(engine_sound_config_t, rev_switch_point, 3),
+    NVS_FIELD(engine_sound_config_t, idle_end_point, 3),
+    NVS_FIELD(engine_sound_config_t, knock_start_point, 3),
+    NVS_FIELD(engine_sound_config_t, knock_interval, 3),
+    NVS_FIELD(engine_sound_config_t, jake_brake_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, v8_mode, 3),
+    NVS_FIELD(engine_sound_config_t, air_brake_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, air_brake_volume, 3),
+    NVS_FIELD(engine_sound_config_t, reverse_beep_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, reverse_beep_volume, 3),
+    NVS_FIELD(engine_sound_config_t, gear_shift_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, gear_shift_volume, 3),
+    NVS_FIELD(engine_sound_config_t, wastegate_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, wastegate_volume, 3),
+    NVS_FIELD(engine_sound_config_t, horn_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, horn_type, 3),
+    NVS_FIELD(engine_sound_config_t, horn_volume, 3),
+    NVS_FIELD(engine_sound_config_t, mode_switch_sound_enabled, 3),
+    NVS_FIELD(engine_sound_config_t, mode_switch_volume, 3),
+};
 
-    ESP_LOGI(TAG, "Sound config migration complete");
-}
+static const nvs_schema_t sound_config_schema = {
+    .magic = SOUND_CONFIG_MAGIC,
+    .version = SOUND_CONFIG_VERSION,
+    .size = sizeof(engine_sound_config_t),
+    .fields = sound_config_fields,
+    .field_count = sizeof(sound_config_fields) / sizeof(sound_config_fields[0]),
+    .upgrade = sound_config_upgrade,
+};
 
 // ============================================================================
 // Public API
 // ============================================================================
 
 esp_err_t engine_sound_init(void) {
-    if (engine_task_running) {
+    if (engine_initialized) {
         ESP_LOGW(TAG, "Engine sound already initialized");
         return ESP_OK;
     }
@@ -1173,80 +2092,63 @@ esp_err_t engine_sound_init(void) {
         return ESP_ERR_NO_MEM;
     }
 
-    // Try to load saved config from NVS with migration support
-    engine_sound_config_t saved_config;
-    size_t config_len = sizeof(engine_sound_config_t);
-    esp_err_t load_ret = nvs_load_sound_config(&saved_config, &config_len);
+    // Load saved config from NVS over the defaults (older versions are migrated)
+    sound_config_get_defaults(&config);
+    esp_err_t load_ret = nvs_storage_load(NVS_BLOB_SOUND, &sound_config_schema, &config);
 
-    if (load_ret != ESP_OK || saved_config.magic != SOUND_CONFIG_MAGIC) {
-        // No valid config at all - use defaults
+    if (load_ret != ESP_OK) {
         ESP_LOGW(TAG, "No valid sound config found, using defaults");
-        sound_config_get_defaults(&config);
-        nvs_save_sound_config(&config, sizeof(engine_sound_config_t));
-    } else if (saved_config.version != SOUND_CONFIG_VERSION) {
-        // Valid config but old version - migrate it
-        sound_config_migrate(&saved_config, saved_config.version);
-        memcpy(&config, &saved_config, sizeof(engine_sound_config_t));
-        nvs_save_sound_config(&config, sizeof(engine_sound_config_t));
+        nvs_storage_save_deferred(NVS_BLOB_SOUND, &config, sizeof(engine_sound_config_t));
     } else {
-        // Valid config with current version
-        ESP_LOGI(TAG, "Loaded sound config from NVS (version %lu)", (unsigned long)saved_config.version);
-        memcpy(&config, &saved_config, sizeof(engine_sound_config_t));
+        ESP_LOGI(TAG, "Loaded sound config from NVS (version %lu)", (unsigned long)config.version);
+    }
+
+    // A built-in profile left out of this build: switch to the default one
+    if (config.profile < SOUND_PROFILE_COUNT && !sound_profiles_is_available(config.profile)) {
+        ESP_LOGW(TAG, "Profile %d not in this build, using %s", config.profile,
+                 sound_profiles_get_name(SOUND_PROFILE_DEFAULT));
+        config.profile = SOUND_PROFILE_DEFAULT;
     }
 
     // Load profile
-    current_profile = sound_profiles_get(config.profile);
-    if (!current_profile) {
+    const sound_profile_def_t *profile = sound_profiles_get(config.profile);
+    if (!profile) {
         ESP_LOGE(TAG, "Failed to load sound profile");
         vSemaphoreDelete(engine_mutex);
         return ESP_FAIL;
     }
+    profile_cache_reserve();
+    current_profile = profile_cache_load(profile);
+    live_set = 0;
+    xfade_active = false;
+    incoming_profile = NULL;
+    layers_reset(&layer_sets[0], current_profile);
 
     // Update knock interval based on profile cylinder count
     config.knock_interval = current_profile->cylinder_count;
 
+    // Profile switches are cached in the background (kept across deinit)
+    if (loader_task_handle == NULL &&
+        xTaskCreatePinnedToCore(profile_loader_task, "snd_loader", SOUND_LOADER_TASK_STACK_SIZE, NULL,
+                                SOUND_LOADER_TASK_PRIORITY, &loader_task_handle,
+                                SOUND_LOADER_TASK_CORE) != pdPASS) {
+        loader_task_handle = NULL;
+        ESP_LOGW(TAG, "No profile loader task, profile switches load in the caller");
+    }
+
     // Initialize state
     engine_state = ENGINE_OFF;
     current_rpm = IDLE_RPM;
     target_rpm = IDLE_RPM;
     engine_enabled = true;
-
-    // Reset sample positions
-    idle_sample_pos = 0;
-    rev_sample_pos = 0;
-    knock_sample_pos = 0;
-    jake_sample_pos = 0;
+    engine_muted = false;
 
     // Reset effect state
-    air_brake_trigger = false;
-    air_brake_sample_pos = 0;
-    reverse_beep_playing = false;
-    reverse_beep_sample_pos = 0;
-    gear_shift_sound_trigger = false;
-    gear_shift_sound_sample_pos = 0;
-    wastegate_trigger = false;
-    wastegate_sample_pos = 0;
+    voice_active_mask = 0;
     wastegate_lockout_time = 0;
     prev_throttle_for_wastegate = 0;
 
-    // Create engine sound task
-    engine_task_running = true;
-    BaseType_t ret = xTaskCreatePinnedToCore(
-        engine_sound_task,
-        "engine_snd",
-        4096,
-        NULL,
-        5,  // Higher priority for smooth audio
-        &engine_task_handle,
-        1   // Run on core 1
-    );
-
-    if (ret != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create engine sound task");
-        engine_task_running = false;
-        vSemaphoreDelete(engine_mutex);
-        return ESP_FAIL;
-    }
+    engine_initialized = true;
 
     ESP_LOGI(TAG, "Engine sound system initialized");
     ESP_LOGI(TAG, "  Profile: %s (%s)", current_profile->name, current_profile->description);
@@ -1260,17 +2162,20 @@ esp_err_t engine_sound_init(void) {
 }
 
 esp_err_t engine_sound_deinit(void) {
-    if (!engine_task_running) {
+    if (!engine_initialized) {
         return ESP_OK;
     }
 
-    // Stop task
-    engine_task_running = false;
+    // The mixer stops rendering engine audio at its next block
+    engine_initialized = false;
     engine_state = ENGINE_OFF;
 
-    // Wait for task to finish
+    // Let an in-flight render finish
     vTaskDelay(pdMS_TO_TICKS(100));
 
+    // The cache slots stay reserved for the next init
+    cache_info = (engine_sound_cache_info_t){ 0 };
+
     if (engine_mutex) {
         vSemaphoreDelete(engine_mutex);
         engine_mutex = NULL;
@@ -1281,7 +2186,7 @@ esp_err_t engine_sound_deinit(void) {
 }
 
 esp_err_t engine_sound_start(void) {
-    if (!engine_task_running) {
+    if (!engine_initialized) {
         ESP_LOGE(TAG, "Engine sound not initialized");
         return ESP_ERR_INVALID_STATE;
     }
@@ -1291,26 +2196,27 @@ esp_err_t engine_sound_start(void) {
         return ESP_OK;
     }
 
-    ESP_LOGI(TAG, "Starting engine...");
-    engine_state = ENGINE_STARTING;
+    if (engine_state == ENGINE_STARTING) {
+        return ESP_OK;
+    }
+
+    if (__atomic_load_n(&bench_active, __ATOMIC_SEQ_CST)) {
+        ESP_LOGW(TAG, "Benchmark running, engine start ignored");
+        return ESP_ERR_INVALID_STATE;
+    }
 
-    // Play start sound
-    play_start_sound();
+    ESP_LOGI(TAG, "Starting engine (%lu start samples)...", current_profile->start.sample_count);
 
-    // Transition to running
-    engine_state = ENGINE_RUNNING;
+    // Reset RPM (the vehicle model holds the gearbox in 1st until running)
     current_rpm = IDLE_RPM;
     target_rpm = IDLE_RPM;
 
-    // Reset transmission state
-    current_gear = 1;
-    engine_load = 0;
-    vehicle_speed = 0;
-    last_upshift_time = 0;
-    last_downshift_time = 0;
-    rpm_settled_after_upshift = true;  // Allow first upshift
+    // The mixer plays the start sound and switches to ENGINE_RUNNING when done
+    start_sample_idx = 0;
+    start_sample_frac = 0;
+    engine_state = ENGINE_STARTING;
+    audio_mixer_wake();
 
-    ESP_LOGI(TAG, "Engine started (gear 1)");
     return ESP_OK;
 }
 
@@ -1325,225 +2231,72 @@ esp_err_t engine_sound_stop(void) {
     shutdown_attenuation = 1;
     shutdown_speed_pct = 100;
 
-    // Trigger the shutdown sequence - the task will handle the fade-out
+    // Trigger the shutdown sequence - the mixer will handle the fade-out
     engine_state = ENGINE_STOPPING;
 
     return ESP_OK;
 }
 
-void engine_sound_update(int16_t throttle, int16_t speed) {
+void engine_sound_update(const vehicle_state_t *vehicle) {
     if (engine_state != ENGINE_RUNNING) {
         return;
     }
 
     int64_t now = esp_timer_get_time() / 1000;
 
-    // Debug logging every 2 seconds
-    static int64_t last_debug_log = 0;
-    bool should_log = (now - last_debug_log) > 2000;
-
-    // =========================================================================
-    // INPUT PROCESSING - Detect braking vs accelerating
-    // =========================================================================
-
-    // Speed: positive = forward, negative = reverse
-    int16_t abs_speed = (speed < 0) ? -speed : speed;
-    vehicle_speed = abs_speed / 2;  // 0-1000 -> 0-500
-
-    // Determine movement direction and throttle intent
-    bool moving_reverse = (speed < -50);
-    bool throttle_neutral = (throttle > -50 && throttle < 50);
-
-    // Get braking state from tuning layer (more accurate, tracks momentum)
-    bool is_braking = tuning_is_braking();
-
-    // Calculate effective throttle for engine (0-500)
-    // When braking, throttle contribution is zero
-    int16_t effective_throttle = 0;
-    if (!is_braking && !throttle_neutral) {
-        int16_t abs_throttle = (throttle < 0) ? -throttle : throttle;
-        effective_throttle = abs_throttle / 2;  // 0-1000 -> 0-500
-    }
+    // Everything about the drivetrain comes from the shared vehicle model
+    bool is_braking = vehicle->braking;
+    bool throttle_neutral = (vehicle->throttle > -50 && vehicle->throttle < 50);
+    int16_t vehicle_speed = vehicle->speed;
+    int16_t effective_throttle = vehicle->engine_throttle;
+    bool in_reverse = vehicle->reversing;
+    bool gear_shifted = (vehicle->shift_seq != gear_shift_seq);
+    gear_shift_seq = vehicle->shift_seq;
 
     // =========================================================================
     // THROTTLE-DEPENDENT VOLUME FADING (like reference project)
     // Smooth volume transitions - key to natural sound!
     // =========================================================================
 
-    // Fade throttle smoothly (increment/decrement by 2 like reference)
-    if (!is_braking && current_throttle_faded < effective_throttle && current_throttle_faded < 499) {
-        current_throttle_faded += 2;
-    }
-    if ((current_throttle_faded > effective_throttle || is_braking) && current_throttle_faded > 2) {
-        current_throttle_faded -= 2;
-    }
-
-    // Calculate throttle-dependent volumes (maps 0-500 throttle to volume range)
-    if (!is_braking && engine_state == ENGINE_RUNNING) {
-        // Map faded throttle to volume: idle% at 0, full% at 500
-        throttle_dependent_volume = ENGINE_IDLE_VOLUME_PCT +
-            (current_throttle_faded * (ENGINE_FULL_VOLUME_PCT - ENGINE_IDLE_VOLUME_PCT)) / 500;
-        throttle_dependent_rev_volume = REV_IDLE_VOLUME_PCT +
-            (current_throttle_faded * (REV_FULL_VOLUME_PCT - REV_IDLE_VOLUME_PCT)) / 500;
-    } else {
-        // When braking, gradually decrease volume
-        if (throttle_dependent_volume > ENGINE_IDLE_VOLUME_PCT) {
-            throttle_dependent_volume--;
-        }
-        if (throttle_dependent_rev_volume > REV_IDLE_VOLUME_PCT) {
-            throttle_dependent_rev_volume--;
-        }
-    }
-
-    // Determine if we're in reverse gear for reverse beep
-    // Beep should play when:
-    // 1. Actually moving backwards, OR
-    // 2. Stopped but actively accelerating into reverse
-    // Beep should NOT play when braking to a stop (even from reverse)
-    int8_t direction = tuning_get_last_direction();
-    bool stopped = (abs_speed < 50);
-    bool accelerating_into_reverse = stopped && (direction == -1) && !is_braking && (throttle < -100);
-    bool in_reverse = moving_reverse || accelerating_into_reverse;
-
-    // =========================================================================
-    // ENGINE LOAD CALCULATION
-    // =========================================================================
-
-    // Engine load = how hard we're pushing the engine
-    // High load = high throttle + low RPM (engine struggling to accelerate)
-    // Low load = low throttle OR RPM has caught up to demand
-    if (is_braking || throttle_neutral) {
-        engine_load = 0;
-    } else {
-        // Calculate actual max RPM based on config for load calculation
-        uint16_t actual_max = (IDLE_RPM * config.max_rpm_percentage) / 100;
-        uint16_t actual_range = actual_max - IDLE_RPM;  // Actual usable range
-
-        // Convert throttle (0-500) to actual RPM scale
-        int16_t throttle_as_rpm = (effective_throttle * actual_range) / 500;
-        int16_t actual_rpm_offset = current_rpm - IDLE_RPM;
-
-        // Load = demand minus current output
-        // Positive when throttle demands more than engine is currently giving
-        engine_load = throttle_as_rpm - actual_rpm_offset;
-        if (engine_load < 0) engine_load = 0;
-        if (engine_load > 180) engine_load = 180;
-    }
-
-    // =========================================================================
-    // AUTOMATIC TRANSMISSION GEAR SELECTION
-    // =========================================================================
-
-    // Calculate actual max RPM based on config
-    uint16_t max_rpm = (IDLE_RPM * config.max_rpm_percentage) / 100;
-    uint16_t rpm_range = max_rpm - IDLE_RPM;  // Usable RPM range
-
-    // Load-dependent shift points (scaled to actual RPM range)
-    // Reference: upshift at 78-98% of max, downshift at 30-50% of max
-    // Base upshift: 78% of range + idle, max upshift: 98% of range + idle
-    int16_t upshift_base = IDLE_RPM + (rpm_range * 78 / 100);   // ~78% of max
-    int16_t upshift_max = IDLE_RPM + (rpm_range * 98 / 100);    // ~98% of max
-    int16_t upshift_point = upshift_base + ((upshift_max - upshift_base) * engine_load / 180);
-
-    // Base downshift: 30% of range + idle, max downshift: 50% of range + idle
-    int16_t downshift_base = IDLE_RPM + (rpm_range * 30 / 100); // ~30% of max
-    int16_t downshift_max = IDLE_RPM + (rpm_range * 50 / 100);  // ~50% of max
-    int16_t downshift_point = downshift_base + ((downshift_max - downshift_base) * engine_load / 180);
-
-    if (in_reverse) {
-        // Reverse - only one gear
-        current_gear = 0;
-    } else if (current_gear == 0 && !in_reverse) {
-        // Coming out of reverse, start in 1st
-        current_gear = 1;
-    } else {
-        // Forward gears with automatic shifting
-
-        // Track if RPM has settled below upshift point since last upshift
-        // This prevents back-to-back upshifts when accelerating hard
-        // But after 2 seconds, allow upshift anyway (sustained high RPM)
-        bool time_override = (now - last_upshift_time) > 2000;
-        if (current_rpm < upshift_point - 30) {  // 30 RPM hysteresis
-            rpm_settled_after_upshift = true;
-        }
-
-        // Upshift: High RPM + low engine load + lockout timers expired
-        // Either RPM settled OR enough time passed (sustained high RPM)
-        if ((now - last_downshift_time) > 800 &&
-            (now - last_upshift_time) > 800 &&
-            (rpm_settled_after_upshift || time_override) &&
-            current_rpm >= upshift_point &&
-            engine_load < 10 &&
-            current_gear < 3 &&
-            !is_braking) {
-            current_gear++;
-            last_upshift_time = now;
-            gear_shift_trigger = true;  // Trigger gear shift sound
-            rpm_settled_after_upshift = false;  // Must settle again before next upshift
-            ESP_LOGI(TAG, "Upshift to gear %d (RPM=%d, load=%d)", current_gear, current_rpm, engine_load);
+    // Fades are defined per 10ms reference tick (like reference project).
+    // Run them once per elapsed reference tick so they take the same time
+    // at any control loop rate.
+    static int32_t fade_accum_q8 = 0;
+    fade_accum_q8 += tuning_get_dt_q8();
+    while (fade_accum_q8 >= 256) {
+        fade_accum_q8 -= 256;
+
+        // Fade throttle smoothly (increment/decrement by 2 like reference)
+        if (!is_braking && current_throttle_faded < effective_throttle && current_throttle_faded < 499) {
+            current_throttle_faded += 2;
         }
-
-        // Downshift: Low RPM OR high engine load (kickdown) + lockout timers expired
-        // Also downshift when braking (engine braking in lower gear)
-        // BUT: Don't kickdown if already at/near max RPM (engine is giving all it can)
-        bool at_max_rpm = (current_rpm >= (max_rpm - 20));  // Within 20 RPM of max
-        bool kickdown_allowed = (engine_load > 100) && !at_max_rpm && (current_gear > 2);  // Only drop to 2nd, not 1st
-
-        if ((now - last_upshift_time) > 800 &&
-            (now - last_downshift_time) > 800 &&
-            current_gear > 1 &&
-            (current_rpm <= downshift_point || kickdown_allowed || is_braking)) {
-            current_gear--;
-            last_downshift_time = now;
-            gear_shift_trigger = true;  // Trigger gear shift sound
-            rpm_settled_after_upshift = true;  // Downshift resets upshift settle requirement
-            ESP_LOGI(TAG, "Downshift to gear %d (RPM=%d, load=%d, braking=%d, kickdown=%d)",
-                     current_gear, current_rpm, engine_load, is_braking, kickdown_allowed ? 1 : 0);
+        if ((current_throttle_faded > effective_throttle || is_braking) && current_throttle_faded > 2) {
+            current_throttle_faded -= 2;
         }
-    }
 
-    // =========================================================================
-    // RPM CALCULATION
-    // =========================================================================
-
-    int16_t new_target_rpm;
-
-    if (is_braking && vehicle_speed < CLUTCH_ENGAGING_POINT) {
-        // Braking at very low speed - engine goes to idle
-        new_target_rpm = IDLE_RPM;
-    } else if (vehicle_speed < CLUTCH_ENGAGING_POINT && !is_braking) {
-        // Below clutch engaging point (not braking): RPM follows throttle
-        // This allows revving at low speed
-        new_target_rpm = IDLE_RPM + (effective_throttle * (MAX_RPM - IDLE_RPM) / 500);
-    } else {
-        // Above clutch engaging point OR braking: RPM based on vehicle speed and gear ratio
-        // RPM = speed * gear_ratio / 10
-        int16_t gear_ratio = gear_ratios[current_gear];
-        new_target_rpm = (vehicle_speed * gear_ratio / 10);
-
-        // Add torque converter slip only when accelerating (not braking)
-        if (!is_braking) {
-            int16_t converter_slip = 0;
-            if (current_gear <= 1) {
-                converter_slip = engine_load * 2;  // More slip in 1st/reverse
-            } else {
-                converter_slip = engine_load;
+        // Calculate throttle-dependent volumes (maps 0-500 throttle to volume range)
+        if (!is_braking && engine_state == ENGINE_RUNNING) {
+            // Map faded throttle to volume: idle% at 0, full% at 500
+            throttle_dependent_volume = ENGINE_IDLE_VOLUME_PCT +
+                (current_throttle_faded * (ENGINE_FULL_VOLUME_PCT - ENGINE_IDLE_VOLUME_PCT)) / 500;
+            throttle_dependent_rev_volume = REV_IDLE_VOLUME_PCT +
+                (current_throttle_faded * (REV_FULL_VOLUME_PCT - REV_IDLE_VOLUME_PCT)) / 500;
+        } else {
+            // When braking, gradually decrease volume
+            if (throttle_dependent_volume > ENGINE_IDLE_VOLUME_PCT) {
+                throttle_dependent_volume--;
+            }
+            if (throttle_dependent_rev_volume > REV_IDLE_VOLUME_PCT) {
+                throttle_dependent_rev_volume--;
             }
-            new_target_rpm += converter_slip;
-        }
-
-        // Ensure minimum idle RPM
-        if (new_target_rpm < IDLE_RPM) {
-            new_target_rpm = IDLE_RPM;
         }
     }
 
-    // Clamp to max RPM (max_rpm already calculated above)
-    if (new_target_rpm > max_rpm) {
-        new_target_rpm = max_rpm;
+    // Stamp large demand changes for the latency probe
+    if (abs((int)vehicle->target_rpm - (int)target_rpm) >= LATENCY_PROBE_RPM_STEP) {
+        latency_probe_pending = true;
     }
-
-    target_rpm = new_target_rpm;
+    target_rpm = vehicle->target_rpm;
 
     // =========================================================================
     // JAKE BRAKE DETECTION
@@ -1552,7 +2305,7 @@ void engine_sound_update(int16_t throttle, int16_t speed) {
     // Jake brake: active when braking OR coasting at high RPM while moving
     // This creates the engine braking sound
     bool coasting = throttle_neutral && vehicle_speed > 100;
-    if ((is_braking || coasting) && current_rpm > 200 && vehicle_speed > 100) {
+    if ((is_braking || coasting) && vehicle->rpm > 200 && vehicle_speed > 100) {
         jake_brake_active = config.jake_brake_enabled;
     } else {
         jake_brake_active = false;
@@ -1569,7 +2322,7 @@ void engine_sound_update(int16_t throttle, int16_t speed) {
 
     // Get motor cutoff in vehicle_speed scale (0-500 instead of 0-1000)
     int16_t motor_cutoff_scaled = tuning_get_motor_cutoff() / 2;
-    bool motor_stopped = tuning_is_motor_stopped();
+    bool motor_stopped = vehicle->motor_stopped;
 
     // Track peak speed while motor is running (not stopped)
     if (!motor_stopped && vehicle_speed > peak_vehicle_speed) {
@@ -1579,15 +2332,14 @@ void engine_sound_update(int16_t throttle, int16_t speed) {
     // Trigger air brake when motor crosses into "stopped" state from moving
     // This uses the ESC cutoff threshold for accurate timing
     bool motor_just_stopped = motor_stopped && !was_motor_stopped;
-    if (motor_just_stopped && peak_vehicle_speed > 100 && !air_brake_trigger) {
-        air_brake_trigger = true;
-        air_brake_sample_pos = 0;
-        // Generate random variation for this instance
-        air_brake_pitch_increment = generate_random_pitch_increment();
-        air_brake_volume_variation = generate_random_volume_variation();
-        air_brake_attack_samples = generate_random_attack_samples();
+    if (motor_just_stopped && peak_vehicle_speed > 100 && !voice_is_active(VOICE_AIR_BRAKE)) {
+#if CONFIG_CRAWLER_SOUND_AIR_BRAKE
+        // Random pitch/volume/attack variation for this instance
+        uint16_t attack = voice_start_oneshot(VOICE_AIR_BRAKE, effect_airBrakeSamples,
+                                              effect_airBrakeSampleCount, effect_airBrakeSampleRate);
         ESP_LOGI(TAG, "Air brake triggered (peak: %d, atk: %dms)",
-                 peak_vehicle_speed, air_brake_attack_samples * 1000 / ENGINE_SAMPLE_RATE);
+                 peak_vehicle_speed, attack * 1000 / AUDIO_SAMPLE_RATE);
+#endif
         peak_vehicle_speed = 0;  // Reset after triggering
     }
     was_motor_stopped = motor_stopped;
@@ -1595,7 +2347,7 @@ void engine_sound_update(int16_t throttle, int16_t speed) {
     // Reset peak tracking when accelerating again
     if (!motor_stopped && effective_throttle > 50) {
         peak_vehicle_speed = vehicle_speed;  // Reset to current, not zero
-    } else if (vehicle_speed < motor_cutoff_scaled && !air_brake_trigger) {
+    } else if (vehicle_speed < motor_cutoff_scaled && !voice_is_active(VOICE_AIR_BRAKE)) {
         // Reset after fully stopped
         peak_vehicle_speed = 0;
     }
@@ -1603,40 +2355,52 @@ void engine_sound_update(int16_t throttle, int16_t speed) {
     // Reverse beep: play when in reverse and engine is running
     // Reference: loops continuously while escInReverse is true
     if (in_reverse && engine_state == ENGINE_RUNNING) {
-        reverse_beep_playing = true;
+#if CONFIG_CRAWLER_SOUND_REVERSE_BEEP
+        if (!voice_is_active(VOICE_REVERSE_BEEP)) {
+            voice_start_loop(VOICE_REVERSE_BEEP, effect_reverseBeepSamples, SOUND_FORMAT_PCM8,
+                             effect_reverseBeepSampleRate, 0, effect_reverseBeepSampleCount);
+        }
+#endif
     } else {
-        reverse_beep_playing = false;
-        reverse_beep_sample_pos = 0;  // Reset for next time
-    }
-
-    // Gear shift clunk: trigger when gear_shift_trigger is set (already done in transmission logic)
-    // We reuse the existing gear_shift_trigger but for sound, not the RPM drop effect
-    if (gear_shift_trigger && !gear_shift_sound_trigger) {
-        gear_shift_sound_trigger = true;
-        gear_shift_sound_sample_pos = 0;
-        // Generate random variation for this instance
-        gear_shift_pitch_increment = generate_random_pitch_increment();
-        gear_shift_volume_variation = generate_random_volume_variation();
-        gear_shift_attack_samples = generate_random_attack_samples();
+        voice_stop(VOICE_REVERSE_BEEP);  // Restarts from the top next time
+    }
+
+    // Gear shift clunk: trigger when the vehicle model shifted
+    // (the mixer applies the power-cut effect from the published shift_seq)
+    // Use profile-specific sound if available, otherwise generic fallback
+    if (gear_shifted && !voice_is_active(VOICE_GEAR_SHIFT)) {
+        uint16_t attack = 0;
+        if (current_profile->shifting.samples != NULL) {
+            attack = voice_start_clip(VOICE_GEAR_SHIFT, &current_profile->shifting);
+        } else {
+#if CONFIG_CRAWLER_SOUND_GEAR_SHIFT
+            attack = voice_start_oneshot(VOICE_GEAR_SHIFT, effect_gearShiftSamples,
+                                         effect_gearShiftSampleCount, effect_gearShiftSampleRate);
+#endif
+        }
         ESP_LOGI(TAG, "Gear shift sound triggered (atk: %dms)",
-                 gear_shift_attack_samples * 1000 / ENGINE_SAMPLE_RATE);
+                 attack * 1000 / AUDIO_SAMPLE_RATE);
     }
 
     // Wastegate/blowoff: trigger after rapid throttle drop from high throttle
     // Triggers when throttle drops by >80 from a high value, with 1 second cooldown
     if (prev_throttle_for_wastegate > 150 &&
         prev_throttle_for_wastegate - effective_throttle > 80 &&
-        !wastegate_trigger &&
+        !voice_is_active(VOICE_WASTEGATE) &&
         (now - wastegate_lockout_time) > 1000) {
-        wastegate_trigger = true;
-        wastegate_sample_pos = 0;
         wastegate_lockout_time = now;
-        // Generate random variation for this instance
-        wastegate_pitch_increment = generate_random_pitch_increment();
-        wastegate_volume_variation = generate_random_volume_variation();
-        wastegate_attack_samples = generate_random_attack_samples();
+        // Use profile-specific sound if available, otherwise generic fallback
+        uint16_t attack = 0;
+        if (current_profile->wastegate.samples != NULL) {
+            attack = voice_start_clip(VOICE_WASTEGATE, &current_profile->wastegate);
+        } else {
+#if CONFIG_CRAWLER_SOUND_WASTEGATE
+            attack = voice_start_oneshot(VOICE_WASTEGATE, effect_wastegateSamples,
+                                         effect_wastegateSampleCount, effect_wastegateSampleRate);
+#endif
+        }
         ESP_LOGI(TAG, "Wastegate triggered (atk: %dms)",
-                 wastegate_attack_samples * 1000 / ENGINE_SAMPLE_RATE);
+                 attack * 1000 / AUDIO_SAMPLE_RATE);
         prev_throttle_for_wastegate = 0;  // Reset to prevent repeated triggers
     }
 
@@ -1650,17 +2414,9 @@ void engine_sound_update(int16_t throttle, int16_t speed) {
 
     last_throttle = effective_throttle;
 
-    // Debug logging
-    if (should_log) {
-        last_debug_log = now;
-        uint16_t dbg_max_rpm = (IDLE_RPM * config.max_rpm_percentage) / 100;
-        uint16_t dbg_rpm_range = dbg_max_rpm - IDLE_RPM;
-        int16_t dbg_upshift_base = IDLE_RPM + (dbg_rpm_range * 78 / 100);
-        int16_t dbg_upshift_max = IDLE_RPM + (dbg_rpm_range * 98 / 100);
-        int16_t upshift_pt = dbg_upshift_base + ((dbg_upshift_max - dbg_upshift_base) * engine_load / 180);
-        ESP_LOGI(TAG, "GEAR: g=%d rpm=%d(need>%d) load=%d spd=%d thr=%d brk=%d",
-                 current_gear, current_rpm, upshift_pt, engine_load, vehicle_speed,
-                 effective_throttle, is_braking ? 1 : 0);
+    // Publish this update's parameters to the mixer as one packet
+    if (publish_params(latency_probe_pending)) {
+        latency_probe_pending = false;  // Else retried with the next packet
     }
 }
 
@@ -1669,6 +2425,13 @@ void engine_sound_set_rpm(uint16_t rpm) {
     uint16_t max = (IDLE_RPM * config.max_rpm_percentage) / 100;
     if (rpm > max) rpm = max;
     target_rpm = rpm;
+    publish_params(false);
+}
+
+uint32_t engine_sound_take_latency_mark(void) {
+    uint32_t mark = latency_taken_us;
+    latency_taken_us = 0;
+    return mark;
 }
 
 uint16_t engine_sound_get_rpm(void) {
@@ -1702,39 +2465,42 @@ bool engine_sound_is_enabled(void) {
     return engine_enabled;
 }
 
+void engine_sound_set_muted(bool muted) {
+    engine_muted = muted;
+}
+
 void engine_sound_set_jake_brake(bool active) {
     jake_brake_active = active && config.jake_brake_enabled;
+    publish_params(false);
 }
 
 esp_err_t engine_sound_set_profile(sound_profile_t profile) {
-    if (profile >= SOUND_PROFILE_COUNT) {
+    if ((int)profile >= sound_profiles_count() || !sound_profiles_is_available(profile)) {
         ESP_LOGE(TAG, "Invalid profile: %d", profile);
         return ESP_ERR_INVALID_ARG;
     }
 
-    const sound_profile_def_t *new_profile = sound_profiles_get(profile);
-    if (!new_profile) {
+    if (!sound_profiles_get(profile)) {
         ESP_LOGE(TAG, "Failed to load profile: %d", profile);
         return ESP_FAIL;
     }
 
-    xSemaphoreTake(engine_mutex, portMAX_DELAY);
-
-    // Update profile
     config.profile = profile;
-    current_profile = new_profile;
-
-    // Update knock interval to match cylinder count
-    config.knock_interval = current_profile->cylinder_count;
 
-    // Reset sample positions
-    idle_sample_pos = 0;
-    rev_sample_pos = 0;
-    knock_sample_pos = 0;
-    jake_sample_pos = 0;
-    last_knock_pos = 0;
-    knock_counter = 0;
+    if (loader_task_handle != NULL) {
+        // Cached by the loader task, then crossfaded in by the mixer
+        __atomic_store_n(&requested_profile, (int)profile, __ATOMIC_SEQ_CST);
+        xTaskNotifyGive(loader_task_handle);
+        return ESP_OK;
+    }
 
+    // No loader task (host tools): load here and switch at once
+    xSemaphoreTake(engine_mutex, portMAX_DELAY);
+    current_profile = profile_cache_load(sound_profiles_get(profile));
+    config.knock_interval = current_profile->cylinder_count;
+    incoming_profile = NULL;
+    xfade_active = false;
+    layers_reset(&layer_sets[live_set], current_profile);
     xSemaphoreGive(engine_mutex);
 
     ESP_LOGI(TAG, "Switched to profile: %s", current_profile->name);
@@ -1745,31 +2511,22 @@ sound_profile_t engine_sound_get_profile(void) {
     return config.profile;
 }
 
-uint8_t engine_sound_get_gear(void) {
-    return current_gear;
-}
-
-int16_t engine_sound_get_load(void) {
-    return engine_load;
+void engine_sound_get_cache_info(engine_sound_cache_info_t *info) {
+    *info = cache_info;
 }
 
 void engine_sound_play_mode_switch(void) {
     // Trigger the air shift sound for mode change feedback
     // Only if engine is running (otherwise use beep from sound.c)
-    if (engine_state == ENGINE_RUNNING) {
-        mode_switch_trigger = true;
-        mode_switch_sample_pos = 0;
-        // Generate random variation for this instance
-        mode_switch_pitch_increment = generate_random_pitch_increment();
-        mode_switch_volume_variation = generate_random_volume_variation();
-        mode_switch_attack_samples = generate_random_attack_samples();
-    }
+    voice_start_mode_switch();
 }
 
 void engine_sound_set_horn(bool active) {
     if (active && !horn_active) {
-        // Starting horn - reset sample position
-        horn_sample_pos = 0;
+        voice_start_horn();  // Starts from the top with the current horn type
+        audio_mixer_wake();  // Horn can play with the engine off
+    } else if (!active) {
+        voice_stop(VOICE_HORN);
     }
     horn_active = active;
 }
@@ -1778,6 +2535,18 @@ bool engine_sound_is_horn_active(void) {
     return horn_active;
 }
 
+bool engine_sound_horn_available(horn_type_t type) {
+    if (type >= HORN_TYPE_COUNT) {
+        return false;
+    }
+    sound_pack_clip_t pack_clip;
+    return horn_clips[type].samples != NULL || sound_pack_find(horn_clips[type].pack_name, &pack_clip);
+}
+
+const char *engine_sound_horn_name(horn_type_t type) {
+    return type < HORN_TYPE_COUNT ? horn_clips[type].name : NULL;
+}
+
 uint8_t engine_sound_toggle_volume_level(void) {
     // Toggle between level 0 and 1
     config.active_volume_level = (config.active_volume_level == 0) ? 1 : 0;
@@ -1788,17 +2557,10 @@ uint8_t engine_sound_toggle_volume_level(void) {
 
     // Play a short confirmation beep
     // Use the mode switch sound if engine is running, otherwise use a simple beep
-    if (engine_state == ENGINE_RUNNING) {
-        mode_switch_trigger = true;
-        mode_switch_sample_pos = 0;
-        // Generate random variation for this instance
-        mode_switch_pitch_increment = generate_random_pitch_increment();
-        mode_switch_volume_variation = generate_random_volume_variation();
-        mode_switch_attack_samples = generate_random_attack_samples();
-    }
+    voice_start_mode_switch();
 
     // Save the new setting to NVS
-    nvs_save_sound_config(&config, sizeof(engine_sound_config_t));
+    nvs_storage_save_deferred(NVS_BLOB_SOUND, &config, sizeof(engine_sound_config_t));
 
     return config.active_volume_level;
 }
@@ -1822,7 +2584,7 @@ void engine_sound_set_volume_preset(uint8_t index) {
     config.master_volume_level1 = volume;
     config.master_volume_level2 = volume;
     // Save to NVS
-    nvs_save_sound_config(&config, sizeof(engine_sound_config_t));
+    nvs_storage_save_deferred(NVS_BLOB_SOUND, &config, sizeof(engine_sound_config_t));
     ESP_LOGI(TAG, "Volume set to preset %d (%d%%)", index, volume);
 }
 
@@ -1841,3 +2603,82 @@ uint8_t engine_sound_get_current_volume_preset_index(void) {
         return 1;  // Medium
     }
 }
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+#define BENCH_MIX_RPM   ((IDLE_RPM + MAX_RPM) / 2)  // Idle, rev and knock layers all audible
+
+typedef struct {
+    int32_t *acc;
+    size_t frames;
+    bool effects;
+    uint32_t horn_pos;
+    uint32_t brake_pos;
+} bench_mix_ctx_t;
+
+/**
+ * @brief One benchmark run: a block of engine (and effect) mixing
+ */
+static void bench_mix_run(void *arg) {
+    bench_mix_ctx_t *ctx = arg;
+
+    // Steady gains, as on a cruising engine
+    engine_gains_t gains = engine_gains(BENCH_MIX_RPM, ENGINE_FULL_VOLUME_PCT, REV_FULL_VOLUME_PCT);
+    memset(ctx->acc, 0, ctx->frames * sizeof(int32_t));
+    mix_engine_block(ctx->acc, ctx->frames, BENCH_MIX_RPM, BENCH_MIX_RPM, &gains, &gains);
+    if (ctx->effects) {
+        horn_type_t type = first_builtin_horn();
+        if (type < HORN_TYPE_COUNT) {
+            const horn_clip_t *horn = &horn_clips[type];
+            mix_loop_layer(ctx->acc, ctx->frames, horn->samples, *horn->loop_begin, *horn->loop_end,
+                           &ctx->horn_pos, clip_increment(0x10000, *horn->sample_rate),
+                           gain_const(config.horn_volume));
+        }
+#if CONFIG_CRAWLER_SOUND_AIR_BRAKE
+        if (!mix_oneshot_layer(ctx->acc, ctx->frames, effect_airBrakeSamples, effect_airBrakeSampleCount,
+                               &ctx->brake_pos, clip_increment(0x10000, effect_airBrakeSampleRate),
+                               gain_const(config.air_brake_volume), ATTACK_MIN_SAMPLES)) {
+            ctx->brake_pos = 0;
+        }
+#endif
+    }
+}
+
+esp_err_t engine_sound_bench_mix(sound_profile_t profile, bool effects, int32_t *acc,
+                                 size_t frames, uint32_t runs, bench_stat_t *stat) {
+    if (!engine_initialized || !sound_profiles_is_available(profile)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(engine_mutex, portMAX_DELAY);
+
+    // Refuse starts first, then check, so the mixer cannot pick up the engine mid-run
+    __atomic_store_n(&bench_active, true, __ATOMIC_SEQ_CST);
+    if (engine_state != ENGINE_OFF) {
+        __atomic_store_n(&bench_active, false, __ATOMIC_SEQ_CST);
+        xSemaphoreGive(engine_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // With the engine off the mixer does not render loops, so the kernels
+    // can be pointed at a layer set of their own
+    static engine_layers_t bench_layers;
+    engine_layers_t *saved_lay = lay;
+    const uint8_t saved_interval = config.knock_interval;
+
+    layers_reset(&bench_layers, profile == config.profile ? current_profile : sound_profiles_get(profile));
+    config.knock_interval = bench_layers.profile->cylinder_count;
+    lay = &bench_layers;
+
+    bench_mix_ctx_t ctx = { .acc = acc, .frames = frames, .effects = effects };
+    bench_measure(bench_mix_run, &ctx, runs, stat);
+
+    lay = saved_lay;
+    config.knock_interval = saved_interval;
+
+    __atomic_store_n(&bench_active, false, __ATOMIC_SEQ_CST);
+    xSemaphoreGive(engine_mutex);
+    return ESP_OK;
+}
@@ -17,7 +17,10 @@
 #include "esp_err.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "sounds/sound_profiles.h"
+#include "vehicle.h"
+#include "bench.h"
 
 /**
  * @brief Engine state machine
@@ -31,6 +34,9 @@ typedef enum {
 
 /**
  * @brief Horn type selection
+ *
+ * IDs are stored in NVS, so they stay fixed whichever horns the build
+ * compiles in; see engine_sound_horn_available().
  */
 typedef enum {
     HORN_TYPE_TRUCK = 0,    // Classic truck air horn
@@ -47,6 +53,15 @@ typedef enum {
 #define SOUND_CONFIG_MAGIC      0x534E4443  // "SNDC" in hex
 #define SOUND_CONFIG_VERSION    3           // Version 3: Added configurable volume presets
 
+/**
+ * @brief Active profile's loop sample cache
+ */
+typedef struct {
+    uint32_t bytes;                     // Loop sample bytes copied to RAM
+    uint32_t flash_bytes;               // Loop sample bytes still read from flash
+    bool psram;                         // Cache is in PSRAM (no internal SRAM left)
+} engine_sound_cache_info_t;
+
 /**
  * @brief Engine sound configuration
  */
@@ -86,7 +101,7 @@ typedef struct {
 
     // Flags
     bool jake_brake_enabled;            // Enable jake brake sound
-    bool v8_mode;                       // V8 firing pattern (pulses 4,8 louder)
+    bool v8_mode;                       // V8 accents (firings 4,8 louder) on profiles without a firing table
 
     // Sound effects settings
     bool air_brake_enabled;             // Enable air brake release sound
@@ -114,7 +129,8 @@ typedef struct {
 /**
  * @brief Initialize the engine sound system
  *
- * Must be called after sound_init() since it shares the I2S output.
+ * Loads config and profile; audio is rendered by the audio mixer task
+ * through engine_sound_render().
  *
  * @return ESP_OK on success
  */
@@ -127,6 +143,9 @@ esp_err_t engine_sound_deinit(void);
 
 /**
  * @brief Start the engine (plays start sound, transitions to running)
+ *
+ * Returns immediately; the mixer plays the start sound and moves the
+ * engine to ENGINE_RUNNING when it finishes.
  */
 esp_err_t engine_sound_start(void);
 
@@ -136,14 +155,41 @@ esp_err_t engine_sound_start(void);
 esp_err_t engine_sound_stop(void);
 
 /**
- * @brief Update engine sound based on throttle input
+ * @brief Render one block of engine audio (audio mixer task only)
+ *
+ * Advances the engine state machine (start sound, RPM, gear shift,
+ * shutdown) and adds the block into the mixer buses.
+ *
+ * @param engine_bus Accumulator for engine layers
+ * @param effects_bus Accumulator for effect voices (horn, air brake, ...)
+ * @param num_samples Block length (at most AUDIO_BLOCK_FRAMES)
+ * @return true if anything was rendered
+ */
+bool engine_sound_render(int32_t *engine_bus, int32_t *effects_bus, size_t num_samples);
+
+/**
+ * @brief Take the latency probe consumed by the last render (mixer task only)
  *
- * Call this from the main control loop at regular intervals (10-20ms).
+ * engine_sound_update() flags large RPM demand changes; the first block
+ * rendered afterwards hands the stamp over here so the mixer can time it
+ * to the I2S output.
  *
- * @param throttle Current throttle value (-1000 to +1000)
- * @param speed Current vehicle speed for clutch simulation (-1000 to +1000)
+ * @return esp_timer timestamp (us, low 32 bits) of the demand change, or 0
  */
-void engine_sound_update(int16_t throttle, int16_t speed);
+uint32_t engine_sound_take_latency_mark(void);
+
+/**
+ * @brief Update engine sound from this tick's vehicle state
+ *
+ * Call this from the main control loop after vehicle_update(). Gear,
+ * load, RPM demand and braking all come from the vehicle model.
+ * The resulting parameters are published to the mixer as one packet over
+ * a single-producer ring, so this (like engine_sound_set_rpm() and
+ * engine_sound_set_jake_brake()) must only be called from the control task.
+ *
+ * @param vehicle Vehicle state for this tick
+ */
+void engine_sound_update(const vehicle_state_t *vehicle);
 
 /**
  * @brief Set engine RPM directly (for testing)
@@ -184,6 +230,15 @@ void engine_sound_enable(bool enable);
  */
 bool engine_sound_is_enabled(void);
 
+/**
+ * @brief Fade the engine out (or back in) without stopping it
+ *
+ * Used while the menu speaks. The engine keeps running and follows the
+ * throttle underneath, so unmuting needs no restart.
+ * @param muted true to fade to silence over ENGINE_MUTE_FADE_MS
+ */
+void engine_sound_set_muted(bool muted);
+
 /**
  * @brief Set jake brake active state
  *
@@ -193,6 +248,10 @@ void engine_sound_set_jake_brake(bool active);
 
 /**
  * @brief Set sound profile
+ *
+ * Returns at once. A background task copies the new profile's loops to
+ * RAM, then the mixer crossfades to it over ENGINE_PROFILE_XFADE_MS while
+ * the engine keeps running (or swaps at once when it is off).
  * @param profile Profile to switch to
  * @return ESP_OK on success
  */
@@ -203,16 +262,6 @@ esp_err_t engine_sound_set_profile(sound_profile_t profile);
  */
 sound_profile_t engine_sound_get_profile(void);
 
-/**
- * @brief Get current gear (0=reverse, 1-3=forward gears)
- */
-uint8_t engine_sound_get_gear(void);
-
-/**
- * @brief Get current engine load (0-180)
- */
-int16_t engine_sound_get_load(void);
-
 /**
  * @brief Play mode switch sound (air shift sound)
  *
@@ -235,6 +284,21 @@ void engine_sound_set_horn(bool active);
  */
 bool engine_sound_is_horn_active(void);
 
+/**
+ * @brief Check whether a horn type can play
+ *
+ * True when the horn is compiled in (Kconfig "Crawler sound content") or
+ * the flashed sound pack provides it. The horn voice falls back to the
+ * first available horn when the configured one is not.
+ */
+bool engine_sound_horn_available(horn_type_t type);
+
+/**
+ * @brief Get the display name of a horn type
+ * @return Name, or NULL past the last horn type
+ */
+const char *engine_sound_horn_name(horn_type_t type);
+
 /**
  * @brief Toggle between master volume level 1 and 2
  *
@@ -245,6 +309,12 @@ bool engine_sound_is_horn_active(void);
  */
 uint8_t engine_sound_toggle_volume_level(void);
 
+/**
+ * @brief Get loop sample cache usage for the active profile
+ * @param info Filled with the current cache state
+ */
+void engine_sound_get_cache_info(engine_sound_cache_info_t *info);
+
 /**
  * @brief Get the current active master volume (from level 1 or 2)
  */
@@ -269,4 +339,21 @@ void engine_sound_set_volume_preset(uint8_t index);
  */
 uint8_t engine_sound_get_current_volume_preset_index(void);
 
+/**
+ * @brief Time mix_engine_samples() for one profile (engine must be off)
+ *
+ * Built-in profiles other than the active one are mixed straight from
+ * flash; the active one from its sample cache. Playback positions are
+ * restored afterwards and engine_sound_start() is refused meanwhile.
+ * @param profile Profile to mix
+ * @param effects Also mix the horn and an air brake one-shot
+ * @param acc Scratch accumulator of at least frames entries
+ * @param frames Frames per run
+ * @param runs Timed runs
+ * @param stat Receives cycles per run
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, or ESP_ERR_INVALID_STATE while the engine runs
+ */
+esp_err_t engine_sound_bench_mix(sound_profile_t profile, bool effects, int32_t *acc,
+                                 size_t frames, uint32_t runs, bench_stat_t *stat);
+
 #endif // ENGINE_SOUND_H
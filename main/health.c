@@ -0,0 +1,393 @@
+/**
+ * @file health.c
+ * @brief Per-task heartbeats, stall times and graded stall responses
+ *
+ * Beats are timestamps in esp_timer microseconds (32 bits, so gaps up to
+ * ~70 minutes are exact). The gap since the last beat is measured twice:
+ * by the beat itself, which gives the exact length of a stall that ended,
+ * and by the monitor every HEALTH_CHECK_MS, which sees a stall while it
+ * lasts and escalates the response. Each response runs once per stall.
+ *
+ * A health reset goes through esp_system_abort(), so the black box rescues
+ * its RTC ring as a panic; the stalled task and gap are kept in RTC memory
+ * as well and reported after the reboot.
+ */
+
+#include "health.h"
+#include "config.h"
+#include "perf.h"
+#include "pwm_output.h"
+#include "web_server.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_system.h"
+#include "esp_task_wdt.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+
+static const char *TAG = "HEALTH";
+
+#define HEALTH_RTC_MAGIC    0x48454C54  // "HELT"
+
+// Responses each task's stalls may escalate to
+#define GRADE_BIT(g)        (1u << (g))
+#define GRADES_LOG          (GRADE_BIT(HEALTH_GRADE_LATE))
+#define GRADES_SHED         (GRADES_LOG | GRADE_BIT(HEALTH_GRADE_SHED))
+#define GRADES_RESET        (GRADES_SHED | GRADE_BIT(HEALTH_GRADE_RESET))
+#define GRADES_ALL          (GRADES_RESET | GRADE_BIT(HEALTH_GRADE_FAILSAFE))
+
+typedef struct {
+    const char *name;
+    uint8_t grades;             // GRADE_BIT() of each allowed response
+} health_def_t;
+
+// The web UI, log sender and light strip only log: httpd is busy for the
+// whole of an OTA upload, and the other two are cosmetic
+static const health_def_t defs[HEALTH_TASK_COUNT] = {
+    [HEALTH_TASK_CONTROL]      = { "control",      GRADES_ALL },
+    [HEALTH_TASK_HOUSEKEEPING] = { "housekeeping", GRADES_RESET },
+    [HEALTH_TASK_AUDIO]        = { "audio",        GRADES_RESET },
+    [HEALTH_TASK_LIGHTS]       = { "lights",       GRADES_LOG },
+    [HEALTH_TASK_LOG]          = { "log",          GRADES_LOG },
+    [HEALTH_TASK_WEB]          = { "web",          GRADES_LOG },
+};
+
+static const char *const grade_names[] = {
+    [HEALTH_GRADE_OK]       = "ok",
+    [HEALTH_GRADE_LATE]     = "late",
+    [HEALTH_GRADE_SHED]     = "shed",
+    [HEALTH_GRADE_FAILSAFE] = "failsafe",
+    [HEALTH_GRADE_RESET]    = "reset",
+};
+
+typedef struct {
+    // Written by the beat (under health_lock)
+    bool watched;
+    uint32_t last_beat_us;
+    uint32_t period_us;
+    uint32_t beats;
+    uint32_t max_gap_us;        // Longest gap since boot
+    // Monitor only
+    uint8_t grade;              // Response reached by the current stall
+    uint8_t worst;              // Highest response since boot
+    uint32_t stalls;            // Gaps that reached HEALTH_GRADE_LATE
+    uint32_t stall_gap_us;      // Gap at the last check of the current stall
+} health_entry_t;
+
+static portMUX_TYPE health_lock = portMUX_INITIALIZER_UNLOCKED;
+static health_entry_t entries[HEALTH_TASK_COUNT];
+static TaskHandle_t monitor_handle = NULL;
+
+// Control stall failsafe (monitor writes, control task reads)
+static volatile bool failsafe_latched = false;
+static uint32_t failsafe_count = 0;
+static uint32_t control_ok_since_us = 0;
+static uint32_t output_trips = 0;   // Output deadline trips already logged
+
+// Stall that reset the board (survives the abort; garbage after power-on)
+typedef struct {
+    uint32_t magic;
+    uint32_t task;
+    uint32_t gap_ms;
+} health_rtc_t;
+
+static RTC_NOINIT_ATTR health_rtc_t rtc_reset;
+static int last_reset_task = -1;
+static uint32_t last_reset_gap_ms = 0;
+
+static inline uint32_t now_us(void)
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+void health_beat(health_task_t task, uint32_t period_us)
+{
+    if (task >= HEALTH_TASK_COUNT) {
+        return;
+    }
+    health_entry_t *e = &entries[task];
+
+    portENTER_CRITICAL(&health_lock);
+    uint32_t now = now_us();
+    if (e->watched) {
+        uint32_t gap = now - e->last_beat_us;
+        if (gap > e->max_gap_us) {
+            e->max_gap_us = gap;
+        }
+    }
+    e->last_beat_us = now;
+    e->period_us = period_us;
+    e->beats++;
+    e->watched = true;
+    portEXIT_CRITICAL(&health_lock);
+}
+
+void health_unwatch(health_task_t task)
+{
+    if (task >= HEALTH_TASK_COUNT) {
+        return;
+    }
+    portENTER_CRITICAL(&health_lock);
+    entries[task].watched = false;
+    portEXIT_CRITICAL(&health_lock);
+}
+
+bool health_failsafe_active(void)
+{
+    return failsafe_latched;
+}
+
+const char *health_task_name(health_task_t task)
+{
+    return task < HEALTH_TASK_COUNT ? defs[task].name : "?";
+}
+
+/**
+ * @brief Response a gap calls for, limited to what the task allows
+ */
+static health_grade_t grade_for(health_task_t task, uint32_t gap_us, uint32_t period_us)
+{
+    uint32_t late_us = HEALTH_LATE_PERIODS * period_us;
+    if (late_us < HEALTH_LATE_MIN_MS * 1000) {
+        late_us = HEALTH_LATE_MIN_MS * 1000;
+    }
+    if (gap_us <= late_us) {
+        return HEALTH_GRADE_OK;
+    }
+
+    static const uint32_t limit_ms[] = {
+        [HEALTH_GRADE_SHED]     = HEALTH_SHED_MS,
+        [HEALTH_GRADE_FAILSAFE] = HEALTH_FAILSAFE_MS,
+        [HEALTH_GRADE_RESET]    = HEALTH_RESET_MS,
+    };
+    health_grade_t grade = HEALTH_GRADE_LATE;
+    for (int g = HEALTH_GRADE_SHED; g <= HEALTH_GRADE_RESET; g++) {
+        if ((defs[task].grades & GRADE_BIT(g)) && gap_us > limit_ms[g] * 1000) {
+            grade = (health_grade_t)g;
+        }
+    }
+    return grade;
+}
+
+/**
+ * @brief Run the response for one grade (once per stall)
+ */
+static void respond(health_task_t task, health_grade_t grade, uint32_t gap_us)
+{
+    const char *name = defs[task].name;
+
+    switch (grade) {
+        case HEALTH_GRADE_LATE:
+            entries[task].stalls++;
+            break;
+
+        case HEALTH_GRADE_SHED:
+            perf_report_stall();
+            break;
+
+        case HEALTH_GRADE_FAILSAFE:
+            // The control task is not running, so nothing else writes the ESC;
+            // the servos hold their last pulse in hardware
+            ESP_LOGE(TAG, "%s stalled %lu ms - ESC to neutral", name, (unsigned long)(gap_us / 1000));
+            esc_set_neutral();
+            failsafe_latched = true;
+            failsafe_count++;
+            break;
+
+        case HEALTH_GRADE_RESET: {
+            static char reason[48];
+            ESP_LOGE(TAG, "%s stalled %lu ms - resetting", name, (unsigned long)(gap_us / 1000));
+            esc_set_neutral();
+            rtc_reset.task = task;
+            rtc_reset.gap_ms = gap_us / 1000;
+            rtc_reset.magic = HEALTH_RTC_MAGIC;
+            snprintf(reason, sizeof(reason), "%s task stalled", name);
+            esp_system_abort(reason);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Measure one task's current gap and escalate or close its stall
+ */
+static void check_task(health_task_t task)
+{
+    health_entry_t *e = &entries[task];
+
+    portENTER_CRITICAL(&health_lock);
+    bool watched = e->watched;
+    uint32_t now = now_us();
+    uint32_t gap = now - e->last_beat_us;
+    uint32_t period = e->period_us;
+    if (watched && gap > e->max_gap_us) {
+        e->max_gap_us = gap;
+    }
+    portEXIT_CRITICAL(&health_lock);
+
+    if (!watched) {
+        e->grade = HEALTH_GRADE_OK;     // Stopped, possibly mid-stall
+        return;
+    }
+
+    health_grade_t grade = grade_for(task, gap, period);
+    if (grade > e->grade) {
+        for (int g = e->grade + 1; g <= (int)grade; g++) {
+            if (defs[task].grades & GRADE_BIT(g)) {
+                respond(task, (health_grade_t)g, gap);
+            }
+        }
+        e->grade = grade;
+        if (grade > e->worst) {
+            e->worst = grade;
+        }
+    } else if (grade == HEALTH_GRADE_OK && e->grade != HEALTH_GRADE_OK) {
+        // Beating again: the stall lasted at least as long as last seen
+        ESP_LOGW(TAG, "%s stalled %lu ms (period %lu us, %s)", defs[task].name,
+                 (unsigned long)(e->stall_gap_us / 1000), (unsigned long)period,
+                 grade_names[e->grade]);
+        e->grade = HEALTH_GRADE_OK;
+        if (task == HEALTH_TASK_CONTROL) {
+            control_ok_since_us = now;
+        }
+    }
+    if (grade != HEALTH_GRADE_OK) {
+        e->stall_gap_us = gap;
+    }
+}
+
+/**
+ * @brief Monitor task: check every watched task each HEALTH_CHECK_MS
+ *
+ * Subscribed to the task watchdog, which covers a stalled monitor.
+ */
+static void health_task(void *arg)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    uint32_t last_probe_us = now_us();
+    (void)arg;
+
+    ESP_ERROR_CHECK(esp_task_wdt_add(NULL));
+
+    while (1) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(HEALTH_CHECK_MS));
+
+        for (int t = 0; t < HEALTH_TASK_COUNT; t++) {
+            check_task((health_task_t)t);
+        }
+
+        // Lift the failsafe once control has kept time for a while
+        if (failsafe_latched && entries[HEALTH_TASK_CONTROL].grade == HEALTH_GRADE_OK &&
+            now_us() - control_ok_since_us >= HEALTH_RECOVER_MS * 1000) {
+            ESP_LOGI(TAG, "control keeping time again - failsafe released");
+            failsafe_latched = false;
+        }
+
+        // The output deadline trips in the ESC timer ISR, so it is logged here
+        uint32_t trips = pwm_output_deadline_trips();
+        if (trips != output_trips) {
+            ESP_LOGE(TAG, "No output frame for %d ms - motor outputs forced to neutral", OUTPUT_DEADLINE_MS);
+            output_trips = trips;
+        }
+
+        // httpd only runs handlers and queued jobs, so hand it one that beats
+        if (now_us() - last_probe_us >= HEALTH_WEB_PROBE_MS * 1000) {
+            last_probe_us = now_us();
+            web_server_health_probe();
+        }
+
+        esp_task_wdt_reset();
+    }
+}
+
+esp_err_t health_init(void)
+{
+    if (monitor_handle != NULL) {
+        return ESP_OK;
+    }
+
+    if (rtc_reset.magic == HEALTH_RTC_MAGIC && rtc_reset.task < HEALTH_TASK_COUNT) {
+        last_reset_task = rtc_reset.task;
+        last_reset_gap_ms = rtc_reset.gap_ms;
+        ESP_LOGW(TAG, "Last reset: %s task stalled %lu ms", defs[last_reset_task].name,
+                 (unsigned long)last_reset_gap_ms);
+    }
+    rtc_reset.magic = 0;
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        health_task,
+        "health",
+        HEALTH_TASK_STACK_SIZE,
+        NULL,
+        HEALTH_TASK_PRIORITY,
+        &monitor_handle,
+        HEALTH_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create health monitor task");
+        monitor_handle = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Health monitor started (%dms checks, failsafe %dms, reset %dms)",
+             HEALTH_CHECK_MS, HEALTH_FAILSAFE_MS, HEALTH_RESET_MS);
+    return ESP_OK;
+}
+
+int health_to_json(char *buf, size_t len)
+{
+    size_t pos = 0;
+    int n = snprintf(buf, len, "{\"failsafe\":%s,\"failsafes\":%lu,\"outputTrips\":%lu,\"lastReset\":",
+                     failsafe_latched ? "true" : "false", (unsigned long)failsafe_count,
+                     (unsigned long)pwm_output_deadline_trips());
+    pos = (n < 0) ? len : (size_t)n;
+
+    if (pos < len) {
+        if (last_reset_task >= 0) {
+            n = snprintf(buf + pos, len - pos, "{\"task\":\"%s\",\"gapMs\":%lu}",
+                         defs[last_reset_task].name, (unsigned long)last_reset_gap_ms);
+        } else {
+            n = snprintf(buf + pos, len - pos, "null");
+        }
+        pos = (n < 0) ? len : pos + n;
+    }
+    if (pos < len) {
+        n = snprintf(buf + pos, len - pos, ",\"tasks\":[");
+        pos = (n < 0) ? len : pos + n;
+    }
+
+    bool first = true;
+    for (int t = 0; t < HEALTH_TASK_COUNT && pos < len; t++) {
+        health_entry_t *e = &entries[t];
+
+        portENTER_CRITICAL(&health_lock);
+        bool watched = e->watched;
+        uint32_t gap = now_us() - e->last_beat_us;
+        uint32_t period = e->period_us;
+        uint32_t beats = e->beats;
+        uint32_t max_gap = e->max_gap_us;
+        portEXIT_CRITICAL(&health_lock);
+
+        if (!watched) {
+            continue;
+        }
+        n = snprintf(buf + pos, len - pos,
+                     "%s{\"name\":\"%s\",\"periodUs\":%lu,\"gapUs\":%lu,\"maxGapUs\":%lu,"
+                     "\"beats\":%lu,\"stalls\":%lu,\"grade\":\"%s\",\"worst\":\"%s\"}",
+                     first ? "" : ",", defs[t].name, (unsigned long)period,
+                     (unsigned long)gap, (unsigned long)max_gap, (unsigned long)beats,
+                     (unsigned long)e->stalls, grade_names[e->grade], grade_names[e->worst]);
+        pos = (n < 0) ? len : pos + n;
+        first = false;
+    }
+    if (pos < len) {
+        n = snprintf(buf + pos, len - pos, "]}");
+        pos = (n < 0) ? len : pos + n;
+    }
+    return (int)pos;
+}
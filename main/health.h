@@ -0,0 +1,95 @@
+/**
+ * @file health.h
+ * @brief Per-task heartbeats, stall times and graded stall responses
+ *
+ * Each watched task calls health_beat() once per loop with the period it is
+ * currently running at. A monitor task on core 0 measures the gap since each
+ * task's last beat and, as a stall grows, logs it, feeds the degraded-mode
+ * scheduler (perf_report_stall()), puts the car in failsafe when the control
+ * loop is the one stalled, and finally resets the board. The longest gap
+ * per task since boot is kept, so intermittent stalls show up in /api/tasks
+ * long before they grow into watchdog resets.
+ *
+ * A task is watched from its first beat; tasks that never start (no lights
+ * strip, sound init failed, WiFi never enabled) are left out. The httpd
+ * task has no loop of its own, so the monitor queues a no-op job to it
+ * every HEALTH_WEB_PROBE_MS and the job beats when it runs.
+ */
+
+#ifndef HEALTH_H
+#define HEALTH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/**
+ * @brief Watched tasks
+ */
+typedef enum {
+    HEALTH_TASK_CONTROL = 0,    // RC -> mixing -> outputs
+    HEALTH_TASK_HOUSEKEEPING,   // Auto-WiFi, LED, web status
+    HEALTH_TASK_AUDIO,          // Audio mixer (renders the engine sound)
+    HEALTH_TASK_LIGHTS,         // Light strip frames
+    HEALTH_TASK_LOG,            // UDP log and telemetry sender
+    HEALTH_TASK_WEB,            // httpd (probed)
+    HEALTH_TASK_COUNT
+} health_task_t;
+
+/**
+ * @brief Stall response reached, in escalation order
+ */
+typedef enum {
+    HEALTH_GRADE_OK = 0,
+    HEALTH_GRADE_LATE,          // Logged
+    HEALTH_GRADE_SHED,          // Reported to the degraded-mode scheduler
+    HEALTH_GRADE_FAILSAFE,      // ESC at neutral, servos held (control only)
+    HEALTH_GRADE_RESET,         // Board reset
+} health_grade_t;
+
+/**
+ * @brief Start the monitor task
+ * @return ESP_OK, ESP_ERR_NO_MEM
+ */
+esp_err_t health_init(void);
+
+/**
+ * @brief Publish a heartbeat from a watched task
+ * @param task Calling task
+ * @param period_us Loop period the task is running at now
+ */
+void health_beat(health_task_t task, uint32_t period_us);
+
+/**
+ * @brief Stop watching a task that is being shut down
+ *
+ * Its next beat, if it is started again, watches it afresh.
+ */
+void health_unwatch(health_task_t task);
+
+/**
+ * @brief Check whether a control stall is holding the car in failsafe
+ *
+ * Stays set until the control loop has beaten on time for
+ * HEALTH_RECOVER_MS, so control_process() keeps the outputs parked
+ * meanwhile, as for a lost signal.
+ */
+bool health_failsafe_active(void);
+
+/**
+ * @brief Get short name of a watched task (used as JSON key)
+ * @param task Task
+ * @return Name string
+ */
+const char *health_task_name(health_task_t task);
+
+/**
+ * @brief Format period, current and longest stall per task as a JSON object
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Characters written (as snprintf)
+ */
+int health_to_json(char *buf, size_t len);
+
+#endif // HEALTH_H
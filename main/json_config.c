@@ -0,0 +1,287 @@
+/**
+ * @file json_config.c
+ * @brief Allocation-free JSON object walker and config field tables
+ */
+
+#include "json_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    const char *p;
+    const char *end;
+} json_cursor_t;
+
+static void skip_ws(json_cursor_t *c)
+{
+    while (c->p < c->end && (*c->p == ' ' || *c->p == '\t' || *c->p == '\n' || *c->p == '\r')) {
+        c->p++;
+    }
+}
+
+/**
+ * @brief Scan a string starting at the opening quote
+ * @return false if it is not terminated
+ */
+static bool scan_string(json_cursor_t *c, const char **start, size_t *len)
+{
+    c->p++;     // Opening quote
+    *start = c->p;
+    while (c->p < c->end && *c->p != '"') {
+        if (*c->p == '\\') {
+            c->p++;
+        }
+        c->p++;
+    }
+    if (c->p >= c->end) {
+        return false;
+    }
+    *len = (size_t)(c->p - *start);
+    c->p++;     // Closing quote
+    return true;
+}
+
+/**
+ * @brief Skip an object or array starting at its opening bracket
+ */
+static bool skip_nested(json_cursor_t *c)
+{
+    int depth = 0;
+    while (c->p < c->end) {
+        char ch = *c->p;
+        if (ch == '"') {
+            const char *s;
+            size_t n;
+            if (!scan_string(c, &s, &n)) return false;
+            continue;
+        }
+        if (ch == '{' || ch == '[') {
+            depth++;
+        } else if (ch == '}' || ch == ']') {
+            if (--depth == 0) {
+                c->p++;
+                return true;
+            }
+        }
+        c->p++;
+    }
+    return false;
+}
+
+/**
+ * @brief Parse a number (fraction and exponent are accepted and dropped)
+ */
+static bool scan_number(json_cursor_t *c, int32_t *out)
+{
+    bool neg = false;
+    int64_t v = 0;
+    const char *digits;
+
+    if (*c->p == '-') {
+        neg = true;
+        c->p++;
+    }
+    digits = c->p;
+    while (c->p < c->end && *c->p >= '0' && *c->p <= '9') {
+        if (v <= INT32_MAX) {
+            v = v * 10 + (*c->p - '0');
+        }
+        c->p++;
+    }
+    if (c->p == digits) {
+        return false;
+    }
+    if (c->p < c->end && *c->p == '.') {
+        c->p++;
+        while (c->p < c->end && *c->p >= '0' && *c->p <= '9') c->p++;
+    }
+    if (c->p < c->end && (*c->p == 'e' || *c->p == 'E')) {
+        c->p++;
+        if (c->p < c->end && (*c->p == '+' || *c->p == '-')) c->p++;
+        while (c->p < c->end && *c->p >= '0' && *c->p <= '9') c->p++;
+    }
+
+    if (neg) v = -v;
+    if (v > INT32_MAX) v = INT32_MAX;
+    if (v < INT32_MIN) v = INT32_MIN;
+    *out = (int32_t)v;
+    return true;
+}
+
+/**
+ * @brief Match a literal keyword
+ */
+static bool scan_literal(json_cursor_t *c, const char *word)
+{
+    size_t n = strlen(word);
+    if ((size_t)(c->end - c->p) < n || memcmp(c->p, word, n) != 0) {
+        return false;
+    }
+    c->p += n;
+    return true;
+}
+
+static bool scan_value(json_cursor_t *c, json_value_t *v)
+{
+    memset(v, 0, sizeof(*v));
+    if (c->p >= c->end) {
+        return false;
+    }
+
+    switch (*c->p) {
+        case '"':
+            v->type = JSON_VALUE_STRING;
+            return scan_string(c, &v->str, &v->str_len);
+        case '{':
+        case '[': {
+            const char *start = c->p;
+            v->type = JSON_VALUE_NESTED;
+            if (!skip_nested(c)) return false;
+            v->str = start;
+            v->str_len = (size_t)(c->p - start);
+            return true;
+        }
+        case 't':
+            v->type = JSON_VALUE_BOOL;
+            v->number = 1;
+            return scan_literal(c, "true");
+        case 'f':
+            v->type = JSON_VALUE_BOOL;
+            return scan_literal(c, "false");
+        case 'n':
+            v->type = JSON_VALUE_NULL;
+            return scan_literal(c, "null");
+        default:
+            v->type = JSON_VALUE_NUMBER;
+            return scan_number(c, &v->number);
+    }
+}
+
+int json_walk_object(const char *json, size_t len, json_member_cb_t cb, void *ctx)
+{
+    json_cursor_t c = { json, json + len };
+    int members = 0;
+
+    skip_ws(&c);
+    if (c.p >= c.end || *c.p != '{') return -1;
+    c.p++;
+    skip_ws(&c);
+    if (c.p < c.end && *c.p == '}') {
+        return 0;
+    }
+
+    while (c.p < c.end) {
+        const char *key;
+        size_t key_len;
+        json_value_t value;
+
+        if (*c.p != '"' || !scan_string(&c, &key, &key_len)) return -1;
+        skip_ws(&c);
+        if (c.p >= c.end || *c.p != ':') return -1;
+        c.p++;
+        skip_ws(&c);
+        if (!scan_value(&c, &value)) return -1;
+        if (cb && !cb(key, key_len, &value, ctx)) return -1;
+        members++;
+
+        skip_ws(&c);
+        if (c.p >= c.end) return -1;
+        if (*c.p == '}') return members;
+        if (*c.p != ',') return -1;
+        c.p++;
+        skip_ws(&c);
+    }
+    return -1;
+}
+
+const json_field_t *json_find_field(const json_field_t *fields, size_t count,
+                                    const char *key, size_t key_len)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (strncmp(fields[i].key, key, key_len) == 0 && fields[i].key[key_len] == '\0') {
+            return &fields[i];
+        }
+    }
+    return NULL;
+}
+
+bool json_field_store(const json_field_t *field, void *config, const json_value_t *value)
+{
+    uint8_t *dst = (uint8_t *)config + field->offset;
+    int32_t v = value->number;
+
+    if (field->kind == JSON_FIELD_BOOL) {
+        if (value->type != JSON_VALUE_BOOL && value->type != JSON_VALUE_NUMBER) return false;
+        *(bool *)dst = v != 0;
+        return true;
+    }
+    if (value->type != JSON_VALUE_NUMBER) {
+        return false;
+    }
+
+    if (field->kind == JSON_FIELD_UINT) {
+        uint32_t max = field->size >= 4 ? UINT32_MAX : (1u << (field->size * 8)) - 1;
+        uint32_t u = v < 0 ? 0 : (uint32_t)v;
+        if (u > max) u = max;
+        switch (field->size) {
+            case 1: *(uint8_t *)dst = (uint8_t)u; break;
+            case 2: *(uint16_t *)dst = (uint16_t)u; break;
+            default: *(uint32_t *)dst = u; break;
+        }
+    } else {
+        int32_t max = field->size >= 4 ? INT32_MAX : (1 << (field->size * 8 - 1)) - 1;
+        int32_t min = -max - 1;
+        if (v > max) v = max;
+        if (v < min) v = min;
+        switch (field->size) {
+            case 1: *(int8_t *)dst = (int8_t)v; break;
+            case 2: *(int16_t *)dst = (int16_t)v; break;
+            default: *(int32_t *)dst = v; break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Read a config member as a signed 64-bit value
+ */
+static int64_t field_load(const json_field_t *field, const void *config)
+{
+    const uint8_t *src = (const uint8_t *)config + field->offset;
+
+    if (field->kind == JSON_FIELD_BOOL) {
+        return *(const bool *)src ? 1 : 0;
+    }
+    if (field->kind == JSON_FIELD_UINT) {
+        switch (field->size) {
+            case 1: return *(const uint8_t *)src;
+            case 2: return *(const uint16_t *)src;
+            default: return *(const uint32_t *)src;
+        }
+    }
+    switch (field->size) {
+        case 1: return *(const int8_t *)src;
+        case 2: return *(const int16_t *)src;
+        default: return *(const int32_t *)src;
+    }
+}
+
+size_t json_write_fields(char *out, size_t size, size_t len,
+                         const json_field_t *fields, size_t count, const void *config)
+{
+    for (size_t i = 0; i < count && len < size; i++) {
+        const json_field_t *f = &fields[i];
+        const char *sep = (len > 0 && out[len - 1] != '{') ? "," : "";
+        int n;
+        if (f->kind == JSON_FIELD_BOOL) {
+            n = snprintf(out + len, size - len, "%s\"%s\":%s", sep, f->key,
+                         field_load(f, config) ? "true" : "false");
+        } else {
+            n = snprintf(out + len, size - len, "%s\"%s\":%lld", sep, f->key,
+                         (long long)field_load(f, config));
+        }
+        len = (n < 0 || (size_t)n >= size - len) ? size : len + (size_t)n;
+    }
+    return len;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file json_config.h
+ * @brief Allocation-free JSON object walker and config field tables
+ *
+ * The config APIs describe each JSON key once, as a json_field_t naming
+ * the struct member it maps to. The same table parses a request body in a
+ * single pass (only the keys present are written, so a body can update one
+ * field) and serializes the GET response.
+ */
+
+#ifndef JSON_CONFIG_H
+#define JSON_CONFIG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief Storage of a config member
+ */
+typedef enum {
+    JSON_FIELD_UINT = 0,        // uint8_t/uint16_t/uint32_t or enum
+    JSON_FIELD_INT,             // int8_t/int16_t/int32_t
+    JSON_FIELD_BOOL,
+} json_field_kind_t;
+
+/**
+ * @brief One JSON key mapped to a config member
+ */
+typedef struct {
+    const char *key;
+    uint16_t offset;
+    uint8_t size;
+    uint8_t kind;               // json_field_kind_t
+} json_field_t;
+
+#define JSON_FIELD(kind, type, member, key) \
+    { (key), offsetof(type, member), sizeof(((type *)0)->member), (kind) }
+#define JSON_UINT(type, member, key)    JSON_FIELD(JSON_FIELD_UINT, type, member, key)
+#define JSON_INT(type, member, key)     JSON_FIELD(JSON_FIELD_INT, type, member, key)
+#define JSON_BOOL(type, member, key)    JSON_FIELD(JSON_FIELD_BOOL, type, member, key)
+
+/**
+ * @brief Scalar value of an object member
+ */
+typedef enum {
+    JSON_VALUE_NUMBER = 0,      // Integer part (fraction and exponent ignored)
+    JSON_VALUE_BOOL,
+    JSON_VALUE_NULL,
+    JSON_VALUE_STRING,          // Raw contents between the quotes, escapes kept
+    JSON_VALUE_NESTED,          // Object or array, skipped
+} json_value_type_t;
+
+typedef struct {
+    json_value_type_t type;
+    int32_t number;             // NUMBER (saturated), BOOL (0/1)
+    const char *str;            // STRING contents / NESTED text
+    size_t str_len;
+} json_value_t;
+
+/**
+ * @brief Called for each member of the top-level object
+ * @return false to stop with an error
+ */
+typedef bool (*json_member_cb_t)(const char *key, size_t key_len, const json_value_t *value, void *ctx);
+
+/**
+ * @brief Walk the members of a JSON object once
+ * @param json Body (need not be NUL-terminated)
+ * @param len Length of json
+ * @return Number of members, or -1 if the body is not a valid object or cb failed
+ */
+int json_walk_object(const char *json, size_t len, json_member_cb_t cb, void *ctx);
+
+/**
+ * @brief Look up a key in a field table
+ * @return Field, or NULL if the key is not in the table
+ */
+const json_field_t *json_find_field(const json_field_t *fields, size_t count,
+                                    const char *key, size_t key_len);
+
+/**
+ * @brief Store a value into a config member, saturating to its range
+ * @return false if the value has the wrong type for the field
+ */
+bool json_field_store(const json_field_t *field, void *config, const json_value_t *value);
+
+/**
+ * @brief Append "key":value pairs for every field, comma separated
+ * @param out Buffer
+ * @param size Size of out
+ * @param len Bytes already used in out (a comma is added first if non-zero
+ *            and the previous character is not '{')
+ * @return New length, or size if the buffer is full
+ */
+size_t json_write_fields(char *out, size_t size, size_t len,
+                         const json_field_t *fields, size_t count, const void *config);
+
+#endif // JSON_CONFIG_H
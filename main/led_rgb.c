@@ -5,23 +5,17 @@
 
 #include "led_rgb.h"
 #include "config.h"
-#include "driver/rmt_tx.h"
+#include "ws2812.h"
 #include "freertos/FreeRTOS.h"
 #include "esp_log.h"
+#include "esp_attr.h"
 #include "esp_random.h"
 #include <string.h>
 
 static const char *TAG = "LED_RGB";
 
-// WS2812 timing (in RMT ticks at 10MHz resolution)
-#define WS2812_T0H_TICKS    3   // 0.3us
-#define WS2812_T0L_TICKS    9   // 0.9us
-#define WS2812_T1H_TICKS    9   // 0.9us
-#define WS2812_T1L_TICKS    3   // 0.3us
-#define WS2812_RESET_TICKS  500 // 50us reset
-
-// RMT resolution
-#define RMT_RESOLUTION_HZ   10000000  // 10MHz = 0.1us resolution
+// Frames queued in the RMT driver; each needs its own buffer until sent
+#define LED_TX_QUEUE_DEPTH  4
 
 // Animation timing (at 100Hz update rate)
 #define BREATHE_PERIOD      200     // 2 seconds per breathe cycle
@@ -44,115 +38,24 @@ static uint8_t brightness = 50;  // Default 50% brightness
 static uint32_t animation_tick = 0;
 static bool initialized = false;
 
-// WS2812 encoder
-typedef struct {
-    rmt_encoder_t base;
-    rmt_encoder_t *bytes_encoder;
-    rmt_encoder_t *copy_encoder;
-    int state;
-    rmt_symbol_word_t reset_code;
-} ws2812_encoder_t;
-
-// Encoder callbacks
-static size_t ws2812_encode(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
-                            const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
-{
-    ws2812_encoder_t *ws2812_encoder = __containerof(encoder, ws2812_encoder_t, base);
-    rmt_encoder_handle_t bytes_encoder = ws2812_encoder->bytes_encoder;
-    rmt_encoder_handle_t copy_encoder = ws2812_encoder->copy_encoder;
-    rmt_encode_state_t session_state = RMT_ENCODING_RESET;
-    size_t encoded_symbols = 0;
-
-    switch (ws2812_encoder->state) {
-        case 0: // Send RGB data
-            encoded_symbols += bytes_encoder->encode(bytes_encoder, channel, primary_data, data_size, &session_state);
-            if (session_state & RMT_ENCODING_COMPLETE) {
-                ws2812_encoder->state = 1;
-            }
-            if (session_state & RMT_ENCODING_MEM_FULL) {
-                *ret_state = (rmt_encode_state_t)(session_state & (~RMT_ENCODING_COMPLETE));
-                return encoded_symbols;
-            }
-            // Fall through
-        case 1: // Send reset code
-            encoded_symbols += copy_encoder->encode(copy_encoder, channel, &ws2812_encoder->reset_code,
-                                                     sizeof(ws2812_encoder->reset_code), &session_state);
-            if (session_state & RMT_ENCODING_COMPLETE) {
-                ws2812_encoder->state = RMT_ENCODING_RESET;
-                *ret_state = RMT_ENCODING_COMPLETE;
-            }
-            if (session_state & RMT_ENCODING_MEM_FULL) {
-                *ret_state = (rmt_encode_state_t)(session_state & (~RMT_ENCODING_COMPLETE));
-            }
-            break;
-    }
-    return encoded_symbols;
-}
-
-static esp_err_t ws2812_encoder_reset(rmt_encoder_t *encoder)
-{
-    ws2812_encoder_t *ws2812_encoder = __containerof(encoder, ws2812_encoder_t, base);
-    rmt_encoder_reset(ws2812_encoder->bytes_encoder);
-    rmt_encoder_reset(ws2812_encoder->copy_encoder);
-    ws2812_encoder->state = RMT_ENCODING_RESET;
-    return ESP_OK;
-}
-
-static esp_err_t ws2812_encoder_del(rmt_encoder_t *encoder)
-{
-    ws2812_encoder_t *ws2812_encoder = __containerof(encoder, ws2812_encoder_t, base);
-    rmt_del_encoder(ws2812_encoder->bytes_encoder);
-    rmt_del_encoder(ws2812_encoder->copy_encoder);
-    free(ws2812_encoder);
-    return ESP_OK;
-}
-
-static esp_err_t create_ws2812_encoder(rmt_encoder_handle_t *ret_encoder)
+// Fire-and-forget transmit state. Frames are only queued while a driver
+// slot is free, so rmt_transmit() never blocks the caller; a skipped frame
+// is resent on the next update because last_grb is left unchanged.
+static uint8_t tx_buffers[LED_TX_QUEUE_DEPTH][3];
+static uint32_t tx_next = 0;
+static volatile uint32_t tx_in_flight = 0;
+static uint8_t last_grb[3];
+static bool last_valid = false;
+
+// RMT transmit-done callback: frees a queue slot (ISR context)
+static bool IRAM_ATTR led_tx_done(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata,
+                                  void *user_ctx)
 {
-    ws2812_encoder_t *ws2812_encoder = calloc(1, sizeof(ws2812_encoder_t));
-    if (!ws2812_encoder) {
-        return ESP_ERR_NO_MEM;
-    }
-
-    ws2812_encoder->base.encode = ws2812_encode;
-    ws2812_encoder->base.reset = ws2812_encoder_reset;
-    ws2812_encoder->base.del = ws2812_encoder_del;
-
-    // Create bytes encoder for the LED data
-    rmt_bytes_encoder_config_t bytes_encoder_config = {
-        .bit0 = {
-            .level0 = 1,
-            .duration0 = WS2812_T0H_TICKS,
-            .level1 = 0,
-            .duration1 = WS2812_T0L_TICKS,
-        },
-        .bit1 = {
-            .level0 = 1,
-            .duration0 = WS2812_T1H_TICKS,
-            .level1 = 0,
-            .duration1 = WS2812_T1L_TICKS,
-        },
-        .flags.msb_first = true,
-    };
-    ESP_ERROR_CHECK(rmt_new_bytes_encoder(&bytes_encoder_config, &ws2812_encoder->bytes_encoder));
-
-    // Create copy encoder for the reset code
-    rmt_copy_encoder_config_t copy_encoder_config = {};
-    ESP_ERROR_CHECK(rmt_new_copy_encoder(&copy_encoder_config, &ws2812_encoder->copy_encoder));
-
-    // Reset code
-    ws2812_encoder->reset_code = (rmt_symbol_word_t){
-        .level0 = 0,
-        .duration0 = WS2812_RESET_TICKS,
-        .level1 = 0,
-        .duration1 = WS2812_RESET_TICKS,
-    };
-
-    *ret_encoder = &ws2812_encoder->base;
-    return ESP_OK;
+    __atomic_sub_fetch(&tx_in_flight, 1, __ATOMIC_RELEASE);
+    return false;
 }
 
-// Send color to LED
+// Send color to LED if it differs from the last frame sent
 static void send_color(rgb_color_t color)
 {
     if (!initialized) return;
@@ -164,12 +67,27 @@ static void send_color(rgb_color_t color)
 
     // WS2812 expects GRB order
     uint8_t grb[3] = {g, r, b};
+    if (last_valid && memcmp(grb, last_grb, sizeof(grb)) == 0) {
+        return;
+    }
+    if (__atomic_load_n(&tx_in_flight, __ATOMIC_ACQUIRE) >= LED_TX_QUEUE_DEPTH) {
+        return;
+    }
+
+    uint8_t *buf = tx_buffers[tx_next % LED_TX_QUEUE_DEPTH];
+    memcpy(buf, grb, sizeof(grb));
 
     rmt_transmit_config_t tx_config = {
         .loop_count = 0,
     };
-    rmt_transmit(led_channel, led_encoder, grb, sizeof(grb), &tx_config);
-    rmt_tx_wait_all_done(led_channel, portMAX_DELAY);
+    __atomic_add_fetch(&tx_in_flight, 1, __ATOMIC_RELAXED);
+    if (rmt_transmit(led_channel, led_encoder, buf, sizeof(grb), &tx_config) != ESP_OK) {
+        __atomic_sub_fetch(&tx_in_flight, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    tx_next++;
+    memcpy(last_grb, grb, sizeof(grb));
+    last_valid = true;
 }
 
 // HSV to RGB conversion
@@ -400,14 +318,19 @@ esp_err_t led_rgb_init(void)
     rmt_tx_channel_config_t tx_config = {
         .gpio_num = PIN_STATUS_LED,
         .clk_src = RMT_CLK_SRC_DEFAULT,
-        .resolution_hz = RMT_RESOLUTION_HZ,
+        .resolution_hz = WS2812_RESOLUTION_HZ,
         .mem_block_symbols = 64,
-        .trans_queue_depth = 4,
+        .trans_queue_depth = LED_TX_QUEUE_DEPTH,
     };
     ESP_ERROR_CHECK(rmt_new_tx_channel(&tx_config, &led_channel));
 
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = led_tx_done,
+    };
+    ESP_ERROR_CHECK(rmt_tx_register_event_callbacks(led_channel, &callbacks, NULL));
+
     // Create WS2812 encoder
-    ESP_ERROR_CHECK(create_ws2812_encoder(&led_encoder));
+    ESP_ERROR_CHECK(ws2812_new_encoder(&led_encoder));
 
     // Enable channel
     ESP_ERROR_CHECK(rmt_enable(led_channel));
@@ -480,6 +403,16 @@ void led_rgb_set_state(led_state_t state)
             current_color = COLOR_RED;
             break;
 
+        case LED_STATE_BATTERY_LOW:
+            current_effect = LED_EFFECT_BLINK;
+            current_color = COLOR_ORANGE;
+            break;
+
+        case LED_STATE_BATTERY_CRITICAL:
+            current_effect = LED_EFFECT_HEARTBEAT;
+            current_color = COLOR_RED;
+            break;
+
         default:
             current_effect = LED_EFFECT_OFF;
             break;
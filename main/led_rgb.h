@@ -60,6 +60,8 @@ typedef enum {
     LED_STATE_WIFI_ON,          // WiFi enabled - cyan double blink
     LED_STATE_WIFI_OFF,         // WiFi disabled - orange double blink
     LED_STATE_ERROR,            // Error state - red solid
+    LED_STATE_BATTERY_LOW,      // Pack low - orange blink
+    LED_STATE_BATTERY_CRITICAL, // Pack critical - red heartbeat
 } led_state_t;
 
 /**
@@ -93,8 +95,10 @@ void led_rgb_set_color(rgb_color_t color);
 void led_rgb_off(void);
 
 /**
- * @brief Update LED animation (call from main loop at ~100Hz)
- * This updates the LED based on current effect/animation state
+ * @brief Update LED animation (call from the housekeeping task at ~100Hz)
+ * This updates the LED based on current effect/animation state. Only
+ * changed colors are transmitted, and the RMT transmit is queued without
+ * waiting for it to finish.
  */
 void led_rgb_update(void);
 
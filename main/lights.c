@@ -0,0 +1,371 @@
+/**
+ * @file lights.c
+ * @brief Addressable light strip engine on RMT with DMA
+ *
+ * Each frame every segment is rendered into an RGB framebuffer from the
+ * published vehicle state, scaled to GRB bytes and, if anything changed,
+ * handed to the RMT channel. DMA feeds the symbols, so the only CPU work
+ * per frame is the render in this task (core 0, below the control loop and
+ * audio mixer on core 1).
+ */
+
+#include "lights.h"
+#include "config.h"
+#include "led_rgb.h"
+#include "ws2812.h"
+#include "perf.h"
+#include "health.h"
+#include "timeline.h"
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+
+static const char *TAG = "LIGHTS";
+
+// RMT symbols per DMA buffer (the driver refills it as it drains)
+#define LIGHTS_DMA_SYMBOLS      1024
+#define LIGHTS_NO_DMA_SYMBOLS   48
+
+// Effect timing
+#define INDICATOR_PERIOD_MS     700     // One on/off cycle (~85 flashes/min)
+#define BEACON_PERIOD_MS        800     // One rotation
+
+// Colors at full scale (LIGHTS_BRIGHTNESS_PCT applies on top)
+#define COLOR_HEADLIGHT         (rgb_color_t){255, 200, 120}
+#define COLOR_AMBER             (rgb_color_t){255, 110, 0}
+#define COLOR_TAIL_DIM          (rgb_color_t){50, 0, 0}
+
+// A run of pixels with one role. 'reversed' flips effects that move along
+// the segment (indicator sweep, beacon rotation) for mirrored wiring.
+typedef struct {
+    light_role_t role;
+    uint16_t first;
+    uint16_t count;
+    bool reversed;
+} light_segment_t;
+
+// Strip layout, in wiring order. Edit to match the truck; lights_init()
+// refuses a layout that runs past LIGHTS_PIXEL_COUNT.
+static const light_segment_t segments[] = {
+    { LIGHT_ROLE_INDICATOR_LEFT,  0,   6,  true  },   // Front left, sweeps outwards
+    { LIGHT_ROLE_HEADLIGHT,       6,   12, false },   // Front bar
+    { LIGHT_ROLE_INDICATOR_RIGHT, 18,  6,  false },   // Front right
+    { LIGHT_ROLE_MARKER,          24,  40, false },   // Right side markers
+    { LIGHT_ROLE_INDICATOR_RIGHT, 64,  6,  true  },   // Rear right
+    { LIGHT_ROLE_TAIL,            70,  8,  false },   // Rear right tail/brake
+    { LIGHT_ROLE_REVERSE,         78,  4,  false },   // Rear center
+    { LIGHT_ROLE_TAIL,            82,  8,  false },   // Rear left tail/brake
+    { LIGHT_ROLE_INDICATOR_LEFT,  90,  6,  false },   // Rear left
+    { LIGHT_ROLE_MARKER,          96,  38, false },   // Left side markers
+    { LIGHT_ROLE_BEACON,          134, 16, false },   // Roof bar
+};
+#define SEGMENT_COUNT (sizeof(segments) / sizeof(segments[0]))
+
+// RMT channel and encoder
+static rmt_channel_handle_t strip_channel = NULL;
+static rmt_encoder_handle_t strip_encoder = NULL;
+
+// Render task, woken by a periodic timer at LIGHTS_FPS
+static TaskHandle_t lights_task_handle = NULL;
+static esp_timer_handle_t frame_timer = NULL;
+
+// Published vehicle state (written by housekeeping, read per frame)
+static lights_vehicle_t vehicle;
+static portMUX_TYPE vehicle_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Framebuffer and GRB transmit buffers. Only one frame is in flight: the
+// next one renders into the other buffer, and the frame just sent stays
+// intact for change detection.
+static rgb_color_t framebuffer[LIGHTS_PIXEL_COUNT];
+static uint8_t tx_buffers[2][LIGHTS_PIXEL_COUNT * 3];
+static int tx_last = -1;                // Buffer last sent, -1 = none yet
+static volatile bool tx_busy = false;
+
+// Indicator state: blink until this time (ms since boot)
+static uint32_t indicate_left_until = 0;
+static uint32_t indicate_right_until = 0;
+
+static uint32_t frames_rendered = 0;
+static uint32_t frames_sent = 0;
+
+// ============================================================================
+// Effects
+// ============================================================================
+
+static rgb_color_t scale_color(rgb_color_t c, uint8_t intensity)
+{
+    return (rgb_color_t){
+        (uint8_t)((c.r * intensity) / 255),
+        (uint8_t)((c.g * intensity) / 255),
+        (uint8_t)((c.b * intensity) / 255),
+    };
+}
+
+static void fill(const light_segment_t *seg, rgb_color_t c)
+{
+    for (uint16_t i = 0; i < seg->count; i++) {
+        framebuffer[seg->first + i] = c;
+    }
+}
+
+// Sequential indicator: pixels light one after another for the first half
+// of each period, then the segment goes dark
+static void render_indicator(const light_segment_t *seg, bool active, uint32_t now_ms)
+{
+    fill(seg, COLOR_OFF);
+    if (!active) {
+        return;
+    }
+
+    uint32_t phase = now_ms % INDICATOR_PERIOD_MS;
+    uint32_t half = INDICATOR_PERIOD_MS / 2;
+    if (phase >= half) {
+        return;
+    }
+    uint32_t lit = 1 + (phase * seg->count) / half;
+    for (uint16_t i = 0; i < seg->count && i < lit; i++) {
+        uint16_t px = seg->reversed ? (uint16_t)(seg->count - 1 - i) : i;
+        framebuffer[seg->first + px] = COLOR_AMBER;
+    }
+}
+
+// Rotating beacon: a bright peak travels round the segment with a falloff
+// either side and a dim glow elsewhere (effect_beacon() spread over pixels)
+static void render_beacon(const light_segment_t *seg, bool active, uint32_t now_ms)
+{
+    if (!active) {
+        fill(seg, COLOR_OFF);
+        return;
+    }
+
+    uint32_t count = seg->count;
+    uint32_t pos = ((now_ms % BEACON_PERIOD_MS) * count * 256) / BEACON_PERIOD_MS;  // 8.8 fixed
+    uint32_t width = (count / 4 > 0 ? count / 4 : 1) * 256;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t px = i * 256;
+        uint32_t dist = px > pos ? px - pos : pos - px;
+        if (dist > count * 128) {
+            dist = count * 256 - dist;          // Wrap round the bar
+        }
+        uint8_t intensity = dist < width ? (uint8_t)(255 - (dist * 247) / width) : 8;
+        uint16_t idx = seg->reversed ? (uint16_t)(count - 1 - i) : (uint16_t)i;
+        framebuffer[seg->first + idx] = scale_color(COLOR_AMBER, intensity);
+    }
+}
+
+static void render_segment(const light_segment_t *seg, const lights_vehicle_t *v, uint32_t now_ms)
+{
+    bool hazard = v->failsafe;
+
+    switch (seg->role) {
+        case LIGHT_ROLE_HEADLIGHT:
+            fill(seg, v->running ? COLOR_HEADLIGHT : scale_color(COLOR_HEADLIGHT, 64));
+            break;
+
+        case LIGHT_ROLE_TAIL:
+            fill(seg, v->braking ? COLOR_RED : COLOR_TAIL_DIM);
+            break;
+
+        case LIGHT_ROLE_REVERSE:
+            fill(seg, (v->running && v->reverse) ? COLOR_WHITE : COLOR_OFF);
+            break;
+
+        case LIGHT_ROLE_INDICATOR_LEFT:
+            render_indicator(seg, hazard || now_ms < indicate_left_until, now_ms);
+            break;
+
+        case LIGHT_ROLE_INDICATOR_RIGHT:
+            render_indicator(seg, hazard || now_ms < indicate_right_until, now_ms);
+            break;
+
+        case LIGHT_ROLE_MARKER:
+            fill(seg, scale_color(COLOR_AMBER, 128));
+            break;
+
+        case LIGHT_ROLE_BEACON:
+            render_beacon(seg, v->running || hazard, now_ms);
+            break;
+
+        default:
+            fill(seg, COLOR_OFF);
+            break;
+    }
+}
+
+// ============================================================================
+// Frame output
+// ============================================================================
+
+// RMT transmit-done callback (ISR context)
+static bool IRAM_ATTR strip_tx_done(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata,
+                                    void *user_ctx)
+{
+    TIMELINE_ISR_ENTER(TIMELINE_ISR_RMT_LIGHTS);
+    tx_busy = false;
+    TIMELINE_ISR_EXIT(TIMELINE_ISR_RMT_LIGHTS);
+    return false;
+}
+
+/**
+ * @brief Scale the framebuffer to GRB and send it if it changed
+ */
+static void send_frame(void)
+{
+    if (tx_busy) {
+        return;     // Previous frame still on the wire, try again next frame
+    }
+
+    int next = (tx_last == 0) ? 1 : 0;
+    uint8_t *grb = tx_buffers[next];
+    for (int i = 0; i < LIGHTS_PIXEL_COUNT; i++) {
+        grb[i * 3 + 0] = (uint8_t)((framebuffer[i].g * LIGHTS_BRIGHTNESS_PCT) / 100);
+        grb[i * 3 + 1] = (uint8_t)((framebuffer[i].r * LIGHTS_BRIGHTNESS_PCT) / 100);
+        grb[i * 3 + 2] = (uint8_t)((framebuffer[i].b * LIGHTS_BRIGHTNESS_PCT) / 100);
+    }
+    if (tx_last >= 0 && memcmp(grb, tx_buffers[tx_last], sizeof(tx_buffers[0])) == 0) {
+        return;
+    }
+
+    rmt_transmit_config_t tx_config = {
+        .loop_count = 0,
+    };
+    tx_busy = true;
+    if (rmt_transmit(strip_channel, strip_encoder, grb, sizeof(tx_buffers[0]), &tx_config) != ESP_OK) {
+        tx_busy = false;
+        return;
+    }
+    tx_last = next;
+    frames_sent++;
+}
+
+static void frame_timer_callback(void *arg)
+{
+    xTaskNotifyGive(lights_task_handle);
+}
+
+static void lights_task(void *arg)
+{
+    lights_vehicle_t v;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        health_beat(HEALTH_TASK_LIGHTS, 1000000 / LIGHTS_FPS);
+
+        // Lights are cosmetic: hold the last frame while timing is degraded
+        if (perf_should_shed(PERF_SHED_LED)) {
+            continue;
+        }
+
+        taskENTER_CRITICAL(&vehicle_lock);
+        v = vehicle;
+        taskEXIT_CRITICAL(&vehicle_lock);
+
+        uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+        if (v.steering <= -LIGHTS_INDICATOR_THRESHOLD) {
+            indicate_left_until = now_ms + LIGHTS_INDICATOR_HOLD_MS;
+        } else if (v.steering >= LIGHTS_INDICATOR_THRESHOLD) {
+            indicate_right_until = now_ms + LIGHTS_INDICATOR_HOLD_MS;
+        }
+
+        for (size_t i = 0; i < SEGMENT_COUNT; i++) {
+            if (segments[i].count > 0) {
+                render_segment(&segments[i], &v, now_ms);
+            }
+        }
+        frames_rendered++;
+        send_frame();
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+esp_err_t lights_init(void)
+{
+    if (!LIGHTS_ENABLED || lights_task_handle != NULL) {
+        return ESP_OK;
+    }
+
+    for (size_t i = 0; i < SEGMENT_COUNT; i++) {
+        if (segments[i].first + segments[i].count > LIGHTS_PIXEL_COUNT) {
+            ESP_LOGE(TAG, "Segment %u runs past LIGHTS_PIXEL_COUNT (%d)", (unsigned)i, LIGHTS_PIXEL_COUNT);
+            return ESP_ERR_INVALID_SIZE;
+        }
+    }
+
+    // Prefer the DMA-capable channel; fall back to a ping-pong channel
+    // (one refill interrupt per 24 symbols) if it is taken
+    rmt_tx_channel_config_t tx_config = {
+        .gpio_num = PIN_LIGHT_STRIP,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = WS2812_RESOLUTION_HZ,
+        .mem_block_symbols = LIGHTS_DMA_SYMBOLS,
+        .trans_queue_depth = 1,
+        .flags.with_dma = true,
+    };
+    esp_err_t err = rmt_new_tx_channel(&tx_config, &strip_channel);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "No RMT DMA channel (%s), using interrupt refill", esp_err_to_name(err));
+        tx_config.mem_block_symbols = LIGHTS_NO_DMA_SYMBOLS;
+        tx_config.flags.with_dma = false;
+        err = rmt_new_tx_channel(&tx_config, &strip_channel);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create RMT channel: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = strip_tx_done,
+    };
+    ESP_ERROR_CHECK(rmt_tx_register_event_callbacks(strip_channel, &callbacks, NULL));
+    ESP_ERROR_CHECK(ws2812_new_encoder(&strip_encoder));
+    ESP_ERROR_CHECK(rmt_enable(strip_channel));
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        lights_task,
+        "lights",
+        LIGHTS_TASK_STACK_SIZE,
+        NULL,
+        LIGHTS_TASK_PRIORITY,
+        &lights_task_handle,
+        LIGHTS_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create lights task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = frame_timer_callback,
+        .name = "lights",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &frame_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(frame_timer, 1000000 / LIGHTS_FPS));
+
+    ESP_LOGI(TAG, "Light strip: %d pixels on GPIO %d, %u segments, %d fps%s",
+             LIGHTS_PIXEL_COUNT, PIN_LIGHT_STRIP, (unsigned)SEGMENT_COUNT, LIGHTS_FPS,
+             tx_config.flags.with_dma ? " (DMA)" : "");
+    return ESP_OK;
+}
+
+void lights_set_vehicle(const lights_vehicle_t *v)
+{
+    taskENTER_CRITICAL(&vehicle_lock);
+    vehicle = *v;
+    taskEXIT_CRITICAL(&vehicle_lock);
+}
+
+uint32_t lights_get_stats(uint32_t *sent)
+{
+    if (sent) {
+        *sent = frames_sent;
+    }
+    return frames_rendered;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file lights.h
+ * @brief Addressable light strip: headlights, brake, reverse, indicators, beacons
+ *
+ * A WS2812 chain on PIN_LIGHT_STRIP is split into segments, each with a
+ * role. A low-priority task renders every segment into a framebuffer at
+ * LIGHTS_FPS from the last published vehicle state and sends it over RMT
+ * with DMA, so a frame costs the CPU only the render.
+ */
+
+#ifndef LIGHTS_H
+#define LIGHTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+// Segment roles (what a run of pixels shows)
+typedef enum {
+    LIGHT_ROLE_HEADLIGHT = 0,   // Warm white, dimmed while idle
+    LIGHT_ROLE_TAIL,            // Dim red, full red while braking
+    LIGHT_ROLE_REVERSE,         // White while reversing
+    LIGHT_ROLE_INDICATOR_LEFT,  // Amber sequential blink (hazards in failsafe)
+    LIGHT_ROLE_INDICATOR_RIGHT,
+    LIGHT_ROLE_MARKER,          // Steady amber side markers
+    LIGHT_ROLE_BEACON,          // Rotating amber sweep while running
+    LIGHT_ROLE_COUNT
+} light_role_t;
+
+// Vehicle state the lights react to (published by housekeeping)
+typedef struct {
+    bool running;       // Signal present and driving allowed
+    bool failsafe;      // Signal lost: hazards
+    bool braking;       // vehicle_state_t braking
+    bool reverse;       // vehicle_state_t reversing
+    int16_t steering;   // -1000 (left) to +1000 (right)
+} lights_vehicle_t;
+
+/**
+ * @brief Create the RMT DMA channel and start the render task
+ * @return ESP_OK on success (also when LIGHTS_ENABLED is 0)
+ */
+esp_err_t lights_init(void);
+
+/**
+ * @brief Publish the vehicle state for the next frames
+ * @param vehicle State to copy (called from housekeeping each tick)
+ */
+void lights_set_vehicle(const lights_vehicle_t *vehicle);
+
+/**
+ * @brief Get frames rendered and frames actually sent (changed)
+ * @param sent Receives frames sent, may be NULL
+ * @return Frames rendered since boot
+ */
+uint32_t lights_get_stats(uint32_t *sent);
+
+#endif // LIGHTS_H
@@ -7,6 +7,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
@@ -21,27 +22,57 @@
 #include "pwm_output.h"
 #include "calibration.h"
 #include "tuning.h"
+#include "preset.h"
 #include "web_server.h"
 #include "ota_update.h"
 #include "led_rgb.h"
+#include "lights.h"
 #include "udp_log.h"
 #include "sound.h"
 #include "engine_sound.h"
+#include "vehicle.h"
+#include "audio_mixer.h"
+#include "sound_pack.h"
 #include "mode_switch.h"
 #include "menu.h"
+#include "perf.h"
+#include "power.h"
+#include "battery.h"
+#include "trace.h"
+#include "blackbox.h"
+#include "control.h"
+#include "bench.h"
+#include "task_stats.h"
+#include "health.h"
+#include "timeline.h"
 
 static const char *TAG = "MAIN";
 
-// Application state
-typedef enum {
-    APP_STATE_INIT,
-    APP_STATE_CALIBRATING,
-    APP_STATE_RUNNING,
-    APP_STATE_FAILSAFE
-} app_state_t;
-
-static app_state_t app_state = APP_STATE_INIT;
-static steering_mode_t current_steering_mode = STEER_MODE_FRONT;
+// RC frame captured once per control tick
+static rc_frame_t rc_frame;
+
+// State published by the control task for housekeeping (LED, web status).
+// Housekeeping only ever reads a copy, so it can never stall the control path.
+typedef struct {
+    app_state_t app_state;
+    steering_mode_t steering_mode;
+    rc_frame_t frame;
+    vehicle_state_t vehicle;
+} control_snapshot_t;
+
+static control_snapshot_t control_snapshot = {
+    .app_state = APP_STATE_INIT,
+    .steering_mode = STEER_MODE_FRONT,
+};
+static portMUX_TYPE snapshot_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Control loop tick source
+static TaskHandle_t control_task_handle = NULL;
+static esp_timer_handle_t control_timer = NULL;
+static uint16_t control_rate_hz = 0;     // 0 = timer not started
+static uint32_t control_period_us = 0;
+static int64_t control_timer_start_us = 0;
+static volatile uint32_t control_tick_due_us = 0;  // Timer tick not yet seen by the loop (0 = none)
 
 // LED state tracking
 static led_state_t current_led_state = LED_STATE_BOOT;
@@ -64,221 +95,55 @@ static void print_banner(void)
     ESP_LOGI(TAG, "║             GPIO %2d (horn)              ║", PIN_RC_AUX1);
     ESP_LOGI(TAG, "║             GPIO %2d (mode switch)       ║", PIN_RC_AUX2);
     ESP_LOGI(TAG, "║  ESC:        GPIO %2d                     ║", PIN_ESC);
-    ESP_LOGI(TAG, "║  Servos:     A1:%2d A2:%2d A3:%2d A4:%2d    ║",
-             PIN_SERVO_AXLE_1, PIN_SERVO_AXLE_2, PIN_SERVO_AXLE_3, PIN_SERVO_AXLE_4);
+    static const int servo_pins[SERVO_COUNT] = {
+        PIN_SERVO_AXLE_1, PIN_SERVO_AXLE_2,
+#if SERVO_COUNT > 2
+        PIN_SERVO_AXLE_3,
+#endif
+#if SERVO_COUNT > 3
+        PIN_SERVO_AXLE_4,
+#endif
+#if SERVO_COUNT > 4
+        PIN_SERVO_AXLE_5,
+#endif
+    };
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        ESP_LOGI(TAG, "║  %s    A%d: GPIO %2d                  ║",
+                 i ? "       " : "Servos:", i + 1, servo_pins[i]);
+    }
     ESP_LOGI(TAG, "╚══════════════════════════════════════════╝");
     ESP_LOGI(TAG, "");
 }
 
 /**
- * @brief Process RC input and update outputs
+ * @brief Publish control state for the housekeeping task
  */
-static void process_control_loop(void)
+static void publish_snapshot(void)
 {
-    const calibration_data_t *cal = calibration_get_data();
-
-    // Get RC input
-    rc_channel_data_t throttle_data, steering_data, aux1_data, aux2_data, aux3_data, aux4_data;
-    rc_input_get_calibrated(RC_CH_THROTTLE, &cal->channels[RC_CH_THROTTLE], &throttle_data);
-    rc_input_get_calibrated(RC_CH_STEERING, &cal->channels[RC_CH_STEERING], &steering_data);
-    rc_input_get_calibrated(RC_CH_AUX1, &cal->channels[RC_CH_AUX1], &aux1_data);  // Horn button
-    rc_input_get_calibrated(RC_CH_AUX2, &cal->channels[RC_CH_AUX2], &aux2_data);  // Mode switch button
-    rc_input_get_calibrated(RC_CH_AUX3, &cal->channels[RC_CH_AUX3], &aux3_data);
-    rc_input_get_calibrated(RC_CH_AUX4, &cal->channels[RC_CH_AUX4], &aux4_data);
-
-    bool signal_lost = throttle_data.signal_lost || steering_data.signal_lost;
-
-    // Get button states
-    bool aux1_pressed = (aux1_data.value > 400);  // Horn / Menu confirm
-    bool aux2_pressed = (aux2_data.value > 400);  // Mode switch / Menu navigate
-
-    // Update menu state machine (handles AUX2 when menu is active)
-    menu_update(aux2_pressed);
-
-    // AUX1 - Horn or Menu Confirm
-    // When menu is active, AUX1 is used for menu confirmation
-    // When menu is inactive, AUX1 is the horn button
-    if (menu_is_active()) {
-        menu_handle_confirm(aux1_pressed);
-        engine_sound_set_horn(false);  // No horn while in menu
-    } else {
-        engine_sound_set_horn(aux1_pressed);
-    }
-
-    // AUX3 - Throttle Mode (3-position switch)
-    // SWAPPED: Was AUX4, now AUX3
-    // Low (<-400): Direct pass-through
-    // Center (-400 to 400): Neutral - rev engine but no ESC output
-    // High (>400): Realistic throttle physics
-    static throttle_mode_t prev_throttle_mode = THROTTLE_MODE_DIRECT;
-    throttle_mode_t throttle_mode;
-    if (aux3_data.value > 400) {
-        throttle_mode = THROTTLE_MODE_REALISTIC;
-    } else if (aux3_data.value > -400) {
-        throttle_mode = THROTTLE_MODE_NEUTRAL;
-    } else {
-        throttle_mode = THROTTLE_MODE_DIRECT;
-    }
-    if (throttle_mode != prev_throttle_mode) {
-        ESP_LOGI(TAG, "Throttle mode: %d (aux3=%d)", throttle_mode, aux3_data.value);
-        prev_throttle_mode = throttle_mode;
-    }
-    tuning_set_throttle_mode(throttle_mode);
-
-    // AUX4 - Engine On/Off (momentary button)
-    // SWAPPED: Was AUX3 (complex state machine), now simple single-press toggle
-    static bool aux4_was_pressed = false;
-    bool aux4_pressed = (aux4_data.value > 400);
-    if (aux4_pressed && !aux4_was_pressed) {
-        // Rising edge - toggle engine
-        if (engine_sound_get_state() == ENGINE_OFF) {
-            ESP_LOGI(TAG, "Engine start (AUX4)");
-            engine_sound_start();
-        } else {
-            ESP_LOGI(TAG, "Engine stop (AUX4)");
-            engine_sound_stop();
-        }
-    }
-    aux4_was_pressed = aux4_pressed;
-
-    // Check for signal loss
-    if (signal_lost) {
-        if (app_state != APP_STATE_FAILSAFE) {
-            ESP_LOGW(TAG, "Signal lost! Entering failsafe mode");
-            app_state = APP_STATE_FAILSAFE;
-            menu_force_exit();  // Exit menu on signal loss
-            esc_set_neutral();
-            servo_center_all();
-            tuning_reset_realistic_throttle();  // Reset simulated velocity
-            tuning_reset_realistic_steering();  // Reset steering positions
-        }
-        return;
-    }
-
-    // Recover from failsafe
-    if (app_state == APP_STATE_FAILSAFE) {
-        ESP_LOGI(TAG, "Signal recovered, resuming operation");
-        app_state = APP_STATE_RUNNING;
-    }
-
-    // Apply throttle to ESC with tuning (limits, subtrim, deadzone, reverse)
-    // Skip ESC output in neutral mode (rev engine sound only)
-    if (!tuning_is_neutral_mode()) {
-        uint16_t esc_pulse = tuning_calc_esc_pulse(throttle_data.value);
-        esc_set_pulse(esc_pulse);
-    } else {
-        esc_set_neutral();
-    }
-
-    // Update engine sound based on throttle and velocity
-    // In realistic mode: use simulated velocity for natural physics
-    // In direct/neutral mode: use throttle directly as pseudo-velocity for effects
-    int16_t sound_velocity;
-    if (throttle_mode == THROTTLE_MODE_REALISTIC) {
-        sound_velocity = tuning_get_simulated_velocity();
-    } else {
-        // Use throttle as velocity - this makes effects work in all modes
-        sound_velocity = throttle_data.value;
-    }
-    engine_sound_update(throttle_data.value, sound_velocity);
-
-    // Apply steering expo curve
-    int16_t steer = tuning_apply_expo(steering_data.value);
-
-    // Apply speed-dependent steering reduction
-    steer = tuning_apply_speed_steering(steer);
-
-    // Update mode switch with button state (AUX2 = Channel 3 momentary button)
-    // Priority: UI override > mode switch button
-    steering_mode_t new_mode;
-    uint8_t ui_mode;
-
-    if (web_server_get_mode_override(&ui_mode)) {
-        // UI has selected a mode - update mode_switch to stay in sync
-        mode_switch_set_mode((steering_mode_t)ui_mode);
-        new_mode = (steering_mode_t)ui_mode;
-    } else {
-        // RC: Use momentary button on Channel 3 (AUX2)
-        // Single press: Toggle between Front and All-Axle
-        // Double press: Crab mode
-        // Triple press: Rear mode
-        // In Crab/Rear: Single press returns to last normal mode
-        bool mode_btn_pressed = (aux2_data.value > 400);
-        mode_switch_update(mode_btn_pressed);
-        new_mode = mode_switch_get_mode();
-    }
-
-    // Log mode changes
-    if (new_mode != current_steering_mode) {
-        const char *mode_names[] = {"Front", "Rear", "All-Axle", "Crab"};
-        ESP_LOGI(TAG, "Steering mode: %s", mode_names[new_mode]);
-        current_steering_mode = new_mode;
-    }
-
-    // Apply realistic steering if enabled (smooth interpolation of input)
-    // This must happen BEFORE applying ratios - like a mechanical linkage,
-    // all axles follow one smoothed steering input proportionally
-    int16_t smoothed_steer = steer;
-    if (tuning_is_realistic_steering_enabled()) {
-        smoothed_steer = tuning_apply_realistic_steering(steer);
-    }
-
-    // Calculate per-axle steering based on mode and axle ratios
-    int16_t final_positions[SERVO_COUNT] = {0, 0, 0, 0};
-
-    switch (current_steering_mode) {
-        case STEER_MODE_FRONT:
-            // Axles 1-2 steer, 3-4 fixed (like a car)
-            final_positions[0] = (smoothed_steer * tuning_get_axle_ratio(0, current_steering_mode)) / 100;
-            final_positions[1] = (smoothed_steer * tuning_get_axle_ratio(1, current_steering_mode)) / 100;
-            final_positions[2] = 0;
-            final_positions[3] = 0;
-            break;
-
-        case STEER_MODE_REAR:
-            // Axles 3-4 steer, 1-2 fixed (reverse direction for intuitive control)
-            final_positions[0] = 0;
-            final_positions[1] = 0;
-            final_positions[2] = (-smoothed_steer * tuning_get_axle_ratio(2, current_steering_mode)) / 100;
-            final_positions[3] = (-smoothed_steer * tuning_get_axle_ratio(3, current_steering_mode)) / 100;
-            break;
-
-        case STEER_MODE_ALL_AXLE:
-            // All axles steer (1-2 opposite to 3-4 for tighter turning)
-            // Rear gets additional ratio reduction via tuning_get_axle_ratio
-            final_positions[0] = (smoothed_steer * tuning_get_axle_ratio(0, current_steering_mode)) / 100;
-            final_positions[1] = (smoothed_steer * tuning_get_axle_ratio(1, current_steering_mode)) / 100;
-            final_positions[2] = (-smoothed_steer * tuning_get_axle_ratio(2, current_steering_mode)) / 100;
-            final_positions[3] = (-smoothed_steer * tuning_get_axle_ratio(3, current_steering_mode)) / 100;
-            break;
-
-        case STEER_MODE_CRAB:
-            // All axles same direction at 100% (crab walk / sideways)
-            // No ratios applied - all wheels must point the same direction
-            final_positions[0] = smoothed_steer;
-            final_positions[1] = smoothed_steer;
-            final_positions[2] = smoothed_steer;
-            final_positions[3] = smoothed_steer;
-            break;
-
-        default:
-            break;
-    }
+    portENTER_CRITICAL(&snapshot_lock);
+    control_snapshot.app_state = control_get_state();
+    control_snapshot.steering_mode = control_get_steering_mode();
+    control_snapshot.frame = rc_frame;
+    control_snapshot.vehicle = *vehicle_get_state();
+    portEXIT_CRITICAL(&snapshot_lock);
+}
 
-    // Set servo positions with tuning (endpoints, subtrim, trim, reverse)
-    // Skip if servo test mode is active (UI controls servos directly)
-    if (!web_server_is_servo_test_active()) {
-        for (int i = 0; i < SERVO_COUNT; i++) {
-            uint16_t pulse = tuning_calc_servo_pulse(i, final_positions[i]);
-            servo_set_pulse((servo_id_t)i, pulse);
-        }
-    }
+/**
+ * @brief Get a copy of the latest control state
+ * @param out Destination snapshot
+ */
+static void read_snapshot(control_snapshot_t *out)
+{
+    portENTER_CRITICAL(&snapshot_lock);
+    *out = control_snapshot;
+    portEXIT_CRITICAL(&snapshot_lock);
 }
 
 /**
  * @brief Update web UI and optionally print to serial
+ * @param snap Control state snapshot for this housekeeping tick
  */
-static void update_status(void)
+static void update_status(const control_snapshot_t *snap)
 {
     // Skip status updates if WiFi is off
     if (!web_server_wifi_is_enabled()) {
@@ -288,18 +153,14 @@ static void update_status(void)
     static uint32_t last_update = 0;
     uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
 
-    // Update web UI at 10Hz
-    if (now - last_update < 100) {
+    // Update web UI at the telemetry rate
+    if (now - last_update < WEB_STATUS_PERIOD_MS) {
         return;
     }
     last_update = now;
     
-    const calibration_data_t *cal = calibration_get_data();
-    
-    rc_channel_data_t ch[RC_CHANNEL_COUNT];
-    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
-        rc_input_get_calibrated((rc_channel_t)i, &cal->channels[i], &ch[i]);
-    }
+    // Reuse the frame the control task already computed
+    const rc_channel_data_t *ch = snap->frame.ch;
     
     // Build web status
     web_status_t web_status = {
@@ -318,11 +179,10 @@ static void update_status(void)
             ch[RC_CH_AUX4].pulse_us
         },
         .esc_pulse = esc_get_pulse(),
-        .servo_a1 = servo_get_pulse(SERVO_AXLE_1),
-        .servo_a2 = servo_get_pulse(SERVO_AXLE_2),
-        .servo_a3 = servo_get_pulse(SERVO_AXLE_3),
-        .servo_a4 = servo_get_pulse(SERVO_AXLE_4),
-        .steering_mode = current_steering_mode,
+        .engine_rpm = snap->vehicle.rpm,
+        .velocity = snap->vehicle.velocity,
+        .gear = snap->vehicle.gear,
+        .steering_mode = snap->steering_mode,
         .signal_lost = ch[RC_CH_THROTTLE].signal_lost,
         .calibrated = calibration_is_valid(),
         .calibrating = calibration_in_progress(),
@@ -332,147 +192,214 @@ static void update_status(void)
         .heap_min = esp_get_minimum_free_heap_size(),
         .wifi_rssi = 0  // TODO: Get actual RSSI if connected to STA
     };
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        web_status.servo[i] = servo_get_pulse((servo_id_t)i);
+    }
     
     web_server_update_status(&web_status);
 }
 
 /**
- * @brief Main application entry point
+ * @brief Control loop timer tick (esp_timer task context)
+ *
+ * Works out when the tick was due from the timer's start time, so the
+ * tickToLoop latency also covers any delay in dispatching the callback.
  */
-void app_main(void)
+static void control_timer_callback(void *arg)
 {
-    print_banner();
-    
-    // Initialize NVS (required for calibration storage)
-    ESP_LOGI(TAG, "Initializing NVS...");
-    ESP_ERROR_CHECK(nvs_storage_init());
-    
-    // Initialize status LED
-    // Initialize RGB LED (shows rainbow boot animation)
-    ESP_LOGI(TAG, "Initializing RGB LED...");
-    ESP_ERROR_CHECK(led_rgb_init());
+    int64_t now = esp_timer_get_time();
+    control_tick_due_us = (uint32_t)(now - (now - control_timer_start_us) % control_period_us);
+    xTaskNotifyGive(control_task_handle);
+}
 
-    // Initialize sound system
-    ESP_LOGI(TAG, "Initializing sound system...");
-    ESP_ERROR_CHECK(sound_init());
+/**
+ * @brief (Re)start the control loop timer if the rate changed
+ * @param rate_hz Loop rate (already validated by tuning)
+ */
+static void control_apply_rate(uint16_t rate_hz)
+{
+    if (rate_hz == control_rate_hz) {
+        return;
+    }
+    if (control_rate_hz != 0) {
+        esp_timer_stop(control_timer);
+    }
+    control_period_us = 1000000 / rate_hz;
+    control_timer_start_us = esp_timer_get_time();
+    ESP_ERROR_CHECK(esp_timer_start_periodic(control_timer, control_period_us));
+    control_rate_hz = rate_hz;
+    ESP_LOGI(TAG, "Control loop rate: %dHz", rate_hz);
+}
 
-    // Initialize engine sound system
-    ESP_LOGI(TAG, "Initializing engine sound...");
-    ESP_ERROR_CHECK(engine_sound_init());
+/**
+ * @brief Hold the full CPU clock while the vehicle is in use
+ *
+ * Called before the tick's mixing, so the first tick that sees the sticks
+ * move pays the clock switch (power wake latency) and then runs at full
+ * clock like every other driving tick.
+ */
+static void control_power_update(const rc_frame_t *frame, bool calibrating)
+{
+    static int64_t last_active_us = 0;
+
+    bool active = calibrating || menu_is_active() ||
+                  engine_sound_get_state() != ENGINE_OFF ||
+                  vehicle_get_state()->velocity != 0;
+    if (!frame->ch[RC_CH_THROTTLE].signal_lost && !frame->ch[RC_CH_STEERING].signal_lost) {
+        active = active ||
+                 abs(frame->ch[RC_CH_THROTTLE].value) > POWER_ACTIVE_DEADBAND ||
+                 abs(frame->ch[RC_CH_STEERING].value) > POWER_ACTIVE_DEADBAND ||
+                 frame->ch[RC_CH_AUX1].value > 400 || frame->ch[RC_CH_AUX2].value > 400;
+    }
 
-    // Initialize RC input capture
-    ESP_LOGI(TAG, "Initializing RC input...");
-    ESP_ERROR_CHECK(rc_input_init());
-    
-    // Initialize PWM outputs (ESC + servos)
-    ESP_LOGI(TAG, "Initializing PWM outputs...");
-    ESP_ERROR_CHECK(pwm_output_init());
-    
-    // Initialize calibration system (loads from NVS or defaults)
-    ESP_LOGI(TAG, "Initializing calibration...");
-    calibration_data_t cal_data;
-    ESP_ERROR_CHECK(calibration_init(&cal_data));
+    int64_t now_us = esp_timer_get_time();
+    if (active) {
+        last_active_us = now_us;
+    }
+    power_hold(POWER_LOCK_CONTROL, now_us - last_active_us < (int64_t)POWER_PARK_DELAY_MS * 1000);
+}
 
-    // Initialize tuning system (loads from NVS or defaults)
-    ESP_LOGI(TAG, "Initializing tuning...");
-    ESP_ERROR_CHECK(tuning_init(NULL));
+/**
+ * @brief Time-critical control task: RC frame -> mixing -> outputs
+ *
+ * Pinned away from the WiFi/lwIP core at the highest application priority.
+ * Nothing here may block on the web UI, WiFi or LED.
+ */
+static void control_task(void *arg)
+{
+    ESP_ERROR_CHECK(esp_task_wdt_add(NULL));
+
+    // From here on only this task changes the tuning config and its tables
+    // (a web request during boot may have changed the output rates in place)
+    tuning_bind_control_task();
+    const tuning_config_t *bound = tuning_get_config();
+    pwm_output_set_rates(bound->output.esc_rate_hz, bound->output.servo_rate_hz);
+
+    // Loop tick comes from an esp_timer so rates above the FreeRTOS tick
+    // (and non-integer periods like 2.5ms) are possible
+    control_task_handle = xTaskGetCurrentTaskHandle();
+    const esp_timer_create_args_t timer_args = {
+        .callback = control_timer_callback,
+        .name = "control",
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &control_timer));
+    control_apply_rate(tuning_get_config()->control.loop_rate_hz);
 
-    // Initialize mode switch (starts in Front steering mode)
-    ESP_LOGI(TAG, "Initializing mode switch...");
-    mode_switch_init();
+#if CONTROL_LOOP_EVENT_DRIVEN
+    // Let the RC capture ISR wake us as soon as a new frame is in
+    rc_input_set_frame_notify(control_task_handle);
+    ESP_LOGI(TAG, "Control task: %dHz + event-driven, core %d, prio %d",
+             control_rate_hz, xPortGetCoreID(), CONTROL_TASK_PRIORITY);
+#else
+    ESP_LOGI(TAG, "Control task: %dHz, core %d, prio %d",
+             control_rate_hz, xPortGetCoreID(), CONTROL_TASK_PRIORITY);
+#endif
 
-    // Initialize menu system (registers long-press callback with mode_switch)
-    ESP_LOGI(TAG, "Initializing menu system...");
-    menu_init();
+    int64_t last_tick_us = esp_timer_get_time();
 
-    // Initialize web server (WiFi OFF by default - use menu to enable)
-    ESP_LOGI(TAG, "Initializing web server (WiFi OFF)...");
-    ESP_ERROR_CHECK(web_server_init_no_wifi());
+    while (1) {
+        // Wake on the next timer tick or RC frame, whichever comes first
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CONTROL_WAKE_TIMEOUT_MS));
+        uint32_t tick_cycles = perf_cycles();
+        TIMELINE_MARK_BEGIN(TIMELINE_MARK_CONTROL);
+
+        // Physics is scaled by the real elapsed time, not an assumed period
+        int64_t now_us = esp_timer_get_time();
+        uint32_t due_us = control_tick_due_us;
+        if (due_us != 0) {
+            // Woken by the timer: how long the tick waited for this core
+            control_tick_due_us = 0;
+            perf_record(PERF_LAT_TICK_TO_LOOP, (uint32_t)now_us - due_us);
+        }
+        tuning_set_dt_us((uint32_t)(now_us - last_tick_us));
+        last_tick_us = now_us;
 
-    // OTA update module (initialized when WiFi is enabled)
-    // Note: OTA only works when WiFi is on
+        // Apply live edits from the web UI between ticks, then pick up rate changes
+        if (tuning_live_apply()) {
+            const tuning_config_t *tune = tuning_get_config();
+            pwm_output_set_rates(tune->output.esc_rate_hz, tune->output.servo_rate_hz);
+        }
+        control_apply_rate(tuning_get_config()->control.loop_rate_hz);
 
-    // Mark this firmware as valid (cancels automatic rollback)
-    ota_mark_valid();
+        // Sample and calibrate all RC channels once for this tick
+        rc_input_get_all_calibrated(calibration_get_data(), &rc_frame);
 
-    ESP_LOGI(TAG, "");
-    ESP_LOGI(TAG, "╔══════════════════════════════════════════╗");
-    ESP_LOGI(TAG, "║  AUX1: Horn (hold) / Menu confirm        ║");
-    ESP_LOGI(TAG, "║  AUX2: Steering mode (1x/2x/3x press)    ║");
-    ESP_LOGI(TAG, "║        Hold 1.5s = Enter settings menu   ║");
-    ESP_LOGI(TAG, "║  AUX3: Throttle mode (3-pos switch)      ║");
-    ESP_LOGI(TAG, "║  AUX4: Engine on/off (press)             ║");
-    ESP_LOGI(TAG, "╠══════════════════════════════════════════╣");
-    ESP_LOGI(TAG, "║  Menu: Volume / Profile / WiFi           ║");
-    ESP_LOGI(TAG, "║  WiFi: %s / %s           ║", WIFI_AP_SSID, WIFI_AP_PASS);
-    ESP_LOGI(TAG, "║  (WiFi auto-enables if no RC for 5 sec)  ║");
-    ESP_LOGI(TAG, "╚══════════════════════════════════════════╝");
-    ESP_LOGI(TAG, "");
-    
-    // Set ESC and servos to safe positions
-    esc_set_neutral();
-    servo_center_all();
-    
-    // Brief delay to let RC receiver boot
-    ESP_LOGI(TAG, "Waiting for RC signal...");
-    vTaskDelay(pdMS_TO_TICKS(1000));
+        // Check if calibration is running (can be started via web UI)
+        uint32_t stage_cycles = perf_cycles();
+        bool calibrating = calibration_in_progress();
+        control_power_update(&rc_frame, calibrating);
 
-    // Check calibration status
-    if (!calibration_is_valid()) {
-        ESP_LOGW(TAG, "No valid calibration - use web UI to calibrate");
-    }
+        if (calibrating) {
+            // Update calibration to read current pulse values
+            calibration_update();
 
-    ESP_LOGI(TAG, "Starting normal operation...");
-    app_state = APP_STATE_RUNNING;
+            // Hold the ESC at neutral while the sticks are swept (keeps a
+            // DShot ESC fed and the output deadline from tripping)
+            static const output_frame_t neutral = { .esc_pulse = FAILSAFE_THROTTLE_US, .update_esc = true };
+            pwm_output_commit(&neutral);
+            control_set_state(APP_STATE_CALIBRATING);
+        } else {
+            // Check if we just finished calibration
+            if (control_get_state() == APP_STATE_CALIBRATING) {
+                ESP_LOGI(TAG, "Calibration finished, resuming normal operation");
+                control_set_state(APP_STATE_RUNNING);
+            }
 
-    // Initialize Task Watchdog Timer (5 second timeout)
-    // This will reset the device if the main loop hangs
-    ESP_LOGI(TAG, "Initializing watchdog timer...");
-    esp_task_wdt_config_t wdt_config = {
-        .timeout_ms = 5000,
-        .idle_core_mask = 0,  // Don't watch idle tasks
-        .trigger_panic = true  // Reset on timeout
-    };
-    ESP_ERROR_CHECK(esp_task_wdt_reconfigure(&wdt_config));
-    ESP_ERROR_CHECK(esp_task_wdt_add(NULL));  // Add current task to watchdog
+            // Normal operation (passes are sampled for /api/bench on request)
+            uint32_t pass_cycles = esp_cpu_get_cycle_count();
+            control_process(&rc_frame);
+            bench_control_sample(esp_cpu_get_cycle_count() - pass_cycles);
+        }
+        perf_stage_end(PERF_STAGE_CONTROL, stage_cycles);
 
-    ESP_LOGI(TAG, "");
-    ESP_LOGI(TAG, "╔══════════════════════════════════════════╗");
-    ESP_LOGI(TAG, "║            SYSTEM READY                  ║");
-    ESP_LOGI(TAG, "╚══════════════════════════════════════════╝");
-    ESP_LOGI(TAG, "");
+        publish_snapshot();
 
-    // Play boot chime to indicate system is ready
-    sound_play_boot_chime();
+        // Feed watchdog to prevent reset
+        esp_task_wdt_reset();
+        health_beat(HEALTH_TASK_CONTROL, 1000000 / control_rate_hz);
+        TIMELINE_MARK_END(TIMELINE_MARK_CONTROL);
 
-    // Engine starts OFF - user can start it with AUX3 short press
+        perf_loop_end(PERF_LOOP_CONTROL, tick_cycles, 1000000 / control_rate_hz);
+    }
+}
 
-    // Main control loop
+/**
+ * @brief Housekeeping task: auto-WiFi, LED state/animation, web status
+ *
+ * Runs at low priority from snapshots of the control state.
+ */
+static void housekeeping_task(void *arg)
+{
     uint32_t loop_count = 0;
     TickType_t last_wake_time = xTaskGetTickCount();
-    const TickType_t loop_period_ticks = pdMS_TO_TICKS(MAIN_LOOP_PERIOD_MS);
+    const TickType_t loop_period_ticks = pdMS_TO_TICKS(HOUSEKEEPING_PERIOD_MS);
+    control_snapshot_t snap;
+
+    ESP_ERROR_CHECK(esp_task_wdt_add(NULL));
 
     // Auto-WiFi: enable WiFi automatically if no RC signal for 5 seconds
     bool auto_wifi_enabled = false;
     #define AUTO_WIFI_TIMEOUT_MS 5000
 
-    while (1) {
-        // Check if calibration is running (can be started via web UI)
-        bool calibrating = calibration_in_progress();
+    uint32_t last_prof_log_ms = 0;
 
-        if (calibrating) {
-            // Update calibration to read current pulse values
-            calibration_update();
-            app_state = APP_STATE_CALIBRATING;
-        } else {
-            // Check if we just finished calibration
-            if (app_state == APP_STATE_CALIBRATING) {
-                ESP_LOGI(TAG, "Calibration finished, resuming normal operation");
-                app_state = APP_STATE_RUNNING;
-            }
+    // Battery alerts: prompt on entering low/critical, repeated while critical
+    battery_level_t battery_level_seen = BATTERY_LEVEL_UNKNOWN;
+    uint32_t battery_prompt_ms = 0;
 
-            // Normal operation
-            process_control_loop();
+    while (1) {
+        uint32_t tick_cycles = perf_cycles();
+        read_snapshot(&snap);
+
+        // Apply WiFi on/off chosen in the menu (too slow for the control task)
+        uint32_t stage_cycles = perf_cycles();
+        bool wifi_on;
+        if (menu_take_wifi_request(&wifi_on)) {
+            if (wifi_on) {
+                web_server_wifi_enable();
+            } else {
+                web_server_wifi_disable();
+            }
         }
 
         // Auto-WiFi: enable WiFi if no RC signal detected for 5 seconds
@@ -504,25 +431,42 @@ void app_main(void)
             }
             wifi_sta_was_connected = wifi_connected;
         }
+        perf_stage_end(PERF_STAGE_AUTO_WIFI, stage_cycles);
 
         // Update LED state based on system state (priority order)
+        stage_cycles = perf_cycles();
         led_state_t new_led_state = LED_STATE_IDLE;
         ota_progress_t ota = ota_get_progress();
         uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
 
+        battery_level_t battery_level = battery_get_level();
+        if (battery_level > battery_level_seen && battery_level >= BATTERY_LEVEL_LOW) {
+            sound_play(SOUND_BATTERY_LOW);
+            battery_prompt_ms = now_ms;
+        } else if (battery_level == BATTERY_LEVEL_CRITICAL &&
+                   (now_ms - battery_prompt_ms) >= BATTERY_ALERT_REPEAT_MS) {
+            sound_play(SOUND_BATTERY_LOW);
+            battery_prompt_ms = now_ms;
+        }
+        battery_level_seen = battery_level;
+
         if (ota.status == OTA_STATUS_IN_PROGRESS) {
             new_led_state = LED_STATE_OTA;
-        } else if (app_state == APP_STATE_CALIBRATING) {
+        } else if (snap.app_state == APP_STATE_CALIBRATING) {
             new_led_state = LED_STATE_CALIBRATING;
-        } else if (app_state == APP_STATE_FAILSAFE) {
+        } else if (snap.app_state == APP_STATE_FAILSAFE) {
             new_led_state = LED_STATE_FAILSAFE;
+        } else if (battery_level == BATTERY_LEVEL_CRITICAL) {
+            new_led_state = LED_STATE_BATTERY_CRITICAL;
         } else if (now_ms < wifi_switch_notify_until) {
             // WiFi switch changed - show on/off notification
             new_led_state = wifi_switch_notify_on ? LED_STATE_WIFI_ON : LED_STATE_WIFI_OFF;
         } else if (loop_count < wifi_notify_until) {
             // WiFi STA just connected
             new_led_state = LED_STATE_WIFI_CONNECTED;
-        } else if (app_state == APP_STATE_RUNNING) {
+        } else if (battery_level == BATTERY_LEVEL_LOW) {
+            new_led_state = LED_STATE_BATTERY_LOW;
+        } else if (snap.app_state == APP_STATE_RUNNING) {
             new_led_state = LED_STATE_RUNNING;
         } else {
             new_led_state = LED_STATE_IDLE;
@@ -534,24 +478,306 @@ void app_main(void)
             led_rgb_set_state(new_led_state);
         }
 
-        // Update LED animation
-        led_rgb_update();
+        // Update LED animation (first thing shed under load)
+        if (!perf_should_shed(PERF_SHED_LED)) {
+            led_rgb_update();
+        }
+
+        // Light strip renders in its own task from this state
+        lights_vehicle_t lights_state = {
+            .running = snap.app_state == APP_STATE_RUNNING,
+            .failsafe = snap.app_state == APP_STATE_FAILSAFE,
+            .braking = snap.vehicle.braking,
+            .reverse = snap.vehicle.reversing,
+            .steering = snap.frame.ch[RC_CH_STEERING].value,
+        };
+        lights_set_vehicle(&lights_state);
+        perf_stage_end(PERF_STAGE_LED, stage_cycles);
 
         // Only update web server stuff if WiFi is on
         if (web_server_wifi_is_enabled()) {
             // Update servo test mode timeout
-            web_server_update_servo_test();
+            if (!perf_should_shed(PERF_SHED_SERVO_TEST)) {
+                stage_cycles = perf_cycles();
+                web_server_update_servo_test();
+                perf_stage_end(PERF_STAGE_SERVO_TEST, stage_cycles);
+            }
 
             // Update web UI
-            update_status();
+            if (!perf_should_shed(PERF_SHED_STATUS)) {
+                stage_cycles = perf_cycles();
+                update_status(&snap);
+                perf_stage_end(PERF_STAGE_STATUS, stage_cycles);
+            }
+
+            // Stage profile to the UDP log
+            if (now_ms - last_prof_log_ms >= PERF_LOG_INTERVAL_MS) {
+                last_prof_log_ms = now_ms;
+                perf_log_stages();
+            }
         }
 
         // Feed watchdog to prevent reset
         esp_task_wdt_reset();
+        health_beat(HEALTH_TASK_HOUSEKEEPING, HOUSEKEEPING_PERIOD_MS * 1000);
 
-        // Maintain consistent loop timing (compensates for execution time)
+        perf_loop_end(PERF_LOOP_HOUSEKEEPING, tick_cycles, HOUSEKEEPING_PERIOD_MS * 1000);
         vTaskDelayUntil(&last_wake_time, loop_period_ticks);
-
         loop_count++;
     }
 }
+
+// Audio bring-up result, handed back to app_main() when the task finishes
+static esp_err_t audio_init_result = ESP_OK;
+static TaskHandle_t audio_init_waiter = NULL;
+
+/**
+ * @brief Bring up the sound chain while app_main() initializes the rest
+ *
+ * I2S, the sound pack and engine samples only depend on NVS, so they load
+ * on the control core (idle until the control task starts) in parallel
+ * with RC, PWM, calibration, tuning and the web server.
+ */
+static void audio_init_task(void *arg)
+{
+    esp_err_t err = sound_init();
+    if (err == ESP_OK) {
+        // Map the sound pack (if flashed) so its profiles resolve at engine init
+        err = sound_pack_init();
+    }
+    if (err == ESP_OK) {
+        err = engine_sound_init();
+    }
+    if (err == ESP_OK) {
+        // Start the audio mixer (sole I2S writer for engine + UI sound)
+        err = audio_mixer_init();
+    }
+    perf_boot_mark("audio");
+
+    audio_init_result = err;
+    xTaskNotifyGive(audio_init_waiter);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Wait for the receiver's first throttle+steering frame, up to a timeout
+ *
+ * The receiver usually boots while the rest of the system initializes, so
+ * this rarely waits at all.
+ */
+static void wait_for_rc_signal(void)
+{
+    const uint32_t start_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    while (!(rc_input_channel_valid(RC_CH_THROTTLE) && rc_input_channel_valid(RC_CH_STEERING))) {
+        if ((uint32_t)(esp_timer_get_time() / 1000) - start_ms >= RC_BOOT_WAIT_MS) {
+            ESP_LOGW(TAG, "No RC signal after %d ms, starting anyway", RC_BOOT_WAIT_MS);
+            return;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    ESP_LOGI(TAG, "RC signal after %lu ms",
+             (unsigned long)((uint32_t)(esp_timer_get_time() / 1000) - start_ms));
+}
+
+/**
+ * @brief Main application entry point
+ */
+void app_main(void)
+{
+    print_banner();
+    
+    // Latency instrumentation first so every later stage can record into it
+    perf_init();
+    perf_boot_mark("start");
+
+    // Clock scaling before any task can take a lock
+    ESP_ERROR_CHECK(power_init());
+
+    // Initialize NVS (required for calibration storage)
+    ESP_LOGI(TAG, "Initializing NVS...");
+    ESP_ERROR_CHECK(nvs_storage_init());
+    perf_boot_mark("nvs");
+
+    // Initialize PWM outputs (ESC + servos) and park them straight away
+    ESP_LOGI(TAG, "Initializing PWM outputs...");
+    ESP_ERROR_CHECK(pwm_output_init());
+    esc_set_neutral();
+    servo_center_all();
+    perf_boot_mark("pwm");
+
+    // Initialize RC input capture early so the receiver's first frame
+    // is usually in by the time init finishes
+    ESP_LOGI(TAG, "Initializing RC input...");
+    ESP_ERROR_CHECK(rc_input_init());
+    perf_boot_mark("rc");
+
+    // Sound chain loads on the control core while the rest initializes
+    audio_init_waiter = xTaskGetCurrentTaskHandle();
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        audio_init_task,
+        "audio_init",
+        AUDIO_INIT_TASK_STACK_SIZE,
+        NULL,
+        AUDIO_INIT_TASK_PRIORITY,
+        NULL,
+        CONTROL_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create audio init task");
+        abort();
+    }
+
+    // Initialize status LED
+    // Initialize RGB LED (shows rainbow boot animation)
+    ESP_LOGI(TAG, "Initializing RGB LED...");
+    ESP_ERROR_CHECK(led_rgb_init());
+
+    // Light strip (own RMT DMA channel and render task)
+    ESP_ERROR_CHECK(lights_init());
+    perf_boot_mark("led");
+
+    // Initialize calibration system (loads from NVS or defaults)
+    ESP_LOGI(TAG, "Initializing calibration...");
+    calibration_data_t cal_data;
+    ESP_ERROR_CHECK(calibration_init(&cal_data));
+
+    // Initialize tuning system (loads from NVS or defaults)
+    ESP_LOGI(TAG, "Initializing tuning...");
+    ESP_ERROR_CHECK(tuning_init(NULL));
+    const tuning_config_t *tune = tuning_get_config();
+    pwm_output_set_rates(tune->output.esc_rate_hz, tune->output.servo_rate_hz);
+    perf_boot_mark("tuning");
+
+    // Battery sensing (feeds the ESC sag gain; the vehicle runs without it)
+    if (battery_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Battery sensing unavailable");
+    }
+
+    // Flight recorder and black box (each runs without if there is no memory/partition)
+    trace_init();
+    blackbox_init();
+#if CONFIG_CRAWLER_TIMELINE
+    timeline_init();
+#endif
+    perf_boot_mark("trace");
+
+    // Initialize mode switch (starts in Front steering mode)
+    ESP_LOGI(TAG, "Initializing mode switch...");
+    mode_switch_init();
+
+    // Initialize menu system (registers long-press callback with mode_switch)
+    ESP_LOGI(TAG, "Initializing menu system...");
+    menu_init();
+
+    // Initialize web server (WiFi OFF by default - use menu to enable)
+    ESP_LOGI(TAG, "Initializing web server (WiFi OFF)...");
+    ESP_ERROR_CHECK(web_server_init_no_wifi());
+#if RC_INPUT_BACKEND == RC_BACKEND_ESPNOW
+    // The RC link needs the radio from boot
+    web_server_wifi_enable();
+#endif
+    perf_boot_mark("web");
+
+    // Join the sound chain before anything can play
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    ESP_ERROR_CHECK(audio_init_result);
+
+    // Preset bank (seeds from the tuning and sound config just loaded)
+    ESP_ERROR_CHECK(preset_init());
+
+    // OTA update module (initialized when WiFi is enabled)
+    // Note: OTA only works when WiFi is on
+
+    // Mark this firmware as valid (cancels automatic rollback)
+    ota_mark_valid();
+
+    ESP_LOGI(TAG, "");
+    ESP_LOGI(TAG, "╔══════════════════════════════════════════╗");
+    ESP_LOGI(TAG, "║  AUX1: Horn (hold) / Menu confirm        ║");
+    ESP_LOGI(TAG, "║  AUX2: Steering mode (1x/2x/3x press)    ║");
+    ESP_LOGI(TAG, "║        Hold 1.5s = Enter settings menu   ║");
+    ESP_LOGI(TAG, "║  AUX3: Throttle mode (3-pos switch)      ║");
+    ESP_LOGI(TAG, "║  AUX4: Engine on/off (press)             ║");
+    ESP_LOGI(TAG, "╠══════════════════════════════════════════╣");
+    ESP_LOGI(TAG, "║  Menu: Volume / Profile / WiFi           ║");
+    ESP_LOGI(TAG, "║  WiFi: %s / %s           ║", WIFI_AP_SSID, WIFI_AP_PASS);
+    ESP_LOGI(TAG, "║  (WiFi auto-enables if no RC for 5 sec)  ║");
+    ESP_LOGI(TAG, "╚══════════════════════════════════════════╝");
+    ESP_LOGI(TAG, "");
+    
+    // Proceed as soon as the receiver sends a frame (outputs are already neutral)
+    ESP_LOGI(TAG, "Waiting for RC signal...");
+    wait_for_rc_signal();
+    perf_boot_mark("signal");
+
+    // Check calibration status
+    if (!calibration_is_valid()) {
+        ESP_LOGW(TAG, "No valid calibration - use web UI to calibrate");
+    }
+
+    ESP_LOGI(TAG, "Starting normal operation...");
+    control_set_state(APP_STATE_RUNNING);
+
+    // Initialize Task Watchdog Timer (5 second timeout)
+    // This will reset the device if the control or housekeeping loop hangs
+    ESP_LOGI(TAG, "Initializing watchdog timer...");
+    esp_task_wdt_config_t wdt_config = {
+        .timeout_ms = 5000,
+        .idle_core_mask = 0,  // Don't watch idle tasks
+        .trigger_panic = true  // Reset on timeout
+    };
+    ESP_ERROR_CHECK(esp_task_wdt_reconfigure(&wdt_config));
+    // Control, housekeeping and health monitor tasks each subscribe themselves
+
+    // Heartbeat monitor: stall times per task, graded responses before the TWDT
+    ESP_ERROR_CHECK(health_init());
+
+    ESP_LOGI(TAG, "");
+    ESP_LOGI(TAG, "╔══════════════════════════════════════════╗");
+    ESP_LOGI(TAG, "║            SYSTEM READY                  ║");
+    ESP_LOGI(TAG, "╚══════════════════════════════════════════╝");
+    ESP_LOGI(TAG, "");
+
+    // Play boot chime to indicate system is ready
+    sound_play_boot_chime();
+
+    // Engine starts OFF - user can start it with AUX3 short press
+
+    // Control path gets its own task so web/WiFi/LED work can't delay outputs
+    ret = xTaskCreatePinnedToCore(
+        control_task,
+        "control",
+        CONTROL_TASK_STACK_SIZE,
+        NULL,
+        CONTROL_TASK_PRIORITY,
+        NULL,
+        CONTROL_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create control task");
+        abort();
+    }
+
+    ret = xTaskCreatePinnedToCore(
+        housekeeping_task,
+        "housekeeping",
+        HOUSEKEEPING_TASK_STACK_SIZE,
+        NULL,
+        HOUSEKEEPING_TASK_PRIORITY,
+        NULL,
+        HOUSEKEEPING_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create housekeeping task");
+        abort();
+    }
+
+    // Per-task CPU and stack use for /api/tasks (runs without if it can't start)
+    task_stats_init();
+
+    perf_boot_mark("ready");
+    perf_boot_log();
+
+    // app_main returns; the main task is deleted and the two tasks take over
+}
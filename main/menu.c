@@ -16,36 +16,16 @@
 #include "web_server.h"
 #include "nvs_storage.h"
 #include "tuning.h"
+#include "preset.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_timer.h"
 #include "esp_log.h"
 
-// TTS sound samples
-#include "sounds/menu/menu_enter.h"
-#include "sounds/menu/menu_back.h"
-#include "sounds/menu/menu_confirm.h"
-#include "sounds/menu/menu_cancel.h"
-#include "sounds/menu/cat_volume.h"
-#include "sounds/menu/cat_profile.h"
-#include "sounds/menu/cat_horn.h"
-#include "sounds/menu/cat_wifi.h"
-#include "sounds/menu/cat_steering.h"
-#include "sounds/menu/opt_vol_low.h"
-#include "sounds/menu/opt_vol_medium.h"
-#include "sounds/menu/opt_vol_high.h"
-#include "sounds/menu/opt_profile_cat.h"
-#include "sounds/menu/opt_profile_unimog.h"
-#include "sounds/menu/opt_profile_man.h"
-#include "sounds/menu/opt_horn_truck.h"
-#include "sounds/menu/opt_horn_mantge.h"
-#include "sounds/menu/opt_horn_cucaracha.h"
-#include "sounds/menu/opt_horn_2tone.h"
-#include "sounds/menu/opt_horn_dixie.h"
-#include "sounds/menu/opt_horn_peterbilt.h"
-#include "sounds/menu/opt_horn_outlaw.h"
-#include "sounds/menu/opt_on.h"
-#include "sounds/menu/opt_off.h"
+#if CONFIG_CRAWLER_SOUND_MENU_PROMPTS
+// TTS sound samples (embedded from tools/tts_wav at build time)
+#include "menu_sounds.h"
+#endif
 
 static const char *TAG = "MENU";
 
@@ -53,6 +33,17 @@ static const char *TAG = "MENU";
 #define MENU_LONGPRESS_MS       1500    // Long-press to enter menu / back / exit
 #define MENU_TIMEOUT_MS         10000   // Auto-exit timeout (10 seconds)
 #define MENU_DEBOUNCE_MS        50      // Button debounce
+#define MENU_PROMPT_VOLUME      80      // TTS prompt volume (0-100)
+
+#if CONFIG_CRAWLER_SOUND_MENU_PROMPTS
+// Sample pointer, count and rate of a menu_sounds.h prompt
+#define MENU_PROMPT(name)       menu_##name##Samples, menu_##name##SampleCount, menu_##name##SampleRate
+#else
+// Prompts compiled out: play_prompt() beeps instead
+#define MENU_PROMPT(name)       NULL, 0, 0
+#endif
+
+_Static_assert(PRESET_COUNT <= MENU_PRESET_PROMPTS, "Add menu prompts for the extra presets");
 
 // Menu state
 static menu_state_t state = MENU_STATE_INACTIVE;
@@ -67,15 +58,117 @@ static bool aux2_longpress_handled = false;
 
 static bool aux1_was_pressed = false;
 
+// WiFi on/off selected in the menu, applied by housekeeping (-1 = none).
+// Starting/stopping WiFi takes too long to do from the control task.
+static volatile int8_t pending_wifi = -1;
+
+// A profile or horn option: its ID and prompt
+typedef struct {
+    uint8_t id;                 // sound_profile_t / horn_type_t
+    const int8_t *samples;
+    uint32_t count;
+    uint32_t rate;
+} menu_choice_t;
+
+// Only what the build compiled in (Kconfig "Crawler sound content"). The
+// Synth V8 profile has no prompt and is selected from the web UI.
+static const menu_choice_t profile_choices[] = {
+#if CONFIG_CRAWLER_SOUND_PROFILE_CAT3408
+    { SOUND_PROFILE_CAT_3408, MENU_PROMPT(opt_profile_cat) },
+#endif
+#if CONFIG_CRAWLER_SOUND_PROFILE_UNIMOG
+    { SOUND_PROFILE_UNIMOG_U1000, MENU_PROMPT(opt_profile_unimog) },
+#endif
+#if CONFIG_CRAWLER_SOUND_PROFILE_MANTGX
+    { SOUND_PROFILE_MAN_TGX, MENU_PROMPT(opt_profile_man) },
+#endif
+};
+
+static const menu_choice_t horn_choices[] = {
+#if CONFIG_CRAWLER_SOUND_HORN_TRUCK
+    { HORN_TYPE_TRUCK, MENU_PROMPT(opt_horn_truck) },
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_MANTGE
+    { HORN_TYPE_MANTGE, MENU_PROMPT(opt_horn_mantge) },
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_CUCARACHA
+    { HORN_TYPE_CUCARACHA, MENU_PROMPT(opt_horn_cucaracha) },
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_2TONE
+    { HORN_TYPE_2TONE, MENU_PROMPT(opt_horn_2tone) },
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_DIXIE
+    { HORN_TYPE_DIXIE, MENU_PROMPT(opt_horn_dixie) },
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_PETERBILT
+    { HORN_TYPE_PETERBILT, MENU_PROMPT(opt_horn_peterbilt) },
+#endif
+#if CONFIG_CRAWLER_SOUND_HORN_OUTLAW
+    { HORN_TYPE_OUTLAW, MENU_PROMPT(opt_horn_outlaw) },
+#endif
+};
+
+#define PROFILE_CHOICE_COUNT    (sizeof(profile_choices) / sizeof(profile_choices[0]))
+#define HORN_CHOICE_COUNT       (sizeof(horn_choices) / sizeof(horn_choices[0]))
+
 // Forward declarations
 static void enter_menu(void);
 static void exit_menu(bool cancelled);
-static void play_category_sound(uint8_t cat);
-static void play_option_sound(uint8_t cat, uint8_t opt);
+static void play_category_sound(uint8_t cat, bool barge_in);
+static void play_option_sound(uint8_t cat, uint8_t opt, bool barge_in);
 static uint8_t get_current_option(uint8_t cat);
 static void apply_option(uint8_t cat, uint8_t opt);
 static uint8_t get_option_count(uint8_t cat);
 
+/**
+ * @brief Queue a TTS prompt on the audio mixer (never blocks the control loop)
+ * @param barge_in true to cut off the prompt that is playing
+ */
+static void play_prompt(const int8_t *samples, uint32_t count, uint32_t rate, bool barge_in)
+{
+#if CONFIG_CRAWLER_SOUND_MENU_PROMPTS
+    sound_play_prompt(samples, count, rate, MENU_PROMPT_VOLUME, barge_in);
+#else
+    (void)samples; (void)count; (void)rate;
+    sound_play_count_beeps(1, MENU_PROMPT_VOLUME, barge_in);
+#endif
+}
+
+/**
+ * @brief Position of an ID in a choice table (0 if absent)
+ */
+static uint8_t choice_index(const menu_choice_t *choices, size_t count, uint8_t id)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (choices[i].id == id) {
+            return (uint8_t)i;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Readable name of an option (for the log)
+ * @param buf Scratch space for preset names
+ */
+static const char *option_name(uint8_t cat, uint8_t opt, char *buf)
+{
+    switch (cat) {
+        case MENU_CAT_VOLUME:
+            return opt == MENU_VOL_LOW ? "Low" : opt == MENU_VOL_MEDIUM ? "Medium" : "High";
+        case MENU_CAT_PROFILE:
+            return opt < PROFILE_CHOICE_COUNT ? sound_profiles_get_name(profile_choices[opt].id) : "?";
+        case MENU_CAT_HORN:
+            return opt < HORN_CHOICE_COUNT ? engine_sound_horn_name(horn_choices[opt].id) : "?";
+        case MENU_CAT_STEERING:
+            return opt == MENU_STEERING_ON ? "On" : "Off";
+        case MENU_CAT_PRESET:
+            return preset_get_name(opt, buf) ? buf : "?";
+        default:
+            return opt == MENU_WIFI_ON ? "On" : "Off";
+    }
+}
+
 /**
  * @brief Long-press callback from mode_switch module
  *
@@ -109,18 +202,14 @@ static void enter_menu(void)
     // Disable steering mode changes while in menu
     mode_switch_set_enabled(false);
 
-    // Mute engine sound during menu (so TTS is clear)
-    engine_sound_enable(false);
-
-    // Play "Menu" TTS
-    sound_play_sample(menu_menu_enterSamples, menu_menu_enterSampleCount,
-                      menu_menu_enterSampleRate, 80);
+    // Fade the engine out during the menu (so TTS is clear); it keeps running
+    engine_sound_set_muted(true);
 
-    // Then play current category
-    vTaskDelay(pdMS_TO_TICKS(200));
-    const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi"};
+    // Play "Menu" TTS, then the current category
+    play_prompt(MENU_PROMPT(menu_enter), true);
+    const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi", "Preset"};
     ESP_LOGI(TAG, "Category: %s", cat_names[category_index]);
-    play_category_sound(category_index);
+    play_category_sound(category_index, false);
 }
 
 /**
@@ -143,45 +232,44 @@ static void exit_menu(bool cancelled)
 
     if (cancelled) {
         // Play "Cancel" TTS
-        sound_play_sample(menu_menu_cancelSamples, menu_menu_cancelSampleCount,
-                          menu_menu_cancelSampleRate, 80);
+        play_prompt(MENU_PROMPT(menu_cancel), true);
     }
     // If not cancelled, confirm sound was already played
 
-    // Re-enable engine sound after TTS plays
-    vTaskDelay(pdMS_TO_TICKS(100));
-    engine_sound_enable(true);
+    // The engine fades back in, ducked under the closing prompt
+    engine_sound_set_muted(false);
 }
 
 /**
  * @brief Play category indication sound (TTS)
  */
-static void play_category_sound(uint8_t cat)
+static void play_category_sound(uint8_t cat, bool barge_in)
 {
+#if !CONFIG_CRAWLER_SOUND_MENU_PROMPTS
+    sound_play_count_beeps(cat + 1, MENU_PROMPT_VOLUME, barge_in);
+    return;
+#endif
     switch (cat) {
         case MENU_CAT_VOLUME:
-            sound_play_sample(menu_cat_volumeSamples, menu_cat_volumeSampleCount,
-                              menu_cat_volumeSampleRate, 80);
+            play_prompt(MENU_PROMPT(cat_volume), barge_in);
             break;
         case MENU_CAT_PROFILE:
-            sound_play_sample(menu_cat_profileSamples, menu_cat_profileSampleCount,
-                              menu_cat_profileSampleRate, 80);
+            play_prompt(MENU_PROMPT(cat_profile), barge_in);
             break;
         case MENU_CAT_HORN:
-            sound_play_sample(menu_cat_hornSamples, menu_cat_hornSampleCount,
-                              menu_cat_hornSampleRate, 80);
+            play_prompt(MENU_PROMPT(cat_horn), barge_in);
             break;
         case MENU_CAT_STEERING:
-            sound_play_sample(menu_cat_steeringSamples, menu_cat_steeringSampleCount,
-                              menu_cat_steeringSampleRate, 80);
+            play_prompt(MENU_PROMPT(cat_steering), barge_in);
             break;
         case MENU_CAT_WIFI:
-            sound_play_sample(menu_cat_wifiSamples, menu_cat_wifiSampleCount,
-                              menu_cat_wifiSampleRate, 80);
+            play_prompt(MENU_PROMPT(cat_wifi), barge_in);
+            break;
+        case MENU_CAT_PRESET:
+            play_prompt(MENU_PROMPT(cat_preset), barge_in);
             break;
         default:
-            sound_play_sample(menu_cat_volumeSamples, menu_cat_volumeSampleCount,
-                              menu_cat_volumeSampleRate, 80);
+            play_prompt(MENU_PROMPT(cat_volume), barge_in);
             break;
     }
 }
@@ -189,93 +277,71 @@ static void play_category_sound(uint8_t cat)
 /**
  * @brief Play option indication sound (TTS)
  */
-static void play_option_sound(uint8_t cat, uint8_t opt)
+static void play_option_sound(uint8_t cat, uint8_t opt, bool barge_in)
 {
+#if !CONFIG_CRAWLER_SOUND_MENU_PROMPTS
+    sound_play_count_beeps(opt + 1, MENU_PROMPT_VOLUME, barge_in);
+    return;
+#endif
     switch (cat) {
         case MENU_CAT_VOLUME:
             switch (opt) {
                 case MENU_VOL_LOW:
-                    sound_play_sample(menu_opt_vol_lowSamples, menu_opt_vol_lowSampleCount,
-                                      menu_opt_vol_lowSampleRate, 80);
+                    play_prompt(MENU_PROMPT(opt_vol_low), barge_in);
                     break;
                 case MENU_VOL_MEDIUM:
-                    sound_play_sample(menu_opt_vol_mediumSamples, menu_opt_vol_mediumSampleCount,
-                                      menu_opt_vol_mediumSampleRate, 80);
+                    play_prompt(MENU_PROMPT(opt_vol_medium), barge_in);
                     break;
                 case MENU_VOL_HIGH:
-                    sound_play_sample(menu_opt_vol_highSamples, menu_opt_vol_highSampleCount,
-                                      menu_opt_vol_highSampleRate, 80);
+                    play_prompt(MENU_PROMPT(opt_vol_high), barge_in);
                     break;
             }
             break;
 
         case MENU_CAT_PROFILE:
-            switch (opt) {
-                case MENU_PROFILE_CAT:
-                    sound_play_sample(menu_opt_profile_catSamples, menu_opt_profile_catSampleCount,
-                                      menu_opt_profile_catSampleRate, 80);
-                    break;
-                case MENU_PROFILE_UNIMOG:
-                    sound_play_sample(menu_opt_profile_unimogSamples, menu_opt_profile_unimogSampleCount,
-                                      menu_opt_profile_unimogSampleRate, 80);
-                    break;
-                case MENU_PROFILE_MAN:
-                    sound_play_sample(menu_opt_profile_manSamples, menu_opt_profile_manSampleCount,
-                                      menu_opt_profile_manSampleRate, 80);
-                    break;
+            if (opt < PROFILE_CHOICE_COUNT) {
+                const menu_choice_t *c = &profile_choices[opt];
+                play_prompt(c->samples, c->count, c->rate, barge_in);
             }
             break;
 
         case MENU_CAT_HORN:
-            switch (opt) {
-                case MENU_HORN_TRUCK:
-                    sound_play_sample(menu_opt_horn_truckSamples, menu_opt_horn_truckSampleCount,
-                                      menu_opt_horn_truckSampleRate, 80);
-                    break;
-                case MENU_HORN_MANTGE:
-                    sound_play_sample(menu_opt_horn_mantgeSamples, menu_opt_horn_mantgeSampleCount,
-                                      menu_opt_horn_mantgeSampleRate, 80);
-                    break;
-                case MENU_HORN_CUCARACHA:
-                    sound_play_sample(menu_opt_horn_cucarachaSamples, menu_opt_horn_cucarachaSampleCount,
-                                      menu_opt_horn_cucarachaSampleRate, 80);
-                    break;
-                case MENU_HORN_2TONE:
-                    sound_play_sample(menu_opt_horn_2toneSamples, menu_opt_horn_2toneSampleCount,
-                                      menu_opt_horn_2toneSampleRate, 80);
-                    break;
-                case MENU_HORN_DIXIE:
-                    sound_play_sample(menu_opt_horn_dixieSamples, menu_opt_horn_dixieSampleCount,
-                                      menu_opt_horn_dixieSampleRate, 80);
-                    break;
-                case MENU_HORN_PETERBILT:
-                    sound_play_sample(menu_opt_horn_peterbiltSamples, menu_opt_horn_peterbiltSampleCount,
-                                      menu_opt_horn_peterbiltSampleRate, 80);
-                    break;
-                case MENU_HORN_OUTLAW:
-                    sound_play_sample(menu_opt_horn_outlawSamples, menu_opt_horn_outlawSampleCount,
-                                      menu_opt_horn_outlawSampleRate, 80);
-                    break;
+            if (opt < HORN_CHOICE_COUNT) {
+                const menu_choice_t *c = &horn_choices[opt];
+                play_prompt(c->samples, c->count, c->rate, barge_in);
             }
             break;
 
         case MENU_CAT_WIFI:
             if (opt == MENU_WIFI_ON) {
-                sound_play_sample(menu_opt_onSamples, menu_opt_onSampleCount,
-                                  menu_opt_onSampleRate, 80);
+                play_prompt(MENU_PROMPT(opt_on), barge_in);
             } else {
-                sound_play_sample(menu_opt_offSamples, menu_opt_offSampleCount,
-                                  menu_opt_offSampleRate, 80);
+                play_prompt(MENU_PROMPT(opt_off), barge_in);
             }
             break;
 
         case MENU_CAT_STEERING:
             if (opt == MENU_STEERING_ON) {
-                sound_play_sample(menu_opt_onSamples, menu_opt_onSampleCount,
-                                  menu_opt_onSampleRate, 80);
+                play_prompt(MENU_PROMPT(opt_on), barge_in);
             } else {
-                sound_play_sample(menu_opt_offSamples, menu_opt_offSampleCount,
-                                  menu_opt_offSampleRate, 80);
+                play_prompt(MENU_PROMPT(opt_off), barge_in);
+            }
+            break;
+
+        case MENU_CAT_PRESET:
+            switch (opt) {
+                case 0:
+                    play_prompt(MENU_PROMPT(opt_preset_1), barge_in);
+                    break;
+                case 1:
+                    play_prompt(MENU_PROMPT(opt_preset_2), barge_in);
+                    break;
+                case 2:
+                    play_prompt(MENU_PROMPT(opt_preset_3), barge_in);
+                    break;
+                case 3:
+                    play_prompt(MENU_PROMPT(opt_preset_4), barge_in);
+                    break;
             }
             break;
     }
@@ -292,11 +358,11 @@ static uint8_t get_current_option(uint8_t cat)
             return engine_sound_get_current_volume_preset_index();
 
         case MENU_CAT_PROFILE:
-            return (uint8_t)engine_sound_get_profile();
+            return choice_index(profile_choices, PROFILE_CHOICE_COUNT, (uint8_t)engine_sound_get_profile());
 
         case MENU_CAT_HORN: {
             const engine_sound_config_t *cfg = engine_sound_get_config();
-            return (uint8_t)cfg->horn_type;
+            return choice_index(horn_choices, HORN_CHOICE_COUNT, (uint8_t)cfg->horn_type);
         }
 
         case MENU_CAT_WIFI:
@@ -305,6 +371,9 @@ static uint8_t get_current_option(uint8_t cat)
         case MENU_CAT_STEERING:
             return tuning_is_realistic_steering_enabled() ? MENU_STEERING_ON : MENU_STEERING_OFF;
 
+        case MENU_CAT_PRESET:
+            return preset_get_active();
+
         default:
             return 0;
     }
@@ -319,13 +388,15 @@ static uint8_t get_option_count(uint8_t cat)
         case MENU_CAT_VOLUME:
             return MENU_VOL_COUNT;
         case MENU_CAT_PROFILE:
-            return MENU_PROFILE_COUNT;
+            return PROFILE_CHOICE_COUNT;
         case MENU_CAT_HORN:
-            return MENU_HORN_COUNT;
+            return HORN_CHOICE_COUNT;
         case MENU_CAT_WIFI:
             return MENU_WIFI_COUNT;
         case MENU_CAT_STEERING:
             return MENU_STEERING_COUNT;
+        case MENU_CAT_PRESET:
+            return PRESET_COUNT;
         default:
             return 1;
     }
@@ -347,38 +418,34 @@ static void apply_option(uint8_t cat, uint8_t opt)
         }
 
         case MENU_CAT_PROFILE: {
-            sound_profile_t profile = (sound_profile_t)opt;
-            ESP_LOGI(TAG, "Setting profile to %d", opt);
+            if (opt >= PROFILE_CHOICE_COUNT) break;
+            sound_profile_t profile = (sound_profile_t)profile_choices[opt].id;
+            ESP_LOGI(TAG, "Setting profile to %s", sound_profiles_get_name(profile));
             engine_sound_set_profile(profile);
 
             // Save to NVS
             const engine_sound_config_t *current = engine_sound_get_config();
-            nvs_save_sound_config(current, sizeof(engine_sound_config_t));
+            nvs_storage_save_deferred(NVS_BLOB_SOUND, current, sizeof(engine_sound_config_t));
             break;
         }
 
         case MENU_CAT_HORN: {
-            horn_type_t horn = (horn_type_t)opt;
-            const char *horn_names[] = {"Truck", "MAN TGE", "La Cucaracha", "2-Tone", "Dixie", "Peterbilt", "Outlaw"};
-            ESP_LOGI(TAG, "Setting horn to %s", horn_names[opt]);
+            if (opt >= HORN_CHOICE_COUNT) break;
+            horn_type_t horn = (horn_type_t)horn_choices[opt].id;
+            ESP_LOGI(TAG, "Setting horn to %s", engine_sound_horn_name(horn));
 
             // Get current config, update horn type, save
             const engine_sound_config_t *current = engine_sound_get_config();
             engine_sound_config_t new_config = *current;
             new_config.horn_type = horn;
             engine_sound_set_config(&new_config);
-            nvs_save_sound_config(&new_config, sizeof(engine_sound_config_t));
+            nvs_storage_save_deferred(NVS_BLOB_SOUND, &new_config, sizeof(engine_sound_config_t));
             break;
         }
 
         case MENU_CAT_WIFI:
-            if (opt == MENU_WIFI_ON) {
-                ESP_LOGI(TAG, "Enabling WiFi");
-                web_server_wifi_enable();
-            } else {
-                ESP_LOGI(TAG, "Disabling WiFi");
-                web_server_wifi_disable();
-            }
+            ESP_LOGI(TAG, "%s WiFi", opt == MENU_WIFI_ON ? "Enabling" : "Disabling");
+            pending_wifi = (opt == MENU_WIFI_ON) ? 1 : 0;
             break;
 
         case MENU_CAT_STEERING: {
@@ -393,6 +460,12 @@ static void apply_option(uint8_t cat, uint8_t opt)
             tuning_save();
             break;
         }
+
+        case MENU_CAT_PRESET:
+            // The preset task builds the tables; the control task only swaps them in
+            ESP_LOGI(TAG, "Switching to preset %d", opt);
+            preset_select(opt);
+            break;
     }
 }
 
@@ -458,11 +531,9 @@ void menu_update(bool aux2_pressed)
                 // Long-press in Level 2: back to Level 1
                 ESP_LOGI(TAG, "Long-press in Level 2 -> back to Level 1");
                 state = MENU_STATE_LEVEL1;
-                // Play "Back" TTS
-                sound_play_sample(menu_menu_backSamples, menu_menu_backSampleCount,
-                                  menu_menu_backSampleRate, 80);
-                vTaskDelay(pdMS_TO_TICKS(200));
-                play_category_sound(category_index);
+                // Play "Back" TTS, then the category
+                play_prompt(MENU_PROMPT(menu_back), true);
+                play_category_sound(category_index, false);
             }
         }
     }
@@ -473,34 +544,23 @@ void menu_update(bool aux2_pressed)
             last_activity_time = now_ms;
 
             if (state == MENU_STATE_LEVEL1) {
-                // Cycle to next category
-                category_index = (category_index + 1) % MENU_CAT_COUNT;
-                const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi"};
+                // Cycle to next category, skipping any left without options
+                do {
+                    category_index = (category_index + 1) % MENU_CAT_COUNT;
+                } while (get_option_count(category_index) == 0);
+                const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi", "Preset"};
                 ESP_LOGI(TAG, "Category: %s (%d beeps)", cat_names[category_index], category_index + 1);
-                play_category_sound(category_index);
+                play_category_sound(category_index, true);
             } else if (state == MENU_STATE_LEVEL2) {
                 // Cycle to next option
                 uint8_t count = get_option_count(category_index);
                 option_index = (option_index + 1) % count;
 
                 // Log with readable option name
-                const char *opt_name;
-                if (category_index == MENU_CAT_VOLUME) {
-                    opt_name = option_index == MENU_VOL_LOW ? "Low" :
-                               option_index == MENU_VOL_MEDIUM ? "Medium" : "High";
-                } else if (category_index == MENU_CAT_PROFILE) {
-                    opt_name = option_index == MENU_PROFILE_CAT ? "CAT 3408" :
-                               option_index == MENU_PROFILE_UNIMOG ? "Unimog" : "MAN TGX";
-                } else if (category_index == MENU_CAT_HORN) {
-                    const char *horn_names[] = {"Truck", "MAN TGE", "La Cucaracha", "2-Tone", "Dixie", "Peterbilt", "Outlaw"};
-                    opt_name = horn_names[option_index < MENU_HORN_COUNT ? option_index : 0];
-                } else if (category_index == MENU_CAT_STEERING) {
-                    opt_name = option_index == MENU_STEERING_ON ? "On" : "Off";
-                } else {
-                    opt_name = option_index == MENU_WIFI_ON ? "On" : "Off";
-                }
-                ESP_LOGI(TAG, "Option: %s (%d beeps)", opt_name, option_index + 1);
-                play_option_sound(category_index, option_index);
+                char preset_name[PRESET_NAME_LEN];
+                ESP_LOGI(TAG, "Option: %s (%d beeps)",
+                         option_name(category_index, option_index, preset_name), option_index + 1);
+                play_option_sound(category_index, option_index, true);
             }
         }
     }
@@ -529,37 +589,23 @@ void menu_handle_confirm(bool aux1_pressed)
             state = MENU_STATE_LEVEL2;
             option_index = get_current_option(category_index);
 
-            const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi"};
+            const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi", "Preset"};
             ESP_LOGI(TAG, "=== ENTERING %s (Level 2, option %d) ===", cat_names[category_index], option_index);
 
             // Play current option TTS (no need for transition sound with TTS)
-            play_option_sound(category_index, option_index);
+            play_option_sound(category_index, option_index, true);
         } else if (state == MENU_STATE_LEVEL2) {
             // Confirm selection - log with readable names
-            const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi"};
-            const char *opt_name;
-            if (category_index == MENU_CAT_VOLUME) {
-                opt_name = option_index == MENU_VOL_LOW ? "Low" :
-                           option_index == MENU_VOL_MEDIUM ? "Medium" : "High";
-            } else if (category_index == MENU_CAT_PROFILE) {
-                opt_name = option_index == MENU_PROFILE_CAT ? "CAT 3408" :
-                           option_index == MENU_PROFILE_UNIMOG ? "Unimog" : "MAN TGX";
-            } else if (category_index == MENU_CAT_HORN) {
-                const char *horn_names[] = {"Truck", "MAN TGE", "La Cucaracha", "2-Tone", "Dixie", "Peterbilt", "Outlaw"};
-                opt_name = horn_names[option_index < MENU_HORN_COUNT ? option_index : 0];
-            } else if (category_index == MENU_CAT_STEERING) {
-                opt_name = option_index == MENU_STEERING_ON ? "On" : "Off";
-            } else {
-                opt_name = option_index == MENU_WIFI_ON ? "On" : "Off";
-            }
-            ESP_LOGI(TAG, "=== CONFIRMED: %s -> %s ===", cat_names[category_index], opt_name);
+            const char *cat_names[] = {"Volume", "Profile", "Horn", "Steering", "WiFi", "Preset"};
+            char preset_name[PRESET_NAME_LEN];
+            ESP_LOGI(TAG, "=== CONFIRMED: %s -> %s ===", cat_names[category_index],
+                     option_name(category_index, option_index, preset_name));
 
             // Apply the setting
             apply_option(category_index, option_index);
 
             // Play "OK" TTS and exit
-            sound_play_sample(menu_menu_confirmSamples, menu_menu_confirmSampleCount,
-                              menu_menu_confirmSampleRate, 80);
+            play_prompt(MENU_PROMPT(menu_confirm), true);
             exit_menu(false);  // false = not cancelled
         }
     }
@@ -572,6 +618,17 @@ bool menu_is_active(void)
     return state != MENU_STATE_INACTIVE;
 }
 
+bool menu_take_wifi_request(bool *enable)
+{
+    int8_t req = pending_wifi;
+    if (req < 0) {
+        return false;
+    }
+    pending_wifi = -1;
+    *enable = (req == 1);
+    return true;
+}
+
 menu_state_t menu_get_state(void)
 {
     return state;
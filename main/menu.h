@@ -3,7 +3,7 @@
  * @brief 2-Level menu system for RC controller settings
  *
  * Provides a hierarchical menu accessible via long-press on AUX2:
- * - Level 1: Category selection (Volume, Profile, Horn, WiFi)
+ * - Level 1: Category selection (Volume, Profile, Horn, Steering, WiFi, Preset)
  * - Level 2: Option selection within each category
  *
  * Navigation:
@@ -38,6 +38,7 @@ typedef enum {
     MENU_CAT_HORN,              // Horn type selection
     MENU_CAT_STEERING,          // Realistic steering on/off
     MENU_CAT_WIFI,              // WiFi enable/disable
+    MENU_CAT_PRESET,            // Tuning + sound preset selection
     MENU_CAT_COUNT
 } menu_category_t;
 
@@ -51,16 +52,6 @@ typedef enum {
     MENU_VOL_COUNT
 } menu_volume_option_t;
 
-/**
- * @brief Sound profile options (matches sound_profile_t)
- */
-typedef enum {
-    MENU_PROFILE_CAT = 0,       // CAT 3408
-    MENU_PROFILE_UNIMOG,        // Unimog U1000
-    MENU_PROFILE_MAN,           // MAN TGX
-    MENU_PROFILE_COUNT
-} menu_profile_option_t;
-
 /**
  * @brief WiFi options
  */
@@ -79,19 +70,11 @@ typedef enum {
     MENU_STEERING_COUNT
 } menu_steering_option_t;
 
-/**
- * @brief Horn type options (matches horn_type_t)
- */
-typedef enum {
-    MENU_HORN_TRUCK = 0,        // Classic truck air horn
-    MENU_HORN_MANTGE,           // MAN TGE horn
-    MENU_HORN_CUCARACHA,        // La Cucaracha musical horn
-    MENU_HORN_2TONE,            // Two-tone truck horn
-    MENU_HORN_DIXIE,            // Dixie horn (General Lee)
-    MENU_HORN_PETERBILT,        // Peterbilt truck horn
-    MENU_HORN_OUTLAW,           // Outlaw train horn
-    MENU_HORN_COUNT
-} menu_horn_option_t;
+// Profile and horn options are the compiled-in sound_profile_t and
+// horn_type_t IDs that have a prompt, in ID order (see menu.c)
+
+// Preset options are slots 0 to PRESET_COUNT-1, announced "One" to "Four"
+#define MENU_PRESET_PROMPTS     4
 
 /**
  * @brief Initialize the menu system
@@ -130,6 +113,17 @@ void menu_handle_confirm(bool aux1_pressed);
  */
 bool menu_is_active(void);
 
+/**
+ * @brief Take a pending WiFi on/off request made from the menu
+ *
+ * The menu runs in the control task, so WiFi changes are handed off to
+ * housekeeping instead of being applied in place.
+ *
+ * @param enable Set to requested WiFi state when a request is pending
+ * @return true if a request was pending (and is now consumed)
+ */
+bool menu_take_wifi_request(bool *enable);
+
 /**
  * @brief Get current menu state
  *
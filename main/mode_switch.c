@@ -6,6 +6,11 @@
  * - Single press: Toggle between FWS and AWS (or return from Crab/Rear to last normal mode)
  * - Double press: Switch to Crab mode
  * - Triple press: Switch to Rear-only steering
+ *
+ * With MODE_SWITCH_SPECULATIVE the press count is acted on at every
+ * release instead of PRESS_TIMEOUT after the last one, always resolved
+ * from the mode the sequence started in, so a single press takes effect
+ * at once and a double or triple press replaces it.
  */
 
 #include "mode_switch.h"
@@ -35,6 +40,11 @@ static int64_t last_press_time = 0;
 static int64_t last_release_time = 0;
 static int press_count = 0;
 
+// Modes when the current press sequence started (speculative switching)
+static steering_mode_t seq_mode = STEER_MODE_FRONT;
+static steering_mode_t seq_normal_mode = STEER_MODE_FRONT;
+static bool seq_applied = false;        // Current mode is a speculative result
+
 static steering_mode_t current_mode = STEER_MODE_FRONT;
 static steering_mode_t last_normal_mode = STEER_MODE_FRONT;  // FWS or AWS only
 static bool mode_changed = false;
@@ -59,16 +69,18 @@ static bool is_special_mode(steering_mode_t mode)
 }
 
 /**
- * @brief Execute mode change based on press count
+ * @brief Mode a press count leads to from a starting mode
+ * @param from Mode before the presses
+ * @param normal Last FWS/AWS mode before the presses
  */
-static void execute_mode_change(int presses)
+static steering_mode_t resolve_mode(steering_mode_t from, steering_mode_t normal, int presses)
 {
-    steering_mode_t new_mode = current_mode;
+    steering_mode_t new_mode = from;
 
-    if (is_special_mode(current_mode)) {
+    if (is_special_mode(from)) {
         // In Crab or Rear mode: any single press returns to last normal mode
         if (presses == 1) {
-            new_mode = last_normal_mode;
+            new_mode = normal;
             ESP_LOGI(TAG, "Single press in special mode -> returning to %s",
                      new_mode == STEER_MODE_FRONT ? "Front" : "All-Axle");
         } else if (presses == 2) {
@@ -84,7 +96,7 @@ static void execute_mode_change(int presses)
         // In normal mode (FWS or AWS)
         if (presses == 1) {
             // Toggle between FWS and AWS
-            if (current_mode == STEER_MODE_FRONT) {
+            if (from == STEER_MODE_FRONT) {
                 new_mode = STEER_MODE_ALL_AXLE;
                 ESP_LOGI(TAG, "Single press -> All-Axle mode");
             } else {
@@ -100,23 +112,88 @@ static void execute_mode_change(int presses)
         }
     }
 
-    // Update modes if changed
-    if (new_mode != current_mode) {
-        // Update last_normal_mode if we're switching to a normal mode
-        if (!is_special_mode(new_mode)) {
-            last_normal_mode = new_mode;
-        }
+    return new_mode;
+}
 
-        current_mode = new_mode;
-        mode_changed = true;
+/**
+ * @brief Mode change feedback - air shift sound when engine running, beep when off
+ */
+static void play_mode_feedback(steering_mode_t mode)
+{
+    if (engine_sound_get_state() == ENGINE_RUNNING) {
+        engine_sound_play_mode_switch();
+    } else {
+        sound_play_mode_beep(mode);
+    }
+}
 
-        // Play sound feedback - air shift sound when engine running, beep when off
-        if (engine_sound_get_state() == ENGINE_RUNNING) {
-            engine_sound_play_mode_switch();
-        } else {
-            sound_play_mode_beep(new_mode);
+/**
+ * @brief Switch to a mode
+ * @param feedback Play the mode sound if the mode changes
+ */
+static void apply_mode(steering_mode_t new_mode, bool feedback)
+{
+    if (new_mode == current_mode) {
+        return;
+    }
+
+    // Update last_normal_mode if we're switching to a normal mode
+    if (!is_special_mode(new_mode)) {
+        last_normal_mode = new_mode;
+    }
+
+    current_mode = new_mode;
+    mode_changed = true;
+
+    if (feedback) {
+        play_mode_feedback(new_mode);
+    }
+}
+
+/**
+ * @brief Act on the press count so far without ending the sequence
+ *
+ * Called at each release in speculative mode. The count is resolved from
+ * the mode the sequence started in, so a double press goes straight from
+ * the start mode to Crab rather than via the single-press mode.
+ */
+static void speculate_mode_change(int presses)
+{
+    if (!seq_applied) {
+        seq_mode = current_mode;
+        seq_normal_mode = last_normal_mode;
+        seq_applied = true;
+    }
+    last_normal_mode = seq_normal_mode;
+    apply_mode(resolve_mode(seq_mode, seq_normal_mode, presses), false);
+}
+
+/**
+ * @brief Undo a speculative change (the sequence turned into a long press)
+ */
+static void revert_speculation(void)
+{
+    if (seq_applied) {
+        apply_mode(seq_mode, false);
+        last_normal_mode = seq_normal_mode;
+        seq_applied = false;
+    }
+}
+
+/**
+ * @brief Execute mode change based on press count (end of a press sequence)
+ */
+static void execute_mode_change(int presses)
+{
+    if (seq_applied) {
+        // Already switched as the presses came in: only the sound is left
+        seq_applied = false;
+        if (current_mode != seq_mode) {
+            play_mode_feedback(current_mode);
         }
+        return;
     }
+    apply_mode(resolve_mode(current_mode, last_normal_mode, presses), true);
 }
 
 void mode_switch_init(void)
@@ -126,6 +203,7 @@ void mode_switch_init(void)
     current_mode = STEER_MODE_FRONT;
     last_normal_mode = STEER_MODE_FRONT;
     mode_changed = false;
+    seq_applied = false;
 
     ESP_LOGI(TAG, "Mode switch initialized (Front steering)");
 }
@@ -158,17 +236,28 @@ void mode_switch_update(bool button_pressed)
                     longpress_handled = true;
                     ESP_LOGI(TAG, "Long press detected (%lu ms), firing callback",
                              (unsigned long)(now_ms - last_press_time));
+                    // A long press is not a mode press: undo the
+                    // speculative result of the presses before it
+                    revert_speculation();
                     // Fire callback
                     longpress_callback();
-                    // Reset state machine - don't execute multi-click action
+                    // Don't execute a multi-click action; the rest of the
+                    // hold is ignored until release
                     press_count = 0;
-                    btn_state = BTN_STATE_IDLE;
                 }
+            } else if (longpress_handled) {
+                // Release ending a long press is not a mode press
+                btn_state = BTN_STATE_IDLE;
             } else {
                 // Button just released (with debounce)
                 if ((now_ms - last_press_time) >= DEBOUNCE_MS) {
                     btn_state = BTN_STATE_WAIT_COMMIT;
                     last_release_time = now_ms;
+#if MODE_SWITCH_SPECULATIVE
+                    if (steering_enabled) {
+                        speculate_mode_change(press_count);
+                    }
+#endif
                 }
             }
             break;
@@ -258,10 +347,12 @@ void mode_switch_set_enabled(bool enabled)
         ESP_LOGI(TAG, "Steering mode changes %s", enabled ? "enabled" : "disabled");
 
         if (!enabled) {
-            // Reset state machine when disabling
+            // Reset state machine when disabling (a speculative change
+            // stays, without its sound)
             btn_state = BTN_STATE_IDLE;
             press_count = 0;
             longpress_handled = false;
+            seq_applied = false;
         }
     }
 }
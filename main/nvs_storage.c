@@ -1,16 +1,137 @@
 /**
  * @file nvs_storage.c
  * @brief Non-Volatile Storage implementation for persistent configuration
+ *
+ * Every config record is read in one pass at boot and kept in RAM; loads
+ * are served from there and saves go through the deferred writer. Records
+ * are stored behind a small header carrying their length and CRC-32.
+ * Blobs written by older firmware have no header and are still accepted.
  */
 
 #include "nvs_storage.h"
+#include "tuning.h"
+#include "perf.h"
 #include "nvs_flash.h"
 #include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_rom_crc.h"
 #include "esp_log.h"
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "NVS_STORAGE";
 
+// ============================================================================
+// RECORD FORMAT
+// ============================================================================
+
+#define NVS_RECORD_MAGIC    0xC5A1  // Distinct from the low half of every legacy config magic
+
+/**
+ * @brief Header stored in front of each record's payload
+ */
+typedef struct {
+    uint16_t magic;             // NVS_RECORD_MAGIC
+    uint16_t length;            // Payload bytes
+    uint32_t crc32;             // CRC-32 of the payload
+} nvs_record_header_t;
+
+// ============================================================================
+// RECORD STATE
+// ============================================================================
+
+/**
+ * @brief RAM copy of one config record
+ */
+typedef struct {
+    const char *key;
+    const char *name;
+    uint8_t *stored;            // Raw blob read at boot, released once loaded
+    size_t stored_len;
+    void *shadow;               // Newest contents (loaded or saved)
+    size_t capacity;
+    size_t len;
+    bool dirty;                 // shadow differs from flash
+    uint32_t updates;           // Saves coalesced into the pending write
+    int64_t first_dirty_ms;     // When the pending write was first requested
+} deferred_blob_t;
+
+static deferred_blob_t deferred[NVS_BLOB_COUNT] = {
+    [NVS_BLOB_CALIBRATION] = { .key = NVS_KEY_CALIBRATION, .name = "Calibration" },
+    [NVS_BLOB_TUNING]      = { .key = NVS_KEY_TUNING,      .name = "Tuning config" },
+    [NVS_BLOB_SOUND]       = { .key = NVS_KEY_SOUND,       .name = "Sound config" },
+    [NVS_BLOB_WIFI]        = { .key = NVS_KEY_WIFI_STA,    .name = "WiFi config" },
+    [NVS_BLOB_WIFI_CACHE]  = { .key = NVS_KEY_WIFI_CACHE,  .name = "WiFi AP cache" },
+    [NVS_BLOB_PRESETS]     = { .key = NVS_KEY_PRESETS,     .name = "Presets" },
+};
+
+static SemaphoreHandle_t deferred_mutex = NULL;  // Guards the shadow copies (never held across flash I/O)
+static SemaphoreHandle_t flash_mutex = NULL;     // Orders deferred commits against erases
+static int64_t last_change_ms = 0;      // Newest save of any blob
+
+static void nvs_writer_task(void *arg);
+static void flush_on_shutdown(void);
+
+/**
+ * @brief Replace a record's RAM copy (caller holds deferred_mutex)
+ * @return false if the copy could not be allocated
+ */
+static bool shadow_store(deferred_blob_t *d, const void *data, size_t len)
+{
+    if (d->capacity < len) {
+        void *grown = realloc(d->shadow, len);
+        if (!grown) {
+            return false;
+        }
+        d->shadow = grown;
+        d->capacity = len;
+    }
+    memcpy(d->shadow, data, len);
+    d->len = len;
+    return true;
+}
+
+/**
+ * @brief Read every config record with a single namespace open
+ * @return Number of records found
+ */
+static int read_records(void)
+{
+    nvs_handle_t handle;
+    int found = 0;
+
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return 0;   // Namespace not created yet: nothing saved
+    }
+
+    for (int i = 0; i < NVS_BLOB_COUNT; i++) {
+        deferred_blob_t *d = &deferred[i];
+        size_t len = 0;
+        if (nvs_get_blob(handle, d->key, NULL, &len) != ESP_OK || len == 0) {
+            continue;
+        }
+        d->stored = malloc(len);
+        if (!d->stored) {
+            ESP_LOGE(TAG, "No memory to read %s", d->name);
+            continue;
+        }
+        if (nvs_get_blob(handle, d->key, d->stored, &len) != ESP_OK) {
+            free(d->stored);
+            d->stored = NULL;
+            continue;
+        }
+        d->stored_len = len;
+        found++;
+    }
+
+    nvs_close(handle);
+    return found;
+}
+
 esp_err_t nvs_storage_init(void)
 {
     esp_err_t ret = nvs_flash_init();
@@ -22,347 +143,530 @@ esp_err_t nvs_storage_init(void)
         ret = nvs_flash_init();
     }
     
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "NVS storage initialized");
-    } else {
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to initialize NVS: %s", esp_err_to_name(ret));
+        return ret;
     }
-    
-    return ret;
+
+    deferred_mutex = xSemaphoreCreateMutex();
+    flash_mutex = xSemaphoreCreateMutex();
+    if (!deferred_mutex || !flash_mutex) {
+        ESP_LOGE(TAG, "Failed to create deferred write mutex");
+        return ESP_ERR_NO_MEM;
+    }
+
+    int found = read_records();
+
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        nvs_writer_task,
+        "nvs_writer",
+        NVS_WRITER_TASK_STACK_SIZE,
+        NULL,
+        NVS_WRITER_TASK_PRIORITY,
+        NULL,
+        NVS_WRITER_TASK_CORE
+    );
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create NVS writer task");
+        return ESP_FAIL;
+    }
+    esp_register_shutdown_handler(flush_on_shutdown);
+
+    ESP_LOGI(TAG, "NVS storage initialized (%d of %d config records found)", found, NVS_BLOB_COUNT);
+    return ESP_OK;
 }
 
-esp_err_t nvs_save_calibration(const calibration_data_t *data)
+// ============================================================================
+// RECORD I/O
+// ============================================================================
+
+/**
+ * @brief Write one record (header + payload) and commit it
+ */
+static esp_err_t write_record(const char *key, const void *data, size_t len)
 {
     nvs_handle_t handle;
     esp_err_t ret;
-    
-    ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
+
+    if (len > UINT16_MAX) {
+        return ESP_ERR_INVALID_SIZE;
     }
-    
-    // Save calibration as blob
-    ret = nvs_set_blob(handle, NVS_KEY_CALIBRATION, data, sizeof(calibration_data_t));
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to write calibration: %s", esp_err_to_name(ret));
-        nvs_close(handle);
-        return ret;
+    uint8_t *record = malloc(sizeof(nvs_record_header_t) + len);
+    if (!record) {
+        return ESP_ERR_NO_MEM;
     }
-    
-    // Commit changes
-    ret = nvs_commit(handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to commit NVS: %s", esp_err_to_name(ret));
+    nvs_record_header_t hdr = {
+        .magic = NVS_RECORD_MAGIC,
+        .length = (uint16_t)len,
+        .crc32 = esp_rom_crc32_le(0, data, len),
+    };
+    memcpy(record, &hdr, sizeof(hdr));
+    memcpy(record + sizeof(hdr), data, len);
+
+    ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret == ESP_OK) {
+        perf_flash_begin();
+        ret = nvs_set_blob(handle, key, record, sizeof(hdr) + len);
+        if (ret == ESP_OK) {
+            ret = nvs_commit(handle);
+        }
+        perf_flash_end();
+        nvs_close(handle);
     } else {
-        ESP_LOGI(TAG, "Calibration saved to NVS");
+        ESP_LOGE(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
     }
-    
-    nvs_close(handle);
+
+    free(record);
     return ret;
 }
 
-esp_err_t nvs_load_calibration(calibration_data_t *data)
+/**
+ * @brief Locate the payload of a raw blob
+ *
+ * Blobs without a record header were written by older firmware and are
+ * taken as a bare payload; the schema's magic check validates them.
+ */
+static esp_err_t record_payload(const uint8_t *raw, size_t raw_len, const uint8_t **payload, size_t *len)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
-    
-    ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
-    }
-    
-    // Get blob size first
-    size_t required_size = sizeof(calibration_data_t);
-    ret = nvs_get_blob(handle, NVS_KEY_CALIBRATION, data, &required_size);
-    
-    nvs_close(handle);
-    
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "No calibration found in NVS");
-        return ret;
+    nvs_record_header_t hdr;
+
+    if (raw_len >= sizeof(hdr)) {
+        memcpy(&hdr, raw, sizeof(hdr));
+        if (hdr.magic == NVS_RECORD_MAGIC) {
+            if (hdr.length != raw_len - sizeof(hdr) ||
+                esp_rom_crc32_le(0, raw + sizeof(hdr), hdr.length) != hdr.crc32) {
+                return ESP_ERR_INVALID_CRC;
+            }
+            *payload = raw + sizeof(hdr);
+            *len = hdr.length;
+            return ESP_OK;
+        }
+    }
+
+    *payload = raw;
+    *len = raw_len;
+    return ESP_OK;
+}
+
+/**
+ * @brief Copy a payload into config according to its schema
+ * @param migrated Set when the payload was of another version or size
+ */
+static esp_err_t schema_apply(const nvs_schema_t *schema, const uint8_t *payload, size_t len,
+                              void *config, bool *migrated, uint32_t *from_version)
+{
+    uint32_t magic;
+    uint32_t version = schema->version;
+    size_t fixed = schema->version ? 2 * sizeof(uint32_t) : sizeof(uint32_t);
+
+    if (len < fixed) {
+        return ESP_ERR_INVALID_SIZE;
     }
-    
-    // Verify magic number and version
-    if (data->magic != CALIBRATION_MAGIC) {
-        ESP_LOGW(TAG, "Invalid calibration magic number");
+    memcpy(&magic, payload, sizeof(magic));
+    if (magic != schema->magic) {
         return ESP_ERR_INVALID_STATE;
     }
-    
-    if (data->version != CALIBRATION_VERSION) {
-        ESP_LOGW(TAG, "Calibration version mismatch (stored: %lu, current: %d)", 
-                 data->version, CALIBRATION_VERSION);
-        // Could add migration logic here for future versions
-        return ESP_ERR_INVALID_VERSION;
+    if (schema->version) {
+        memcpy(&version, payload + sizeof(magic), sizeof(version));
     }
-    
-    ESP_LOGI(TAG, "Calibration loaded from NVS");
+    *from_version = version;
+
+    if (version == schema->version && len == schema->size) {
+        memcpy(config, payload, len);
+        *migrated = false;
+        return ESP_OK;
+    }
+
+    // Field-level migration over the defaults already in config
+    for (size_t i = 0; i < schema->field_count; i++) {
+        const nvs_field_t *f = &schema->fields[i];
+        if (f->since <= version && f->offset + f->size <= len) {
+            memcpy((uint8_t *)config + f->offset, payload + f->offset, f->size);
+        }
+    }
+    if (schema->upgrade) {
+        schema->upgrade(config, version);
+    }
+    *migrated = true;
     return ESP_OK;
 }
 
-esp_err_t nvs_clear_calibration(void)
+esp_err_t nvs_storage_load(nvs_blob_t blob, const nvs_schema_t *schema, void *config)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
-    
-    ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
-    if (ret != ESP_OK) {
-        return ret;
-    }
-    
-    ret = nvs_erase_key(handle, NVS_KEY_CALIBRATION);
+    if (blob >= NVS_BLOB_COUNT || !schema || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    deferred_blob_t *d = &deferred[blob];
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    bool migrated = false;
+    uint32_t from_version = 0;
+    void *scratch = malloc(schema->size);
+    if (!scratch) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(scratch, config, schema->size);
+
+    if (deferred_mutex) xSemaphoreTake(deferred_mutex, portMAX_DELAY);
+    if (d->stored) {
+        // First load: parse the blob read at boot
+        const uint8_t *payload;
+        size_t len;
+        ret = record_payload(d->stored, d->stored_len, &payload, &len);
+        if (ret == ESP_OK) {
+            ret = schema_apply(schema, payload, len, scratch, &migrated, &from_version);
+        }
+        free(d->stored);
+        d->stored = NULL;
+        d->stored_len = 0;
+        if (ret == ESP_OK && !migrated) {
+            shadow_store(d, scratch, schema->size);
+        }
+    } else if (d->len > 0) {
+        ret = schema_apply(schema, d->shadow, d->len, scratch, &migrated, &from_version);
+    }
+    if (deferred_mutex) xSemaphoreGive(deferred_mutex);
+
     if (ret == ESP_OK) {
-        nvs_commit(handle);
-        ESP_LOGI(TAG, "Calibration cleared from NVS");
+        memcpy(config, scratch, schema->size);
+        if (migrated) {
+            ESP_LOGI(TAG, "Migrated %s from v%lu to v%lu", d->name,
+                     (unsigned long)from_version, (unsigned long)schema->version);
+            nvs_storage_save_deferred(blob, config, schema->size);
+        }
+    } else if (ret != ESP_ERR_NOT_FOUND) {
+        ESP_LOGW(TAG, "Ignoring stored %s: %s", d->name, esp_err_to_name(ret));
     }
-    
-    nvs_close(handle);
+
+    free(scratch);
     return ret;
 }
 
-bool nvs_has_calibration(void)
+// ============================================================================
+// DEFERRED WRITES
+// ============================================================================
+
+esp_err_t nvs_storage_save_deferred(nvs_blob_t blob, const void *data, size_t len)
 {
-    calibration_data_t data;
-    return (nvs_load_calibration(&data) == ESP_OK && data.calibrated);
+    if (blob >= NVS_BLOB_COUNT || !data || len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!deferred_mutex) {
+        // Writer not running (NVS init failed): write through
+        return write_record(deferred[blob].key, data, len);
+    }
+
+    deferred_blob_t *d = &deferred[blob];
+    esp_err_t ret = ESP_OK;
+    int64_t now_ms = esp_timer_get_time() / 1000;
+
+    xSemaphoreTake(deferred_mutex, portMAX_DELAY);
+    if (shadow_store(d, data, len)) {
+        if (!d->dirty) {
+            d->dirty = true;
+            d->updates = 0;
+            d->first_dirty_ms = now_ms;
+        }
+        d->updates++;
+        last_change_ms = now_ms;
+    } else {
+        ret = ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(deferred_mutex);
+
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "No memory to queue %s", d->name);
+    }
+    return ret;
 }
 
-void nvs_get_default_calibration(calibration_data_t *data)
+bool nvs_storage_has_pending(void)
 {
-    memset(data, 0, sizeof(calibration_data_t));
-    
-    data->magic = CALIBRATION_MAGIC;
-    data->version = CALIBRATION_VERSION;
-    data->calibrated = false;
-    
-    // Set defaults for all channels
-    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
-        data->channels[i].min = RC_DEFAULT_MIN_US;
-        data->channels[i].center = RC_DEFAULT_CENTER_US;
-        data->channels[i].max = RC_DEFAULT_MAX_US;
-        data->channels[i].deadzone = DEFAULT_DEADZONE_US;
-        data->channels[i].reversed = false;
+    for (int i = 0; i < NVS_BLOB_COUNT; i++) {
+        if (deferred[i].dirty) {
+            return true;
+        }
     }
-    
-    ESP_LOGI(TAG, "Default calibration values set");
+    return false;
 }
 
-esp_err_t nvs_save_wifi_config(const crawler_wifi_config_t *config)
+/**
+ * @brief Write one pending blob to flash
+ *
+ * The contents are copied out under the mutex so callers can keep queueing
+ * while the (slow) flash write runs; a save that lands meanwhile leaves the
+ * blob dirty for the next pass.
+ */
+static esp_err_t commit_blob(deferred_blob_t *d)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
-
-    ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
+    xSemaphoreTake(flash_mutex, portMAX_DELAY);
+    xSemaphoreTake(deferred_mutex, portMAX_DELAY);
+    if (!d->dirty) {
+        xSemaphoreGive(deferred_mutex);
+        xSemaphoreGive(flash_mutex);
+        return ESP_OK;
     }
+    size_t len = d->len;
+    uint32_t updates = d->updates;
+    void *copy = malloc(len);
+    if (copy) {
+        memcpy(copy, d->shadow, len);
+        d->dirty = false;
+    }
+    xSemaphoreGive(deferred_mutex);
 
-    // Save WiFi config as blob
-    ret = nvs_set_blob(handle, NVS_KEY_WIFI_STA, config, sizeof(crawler_wifi_config_t));
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to write WiFi config: %s", esp_err_to_name(ret));
-        nvs_close(handle);
-        return ret;
+    if (!copy) {
+        xSemaphoreGive(flash_mutex);
+        return ESP_ERR_NO_MEM;  // Still dirty: retried on the next pass
     }
 
-    ret = nvs_commit(handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to commit NVS: %s", esp_err_to_name(ret));
+    esp_err_t ret = write_record(d->key, copy, len);
+    free(copy);
+    xSemaphoreGive(flash_mutex);
+
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "%s saved to NVS (%lu update%s coalesced)", d->name,
+                 (unsigned long)updates, updates == 1 ? "" : "s");
     } else {
-        ESP_LOGI(TAG, "WiFi config saved to NVS");
+        ESP_LOGE(TAG, "Failed to save %s: %s", d->name, esp_err_to_name(ret));
+        xSemaphoreTake(deferred_mutex, portMAX_DELAY);
+        if (!d->dirty) {
+            d->dirty = true;    // Nothing newer arrived: retry the same contents
+            d->first_dirty_ms = esp_timer_get_time() / 1000;
+        }
+        xSemaphoreGive(deferred_mutex);
     }
-
-    nvs_close(handle);
     return ret;
 }
 
-esp_err_t nvs_load_wifi_config(crawler_wifi_config_t *config)
+esp_err_t nvs_storage_flush(void)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
+    esp_err_t result = ESP_OK;
 
-    ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
+    if (!deferred_mutex) {
+        return ESP_OK;
     }
-
-    size_t required_size = sizeof(crawler_wifi_config_t);
-    ret = nvs_get_blob(handle, NVS_KEY_WIFI_STA, config, &required_size);
-
-    nvs_close(handle);
-
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "No WiFi config found in NVS");
-        return ret;
+    for (int i = 0; i < NVS_BLOB_COUNT; i++) {
+        esp_err_t ret = commit_blob(&deferred[i]);
+        if (ret != ESP_OK) {
+            result = ret;
+        }
     }
-
-    // Verify magic number
-    if (config->magic != CRAWLER_WIFI_MAGIC) {
-        ESP_LOGW(TAG, "Invalid WiFi config magic number");
-        return ESP_ERR_INVALID_STATE;
-    }
-
-    ESP_LOGI(TAG, "WiFi config loaded from NVS (enabled: %s)", config->enabled ? "yes" : "no");
-    return ESP_OK;
+    return result;
 }
 
-void nvs_get_default_wifi_config(crawler_wifi_config_t *config)
+/**
+ * @brief esp_restart() hook: don't lose settings changed just before a reboot
+ */
+static void flush_on_shutdown(void)
 {
-    memset(config, 0, sizeof(crawler_wifi_config_t));
-    config->magic = CRAWLER_WIFI_MAGIC;
-    config->enabled = false;
-    config->ssid[0] = '\0';
-    config->password[0] = '\0';
-    config->connected = false;
-    ESP_LOGI(TAG, "Default WiFi config set (disabled)");
+    if (nvs_storage_has_pending()) {
+        ESP_LOGI(TAG, "Flushing pending config before restart");
+        nvs_storage_flush();
+    }
 }
 
-esp_err_t nvs_save_tuning(const tuning_config_t *config)
+/**
+ * @brief Commit dirty blobs at a safe moment
+ *
+ * Flash writes stall the instruction cache on both cores, so they wait
+ * until the settings have stopped changing and the motor is stopped. A blob
+ * that stays dirty for NVS_DEFER_MAX_MS is written regardless.
+ */
+static void nvs_writer_task(void *arg)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(NVS_WRITER_POLL_MS));
 
-    ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
-    }
+        int64_t now_ms = esp_timer_get_time() / 1000;
+        bool quiet = (now_ms - last_change_ms) >= NVS_DEFER_QUIET_MS;
+        bool safe = quiet && tuning_is_motor_stopped();
 
-    ret = nvs_set_blob(handle, NVS_KEY_TUNING, config, sizeof(tuning_config_t));
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to write tuning config: %s", esp_err_to_name(ret));
-        nvs_close(handle);
-        return ret;
+        for (int i = 0; i < NVS_BLOB_COUNT; i++) {
+            deferred_blob_t *d = &deferred[i];
+            if (d->dirty && (safe || (now_ms - d->first_dirty_ms) >= NVS_DEFER_MAX_MS)) {
+                commit_blob(d);
+            }
+        }
     }
-
-    ret = nvs_commit(handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to commit NVS: %s", esp_err_to_name(ret));
-    } else {
-        ESP_LOGI(TAG, "Tuning config saved to NVS");
-    }
-
-    nvs_close(handle);
-    return ret;
 }
 
-esp_err_t nvs_load_tuning(tuning_config_t *config)
-{
-    nvs_handle_t handle;
-    esp_err_t ret;
+// ============================================================================
+// CALIBRATION AND WIFI RECORDS
+// ============================================================================
+
+static const nvs_field_t calibration_fields[] = {
+    NVS_FIELD(calibration_data_t, channels, 1),
+    NVS_FIELD(calibration_data_t, calibrated, 1),
+};
+
+static const nvs_schema_t calibration_schema = {
+    .magic = CALIBRATION_MAGIC,
+    .version = CALIBRATION_VERSION,
+    .size = sizeof(calibration_data_t),
+    .fields = calibration_fields,
+    .field_count = sizeof(calibration_fields) / sizeof(calibration_fields[0]),
+};
+
+static const nvs_field_t wifi_fields[] = {
+    NVS_FIELD(crawler_wifi_config_t, enabled, 0),
+    NVS_FIELD(crawler_wifi_config_t, ssid, 0),
+    NVS_FIELD(crawler_wifi_config_t, password, 0),
+};
+
+static const nvs_schema_t wifi_schema = {
+    .magic = CRAWLER_WIFI_MAGIC,
+    .version = 0,
+    .size = sizeof(crawler_wifi_config_t),
+    .fields = wifi_fields,
+    .field_count = sizeof(wifi_fields) / sizeof(wifi_fields[0]),
+};
+
+static const nvs_field_t wifi_cache_fields[] = {
+    NVS_FIELD(crawler_wifi_cache_t, ssid, 0),
+    NVS_FIELD(crawler_wifi_cache_t, bssid, 0),
+    NVS_FIELD(crawler_wifi_cache_t, channel, 0),
+};
+
+static const nvs_schema_t wifi_cache_schema = {
+    .magic = CRAWLER_WIFI_CACHE_MAGIC,
+    .version = 0,
+    .size = sizeof(crawler_wifi_cache_t),
+    .fields = wifi_cache_fields,
+    .field_count = sizeof(wifi_cache_fields) / sizeof(wifi_cache_fields[0]),
+};
 
-    ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
-    }
-
-    size_t required_size = sizeof(tuning_config_t);
-    ret = nvs_get_blob(handle, NVS_KEY_TUNING, config, &required_size);
-
-    nvs_close(handle);
+esp_err_t nvs_load_calibration(calibration_data_t *data)
+{
+    nvs_get_default_calibration(data);
 
+    esp_err_t ret = nvs_storage_load(NVS_BLOB_CALIBRATION, &calibration_schema, data);
     if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "No tuning config found in NVS");
+        ESP_LOGW(TAG, "No calibration found in NVS");
         return ret;
     }
-
-    // Verify magic number
-    if (config->magic != TUNING_MAGIC) {
-        ESP_LOGW(TAG, "Invalid tuning config magic number");
-        return ESP_ERR_INVALID_STATE;
-    }
-
-    ESP_LOGI(TAG, "Tuning config loaded from NVS (version %lu)", (unsigned long)config->version);
+    
+    ESP_LOGI(TAG, "Calibration loaded from NVS");
     return ESP_OK;
 }
 
-esp_err_t nvs_storage_set_blob(const char *key, const void *data, size_t len)
+esp_err_t nvs_clear_calibration(void)
 {
     nvs_handle_t handle;
     esp_err_t ret;
+    deferred_blob_t *d = &deferred[NVS_BLOB_CALIBRATION];
+
+    // A pending deferred save must not bring the calibration back
+    if (flash_mutex) {
+        xSemaphoreTake(flash_mutex, portMAX_DELAY);
+        xSemaphoreTake(deferred_mutex, portMAX_DELAY);
+    }
+    d->dirty = false;
+    d->len = 0;
+    free(d->stored);
+    d->stored = NULL;
+    d->stored_len = 0;
+    if (flash_mutex) xSemaphoreGive(deferred_mutex);
 
     ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
+        if (flash_mutex) xSemaphoreGive(flash_mutex);
         return ret;
     }
-
-    ret = nvs_set_blob(handle, key, data, len);
+    
+    ret = nvs_erase_key(handle, NVS_KEY_CALIBRATION);
     if (ret == ESP_OK) {
-        ret = nvs_commit(handle);
+        nvs_commit(handle);
+        ESP_LOGI(TAG, "Calibration cleared from NVS");
     }
-
+    
     nvs_close(handle);
+    if (flash_mutex) xSemaphoreGive(flash_mutex);
     return ret;
 }
 
-esp_err_t nvs_storage_get_blob(const char *key, void *data, size_t *len)
+bool nvs_has_calibration(void)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
+    calibration_data_t data;
+    return (nvs_load_calibration(&data) == ESP_OK && data.calibrated);
+}
 
-    ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
-    if (ret != ESP_OK) {
-        return ret;
+void nvs_get_default_calibration(calibration_data_t *data)
+{
+    memset(data, 0, sizeof(calibration_data_t));
+    
+    data->magic = CALIBRATION_MAGIC;
+    data->version = CALIBRATION_VERSION;
+    data->calibrated = false;
+    
+    // Set defaults for all channels
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        data->channels[i].min = RC_DEFAULT_MIN_US;
+        data->channels[i].center = RC_DEFAULT_CENTER_US;
+        data->channels[i].max = RC_DEFAULT_MAX_US;
+        data->channels[i].deadzone = DEFAULT_DEADZONE_US;
+        data->channels[i].reversed = false;
     }
-
-    ret = nvs_get_blob(handle, key, data, len);
-    nvs_close(handle);
-
-    return ret;
 }
 
-esp_err_t nvs_save_sound_config(const void *config, size_t len)
+esp_err_t nvs_save_wifi_config(const crawler_wifi_config_t *config)
 {
-    nvs_handle_t handle;
+    deferred_blob_t *d = &deferred[NVS_BLOB_WIFI];
     esp_err_t ret;
 
-    ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
-        return ret;
-    }
-
-    ret = nvs_set_blob(handle, NVS_KEY_SOUND, config, len);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to write sound config: %s", esp_err_to_name(ret));
-        nvs_close(handle);
-        return ret;
+    // Written straight away: the new settings are applied by rebooting
+    if (flash_mutex) xSemaphoreTake(flash_mutex, portMAX_DELAY);
+    ret = write_record(d->key, config, sizeof(crawler_wifi_config_t));
+    if (ret == ESP_OK && deferred_mutex) {
+        xSemaphoreTake(deferred_mutex, portMAX_DELAY);
+        shadow_store(d, config, sizeof(crawler_wifi_config_t));
+        d->dirty = false;
+        xSemaphoreGive(deferred_mutex);
     }
+    if (flash_mutex) xSemaphoreGive(flash_mutex);
 
-    ret = nvs_commit(handle);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to commit NVS: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "Failed to write WiFi config: %s", esp_err_to_name(ret));
     } else {
-        ESP_LOGI(TAG, "Sound config saved to NVS");
+        ESP_LOGI(TAG, "WiFi config saved to NVS");
     }
-
-    nvs_close(handle);
     return ret;
 }
 
-esp_err_t nvs_load_sound_config(void *config, size_t *len)
+esp_err_t nvs_load_wifi_config(crawler_wifi_config_t *config)
 {
-    nvs_handle_t handle;
-    esp_err_t ret;
+    nvs_get_default_wifi_config(config);
 
-    ret = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
+    esp_err_t ret = nvs_storage_load(NVS_BLOB_WIFI, &wifi_schema, config);
     if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "Failed to open NVS namespace: %s", esp_err_to_name(ret));
+        ESP_LOGW(TAG, "No WiFi config found in NVS");
         return ret;
     }
 
-    ret = nvs_get_blob(handle, NVS_KEY_SOUND, config, len);
-    nvs_close(handle);
+    config->connected = false;  // Runtime only
+    ESP_LOGI(TAG, "WiFi config loaded from NVS (enabled: %s)", config->enabled ? "yes" : "no");
+    return ESP_OK;
+}
 
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "No sound config found in NVS");
-        return ret;
-    }
+esp_err_t nvs_save_wifi_cache(const crawler_wifi_cache_t *cache)
+{
+    // Deferred like the other records: it only speeds up the next boot
+    return nvs_storage_save_deferred(NVS_BLOB_WIFI_CACHE, cache, sizeof(crawler_wifi_cache_t));
+}
 
-    ESP_LOGI(TAG, "Sound config loaded from NVS");
-    return ESP_OK;
+esp_err_t nvs_load_wifi_cache(crawler_wifi_cache_t *cache)
+{
+    memset(cache, 0, sizeof(crawler_wifi_cache_t));
+    cache->magic = CRAWLER_WIFI_CACHE_MAGIC;
+    return nvs_storage_load(NVS_BLOB_WIFI_CACHE, &wifi_cache_schema, cache);
+}
+
+void nvs_get_default_wifi_config(crawler_wifi_config_t *config)
+{
+    memset(config, 0, sizeof(crawler_wifi_config_t));
+    config->magic = CRAWLER_WIFI_MAGIC;
+    config->enabled = false;
+    config->ssid[0] = '\0';
+    config->password[0] = '\0';
+    config->connected = false;
 }
@@ -8,19 +8,102 @@
 
 #include "config.h"
 #include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
 
 /**
- * @brief Initialize NVS storage
+ * @brief Config records held by the store
+ */
+typedef enum {
+    NVS_BLOB_CALIBRATION = 0,   // calibration_data_t (NVS_KEY_CALIBRATION)
+    NVS_BLOB_TUNING,            // tuning_config_t (NVS_KEY_TUNING)
+    NVS_BLOB_SOUND,             // engine_sound_config_t (NVS_KEY_SOUND)
+    NVS_BLOB_WIFI,              // crawler_wifi_config_t (NVS_KEY_WIFI_STA), written synchronously
+    NVS_BLOB_WIFI_CACHE,        // crawler_wifi_cache_t (NVS_KEY_WIFI_CACHE)
+    NVS_BLOB_PRESETS,           // preset_bank_t (NVS_KEY_PRESETS)
+    NVS_BLOB_COUNT
+} nvs_blob_t;
+
+/**
+ * @brief One field carried over when a stored record is migrated
+ */
+typedef struct {
+    uint16_t offset;            // Offset in the record (same in every version)
+    uint16_t size;
+    uint32_t since;             // First record version that stores the field
+} nvs_field_t;
+
+#define NVS_FIELD(type, member, since) \
+    { offsetof(type, member), sizeof(((type *)0)->member), (since) }
+
+/**
+ * @brief Layout description of a config record
+ *
+ * Records start with a uint32_t magic, followed by a uint32_t version
+ * unless version is 0. A record of another version is migrated field by
+ * field: every field whose since is at or below the stored version is
+ * copied over the defaults, the rest keep their defaults. Adding a field
+ * means appending it with since = the new version and bumping the version.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;           // Current record version, 0 if unversioned
+    size_t size;                // Size of the current struct
+    const nvs_field_t *fields;
+    size_t field_count;
+    void (*upgrade)(void *config, uint32_t from_version);  // Optional fix-ups after the field copy
+} nvs_schema_t;
+
+/**
+ * @brief Initialize NVS storage, read every config record and start the deferred writer
  * @return ESP_OK on success
  */
 esp_err_t nvs_storage_init(void);
 
 /**
- * @brief Save calibration data to NVS
- * @param data Pointer to calibration data to save
- * @return ESP_OK on success
+ * @brief Load a config record read at boot, migrating older versions
+ *
+ * Records are read from flash once, by nvs_storage_init(); later loads
+ * return the newest saved contents from RAM. A migrated record is queued
+ * for writing back in the current format.
+ *
+ * @param blob Record to load
+ * @param schema Layout of the record
+ * @param config Holds the defaults on entry; stored fields are copied over them
+ * @return ESP_OK if a stored record was used, ESP_ERR_NOT_FOUND if none is
+ *         saved, ESP_ERR_INVALID_CRC / ESP_ERR_INVALID_STATE if it is unusable
+ *         (config is left at the defaults)
+ */
+esp_err_t nvs_storage_load(nvs_blob_t blob, const nvs_schema_t *schema, void *config);
+
+/**
+ * @brief Queue a config blob for writing (never touches flash)
+ *
+ * Copies the data and marks the blob dirty. A low-priority task commits it
+ * once it has stopped changing for NVS_DEFER_QUIET_MS while the motor is
+ * stopped, or NVS_DEFER_MAX_MS after the first unsaved change, so a burst
+ * of updates costs one flash write and none happen mid-drive.
+ *
+ * @param blob Blob to save
+ * @param data Blob contents (copied)
+ * @param len Length of data
+ * @return ESP_OK if queued, ESP_ERR_NO_MEM if the copy could not be allocated
+ */
+esp_err_t nvs_storage_save_deferred(nvs_blob_t blob, const void *data, size_t len);
+
+/**
+ * @brief Commit every pending deferred write now (blocks on flash)
+ *
+ * Runs automatically from esp_restart() via a shutdown handler.
+ * @return ESP_OK if nothing failed
+ */
+esp_err_t nvs_storage_flush(void);
+
+/**
+ * @brief Check whether deferred writes are waiting to be committed
  */
-esp_err_t nvs_save_calibration(const calibration_data_t *data);
+bool nvs_storage_has_pending(void);
 
 /**
  * @brief Load calibration data from NVS
@@ -62,56 +145,23 @@ esp_err_t nvs_save_wifi_config(const crawler_wifi_config_t *config);
 esp_err_t nvs_load_wifi_config(crawler_wifi_config_t *config);
 
 /**
- * @brief Get default WiFi STA configuration (disabled)
- * @param config Pointer to WiFi STA config structure to fill with defaults
- */
-void nvs_get_default_wifi_config(crawler_wifi_config_t *config);
-
-/**
- * @brief Save tuning configuration to NVS
- * @param config Pointer to tuning config to save
- * @return ESP_OK on success
+ * @brief Queue the last good access point for saving (deferred)
+ * @param cache Access point to remember
+ * @return ESP_OK if queued
  */
-esp_err_t nvs_save_tuning(const tuning_config_t *config);
+esp_err_t nvs_save_wifi_cache(const crawler_wifi_cache_t *cache);
 
 /**
- * @brief Load tuning configuration from NVS
- * @param config Pointer to tuning config structure to fill
- * @return ESP_OK on success, ESP_ERR_NOT_FOUND if no config saved
+ * @brief Load the last good access point
+ * @param cache Filled with the stored entry, or cleared (channel 0)
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if none is saved
  */
-esp_err_t nvs_load_tuning(tuning_config_t *config);
+esp_err_t nvs_load_wifi_cache(crawler_wifi_cache_t *cache);
 
 /**
- * @brief Save a blob to NVS
- * @param key Key name
- * @param data Pointer to data
- * @param len Length of data
- * @return ESP_OK on success
- */
-esp_err_t nvs_storage_set_blob(const char *key, const void *data, size_t len);
-
-/**
- * @brief Load a blob from NVS
- * @param key Key name
- * @param data Pointer to buffer for data
- * @param len Pointer to length (in: buffer size, out: actual size)
- * @return ESP_OK on success, ESP_ERR_NOT_FOUND if key doesn't exist
- */
-esp_err_t nvs_storage_get_blob(const char *key, void *data, size_t *len);
-
-/**
- * @brief Save engine sound configuration to NVS
- * @param config Pointer to engine sound config to save
- * @return ESP_OK on success
- */
-esp_err_t nvs_save_sound_config(const void *config, size_t len);
-
-/**
- * @brief Load engine sound configuration from NVS
- * @param config Pointer to engine sound config structure to fill
- * @param len Pointer to length (in: buffer size, out: actual size)
- * @return ESP_OK on success, ESP_ERR_NOT_FOUND if no config saved
+ * @brief Get default WiFi STA configuration (disabled)
+ * @param config Pointer to WiFi STA config structure to fill with defaults
  */
-esp_err_t nvs_load_sound_config(void *config, size_t *len);
+void nvs_get_default_wifi_config(crawler_wifi_config_t *config);
 
 #endif // NVS_STORAGE_H
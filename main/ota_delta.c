@@ -0,0 +1,217 @@
+/**
+ * @file ota_delta.c
+ * @brief Delta firmware patcher implementation
+ */
+
+#include "ota_delta.h"
+#include "perf.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "mbedtls/sha256.h"
+
+static const char *TAG = "ota_delta";
+
+#define DELTA_COPY_CHUNK    1024    // Source bytes read per flash access
+
+_Static_assert(sizeof(ota_delta_header_t) == 80, "delta header layout must match tools/ota-delta.py");
+_Static_assert(sizeof(ota_delta_op_t) == 8, "delta op layout must match tools/ota-delta.py");
+
+typedef enum {
+    DELTA_HEADER,       // Collecting the header
+    DELTA_OP,           // Collecting the next op
+    DELTA_DATA,         // Passing inline bytes through
+} delta_state_t;
+
+struct ota_delta {
+    esp_ota_handle_t handle;
+    const esp_partition_t *source;
+    delta_state_t state;
+    ota_delta_header_t header;
+    ota_delta_op_t op;
+    size_t collected;               // Bytes of the header or op gathered so far
+    uint32_t data_left;             // Inline bytes left in a DATA op
+    uint32_t written;               // Bytes of the patched image so far
+    mbedtls_sha256_context sha;
+    uint8_t copy[DELTA_COPY_CHUNK];
+};
+
+/**
+ * @brief Write patched bytes to the update partition
+ */
+static esp_err_t delta_output(ota_delta_t *d, const uint8_t *data, size_t len)
+{
+    if (len > d->header.target_size - d->written) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    mbedtls_sha256_update(&d->sha, data, len);
+    d->written += len;
+
+    perf_flash_begin();
+    esp_err_t err = esp_ota_write(d->handle, data, len);
+    perf_flash_end();
+    return err;
+}
+
+/**
+ * @brief Check that the running image is the one the delta was made against
+ */
+static esp_err_t delta_check_source(ota_delta_t *d)
+{
+    const ota_delta_header_t *h = &d->header;
+    if (h->magic != OTA_DELTA_MAGIC || h->version != OTA_DELTA_VERSION) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    if (h->source_size > d->source->size) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    mbedtls_sha256_context sha;
+    uint8_t digest[32];
+    esp_err_t err = ESP_OK;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+    for (uint32_t pos = 0; pos < h->source_size && err == ESP_OK; pos += DELTA_COPY_CHUNK) {
+        size_t n = h->source_size - pos < DELTA_COPY_CHUNK ? h->source_size - pos : DELTA_COPY_CHUNK;
+        err = esp_partition_read(d->source, pos, d->copy, n);
+        mbedtls_sha256_update(&sha, d->copy, n);
+    }
+    mbedtls_sha256_finish(&sha, digest);
+    mbedtls_sha256_free(&sha);
+
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (memcmp(digest, h->source_sha256, sizeof(digest)) != 0) {
+        ESP_LOGE(TAG, "Delta was made against another firmware image");
+        return ESP_ERR_INVALID_VERSION;
+    }
+    ESP_LOGI(TAG, "Patching %lu byte image into %lu bytes",
+             (unsigned long)h->source_size, (unsigned long)h->target_size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Run a complete op (COPY runs at once, DATA switches to pass-through)
+ */
+static esp_err_t delta_run_op(ota_delta_t *d)
+{
+    uint32_t length = d->op.length & ~OTA_DELTA_OP_COPY;
+    if (!(d->op.length & OTA_DELTA_OP_COPY)) {
+        d->data_left = length;
+        d->state = length ? DELTA_DATA : DELTA_OP;
+        return ESP_OK;
+    }
+
+    if (d->op.offset > d->header.source_size || length > d->header.source_size - d->op.offset) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    for (uint32_t done = 0; done < length; ) {
+        size_t n = length - done < DELTA_COPY_CHUNK ? length - done : DELTA_COPY_CHUNK;
+        esp_err_t err = esp_partition_read(d->source, d->op.offset + done, d->copy, n);
+        if (err == ESP_OK) {
+            err = delta_output(d, d->copy, n);
+        }
+        if (err != ESP_OK) {
+            return err;
+        }
+        done += n;
+    }
+    return ESP_OK;
+}
+
+bool ota_delta_detect(const void *data, size_t len)
+{
+    uint32_t magic;
+    if (len < sizeof(magic)) {
+        return false;
+    }
+    memcpy(&magic, data, sizeof(magic));
+    return magic == OTA_DELTA_MAGIC;
+}
+
+ota_delta_t *ota_delta_create(esp_ota_handle_t handle, const esp_partition_t *source)
+{
+    ota_delta_t *d = calloc(1, sizeof(*d));
+    if (!d) {
+        return NULL;
+    }
+    d->handle = handle;
+    d->source = source;
+    d->state = DELTA_HEADER;
+    mbedtls_sha256_init(&d->sha);
+    mbedtls_sha256_starts(&d->sha, 0);
+    return d;
+}
+
+esp_err_t ota_delta_write(ota_delta_t *d, const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        esp_err_t err = ESP_OK;
+        size_t n;
+
+        switch (d->state) {
+            case DELTA_HEADER:
+            case DELTA_OP: {
+                uint8_t *dst = d->state == DELTA_HEADER ? (uint8_t *)&d->header : (uint8_t *)&d->op;
+                size_t size = d->state == DELTA_HEADER ? sizeof(d->header) : sizeof(d->op);
+                n = len < size - d->collected ? len : size - d->collected;
+                memcpy(dst + d->collected, data, n);
+                d->collected += n;
+                if (d->collected == size) {
+                    d->collected = 0;
+                    if (d->state == DELTA_HEADER) {
+                        err = delta_check_source(d);
+                        d->state = DELTA_OP;
+                    } else {
+                        err = delta_run_op(d);
+                    }
+                }
+                break;
+            }
+            case DELTA_DATA:
+                n = len < d->data_left ? len : d->data_left;
+                err = delta_output(d, data, n);
+                d->data_left -= n;
+                if (d->data_left == 0) {
+                    d->state = DELTA_OP;
+                }
+                break;
+            default:
+                return ESP_ERR_INVALID_STATE;
+        }
+
+        if (err != ESP_OK) {
+            return err;
+        }
+        data += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+esp_err_t ota_delta_finish(ota_delta_t *d)
+{
+    uint8_t digest[32];
+
+    if (d->state == DELTA_HEADER || d->state == DELTA_DATA || d->collected != 0 ||
+        d->written != d->header.target_size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    mbedtls_sha256_finish(&d->sha, digest);
+    if (memcmp(digest, d->header.target_sha256, sizeof(digest)) != 0) {
+        ESP_LOGE(TAG, "Patched image hash mismatch");
+        return ESP_ERR_INVALID_CRC;
+    }
+    return ESP_OK;
+}
+
+void ota_delta_free(ota_delta_t *d)
+{
+    if (d) {
+        mbedtls_sha256_free(&d->sha);
+        free(d);
+    }
+}
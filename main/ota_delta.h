@@ -0,0 +1,79 @@
+/**
+ * @file ota_delta.h
+ * @brief Delta firmware images patched against the running partition
+ *
+ * A delta (built by tools/ota-delta.py) is an ota_delta_header_t followed
+ * by ops, each an ota_delta_op_t: COPY takes bytes from the running
+ * image, DATA carries new bytes inline. Ops are applied as they stream
+ * in, so the new image goes straight to the update partition and only
+ * the changed bytes cross the WiFi link. A delta can itself be gzipped.
+ */
+
+#ifndef OTA_DELTA_H
+#define OTA_DELTA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_ota_ops.h"
+
+#define OTA_DELTA_MAGIC     0x41544C44  // "DLTA"
+#define OTA_DELTA_VERSION   1
+#define OTA_DELTA_OP_COPY   0x80000000  // Set in ota_delta_op_t.length for COPY
+
+/**
+ * @brief Delta header
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;                 // OTA_DELTA_MAGIC
+    uint16_t version;               // OTA_DELTA_VERSION
+    uint16_t reserved;
+    uint32_t source_size;           // Length of the image the delta was made against
+    uint32_t target_size;           // Length of the patched image
+    uint8_t source_sha256[32];      // Of the first source_size bytes of the running partition
+    uint8_t target_sha256[32];      // Of the patched image
+} ota_delta_header_t;
+
+/**
+ * @brief One patch op
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t length;                // Bytes produced, | OTA_DELTA_OP_COPY for a copy
+    uint32_t offset;                // COPY: source offset; DATA: 0 (length bytes follow)
+} ota_delta_op_t;
+
+typedef struct ota_delta ota_delta_t;
+
+/**
+ * @brief Check whether an upload starts with a delta header
+ */
+bool ota_delta_detect(const void *data, size_t len);
+
+/**
+ * @brief Start patching into an OTA update
+ * @param handle Update begun with OTA_WITH_SEQUENTIAL_WRITES
+ * @param source Partition the delta applies to (the running one)
+ * @return NULL if out of memory
+ */
+ota_delta_t *ota_delta_create(esp_ota_handle_t handle, const esp_partition_t *source);
+
+/**
+ * @brief Apply the next piece of the delta
+ * @return ESP_OK, ESP_ERR_INVALID_VERSION if made against another image,
+ *         ESP_ERR_INVALID_RESPONSE if malformed, or an esp_ota_write() error
+ */
+esp_err_t ota_delta_write(ota_delta_t *delta, const uint8_t *data, size_t len);
+
+/**
+ * @brief Check that the patched image is complete and matches its hash
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE if the delta was cut short, ESP_ERR_INVALID_CRC on a hash mismatch
+ */
+esp_err_t ota_delta_finish(ota_delta_t *delta);
+
+/**
+ * @brief Release a delta (NULL is allowed)
+ */
+void ota_delta_free(ota_delta_t *delta);
+
+#endif // OTA_DELTA_H
@@ -3,20 +3,58 @@
 
 #include <string.h>
 #include <stdio.h>
-#include <sys/stat.h>
-#include <dirent.h>
+#include <stdlib.h>
 #include "esp_log.h"
 #include "esp_ota_ops.h"
 #include "esp_app_format.h"
 #include "esp_timer.h"
 #include "esp_system.h"
-#include "esp_spiffs.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include "rom/miniz.h"
+#include "ota_delta.h"
+#include "perf.h"
+#include "web_bundle.h"
 
 static const char *TAG = "ota_update";
 
 // OTA receive buffer size
 #define OTA_BUFFER_SIZE 4096
 
+// gzip member header (RFC 1952)
+#define GZIP_ID1        0x1F
+#define GZIP_ID2        0x8B
+#define GZIP_CM_DEFLATE 8
+#define GZIP_FHCRC      0x02
+#define GZIP_FEXTRA     0x04
+#define GZIP_FNAME      0x08
+#define GZIP_FCOMMENT   0x10
+#define GZIP_TRAILER    8       // CRC-32 + ISIZE
+
+// Inflate state for gzip uploads: the ROM inflater writes into a circular
+// window, which doubles as the output buffer handed to esp_ota_write()
+typedef struct {
+    tinfl_decompressor inflator;
+    uint8_t window[TINFL_LZ_DICT_SIZE];
+    size_t window_pos;
+    uint32_t crc;
+    uint32_t size;
+    uint8_t trailer[GZIP_TRAILER];
+    size_t trailer_len;
+    bool done;
+} ota_inflate_t;
+
+// Upload being written: optional gzip layer, then optional delta layer
+typedef struct {
+    esp_ota_handle_t handle;
+    const esp_partition_t *source;  // Running partition (delta source)
+    ota_inflate_t *inflate;         // NULL unless the upload is gzipped
+    ota_delta_t *delta;             // NULL unless the payload is a delta
+    uint8_t probe[4];               // First payload bytes, to spot a delta
+    size_t probe_len;
+    bool probed;
+} ota_stream_t;
+
 // Current OTA progress (accessible for WebSocket status updates)
 static ota_progress_t s_ota_progress = {
     .status = OTA_STATUS_IDLE,
@@ -56,7 +94,215 @@ static void set_error(const char *msg)
     s_ota_progress.error_msg[sizeof(s_ota_progress.error_msg) - 1] = '\0';
 }
 
-// HTTP POST handler for firmware upload
+// ============================================================================
+// PAYLOAD
+// ============================================================================
+
+static esp_err_t ota_emit_payload(ota_stream_t *s, const uint8_t *data, size_t len)
+{
+    if (len == 0) {
+        return ESP_OK;
+    }
+    if (s->delta) {
+        return ota_delta_write(s->delta, data, len);
+    }
+
+    perf_flash_begin();
+    esp_err_t err = esp_ota_write(s->handle, data, len);
+    perf_flash_end();
+    return err;
+}
+
+/**
+ * @brief Write (inflated) upload data: a full image, or a delta to patch
+ */
+static esp_err_t ota_emit(ota_stream_t *s, const uint8_t *data, size_t len)
+{
+    if (!s->probed) {
+        size_t n = len < sizeof(s->probe) - s->probe_len ? len : sizeof(s->probe) - s->probe_len;
+        memcpy(s->probe + s->probe_len, data, n);
+        s->probe_len += n;
+        data += n;
+        len -= n;
+        if (s->probe_len < sizeof(s->probe)) {
+            return ESP_OK;
+        }
+
+        s->probed = true;
+        if (ota_delta_detect(s->probe, s->probe_len)) {
+            s->delta = ota_delta_create(s->handle, s->source);
+            if (!s->delta) {
+                return ESP_ERR_NO_MEM;
+            }
+            ESP_LOGI(TAG, "Delta image, patching against %s", s->source->label);
+        }
+        esp_err_t err = ota_emit_payload(s, s->probe, s->probe_len);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    return ota_emit_payload(s, data, len);
+}
+
+// ============================================================================
+// GZIP IMAGES
+// ============================================================================
+
+/**
+ * @brief Check for a gzip member header at the start of an upload
+ * @param header_len Set to the header length if complete
+ * @return true if data starts a gzip member (header_len 0 if truncated)
+ */
+static bool gzip_header(const uint8_t *data, size_t len, size_t *header_len)
+{
+    *header_len = 0;
+    if (len < 10 || data[0] != GZIP_ID1 || data[1] != GZIP_ID2) {
+        return false;
+    }
+
+    uint8_t flags = data[3];
+    size_t pos = 10;
+    if (data[2] != GZIP_CM_DEFLATE) {
+        return true;            // Unsupported method: header stays 0
+    }
+    if (flags & GZIP_FEXTRA) {
+        if (pos + 2 > len) return true;
+        pos += 2 + (data[pos] | (data[pos + 1] << 8));
+    }
+    for (int field = GZIP_FNAME; field <= GZIP_FCOMMENT; field <<= 1) {
+        if (flags & field) {
+            const uint8_t *end = pos < len ? memchr(data + pos, '\0', len - pos) : NULL;
+            if (!end) return true;
+            pos = end - data + 1;
+        }
+    }
+    if (flags & GZIP_FHCRC) {
+        pos += 2;
+    }
+    if (pos <= len) {
+        *header_len = pos;
+    }
+    return true;
+}
+
+/**
+ * @brief Inflate a piece of the deflate stream into the payload
+ * @return ESP_OK, ESP_ERR_INVALID_RESPONSE if the stream is corrupt, or an ota_emit() error
+ */
+static esp_err_t gzip_inflate(ota_stream_t *s, const uint8_t *in, size_t len)
+{
+    ota_inflate_t *z = s->inflate;
+
+    while (len > 0 || !z->done) {
+        if (z->done) {
+            size_t n = len < GZIP_TRAILER - z->trailer_len ? len : GZIP_TRAILER - z->trailer_len;
+            memcpy(z->trailer + z->trailer_len, in, n);
+            z->trailer_len += n;
+            return ESP_OK;      // Anything after the trailer is ignored
+        }
+
+        size_t in_size = len;
+        size_t out_size = TINFL_LZ_DICT_SIZE - z->window_pos;
+        tinfl_status status = tinfl_decompress(&z->inflator, in, &in_size, z->window,
+                                               z->window + z->window_pos, &out_size,
+                                               TINFL_FLAG_HAS_MORE_INPUT);
+        in += in_size;
+        len -= in_size;
+
+        if (out_size > 0) {
+            z->crc = esp_rom_crc32_le(z->crc, z->window + z->window_pos, out_size);
+            z->size += out_size;
+            esp_err_t err = ota_emit(s, z->window + z->window_pos, out_size);
+            if (err != ESP_OK) {
+                return err;
+            }
+            z->window_pos = (z->window_pos + out_size) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+
+        if (status == TINFL_STATUS_DONE) {
+            z->done = true;
+        } else if (status < TINFL_STATUS_DONE) {
+            return ESP_ERR_INVALID_RESPONSE;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0) {
+            return ESP_OK;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Check the gzip trailer against the inflated image
+ */
+static bool gzip_finished(const ota_inflate_t *z)
+{
+    if (!z->done || z->trailer_len < GZIP_TRAILER) {
+        return false;
+    }
+    uint32_t crc = z->trailer[0] | (z->trailer[1] << 8) | (z->trailer[2] << 16) | ((uint32_t)z->trailer[3] << 24);
+    uint32_t size = z->trailer[4] | (z->trailer[5] << 8) | (z->trailer[6] << 16) | ((uint32_t)z->trailer[7] << 24);
+    return crc == z->crc && size == z->size;
+}
+
+/**
+ * @brief Receive exactly len bytes (retrying timeouts)
+ * @return len, or <= 0 if the connection closed
+ */
+static int recv_full(httpd_req_t *req, char *buf, int len)
+{
+    int got = 0;
+    while (got < len) {
+        int n = httpd_req_recv(req, buf + got, len - got);
+        if (n == HTTPD_SOCK_ERR_TIMEOUT) {
+            ESP_LOGW(TAG, "Timeout, retrying...");
+            continue;
+        }
+        if (n <= 0) {
+            return n;
+        }
+        got += n;
+    }
+    return got;
+}
+
+/**
+ * @brief Write a piece of the upload, inflating it first for gzip images
+ */
+static esp_err_t ota_write_chunk(ota_stream_t *s, const char *data, size_t len)
+{
+    if (s->inflate) {
+        return gzip_inflate(s, (const uint8_t *)data, len);
+    }
+    return ota_emit(s, (const uint8_t *)data, len);
+}
+
+/**
+ * @brief Free an upload's layers
+ */
+static void ota_stream_free(ota_stream_t *s)
+{
+    free(s->inflate);
+    ota_delta_free(s->delta);
+    s->inflate = NULL;
+    s->delta = NULL;
+}
+
+/**
+ * @brief Why a write failed, for the status API
+ */
+static const char *ota_write_error(esp_err_t err)
+{
+    switch (err) {
+        case ESP_ERR_INVALID_RESPONSE: return "Corrupt upload";
+        case ESP_ERR_INVALID_VERSION:  return "Delta is for another firmware";
+        case ESP_ERR_INVALID_SIZE:     return "Truncated upload";
+        case ESP_ERR_INVALID_CRC:      return "Patched image hash mismatch";
+        case ESP_ERR_NO_MEM:           return "Out of memory";
+        default:                       return "Write failed";
+    }
+}
+
+// HTTP POST handler for firmware upload: a raw .bin or a delta against the
+// running image, either one optionally gzipped and inflated as it arrives
 static esp_err_t ota_upload_handler(httpd_req_t *req)
 {
     ESP_LOGI(TAG, "OTA upload request received");
@@ -88,61 +334,82 @@ static esp_err_t ota_upload_handler(httpd_req_t *req)
         return ESP_FAIL;
     }
 
-    ESP_LOGI(TAG, "Writing to partition: %s at 0x%lx", update_partition->label, update_partition->address);
-
-    // Begin OTA update
-    esp_ota_handle_t ota_handle;
-    esp_err_t err = esp_ota_begin(update_partition, content_len, &ota_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "esp_ota_begin failed: %s", esp_err_to_name(err));
-        set_error("OTA begin failed");
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to start OTA");
-        return err;
-    }
-
     // Allocate receive buffer
     char *buffer = malloc(OTA_BUFFER_SIZE);
     if (buffer == NULL) {
-        esp_ota_abort(ota_handle);
         set_error("Out of memory");
         httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
         return ESP_ERR_NO_MEM;
     }
 
-    // Receive and write firmware data
-    int bytes_received = 0;
-    while (bytes_received < content_len) {
-        int to_read = content_len - bytes_received;
-        if (to_read > OTA_BUFFER_SIZE) {
-            to_read = OTA_BUFFER_SIZE;
-        }
+    // The first chunk tells a gzip image from a raw one
+    int first_len = content_len < OTA_BUFFER_SIZE ? content_len : OTA_BUFFER_SIZE;
+    if (recv_full(req, buffer, first_len) != first_len) {
+        free(buffer);
+        set_error("Connection closed");
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Connection closed");
+        return ESP_FAIL;
+    }
 
-        int read_bytes = httpd_req_recv(req, buffer, to_read);
-        if (read_bytes <= 0) {
-            if (read_bytes == HTTPD_SOCK_ERR_TIMEOUT) {
-                ESP_LOGW(TAG, "Timeout, retrying...");
-                continue;
-            }
-            ESP_LOGE(TAG, "Connection closed after %d bytes", bytes_received);
+    size_t header_len = 0;
+    ota_stream_t stream = { .source = running };
+    if (gzip_header((const uint8_t *)buffer, first_len, &header_len)) {
+        if (header_len == 0) {
             free(buffer);
-            esp_ota_abort(ota_handle);
-            set_error("Connection closed");
-            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Connection closed");
+            set_error("Unsupported gzip image");
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Unsupported gzip image");
             return ESP_FAIL;
         }
+        ota_inflate_t *inflate = heap_caps_malloc(sizeof(*inflate), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (inflate == NULL) {
+            inflate = heap_caps_malloc(sizeof(*inflate), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        }
+        if (inflate == NULL) {
+            free(buffer);
+            set_error("Out of memory");
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory for gzip image");
+            return ESP_ERR_NO_MEM;
+        }
+        memset(inflate, 0, sizeof(*inflate));
+        tinfl_init(&inflate->inflator);
+        stream.inflate = inflate;
+        ESP_LOGI(TAG, "Compressed image, inflating while writing");
+    }
+
+    ESP_LOGI(TAG, "Writing to partition: %s at 0x%lx", update_partition->label, update_partition->address);
+
+    // Begin OTA update. Sectors are erased as the writes reach them, so no
+    // single flash operation holds the cache off for long (for gzip and
+    // delta uploads the image size isn't known up front anyway)
+    bool sized = !stream.inflate && !ota_delta_detect(buffer, first_len);
+    esp_err_t err = (sized && (size_t)content_len > update_partition->size) ? ESP_ERR_INVALID_SIZE :
+                    esp_ota_begin(update_partition, OTA_WITH_SEQUENTIAL_WRITES, &stream.handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_ota_begin failed: %s", esp_err_to_name(err));
+        free(buffer);
+        ota_stream_free(&stream);
+        set_error(err == ESP_ERR_INVALID_SIZE ? "Image too large" : "OTA begin failed");
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, s_ota_progress.error_msg);
+        return err;
+    }
 
+    // Receive and write firmware data
+    int bytes_received = first_len;
+    int read_bytes = first_len - (int)header_len;
+    const char *data = buffer + header_len;
+    while (1) {
         // Write to OTA partition
-        err = esp_ota_write(ota_handle, buffer, read_bytes);
+        err = ota_write_chunk(&stream, data, read_bytes);
         if (err != ESP_OK) {
-            ESP_LOGE(TAG, "esp_ota_write failed: %s", esp_err_to_name(err));
+            ESP_LOGE(TAG, "OTA write failed: %s", esp_err_to_name(err));
             free(buffer);
-            esp_ota_abort(ota_handle);
-            set_error("Write failed");
-            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Write failed");
+            ota_stream_free(&stream);
+            esp_ota_abort(stream.handle);
+            set_error(ota_write_error(err));
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, s_ota_progress.error_msg);
             return err;
         }
 
-        bytes_received += read_bytes;
         s_ota_progress.bytes_received = bytes_received;
         s_ota_progress.progress_percent = (bytes_received * 100) / content_len;
 
@@ -153,12 +420,57 @@ static esp_err_t ota_upload_handler(httpd_req_t *req)
             ESP_LOGI(TAG, "Progress: %d%%", s_ota_progress.progress_percent);
             last_logged = current_ten;
         }
+
+        if (bytes_received >= content_len) {
+            break;
+        }
+        int to_read = content_len - bytes_received;
+        if (to_read > OTA_BUFFER_SIZE) {
+            to_read = OTA_BUFFER_SIZE;
+        }
+
+        read_bytes = httpd_req_recv(req, buffer, to_read);
+        if (read_bytes <= 0) {
+            if (read_bytes == HTTPD_SOCK_ERR_TIMEOUT) {
+                ESP_LOGW(TAG, "Timeout, retrying...");
+                read_bytes = 0;
+                continue;
+            }
+            ESP_LOGE(TAG, "Connection closed after %d bytes", bytes_received);
+            free(buffer);
+            ota_stream_free(&stream);
+            esp_ota_abort(stream.handle);
+            set_error("Connection closed");
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Connection closed");
+            return ESP_FAIL;
+        }
+        data = buffer;
+        bytes_received += read_bytes;
     }
 
     free(buffer);
 
+    // Every layer must have seen its whole input, and a patched image its hash
+    err = stream.probed ? ESP_OK : ESP_ERR_INVALID_SIZE;
+    if (err == ESP_OK && stream.inflate) {
+        ESP_LOGI(TAG, "Inflated %lu bytes from %d", (unsigned long)stream.inflate->size, content_len);
+        err = gzip_finished(stream.inflate) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+    }
+    if (err == ESP_OK && stream.delta) {
+        err = ota_delta_finish(stream.delta);
+    }
+    ota_stream_free(&stream);
+    if (err != ESP_OK) {
+        esp_ota_abort(stream.handle);
+        set_error(ota_write_error(err));
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, s_ota_progress.error_msg);
+        return ESP_FAIL;
+    }
+
     // Finalize OTA
-    err = esp_ota_end(ota_handle);
+    perf_flash_begin();
+    err = esp_ota_end(stream.handle);
+    perf_flash_end();
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "esp_ota_end failed: %s", esp_err_to_name(err));
         set_error("Validation failed");
@@ -167,7 +479,9 @@ static esp_err_t ota_upload_handler(httpd_req_t *req)
     }
 
     // Set boot partition
+    perf_flash_begin();
     err = esp_ota_set_boot_partition(update_partition);
+    perf_flash_end();
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "esp_ota_set_boot_partition failed: %s", esp_err_to_name(err));
         set_error("Set boot partition failed");
@@ -226,61 +540,40 @@ static esp_err_t ota_status_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
-// HTTP POST handler for SPIFFS file upload
-// Expects multipart form data with filename in URL: /api/spiffs?file=filename.ext
-static esp_err_t spiffs_upload_handler(httpd_req_t *req)
+// HTTP POST handler for web UI bundle upload (build/webui.bin)
+static esp_err_t webui_upload_handler(httpd_req_t *req)
 {
-    ESP_LOGI(TAG, "SPIFFS upload request received");
-
-    // Get filename from query string
-    char query[64] = {0};
-    char filename[48] = {0};
-
-    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing filename parameter");
-        return ESP_FAIL;
-    }
-
-    if (httpd_query_key_value(query, "file", filename, sizeof(filename)) != ESP_OK) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing 'file' parameter");
-        return ESP_FAIL;
-    }
-
-    // Build full path
-    char filepath[64];
-    snprintf(filepath, sizeof(filepath), "/web/%s", filename);
-
-    ESP_LOGI(TAG, "Uploading file: %s (%d bytes)", filepath, req->content_len);
-
-    // Get content length
     int content_len = req->content_len;
-    if (content_len <= 0 || content_len > 256 * 1024) {  // Max 256KB per file
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid content length");
-        return ESP_FAIL;
-    }
+    ESP_LOGI(TAG, "Web UI upload request received (%d bytes)", content_len);
 
-    // Open file for writing
-    FILE *f = fopen(filepath, "w");
-    if (f == NULL) {
-        ESP_LOGE(TAG, "Failed to open file for writing: %s", filepath);
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to create file");
+    if (content_len <= 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No content");
         return ESP_FAIL;
     }
 
     // Allocate receive buffer
-    char *buffer = malloc(1024);
+    char *buffer = malloc(OTA_BUFFER_SIZE);
     if (buffer == NULL) {
-        fclose(f);
         httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
         return ESP_ERR_NO_MEM;
     }
 
-    // Receive and write file data
+    // The old bundle is unmapped from here on; pages 404 until the new one is in
+    esp_err_t err = web_bundle_update_begin(content_len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Web UI update failed to start: %s", esp_err_to_name(err));
+        free(buffer);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST,
+                            err == ESP_ERR_INVALID_SIZE ? "Bundle too large" : "No web UI partition");
+        return ESP_FAIL;
+    }
+
+    // Receive and write bundle data
     int bytes_received = 0;
     while (bytes_received < content_len) {
         int to_read = content_len - bytes_received;
-        if (to_read > 1024) {
-            to_read = 1024;
+        if (to_read > OTA_BUFFER_SIZE) {
+            to_read = OTA_BUFFER_SIZE;
         }
 
         int read_bytes = httpd_req_recv(req, buffer, to_read);
@@ -288,18 +581,16 @@ static esp_err_t spiffs_upload_handler(httpd_req_t *req)
             if (read_bytes == HTTPD_SOCK_ERR_TIMEOUT) {
                 continue;
             }
-            ESP_LOGE(TAG, "Connection closed");
+            ESP_LOGE(TAG, "Connection closed after %d bytes", bytes_received);
             free(buffer);
-            fclose(f);
             httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Connection closed");
             return ESP_FAIL;
         }
 
-        size_t written = fwrite(buffer, 1, read_bytes, f);
-        if (written != read_bytes) {
-            ESP_LOGE(TAG, "Write failed");
+        err = web_bundle_update_write(buffer, read_bytes);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Web UI write failed: %s", esp_err_to_name(err));
             free(buffer);
-            fclose(f);
             httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Write failed");
             return ESP_FAIL;
         }
@@ -308,85 +599,61 @@ static esp_err_t spiffs_upload_handler(httpd_req_t *req)
     }
 
     free(buffer);
-    fclose(f);
-
-    ESP_LOGI(TAG, "File uploaded successfully: %s (%d bytes)", filename, bytes_received);
-
-    // Send success response
-    httpd_resp_set_type(req, "application/json");
-    char response[128];
-    snprintf(response, sizeof(response), "{\"status\":\"success\",\"file\":\"%s\",\"size\":%d}", filename, bytes_received);
-    httpd_resp_sendstr(req, response);
-
-    return ESP_OK;
-}
 
-// HTTP DELETE handler for SPIFFS file deletion
-static esp_err_t spiffs_delete_handler(httpd_req_t *req)
-{
-    // Get filename from query string
-    char query[64] = {0};
-    char filename[48] = {0};
-
-    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
-        httpd_query_key_value(query, "file", filename, sizeof(filename)) != ESP_OK) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing 'file' parameter");
-        return ESP_FAIL;
-    }
-
-    char filepath[64];
-    snprintf(filepath, sizeof(filepath), "/web/%s", filename);
-
-    if (remove(filepath) != 0) {
-        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "File not found");
+    err = web_bundle_update_end();
+    if (err != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid web UI bundle");
         return ESP_FAIL;
     }
 
-    ESP_LOGI(TAG, "File deleted: %s", filename);
+    ESP_LOGI(TAG, "Web UI updated: %d assets", web_bundle_count());
 
+    // Send success response
+    const web_bundle_upload_stats_t *stats = web_bundle_get_upload_stats();
     httpd_resp_set_type(req, "application/json");
-    httpd_resp_sendstr(req, "{\"status\":\"success\"}");
+    char response[192];
+    snprintf(response, sizeof(response),
+             "{\"status\":\"success\",\"files\":%d,\"size\":%d,"
+             "\"totalMs\":%lu,\"eraseMs\":%lu,\"writeMs\":%lu,\"flashKBps\":%lu}",
+             web_bundle_count(), bytes_received,
+             (unsigned long)stats->total_ms, (unsigned long)stats->erase_ms,
+             (unsigned long)stats->write_ms, (unsigned long)stats->flash_kbps);
+    httpd_resp_sendstr(req, response);
+
     return ESP_OK;
 }
 
-// HTTP GET handler for SPIFFS file listing
-static esp_err_t spiffs_list_handler(httpd_req_t *req)
+// HTTP GET handler for web UI bundle contents
+static esp_err_t webui_list_handler(httpd_req_t *req)
 {
-    DIR *dir = opendir("/web");
-    if (dir == NULL) {
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to open directory");
-        return ESP_FAIL;
-    }
-
-    // Get SPIFFS info
     size_t total = 0, used = 0;
-    esp_spiffs_info("storage", &total, &used);
+    web_bundle_get_usage(&used, &total);
 
     httpd_resp_set_type(req, "application/json");
 
     // Build JSON response
-    char response[512];
-    int offset = snprintf(response, sizeof(response), "{\"total\":%u,\"used\":%u,\"files\":[",
-                          (unsigned)total, (unsigned)used);
-
-    struct dirent *entry;
-    bool first = true;
-    while ((entry = readdir(dir)) != NULL) {
-        if (entry->d_type == DT_REG) {  // Regular file
-            char filepath[280];  // /web/ + NAME_MAX (255)
-            struct stat st;
-            snprintf(filepath, sizeof(filepath), "/web/%s", entry->d_name);
-            stat(filepath, &st);
-
-            offset += snprintf(response + offset, sizeof(response) - offset,
-                             "%s{\"name\":\"%s\",\"size\":%ld}",
-                             first ? "" : ",", entry->d_name, st.st_size);
-            first = false;
-        }
+    const web_bundle_upload_stats_t *stats = web_bundle_get_upload_stats();
+    char response[896];
+    int offset = snprintf(response, sizeof(response),
+                          "{\"total\":%u,\"used\":%u,\"mountUs\":%lu,"
+                          "\"lastUpload\":{\"bytes\":%lu,\"totalMs\":%lu,\"eraseMs\":%lu,"
+                          "\"writeMs\":%lu,\"flashKBps\":%lu},\"files\":[",
+                          (unsigned)total, (unsigned)used, (unsigned long)web_bundle_get_mount_us(),
+                          (unsigned long)stats->bytes, (unsigned long)stats->total_ms,
+                          (unsigned long)stats->erase_ms, (unsigned long)stats->write_ms,
+                          (unsigned long)stats->flash_kbps);
+
+    for (int i = 0; i < web_bundle_count() && offset < (int)sizeof(response); i++) {
+        const web_bundle_entry_t *e = web_bundle_get(i);
+        offset += snprintf(response + offset, sizeof(response) - offset,
+                           "%s{\"name\":\"%s\",\"size\":%lu,\"gzip\":%s}",
+                           i ? "," : "", e->path + 1, (unsigned long)e->size,
+                           e->encoding == WEB_BUNDLE_GZIP ? "true" : "false");
     }
-    closedir(dir);
 
-    snprintf(response + offset, sizeof(response) - offset, "]}");
+    if (offset < (int)sizeof(response)) {
+        snprintf(response + offset, sizeof(response) - offset, "]}");
+    }
     httpd_resp_sendstr(req, response);
     return ESP_OK;
 }
@@ -428,46 +695,33 @@ esp_err_t ota_register_handlers(httpd_handle_t server)
         return err;
     }
 
-    // Register SPIFFS file upload handler (POST /api/spiffs?file=filename)
-    httpd_uri_t spiffs_upload = {
-        .uri = "/api/spiffs",
+    // Register web UI bundle upload handler (POST /api/webui)
+    httpd_uri_t webui_upload = {
+        .uri = "/api/webui",
         .method = HTTP_POST,
-        .handler = spiffs_upload_handler,
+        .handler = webui_upload_handler,
         .user_ctx = NULL
     };
-    err = httpd_register_uri_handler(server, &spiffs_upload);
+    err = httpd_register_uri_handler(server, &webui_upload);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to register SPIFFS upload handler");
+        ESP_LOGE(TAG, "Failed to register web UI upload handler");
         return err;
     }
 
-    // Register SPIFFS file list handler (GET /api/spiffs)
-    httpd_uri_t spiffs_list = {
-        .uri = "/api/spiffs",
+    // Register web UI bundle list handler (GET /api/webui)
+    httpd_uri_t webui_list = {
+        .uri = "/api/webui",
         .method = HTTP_GET,
-        .handler = spiffs_list_handler,
-        .user_ctx = NULL
-    };
-    err = httpd_register_uri_handler(server, &spiffs_list);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to register SPIFFS list handler");
-        return err;
-    }
-
-    // Register SPIFFS file delete handler (DELETE /api/spiffs?file=filename)
-    httpd_uri_t spiffs_delete = {
-        .uri = "/api/spiffs",
-        .method = HTTP_DELETE,
-        .handler = spiffs_delete_handler,
+        .handler = webui_list_handler,
         .user_ctx = NULL
     };
-    err = httpd_register_uri_handler(server, &spiffs_delete);
+    err = httpd_register_uri_handler(server, &webui_list);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to register SPIFFS delete handler");
+        ESP_LOGE(TAG, "Failed to register web UI list handler");
         return err;
     }
 
-    ESP_LOGI(TAG, "OTA and SPIFFS handlers registered");
+    ESP_LOGI(TAG, "OTA and web UI handlers registered");
     return ESP_OK;
 }
 
@@ -0,0 +1,528 @@
+/**
+ * @file perf.c
+ * @brief Stick-to-servo latency instrumentation and stage profiler implementation
+ */
+
+#include "perf.h"
+#include "config.h"
+#include "timeline.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "PERF";
+
+// Histogram: 100us bins up to 12.8ms, last bin catches everything above
+#define PERF_BIN_US         100
+#define PERF_BIN_COUNT      128
+
+typedef struct {
+    uint32_t bins[PERF_BIN_COUNT];
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+} perf_histogram_t;
+
+static perf_histogram_t histograms[PERF_LAT_COUNT];
+static portMUX_TYPE perf_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Frame currently travelling through the pipeline
+static uint32_t last_edge_us = 0;
+static uint32_t pending_edge_us = 0;
+static uint32_t pending_loop_us = 0;
+static bool output_pending = false;
+
+static const char *stage_names[PERF_LAT_COUNT] = {
+    "edgeToLoop",
+    "loopToOutput",
+    "edgeToOutput",
+    "tickToLoop"
+};
+
+// Stage profiler: accumulate for PERF_STAGE_WINDOW_US, then publish
+#define PERF_STAGE_WINDOW_US    1000000
+
+typedef struct {
+    uint32_t window_start_us;
+    uint32_t count;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t sum_cycles;
+} stage_accum_t;
+
+static stage_accum_t stage_accum[PERF_STAGE_COUNT];        // Written by owning task only
+static perf_stage_summary_t stage_published[PERF_STAGE_COUNT];
+static volatile uint32_t loop_overruns[PERF_LOOP_COUNT];
+static uint32_t loop_last_wake[PERF_LOOP_COUNT];             // Cycle count at previous wakeup
+
+// Degraded-mode scheduler state (guarded by perf_lock)
+static volatile perf_shed_level_t shed_level = PERF_SHED_NONE;
+static uint32_t shed_events = 0;
+static uint32_t deadline_misses = 0;
+static uint32_t window_misses = 0;
+static uint32_t window_start_us = 0;
+static uint32_t clean_windows = 0;
+static uint32_t cycles_per_us = 1;
+
+// Flash write stalls (control loop wake gaps, [0] idle, [1] during a flash operation)
+static uint32_t flash_active = 0;
+static volatile bool flash_seen = false;    // A flash operation overlapped the current period
+static uint32_t flash_ops = 0;
+static uint32_t wake_gap_max_us[2];
+
+// Boot profile (guarded by perf_lock, written once per milestone)
+typedef struct {
+    const char *name;
+    uint32_t ms;
+} boot_mark_t;
+static boot_mark_t boot_marks[PERF_BOOT_MARKS];
+static int boot_mark_count = 0;
+
+static const char *stage_prof_names[PERF_STAGE_COUNT] = {
+    "control",
+    "autoWifi",
+    "led",
+    "servoTest",
+    "status",
+    "audioMix",
+    "audioEngine",
+    "audioEffects",
+    "audioHorn",
+    "audioUi",
+    "audioDsp"
+};
+
+static const char *loop_names[PERF_LOOP_COUNT] = {
+    "control",
+    "housekeeping"
+};
+
+static inline uint32_t now_us(void)
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+esp_err_t perf_init(void)
+{
+#if CONFIG_PM_ENABLE
+    cycles_per_us = 1;      // perf_cycles() counts esp_timer microseconds
+#else
+    cycles_per_us = esp_rom_get_cpu_ticks_per_us();
+    if (cycles_per_us == 0) cycles_per_us = 1;
+#endif
+    perf_reset();
+    ESP_LOGI(TAG, "Latency instrumentation ready (%d x %dus bins)", PERF_BIN_COUNT, PERF_BIN_US);
+    return ESP_OK;
+}
+
+void perf_record(perf_latency_t stage, uint32_t us)
+{
+    if (stage >= PERF_LAT_COUNT) {
+        return;
+    }
+
+    uint32_t bin = us / PERF_BIN_US;
+    if (bin >= PERF_BIN_COUNT) {
+        bin = PERF_BIN_COUNT - 1;
+    }
+
+    perf_histogram_t *h = &histograms[stage];
+    portENTER_CRITICAL(&perf_lock);
+    h->bins[bin]++;
+    h->count++;
+    h->sum_us += us;
+    if (us < h->min_us) h->min_us = us;
+    if (us > h->max_us) h->max_us = us;
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+void perf_mark_loop_entry(uint32_t edge_us)
+{
+    // Only a new frame starts a measurement; with a 100Hz loop and 50Hz
+    // receiver every other tick re-processes the previous frame
+    if (edge_us == 0 || edge_us == last_edge_us) {
+        return;
+    }
+    last_edge_us = edge_us;
+
+    uint32_t now = now_us();
+    perf_record(PERF_LAT_EDGE_TO_LOOP, now - edge_us);
+
+    pending_edge_us = edge_us;
+    pending_loop_us = now;
+    output_pending = true;
+}
+
+void perf_mark_output(void)
+{
+    if (!output_pending) {
+        return;
+    }
+    output_pending = false;
+
+    uint32_t now = now_us();
+    perf_record(PERF_LAT_LOOP_TO_OUTPUT, now - pending_loop_us);
+    perf_record(PERF_LAT_EDGE_TO_OUTPUT, now - pending_edge_us);
+}
+
+void perf_get_summary(perf_latency_t stage, perf_summary_t *summary)
+{
+    if (stage >= PERF_LAT_COUNT || summary == NULL) {
+        return;
+    }
+
+    perf_histogram_t snap;
+    portENTER_CRITICAL(&perf_lock);
+    memcpy(&snap, &histograms[stage], sizeof(snap));
+    portEXIT_CRITICAL(&perf_lock);
+
+    memset(summary, 0, sizeof(*summary));
+    summary->count = snap.count;
+    if (snap.count == 0) {
+        return;
+    }
+
+    summary->min_us = snap.min_us;
+    summary->max_us = snap.max_us;
+    summary->avg_us = (uint32_t)(snap.sum_us / snap.count);
+
+    // p99: upper edge of the bin containing the 99th percentile sample
+    uint32_t target = snap.count - snap.count / 100;
+    uint32_t seen = 0;
+    for (int i = 0; i < PERF_BIN_COUNT; i++) {
+        seen += snap.bins[i];
+        if (seen >= target) {
+            summary->p99_us = (i + 1) * PERF_BIN_US;
+            break;
+        }
+    }
+    if (summary->p99_us > summary->max_us) {
+        summary->p99_us = summary->max_us;
+    }
+}
+
+void perf_reset(void)
+{
+    portENTER_CRITICAL(&perf_lock);
+    memset(histograms, 0, sizeof(histograms));
+    for (int i = 0; i < PERF_LAT_COUNT; i++) {
+        histograms[i].min_us = UINT32_MAX;
+    }
+    memset(stage_published, 0, sizeof(stage_published));
+    for (int i = 0; i < PERF_LOOP_COUNT; i++) {
+        loop_overruns[i] = 0;
+    }
+    shed_events = 0;
+    deadline_misses = 0;
+    wake_gap_max_us[0] = wake_gap_max_us[1] = 0;
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+const char* perf_get_name(perf_latency_t stage)
+{
+    return (stage < PERF_LAT_COUNT) ? stage_names[stage] : "unknown";
+}
+
+int perf_to_json(char *buf, size_t len)
+{
+    int n = snprintf(buf, len, "{");
+    for (int i = 0; i < PERF_LAT_COUNT && n < (int)len; i++) {
+        perf_summary_t s;
+        perf_get_summary((perf_latency_t)i, &s);
+        n += snprintf(buf + n, len - n,
+            "%s\"%s\":{\"count\":%lu,\"min\":%lu,\"avg\":%lu,\"p99\":%lu,\"max\":%lu}",
+            i > 0 ? "," : "", stage_names[i],
+            (unsigned long)s.count, (unsigned long)s.min_us, (unsigned long)s.avg_us,
+            (unsigned long)s.p99_us, (unsigned long)s.max_us);
+    }
+
+    // Loop stage profile (last 1s window)
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n, ",\"stages\":{");
+    }
+    for (int i = 0; i < PERF_STAGE_COUNT && n < (int)len; i++) {
+        perf_stage_summary_t s;
+        perf_get_stage((perf_stage_t)i, &s);
+        n += snprintf(buf + n, len - n,
+            "%s\"%s\":{\"count\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu}",
+            i > 0 ? "," : "", stage_prof_names[i],
+            (unsigned long)s.count, (unsigned long)s.min_us,
+            (unsigned long)s.avg_us, (unsigned long)s.max_us);
+    }
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n, "},\"overruns\":{");
+    }
+    for (int i = 0; i < PERF_LOOP_COUNT && n < (int)len; i++) {
+        n += snprintf(buf + n, len - n, "%s\"%s\":%lu",
+            i > 0 ? "," : "", loop_names[i], (unsigned long)loop_overruns[i]);
+    }
+
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n,
+            "},\"shed\":{\"level\":%d,\"events\":%lu,\"misses\":%lu}",
+            (int)shed_level, (unsigned long)shed_events, (unsigned long)deadline_misses);
+    }
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n,
+            ",\"flash\":{\"ops\":%lu,\"gapIdle\":%lu,\"gapFlash\":%lu},\"boot\":",
+            (unsigned long)flash_ops, (unsigned long)wake_gap_max_us[0],
+            (unsigned long)wake_gap_max_us[1]);
+    }
+    if (n < (int)len) {
+        n += perf_boot_to_json(buf + n, len - n);
+    }
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n, "}");
+    }
+    return n;
+}
+
+// ============================================================================
+// Loop Stage Profiler
+// ============================================================================
+
+void perf_stage_end(perf_stage_t stage, uint32_t start_cycles)
+{
+    if (stage >= PERF_STAGE_COUNT) {
+        return;
+    }
+
+    uint32_t cycles = perf_cycles() - start_cycles;
+    stage_accum_t *a = &stage_accum[stage];
+
+    if (a->count == 0 || cycles < a->min_cycles) a->min_cycles = cycles;
+    if (cycles > a->max_cycles) a->max_cycles = cycles;
+    a->sum_cycles += cycles;
+    a->count++;
+
+    // Roll the window: publish and start over
+    uint32_t now = now_us();
+    if (now - a->window_start_us >= PERF_STAGE_WINDOW_US) {
+        perf_stage_summary_t s = {
+            .count = a->count,
+            .min_us = a->min_cycles / cycles_per_us,
+            .avg_us = (uint32_t)(a->sum_cycles / a->count) / cycles_per_us,
+            .max_us = a->max_cycles / cycles_per_us,
+        };
+        portENTER_CRITICAL(&perf_lock);
+        stage_published[stage] = s;
+        portEXIT_CRITICAL(&perf_lock);
+
+        memset(a, 0, sizeof(*a));
+        a->window_start_us = now;
+    }
+}
+
+void perf_loop_end(perf_loop_t loop, uint32_t start_cycles, uint32_t period_us)
+{
+    if (loop >= PERF_LOOP_COUNT) {
+        return;
+    }
+
+    uint32_t busy_us = (perf_cycles() - start_cycles) / cycles_per_us;
+    bool missed = false;
+    if (busy_us > period_us) {
+        loop_overruns[loop]++;
+        missed = true;
+    }
+
+    // Woke more than a full period late: the previous deadline was missed
+    // even if this iteration itself was quick
+    if (loop_last_wake[loop] != 0) {
+        uint32_t interval_us = (start_cycles - loop_last_wake[loop]) / cycles_per_us;
+        if (interval_us > 2 * period_us) {
+            missed = true;
+        }
+        if (loop == PERF_LOOP_CONTROL) {
+            bool during_flash = flash_seen || __atomic_load_n(&flash_active, __ATOMIC_RELAXED);
+            if (interval_us > wake_gap_max_us[during_flash]) {
+                wake_gap_max_us[during_flash] = interval_us;
+            }
+        }
+    }
+    loop_last_wake[loop] = start_cycles;
+    if (loop == PERF_LOOP_CONTROL && __atomic_load_n(&flash_active, __ATOMIC_RELAXED) == 0) {
+        flash_seen = false;
+    }
+    if (loop == PERF_LOOP_CONTROL && missed) {
+        TIMELINE_TRIGGER();
+    }
+
+    uint32_t now = now_us();
+    perf_shed_level_t old_level, new_level;
+
+    portENTER_CRITICAL(&perf_lock);
+    if (missed) {
+        deadline_misses++;
+        window_misses++;
+    }
+
+    old_level = new_level = shed_level;
+    if (now - window_start_us >= DEADLINE_WINDOW_MS * 1000) {
+        if (window_misses >= DEADLINE_MISS_THRESHOLD) {
+            clean_windows = 0;
+            if (shed_level < PERF_SHED_MAX) {
+                new_level = shed_level + 1;
+                shed_events++;
+            }
+        } else if (window_misses == 0 && shed_level > PERF_SHED_NONE) {
+            if (++clean_windows >= DEADLINE_RECOVER_WINDOWS) {
+                clean_windows = 0;
+                new_level = shed_level - 1;
+            }
+        }
+        shed_level = new_level;
+        window_misses = 0;
+        window_start_us = now;
+    }
+    portEXIT_CRITICAL(&perf_lock);
+
+    if (new_level != old_level) {
+        if (new_level > old_level) {
+            ESP_LOGW(TAG, "Deadline misses over threshold - shedding level %d", new_level);
+        } else {
+            ESP_LOGI(TAG, "Timing recovered - shedding level %d", new_level);
+        }
+    }
+}
+
+// ============================================================================
+// Degraded-Mode Scheduler
+// ============================================================================
+
+perf_shed_level_t perf_get_shed_level(void)
+{
+    return shed_level;
+}
+
+void perf_report_stall(void)
+{
+    portENTER_CRITICAL(&perf_lock);
+    deadline_misses++;
+    if (window_misses < DEADLINE_MISS_THRESHOLD) {
+        window_misses = DEADLINE_MISS_THRESHOLD;
+    }
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+uint32_t perf_get_shed_events(void)
+{
+    return shed_events;
+}
+
+uint32_t perf_get_deadline_misses(void)
+{
+    return deadline_misses;
+}
+
+void perf_get_stage(perf_stage_t stage, perf_stage_summary_t *summary)
+{
+    if (stage >= PERF_STAGE_COUNT || summary == NULL) {
+        return;
+    }
+
+    portENTER_CRITICAL(&perf_lock);
+    *summary = stage_published[stage];
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+uint32_t perf_get_overruns(perf_loop_t loop)
+{
+    return (loop < PERF_LOOP_COUNT) ? loop_overruns[loop] : 0;
+}
+
+const char* perf_get_stage_name(perf_stage_t stage)
+{
+    return (stage < PERF_STAGE_COUNT) ? stage_prof_names[stage] : "unknown";
+}
+
+void perf_log_stages(void)
+{
+    char line[384];
+    int n = 0;
+
+    for (int i = 0; i < PERF_STAGE_COUNT && n < (int)sizeof(line); i++) {
+        perf_stage_summary_t s;
+        perf_get_stage((perf_stage_t)i, &s);
+        n += snprintf(line + n, sizeof(line) - n, "%s %lu/%lu/%lu ",
+                      stage_prof_names[i], (unsigned long)s.min_us,
+                      (unsigned long)s.avg_us, (unsigned long)s.max_us);
+    }
+
+    ESP_LOGI(TAG, "Stages us (min/avg/max): %s| overruns ctrl=%lu hk=%lu | shed lvl=%d events=%lu"
+             " | ctrl gap max idle=%lu flash=%lu",
+             line, (unsigned long)loop_overruns[PERF_LOOP_CONTROL],
+             (unsigned long)loop_overruns[PERF_LOOP_HOUSEKEEPING],
+             (int)shed_level, (unsigned long)shed_events,
+             (unsigned long)wake_gap_max_us[0], (unsigned long)wake_gap_max_us[1]);
+}
+
+// ============================================================================
+// Flash Write Stalls
+// ============================================================================
+
+void perf_flash_begin(void)
+{
+    __atomic_fetch_add(&flash_active, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&flash_ops, 1, __ATOMIC_RELAXED);
+    flash_seen = true;
+}
+
+void perf_flash_end(void)
+{
+    __atomic_fetch_sub(&flash_active, 1, __ATOMIC_RELAXED);
+}
+
+uint32_t perf_get_flash_stalls(uint32_t *idle_us, uint32_t *flash_us)
+{
+    *idle_us = wake_gap_max_us[0];
+    *flash_us = wake_gap_max_us[1];
+    return __atomic_load_n(&flash_ops, __ATOMIC_RELAXED);
+}
+
+// ============================================================================
+// Boot Profile
+// ============================================================================
+
+void perf_boot_mark(const char *name)
+{
+    uint32_t ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    portENTER_CRITICAL(&perf_lock);
+    if (boot_mark_count < PERF_BOOT_MARKS) {
+        boot_marks[boot_mark_count++] = (boot_mark_t){ .name = name, .ms = ms };
+    }
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+int perf_boot_to_json(char *buf, size_t len)
+{
+    boot_mark_t marks[PERF_BOOT_MARKS];
+    int count;
+
+    portENTER_CRITICAL(&perf_lock);
+    count = boot_mark_count;
+    memcpy(marks, boot_marks, count * sizeof(boot_mark_t));
+    portEXIT_CRITICAL(&perf_lock);
+
+    int n = snprintf(buf, len, "{");
+    for (int i = 0; i < count && n < (int)len; i++) {
+        n += snprintf(buf + n, len - n, "%s\"%s\":%lu",
+                      i > 0 ? "," : "", marks[i].name, (unsigned long)marks[i].ms);
+    }
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n, "}");
+    }
+    return n < (int)len ? n : (int)len - 1;
+}
+
+void perf_boot_log(void)
+{
+    char line[256];
+    int n = perf_boot_to_json(line, sizeof(line));
+    ESP_LOGI(TAG, "Boot ms: %.*s", n, line);
+}
@@ -0,0 +1,317 @@
+/**
+ * @file perf.h
+ * @brief Stick-to-servo latency instrumentation and loop stage profiler
+ *
+ * Records the age of each new RC frame at control loop entry and at the
+ * first output comparator write that follows it, into fixed-bin histograms
+ * that can be summarized (min/avg/p99/max) for the web UI.
+ *
+ * The stage profiler times each subsystem of the control and housekeeping
+ * loops, and each audio mixer block and its layers, with the CPU cycle counter
+ * and keeps min/mean/max over a rolling one-second window, plus a count
+ * of loop iterations that overran their period.
+ */
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+
+/**
+ * @brief Measured latency stages
+ */
+typedef enum {
+    PERF_LAT_EDGE_TO_LOOP = 0,  // RC falling edge -> control_process() entry
+    PERF_LAT_LOOP_TO_OUTPUT,    // Loop entry -> comparator update
+    PERF_LAT_EDGE_TO_OUTPUT,    // RC falling edge -> comparator update (end to end)
+    PERF_LAT_TICK_TO_LOOP,      // Control timer tick due -> control task running (preemption)
+    PERF_LAT_COUNT
+} perf_latency_t;
+
+/**
+ * @brief Histogram summary for one stage (all values in microseconds)
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+} perf_summary_t;
+
+/**
+ * @brief Initialize latency instrumentation
+ * @return ESP_OK on success
+ */
+esp_err_t perf_init(void);
+
+/**
+ * @brief Mark control loop entry for the given RC frame
+ *
+ * Records edge-to-loop latency once per new frame and arms the output
+ * measurement. Stale frames (already seen) are ignored.
+ * @param edge_us Timestamp of the frame's falling edge (esp_timer, us)
+ */
+void perf_mark_loop_entry(uint32_t edge_us);
+
+/**
+ * @brief Mark an output comparator update
+ *
+ * Only the first update after a perf_mark_loop_entry() is recorded.
+ */
+void perf_mark_output(void);
+
+/**
+ * @brief Record a latency sample directly
+ * @param stage Latency stage
+ * @param us Latency in microseconds
+ */
+void perf_record(perf_latency_t stage, uint32_t us);
+
+/**
+ * @brief Get histogram summary for a stage
+ * @param stage Latency stage
+ * @param summary Pointer to summary to fill
+ */
+void perf_get_summary(perf_latency_t stage, perf_summary_t *summary);
+
+/**
+ * @brief Clear all histograms
+ */
+void perf_reset(void);
+
+/**
+ * @brief Get short name of a stage (used as JSON key)
+ * @param stage Latency stage
+ * @return Name string
+ */
+const char* perf_get_name(perf_latency_t stage);
+
+/**
+ * @brief Write all stage summaries as a JSON object
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Number of characters written
+ */
+int perf_to_json(char *buf, size_t len);
+
+// ============================================================================
+// Loop Stage Profiler
+// ============================================================================
+
+/**
+ * @brief Profiled loop stages
+ */
+typedef enum {
+    PERF_STAGE_CONTROL = 0,     // Calibration or control_process()
+    PERF_STAGE_AUTO_WIFI,       // Menu WiFi request, auto-WiFi, STA state check
+    PERF_STAGE_LED,             // LED state selection + animation
+    PERF_STAGE_SERVO_TEST,      // web_server_update_servo_test()
+    PERF_STAGE_STATUS,          // update_status() (web status frame + WS send)
+    PERF_STAGE_AUDIO_MIX,       // One mixer block: all buses rendered, mixed and saturated
+    PERF_STAGE_AUDIO_ENGINE,    // Engine bus (start, loops/synth, knock, jake, shutdown)
+    PERF_STAGE_AUDIO_EFFECTS,   // Effect voices other than the horn (blocks with any active)
+    PERF_STAGE_AUDIO_HORN,      // Horn voice (blocks where it plays)
+    PERF_STAGE_AUDIO_UI,        // UI bus: chimes, beeps, prompts (blocks where active)
+    PERF_STAGE_AUDIO_DSP,       // Master EQ + limiter (AUDIO_DSP_ENABLE builds)
+    PERF_STAGE_COUNT
+} perf_stage_t;
+
+/**
+ * @brief Loops whose overruns are counted
+ */
+typedef enum {
+    PERF_LOOP_CONTROL = 0,
+    PERF_LOOP_HOUSEKEEPING,
+    PERF_LOOP_COUNT
+} perf_loop_t;
+
+/**
+ * @brief Stage timing over the last completed window (microseconds)
+ */
+typedef struct {
+    uint32_t count;             // Samples in the window
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+} perf_stage_summary_t;
+
+/**
+ * @brief Read the CPU cycle counter to start timing a stage
+ *
+ * With power management the cycle counter's rate follows the CPU clock,
+ * so esp_timer microseconds are counted instead (perf_init() then uses
+ * one "cycle" per microsecond).
+ * @return Current cycle count (per core; the profiled tasks are pinned)
+ */
+static inline uint32_t perf_cycles(void)
+{
+#if CONFIG_PM_ENABLE
+    return (uint32_t)esp_timer_get_time();
+#else
+    return (uint32_t)esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief Record the duration of a stage
+ * @param stage Stage that just finished
+ * @param start_cycles Value of perf_cycles() when the stage began
+ */
+void perf_stage_end(perf_stage_t stage, uint32_t start_cycles);
+
+/**
+ * @brief Mark the end of a loop iteration and count it if it overran
+ *
+ * An iteration misses its deadline when its busy time exceeds the period,
+ * or when it woke more than one period late (the delay call silently
+ * caught up). Misses feed the degraded-mode scheduler below.
+ * @param loop Loop that finished an iteration
+ * @param start_cycles Value of perf_cycles() at wakeup
+ * @param period_us Loop period; iterations longer than this are overruns
+ */
+void perf_loop_end(perf_loop_t loop, uint32_t start_cycles, uint32_t period_us);
+
+/**
+ * @brief Get timing of a stage over the last completed window
+ * @param stage Stage
+ * @param summary Pointer to summary to fill
+ */
+void perf_get_stage(perf_stage_t stage, perf_stage_summary_t *summary);
+
+/**
+ * @brief Get number of overrun iterations since boot/reset
+ * @param loop Loop
+ * @return Overrun count
+ */
+uint32_t perf_get_overruns(perf_loop_t loop);
+
+// ============================================================================
+// Degraded-Mode Scheduler
+// ============================================================================
+
+/**
+ * @brief Load shedding level, each level also sheds everything below it
+ *
+ * Raised one step when a DEADLINE_WINDOW_MS window sees at least
+ * DEADLINE_MISS_THRESHOLD misses, lowered one step after
+ * DEADLINE_RECOVER_WINDOWS clean windows.
+ */
+typedef enum {
+    PERF_SHED_NONE = 0,         // Everything runs
+    PERF_SHED_LED,              // Skip LED animation
+    PERF_SHED_STATUS,           // Also skip web status frame/WS push
+    PERF_SHED_SERVO_TEST,       // Also skip servo test timeout polling
+    PERF_SHED_MAX = PERF_SHED_SERVO_TEST
+} perf_shed_level_t;
+
+/**
+ * @brief Get current load shedding level
+ * @return Shed level
+ */
+perf_shed_level_t perf_get_shed_level(void);
+
+/**
+ * @brief Check whether work at a given level should be skipped
+ * @param level Level at which the work is shed
+ * @return true if the work should be skipped this iteration
+ */
+static inline bool perf_should_shed(perf_shed_level_t level)
+{
+    return perf_get_shed_level() >= level;
+}
+
+/**
+ * @brief Count a task stall as a full window of deadline misses
+ *
+ * Called by the health monitor for stalls too long to leave to the loop
+ * counters, so shedding steps up at the end of the current window.
+ */
+void perf_report_stall(void);
+
+/**
+ * @brief Get number of times shedding was escalated since boot/reset
+ * @return Escalation count
+ */
+uint32_t perf_get_shed_events(void);
+
+/**
+ * @brief Get total deadline misses (all loops) since boot/reset
+ * @return Miss count
+ */
+uint32_t perf_get_deadline_misses(void);
+
+/**
+ * @brief Get short name of a profiled stage (used as JSON key)
+ * @param stage Stage
+ * @return Name string
+ */
+const char* perf_get_stage_name(perf_stage_t stage);
+
+// ============================================================================
+// Flash Write Stalls
+// ============================================================================
+
+/**
+ * @brief Mark the start of a flash write/erase operation (OTA, web UI, NVS, black box)
+ *
+ * While the flash cache is disabled, neither core runs tasks; only IRAM
+ * interrupt handlers (RC capture, servo timer, I2S, UART) keep going. The
+ * control loop's worst wake-to-wake gap is tracked separately for periods
+ * that overlap a flash operation, which bounds the jitter a write causes.
+ * Calls nest.
+ */
+void perf_flash_begin(void);
+
+/**
+ * @brief Mark the end of a flash operation started with perf_flash_begin()
+ */
+void perf_flash_end(void);
+
+/**
+ * @brief Worst control loop wake-to-wake gaps since boot/reset (microseconds)
+ * @param idle_us Gap with no flash operation in progress
+ * @param flash_us Gap overlapping a flash operation
+ * @return Flash operations seen
+ */
+uint32_t perf_get_flash_stalls(uint32_t *idle_us, uint32_t *flash_us);
+
+// ============================================================================
+// Boot Profile
+// ============================================================================
+
+/**
+ * @brief Record a boot milestone at the current time (ms since the app started)
+ * @param name Short JSON key; must outlive the call (string literal)
+ *
+ * Safe to call from any task and before perf_init(). Marks past
+ * PERF_BOOT_MARKS are dropped.
+ */
+void perf_boot_mark(const char *name);
+
+/**
+ * @brief Format the boot milestones as a JSON object, e.g. {"nvs":41,"ready":390}
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Characters written (excluding NUL)
+ */
+int perf_boot_to_json(char *buf, size_t len);
+
+/**
+ * @brief Log the boot milestones on one line
+ */
+void perf_boot_log(void);
+
+/**
+ * @brief Log one line with all stage timings and overruns
+ * Goes out over the UDP log when WiFi is enabled.
+ */
+void perf_log_stages(void);
+
+#endif // PERF_H
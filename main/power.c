@@ -0,0 +1,195 @@
+/**
+ * @file power.c
+ * @brief Dynamic frequency scaling and light sleep gated by activity locks
+ *
+ * Every lock is an ESP_PM_CPU_FREQ_MAX lock, so any one of them also keeps
+ * the chip out of light sleep. Hold state and timing are tracked here under
+ * a spinlock; esp_pm calls are made outside it. The first lock taken from
+ * the low clock is timed as the wake latency: the control task takes its
+ * lock at the top of the tick that first sees the sticks move, so that
+ * tick pays the clock switch once and then runs at full clock.
+ */
+
+#include "power.h"
+#include "config.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <string.h>
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char *TAG = "POWER";
+
+static const char *lock_names[POWER_LOCK_COUNT] = {
+    "control",
+    "audio",
+    "wifi",
+};
+
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t pm_locks[POWER_LOCK_COUNT];
+#endif
+static bool pm_enabled = false;
+static bool light_sleep = false;
+
+static portMUX_TYPE power_lock = portMUX_INITIALIZER_UNLOCKED;
+static power_lock_stats_t lock_stats[POWER_LOCK_COUNT];
+static int64_t held_since_us[POWER_LOCK_COUNT];
+static uint32_t held_mask = 0;
+static int64_t any_since_us = 0;        // Start of the current full-clock period
+static uint64_t any_held_us = 0;        // Completed full-clock periods
+static bool changing[POWER_LOCK_COUNT]; // Acquire/release in flight (outside the spinlock)
+
+esp_err_t power_init(void)
+{
+    memset(lock_stats, 0, sizeof(lock_stats));
+
+#if CONFIG_PM_ENABLE
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        esp_err_t ret = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, lock_names[i], &pm_locks[i]);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Lock '%s' create failed: %s", lock_names[i], esp_err_to_name(ret));
+            return ret;
+        }
+    }
+
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    light_sleep = POWER_LIGHT_SLEEP;
+#endif
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = POWER_MAX_CPU_MHZ,
+        .min_freq_mhz = POWER_MIN_CPU_MHZ,
+        .light_sleep_enable = light_sleep,
+    };
+    esp_err_t ret = esp_pm_configure(&pm_config);
+    if (ret != ESP_OK) {
+        // Locks stay valid; the CPU just keeps its boot clock
+        ESP_LOGW(TAG, "esp_pm_configure failed: %s (full clock)", esp_err_to_name(ret));
+        light_sleep = false;
+        return ESP_OK;
+    }
+    pm_enabled = true;
+    ESP_LOGI(TAG, "DFS %d-%dMHz, light sleep %s", POWER_MIN_CPU_MHZ, POWER_MAX_CPU_MHZ,
+             light_sleep ? "on" : "off");
+#else
+    ESP_LOGI(TAG, "Power management disabled (CONFIG_PM_ENABLE), full clock");
+#endif
+    return ESP_OK;
+}
+
+void power_hold(power_lock_t lock, bool hold)
+{
+    if (lock >= POWER_LOCK_COUNT) {
+        return;
+    }
+
+    portENTER_CRITICAL(&power_lock);
+    if (lock_stats[lock].held == hold || changing[lock]) {
+        portEXIT_CRITICAL(&power_lock);
+        return;
+    }
+    changing[lock] = true;
+    bool from_low = (held_mask == 0);
+    portEXIT_CRITICAL(&power_lock);
+
+    int64_t start = esp_timer_get_time();
+#if CONFIG_PM_ENABLE
+    if (pm_enabled) {
+        if (hold) {
+            esp_pm_lock_acquire(pm_locks[lock]);
+        } else {
+            esp_pm_lock_release(pm_locks[lock]);
+        }
+    }
+#endif
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&power_lock);
+    power_lock_stats_t *st = &lock_stats[lock];
+    st->held = hold;
+    if (hold) {
+        st->acquires++;
+        held_since_us[lock] = now;
+        if (held_mask == 0) {
+            any_since_us = start;
+        }
+        held_mask |= 1u << lock;
+        if (from_low) {
+            st->wake_us = (uint32_t)(now - start);
+            if (st->wake_us > st->wake_max_us) st->wake_max_us = st->wake_us;
+        }
+    } else {
+        st->held_us += (uint64_t)(now - held_since_us[lock]);
+        held_mask &= ~(1u << lock);
+        if (held_mask == 0) {
+            any_held_us += (uint64_t)(now - any_since_us);
+        }
+    }
+    changing[lock] = false;
+    portEXIT_CRITICAL(&power_lock);
+}
+
+void power_get_stats(power_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    uint64_t full_us;
+
+    portENTER_CRITICAL(&power_lock);
+    memcpy(stats->locks, lock_stats, sizeof(lock_stats));
+    for (int i = 0; i < POWER_LOCK_COUNT; i++) {
+        if (lock_stats[i].held) {
+            stats->locks[i].held_us += (uint64_t)(now - held_since_us[i]);
+        }
+    }
+    full_us = any_held_us + ((held_mask != 0) ? (uint64_t)(now - any_since_us) : 0);
+    portEXIT_CRITICAL(&power_lock);
+
+    stats->enabled = pm_enabled;
+    stats->light_sleep = light_sleep;
+    stats->max_mhz = POWER_MAX_CPU_MHZ;
+    stats->min_mhz = pm_enabled ? POWER_MIN_CPU_MHZ : POWER_MAX_CPU_MHZ;
+
+    // Without DFS the chip never leaves full clock
+    uint32_t pct = 100;
+    if (pm_enabled && now > 0) {
+        pct = (uint32_t)((full_us * 100) / (uint64_t)now);
+        if (pct > 100) pct = 100;
+    }
+    stats->full_clock_pct = (uint8_t)pct;
+    stats->est_ma = (uint16_t)((POWER_EST_FULL_MA * pct + POWER_EST_MIN_MA * (100 - pct)) / 100);
+    if (stats->locks[POWER_LOCK_WIFI].held) {
+        stats->est_ma += POWER_EST_WIFI_MA;
+    }
+}
+
+int power_to_json(char *buf, size_t len)
+{
+    power_stats_t st;
+    power_get_stats(&st);
+
+    int n = snprintf(buf, len,
+        "{\"enabled\":%s,\"lightSleep\":%s,\"maxMhz\":%u,\"minMhz\":%u,"
+        "\"fullClockPct\":%u,\"estMa\":%u,\"locks\":{",
+        st.enabled ? "true" : "false", st.light_sleep ? "true" : "false",
+        st.max_mhz, st.min_mhz, st.full_clock_pct, st.est_ma);
+    for (int i = 0; i < POWER_LOCK_COUNT && n < (int)len; i++) {
+        const power_lock_stats_t *l = &st.locks[i];
+        n += snprintf(buf + n, len - n,
+            "%s\"%s\":{\"held\":%s,\"acquires\":%lu,\"heldMs\":%llu,\"wakeUs\":%lu,\"wakeMaxUs\":%lu}",
+            i > 0 ? "," : "", lock_names[i], l->held ? "true" : "false",
+            (unsigned long)l->acquires, (unsigned long long)(l->held_us / 1000),
+            (unsigned long)l->wake_us, (unsigned long)l->wake_max_us);
+    }
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n, "}}");
+    }
+    return n;
+}
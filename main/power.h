@@ -0,0 +1,89 @@
+/**
+ * @file power.h
+ * @brief Dynamic frequency scaling and light sleep gated by activity locks
+ *
+ * The CPU runs at POWER_MIN_CPU_MHZ unless one of the locks below is held:
+ * the control task holds one while the vehicle is in use, the mixer while
+ * it renders audio and the web server while WiFi is on. With nothing held
+ * the chip may light sleep between ticks, subject to the locks the
+ * MCPWM/RMT/I2S drivers take on their own while their outputs run.
+ *
+ * Each lock records how long it was held and how long the switch back to
+ * full clock took (wake latency); the residency gives a current estimate.
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/**
+ * @brief Activity locks (each keeps the CPU at full clock while held)
+ */
+typedef enum {
+    POWER_LOCK_CONTROL = 0,     // Control task: sticks moving, engine on, vehicle rolling
+    POWER_LOCK_AUDIO,           // Mixer task: rendering a block
+    POWER_LOCK_WIFI,            // WiFi enabled
+    POWER_LOCK_COUNT
+} power_lock_t;
+
+/**
+ * @brief Statistics of one lock
+ */
+typedef struct {
+    bool held;
+    uint32_t acquires;          // Times taken since boot
+    uint64_t held_us;           // Total time held, including the current hold
+    uint32_t wake_us;           // Last switch from low to full clock
+    uint32_t wake_max_us;       // Slowest switch
+} power_lock_stats_t;
+
+/**
+ * @brief Power management summary
+ */
+typedef struct {
+    bool enabled;               // esp_pm configured (CONFIG_PM_ENABLE)
+    bool light_sleep;           // Light sleep allowed when no lock is held
+    uint16_t max_mhz;
+    uint16_t min_mhz;
+    uint8_t full_clock_pct;     // Share of uptime with any lock held
+    uint16_t est_ma;            // Estimated chip current (see POWER_EST_* in config.h)
+    power_lock_stats_t locks[POWER_LOCK_COUNT];
+} power_stats_t;
+
+/**
+ * @brief Configure DFS/light sleep and create the locks
+ *
+ * Without CONFIG_PM_ENABLE the CPU stays at full clock; locks are still
+ * tracked so the statistics show what would have been held.
+ * @return ESP_OK on success
+ */
+esp_err_t power_init(void);
+
+/**
+ * @brief Take or release a lock (idempotent, cheap when unchanged)
+ *
+ * Taking the first lock switches to full clock before returning.
+ * @param lock Lock to change
+ * @param hold true to take, false to release
+ */
+void power_hold(power_lock_t lock, bool hold);
+
+/**
+ * @brief Get the power statistics
+ * @param stats Pointer to stats structure to fill
+ */
+void power_get_stats(power_stats_t *stats);
+
+/**
+ * @brief Format the statistics as a JSON object
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Characters written (as snprintf)
+ */
+int power_to_json(char *buf, size_t len);
+
+#endif // POWER_H
@@ -0,0 +1,250 @@
+/**
+ * @file preset.c
+ * @brief Named tuning + sound presets held in RAM, switched without flash access
+ */
+
+#include "preset.h"
+#include "tuning.h"
+#include "nvs_storage.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "PRESET";
+
+#define PRESET_STAGE_RETRY_MS   5   // Wait for the control task to take the previous switch
+
+static preset_bank_t bank;              // Guarded by bank_mutex
+static SemaphoreHandle_t bank_mutex = NULL;
+static TaskHandle_t preset_task_handle = NULL;
+static volatile int8_t requested = -1;  // Latest preset_select(), -1 = none
+static volatile bool switching = false;
+static int8_t aux_position = -1;        // Control task only
+
+static const nvs_field_t preset_fields[] = {
+    NVS_FIELD(preset_bank_t, magic, 1),
+    NVS_FIELD(preset_bank_t, version, 1),
+    NVS_FIELD(preset_bank_t, tuning_version, 1),
+    NVS_FIELD(preset_bank_t, sound_version, 1),
+    NVS_FIELD(preset_bank_t, active, 1),
+    NVS_FIELD(preset_bank_t, names, 1),
+    NVS_FIELD(preset_bank_t, presets, 1),
+};
+
+static const nvs_schema_t preset_schema = {
+    .magic = PRESET_MAGIC,
+    .version = PRESET_VERSION,
+    .size = sizeof(preset_bank_t),
+    .fields = preset_fields,
+    .field_count = sizeof(preset_fields) / sizeof(preset_fields[0]),
+};
+
+/**
+ * @brief Fill a slot from the live config (caller holds bank_mutex)
+ */
+static void slot_capture(preset_t *slot)
+{
+    tuning_copy_config(&slot->tuning);
+    memcpy(&slot->sound, engine_sound_get_config(), sizeof(engine_sound_config_t));
+}
+
+/**
+ * @brief Queue the bank for saving (caller holds bank_mutex)
+ */
+static void bank_save(void)
+{
+    nvs_storage_save_deferred(NVS_BLOB_PRESETS, &bank, sizeof(bank));
+}
+
+/**
+ * @brief Apply one slot: stage its tuning for the control task, then its sound
+ */
+static void apply_slot(uint8_t index)
+{
+    preset_t slot;
+
+    xSemaphoreTake(bank_mutex, portMAX_DELAY);
+    memcpy(&slot, &bank.presets[index], sizeof(slot));
+    bank.active = index;
+    bank_save();
+    xSemaphoreGive(bank_mutex);
+
+    // Builds the tables here; the control task only swaps them in
+    while (!tuning_stage_config(&slot.tuning)) {
+        vTaskDelay(pdMS_TO_TICKS(PRESET_STAGE_RETRY_MS));
+    }
+
+    // The profile goes through the loader (cached, then crossfaded in)
+    sound_profile_t profile = slot.sound.profile;
+    slot.sound.profile = engine_sound_get_profile();
+    engine_sound_set_config(&slot.sound);
+    if (profile != slot.sound.profile) {
+        engine_sound_set_profile(profile);
+    }
+
+    // Boot into the selected setup
+    while (tuning_stage_pending()) {
+        vTaskDelay(pdMS_TO_TICKS(PRESET_STAGE_RETRY_MS));
+    }
+    tuning_save();
+    nvs_storage_save_deferred(NVS_BLOB_SOUND, engine_sound_get_config(), sizeof(engine_sound_config_t));
+}
+
+static void preset_task(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        int8_t index;
+        while ((index = __atomic_exchange_n(&requested, -1, __ATOMIC_SEQ_CST)) >= 0) {
+            apply_slot((uint8_t)index);
+            ESP_LOGI(TAG, "Switched to preset %d (%s)", index, bank.names[index]);
+        }
+        switching = false;
+    }
+}
+
+esp_err_t preset_init(void)
+{
+    bank_mutex = xSemaphoreCreateMutex();
+    if (!bank_mutex) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    memset(&bank, 0, sizeof(bank));
+    esp_err_t ret = nvs_storage_load(NVS_BLOB_PRESETS, &preset_schema, &bank);
+    bool seed = ret != ESP_OK;
+
+    if (!seed && (bank.tuning_version != TUNING_VERSION || bank.sound_version != SOUND_CONFIG_VERSION)) {
+        ESP_LOGW(TAG, "Presets stored with tuning v%lu / sound v%lu, reseeding from the live config",
+                 (unsigned long)bank.tuning_version, (unsigned long)bank.sound_version);
+        seed = true;
+    }
+    if (seed) {
+        for (int i = 0; i < PRESET_COUNT; i++) {
+            slot_capture(&bank.presets[i]);
+            if (bank.names[i][0] == '\0') {
+                snprintf(bank.names[i], PRESET_NAME_LEN, "Preset %d", i + 1);
+            }
+        }
+        bank.magic = PRESET_MAGIC;
+        bank.version = PRESET_VERSION;
+        bank.tuning_version = TUNING_VERSION;
+        bank.sound_version = SOUND_CONFIG_VERSION;
+        if (bank.active >= PRESET_COUNT) {
+            bank.active = 0;
+        }
+        bank_save();
+    }
+    for (int i = 0; i < PRESET_COUNT; i++) {
+        bank.names[i][PRESET_NAME_LEN - 1] = '\0';
+    }
+
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        preset_task,
+        "preset",
+        PRESET_TASK_STACK_SIZE,
+        NULL,
+        PRESET_TASK_PRIORITY,
+        &preset_task_handle,
+        PRESET_TASK_CORE
+    );
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create preset task");
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "%d presets (%u bytes), active %d (%s)%s", PRESET_COUNT,
+             (unsigned)sizeof(bank), bank.active, bank.names[bank.active],
+             seed ? ", seeded from the live config" : "");
+    return ESP_OK;
+}
+
+esp_err_t preset_select(uint8_t index)
+{
+    if (index >= PRESET_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!preset_task_handle) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    switching = true;
+    __atomic_store_n(&requested, (int8_t)index, __ATOMIC_SEQ_CST);
+    xTaskNotifyGive(preset_task_handle);
+    return ESP_OK;
+}
+
+esp_err_t preset_store(uint8_t index, const char *name)
+{
+    if (index >= PRESET_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!bank_mutex) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(bank_mutex, portMAX_DELAY);
+    slot_capture(&bank.presets[index]);
+    if (name) {
+        strlcpy(bank.names[index], name, PRESET_NAME_LEN);
+    }
+    bank_save();
+    xSemaphoreGive(bank_mutex);
+
+    ESP_LOGI(TAG, "Stored live config as preset %d (%s)", index, bank.names[index]);
+    return ESP_OK;
+}
+
+esp_err_t preset_rename(uint8_t index, const char *name)
+{
+    if (index >= PRESET_COUNT || !name) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!bank_mutex) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(bank_mutex, portMAX_DELAY);
+    strlcpy(bank.names[index], name, PRESET_NAME_LEN);
+    bank_save();
+    xSemaphoreGive(bank_mutex);
+    return ESP_OK;
+}
+
+uint8_t preset_get_active(void)
+{
+    return bank.active;
+}
+
+bool preset_is_switching(void)
+{
+    return switching;
+}
+
+bool preset_get_name(uint8_t index, char *name)
+{
+    if (index >= PRESET_COUNT || !bank_mutex) {
+        return false;
+    }
+
+    xSemaphoreTake(bank_mutex, portMAX_DELAY);
+    memcpy(name, bank.names[index], PRESET_NAME_LEN);
+    xSemaphoreGive(bank_mutex);
+    return true;
+}
+
+void preset_aux_update(int16_t value)
+{
+    int8_t position = value > 400 ? 2 : value > -400 ? 1 : 0;
+
+    if (position != aux_position && position < PRESET_COUNT) {
+        aux_position = position;
+        preset_select((uint8_t)position);
+    }
+}
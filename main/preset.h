@@ -0,0 +1,115 @@
+/**
+ * @file preset.h
+ * @brief Named tuning + sound presets held in RAM, switched without flash access
+ *
+ * PRESET_COUNT slots, each a full tuning_config_t and engine_sound_config_t,
+ * are kept in RAM and persisted together as one NVS record. Selecting a
+ * slot (menu, web UI or the PRESET_AUX_CHANNEL switch) only posts a request:
+ * the preset task compiles the slot's lookup tables into a spare bank
+ * (tuning_stage_config) and the control task swaps them in at its next
+ * tick. The switch is then queued for saving like any other config change,
+ * so the vehicle boots into the last selected setup.
+ *
+ * Edits after a switch change the live config only; preset_store() copies
+ * the live config back into a slot.
+ */
+
+#ifndef PRESET_H
+#define PRESET_H
+
+#include "config.h"
+#include "engine_sound.h"
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PRESET_MAGIC            (0x50525354 ^ AXLE_COUNT_MAGIC_TAG)  // "PRST" in hex
+#define PRESET_VERSION          1
+
+/**
+ * @brief One preset slot
+ */
+typedef struct {
+    tuning_config_t tuning;
+    engine_sound_config_t sound;
+} preset_t;
+
+/**
+ * @brief Stored preset record
+ *
+ * Names sit ahead of the slots so they keep their offset (and survive a
+ * migration) when the tuning or sound layout grows. Slots stored under
+ * another tuning or sound version are reseeded from the live config.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t tuning_version;    // TUNING_VERSION the slots were stored with
+    uint32_t sound_version;     // SOUND_CONFIG_VERSION the slots were stored with
+    uint8_t active;             // Last selected slot
+    char names[PRESET_COUNT][PRESET_NAME_LEN];
+    preset_t presets[PRESET_COUNT];
+} preset_bank_t;
+
+/**
+ * @brief Load the preset record and start the preset task
+ *
+ * Call after tuning_init() and once the sound config is loaded; a missing
+ * or unusable record seeds every slot from the live config.
+ * @return ESP_OK on success
+ */
+esp_err_t preset_init(void);
+
+/**
+ * @brief Request a switch to a preset (any task, never blocks)
+ *
+ * The latest request wins if several arrive before the preset task runs.
+ * @param index Slot (0 to PRESET_COUNT-1)
+ * @return ESP_ERR_INVALID_ARG for a bad slot, ESP_ERR_INVALID_STATE before preset_init()
+ */
+esp_err_t preset_select(uint8_t index);
+
+/**
+ * @brief Copy the live tuning and sound config into a slot (and queue a save)
+ * @param index Slot (0 to PRESET_COUNT-1)
+ * @param name New name, or NULL to keep the current one
+ * @return ESP_OK on success
+ */
+esp_err_t preset_store(uint8_t index, const char *name);
+
+/**
+ * @brief Rename a slot (and queue a save)
+ * @param index Slot (0 to PRESET_COUNT-1)
+ * @param name New name (truncated to PRESET_NAME_LEN - 1)
+ * @return ESP_OK on success
+ */
+esp_err_t preset_rename(uint8_t index, const char *name);
+
+/**
+ * @brief Get the last selected slot
+ */
+uint8_t preset_get_active(void);
+
+/**
+ * @brief Check whether a switch is requested or still being applied
+ */
+bool preset_is_switching(void);
+
+/**
+ * @brief Copy a slot's name
+ * @param index Slot (0 to PRESET_COUNT-1)
+ * @param name Buffer of at least PRESET_NAME_LEN bytes
+ * @return false for a bad slot
+ */
+bool preset_get_name(uint8_t index, char *name);
+
+/**
+ * @brief Select presets from a 3-position switch (control task, once per tick)
+ *
+ * Low, center and high pick slots 0, 1 and 2. A slot is requested when the
+ * position changes, including the first valid frame after boot.
+ * @param value Channel value (-1000 to +1000)
+ */
+void preset_aux_update(int16_t value);
+
+#endif // PRESET_H
@@ -1,198 +1,620 @@
 /**
  * @file pwm_output.c
- * @brief PWM output implementation for ESC and servos
+ * @brief PWM output implementation for ESC, servos and auxiliary outputs
  */
 
 #include "pwm_output.h"
+#include "perf.h"
+#include "dshot.h"
+#include "timeline.h"
 #include "driver/mcpwm_prelude.h"
+#include "driver/ledc.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
 
 static const char *TAG = "PWM_OUTPUT";
 
-// ESC comparator handle
-static mcpwm_cmpr_handle_t esc_comparator = NULL;
-static uint16_t esc_current_pulse = FAILSAFE_THROTTLE_US;
+// Commits closer than this to the next TEZ wait for it to pass, so a frame
+// is never split across two PWM periods
+#define COMMIT_TEZ_GUARD_US     40
 
-// Servo comparator handles
-static mcpwm_cmpr_handle_t servo_comparators[SERVO_COUNT] = {NULL};
-static uint16_t servo_current_pulse[SERVO_COUNT] = {SERVO_CENTER_US, SERVO_CENTER_US, SERVO_CENTER_US, SERVO_CENTER_US};
+// Default LEDC channel rate and resolution (50 Hz servo frames, ~1.2us steps)
+#define LEDC_SERVO_RATE_HZ      50
+#define LEDC_SERVO_BITS         14
 
-// Servo GPIO pins (one per axle)
-static const int servo_gpio_pins[SERVO_COUNT] = {
-    PIN_SERVO_AXLE_1,
-    PIN_SERVO_AXLE_2,
-    PIN_SERVO_AXLE_3,
-    PIN_SERVO_AXLE_4
-};
+typedef enum {
+    OUTPUT_BACKEND_MCPWM_ESC,           // MCPWM_GROUP_RC_ESC timer (ESC rate)
+    OUTPUT_BACKEND_MCPWM_SERVO,         // MCPWM_GROUP_SERVOS timer (servo rate)
+    OUTPUT_BACKEND_LEDC,                // LEDC channel (own rate and resolution)
+    OUTPUT_BACKEND_DSHOT,               // DShot frames on RMT (one per commit)
+} output_backend_t;
+
+#if ESC_PROTOCOL == ESC_PROTOCOL_PWM
+#define ESC_BACKEND             OUTPUT_BACKEND_MCPWM_ESC
+#else
+#define ESC_BACKEND             OUTPUT_BACKEND_DSHOT
+#endif
 
-// Servo names for logging
-static const char *servo_names[SERVO_COUNT] = {
-    "Axle-1",
-    "Axle-2",
-    "Axle-3",
-    "Axle-4"
+/**
+ * @brief Where a logical function is driven
+ */
+typedef struct {
+    output_function_t function;
+    int gpio;                           // -1 = not fitted
+    output_backend_t backend;
+    uint16_t min_us;                    // Clamp range
+    uint16_t neutral_us;                // Initial pulse
+    uint16_t max_us;
+    uint16_t rate_hz;                   // LEDC only
+    uint8_t resolution_bits;            // LEDC only
+    const char *name;
+} output_channel_def_t;
+
+// Function -> pin and backend. MCPWM groups take up to
+// OUTPUT_MCPWM_GROUP_CHANNELS each; channels that don't fit are not started.
+static const output_channel_def_t channel_map[] = {
+    { OUTPUT_FN_ESC,             PIN_ESC,           ESC_BACKEND,
+      RC_VALID_MIN_US, FAILSAFE_THROTTLE_US, RC_VALID_MAX_US, 0, 0, "ESC" },
+    { OUTPUT_FN_SERVO_FIRST + 0, PIN_SERVO_AXLE_1,  OUTPUT_BACKEND_MCPWM_SERVO,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, 0, 0, "Axle-1" },
+    { OUTPUT_FN_SERVO_FIRST + 1, PIN_SERVO_AXLE_2,  OUTPUT_BACKEND_MCPWM_SERVO,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, 0, 0, "Axle-2" },
+#if SERVO_COUNT > 2
+    { OUTPUT_FN_SERVO_FIRST + 2, PIN_SERVO_AXLE_3,  OUTPUT_BACKEND_MCPWM_SERVO,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, 0, 0, "Axle-3" },
+#endif
+#if SERVO_COUNT > 3
+    { OUTPUT_FN_SERVO_FIRST + 3, PIN_SERVO_AXLE_4,  OUTPUT_BACKEND_MCPWM_SERVO,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, 0, 0, "Axle-4" },
+#endif
+#if SERVO_COUNT > 4
+    { OUTPUT_FN_SERVO_FIRST + 4, PIN_SERVO_AXLE_5,  OUTPUT_BACKEND_MCPWM_SERVO,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, 0, 0, "Axle-5" },
+#endif
+    { OUTPUT_FN_ESC_2,           PIN_ESC_2,         OUTPUT_BACKEND_MCPWM_ESC,
+      RC_VALID_MIN_US, FAILSAFE_THROTTLE_US, RC_VALID_MAX_US, 0, 0, "ESC-2" },
+    { OUTPUT_FN_WINCH,           PIN_WINCH,         OUTPUT_BACKEND_MCPWM_SERVO,
+      RC_VALID_MIN_US, FAILSAFE_THROTTLE_US, RC_VALID_MAX_US, 0, 0, "Winch" },
+    { OUTPUT_FN_GEARBOX,         PIN_GEARBOX_SERVO, OUTPUT_BACKEND_LEDC,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, LEDC_SERVO_RATE_HZ, LEDC_SERVO_BITS, "Gearbox" },
+    { OUTPUT_FN_LIGHT_SERVO_1,   PIN_LIGHT_SERVO_1, OUTPUT_BACKEND_LEDC,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, LEDC_SERVO_RATE_HZ, LEDC_SERVO_BITS, "Light-1" },
+    { OUTPUT_FN_LIGHT_SERVO_2,   PIN_LIGHT_SERVO_2, OUTPUT_BACKEND_LEDC,
+      SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US, LEDC_SERVO_RATE_HZ, LEDC_SERVO_BITS, "Light-2" },
 };
 
+#define CHANNEL_MAP_SIZE    (sizeof(channel_map) / sizeof(channel_map[0]))
+_Static_assert(CHANNEL_MAP_SIZE <= OUTPUT_CHANNEL_MAX, "channel map exceeds OUTPUT_CHANNEL_MAX");
+_Static_assert(OUTPUT_CHANNEL_MAX <= 32, "channel masks are 32-bit");
+
+/**
+ * @brief A started output channel
+ */
+typedef struct {
+    const output_channel_def_t *def;
+    mcpwm_cmpr_handle_t comparator;     // MCPWM backends
+    ledc_channel_t ledc_channel;        // LEDC backend
+    uint16_t pulse;                     // Current pulse (us)
+} output_channel_t;
+
+/**
+ * @brief An MCPWM group timer and the channels hung off it
+ */
+typedef struct {
+    int group_id;
+    mcpwm_timer_handle_t timer;
+    mcpwm_oper_handle_t oper;           // Operator with a free generator
+    int channels;
+    uint32_t mask;                      // Channel bits
+} output_group_t;
+
+static output_channel_t channels[OUTPUT_CHANNEL_MAX];
+static int channel_count = 0;
+static int8_t function_channel[OUTPUT_FN_COUNT];   // -1 = not fitted
+
+static output_group_t esc_group = { .group_id = MCPWM_GROUP_RC_ESC };
+static output_group_t servo_group = { .group_id = MCPWM_GROUP_SERVOS };
+static uint32_t ledc_mask = 0;
+static uint32_t dshot_mask = 0;
+
+// LEDC timers, one per distinct rate/resolution
+static struct {
+    uint16_t rate_hz;
+    uint8_t bits;
+} ledc_timers[LEDC_TIMER_MAX];
+static int ledc_timer_count = 0;
+static int ledc_channel_count = 0;
+
+// Group periods (runtime configurable)
+static uint32_t esc_period_us = RC_PWM_PERIOD_US;
+static volatile uint32_t servo_period_us = RC_PWM_PERIOD_US;
+
+// Time of the last servo timer TEZ (period start), written by timer ISR
+static volatile uint32_t servo_tez_us = 0;
+static portMUX_TYPE commit_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Auxiliary pulses waiting for the next commit (under commit_lock)
+static uint16_t staged_pulse[OUTPUT_CHANNEL_MAX];
+static uint32_t staged_mask = 0;
+
+// Output deadline (under commit_lock): when the last frame was committed
+// and the MCPWM motor channels (ESC, ESC-2, winch) the ESC timer ISR
+// forces to neutral once it lapses
+static uint32_t commit_us = 0;          // 0 = no frame yet, deadline not armed
+static uint32_t motor_mask = 0;
+static bool deadline_tripped = false;   // Forced since the last commit
+static volatile uint32_t deadline_trips = 0;
+
 /**
- * @brief Initialize ESC PWM output
+ * @brief Servo timer empty (TEZ) callback - marks the start of a period
  */
-static esp_err_t init_esc(void)
+static bool IRAM_ATTR servo_timer_on_empty(mcpwm_timer_handle_t timer,
+                                           const mcpwm_timer_event_data_t *edata,
+                                           void *user_ctx)
+{
+    TIMELINE_ISR_ENTER(TIMELINE_ISR_SERVO_TIMER);
+    servo_tez_us = (uint32_t)esp_timer_get_time();
+    TIMELINE_ISR_EXIT(TIMELINE_ISR_SERVO_TIMER);
+    return false;
+}
+
+/**
+ * @brief ESC timer empty (TEZ) callback - output deadline check
+ *
+ * Runs every ESC period whatever the tasks are doing. When no frame has
+ * been committed for OUTPUT_DEADLINE_MS the motor channels are set to
+ * neutral, latching at their next TEZ; servos keep their last pulse.
+ */
+static bool IRAM_ATTR esc_timer_on_empty(mcpwm_timer_handle_t timer,
+                                         const mcpwm_timer_event_data_t *edata,
+                                         void *user_ctx)
+{
+    uint32_t now = (uint32_t)esp_timer_get_time();
+
+    portENTER_CRITICAL_ISR(&commit_lock);
+    if (commit_us != 0 && !deadline_tripped && now - commit_us > OUTPUT_DEADLINE_MS * 1000u) {
+        for (uint32_t m = motor_mask; m != 0; m &= m - 1) {
+            int c = __builtin_ctz(m);
+            mcpwm_comparator_set_compare_value(channels[c].comparator, FAILSAFE_THROTTLE_US);
+            channels[c].pulse = FAILSAFE_THROTTLE_US;
+        }
+        deadline_tripped = true;
+        deadline_trips++;
+    }
+    portEXIT_CRITICAL_ISR(&commit_lock);
+    return false;
+}
+
+/**
+ * @brief Create an MCPWM group's timer (started once its channels are attached)
+ */
+static esp_err_t group_init(output_group_t *group)
 {
-    ESP_LOGI(TAG, "Initializing ESC on GPIO %d", PIN_ESC);
-    
-    // Create timer for ESC (Group 0, same as RC input capture)
     mcpwm_timer_config_t timer_config = {
-        .group_id = MCPWM_GROUP_RC_ESC,
+        .group_id = group->group_id,
         .clk_src = MCPWM_TIMER_CLK_SRC_DEFAULT,
         .resolution_hz = MCPWM_TIMER_RESOLUTION_HZ,
-        .period_ticks = RC_PWM_PERIOD_US,  // 20000us = 50Hz
+        .period_ticks = RC_PWM_PERIOD_US,  // 20000us = 50Hz (see pwm_output_set_rates)
         .count_mode = MCPWM_TIMER_COUNT_MODE_UP,
+        .flags.update_period_on_empty = true,
     };
-    mcpwm_timer_handle_t timer = NULL;
-    ESP_ERROR_CHECK(mcpwm_new_timer(&timer_config, &timer));
-    
-    // Create operator
-    mcpwm_operator_config_t operator_config = {
-        .group_id = MCPWM_GROUP_RC_ESC,
-    };
-    mcpwm_oper_handle_t oper = NULL;
-    ESP_ERROR_CHECK(mcpwm_new_operator(&operator_config, &oper));
-    ESP_ERROR_CHECK(mcpwm_operator_connect_timer(oper, timer));
-    
-    // Create comparator
+    return mcpwm_new_timer(&timer_config, &group->timer);
+}
+
+/**
+ * @brief Enable and start an MCPWM group's timer
+ */
+static esp_err_t group_start(output_group_t *group)
+{
+    esp_err_t ret = mcpwm_timer_enable(group->timer);
+    if (ret == ESP_OK) {
+        ret = mcpwm_timer_start_stop(group->timer, MCPWM_TIMER_START_NO_STOP);
+    }
+    return ret;
+}
+
+/**
+ * @brief Drive a channel from an MCPWM group timer
+ *
+ * Operators are added as needed, two generators each. Comparators update
+ * on TEZ, so values written together latch in the same period.
+ */
+static esp_err_t mcpwm_attach(output_group_t *group, output_channel_t *ch)
+{
+    if (group->channels >= OUTPUT_MCPWM_GROUP_CHANNELS) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (group->channels % 2 == 0) {
+        mcpwm_operator_config_t operator_config = {
+            .group_id = group->group_id,
+        };
+        ESP_ERROR_CHECK(mcpwm_new_operator(&operator_config, &group->oper));
+        ESP_ERROR_CHECK(mcpwm_operator_connect_timer(group->oper, group->timer));
+    }
+
     mcpwm_comparator_config_t comparator_config = {
         .flags.update_cmp_on_tez = true,
     };
-    ESP_ERROR_CHECK(mcpwm_new_comparator(oper, &comparator_config, &esc_comparator));
-    
-    // Create generator
+    ESP_ERROR_CHECK(mcpwm_new_comparator(group->oper, &comparator_config, &ch->comparator));
+
     mcpwm_generator_config_t generator_config = {
-        .gen_gpio_num = PIN_ESC,
+        .gen_gpio_num = ch->def->gpio,
     };
     mcpwm_gen_handle_t generator = NULL;
-    ESP_ERROR_CHECK(mcpwm_new_generator(oper, &generator_config, &generator));
-    
-    // Set PWM actions: HIGH on timer empty, LOW on compare match
+    ESP_ERROR_CHECK(mcpwm_new_generator(group->oper, &generator_config, &generator));
+
+    // HIGH on timer empty, LOW on compare match
     ESP_ERROR_CHECK(mcpwm_generator_set_action_on_timer_event(generator,
         MCPWM_GEN_TIMER_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, MCPWM_TIMER_EVENT_EMPTY, MCPWM_GEN_ACTION_HIGH)));
     ESP_ERROR_CHECK(mcpwm_generator_set_action_on_compare_event(generator,
-        MCPWM_GEN_COMPARE_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, esc_comparator, MCPWM_GEN_ACTION_LOW)));
-    
-    // Set initial pulse to neutral
-    ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(esc_comparator, FAILSAFE_THROTTLE_US));
-    esc_current_pulse = FAILSAFE_THROTTLE_US;
-    
-    // Enable and start timer
-    ESP_ERROR_CHECK(mcpwm_timer_enable(timer));
-    ESP_ERROR_CHECK(mcpwm_timer_start_stop(timer, MCPWM_TIMER_START_NO_STOP));
-    
-    ESP_LOGI(TAG, "ESC initialized at neutral (%d us)", FAILSAFE_THROTTLE_US);
+        MCPWM_GEN_COMPARE_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, ch->comparator, MCPWM_GEN_ACTION_LOW)));
+
+    ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(ch->comparator, ch->pulse));
+    group->channels++;
     return ESP_OK;
 }
 
 /**
- * @brief Initialize servo PWM outputs
+ * @brief LEDC duty for a pulse width at the channel's rate and resolution
  */
-static esp_err_t init_servos(void)
+static uint32_t ledc_duty(const output_channel_def_t *def, uint16_t pulse_us)
 {
-    ESP_LOGI(TAG, "Initializing %d servos...", SERVO_COUNT);
-    
-    // Create timer for servos (Group 1)
-    mcpwm_timer_config_t timer_config = {
-        .group_id = MCPWM_GROUP_SERVOS,
-        .clk_src = MCPWM_TIMER_CLK_SRC_DEFAULT,
-        .resolution_hz = MCPWM_TIMER_RESOLUTION_HZ,
-        .period_ticks = RC_PWM_PERIOD_US,  // 20000us = 50Hz
-        .count_mode = MCPWM_TIMER_COUNT_MODE_UP,
-    };
-    mcpwm_timer_handle_t timer = NULL;
-    ESP_ERROR_CHECK(mcpwm_new_timer(&timer_config, &timer));
-    
-    // Create operators for servos (need multiple operators for multiple outputs)
-    // Each MCPWM group has 3 operators, each operator has 2 generators
-    // We need 4 servos, so we'll use 2 operators
-    
-    mcpwm_oper_handle_t operators[2] = {NULL, NULL};
-    
-    for (int op = 0; op < 2; op++) {
-        mcpwm_operator_config_t operator_config = {
-            .group_id = MCPWM_GROUP_SERVOS,
-        };
-        ESP_ERROR_CHECK(mcpwm_new_operator(&operator_config, &operators[op]));
-        ESP_ERROR_CHECK(mcpwm_operator_connect_timer(operators[op], timer));
+    return (uint32_t)(((uint64_t)pulse_us * def->rate_hz << def->resolution_bits) / 1000000);
+}
+
+/**
+ * @brief Drive a channel from LEDC, sharing a timer with channels of the same rate
+ */
+static esp_err_t ledc_attach(output_channel_t *ch)
+{
+    const output_channel_def_t *def = ch->def;
+    int timer = 0;
+
+    while (timer < ledc_timer_count &&
+           (ledc_timers[timer].rate_hz != def->rate_hz || ledc_timers[timer].bits != def->resolution_bits)) {
+        timer++;
     }
-    
-    // Create comparators and generators for each servo
-    for (int i = 0; i < SERVO_COUNT; i++) {
-        int op_idx = i / 2;  // Which operator to use
-        
-        // Create comparator
-        mcpwm_comparator_config_t comparator_config = {
-            .flags.update_cmp_on_tez = true,
-        };
-        ESP_ERROR_CHECK(mcpwm_new_comparator(operators[op_idx], &comparator_config, &servo_comparators[i]));
-        
-        // Create generator
-        mcpwm_generator_config_t generator_config = {
-            .gen_gpio_num = servo_gpio_pins[i],
+    if (timer == ledc_timer_count) {
+        if (timer >= LEDC_TIMER_MAX) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        ledc_timer_config_t timer_config = {
+            .speed_mode = LEDC_LOW_SPEED_MODE,
+            .duty_resolution = (ledc_timer_bit_t)def->resolution_bits,
+            .timer_num = (ledc_timer_t)timer,
+            .freq_hz = def->rate_hz,
+            .clk_cfg = LEDC_AUTO_CLK,
         };
-        mcpwm_gen_handle_t generator = NULL;
-        ESP_ERROR_CHECK(mcpwm_new_generator(operators[op_idx], &generator_config, &generator));
-        
-        // Set PWM actions
-        ESP_ERROR_CHECK(mcpwm_generator_set_action_on_timer_event(generator,
-            MCPWM_GEN_TIMER_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, MCPWM_TIMER_EVENT_EMPTY, MCPWM_GEN_ACTION_HIGH)));
-        ESP_ERROR_CHECK(mcpwm_generator_set_action_on_compare_event(generator,
-            MCPWM_GEN_COMPARE_EVENT_ACTION(MCPWM_TIMER_DIRECTION_UP, servo_comparators[i], MCPWM_GEN_ACTION_LOW)));
-        
-        // Set initial pulse to center
-        ESP_ERROR_CHECK(mcpwm_comparator_set_compare_value(servo_comparators[i], SERVO_CENTER_US));
-        servo_current_pulse[i] = SERVO_CENTER_US;
-        
-        ESP_LOGI(TAG, "  Servo %d (%s) on GPIO %d", i, servo_names[i], servo_gpio_pins[i]);
+        ESP_ERROR_CHECK(ledc_timer_config(&timer_config));
+        ledc_timers[timer].rate_hz = def->rate_hz;
+        ledc_timers[timer].bits = def->resolution_bits;
+        ledc_timer_count++;
     }
-    
-    // Enable and start timer
-    ESP_ERROR_CHECK(mcpwm_timer_enable(timer));
-    ESP_ERROR_CHECK(mcpwm_timer_start_stop(timer, MCPWM_TIMER_START_NO_STOP));
-    
-    ESP_LOGI(TAG, "Servos initialized at center (%d us)", SERVO_CENTER_US);
+    if (ledc_channel_count >= LEDC_CHANNEL_MAX) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    ch->ledc_channel = (ledc_channel_t)ledc_channel_count;
+    ledc_channel_config_t channel_config = {
+        .gpio_num = def->gpio,
+        .speed_mode = LEDC_LOW_SPEED_MODE,
+        .channel = ch->ledc_channel,
+        .intr_type = LEDC_INTR_DISABLE,
+        .timer_sel = (ledc_timer_t)timer,
+        .duty = ledc_duty(def, ch->pulse),
+        .hpoint = 0,
+    };
+    ESP_ERROR_CHECK(ledc_channel_config(&channel_config));
+    ledc_channel_count++;
     return ESP_OK;
 }
 
+/**
+ * @brief Write an LEDC channel (latches at the end of its current period)
+ */
+static esp_err_t ledc_write(const output_channel_t *ch, uint16_t pulse_us)
+{
+    esp_err_t ret = ledc_set_duty(LEDC_LOW_SPEED_MODE, ch->ledc_channel, ledc_duty(ch->def, pulse_us));
+    if (ret == ESP_OK) {
+        ret = ledc_update_duty(LEDC_LOW_SPEED_MODE, ch->ledc_channel);
+    }
+    return ret;
+}
+
+static inline uint16_t channel_clamp(const output_channel_t *ch, uint16_t pulse_us)
+{
+    if (pulse_us < ch->def->min_us) return ch->def->min_us;
+    if (pulse_us > ch->def->max_us) return ch->def->max_us;
+    return pulse_us;
+}
+
+static inline output_channel_t *channel_of(output_function_t function)
+{
+    if ((unsigned)function >= OUTPUT_FN_COUNT || function_channel[function] < 0) {
+        return NULL;
+    }
+    return &channels[function_channel[function]];
+}
+
+/**
+ * @brief Write one channel at once (outside the batched commit)
+ */
+static esp_err_t channel_write(output_channel_t *ch, uint16_t pulse_us)
+{
+    pulse_us = channel_clamp(ch, pulse_us);
+    esp_err_t ret;
+    if (ch->def->backend == OUTPUT_BACKEND_LEDC) {
+        ret = ledc_write(ch, pulse_us);
+    } else if (ch->def->backend == OUTPUT_BACKEND_DSHOT) {
+        ret = dshot_write(pulse_us);
+    } else {
+        ret = mcpwm_comparator_set_compare_value(ch->comparator, pulse_us);
+    }
+    if (ret == ESP_OK) {
+        ch->pulse = pulse_us;
+        perf_mark_output();
+    }
+    return ret;
+}
+
 esp_err_t pwm_output_init(void)
 {
     ESP_LOGI(TAG, "Initializing PWM outputs...");
-    
-    esp_err_t ret = init_esc();
-    if (ret != ESP_OK) {
-        return ret;
+
+    for (int f = 0; f < OUTPUT_FN_COUNT; f++) {
+        function_channel[f] = -1;
     }
-    
-    ret = init_servos();
-    if (ret != ESP_OK) {
-        return ret;
+    ESP_ERROR_CHECK(group_init(&esc_group));
+    ESP_ERROR_CHECK(group_init(&servo_group));
+
+    for (size_t i = 0; i < CHANNEL_MAP_SIZE; i++) {
+        const output_channel_def_t *def = &channel_map[i];
+        if (def->gpio < 0) {
+            continue;
+        }
+
+        output_channel_t *ch = &channels[channel_count];
+        *ch = (output_channel_t){ .def = def, .pulse = def->neutral_us };
+
+        esp_err_t ret;
+        output_group_t *group = NULL;
+        if (def->backend == OUTPUT_BACKEND_LEDC) {
+            ret = ledc_attach(ch);
+        } else if (def->backend == OUTPUT_BACKEND_DSHOT) {
+            ret = dshot_init(def->gpio);
+        } else {
+            group = (def->backend == OUTPUT_BACKEND_MCPWM_ESC) ? &esc_group : &servo_group;
+            ret = mcpwm_attach(group, ch);
+        }
+        if (ret != ESP_OK) {
+            // The drive ESC and axle servos are required; extras are optional
+            if (def->function < OUTPUT_FN_ESC_2) {
+                ESP_LOGE(TAG, "No channel for %s on GPIO %d: %s", def->name, def->gpio, esp_err_to_name(ret));
+                return ret;
+            }
+            ESP_LOGW(TAG, "No channel for %s on GPIO %d: %s", def->name, def->gpio, esp_err_to_name(ret));
+            continue;
+        }
+
+        const char *driver;
+        if (group) {
+            group->mask |= 1u << channel_count;
+            if (def->function == OUTPUT_FN_ESC || def->function == OUTPUT_FN_ESC_2 ||
+                def->function == OUTPUT_FN_WINCH) {
+                motor_mask |= 1u << channel_count;
+            }
+            driver = (group == &esc_group) ? "ESC timer" : "servo timer";
+        } else if (def->backend == OUTPUT_BACKEND_DSHOT) {
+            dshot_mask |= 1u << channel_count;
+            driver = "DShot";
+        } else {
+            ledc_mask |= 1u << channel_count;
+            driver = "LEDC";
+        }
+        function_channel[def->function] = (int8_t)channel_count++;
+        ESP_LOGI(TAG, "  %s on GPIO %d (%s) at %d us", def->name, def->gpio, driver, def->neutral_us);
     }
-    
-    ESP_LOGI(TAG, "All PWM outputs initialized");
+
+    // Track period start so frame commits can avoid straddling TEZ
+    mcpwm_timer_event_callbacks_t timer_callbacks = {
+        .on_empty = servo_timer_on_empty,
+    };
+    ESP_ERROR_CHECK(mcpwm_timer_register_event_callbacks(servo_group.timer, &timer_callbacks, NULL));
+
+    // The ESC timer checks the output deadline once per period
+    mcpwm_timer_event_callbacks_t deadline_callbacks = {
+        .on_empty = esc_timer_on_empty,
+    };
+    ESP_ERROR_CHECK(mcpwm_timer_register_event_callbacks(esc_group.timer, &deadline_callbacks, NULL));
+
+    ESP_ERROR_CHECK(group_start(&esc_group));
+    ESP_ERROR_CHECK(group_start(&servo_group));
+
+    ESP_LOGI(TAG, "%d PWM outputs initialized", channel_count);
+    return ESP_OK;
+}
+
+// ============================================================================
+// Output Rate
+// ============================================================================
+
+esp_err_t pwm_output_set_rates(uint16_t esc_rate_hz, uint16_t servo_rate_hz)
+{
+    if (esc_rate_hz < OUTPUT_RATE_MIN_HZ || esc_rate_hz > OUTPUT_RATE_MAX_HZ ||
+        servo_rate_hz < OUTPUT_RATE_MIN_HZ || servo_rate_hz > OUTPUT_RATE_MAX_HZ) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (esc_group.timer == NULL || servo_group.timer == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Timer resolution is 1MHz, so period ticks == microseconds. LEDC
+    // channels keep the rate in their channel map entry, and a DShot ESC
+    // gets one frame per commit.
+    uint32_t esc_period = MCPWM_TIMER_RESOLUTION_HZ / esc_rate_hz;
+    uint32_t servo_period = MCPWM_TIMER_RESOLUTION_HZ / servo_rate_hz;
+
+    if (esc_period != esc_period_us) {
+        ESP_ERROR_CHECK(mcpwm_timer_set_period(esc_group.timer, esc_period));
+        esc_period_us = esc_period;
+        ESP_LOGI(TAG, "ESC output rate: %dHz (%luus)", esc_rate_hz, (unsigned long)esc_period);
+    }
+    if (servo_period != servo_period_us) {
+        ESP_ERROR_CHECK(mcpwm_timer_set_period(servo_group.timer, servo_period));
+        servo_period_us = servo_period;
+        ESP_LOGI(TAG, "Servo output rate: %dHz (%luus)", servo_rate_hz, (unsigned long)servo_period);
+    }
+
     return ESP_OK;
 }
 
+// ============================================================================
+// Frame Commit
+// ============================================================================
+
+/**
+ * @brief Add a function's new pulse to the commit
+ */
+static inline void commit_target(output_function_t function, uint16_t pulse_us,
+                                 uint16_t *target, uint32_t *dirty)
+{
+    int c = function_channel[function];
+    if (c >= 0) {
+        target[c] = pulse_us;
+        *dirty |= 1u << c;
+    }
+}
+
+esp_err_t pwm_output_commit(const output_frame_t *frame)
+{
+    if (frame == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint16_t target[OUTPUT_CHANNEL_MAX];
+    uint32_t dirty;
+
+    // Auxiliary pulses staged since the last commit go out with this frame.
+    // Feeding the deadline here, under the lock, means the ESC timer ISR
+    // can't force neutral between the pulse comparisons below and the writes.
+    portENTER_CRITICAL(&commit_lock);
+    commit_us = (uint32_t)esp_timer_get_time();
+    deadline_tripped = false;
+    dirty = staged_mask;
+    for (uint32_t m = dirty; m != 0; m &= m - 1) {
+        int c = __builtin_ctz(m);
+        target[c] = staged_pulse[c];
+    }
+    staged_mask = 0;
+    portEXIT_CRITICAL(&commit_lock);
+
+    if (frame->update_esc) {
+        commit_target(OUTPUT_FN_ESC, frame->esc_pulse, target, &dirty);
+    }
+    if (frame->update_servos) {
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            commit_target(OUTPUT_FN_SERVO_FIRST + i, frame->servo_pulse[i], target, &dirty);
+        }
+    }
+
+    // Clamp and keep only the channels that actually change (DShot
+    // channels are sent every commit regardless, see below)
+    for (uint32_t m = dirty; m != 0; m &= m - 1) {
+        int c = __builtin_ctz(m);
+        target[c] = channel_clamp(&channels[c], target[c]);
+        if (target[c] == channels[c].pulse) {
+            dirty &= ~(1u << c);
+        }
+    }
+
+    if (dirty) {
+        // If the servo timer is about to wrap, let TEZ pass first so all
+        // shadow registers latch together on the following one
+        if (dirty & servo_group.mask) {
+            uint32_t tez = servo_tez_us;
+            uint32_t since = (uint32_t)esp_timer_get_time() - tez;
+            uint32_t period = servo_period_us;
+            if (since >= period - COMMIT_TEZ_GUARD_US && since < period + COMMIT_TEZ_GUARD_US) {
+                int64_t deadline = esp_timer_get_time() + 2 * COMMIT_TEZ_GUARD_US;
+                while (servo_tez_us == tez && esp_timer_get_time() < deadline) {
+                    // Bounded spin (< 2 guard windows)
+                }
+            }
+        }
+
+        portENTER_CRITICAL(&commit_lock);
+        for (uint32_t m = dirty & ~(ledc_mask | dshot_mask); m != 0; m &= m - 1) {
+            int c = __builtin_ctz(m);
+            mcpwm_comparator_set_compare_value(channels[c].comparator, target[c]);
+            channels[c].pulse = target[c];
+        }
+        portEXIT_CRITICAL(&commit_lock);
+
+        // LEDC channels latch at the end of their own periods
+        for (uint32_t m = dirty & ledc_mask; m != 0; m &= m - 1) {
+            int c = __builtin_ctz(m);
+            if (ledc_write(&channels[c], target[c]) == ESP_OK) {
+                channels[c].pulse = target[c];
+            }
+        }
+    }
+
+    // A DShot ESC disarms when frames stop, and each frame is also its
+    // telemetry request, so these go out on every commit
+    for (uint32_t m = dshot_mask; m != 0; m &= m - 1) {
+        int c = __builtin_ctz(m);
+        uint16_t pulse = (dirty & (1u << c)) ? target[c] : channels[c].pulse;
+        if (dshot_write(pulse) == ESP_OK) {
+            channels[c].pulse = pulse;
+        }
+    }
+
+    perf_mark_output();
+    return ESP_OK;
+}
+
+esp_err_t pwm_output_stage(output_function_t function, uint16_t pulse_us)
+{
+    output_channel_t *ch = channel_of(function);
+    if (ch == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    int c = ch - channels;
+    portENTER_CRITICAL(&commit_lock);
+    staged_pulse[c] = pulse_us;
+    staged_mask |= 1u << c;
+    portEXIT_CRITICAL(&commit_lock);
+    return ESP_OK;
+}
+
+uint32_t pwm_output_deadline_trips(void)
+{
+    return deadline_trips;
+}
+
+bool pwm_output_is_fitted(output_function_t function)
+{
+    return channel_of(function) != NULL;
+}
+
+uint16_t pwm_output_get_pulse(output_function_t function)
+{
+    output_channel_t *ch = channel_of(function);
+    return ch ? ch->pulse : 0;
+}
+
 // ============================================================================
 // ESC Control
 // ============================================================================
 
 esp_err_t esc_set_pulse(uint16_t pulse_us)
 {
-    // Clamp to valid range
-    if (pulse_us < RC_VALID_MIN_US) pulse_us = RC_VALID_MIN_US;
-    if (pulse_us > RC_VALID_MAX_US) pulse_us = RC_VALID_MAX_US;
-    
-    esp_err_t ret = mcpwm_comparator_set_compare_value(esc_comparator, pulse_us);
-    if (ret == ESP_OK) {
-        esc_current_pulse = pulse_us;
+    output_channel_t *ch = channel_of(OUTPUT_FN_ESC);
+    if (ch == NULL) {
+        return ESP_ERR_INVALID_STATE;
     }
-    return ret;
+    return channel_write(ch, pulse_us);
 }
 
 esp_err_t esc_set_throttle(int16_t throttle)
@@ -208,7 +630,8 @@ esp_err_t esc_set_neutral(void)
 
 uint16_t esc_get_pulse(void)
 {
-    return esc_current_pulse;
+    output_channel_t *ch = channel_of(OUTPUT_FN_ESC);
+    return ch ? ch->pulse : FAILSAFE_THROTTLE_US;
 }
 
 // ============================================================================
@@ -220,16 +643,11 @@ esp_err_t servo_set_pulse(servo_id_t servo, uint16_t pulse_us)
     if (servo >= SERVO_COUNT) {
         return ESP_ERR_INVALID_ARG;
     }
-    
-    // Clamp to valid servo range
-    if (pulse_us < SERVO_MIN_US) pulse_us = SERVO_MIN_US;
-    if (pulse_us > SERVO_MAX_US) pulse_us = SERVO_MAX_US;
-    
-    esp_err_t ret = mcpwm_comparator_set_compare_value(servo_comparators[servo], pulse_us);
-    if (ret == ESP_OK) {
-        servo_current_pulse[servo] = pulse_us;
+    output_channel_t *ch = channel_of(OUTPUT_FN_SERVO_FIRST + servo);
+    if (ch == NULL) {
+        return ESP_ERR_INVALID_STATE;
     }
-    return ret;
+    return channel_write(ch, pulse_us);
 }
 
 esp_err_t servo_set_position(servo_id_t servo, int16_t position)
@@ -264,10 +682,8 @@ esp_err_t servo_set_all(const int16_t positions[SERVO_COUNT])
 
 uint16_t servo_get_pulse(servo_id_t servo)
 {
-    if (servo >= SERVO_COUNT) {
-        return SERVO_CENTER_US;
-    }
-    return servo_current_pulse[servo];
+    output_channel_t *ch = (servo < SERVO_COUNT) ? channel_of(OUTPUT_FN_SERVO_FIRST + servo) : NULL;
+    return ch ? ch->pulse : SERVO_CENTER_US;
 }
 
 // ============================================================================
@@ -1,6 +1,14 @@
 /**
  * @file pwm_output.h
- * @brief PWM output interface for ESC and servos
+ * @brief PWM output interface for ESC, servos and auxiliary outputs
+ *
+ * Every output is a channel serving one logical function (drive ESC, an
+ * axle servo, winch, ...). A channel map in pwm_output.c ties functions to
+ * pins and to a backend: one of the two MCPWM group timers (shared period,
+ * set by pwm_output_set_rates()) or an LEDC channel with its own rate and
+ * resolution. With ESC_PROTOCOL set to DShot the drive ESC is sent a
+ * digital frame on every commit instead (dshot.c). Functions whose pin is
+ * -1 in config.h are not fitted.
  */
 
 #ifndef PWM_OUTPUT_H
@@ -14,16 +22,98 @@
 typedef enum {
     SERVO_AXLE_1 = 0,   // Front axle
     SERVO_AXLE_2,       // Second axle
-    SERVO_AXLE_3,       // Third axle
-    SERVO_AXLE_4        // Rear axle
+    SERVO_AXLE_3,       // Third axle (6x6 and up)
+    SERVO_AXLE_4,       // Fourth axle (8x8 and up)
+    SERVO_AXLE_5        // Fifth axle (10x10)
 } servo_id_t;
 
+/**
+ * @brief Logical output functions
+ */
+typedef enum {
+    OUTPUT_FN_ESC = 0,                                      // Main drive ESC
+    OUTPUT_FN_SERVO_FIRST,                                  // Axle servos (SERVO_COUNT)
+    OUTPUT_FN_ESC_2 = OUTPUT_FN_SERVO_FIRST + SERVO_COUNT,  // Second drive ESC
+    OUTPUT_FN_WINCH,
+    OUTPUT_FN_GEARBOX,
+    OUTPUT_FN_LIGHT_SERVO_1,
+    OUTPUT_FN_LIGHT_SERVO_2,
+    OUTPUT_FN_COUNT
+} output_function_t;
+
+/**
+ * @brief One control tick's worth of output values
+ */
+typedef struct {
+    uint16_t esc_pulse;                 // ESC pulse width (us)
+    uint16_t servo_pulse[SERVO_COUNT];  // Servo pulse widths (us)
+    bool update_esc;                    // Apply esc_pulse
+    bool update_servos;                 // Apply servo_pulse[]
+} output_frame_t;
+
 /**
  * @brief Initialize all PWM outputs (ESC and servos)
  * @return ESP_OK on success
  */
 esp_err_t pwm_output_init(void);
 
+/**
+ * @brief Set PWM frame rate for the ESC and servo groups
+ *
+ * Takes effect at the next period boundary of each timer. Callers are
+ * expected to pass rates already validated against the pulse endpoints
+ * (see tuning_max_output_rate_hz()).
+ * @param esc_rate_hz ESC frame rate (OUTPUT_RATE_MIN_HZ..OUTPUT_RATE_MAX_HZ)
+ * @param servo_rate_hz Servo frame rate (OUTPUT_RATE_MIN_HZ..OUTPUT_RATE_MAX_HZ)
+ * @return ESP_OK on success
+ */
+esp_err_t pwm_output_set_rates(uint16_t esc_rate_hz, uint16_t servo_rate_hz);
+
+/**
+ * @brief Apply a complete output frame
+ *
+ * All comparator values are staged together so they latch on the same
+ * timer TEZ (update-on-zero) event - no PWM period starts with only some
+ * axles updated. Commits are kept clear of the TEZ edge, and comparators
+ * whose value hasn't changed are not written.
+ *
+ * Each commit also feeds the output deadline: if none arrives for
+ * OUTPUT_DEADLINE_MS, the ESC timer interrupt sets the MCPWM ESC, second
+ * ESC and winch channels to neutral and servos hold their last pulse,
+ * until the next commit. A DShot ESC disarms by itself once frames stop.
+ * @param frame Output values to apply
+ * @return ESP_OK on success
+ */
+esp_err_t pwm_output_commit(const output_frame_t *frame);
+
+/**
+ * @brief Stage a pulse for an auxiliary output
+ *
+ * Applied by the next pwm_output_commit() together with the control
+ * frame, so auxiliary outputs add no writes of their own to the control
+ * loop. Staging again before the commit replaces the value.
+ * @param function Output function (clamped to its channel's range)
+ * @param pulse_us Pulse width in microseconds
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the function is not fitted
+ */
+esp_err_t pwm_output_stage(output_function_t function, uint16_t pulse_us);
+
+/**
+ * @brief Number of times the output deadline has forced neutral since boot
+ */
+uint32_t pwm_output_deadline_trips(void);
+
+/**
+ * @brief Check whether a function has an output channel
+ */
+bool pwm_output_is_fitted(output_function_t function);
+
+/**
+ * @brief Current pulse of a function's channel
+ * @return Pulse width in microseconds, 0 if not fitted
+ */
+uint16_t pwm_output_get_pulse(output_function_t function);
+
 // ============================================================================
 // ESC Control
 // ============================================================================
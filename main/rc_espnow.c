@@ -0,0 +1,231 @@
+/**
+ * @file rc_espnow.c
+ * @brief ESP-NOW RC input from a paired ESP32 transmitter
+ *
+ * The receive callback runs in the WiFi task. It validates the frame,
+ * checks the sender and the sequence number and publishes the pulses with
+ * rc_input_publish_frame(), which wakes the control task. Adding the peer
+ * and sending telemetry happen on an esp_timer so the callback stays short.
+ */
+
+#include "rc_espnow.h"
+#include "rc_input.h"
+#include "esp_now.h"
+#include "esp_wifi.h"
+#include "esp_mac.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stddef.h>
+#include <string.h>
+
+static const char *TAG = "RC_ESPNOW";
+
+#define ESPNOW_HEADER_BYTES     offsetof(rc_espnow_frame_t, pulse_us)
+#define ESPNOW_RESYNC_GAP       250     // Larger jumps restart the sequence (not counted lost)
+#define ESPNOW_LQ_LOST_MAX      16      // Lost frames applied to link quality per gap
+
+static const uint8_t configured_peer[6] = RC_ESPNOW_PEER_MAC;
+
+// Written by the receive callback only (diagnostics: torn reads are harmless)
+static rc_espnow_stats_t stats;
+static bool have_seq = false;
+static uint16_t last_seq = 0;
+static int64_t last_frame_us = 0;
+static uint32_t link_quality_q8 = 0;   // Percent in Q8
+
+static bool started = false;
+static bool peer_added = false;
+static esp_timer_handle_t telemetry_timer = NULL;
+
+/**
+ * @brief Sender check: the configured MAC, or pair with the first one heard
+ */
+static bool accept_sender(const uint8_t *mac)
+{
+    if (stats.paired) {
+        return memcmp(mac, stats.peer, sizeof(stats.peer)) == 0;
+    }
+
+    static const uint8_t any[6] = {0};
+    if (memcmp(configured_peer, any, sizeof(any)) != 0 &&
+        memcmp(mac, configured_peer, sizeof(configured_peer)) != 0) {
+        return false;
+    }
+
+    memcpy(stats.peer, mac, sizeof(stats.peer));
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    stats.paired = true;
+    ESP_LOGI(TAG, "Paired with transmitter " MACSTR, MAC2STR(mac));
+    return true;
+}
+
+/**
+ * @brief ESP-NOW receive callback (WiFi task)
+ */
+static void recv_callback(const esp_now_recv_info_t *info, const uint8_t *data, int len)
+{
+    const rc_espnow_frame_t *frame = (const rc_espnow_frame_t *)data;
+
+    if (len < (int)ESPNOW_HEADER_BYTES ||
+        frame->magic != RC_ESPNOW_MAGIC_CHANNELS ||
+        frame->version != RC_ESPNOW_VERSION ||
+        frame->count == 0 || frame->count > RC_MAX_CHANNELS ||
+        len != (int)(ESPNOW_HEADER_BYTES + frame->count * sizeof(uint16_t))) {
+        stats.rejected++;
+        return;
+    }
+    if (!accept_sender(info->src_addr)) {
+        stats.rejected++;
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    uint32_t lost = 0;
+
+    if (have_seq) {
+        uint16_t gap = (uint16_t)(frame->seq - last_seq);
+        bool link_alive = (now - last_frame_us) < (int64_t)RC_SIGNAL_TIMEOUT_MS * 1000;
+
+        if (gap == 0 || gap >= 0x8000) {
+            // Duplicate or reordered, unless the transmitter restarted
+            if (link_alive) {
+                stats.rejected++;
+                return;
+            }
+        } else if (gap <= ESPNOW_RESYNC_GAP) {
+            lost = gap - 1;
+        }
+
+        uint32_t interval = (uint32_t)(now - last_frame_us);
+        if (link_alive && lost == 0) {
+            int32_t mean = stats.interval_us;
+            if (interval > UINT16_MAX) interval = UINT16_MAX;
+            stats.interval_us = (mean == 0) ? (uint16_t)interval
+                                            : (uint16_t)(mean + ((int32_t)interval - mean) / 16);
+        }
+    }
+    have_seq = true;
+    last_seq = frame->seq;
+    last_frame_us = now;
+    stats.lost += lost;
+    stats.rssi = (int8_t)info->rx_ctrl->rssi;
+
+    // Link quality: 1/16 weight per expected frame
+    for (uint32_t i = 0; i < lost && i < ESPNOW_LQ_LOST_MAX; i++) {
+        link_quality_q8 -= link_quality_q8 >> 4;
+    }
+    link_quality_q8 += ((100u << 8) - link_quality_q8) >> 4;
+    stats.link_quality = (uint8_t)(link_quality_q8 >> 8);
+
+    if (frame->flags & RC_ESPNOW_FLAG_FAILSAFE) {
+        // Left unpublished so the channels time out into failsafe
+        stats.failsafe++;
+        return;
+    }
+
+    // Copy out: the payload is not guaranteed to be 2-byte aligned
+    uint16_t pulses[RC_MAX_CHANNELS];
+    memcpy(pulses, frame->pulse_us, frame->count * sizeof(uint16_t));
+    rc_input_publish_frame(pulses, frame->count);
+    stats.frames++;
+}
+
+/**
+ * @brief Telemetry timer: register the peer once paired, then report the link
+ */
+static void telemetry_callback(void *arg)
+{
+    if (!stats.paired) {
+        return;
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    if (!peer_added) {
+        esp_now_peer_info_t peer = {
+            .channel = 0,               // Current channel
+            .ifidx = WIFI_IF_AP,
+            .encrypt = false,
+        };
+        memcpy(peer.peer_addr, stats.peer, sizeof(peer.peer_addr));
+        esp_err_t ret = esp_now_add_peer(&peer);
+        if (ret != ESP_OK && ret != ESP_ERR_ESPNOW_EXIST) {
+            ESP_LOGW(TAG, "Add peer failed: %s", esp_err_to_name(ret));
+            return;
+        }
+        peer_added = true;
+    }
+
+    rc_espnow_telemetry_t tel = {
+        .magic = RC_ESPNOW_MAGIC_TELEMETRY,
+        .version = RC_ESPNOW_VERSION,
+        .last_seq = last_seq,
+        .link_quality = stats.link_quality,
+        .rssi = stats.rssi,
+        .frames = stats.frames,
+        .lost = stats.lost,
+    };
+    esp_now_send(stats.peer, (const uint8_t *)&tel, sizeof(tel));
+}
+
+esp_err_t rc_espnow_init(void)
+{
+    memset(&stats, 0, sizeof(stats));
+    have_seq = false;
+    last_seq = 0;
+    last_frame_us = 0;
+    link_quality_q8 = 0;
+
+    ESP_LOGI(TAG, "ESP-NOW input selected (starts with WiFi)");
+    return ESP_OK;
+}
+
+esp_err_t rc_espnow_start(void)
+{
+    if (started) {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = esp_now_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "esp_now_init failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ret = esp_now_register_recv_cb(recv_callback);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Receive callback failed: %s", esp_err_to_name(ret));
+        esp_now_deinit();
+        return ret;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = telemetry_callback,
+        .name = "espnow_tel",
+    };
+    ret = esp_timer_create(&timer_args, &telemetry_timer);
+    if (ret == ESP_OK) {
+        ret = esp_timer_start_periodic(telemetry_timer, 1000000 / RC_ESPNOW_TELEMETRY_HZ);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Telemetry timer failed: %s (input still works)", esp_err_to_name(ret));
+    }
+
+    uint8_t channel = 0;
+    wifi_second_chan_t second;
+    esp_wifi_get_channel(&channel, &second);
+    started = true;
+    ESP_LOGI(TAG, "ESP-NOW input listening on channel %d", channel);
+    return ESP_OK;
+}
+
+int rc_espnow_get_channel_count(void)
+{
+    return RC_MAX_CHANNELS;
+}
+
+void rc_espnow_get_stats(rc_espnow_stats_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    memcpy(out, &stats, sizeof(*out));
+}
@@ -0,0 +1,97 @@
+/**
+ * @file rc_espnow.h
+ * @brief ESP-NOW RC input from a paired ESP32 transmitter
+ *
+ * The transmitter sends one channel frame per packet at 100-250Hz. Frames
+ * are checked and published through rc_input straight from the WiFi
+ * receive callback, so a frame reaches the control task with no queue in
+ * between; a lost link times out like any other backend. Link statistics
+ * go back to the transmitter at RC_ESPNOW_TELEMETRY_HZ.
+ */
+
+#ifndef RC_ESPNOW_H
+#define RC_ESPNOW_H
+
+#include "config.h"
+#include "esp_err.h"
+
+// Packet magics and version (first two bytes of every packet)
+#define RC_ESPNOW_MAGIC_CHANNELS    0xC8    // Transmitter -> vehicle
+#define RC_ESPNOW_MAGIC_TELEMETRY   0x8C    // Vehicle -> transmitter
+#define RC_ESPNOW_VERSION           1
+
+// Channel frame flags
+#define RC_ESPNOW_FLAG_FAILSAFE     0x01    // Transmitter lost its sticks: don't drive
+
+/**
+ * @brief Channel frame (little-endian, pulses in microseconds)
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t magic;                      // RC_ESPNOW_MAGIC_CHANNELS
+    uint8_t version;                    // RC_ESPNOW_VERSION
+    uint16_t seq;                       // +1 per frame, gaps count as lost
+    uint8_t flags;                      // RC_ESPNOW_FLAG_*
+    uint8_t count;                      // Channels that follow (1..RC_MAX_CHANNELS)
+    uint16_t pulse_us[RC_MAX_CHANNELS]; // Only the first count are sent
+} rc_espnow_frame_t;
+
+/**
+ * @brief Telemetry packet sent back to the transmitter
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t magic;                      // RC_ESPNOW_MAGIC_TELEMETRY
+    uint8_t version;                    // RC_ESPNOW_VERSION
+    uint16_t last_seq;                  // Last frame accepted
+    uint8_t link_quality;               // % of recent frames received
+    int8_t rssi;                        // dBm of the last frame
+    uint32_t frames;
+    uint32_t lost;
+} rc_espnow_telemetry_t;
+
+/**
+ * @brief Link statistics
+ */
+typedef struct {
+    uint32_t frames;            // Frames published
+    uint32_t lost;              // Frames missing from the sequence
+    uint32_t rejected;          // Malformed, other sender, duplicate or stale
+    uint32_t failsafe;          // Frames flagged failsafe by the transmitter
+    uint16_t interval_us;       // Running mean time between frames
+    uint8_t link_quality;       // % of recent frames received
+    int8_t rssi;                // dBm of the last frame
+    bool paired;                // Peer known (configured or first heard)
+    uint8_t peer[6];            // Transmitter MAC
+} rc_espnow_stats_t;
+
+/**
+ * @brief Reset link state (called from rc_input_init)
+ *
+ * ESP-NOW needs the WiFi driver running, so reception starts in
+ * rc_espnow_start().
+ * @return ESP_OK on success
+ */
+esp_err_t rc_espnow_init(void);
+
+/**
+ * @brief Start ESP-NOW reception and the telemetry timer
+ *
+ * Call once after esp_wifi_start() (web_server_wifi_enable() does).
+ * @return ESP_OK on success
+ */
+esp_err_t rc_espnow_start(void);
+
+/**
+ * @brief Get maximum number of channels a frame can carry
+ *
+ * Channels beyond those present in the received frame stay invalid.
+ * @return Channel count
+ */
+int rc_espnow_get_channel_count(void);
+
+/**
+ * @brief Get link statistics
+ * @param stats Pointer to stats structure to fill
+ */
+void rc_espnow_get_stats(rc_espnow_stats_t *stats);
+
+#endif // RC_ESPNOW_H
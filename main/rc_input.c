@@ -4,12 +4,16 @@
  */
 
 #include "rc_input.h"
+#include "rc_serial.h"
+#include "rc_ppm.h"
+#include "rc_espnow.h"
+#include "timeline.h"
 #include "driver/mcpwm_cap.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
 #include <string.h>
+#include <math.h>
 
 static const char *TAG = "RC_INPUT";
 
@@ -36,31 +40,193 @@ static const char *rc_channel_names[RC_CHANNEL_COUNT] = {
 // Capture channel handles
 static mcpwm_cap_channel_handle_t cap_channels[RC_CHANNEL_COUNT] = {NULL};
 
-// Raw channel data (updated by ISR)
-static volatile rc_channel_raw_t channel_data[RC_CHANNEL_COUNT];
+// Raw channel data (updated by capture ISR or serial backend)
+// Sized for serial protocols; the PWM backend only fills the first 6
+static volatile rc_channel_raw_t channel_data[RC_MAX_CHANNELS];
+static int active_channel_count = RC_CHANNEL_COUNT;
 
 // Edge timestamps for pulse measurement
 static volatile uint32_t rising_edge[RC_CHANNEL_COUNT] = {0};
 static volatile bool got_rising[RC_CHANNEL_COUNT] = {false};
 
-// Mutex for thread-safe access
-static SemaphoreHandle_t data_mutex = NULL;
+// Per-channel sequence counters (seqlock). The ISR makes the counter odd while
+// it writes channel_data[ch] and even again once the record is complete, so
+// readers can copy without blocking and retry if they raced a write. One
+// counter per channel because channels 0-2 and 3-5 are written by different
+// MCPWM group ISRs that may run concurrently.
+static volatile uint32_t channel_seq[RC_MAX_CHANNELS] = {0};
+
+// Serial backends publish from task context; the critical section keeps a
+// same-core reader from preempting a half-written record and spinning on it
+static portMUX_TYPE publish_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// ISR filter state: last three raw pulses per channel (median-of-3)
+static uint16_t pulse_history[RC_CHANNEL_COUNT][3];
+static uint8_t pulse_history_fill[RC_CHANNEL_COUNT];
+
+// ISR jitter statistics (exponential moving averages, 1/8 weight)
+// mean is kept in us * 16 for sub-microsecond precision, variance in us^2
+typedef struct {
+    int32_t mean_q4;
+    uint32_t var;
+    uint32_t interval_us;
+    uint32_t last_edge_us;
+    uint32_t glitches;
+    uint32_t pulses;
+} isr_stats_t;
+static volatile isr_stats_t channel_stats[RC_CHANNEL_COUNT];
+
+// Calibration capture: every accepted pulse of the selected channels since
+// rc_input_cal_capture_start(), plus a short-term mean/variance (1/16 weight)
+// that says whether the stick is being held still
+typedef struct {
+    uint16_t min_us;
+    uint16_t max_us;
+    uint32_t count;
+    uint32_t sum_us;
+    int32_t recent_q4;
+    uint32_t recent_var;
+} cal_capture_t;
+static cal_capture_t cal_capture[RC_CHANNEL_COUNT];
+static volatile uint32_t cal_capture_mask = 0;
+static portMUX_TYPE cal_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Frame-arrival notification. Throttle and steering are both on capture group
+// 0, so these are only ever touched from one ISR.
+#define FRAME_NOTIFY_MASK   ((1u << RC_CH_THROTTLE) | (1u << RC_CH_STEERING))
+static TaskHandle_t frame_notify_task = NULL;
+static uint32_t frame_pending_mask = 0;
+
+// Timestamp (us) of the falling edge that completed the latest frame
+static volatile uint32_t frame_edge_us = 0;
+
+// Stress test: the receiver is ignored and frames come from rc_input_inject_frame()
+static volatile bool input_synthetic = false;
 
 // ESP32 MCPWM capture runs at 80MHz
 #define TICKS_PER_US    80
 
 /**
- * @brief Capture callback - called on rising and falling edges
+ * @brief Constant-time median of three
  */
-static bool IRAM_ATTR capture_callback(mcpwm_cap_channel_handle_t cap_chan,
-                                        const mcpwm_capture_event_data_t *edata,
-                                        void *user_data)
+static inline uint16_t IRAM_ATTR median3(uint16_t a, uint16_t b, uint16_t c)
+{
+    uint16_t lo = (a < b) ? a : b;
+    uint16_t hi = (a < b) ? b : a;
+    uint16_t m = (hi < c) ? hi : c;
+    return (lo > m) ? lo : m;
+}
+
+/**
+ * @brief Update running statistics with a raw pulse (ISR context)
+ */
+static inline void IRAM_ATTR update_stats(int channel, uint16_t pulse_us, uint32_t now_us)
+{
+    volatile isr_stats_t *st = &channel_stats[channel];
+    int32_t x_q4 = (int32_t)pulse_us << 4;
+
+    if (st->pulses == 0) {
+        st->mean_q4 = x_q4;
+        st->var = 0;
+    } else {
+        int32_t diff = x_q4 - st->mean_q4;
+        st->mean_q4 += diff >> 3;
+        uint32_t sq = (uint32_t)(((int64_t)diff * diff) >> 8);  // us^2
+        st->var = st->var + (((int32_t)sq - (int32_t)st->var) >> 3);
+
+        uint32_t interval = now_us - st->last_edge_us;
+        if (st->interval_us == 0) {
+            st->interval_us = interval;
+        } else {
+            st->interval_us = st->interval_us + (((int32_t)interval - (int32_t)st->interval_us) >> 3);
+        }
+    }
+    st->last_edge_us = now_us;
+    st->pulses++;
+}
+
+/**
+ * @brief Add a pulse to the calibration capture (ISR or backend task)
+ */
+static void IRAM_ATTR cal_capture_add(int channel, uint16_t pulse_us)
+{
+    cal_capture_t *c = &cal_capture[channel];
+    int32_t x_q4 = (int32_t)pulse_us << 4;
+
+    portENTER_CRITICAL_SAFE(&cal_lock);
+    if (c->count == 0) {
+        c->min_us = c->max_us = pulse_us;
+        c->recent_q4 = x_q4;
+        c->recent_var = 0;
+    } else {
+        if (pulse_us < c->min_us) c->min_us = pulse_us;
+        if (pulse_us > c->max_us) c->max_us = pulse_us;
+        int32_t diff = x_q4 - c->recent_q4;
+        c->recent_q4 += diff >> 4;
+        uint32_t sq = (uint32_t)(((int64_t)diff * diff) >> 8);  // us^2
+        c->recent_var = c->recent_var + (((int32_t)sq - (int32_t)c->recent_var) >> 4);
+    }
+    c->sum_us += pulse_us;
+    c->count++;
+    portEXIT_CRITICAL_SAFE(&cal_lock);
+}
+
+/**
+ * @brief Absolute difference of two pulse widths exceeds the glitch threshold
+ */
+static inline bool IRAM_ATTR pulse_apart(uint16_t a, uint16_t b)
+{
+    return (a > b ? a - b : b - a) > RC_GLITCH_THRESHOLD_US;
+}
+
+/**
+ * @brief Push a raw pulse through the median-of-3 window (ISR context)
+ *
+ * Also counts outliers. Once the next pulse arrives, the previous one is a
+ * glitch if it sat far from both neighbours while they agreed with each
+ * other - a one-frame spike the median rejects. A genuine step moves two
+ * consecutive pulses, so it is not counted however large it is.
+ *
+ * @return Filtered pulse width
+ */
+static inline uint16_t IRAM_ATTR filter_pulse(int channel, uint16_t pulse_us)
+{
+    uint16_t *h = pulse_history[channel];
+
+    if (pulse_history_fill[channel] < 3) {
+        // Warm-up: seed the window so the first output isn't delayed
+        if (pulse_history_fill[channel] == 0) {
+            h[0] = h[1] = pulse_us;
+        }
+        pulse_history_fill[channel]++;
+    }
+    h[2] = h[1];
+    h[1] = h[0];
+    h[0] = pulse_us;
+
+    // Seeded samples are copies, so only judge a window of three real pulses
+    if (pulse_history_fill[channel] >= 3 &&
+        pulse_apart(h[1], h[0]) && pulse_apart(h[1], h[2]) && !pulse_apart(h[0], h[2])) {
+        channel_stats[channel].glitches++;
+    }
+
+    return median3(h[0], h[1], h[2]);
+}
+
+/**
+ * @brief Handle one captured edge
+ */
+static inline bool IRAM_ATTR capture_edge(const mcpwm_capture_event_data_t *edata, void *user_data)
 {
     int channel = (int)(intptr_t)user_data;
     
     if (channel < 0 || channel >= RC_CHANNEL_COUNT) {
         return false;
     }
+    if (input_synthetic) {
+        got_rising[channel] = false;
+        return false;
+    }
     
     if (edata->cap_edge == MCPWM_CAP_EDGE_POS) {
         // Rising edge - start of pulse
@@ -70,38 +236,102 @@ static bool IRAM_ATTR capture_callback(mcpwm_cap_channel_handle_t cap_chan,
         // Falling edge - end of pulse
         uint32_t pulse_ticks = edata->cap_value - rising_edge[channel];
         uint16_t pulse_us = pulse_ticks / TICKS_PER_US;
+        got_rising[channel] = false;
         
         // Validate pulse width
-        if (pulse_us >= RC_VALID_MIN_US && pulse_us <= RC_VALID_MAX_US) {
+        if (pulse_us < RC_VALID_MIN_US || pulse_us > RC_VALID_MAX_US) {
+            channel_stats[channel].glitches++;
+        } else {
+            int64_t now = esp_timer_get_time();
+            uint32_t now_us = (uint32_t)now;
+            uint32_t now_ms = (uint32_t)(now / 1000);
+
+            // Statistics on the raw pulse so filtering can be tuned against it
+            update_stats(channel, pulse_us, now_us);
+
+            // The window runs either way so outliers are counted before the filter is enabled
+            uint16_t median = filter_pulse(channel, pulse_us);
+#if RC_MEDIAN_FILTER_ENABLED
+            pulse_us = median;
+#else
+            (void)median;
+#endif
+
+            if (cal_capture_mask & (1u << channel)) {
+                cal_capture_add(channel, pulse_us);
+            }
+
+            // Publish: odd sequence = write in progress
+            channel_seq[channel]++;
+            __atomic_thread_fence(__ATOMIC_RELEASE);
             channel_data[channel].pulse_us = pulse_us;
             channel_data[channel].valid = true;
-            channel_data[channel].last_update = (uint32_t)(esp_timer_get_time() / 1000);
+            channel_data[channel].last_update = now_ms;
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+            channel_seq[channel]++;
+
+            // Frame is complete once throttle and steering are both fresh
+            if (FRAME_NOTIFY_MASK & (1u << channel)) {
+                frame_pending_mask |= (1u << channel);
+                if ((frame_pending_mask & FRAME_NOTIFY_MASK) == FRAME_NOTIFY_MASK) {
+                    frame_pending_mask = 0;
+                    frame_edge_us = now_us;
+
+                    // Wake the control task
+                    TaskHandle_t task = frame_notify_task;
+                    if (task != NULL) {
+                        BaseType_t woken = pdFALSE;
+                        vTaskNotifyGiveFromISR(task, &woken);
+                        return woken == pdTRUE;
+                    }
+                }
+            }
         }
-        
-        got_rising[channel] = false;
     }
     
     return false;  // No high-priority task wakeup needed
 }
 
-esp_err_t rc_input_init(void)
+/**
+ * @brief Capture callback - called on rising and falling edges
+ */
+static bool IRAM_ATTR capture_callback(mcpwm_cap_channel_handle_t cap_chan,
+                                        const mcpwm_capture_event_data_t *edata,
+                                        void *user_data)
+{
+    TIMELINE_ISR_ENTER(TIMELINE_ISR_RC_CAPTURE);
+    bool woken = capture_edge(edata, user_data);
+    TIMELINE_ISR_EXIT(TIMELINE_ISR_RC_CAPTURE);
+    return woken;
+}
+
+/**
+ * @brief Copy one channel record without tearing (seqlock read side)
+ *
+ * Never blocks: if the ISR is mid-write (odd sequence) or published a new
+ * value during the copy, the copy is simply retried.
+ * @return Sequence number the copy corresponds to
+ */
+static inline uint32_t read_channel(int channel, rc_channel_raw_t *out)
+{
+    uint32_t seq;
+    do {
+        while ((seq = __atomic_load_n(&channel_seq[channel], __ATOMIC_ACQUIRE)) & 1) {
+            // Writer in progress on another core - spin briefly
+        }
+        out->pulse_us = channel_data[channel].pulse_us;
+        out->valid = channel_data[channel].valid;
+        out->last_update = channel_data[channel].last_update;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&channel_seq[channel], __ATOMIC_RELAXED) != seq);
+    return seq;
+}
+
+/**
+ * @brief Set up MCPWM capture for six individual PWM channel wires
+ */
+static esp_err_t init_pwm_capture(void)
 {
-    ESP_LOGI(TAG, "Initializing RC input capture...");
-    
-    // Create mutex
-    data_mutex = xSemaphoreCreateMutex();
-    if (data_mutex == NULL) {
-        ESP_LOGE(TAG, "Failed to create mutex");
-        return ESP_ERR_NO_MEM;
-    }
-    
-    // Initialize channel data
-    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
-        channel_data[i].pulse_us = RC_DEFAULT_CENTER_US;
-        channel_data[i].valid = false;
-        channel_data[i].last_update = 0;
-    }
-    
     // ESP32 MCPWM has only 3 capture channels per group
     // Use group 0 for channels 0-2, group 1 for channels 3-5
     mcpwm_cap_timer_handle_t cap_timers[2] = {NULL, NULL};
@@ -167,17 +397,188 @@ esp_err_t rc_input_init(void)
     return ESP_OK;
 }
 
-esp_err_t rc_input_get_raw(rc_channel_t channel, rc_channel_raw_t *raw)
+esp_err_t rc_input_init(void)
+{
+    ESP_LOGI(TAG, "Initializing RC input...");
+    
+    rc_input_reset_stats();
+    
+    // Initialize channel data (no writers running yet, no seqlock needed)
+    for (int i = 0; i < RC_MAX_CHANNELS; i++) {
+        channel_seq[i] = 0;
+        channel_data[i].pulse_us = RC_DEFAULT_CENTER_US;
+        channel_data[i].valid = false;
+        channel_data[i].last_update = 0;
+    }
+    
+#if RC_INPUT_BACKEND == RC_BACKEND_SBUS
+    esp_err_t ret = rc_serial_init(RC_SERIAL_SBUS);
+#elif RC_INPUT_BACKEND == RC_BACKEND_IBUS
+    esp_err_t ret = rc_serial_init(RC_SERIAL_IBUS);
+#elif RC_INPUT_BACKEND == RC_BACKEND_CRSF
+    esp_err_t ret = rc_serial_init(RC_SERIAL_CRSF);
+#elif RC_INPUT_BACKEND == RC_BACKEND_PPM
+    esp_err_t ret = rc_ppm_init();
+#elif RC_INPUT_BACKEND == RC_BACKEND_ESPNOW
+    esp_err_t ret = rc_espnow_init();
+#else
+    esp_err_t ret = init_pwm_capture();
+#endif
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+#if RC_INPUT_BACKEND == RC_BACKEND_PPM
+    active_channel_count = rc_ppm_get_channel_count();
+#elif RC_INPUT_BACKEND == RC_BACKEND_ESPNOW
+    active_channel_count = rc_espnow_get_channel_count();
+#elif RC_INPUT_BACKEND != RC_BACKEND_PWM
+    active_channel_count = rc_serial_get_channel_count();
+#endif
+    return ESP_OK;
+}
+
+/**
+ * @brief Store a whole frame and wake the control task
+ */
+static void publish_frame(const uint16_t *pulse_us, int count)
+{
+    if (count > RC_MAX_CHANNELS) {
+        count = RC_MAX_CHANNELS;
+    }
+    
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    
+    portENTER_CRITICAL(&publish_lock);
+    for (int i = 0; i < count; i++) {
+        if (pulse_us[i] < RC_VALID_MIN_US || pulse_us[i] > RC_VALID_MAX_US) {
+            continue;
+        }
+        channel_seq[i]++;
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        channel_data[i].pulse_us = pulse_us[i];
+        channel_data[i].valid = true;
+        channel_data[i].last_update = now_ms;
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        channel_seq[i]++;
+    }
+    portEXIT_CRITICAL(&publish_lock);
+
+    uint32_t mask = cal_capture_mask;
+    for (int i = 0; i < count && i < RC_CHANNEL_COUNT; i++) {
+        if ((mask & (1u << i)) && pulse_us[i] >= RC_VALID_MIN_US && pulse_us[i] <= RC_VALID_MAX_US) {
+            cal_capture_add(i, pulse_us[i]);
+        }
+    }
+    frame_edge_us = (uint32_t)esp_timer_get_time();
+    
+    // Whole frame arrives at once - wake the control task immediately
+    TaskHandle_t task = frame_notify_task;
+    if (task != NULL) {
+        xTaskNotifyGive(task);
+    }
+}
+
+void rc_input_publish_frame(const uint16_t *pulse_us, int count)
+{
+    if (pulse_us == NULL || input_synthetic) {
+        return;
+    }
+    publish_frame(pulse_us, count);
+}
+
+void rc_input_set_synthetic(bool synthetic)
+{
+    input_synthetic = synthetic;
+}
+
+void rc_input_inject_frame(const uint16_t *pulse_us, int count)
+{
+    if (pulse_us == NULL || !input_synthetic) {
+        return;
+    }
+    publish_frame(pulse_us, count);
+}
+
+esp_err_t rc_input_get_stats(rc_channel_t channel, rc_channel_stats_t *stats)
 {
-    if (channel >= RC_CHANNEL_COUNT || raw == NULL) {
+    if (channel >= RC_CHANNEL_COUNT || stats == NULL) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    xSemaphoreTake(data_mutex, portMAX_DELAY);
+    // Diagnostic values - a torn read just mixes two adjacent samples
+    volatile isr_stats_t *st = &channel_stats[channel];
+    stats->mean_us = (uint16_t)(st->mean_q4 >> 4);
+    stats->jitter_us = (uint16_t)sqrtf((float)st->var);
+    stats->frame_interval_us = (uint16_t)((st->interval_us > UINT16_MAX) ? UINT16_MAX : st->interval_us);
+    stats->glitch_count = st->glitches;
+    stats->pulse_count = st->pulses;
+    return ESP_OK;
+}
+
+void rc_input_reset_stats(void)
+{
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        channel_stats[i].pulses = 0;
+        channel_stats[i].glitches = 0;
+        channel_stats[i].interval_us = 0;
+        channel_stats[i].var = 0;
+        pulse_history_fill[i] = 0;
+    }
+}
+
+void rc_input_cal_capture_start(uint32_t channel_mask)
+{
+    portENTER_CRITICAL(&cal_lock);
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        if (channel_mask & (1u << i)) {
+            cal_capture[i].count = 0;
+            cal_capture[i].sum_us = 0;
+        }
+    }
+    cal_capture_mask = channel_mask;
+    portEXIT_CRITICAL(&cal_lock);
+}
+
+esp_err_t rc_input_cal_capture_get(rc_channel_t channel, rc_cal_capture_t *capture)
+{
+    if (channel >= RC_CHANNEL_COUNT || capture == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&cal_lock);
+    cal_capture_t c = cal_capture[channel];
+    portEXIT_CRITICAL(&cal_lock);
+
+    memset(capture, 0, sizeof(*capture));
+    capture->count = c.count;
+    if (c.count > 0) {
+        capture->min_us = c.min_us;
+        capture->max_us = c.max_us;
+        capture->mean_us = (uint16_t)((c.sum_us + c.count / 2) / c.count);
+        capture->recent_us = (uint16_t)((c.recent_q4 + 8) >> 4);
+        capture->jitter_us = (uint16_t)sqrtf((float)c.recent_var);
+    }
+    return ESP_OK;
+}
+
+uint32_t rc_input_get_frame_edge_us(void)
+{
+    return frame_edge_us;
+}
+
+int rc_input_get_channel_count(void)
+{
+    return active_channel_count;
+}
+
+esp_err_t rc_input_get_raw(rc_channel_t channel, rc_channel_raw_t *raw)
+{
+    if ((int)channel >= active_channel_count || raw == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    raw->pulse_us = channel_data[channel].pulse_us;
-    raw->valid = channel_data[channel].valid;
-    raw->last_update = channel_data[channel].last_update;
+    read_channel(channel, raw);
     
     // Check for signal timeout
     uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
@@ -185,7 +586,6 @@ esp_err_t rc_input_get_raw(rc_channel_t channel, rc_channel_raw_t *raw)
         raw->valid = false;
     }
     
-    xSemaphoreGive(data_mutex);
     return ESP_OK;
 }
 
@@ -195,38 +595,40 @@ esp_err_t rc_input_get_all_raw(rc_channel_raw_t raw[RC_CHANNEL_COUNT])
         return ESP_ERR_INVALID_ARG;
     }
     
+    // Snapshot all channels, retrying until no channel was republished
+    // during the copy so the caller gets one coherent frame
+    uint32_t seq[RC_CHANNEL_COUNT];
+    bool changed;
+    do {
+        for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+            seq[i] = read_channel(i, &raw[i]);
+        }
+        changed = false;
+        for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+            if (__atomic_load_n(&channel_seq[i], __ATOMIC_ACQUIRE) != seq[i]) {
+                changed = true;
+                break;
+            }
+        }
+    } while (changed);
+    
+    // Check for signal timeout
+    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
     for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
-        rc_input_get_raw((rc_channel_t)i, &raw[i]);
+        if (raw[i].valid && (now - raw[i].last_update) > RC_SIGNAL_TIMEOUT_MS) {
+            raw[i].valid = false;
+        }
     }
     
     return ESP_OK;
 }
 
-esp_err_t rc_input_get_calibrated(rc_channel_t channel,
-                                   const channel_calibration_t *calibration,
-                                   rc_channel_data_t *data)
+/**
+ * @brief Convert a pulse width to -1000..+1000 using channel calibration
+ */
+static int16_t apply_calibration(uint16_t pulse_us, const channel_calibration_t *calibration)
 {
-    if (channel >= RC_CHANNEL_COUNT || calibration == NULL || data == NULL) {
-        return ESP_ERR_INVALID_ARG;
-    }
-    
-    rc_channel_raw_t raw;
-    rc_input_get_raw(channel, &raw);
-    
-    data->pulse_us = raw.pulse_us;
-    data->valid = raw.valid;
-    
-    // Check for signal loss
-    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
-    data->signal_lost = !raw.valid || (now - raw.last_update) > RC_SIGNAL_TIMEOUT_MS;
-    
-    if (!data->valid || data->signal_lost) {
-        data->value = 0;  // Return center on invalid/lost signal
-        return ESP_OK;
-    }
-    
-    // Apply calibration to convert pulse_us to -1000 to +1000 range
-    int16_t pulse = raw.pulse_us;
+    int16_t pulse = pulse_us;
     int16_t center = calibration->center;
     int16_t value;
     
@@ -261,17 +663,78 @@ esp_err_t rc_input_get_calibrated(rc_channel_t channel,
         value = -value;
     }
     
-    data->value = value;
+    return value;
+}
+
+/**
+ * @brief Fill processed channel data from a raw reading
+ */
+static void process_channel(const rc_channel_raw_t *raw, uint32_t now,
+                            const channel_calibration_t *calibration,
+                            rc_channel_data_t *data)
+{
+    data->pulse_us = raw->pulse_us;
+    data->valid = raw->valid;
+    
+    // Check for signal loss
+    data->signal_lost = !raw->valid || (now - raw->last_update) > RC_SIGNAL_TIMEOUT_MS;
+    
+    if (!data->valid || data->signal_lost) {
+        data->value = 0;  // Return center on invalid/lost signal
+        return;
+    }
+    
+    data->value = apply_calibration(raw->pulse_us, calibration);
+}
+
+esp_err_t rc_input_get_calibrated(rc_channel_t channel,
+                                   const channel_calibration_t *calibration,
+                                   rc_channel_data_t *data)
+{
+    if (channel >= RC_CHANNEL_COUNT || calibration == NULL || data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    rc_channel_raw_t raw;
+    rc_input_get_raw(channel, &raw);
+    
+    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
+    process_channel(&raw, now, calibration, data);
     return ESP_OK;
 }
 
+esp_err_t rc_input_get_all_calibrated(const calibration_data_t *calibration,
+                                       rc_frame_t *frame)
+{
+    if (calibration == NULL || frame == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // One coherent raw snapshot (timeouts already folded into valid)
+    rc_channel_raw_t raw[RC_CHANNEL_COUNT];
+    rc_input_get_all_raw(raw);
+    
+    frame->timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        process_channel(&raw[i], frame->timestamp_ms, &calibration->channels[i], &frame->ch[i]);
+    }
+    
+    return ESP_OK;
+}
+
+void rc_input_set_frame_notify(TaskHandle_t task)
+{
+    frame_notify_task = task;
+}
+
 bool rc_input_has_signal(void)
 {
     uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
     
-    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
-        if (channel_data[i].valid && 
-            (now - channel_data[i].last_update) < RC_SIGNAL_TIMEOUT_MS) {
+    for (int i = 0; i < active_channel_count; i++) {
+        rc_channel_raw_t raw;
+        read_channel(i, &raw);
+        if (raw.valid && (now - raw.last_update) < RC_SIGNAL_TIMEOUT_MS) {
             return true;
         }
     }
@@ -281,13 +744,14 @@ bool rc_input_has_signal(void)
 
 bool rc_input_channel_valid(rc_channel_t channel)
 {
-    if (channel >= RC_CHANNEL_COUNT) {
+    if ((int)channel >= active_channel_count) {
         return false;
     }
     
+    rc_channel_raw_t raw;
+    read_channel(channel, &raw);
     uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
-    return channel_data[channel].valid && 
-           (now - channel_data[channel].last_update) < RC_SIGNAL_TIMEOUT_MS;
+    return raw.valid && (now - raw.last_update) < RC_SIGNAL_TIMEOUT_MS;
 }
 
 uint32_t rc_input_signal_age_ms(void)
@@ -295,9 +759,11 @@ uint32_t rc_input_signal_age_ms(void)
     uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
     uint32_t newest = 0;
     
-    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
-        if (channel_data[i].last_update > newest) {
-            newest = channel_data[i].last_update;
+    for (int i = 0; i < active_channel_count; i++) {
+        rc_channel_raw_t raw;
+        read_channel(i, &raw);
+        if (raw.last_update > newest) {
+            newest = raw.last_update;
         }
     }
     
@@ -2,7 +2,9 @@
  * @file rc_input.h
  * @brief RC receiver input capture interface
  * 
- * Captures PWM signals from RC receiver channels using MCPWM capture.
+ * Captures PWM signals from RC receiver channels using MCPWM capture, or
+ * takes channel data from a serial (rc_serial.h), PPM (rc_ppm.h) or ESP-NOW
+ * (rc_espnow.h) backend, selected with RC_INPUT_BACKEND in config.h.
  */
 
 #ifndef RC_INPUT_H
@@ -10,6 +12,8 @@
 
 #include "config.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 /**
  * @brief Raw RC channel data (before calibration applied)
@@ -30,6 +34,37 @@ typedef struct {
     bool signal_lost;       // Whether signal has been lost (timeout)
 } rc_channel_data_t;
 
+/**
+ * @brief Per-channel signal quality statistics (gathered in the capture ISR)
+ */
+typedef struct {
+    uint16_t mean_us;           // Running mean of raw pulse width
+    uint16_t jitter_us;         // Running standard deviation of raw pulse width
+    uint16_t frame_interval_us; // Running mean time between pulses
+    uint32_t glitch_count;      // Pulses rejected as out of range or outliers
+    uint32_t pulse_count;       // Valid pulses received
+} rc_channel_stats_t;
+
+/**
+ * @brief Calibration capture of one channel (every pulse since the last start)
+ */
+typedef struct {
+    uint32_t count;             // Pulses captured (0 = nothing yet)
+    uint16_t min_us;            // Lowest pulse
+    uint16_t max_us;            // Highest pulse
+    uint16_t mean_us;           // Mean of all captured pulses
+    uint16_t recent_us;         // Short-term mean (1/16 weight)
+    uint16_t jitter_us;         // Short-term standard deviation (low = stick held still)
+} rc_cal_capture_t;
+
+/**
+ * @brief Calibrated snapshot of all channels taken at one instant
+ */
+typedef struct {
+    rc_channel_data_t ch[RC_CHANNEL_COUNT];  // Indexed by rc_channel_t
+    uint32_t timestamp_ms;                   // Shared capture time (ms since boot)
+} rc_frame_t;
+
 /**
  * @brief Initialize RC input capture
  * @return ESP_OK on success
@@ -38,14 +73,19 @@ esp_err_t rc_input_init(void);
 
 /**
  * @brief Get raw pulse width for a channel (before calibration)
- * @param channel Channel index (0-3)
+ *
+ * Wait-free with respect to the capture ISR (seqlock read).
+ * @param channel Channel index (0 to rc_input_get_channel_count() - 1)
  * @param raw Pointer to raw data structure to fill
  * @return ESP_OK on success
  */
 esp_err_t rc_input_get_raw(rc_channel_t channel, rc_channel_raw_t *raw);
 
 /**
- * @brief Get all raw channel values
+ * @brief Get all raw channel values as one coherent snapshot
+ *
+ * Lock-free: retries internally if the capture ISR republishes a channel
+ * while the snapshot is being taken. Safe to call from any task.
  * @param raw Array of RC_CHANNEL_COUNT raw data structures
  * @return ESP_OK on success
  */
@@ -62,6 +102,107 @@ esp_err_t rc_input_get_calibrated(rc_channel_t channel,
                                    const channel_calibration_t *calibration,
                                    rc_channel_data_t *data);
 
+/**
+ * @brief Get calibrated values for all channels in a single pass
+ *
+ * Takes one coherent raw snapshot and one timestamp, then applies the
+ * calibration math once per channel. Intended to be called once per
+ * control tick and the resulting frame shared by all consumers.
+ * @param calibration Calibration data for all channels
+ * @param frame Pointer to frame to fill
+ * @return ESP_OK on success
+ */
+esp_err_t rc_input_get_all_calibrated(const calibration_data_t *calibration,
+                                       rc_frame_t *frame);
+
+/**
+ * @brief Register a task to be notified when a new RC frame lands
+ *
+ * The capture ISR sends a task notification (vTaskNotifyGiveFromISR) once
+ * both the throttle and steering falling edges of a frame have been
+ * captured. Wait for it with ulTaskNotifyTake().
+ * @param task Task to notify, or NULL to disable notifications
+ */
+void rc_input_set_frame_notify(TaskHandle_t task);
+
+/**
+ * @brief Publish a complete frame of channel pulse widths (frame backends)
+ *
+ * Called from the serial/PPM backend task (or the ESP-NOW receive
+ * callback) after a frame has been verified.
+ * Out-of-range values are ignored so those channels time out normally.
+ * @param pulse_us Pulse widths in microseconds, one per channel
+ * @param count Number of channels in the frame (max RC_MAX_CHANNELS)
+ */
+void rc_input_publish_frame(const uint16_t *pulse_us, int count);
+
+/**
+ * @brief Replace the receiver with injected frames (stress test)
+ *
+ * While set, PWM captures and backend frames are dropped and only
+ * rc_input_inject_frame() updates the channels. Clearing it leaves the
+ * last injected values to time out, so the control task goes through
+ * failsafe unless the receiver is still sending.
+ * @param synthetic true to take frames from rc_input_inject_frame()
+ */
+void rc_input_set_synthetic(bool synthetic);
+
+/**
+ * @brief Publish a synthetic frame like a frame backend would (any task)
+ *
+ * Ignored unless rc_input_set_synthetic(true) is in effect.
+ * @param pulse_us Pulse widths in microseconds, one per channel
+ * @param count Number of channels in the frame (max RC_MAX_CHANNELS)
+ */
+void rc_input_inject_frame(const uint16_t *pulse_us, int count);
+
+/**
+ * @brief Get signal quality statistics for a channel
+ * @param channel Channel index (0-5, PWM capture only)
+ * @param stats Pointer to stats structure to fill
+ * @return ESP_OK on success
+ */
+esp_err_t rc_input_get_stats(rc_channel_t channel, rc_channel_stats_t *stats);
+
+/**
+ * @brief Reset signal quality statistics for all channels
+ */
+void rc_input_reset_stats(void);
+
+/**
+ * @brief Restart the calibration capture for a set of channels
+ *
+ * Clears the capture of every channel in the mask and from then on adds
+ * each accepted pulse (after the median filter) at the rate it arrives,
+ * from the capture ISR or the frame backend. Channels outside the mask stop
+ * capturing but keep their last result.
+ * @param channel_mask Bit per rc_channel_t, 0 to stop capturing
+ */
+void rc_input_cal_capture_start(uint32_t channel_mask);
+
+/**
+ * @brief Read the calibration capture of a channel
+ * @param channel Channel index (0-5)
+ * @param capture Pointer to capture structure to fill
+ * @return ESP_OK on success
+ */
+esp_err_t rc_input_cal_capture_get(rc_channel_t channel, rc_cal_capture_t *capture);
+
+/**
+ * @brief Get timestamp of the edge that completed the latest RC frame
+ *
+ * For PWM capture this is the later of the throttle/steering falling
+ * edges; for frame backends it is the time the frame was published.
+ * @return esp_timer time in microseconds (0 before the first frame)
+ */
+uint32_t rc_input_get_frame_edge_us(void);
+
+/**
+ * @brief Get number of channels provided by the active input backend
+ * @return 6 for PWM, up to RC_MAX_CHANNELS for serial/PPM/ESP-NOW receivers
+ */
+int rc_input_get_channel_count(void);
+
 /**
  * @brief Check if any RC signal is being received
  * @return true if at least one channel has valid signal
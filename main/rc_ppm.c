@@ -0,0 +1,159 @@
+/**
+ * @file rc_ppm.c
+ * @brief PPM sum-signal RC input on the RMT receiver
+ *
+ * Each channel in a PPM frame is one mark + space period. RMT delivers the
+ * frame as symbols (level/duration pairs), one symbol per channel, and ends
+ * the receive at the sync gap. The receive-done ISR hands the buffer to a
+ * task which re-arms the receiver and decodes the frame.
+ */
+
+#include "rc_ppm.h"
+#include "rc_input.h"
+#include "timeline.h"
+#include "driver/rmt_rx.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include <string.h>
+
+static const char *TAG = "RC_PPM";
+
+#define PPM_RESOLUTION_HZ       1000000     // 1MHz = 1us per tick
+#define PPM_MAX_CHANNELS        12
+#define PPM_MIN_CHANNELS        4           // Shorter frames are partial captures
+#define PPM_MEM_SYMBOLS         48          // One RMT memory block on ESP32-S3
+#define PPM_GLITCH_FILTER_NS    2000        // Ignore pulses shorter than 2us
+
+static rmt_channel_handle_t rx_channel = NULL;
+static QueueHandle_t rx_queue = NULL;
+static TaskHandle_t ppm_task_handle = NULL;
+
+// Double buffer: one is being filled by RMT while the other is decoded
+static rmt_symbol_word_t rx_symbols[2][PPM_MEM_SYMBOLS];
+
+static const rmt_receive_config_t rx_config = {
+    .signal_range_min_ns = PPM_GLITCH_FILTER_NS,
+    .signal_range_max_ns = RC_PPM_SYNC_MIN_US * 1000,
+};
+
+/**
+ * @brief RMT receive-done callback (one per PPM frame)
+ */
+static bool IRAM_ATTR rx_done_callback(rmt_channel_handle_t channel,
+                                       const rmt_rx_done_event_data_t *edata,
+                                       void *user_data)
+{
+    TIMELINE_ISR_ENTER(TIMELINE_ISR_RC_PPM);
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(rx_queue, edata, &woken);
+    TIMELINE_ISR_EXIT(TIMELINE_ISR_RC_PPM);
+    return woken == pdTRUE;
+}
+
+/**
+ * @brief Decode one received frame and publish it
+ */
+static void decode_frame(const rmt_symbol_word_t *symbols, size_t count)
+{
+    uint16_t pulses[PPM_MAX_CHANNELS];
+    int channels = 0;
+
+    // Every symbol with both halves present is one channel period. The
+    // last symbol's second half is the sync gap (zero duration) and the
+    // trailing mark, so it doesn't carry a channel.
+    for (size_t i = 0; i < count && channels < PPM_MAX_CHANNELS; i++) {
+        if (symbols[i].duration0 == 0 || symbols[i].duration1 == 0) {
+            break;
+        }
+        uint32_t period_us = symbols[i].duration0 + symbols[i].duration1;
+        if (period_us < RC_VALID_MIN_US || period_us > RC_VALID_MAX_US) {
+            return;  // Not a clean frame (started mid-frame or noise)
+        }
+        pulses[channels++] = (uint16_t)period_us;
+    }
+
+    if (channels < PPM_MIN_CHANNELS) {
+        return;
+    }
+
+    rc_input_publish_frame(pulses, channels);
+}
+
+/**
+ * @brief Re-arm the receiver and decode frames as they complete
+ */
+static void rc_ppm_task(void *arg)
+{
+    int active = 0;
+    rmt_rx_done_event_data_t event;
+
+    ESP_ERROR_CHECK(rmt_receive(rx_channel, rx_symbols[active], sizeof(rx_symbols[active]), &rx_config));
+
+    while (1) {
+        if (xQueueReceive(rx_queue, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        // Re-arm on the other buffer first - we're inside the sync gap now
+        active ^= 1;
+        rmt_receive(rx_channel, rx_symbols[active], sizeof(rx_symbols[active]), &rx_config);
+
+        decode_frame(event.received_symbols, event.num_symbols);
+    }
+}
+
+esp_err_t rc_ppm_init(void)
+{
+    rx_queue = xQueueCreate(2, sizeof(rmt_rx_done_event_data_t));
+    if (rx_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create queue");
+        return ESP_ERR_NO_MEM;
+    }
+
+    rmt_rx_channel_config_t rx_chan_config = {
+        .gpio_num = PIN_RC_PPM,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = PPM_RESOLUTION_HZ,
+        .mem_block_symbols = PPM_MEM_SYMBOLS,
+    };
+    esp_err_t ret = rmt_new_rx_channel(&rx_chan_config, &rx_channel);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create RMT RX channel: %s", esp_err_to_name(ret));
+        vQueueDelete(rx_queue);
+        return ret;
+    }
+
+    rmt_rx_event_callbacks_t callbacks = {
+        .on_recv_done = rx_done_callback,
+    };
+    ESP_ERROR_CHECK(rmt_rx_register_event_callbacks(rx_channel, &callbacks, NULL));
+    ESP_ERROR_CHECK(rmt_enable(rx_channel));
+
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        rc_ppm_task,
+        "rc_ppm",
+        3072,
+        NULL,
+        RC_DECODER_TASK_PRIORITY,  // Above control task - must re-arm within the sync gap
+        &ppm_task_handle,
+        CONTROL_TASK_CORE          // Same core as control task
+    );
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create PPM task");
+        rmt_disable(rx_channel);
+        rmt_del_channel(rx_channel);
+        vQueueDelete(rx_queue);
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "PPM receiver on GPIO %d (RMT RX, up to %d channels)",
+             PIN_RC_PPM, PPM_MAX_CHANNELS);
+    return ESP_OK;
+}
+
+int rc_ppm_get_channel_count(void)
+{
+    return PPM_MAX_CHANNELS;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file rc_ppm.h
+ * @brief PPM sum-signal RC input on the RMT receiver
+ *
+ * The RMT peripheral timestamps every edge of a PPM frame in hardware and
+ * raises a single interrupt at the sync gap, so a whole frame costs one
+ * ISR instead of two per channel. Decoded frames are published through
+ * rc_input like any other backend.
+ */
+
+#ifndef RC_PPM_H
+#define RC_PPM_H
+
+#include "config.h"
+#include "esp_err.h"
+
+/**
+ * @brief Initialize RMT RX on PIN_RC_PPM and start the decoder task
+ * @return ESP_OK on success
+ */
+esp_err_t rc_ppm_init(void);
+
+/**
+ * @brief Get maximum number of channels the decoder can deliver
+ *
+ * Channels beyond those present in the received frame stay invalid.
+ * @return Channel count
+ */
+int rc_ppm_get_channel_count(void);
+
+#endif // RC_PPM_H
@@ -0,0 +1,402 @@
+/**
+ * @file rc_serial.c
+ * @brief Serial RC receiver input (SBUS / iBUS / CRSF) implementation
+ *
+ * The UART driver fills its RX ring buffer from the hardware FIFO and posts
+ * events to a queue; a dedicated task drains it and feeds a byte-wise frame
+ * parser. Each complete, verified frame is converted to microseconds and
+ * published to rc_input in one go.
+ */
+
+#include "rc_serial.h"
+#include "rc_input.h"
+#include "driver/uart.h"
+#include "esp_intr_alloc.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include <string.h>
+
+static const char *TAG = "RC_SERIAL";
+
+#define RC_UART_PORT            ((uart_port_t)RC_SERIAL_UART_NUM)
+#define RC_UART_RX_BUF_SIZE     512
+#define RC_UART_QUEUE_LEN       16
+#define RC_UART_RX_TIMEOUT_SYM  3       // Inter-frame gap that flushes FIFO to driver
+
+// SBUS: 0x0F + 22 bytes (16 x 11-bit) + flags + footer
+#define SBUS_FRAME_LEN          25
+#define SBUS_HEADER             0x0F
+#define SBUS_CHANNELS           16
+#define SBUS_FLAG_FRAME_LOST    0x04
+#define SBUS_FLAG_FAILSAFE      0x08
+
+// iBUS: 0x20 0x40 + 14 x uint16 LE + uint16 checksum
+#define IBUS_FRAME_LEN          32
+#define IBUS_HEADER0            0x20
+#define IBUS_HEADER1            0x40
+#define IBUS_CHANNELS           14
+
+// CRSF: addr + len + type + payload + crc8
+#define CRSF_ADDR_FC            0xC8
+#define CRSF_MAX_FRAME_LEN      64
+#define CRSF_FRAMETYPE_RC       0x16
+#define CRSF_RC_PAYLOAD_LEN     22
+#define CRSF_CHANNELS           16
+
+static rc_serial_protocol_t active_protocol = RC_SERIAL_SBUS;
+static int channel_count = 0;
+static QueueHandle_t uart_queue = NULL;
+static TaskHandle_t serial_task_handle = NULL;
+
+static volatile uint32_t frame_count = 0;
+static volatile uint32_t error_count = 0;
+
+// Frame assembly
+static uint8_t frame_buf[CRSF_MAX_FRAME_LEN];
+static int frame_pos = 0;
+
+// ============================================================================
+// Decoding helpers
+// ============================================================================
+
+/**
+ * @brief Unpack little-endian 11-bit channel values (SBUS/CRSF layout)
+ */
+static void unpack_11bit(const uint8_t *data, uint16_t *out, int count)
+{
+    uint32_t bits = 0;
+    int bit_count = 0;
+    int idx = 0;
+
+    for (int ch = 0; ch < count; ch++) {
+        while (bit_count < 11) {
+            bits |= (uint32_t)data[idx++] << bit_count;
+            bit_count += 8;
+        }
+        out[ch] = bits & 0x7FF;
+        bits >>= 11;
+        bit_count -= 11;
+    }
+}
+
+/**
+ * @brief Convert SBUS/CRSF 11-bit value (172..1811) to pulse width (988..2012us)
+ */
+static inline uint16_t ticks_to_us(uint16_t v)
+{
+    return (uint16_t)(1500 + (((int)v - 992) * 5) / 8);
+}
+
+/**
+ * @brief CRC8 with polynomial 0xD5 (DVB-S2), as used by CRSF
+ */
+static uint8_t crsf_crc8(const uint8_t *data, int len)
+{
+    uint8_t crc = 0;
+    for (int i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0xD5) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// ============================================================================
+// Frame handlers
+// ============================================================================
+
+static void handle_sbus_frame(void)
+{
+    // Footer is 0x00 for SBUS, 0x04/0x14/0x24/0x34 for SBUS2
+    uint8_t footer = frame_buf[SBUS_FRAME_LEN - 1];
+    if (footer != 0x00 && (footer & 0x0F) != 0x04) {
+        error_count++;
+        return;
+    }
+
+    uint8_t flags = frame_buf[23];
+    if (flags & (SBUS_FLAG_FAILSAFE | SBUS_FLAG_FRAME_LOST)) {
+        // Receiver has lost the link - don't refresh, let rc_input time out
+        return;
+    }
+
+    uint16_t raw[SBUS_CHANNELS];
+    uint16_t pulses[SBUS_CHANNELS];
+    unpack_11bit(&frame_buf[1], raw, SBUS_CHANNELS);
+    for (int i = 0; i < SBUS_CHANNELS; i++) {
+        pulses[i] = ticks_to_us(raw[i]);
+    }
+
+    frame_count++;
+    rc_input_publish_frame(pulses, SBUS_CHANNELS);
+}
+
+static void handle_ibus_frame(void)
+{
+    uint16_t sum = 0xFFFF;
+    for (int i = 0; i < IBUS_FRAME_LEN - 2; i++) {
+        sum -= frame_buf[i];
+    }
+    uint16_t rx_sum = frame_buf[30] | (frame_buf[31] << 8);
+    if (sum != rx_sum) {
+        error_count++;
+        return;
+    }
+
+    // iBUS already carries microseconds
+    uint16_t pulses[IBUS_CHANNELS];
+    for (int i = 0; i < IBUS_CHANNELS; i++) {
+        pulses[i] = (frame_buf[2 + i * 2] | (frame_buf[3 + i * 2] << 8)) & 0x0FFF;
+    }
+
+    frame_count++;
+    rc_input_publish_frame(pulses, IBUS_CHANNELS);
+}
+
+static void handle_crsf_frame(int total_len)
+{
+    uint8_t len = frame_buf[1];  // type + payload + crc
+    uint8_t crc = crsf_crc8(&frame_buf[2], len - 1);
+    if (crc != frame_buf[total_len - 1]) {
+        error_count++;
+        return;
+    }
+
+    // Link stats, telemetry etc. are valid frames we simply don't use
+    if (frame_buf[2] != CRSF_FRAMETYPE_RC || len != CRSF_RC_PAYLOAD_LEN + 2) {
+        return;
+    }
+
+    uint16_t raw[CRSF_CHANNELS];
+    uint16_t pulses[CRSF_CHANNELS];
+    unpack_11bit(&frame_buf[3], raw, CRSF_CHANNELS);
+    for (int i = 0; i < CRSF_CHANNELS; i++) {
+        pulses[i] = ticks_to_us(raw[i]);
+    }
+
+    frame_count++;
+    rc_input_publish_frame(pulses, CRSF_CHANNELS);
+}
+
+/**
+ * @brief Feed one received byte into the frame parser
+ */
+static void parse_byte(uint8_t b)
+{
+    switch (active_protocol) {
+        case RC_SERIAL_SBUS:
+            if (frame_pos == 0 && b != SBUS_HEADER) {
+                return;  // Hunt for header
+            }
+            frame_buf[frame_pos++] = b;
+            if (frame_pos == SBUS_FRAME_LEN) {
+                handle_sbus_frame();
+                frame_pos = 0;
+            }
+            break;
+
+        case RC_SERIAL_IBUS:
+            if ((frame_pos == 0 && b != IBUS_HEADER0) ||
+                (frame_pos == 1 && b != IBUS_HEADER1)) {
+                frame_pos = 0;
+                return;
+            }
+            frame_buf[frame_pos++] = b;
+            if (frame_pos == IBUS_FRAME_LEN) {
+                handle_ibus_frame();
+                frame_pos = 0;
+            }
+            break;
+
+        case RC_SERIAL_CRSF:
+            if (frame_pos == 0 && b != CRSF_ADDR_FC) {
+                return;
+            }
+            if (frame_pos == 1 && (b < 2 || b > CRSF_MAX_FRAME_LEN - 2)) {
+                frame_pos = 0;  // Implausible length - resync
+                error_count++;
+                return;
+            }
+            frame_buf[frame_pos++] = b;
+            if (frame_pos >= 2 && frame_pos == frame_buf[1] + 2) {
+                handle_crsf_frame(frame_pos);
+                frame_pos = 0;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief The line went idle (UART RX timeout), so the next byte starts a frame
+ *
+ * SBUS and iBUS frames go out back to back with a gap between them; a
+ * partial frame at the gap lost a byte, and resyncing here keeps a header
+ * value inside the payload from being taken for a frame start. CRSF frames
+ * are checked by their length and CRC instead.
+ */
+static void parse_gap(void)
+{
+    if (active_protocol == RC_SERIAL_CRSF || frame_pos == 0) {
+        return;
+    }
+    frame_pos = 0;
+    error_count++;
+}
+
+// ============================================================================
+// UART task
+// ============================================================================
+
+static void rc_serial_task(void *arg)
+{
+    uart_event_t event;
+    uint8_t rx[128];
+
+    while (1) {
+        if (xQueueReceive(uart_queue, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        switch (event.type) {
+            case UART_DATA: {
+                size_t remaining = event.size;
+                while (remaining > 0) {
+                    size_t chunk = (remaining > sizeof(rx)) ? sizeof(rx) : remaining;
+                    int len = uart_read_bytes(RC_UART_PORT, rx, chunk, 0);
+                    if (len <= 0) {
+                        break;
+                    }
+                    for (int i = 0; i < len; i++) {
+                        parse_byte(rx[i]);
+                    }
+                    remaining -= len;
+                }
+                // Delivered by the RX timeout: these bytes end at the inter-frame gap
+                if (event.timeout_flag) {
+                    parse_gap();
+                }
+                break;
+            }
+
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                ESP_LOGW(TAG, "RX overflow - flushing");
+                uart_flush_input(RC_UART_PORT);
+                xQueueReset(uart_queue);
+                frame_pos = 0;
+                error_count++;
+                break;
+
+            case UART_FRAME_ERR:
+            case UART_PARITY_ERR:
+                frame_pos = 0;
+                error_count++;
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+esp_err_t rc_serial_init(rc_serial_protocol_t protocol)
+{
+    static const char *protocol_names[] = {"SBUS", "iBUS", "CRSF"};
+
+    uart_config_t uart_config = {
+        .data_bits = UART_DATA_8_BITS,
+        .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+        .source_clk = UART_SCLK_DEFAULT,
+    };
+    int frame_len;
+
+    switch (protocol) {
+        case RC_SERIAL_SBUS:
+            uart_config.baud_rate = 100000;
+            uart_config.parity = UART_PARITY_EVEN;
+            uart_config.stop_bits = UART_STOP_BITS_2;
+            frame_len = SBUS_FRAME_LEN;
+            channel_count = SBUS_CHANNELS;
+            break;
+        case RC_SERIAL_IBUS:
+            uart_config.baud_rate = 115200;
+            uart_config.parity = UART_PARITY_DISABLE;
+            uart_config.stop_bits = UART_STOP_BITS_1;
+            frame_len = IBUS_FRAME_LEN;
+            channel_count = IBUS_CHANNELS;
+            break;
+        case RC_SERIAL_CRSF:
+            uart_config.baud_rate = 420000;
+            uart_config.parity = UART_PARITY_DISABLE;
+            uart_config.stop_bits = UART_STOP_BITS_1;
+            frame_len = CRSF_RC_PAYLOAD_LEN + 4;
+            channel_count = CRSF_CHANNELS;
+            break;
+        default:
+            return ESP_ERR_INVALID_ARG;
+    }
+    active_protocol = protocol;
+    frame_pos = 0;
+
+    esp_err_t ret = uart_driver_install(RC_UART_PORT, RC_UART_RX_BUF_SIZE, 0,
+                                        RC_UART_QUEUE_LEN, &uart_queue, ESP_INTR_FLAG_IRAM);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to install UART driver: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_ERROR_CHECK(uart_param_config(RC_UART_PORT, &uart_config));
+    ESP_ERROR_CHECK(uart_set_pin(RC_UART_PORT, UART_PIN_NO_CHANGE, PIN_RC_SERIAL,
+                                 UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+
+    // SBUS is inverted UART - the ESP32 can invert RX in hardware
+    if (protocol == RC_SERIAL_SBUS) {
+        ESP_ERROR_CHECK(uart_set_line_inverse(RC_UART_PORT, UART_SIGNAL_RXD_INV));
+    }
+
+    // Deliver data as soon as one frame is in the FIFO, or at the inter-frame gap
+    uart_set_rx_full_threshold(RC_UART_PORT, frame_len);
+    uart_set_rx_timeout(RC_UART_PORT, RC_UART_RX_TIMEOUT_SYM);
+
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        rc_serial_task,
+        "rc_serial",
+        3072,
+        NULL,
+        RC_DECODER_TASK_PRIORITY,  // Above control task - frames must be drained promptly
+        &serial_task_handle,
+        CONTROL_TASK_CORE          // Same core as control task
+    );
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create serial RX task");
+        uart_driver_delete(RC_UART_PORT);
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "%s receiver on GPIO %d (UART%d, %d baud, %d channels)",
+             protocol_names[protocol], PIN_RC_SERIAL, RC_SERIAL_UART_NUM,
+             uart_config.baud_rate, channel_count);
+    return ESP_OK;
+}
+
+int rc_serial_get_channel_count(void)
+{
+    return channel_count;
+}
+
+uint32_t rc_serial_get_frame_count(void)
+{
+    return frame_count;
+}
+
+uint32_t rc_serial_get_error_count(void)
+{
+    return error_count;
+}
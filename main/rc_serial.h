@@ -0,0 +1,50 @@
+/**
+ * @file rc_serial.h
+ * @brief Serial RC receiver input (SBUS / iBUS / CRSF)
+ *
+ * Decodes digital receiver protocols on a single UART pin and publishes
+ * channel pulse widths through rc_input, so everything above rc_input
+ * (calibration, menu, mode switch) works unchanged.
+ */
+
+#ifndef RC_SERIAL_H
+#define RC_SERIAL_H
+
+#include "config.h"
+#include "esp_err.h"
+
+/**
+ * @brief Supported serial receiver protocols
+ */
+typedef enum {
+    RC_SERIAL_SBUS = 0,     // Futaba SBUS: 100000 8E2 inverted, 16 ch, 25-byte frames
+    RC_SERIAL_IBUS,         // FlySky iBUS: 115200 8N1, 14 ch, 32-byte frames
+    RC_SERIAL_CRSF,         // TBS Crossfire / ELRS: 420000 8N1, 16 ch
+} rc_serial_protocol_t;
+
+/**
+ * @brief Initialize UART reception and start the decoder task
+ * @param protocol Protocol to decode
+ * @return ESP_OK on success
+ */
+esp_err_t rc_serial_init(rc_serial_protocol_t protocol);
+
+/**
+ * @brief Get number of channels carried by the active protocol
+ * @return Channel count (0 if not initialized)
+ */
+int rc_serial_get_channel_count(void);
+
+/**
+ * @brief Get count of frames decoded since init
+ * @return Good frame count
+ */
+uint32_t rc_serial_get_frame_count(void);
+
+/**
+ * @brief Get count of frames rejected (bad checksum/CRC/framing)
+ * @return Error count
+ */
+uint32_t rc_serial_get_error_count(void);
+
+#endif // RC_SERIAL_H
@@ -0,0 +1,109 @@
+/**
+ * @file resample.h
+ * @brief 16.16 fixed-point resampling kernels shared by the audio mixers
+ *
+ * Read positions are 16.16 fixed point (upper 16 bits = source sample,
+ * lower 16 bits = fraction) stepped by a 16.16 increment per output
+ * sample, so a clip addresses at most RESAMPLE_MAX_SAMPLES samples from
+ * its base pointer. Callers resolve clip ends per stretch with
+ * resample_steps_to(), keeping the inner loops free of bounds checks.
+ */
+
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 16.16 positions address at most this many samples
+#define RESAMPLE_MAX_SAMPLES    0xFFFF
+
+/**
+ * @brief 16.16 step that plays a clip recorded at from_rate at to_rate
+ */
+static inline uint32_t resample_increment(uint32_t from_rate, uint32_t to_rate)
+{
+    return (uint32_t)(((uint64_t)from_rate << 16) / to_rate);
+}
+
+/**
+ * @brief Scale a 16.16 pitch increment for a clip recorded at from_rate
+ *
+ * Gives the step that plays the clip at that pitch on a to_rate bus. A
+ * from_rate of 0 (not recorded) is taken to be to_rate.
+ */
+static inline uint32_t resample_scale(uint32_t inc, uint32_t from_rate, uint32_t to_rate)
+{
+    if (from_rate == 0 || from_rate == to_rate) {
+        return inc;
+    }
+    return (uint32_t)(((uint64_t)inc * from_rate) / to_rate);
+}
+
+/**
+ * @brief Count 16.16 steps needed for pos to reach or pass limit
+ *
+ * Always returns at least one step so callers make progress even when
+ * pos is already at the limit.
+ */
+static inline size_t resample_steps_to(uint32_t pos, uint32_t limit, uint32_t inc, size_t max_steps)
+{
+    if (pos >= limit) {
+        return 1;
+    }
+    if (inc == 0) {
+        return max_steps;
+    }
+    uint32_t steps = (limit - pos - 1) / inc + 1;
+    return steps < max_steps ? steps : max_steps;
+}
+
+/**
+ * @brief Accumulate an 8-bit clip with linear interpolation
+ *
+ * Interpolates between neighbouring samples with an 8-bit fraction. The
+ * last sample is held rather than read past, so a clip of count samples
+ * plays exactly until pos reaches count.
+ *
+ * @param acc Accumulator (n samples)
+ * @param n Number of output samples
+ * @param samples Clip data
+ * @param count Number of samples in the clip
+ * @param pos Playback position (16.16), updated
+ * @param inc Playback increment (16.16)
+ * @param vol Gain (sample * vol lands in the 16-bit output range)
+ * @return Output samples produced (less than n when the clip ended)
+ */
+static inline size_t resample_mix_lerp8(int32_t *restrict acc, size_t n,
+                                        const int8_t *restrict samples, uint32_t count,
+                                        uint32_t *pos, uint32_t inc, int32_t vol)
+{
+    const uint32_t end_fixed = count << 16;
+    const uint32_t last_fixed = (count - 1) << 16;
+    uint32_t p = *pos;
+    size_t k = 0;
+
+    if (count == 0 || p >= end_fixed) {
+        return 0;
+    }
+
+    // Everything before the last sample has a right-hand neighbour
+    size_t run = p < last_fixed ? resample_steps_to(p, last_fixed, inc, n) : 0;
+    for (; k < run; k++) {
+        uint32_t idx = p >> 16;
+        int32_t a = samples[idx];
+        int32_t b = samples[idx + 1];
+        int32_t s = (a << 8) + (b - a) * (int32_t)((p >> 8) & 0xFF);
+        acc[k] += (s * vol) >> 8;
+        p += inc;
+    }
+    for (; k < n && p < end_fixed; k++) {
+        acc[k] += samples[count - 1] * vol;
+        p += inc;
+    }
+
+    *pos = p;
+    return k;
+}
+
+#endif // RESAMPLE_H
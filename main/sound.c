@@ -3,43 +3,67 @@
  * @brief Polyphonic sound system for 8x8 Crawler Controller
  *
  * Features:
- * - Additive synthesis for realistic bell/chime sounds
+ * - Additive synthesis for realistic bell/chime sounds (fixed-point
+ *   wavetable oscillators, integer decay envelopes)
  * - Polyphonic voice mixing (up to 6 simultaneous voices)
  * - ADSR envelope generator
  * - Multiple waveform types
+ * - Non-blocking playback: requests queue steps that the audio mixer
+ *   renders on the UI bus, on top of the (ducked) engine
+ * - Fixed cues are recorded the first time they play and streamed from
+ *   RAM afterwards
  *
  * Uses ESP-IDF I2S driver for MAX98357A amplifier output.
  */
 
 #include "sound.h"
 #include "config.h"
+#include "audio_mixer.h"
+#include "resample.h"
 
 #include <string.h>
 #include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "driver/i2s_std.h"
 #include "driver/gpio.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
 
 static const char *TAG = "SOUND";
 
 // Audio parameters
-#define SAMPLE_RATE         22050   // 22050 Hz to match engine sound samples
+#define SAMPLE_RATE         AUDIO_SAMPLE_RATE
 #define BITS_PER_SAMPLE     16
 #define MAX_VOICES          6       // Maximum simultaneous voices
 #define BELL_PARTIALS       9       // Number of partials for bell synthesis
+#define BOOT_CHIME_TIMEOUT_MS 3000  // Longest sound_play_boot_chime() waits
+#define PROMPT_GAP_MS       200     // Pause between chained prompts
+#define COUNT_BEEP_HZ       1500    // sound_play_count_beeps() tone
+#define COUNT_BEEP_MS       80
+#define COUNT_BEEP_GAP_MS   120
 
 // Math constants
-#define PI                  3.14159265358979f
 #define TWO_PI              6.28318530717959f
 
-// I2S channel handle (non-static for sharing with engine_sound.c)
+// Oscillator bank: 32-bit phase accumulators index a Q15 sine table by
+// their top bits; bell partials decay by an integer factor once per chunk
+#define WAVE_TABLE_BITS     10
+#define WAVE_TABLE_SIZE     (1 << WAVE_TABLE_BITS)
+#define BELL_RENDER_PARTIALS 5      // Partials actually summed per bell voice
+#define BELL_ENV_CHUNK      32      // Samples between envelope updates (~1.5ms)
+#define BELL_ENV_DECAY      3.0f    // Overall bell envelope decay rate (1/s)
+#define BELL_END_SAMPLES    (SAMPLE_RATE * 1535 / 1000)  // Envelope below 1% (ln(100)/3 s)
+
+// I2S channel handle (non-static; written only by the audio mixer task)
 i2s_chan_handle_t tx_handle = NULL;
 static bool sound_initialized = false;
-static bool sound_playing = false;
 static uint8_t master_volume = 70;
 
+// One period of sine, Q15 (built at init)
+static int16_t sine_table[WAVE_TABLE_SIZE];
+
 // Bell partial frequency ratios (inharmonic series for realistic bell sound)
 // Based on analysis of real bells - these create the metallic "bell" timbre
 static const float bell_ratios[BELL_PARTIALS] = {
@@ -72,6 +96,9 @@ static const float bell_decays[BELL_PARTIALS] = {
     2.0f, 2.5f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f
 };
 
+// Per-chunk Q16 decay factor of each rendered partial (bell and partial decay combined)
+static uint32_t bell_chunk_decay_q16[BELL_RENDER_PARTIALS];
+
 // ADSR Envelope structure
 typedef struct {
     float attack;       // Attack time in seconds
@@ -83,73 +110,65 @@ typedef struct {
 // Voice structure for polyphonic playback
 typedef struct {
     bool active;
-    float frequency;
-    float amplitude;
-    float phase[BELL_PARTIALS];     // Phase for each partial
-    float partial_amp[BELL_PARTIALS]; // Current amplitude of each partial
+    uint32_t phase[BELL_RENDER_PARTIALS];       // 32-bit phase accumulator per partial
+    uint32_t phase_inc[BELL_RENDER_PARTIALS];   // Phase step per sample
+    int32_t gain[BELL_RENDER_PARTIALS];         // Partial amplitude in output units
     uint32_t sample_count;
     uint32_t total_samples;
-    adsr_t envelope;
-    float env_level;
-    bool releasing;
-    uint32_t release_start;
 } voice_t;
 
 static voice_t voices[MAX_VOICES];
 
-// Waveform generators
-static inline float sine_wave(float phase) {
-    return sinf(phase);
+/**
+ * @brief Phase step per output sample for a frequency
+ */
+static inline uint32_t phase_increment(float frequency) {
+    return (uint32_t)(frequency * (4294967296.0f / SAMPLE_RATE));
 }
 
-static inline float triangle_wave(float phase) {
-    float t = phase / TWO_PI;
-    return 4.0f * fabsf(t - floorf(t + 0.5f)) - 1.0f;
+/**
+ * @brief Q15 sine of a 32-bit phase
+ */
+static inline int32_t wave_sine(uint32_t phase) {
+    return sine_table[phase >> (32 - WAVE_TABLE_BITS)];
 }
 
-// Fast approximation of sin for better performance
-static inline float fast_sin(float x) {
-    // Normalize to -PI to PI
-    while (x > PI) x -= TWO_PI;
-    while (x < -PI) x += TWO_PI;
-
-    // Parabola approximation
-    const float B = 4.0f / PI;
-    const float C = -4.0f / (PI * PI);
-    float y = B * x + C * x * fabsf(x);
-
-    // Extra precision
-    const float P = 0.225f;
-    y = P * (y * fabsf(y) - y) + y;
-    return y;
+/**
+ * @brief Build the sine table and bell decay factors (once, at init)
+ */
+static void oscillators_init(void) {
+    for (int i = 0; i < WAVE_TABLE_SIZE; i++) {
+        sine_table[i] = (int16_t)lrintf(32767.0f * sinf(TWO_PI * i / WAVE_TABLE_SIZE));
+    }
+    for (int i = 0; i < BELL_RENDER_PARTIALS; i++) {
+        float rate = BELL_ENV_DECAY + bell_decays[i];
+        bell_chunk_decay_q16[i] = (uint32_t)lrintf(65536.0f * expf(-rate * BELL_ENV_CHUNK / SAMPLE_RATE));
+    }
 }
 
 /**
  * @brief Initialize a voice for bell synthesis
+ *
+ * Bells use a fixed exponential decay; the ADSR parameters of the
+ * request are not applied.
  */
-static void init_bell_voice(int voice_idx, float frequency, float amplitude,
-                            float attack, float decay, float sustain, float release,
-                            uint32_t duration_ms) {
+static void init_bell_voice(int voice_idx, float frequency, float amplitude, uint32_t duration_ms) {
     voice_t *v = &voices[voice_idx];
 
+    // Peak per partial: amplitude, halved for headroom, at master volume
+    float scale = amplitude * 0.5f * master_volume / 100.0f * 32000.0f;
+
     v->active = true;
-    v->frequency = frequency;
-    v->amplitude = amplitude;
     v->sample_count = 0;
     v->total_samples = (SAMPLE_RATE * duration_ms) / 1000;
-    v->releasing = false;
-    v->release_start = 0;
-    v->env_level = 1.0f;
-
-    v->envelope.attack = attack;
-    v->envelope.decay = decay;
-    v->envelope.sustain = sustain;
-    v->envelope.release = release;
+    if (v->total_samples > BELL_END_SAMPLES) {
+        v->total_samples = BELL_END_SAMPLES;
+    }
 
-    // Initialize phases and partial amplitudes
-    for (int i = 0; i < BELL_PARTIALS; i++) {
-        v->phase[i] = 0.0f;
-        v->partial_amp[i] = bell_amps[i];
+    for (int i = 0; i < BELL_RENDER_PARTIALS; i++) {
+        v->phase[i] = 0;
+        v->phase_inc[i] = phase_increment(frequency * bell_ratios[i]);
+        v->gain[i] = (int32_t)(bell_amps[i] * scale);
     }
 }
 
@@ -167,83 +186,437 @@ static int find_free_voice(void) {
 }
 
 /**
- * @brief Generate one sample from a bell voice using additive synthesis
+ * @brief Add a bell voice into the accumulator using additive synthesis
+ *
+ * Each partial is a table oscillator whose gain decays by a constant
+ * factor every BELL_ENV_CHUNK samples.
  */
-static float generate_bell_sample(voice_t *v) {
-    if (!v->active) return 0.0f;
+static void mix_bell_voice(voice_t *v, int32_t *acc, size_t n) {
+    size_t done = 0;
+
+    while (done < n && v->active) {
+        size_t chunk = n - done;
+        if (chunk > BELL_ENV_CHUNK) chunk = BELL_ENV_CHUNK;
+        if (chunk > v->total_samples - v->sample_count) {
+            chunk = v->total_samples - v->sample_count;
+        }
 
-    float time = (float)v->sample_count / SAMPLE_RATE;
-    float sample = 0.0f;
+        for (int p = 0; p < BELL_RENDER_PARTIALS; p++) {
+            uint32_t phase = v->phase[p];
+            uint32_t inc = v->phase_inc[p];
+            int32_t gain = v->gain[p];
+            int32_t *out = acc + done;
+            for (size_t k = 0; k < chunk; k++) {
+                out[k] += (wave_sine(phase) * gain) >> 15;
+                phase += inc;
+            }
+            v->phase[p] = phase;
+            v->gain[p] = (int32_t)(((int64_t)gain * bell_chunk_decay_q16[p]) >> 16);
+        }
 
-    // Simple exponential decay envelope (bypass complex ADSR for now)
-    float env = expf(-3.0f * time);  // ~1 second decay
+        done += chunk;
+        v->sample_count += chunk;
+        if (v->sample_count >= v->total_samples) {
+            v->active = false;
+        }
+    }
+}
 
-    // Sum just a few partials for simpler bell sound
-    for (int i = 0; i < 5; i++) {  // Only use first 5 partials
-        // Each partial decays at its own rate
-        float partial_decay = expf(-bell_decays[i] * time);
+// ============================================================================
+// UI Bus
+// Sounds are queued as steps (tone, gap, bell, sample) and rendered by the
+// audio mixer task one block at a time, so callers never touch the I2S
+// channel or wait for playback.
+// ============================================================================
 
-        // Use standard sinf instead of fast_sin for debugging
-        float phase = v->phase[i];
-        float partial_sample = sinf(phase) * bell_amps[i] * partial_decay;
-        sample += partial_sample;
+#define UI_QUEUE_DEPTH      32      // Queued steps (a cue is at most ~7)
 
-        // Advance phase for this partial
-        float partial_freq = v->frequency * bell_ratios[i];
-        v->phase[i] += TWO_PI * partial_freq / SAMPLE_RATE;
-        if (v->phase[i] >= TWO_PI) {
-            v->phase[i] -= TWO_PI;
-        }
+/**
+ * @brief Kinds of queued UI step
+ */
+typedef enum {
+    UI_STEP_TONE = 0,       // Sine tone with short attack/decay
+    UI_STEP_GAP,            // Silence
+    UI_STEP_BELL,           // Additive bell voice
+    UI_STEP_SAMPLE,         // 8-bit sample clip
+    UI_STEP_PCM,            // Cached 16-bit cue recording
+    UI_STEP_DONE,           // Completion callback marker (takes no time)
+    UI_STEP_CAPTURE,        // Start recording the UI bus into a cache entry (takes no time)
+    UI_STEP_CAPTURE_END,    // Recording complete (takes no time)
+} ui_step_kind_t;
+
+/**
+ * @brief Recording of one fixed cue
+ *
+ * The buffer is allocated by the requesting task and only written by the
+ * mixer while a capture is running; ready is set once the recording is
+ * complete. Playback scales by master_volume / volume.
+ */
+typedef struct {
+    int16_t *pcm;
+    uint32_t capacity;          // Samples allocated
+    uint32_t length;            // Samples recorded
+    uint8_t volume;             // Master volume at recording time
+    volatile bool ready;
+} ui_cache_entry_t;
+
+/**
+ * @brief One queued UI step
+ */
+typedef struct {
+    ui_step_kind_t kind;
+    uint32_t generation;        // Cue generation (stale steps are dropped)
+    uint32_t duration;          // Tone/gap length in output samples
+    union {
+        struct {
+            uint32_t phase_inc;     // Oscillator phase step per output sample
+            uint8_t volume;
+        } tone;
+        struct {
+            float frequency;
+            float amplitude;
+            adsr_t envelope;
+            uint32_t duration_ms;
+            bool overlap;       // Start the next step without waiting for this bell
+        } bell;
+        struct {
+            const int8_t *samples;
+            uint32_t count;
+            uint32_t increment; // 16.16 source step per output sample
+            uint8_t volume;
+        } sample;
+        struct {
+            const int16_t *samples;
+            uint32_t count;
+            int32_t gain_q8;    // master_volume relative to the recording
+        } pcm;
+        struct {
+            sound_done_cb_t callback;
+            void *arg;
+        } done;
+        ui_cache_entry_t *capture;
+    };
+} ui_step_t;
+
+static QueueHandle_t ui_queue = NULL;
+static volatile uint32_t ui_generation = 0;    // Bumped to cancel everything queued/playing
+static volatile bool ui_busy = false;
+
+// Step being played (mixer task only)
+static ui_step_t ui_step;
+static bool ui_step_active = false;
+static uint32_t ui_progress = 0;        // Output samples rendered for the step
+static uint32_t ui_src_pos = 0;         // Sample step read position (16.16)
+static uint32_t ui_phase = 0;           // Tone phase accumulator
+static int32_t ui_amplitude = 0;        // Tone peak amplitude
+static int ui_bell_voice = 0;           // Bell step waits for this voice
+static uint32_t bell_generation[MAX_VOICES];
+
+// Cue cache: every sound_effect_t, then one mode beep per steering mode
+#define UI_CUE_COUNT        (SOUND_COUNT + STEER_MODE_COUNT)
+
+static ui_cache_entry_t ui_cache[UI_CUE_COUNT];
+static int16_t *ui_cache_pool = NULL;       // Reserved once, carved per cue
+static uint32_t ui_cache_pool_bytes = 0;
+static uint32_t ui_cache_bytes = 0;         // Carved so far (requesting tasks)
+
+// Recording in progress (mixer task only)
+static ui_cache_entry_t *capture_entry = NULL;
+static uint32_t capture_generation = 0;
+static uint32_t capture_pos = 0;            // Samples recorded
+static size_t capture_from = 0;             // Block offset the recording resumes at
+static size_t capture_to = 0;               // Block offset of the end marker
+static bool capture_ending = false;
+
+/**
+ * @brief Length estimate of the steps queued while measuring a cue
+ */
+typedef struct {
+    uint32_t cursor;            // Where the next step starts (samples)
+    uint32_t end;               // Last sample any step reaches
+} ui_measure_t;
+
+static ui_measure_t *ui_measure = NULL;     // Non-NULL: queue_*() only measure
+
+/**
+ * @brief Add a step's duration to the cue being measured
+ *
+ * A bell step holds the queue until its voice ends and the queue resumes
+ * at the next block, so each one is padded by a block.
+ */
+static void ui_measure_step(const ui_step_t *step) {
+    uint32_t length = 0;
+
+    switch (step->kind) {
+        case UI_STEP_TONE:
+        case UI_STEP_GAP:
+            length = step->duration;
+            break;
+
+        case UI_STEP_BELL:
+            length = (SAMPLE_RATE * step->bell.duration_ms) / 1000;
+            if (length > BELL_END_SAMPLES) length = BELL_END_SAMPLES;
+            if (ui_measure->cursor + length > ui_measure->end) {
+                ui_measure->end = ui_measure->cursor + length;
+            }
+            if (step->bell.overlap) {
+                return;
+            }
+            length += AUDIO_BLOCK_FRAMES;
+            break;
+
+        default:
+            return;
     }
 
-    // Apply envelope and amplitude
-    sample *= env * v->amplitude;
+    ui_measure->cursor += length;
+    if (ui_measure->cursor > ui_measure->end) {
+        ui_measure->end = ui_measure->cursor;
+    }
+}
 
-    // Normalize
-    sample /= 2.0f;
+/**
+ * @brief Append a step to the UI queue (never blocks)
+ * @return true if queued
+ */
+static bool ui_queue_step(ui_step_t *step) {
+    if (ui_measure) {
+        ui_measure_step(step);
+        return true;
+    }
+    step->generation = ui_generation;
+    if (xQueueSend(ui_queue, step, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "UI sound queue full, step dropped");
+        return false;
+    }
+    audio_mixer_wake();
+    return true;
+}
 
-    v->sample_count++;
+/**
+ * @brief Report a completion marker to its owner
+ */
+static inline void ui_step_done(const ui_step_t *step, bool completed) {
+    if (step->kind == UI_STEP_DONE && step->done.callback) {
+        step->done.callback(step->done.arg, completed);
+    }
+}
 
-    // Check if voice is done
-    if (v->sample_count >= v->total_samples || env < 0.01f) {
-        v->active = false;
+/**
+ * @brief Cancel everything queued or playing on the UI bus
+ *
+ * Drains the queue on the caller's task so pending completion callbacks
+ * are told about the cancellation; the mixer drops the step in progress.
+ */
+static void ui_flush(void) {
+    ui_step_t step;
+
+    ui_generation++;
+    while (xQueueReceive(ui_queue, &step, 0) == pdTRUE) {
+        ui_step_done(&step, false);
     }
+}
+
+/**
+ * @brief Queue a completion marker after the steps queued so far
+ */
+static void queue_done(sound_done_cb_t callback, void *arg) {
+    if (callback == NULL) {
+        return;
+    }
+    ui_step_t step = {
+        .kind = UI_STEP_DONE,
+        .done = { .callback = callback, .arg = arg },
+    };
+    if (!ui_queue_step(&step)) {
+        callback(arg, false);
+    }
+}
+
+/**
+ * @brief Queue a sine tone
+ */
+static void queue_tone(uint32_t frequency_hz, uint32_t duration_ms, uint8_t volume) {
+    ui_step_t step = {
+        .kind = UI_STEP_TONE,
+        .duration = (SAMPLE_RATE * duration_ms) / 1000,
+        .tone = { .phase_inc = phase_increment((float)frequency_hz), .volume = volume },
+    };
+    ui_queue_step(&step);
+}
+
+/**
+ * @brief Queue a silent gap
+ */
+static void queue_gap(uint32_t duration_ms) {
+    ui_step_t step = {
+        .kind = UI_STEP_GAP,
+        .duration = (SAMPLE_RATE * duration_ms) / 1000,
+    };
+    ui_queue_step(&step);
+}
+
+/**
+ * @brief Queue a bell voice
+ * @param overlap true to start the next step together with this bell
+ */
+static void queue_bell(float frequency, float amplitude, float attack, float decay,
+                       float sustain, float release, uint32_t duration_ms, bool overlap) {
+    ui_step_t step = {
+        .kind = UI_STEP_BELL,
+        .bell = {
+            .frequency = frequency,
+            .amplitude = amplitude,
+            .envelope = { attack, decay, sustain, release },
+            .duration_ms = duration_ms,
+            .overlap = overlap,
+        },
+    };
+    ui_queue_step(&step);
+}
+
+/**
+ * @brief Queue an 8-bit sample clip, resampled to the output rate
+ * @return true if queued
+ */
+static bool queue_sample(const int8_t *samples, uint32_t sample_count,
+                         uint32_t sample_rate, uint8_t volume) {
+    if (volume > 100) volume = 100;
+
+    ui_step_t step = {
+        .kind = UI_STEP_SAMPLE,
+        .sample = {
+            .samples = samples,
+            .count = sample_count,
+            .increment = resample_increment(sample_rate, SAMPLE_RATE),
+            .volume = volume,
+        },
+    };
+    return ui_queue_step(&step);
+}
+
+/**
+ * @brief Tone envelope: 10ms linear attack, 20ms linear decay
+ * @return Gain in Q15
+ */
+static inline int32_t tone_envelope(uint32_t index, uint32_t total) {
+    const uint32_t attack_samples = SAMPLE_RATE / 100;
+    const uint32_t decay_samples = SAMPLE_RATE / 50;
 
-    return sample;
+    if (index < attack_samples) {
+        return (int32_t)(index * (32768 / attack_samples));
+    }
+    if (total > decay_samples && index > total - decay_samples) {
+        return (int32_t)((total - index) * (32768 / decay_samples));
+    }
+    return 32768;
 }
 
 /**
- * @brief Mix all active voices into a buffer
+ * @brief Begin playing a dequeued step
+ * @return true if the step occupies the player (false for overlapped bells)
  */
-static void mix_voices(int16_t *buffer, size_t num_samples) {
-    for (size_t i = 0; i < num_samples; i++) {
-        float mix = 0.0f;
+static bool ui_step_begin(const ui_step_t *step) {
+    ui_step = *step;
+    ui_progress = 0;
+    ui_src_pos = 0;
+
+    switch (step->kind) {
+        case UI_STEP_TONE:
+            ui_phase = 0;
+            ui_amplitude = (32767 * step->tone.volume * master_volume) / 10000;
+            break;
 
-        // Sum all active voices
-        for (int v = 0; v < MAX_VOICES; v++) {
-            if (voices[v].active) {
-                mix += generate_bell_sample(&voices[v]);
+        case UI_STEP_BELL: {
+            int v = find_free_voice();
+            init_bell_voice(v, step->bell.frequency, step->bell.amplitude, step->bell.duration_ms);
+            bell_generation[v] = step->generation;
+            if (step->bell.overlap) {
+                return false;
             }
+            ui_bell_voice = v;
+            break;
         }
 
-        // Apply master volume and clamp
-        mix *= (float)master_volume / 100.0f;
+        default:
+            break;
+    }
+    return true;
+}
 
-        // Simple hard clipping
-        if (mix > 1.0f) mix = 1.0f;
-        if (mix < -1.0f) mix = -1.0f;
+/**
+ * @brief Render up to n samples of the current step
+ * @return Samples consumed (less than n when the step finished)
+ */
+static size_t ui_step_render(int32_t *acc, size_t n) {
+    size_t k = 0;
+
+    switch (ui_step.kind) {
+        case UI_STEP_TONE: {
+            uint32_t inc = ui_step.tone.phase_inc;
+            for (; k < n && ui_progress < ui_step.duration; k++, ui_progress++) {
+                int32_t level = (wave_sine(ui_phase) * ui_amplitude) >> 15;
+                acc[k] += (level * tone_envelope(ui_progress, ui_step.duration)) >> 15;
+                ui_phase += inc;
+            }
+            if (ui_progress >= ui_step.duration) ui_step_active = false;
+            break;
+        }
 
-        // Convert to 16-bit
-        int16_t sample_int = (int16_t)(mix * 32000.0f);
+        case UI_STEP_GAP:
+            k = ui_step.duration - ui_progress;
+            if (k > n) k = n;
+            ui_progress += k;
+            if (ui_progress >= ui_step.duration) ui_step_active = false;
+            break;
+
+        case UI_STEP_BELL:
+            // Bells are rendered with the voice pool; hold the queue until this one ends
+            if (voices[ui_bell_voice].active) {
+                k = n;
+            } else {
+                ui_step_active = false;
+            }
+            break;
 
-        // Stereo output (same on both channels)
-        buffer[i * 2] = sample_int;
-        buffer[i * 2 + 1] = sample_int;
+        case UI_STEP_PCM: {
+            const int16_t *pcm = ui_step.pcm.samples;
+            int32_t gain = ui_step.pcm.gain_q8;
+            for (; k < n && ui_progress < ui_step.pcm.count; k++, ui_progress++) {
+                acc[k] += (pcm[ui_progress] * gain) >> 8;
+            }
+            if (ui_progress >= ui_step.pcm.count) ui_step_active = false;
+            break;
+        }
+
+        case UI_STEP_SAMPLE: {
+            // Volume scaling: 8-bit (-128 to 127) -> 16-bit with volume
+            int32_t gain = (256 * ui_step.sample.volume * master_volume) / 10000;
+
+            // Rebase the clip on the read position each block, so only the
+            // part ahead of it has to fit the 16.16 range
+            uint32_t skip = ui_src_pos >> 16;
+            ui_step.sample.samples += skip;
+            ui_step.sample.count -= skip;
+            ui_src_pos &= 0xFFFF;
+
+            uint32_t count = ui_step.sample.count;
+            if (count > RESAMPLE_MAX_SAMPLES) count = RESAMPLE_MAX_SAMPLES;
+            k = resample_mix_lerp8(acc, n, ui_step.sample.samples, count, &ui_src_pos,
+                                   ui_step.sample.increment, gain);
+            if (k < n || (ui_src_pos >> 16) >= ui_step.sample.count) ui_step_active = false;
+            break;
+        }
+
+        default:
+            ui_step_active = false;
+            break;
     }
+    return k;
 }
 
 /**
- * @brief Check if any voice is still active
+ * @brief Check if any bell voice is still active
  */
 static bool any_voice_active(void) {
     for (int i = 0; i < MAX_VOICES; i++) {
@@ -262,119 +635,388 @@ static void clear_all_voices(void) {
 }
 
 /**
- * @brief Play all queued voices until complete
+ * @brief Copy this block's share of the cue being recorded into its entry
+ *
+ * Runs after the bells are mixed, so the recording holds the finished UI
+ * bus. A cue that outgrows its estimate is dropped unrecorded.
  */
-static esp_err_t play_voices(void) {
-    if (!sound_initialized || tx_handle == NULL) {
-        ESP_LOGE(TAG, "play_voices: not initialized");
-        return ESP_ERR_INVALID_STATE;
+static void ui_capture_block(const int32_t *acc, size_t num_samples) {
+    ui_cache_entry_t *entry = capture_entry;
+    size_t to = capture_ending ? capture_to : num_samples;
+    size_t count = to > capture_from ? to - capture_from : 0;
+
+    if (capture_pos + count > entry->capacity) {
+        capture_entry = NULL;
+        return;
     }
+    for (size_t k = 0; k < count; k++) {
+        int32_t s = acc[capture_from + k];
+        if (s > 32767) s = 32767;
+        if (s < -32768) s = -32768;
+        entry->pcm[capture_pos + k] = (int16_t)s;
+    }
+    capture_pos += count;
+    capture_from = 0;
 
-    // Count active voices
-    int active_count = 0;
-    for (int i = 0; i < MAX_VOICES; i++) {
-        if (voices[i].active) active_count++;
+    if (capture_ending) {
+        entry->length = capture_pos;
+        entry->ready = true;
+        capture_entry = NULL;
     }
-    ESP_LOGI(TAG, "Playing %d active voices", active_count);
+}
 
-    if (active_count == 0) {
-        ESP_LOGW(TAG, "No active voices to play");
-        return ESP_OK;
+bool sound_render(int32_t *acc, size_t num_samples) {
+    if (ui_queue == NULL) {
+        return false;
     }
 
-    const size_t buffer_samples = 256;
-    int16_t *buffer = heap_caps_malloc(buffer_samples * sizeof(int16_t) * 2, MALLOC_CAP_DMA);
-    if (!buffer) {
-        ESP_LOGE(TAG, "Failed to allocate audio buffer");
-        return ESP_ERR_NO_MEM;
+    uint32_t generation = ui_generation;
+    if (uxQueueMessagesWaiting(ui_queue) > 0) {
+        ui_busy = true;
     }
 
-    sound_playing = true;
-    size_t bytes_written = 0;
-    int loop_count = 0;
+    // Drop anything cancelled since the last block
+    if (ui_step_active && ui_step.generation != generation) {
+        ui_step_active = false;
+    }
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (voices[v].active && bell_generation[v] != generation) {
+            voices[v].active = false;
+        }
+    }
+    if (capture_entry && capture_generation != generation) {
+        capture_entry = NULL;   // Cancelled cue: the entry stays unrecorded
+    }
 
-    while (any_voice_active() && sound_playing) {
-        mix_voices(buffer, buffer_samples);
+    // Sequence steps through the block
+    size_t i = 0;
+    while (i < num_samples) {
+        if (!ui_step_active) {
+            ui_step_t next;
+            if (xQueueReceive(ui_queue, &next, 0) != pdTRUE) {
+                break;
+            }
+            if (next.generation != generation) {
+                ui_step_done(&next, false);
+                continue;
+            }
+            if (next.kind == UI_STEP_DONE) {
+                ui_step_done(&next, true);
+                continue;
+            }
+            if (next.kind == UI_STEP_CAPTURE) {
+                capture_entry = next.capture;
+                capture_generation = next.generation;
+                capture_pos = 0;
+                capture_from = i;
+                capture_ending = false;
+                continue;
+            }
+            if (next.kind == UI_STEP_CAPTURE_END) {
+                capture_to = i;
+                capture_ending = capture_entry != NULL;
+                continue;
+            }
+            ui_step_active = ui_step_begin(&next);
+            continue;
+        }
+        i += ui_step_render(acc + i, num_samples - i);
+    }
 
-        esp_err_t ret = i2s_channel_write(tx_handle, buffer,
-                                          buffer_samples * sizeof(int16_t) * 2,
-                                          &bytes_written, pdMS_TO_TICKS(1000));
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "I2S write failed: %s", esp_err_to_name(ret));
-            break;
+    // Bell voices play across the whole block
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (voices[v].active) {
+            mix_bell_voice(&voices[v], acc, num_samples);
         }
-        loop_count++;
     }
-    ESP_LOGI(TAG, "Played %d buffers", loop_count);
 
-    // Play a bit of silence to let the sound ring out
-    memset(buffer, 0, buffer_samples * sizeof(int16_t) * 2);
-    for (int i = 0; i < 4; i++) {
-        i2s_channel_write(tx_handle, buffer,
-                          buffer_samples * sizeof(int16_t) * 2,
-                          &bytes_written, pdMS_TO_TICKS(1000));
+    if (capture_entry) {
+        ui_capture_block(acc, num_samples);
     }
 
-    free(buffer);
-    sound_playing = false;
+    ui_busy = ui_step_active || any_voice_active() || uxQueueMessagesWaiting(ui_queue) > 0;
+    return ui_busy;
+}
 
-    return ESP_OK;
+/**
+ * @brief Queue the boot chime notes
+ */
+static void queue_boot_chime(void) {
+    // Simple, bright 3-note ascending chime
+    // Quick and cheerful - like a friendly notification
+    // C5 -> E5 -> G5 (major triad arpeggio) then resolve to C6
+
+    queue_tone(523, 120, 18);   // C5 - quick start
+    queue_gap(80);
+    queue_tone(659, 120, 20);   // E5 - major third
+    queue_gap(80);
+    queue_tone(784, 150, 22);   // G5 - fifth
+    queue_gap(100);
+    queue_tone(1047, 350, 18);  // C6 - octave resolution, longer
 }
 
 /**
- * @brief Play a simple sine tone (for basic effects)
+ * @brief Boot chime completion: wake the waiting task
  */
-static esp_err_t generate_simple_tone(uint32_t frequency_hz, uint32_t duration_ms, uint8_t volume) {
-    if (!sound_initialized || tx_handle == NULL) {
-        return ESP_ERR_INVALID_STATE;
-    }
+static void boot_chime_done(void *arg, bool completed) {
+    xTaskNotifyGive((TaskHandle_t)arg);
+}
 
-    uint32_t total_samples = (SAMPLE_RATE * duration_ms) / 1000;
-    size_t buffer_samples = 256;
-    int16_t *buffer = heap_caps_malloc(buffer_samples * sizeof(int16_t) * 2, MALLOC_CAP_DMA);
-    if (!buffer) {
-        return ESP_ERR_NO_MEM;
+/**
+ * @brief Queue the steps of a sound effect
+ */
+static void queue_effect(int effect) {
+    switch (effect) {
+        case SOUND_BOOT_CHIME:
+            queue_boot_chime();
+            break;
+
+        case SOUND_WIFI_ON: {
+            // Simple rising two-tone
+            queue_tone(660, 60, 65);   // E5
+            queue_gap(30);
+            queue_tone(880, 80, 70);   // A5
+            break;
+        }
+
+        case SOUND_WIFI_OFF: {
+            // Simple falling two-tone
+            queue_tone(880, 60, 65);   // A5
+            queue_gap(30);
+            queue_tone(440, 80, 70);   // A4
+            break;
+        }
+
+        case SOUND_CALIBRATION: {
+            // Attention bell - single clear tone
+            queue_bell(880.0f, 0.6f, 0.002f, 0.3f, 0.1f, 0.5f, 600, false);
+            break;
+        }
+
+        case SOUND_ERROR: {
+            // Dissonant low bells
+            queue_bell(220.0f, 0.6f, 0.01f, 0.4f, 0.2f, 0.3f, 500, true);
+            queue_bell(233.08f, 0.5f, 0.01f, 0.4f, 0.2f, 0.3f, 500, false);  // Slightly detuned
+            break;
+        }
+
+        case SOUND_MODE_CHANGE: {
+            // Quick blip - single short tone
+            queue_tone(1047, 50, 60);   // C6 - short confirmation beep
+            break;
+        }
+
+        case SOUND_MENU_ENTER: {
+            // Long high beep - unmistakable menu entry
+            queue_tone(1000, 300, 75);
+            break;
+        }
+
+        case SOUND_MENU_BACK: {
+            // Short low beep - going back
+            queue_tone(600, 100, 60);
+            break;
+        }
+
+        case SOUND_MENU_CONFIRM: {
+            // Two quick high beeps - success!
+            queue_tone(1200, 80, 75);
+            queue_gap(60);
+            queue_tone(1200, 80, 75);
+            break;
+        }
+
+        case SOUND_MENU_CANCEL: {
+            // One low beep - cancelled/timeout
+            queue_tone(400, 150, 60);
+            break;
+        }
+
+        case SOUND_BEEP_1: {
+            // 1 beep - category/option 1
+            queue_tone(800, 120, 70);
+            break;
+        }
+
+        case SOUND_BEEP_2: {
+            // 2 beeps - category/option 2
+            queue_tone(800, 100, 70);
+            queue_gap(100);
+            queue_tone(800, 100, 70);
+            break;
+        }
+
+        case SOUND_BEEP_3: {
+            // 3 beeps - category/option 3
+            queue_tone(800, 80, 70);
+            queue_gap(80);
+            queue_tone(800, 80, 70);
+            queue_gap(80);
+            queue_tone(800, 80, 70);
+            break;
+        }
+
+        case SOUND_BATTERY_LOW: {
+            // Slow falling triad - "running down"
+            queue_tone(880, 150, 75);   // A5
+            queue_gap(60);
+            queue_tone(659, 150, 75);   // E5
+            queue_gap(60);
+            queue_tone(440, 300, 75);   // A4
+            break;
+        }
+
+        default:
+            break;
     }
+}
 
-    float amplitude = (32767.0f * volume * master_volume) / 10000.0f;
-    float phase = 0.0f;
-    float phase_increment = TWO_PI * frequency_hz / SAMPLE_RATE;
-    uint32_t attack_samples = SAMPLE_RATE / 100;
-    uint32_t decay_samples = SAMPLE_RATE / 50;
+/**
+ * @brief Queue the beep pattern of a steering mode
+ */
+static void queue_mode_beep(int mode) {
+    // Distinctive beep patterns for each steering mode
+    // All use the same volume for consistency (matched to boot chime level)
+    const uint8_t vol = 25;
 
-    sound_playing = true;
-    size_t bytes_written = 0;
-    uint32_t sample_index = 0;
+    switch (mode) {
+        case STEER_MODE_FRONT:
+            // Single high beep - simple, default mode
+            queue_tone(1319, 80, vol);    // E6
+            break;
 
-    while (sample_index < total_samples && sound_playing) {
-        uint32_t chunk_samples = total_samples - sample_index;
-        if (chunk_samples > buffer_samples) chunk_samples = buffer_samples;
+        case STEER_MODE_ALL_AXLE:
+            // Rising two-tone - "going up" to more capability
+            queue_tone(880, 60, vol);     // A5
+            queue_gap(40);
+            queue_tone(1175, 80, vol);    // D6
+            break;
 
-        for (uint32_t i = 0; i < chunk_samples; i++) {
-            float envelope = 1.0f;
-            uint32_t abs_sample = sample_index + i;
-            if (abs_sample < attack_samples) {
-                envelope = (float)abs_sample / attack_samples;
-            } else if (abs_sample > total_samples - decay_samples) {
-                envelope = (float)(total_samples - abs_sample) / decay_samples;
-            }
+        case STEER_MODE_CRAB:
+            // Three quick beeps - distinctive "special" mode
+            queue_tone(988, 50, vol);     // B5
+            queue_gap(50);
+            queue_tone(988, 50, vol);     // B5
+            queue_gap(50);
+            queue_tone(988, 50, vol);     // B5
+            break;
+
+        case STEER_MODE_REAR:
+            // Low beep - rear/backwards association
+            queue_tone(659, 100, vol);    // E5
+            break;
+
+        default:
+            queue_tone(1047, 60, vol);    // C6 fallback
+            break;
+    }
+}
+
+/**
+ * @brief Measure every cacheable cue once and reserve the recording pool
+ *
+ * The pool holds every cue within UI_SOUND_CACHE_MAX_BYTES, so first plays
+ * only carve from it. The boot chime plays once per boot, so it is never
+ * recorded.
+ */
+static void ui_cache_init(void) {
+    uint32_t bytes = 0;
 
-            int16_t sample_int = (int16_t)(fast_sin(phase) * amplitude * envelope);
-            buffer[i * 2] = sample_int;
-            buffer[i * 2 + 1] = sample_int;
+    for (int cue = 0; cue < UI_CUE_COUNT; cue++) {
+        ui_cache_entry_t *entry = &ui_cache[cue];
+        ui_measure_t measure = { 0 };
 
-            phase += phase_increment;
-            if (phase >= TWO_PI) phase -= TWO_PI;
+        if (entry->pcm != NULL || cue == SOUND_BOOT_CHIME) {
+            continue;   // Recordings survive sound_deinit()
         }
+        ui_measure = &measure;
+        if (cue < SOUND_COUNT) {
+            queue_effect(cue);
+        } else {
+            queue_mode_beep(cue - SOUND_COUNT);
+        }
+        ui_measure = NULL;
 
-        i2s_channel_write(tx_handle, buffer, chunk_samples * sizeof(int16_t) * 2,
-                          &bytes_written, pdMS_TO_TICKS(1000));
-        sample_index += chunk_samples;
+        // Slack for a recording that starts mid-block
+        entry->capacity = measure.end + AUDIO_BLOCK_FRAMES;
+        bytes += entry->capacity * sizeof(int16_t);
     }
 
-    free(buffer);
-    sound_playing = false;
-    return ESP_OK;
+    if (ui_cache_pool != NULL) {
+        return;     // Reserved by an earlier init
+    }
+    if (bytes > UI_SOUND_CACHE_MAX_BYTES) {
+        bytes = UI_SOUND_CACHE_MAX_BYTES;
+    }
+    ui_cache_pool = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (ui_cache_pool == NULL) {
+        ui_cache_pool = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (ui_cache_pool == NULL) {
+        ESP_LOGW(TAG, "No memory for %lu byte cue cache, cues stay synthesized", (unsigned long)bytes);
+        return;
+    }
+    ui_cache_pool_bytes = bytes;
+}
+
+/**
+ * @brief Give a cue its recording buffer from the pool
+ *
+ * First come, first cached. A cue that does not fit is marked uncacheable
+ * (capacity 0) and keeps being synthesized.
+ */
+static void ui_cache_alloc(ui_cache_entry_t *entry) {
+    size_t bytes = entry->capacity * sizeof(int16_t);
+
+    if (ui_cache_pool == NULL || ui_cache_bytes + bytes > ui_cache_pool_bytes) {
+        entry->capacity = 0;
+        return;
+    }
+    entry->pcm = ui_cache_pool + ui_cache_bytes / sizeof(int16_t);
+    ui_cache_bytes += bytes;
+}
+
+/**
+ * @brief Queue a fixed cue, streaming its recording when there is one
+ *
+ * The first play is synthesized and recorded by the mixer. A recording
+ * made at a lower master volume is redone rather than scaled up.
+ */
+static void queue_cue(int cue, void (*build)(int arg), int arg) {
+    ui_cache_entry_t *entry = &ui_cache[cue];
+
+    if (entry->ready && entry->volume >= master_volume) {
+        ui_step_t step = {
+            .kind = UI_STEP_PCM,
+            .pcm = {
+                .samples = entry->pcm,
+                .count = entry->length,
+                .gain_q8 = (master_volume * 256) / entry->volume,
+            },
+        };
+        ui_queue_step(&step);
+        return;
+    }
+
+    if (entry->pcm == NULL && entry->capacity > 0) {
+        ui_cache_alloc(entry);
+    }
+    // Nothing is recording into the buffer: the mixer drops the previous
+    // generation's capture before it starts this one
+    bool record = entry->pcm != NULL && master_volume > 0;
+    if (record) {
+        entry->ready = false;
+        entry->volume = master_volume;
+        ui_step_t step = { .kind = UI_STEP_CAPTURE, .capture = entry };
+        ui_queue_step(&step);
+    }
+
+    build(arg);
+
+    if (record) {
+        ui_step_t step = { .kind = UI_STEP_CAPTURE_END };
+        ui_queue_step(&step);
+    }
 }
 
 // ============================================================================
@@ -392,15 +1034,23 @@ esp_err_t sound_init(void) {
 
     // Clear voice array
     clear_all_voices();
+    oscillators_init();
+    ui_cache_init();
 
-    // Channel configuration with larger DMA buffers to prevent timeout
+    ui_queue = xQueueCreate(UI_QUEUE_DEPTH, sizeof(ui_step_t));
+    if (ui_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create UI sound queue");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Channel configuration (buffering profile from config.h)
     // dma_buffer_size = dma_frame_num * slot_num * slot_bit_width / 8 ≤ 4092
-    // For stereo 16-bit: dma_frame_num * 2 * 2 = dma_frame_num * 4 ≤ 4092
-    // Max dma_frame_num = 1023, using 512 for safety
+    // For mono 16-bit: dma_frame_num * 1 * 2 = 1024 bytes per 512-frame buffer
+    // (stereo would be dma_frame_num * 4)
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
     chan_cfg.auto_clear = true;
-    chan_cfg.dma_desc_num = 8;      // 8 DMA descriptors
-    chan_cfg.dma_frame_num = 512;   // 512 frames per DMA buffer (was 256)
+    chan_cfg.dma_desc_num = AUDIO_DMA_DESC_NUM;
+    chan_cfg.dma_frame_num = AUDIO_DMA_FRAME_NUM;
 
     esp_err_t ret = i2s_new_channel(&chan_cfg, &tx_handle, NULL);
     if (ret != ESP_OK) {
@@ -411,7 +1061,8 @@ esp_err_t sound_init(void) {
     // Standard mode configuration
     i2s_std_config_t std_cfg = {
         .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(SAMPLE_RATE),
-        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
+        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT,
+                        AUDIO_CHANNELS == 2 ? I2S_SLOT_MODE_STEREO : I2S_SLOT_MODE_MONO),
         .gpio_cfg = {
             .mclk = I2S_GPIO_UNUSED,
             .bclk = PIN_I2S_BCLK,
@@ -425,6 +1076,9 @@ esp_err_t sound_init(void) {
             },
         },
     };
+    // Mono defaults to the left slot only; drive both so the amp's (L+R)/2
+    // downmix sees the full signal
+    std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_BOTH;
 
     ret = i2s_channel_init_std_mode(tx_handle, &std_cfg);
     if (ret != ESP_OK) {
@@ -472,18 +1126,15 @@ esp_err_t sound_play_boot_chime(void) {
     }
 
     ESP_LOGI(TAG, "Playing boot chime...");
-
-    // Simple, bright 3-note ascending chime
-    // Quick and cheerful - like a friendly notification
-    // C5 -> E5 -> G5 (major triad arpeggio) then resolve to C6
-
-    generate_simple_tone(523, 120, 18);   // C5 - quick start
-    vTaskDelay(pdMS_TO_TICKS(80));
-    generate_simple_tone(659, 120, 20);   // E5 - major third
-    vTaskDelay(pdMS_TO_TICKS(80));
-    generate_simple_tone(784, 150, 22);   // G5 - fifth
-    vTaskDelay(pdMS_TO_TICKS(100));
-    generate_simple_tone(1047, 350, 18);  // C6 - octave resolution, longer
+    ui_flush();
+    queue_boot_chime();
+    queue_done(boot_chime_done, xTaskGetCurrentTaskHandle());
+
+    // Boot is the one caller that waits: give up rather than hang if the mixer isn't running
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BOOT_CHIME_TIMEOUT_MS)) == 0) {
+        ESP_LOGW(TAG, "Boot chime timed out");
+        return ESP_ERR_TIMEOUT;
+    }
 
     ESP_LOGI(TAG, "Boot chime complete");
     return ESP_OK;
@@ -494,150 +1145,35 @@ esp_err_t sound_play_mode_beep(steering_mode_t mode) {
         return ESP_ERR_INVALID_STATE;
     }
 
-    // Distinctive beep patterns for each steering mode
-    // All use the same volume for consistency (matched to boot chime level)
-    const uint8_t vol = 25;
-
-    switch (mode) {
-        case STEER_MODE_FRONT:
-            // Single high beep - simple, default mode
-            generate_simple_tone(1319, 80, vol);    // E6
-            break;
-
-        case STEER_MODE_ALL_AXLE:
-            // Rising two-tone - "going up" to more capability
-            generate_simple_tone(880, 60, vol);     // A5
-            vTaskDelay(pdMS_TO_TICKS(40));
-            generate_simple_tone(1175, 80, vol);    // D6
-            break;
+    ui_flush();  // Only the latest mode matters
 
-        case STEER_MODE_CRAB:
-            // Three quick beeps - distinctive "special" mode
-            generate_simple_tone(988, 50, vol);     // B5
-            vTaskDelay(pdMS_TO_TICKS(50));
-            generate_simple_tone(988, 50, vol);     // B5
-            vTaskDelay(pdMS_TO_TICKS(50));
-            generate_simple_tone(988, 50, vol);     // B5
-            break;
-
-        case STEER_MODE_REAR:
-            // Low beep - rear/backwards association
-            generate_simple_tone(659, 100, vol);    // E5
-            break;
-
-        default:
-            generate_simple_tone(1047, 60, vol);    // C6 fallback
-            break;
+    if (mode < STEER_MODE_COUNT) {
+        queue_cue(SOUND_COUNT + mode, queue_mode_beep, mode);
+    } else {
+        queue_mode_beep(mode);
     }
 
     return ESP_OK;
 }
 
 esp_err_t sound_play(sound_effect_t effect) {
+    return sound_play_async(effect, NULL, NULL);
+}
+
+esp_err_t sound_play_async(sound_effect_t effect, sound_done_cb_t done, void *arg) {
     if (!sound_initialized) {
         return ESP_ERR_INVALID_STATE;
     }
+    if (effect >= SOUND_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
-    clear_all_voices();
-
-    switch (effect) {
-        case SOUND_BOOT_CHIME:
-            return sound_play_boot_chime();
-
-        case SOUND_WIFI_ON: {
-            // Simple rising two-tone
-            generate_simple_tone(660, 60, 65);   // E5
-            vTaskDelay(pdMS_TO_TICKS(30));
-            generate_simple_tone(880, 80, 70);   // A5
-            break;
-        }
-
-        case SOUND_WIFI_OFF: {
-            // Simple falling two-tone
-            generate_simple_tone(880, 60, 65);   // A5
-            vTaskDelay(pdMS_TO_TICKS(30));
-            generate_simple_tone(440, 80, 70);   // A4
-            break;
-        }
-
-        case SOUND_CALIBRATION: {
-            // Attention bell - single clear tone
-            int v = find_free_voice();
-            init_bell_voice(v, 880.0f, 0.6f, 0.002f, 0.3f, 0.1f, 0.5f, 600);
-            play_voices();
-            break;
-        }
-
-        case SOUND_ERROR: {
-            // Dissonant low bells
-            int v1 = find_free_voice();
-            int v2 = find_free_voice();
-            init_bell_voice(v1, 220.0f, 0.6f, 0.01f, 0.4f, 0.2f, 0.3f, 500);
-            init_bell_voice(v2, 233.08f, 0.5f, 0.01f, 0.4f, 0.2f, 0.3f, 500);  // Slightly detuned
-            play_voices();
-            break;
-        }
-
-        case SOUND_MODE_CHANGE: {
-            // Quick blip - single short tone
-            generate_simple_tone(1047, 50, 60);   // C6 - short confirmation beep
-            break;
-        }
-
-        case SOUND_MENU_ENTER: {
-            // Long high beep - unmistakable menu entry
-            generate_simple_tone(1000, 300, 75);
-            break;
-        }
-
-        case SOUND_MENU_BACK: {
-            // Short low beep - going back
-            generate_simple_tone(600, 100, 60);
-            break;
-        }
-
-        case SOUND_MENU_CONFIRM: {
-            // Two quick high beeps - success!
-            generate_simple_tone(1200, 80, 75);
-            vTaskDelay(pdMS_TO_TICKS(60));
-            generate_simple_tone(1200, 80, 75);
-            break;
-        }
-
-        case SOUND_MENU_CANCEL: {
-            // One low beep - cancelled/timeout
-            generate_simple_tone(400, 150, 60);
-            break;
-        }
-
-        case SOUND_BEEP_1: {
-            // 1 beep - category/option 1
-            generate_simple_tone(800, 120, 70);
-            break;
-        }
-
-        case SOUND_BEEP_2: {
-            // 2 beeps - category/option 2
-            generate_simple_tone(800, 100, 70);
-            vTaskDelay(pdMS_TO_TICKS(100));
-            generate_simple_tone(800, 100, 70);
-            break;
-        }
-
-        case SOUND_BEEP_3: {
-            // 3 beeps - category/option 3
-            generate_simple_tone(800, 80, 70);
-            vTaskDelay(pdMS_TO_TICKS(80));
-            generate_simple_tone(800, 80, 70);
-            vTaskDelay(pdMS_TO_TICKS(80));
-            generate_simple_tone(800, 80, 70);
-            break;
-        }
+    // A new effect interrupts whatever the UI bus is playing
+    ui_flush();
 
-        default:
-            return ESP_ERR_INVALID_ARG;
-    }
+    queue_cue(effect, queue_effect, effect);
 
+    queue_done(done, arg);
     return ESP_OK;
 }
 
@@ -652,17 +1188,19 @@ esp_err_t sound_play_tone(uint32_t frequency_hz, uint32_t duration_ms, uint8_t v
 
     if (volume > 100) volume = 100;
 
-    return generate_simple_tone(frequency_hz, duration_ms, volume);
+    queue_tone(frequency_hz, duration_ms, volume);
+    return ESP_OK;
 }
 
 esp_err_t sound_stop(void) {
-    sound_playing = false;
-    clear_all_voices();
+    if (ui_queue != NULL) {
+        ui_flush();
+    }
     return ESP_OK;
 }
 
 bool sound_is_playing(void) {
-    return sound_playing;
+    return ui_busy || (ui_queue != NULL && uxQueueMessagesWaiting(ui_queue) > 0);
 }
 
 void sound_set_volume(uint8_t volume) {
@@ -676,7 +1214,13 @@ uint8_t sound_get_volume(void) {
 
 esp_err_t sound_play_sample(const int8_t *samples, uint32_t sample_count,
                             uint32_t sample_rate, uint8_t volume) {
-    if (!sound_initialized || tx_handle == NULL) {
+    return sound_play_sample_async(samples, sample_count, sample_rate, volume, NULL, NULL);
+}
+
+esp_err_t sound_play_sample_async(const int8_t *samples, uint32_t sample_count,
+                                  uint32_t sample_rate, uint8_t volume,
+                                  sound_done_cb_t done, void *arg) {
+    if (!sound_initialized) {
         return ESP_ERR_INVALID_STATE;
     }
 
@@ -684,57 +1228,52 @@ esp_err_t sound_play_sample(const int8_t *samples, uint32_t sample_count,
         return ESP_ERR_INVALID_ARG;
     }
 
-    if (volume > 100) volume = 100;
-
-    // Buffer for I2S output (stereo 16-bit)
-    size_t buffer_samples = 256;
-    int16_t *buffer = heap_caps_malloc(buffer_samples * sizeof(int16_t) * 2, MALLOC_CAP_DMA);
-    if (!buffer) {
-        ESP_LOGE(TAG, "Failed to allocate sample buffer");
+    if (!queue_sample(samples, sample_count, sample_rate, volume)) {
         return ESP_ERR_NO_MEM;
     }
+    queue_done(done, arg);
+    return ESP_OK;
+}
 
-    // Volume scaling: 8-bit (-128 to 127) -> 16-bit with volume
-    float scale = (256.0f * volume * master_volume) / 10000.0f;
-
-    sound_playing = true;
-    size_t bytes_written = 0;
-    uint32_t sample_index = 0;
+esp_err_t sound_play_prompt(const int8_t *samples, uint32_t sample_count,
+                            uint32_t sample_rate, uint8_t volume, bool barge_in) {
+    if (!sound_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
 
-    // Simple resampling support (if sample_rate differs from SAMPLE_RATE)
-    float rate_ratio = (float)sample_rate / SAMPLE_RATE;
-    float src_pos = 0.0f;
+    if (samples == NULL || sample_count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
-    while (sample_index < sample_count && sound_playing) {
-        uint32_t chunk_samples = 0;
+    if (barge_in) {
+        ui_flush();
+    } else if (sound_is_playing()) {
+        queue_gap(PROMPT_GAP_MS);
+    }
 
-        // Fill buffer with converted samples
-        for (uint32_t i = 0; i < buffer_samples && src_pos < sample_count; i++) {
-            // Get source sample (with simple linear interpolation)
-            uint32_t idx = (uint32_t)src_pos;
-            if (idx >= sample_count) break;
+    return queue_sample(samples, sample_count, sample_rate, volume) ? ESP_OK : ESP_ERR_NO_MEM;
+}
 
-            // Convert 8-bit signed to 16-bit
-            int16_t sample16 = (int16_t)(samples[idx] * scale);
+esp_err_t sound_play_count_beeps(uint8_t count, uint8_t volume, bool barge_in) {
+    if (!sound_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
-            // Stereo (duplicate to both channels)
-            buffer[i * 2] = sample16;
-            buffer[i * 2 + 1] = sample16;
+    if (barge_in) {
+        ui_flush();
+    } else if (sound_is_playing()) {
+        queue_gap(PROMPT_GAP_MS);
+    }
 
-            src_pos += rate_ratio;
-            chunk_samples++;
+    if (volume > 100) volume = 100;
+    for (uint8_t i = 0; i < count; i++) {
+        if (i > 0) {
+            queue_gap(COUNT_BEEP_GAP_MS);
         }
-
-        if (chunk_samples == 0) break;
-
-        // Write to I2S
-        i2s_channel_write(tx_handle, buffer, chunk_samples * sizeof(int16_t) * 2,
-                          &bytes_written, pdMS_TO_TICKS(1000));
-
-        sample_index = (uint32_t)src_pos;
+        queue_tone(COUNT_BEEP_HZ, COUNT_BEEP_MS, volume);
     }
-
-    free(buffer);
-    sound_playing = false;
     return ESP_OK;
 }
@@ -3,7 +3,8 @@
  * @brief Sound system for 8x8 Crawler Controller
  *
  * I2S audio output driver for MAX98357A amplifier.
- * Provides boot chime and sound effect playback.
+ * Provides boot chime and sound effect playback. Playback calls only
+ * queue steps for the UI bus; the audio mixer renders them.
  */
 
 #ifndef SOUND_H
@@ -13,6 +14,7 @@
 #include "config.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 /**
  * @brief Sound effect identifiers
@@ -32,9 +34,26 @@ typedef enum {
     SOUND_BEEP_1,           // 1 beep (category 1 / volume low)
     SOUND_BEEP_2,           // 2 beeps (category 2 / volume medium)
     SOUND_BEEP_3,           // 3 beeps (category 3 / volume high)
+    SOUND_BATTERY_LOW,      // Falling 3-tone alert (pack low / critical)
     SOUND_COUNT
 } sound_effect_t;
 
+/**
+ * @brief Store one output frame in an I2S buffer (see AUDIO_CHANNELS)
+ * @param buffer Buffer of AUDIO_FRAME_BYTES-sized frames
+ * @param i Frame index
+ * @param sample Sample for every channel of the frame
+ */
+static inline void sound_put_frame(int16_t *buffer, size_t i, int16_t sample)
+{
+#if AUDIO_CHANNELS == 2
+    buffer[i * 2] = sample;
+    buffer[i * 2 + 1] = sample;
+#else
+    buffer[i] = sample;
+#endif
+}
+
 /**
  * @brief Initialize the sound system
  *
@@ -53,6 +72,17 @@ esp_err_t sound_init(void);
  */
 esp_err_t sound_deinit(void);
 
+/**
+ * @brief Playback completion callback
+ *
+ * Runs on the audio mixer task when the sound finishes, or on the task
+ * that cancelled it (sound_stop() or a new sound_play()). Must not block.
+ *
+ * @param arg User argument given when the sound was queued
+ * @param completed true if the sound played to the end, false if cancelled
+ */
+typedef void (*sound_done_cb_t)(void *arg, bool completed);
+
 /**
  * @brief Play a sound effect (non-blocking)
  *
@@ -64,18 +94,31 @@ esp_err_t sound_deinit(void);
  */
 esp_err_t sound_play(sound_effect_t effect);
 
+/**
+ * @brief Play a sound effect and report when it ends (non-blocking)
+ *
+ * Same as sound_play(); done (if not NULL) is called exactly once.
+ *
+ * @param effect Sound effect to play
+ * @param done Completion callback, or NULL
+ * @param arg Argument passed to done
+ * @return ESP_OK on success (done is not called on error)
+ */
+esp_err_t sound_play_async(sound_effect_t effect, sound_done_cb_t done, void *arg);
+
 /**
  * @brief Play the boot chime (blocking)
  *
- * Plays the startup chime and waits for completion.
- * Call this during initialization.
+ * Plays the startup chime and waits for completion (at most a few
+ * seconds). Call this during initialization only; everything else should
+ * use sound_play() / sound_play_async().
  *
  * @return ESP_OK on success
  */
 esp_err_t sound_play_boot_chime(void);
 
 /**
- * @brief Play a tone at specified frequency
+ * @brief Play a tone at specified frequency (queued, non-blocking)
  *
  * @param frequency_hz Tone frequency in Hz
  * @param duration_ms Duration in milliseconds
@@ -109,10 +152,19 @@ esp_err_t sound_stop(void);
 /**
  * @brief Check if sound is currently playing
  *
- * @return true if sound is playing
+ * @return true if UI audio is playing or queued
  */
 bool sound_is_playing(void);
 
+/**
+ * @brief Render one block of the UI bus (audio mixer task only)
+ *
+ * @param acc Accumulator to add into
+ * @param num_samples Block length (at most AUDIO_BLOCK_FRAMES)
+ * @return true if anything was rendered
+ */
+bool sound_render(int32_t *acc, size_t num_samples);
+
 /**
  * @brief Set master volume
  *
@@ -130,8 +182,8 @@ uint8_t sound_get_volume(void);
 /**
  * @brief Play an 8-bit signed sample array
  *
- * Plays audio from a signed 8-bit sample array (like TTS or WAV data).
- * Converts to 16-bit stereo for I2S output.
+ * Queues audio from a signed 8-bit sample array (like TTS or WAV data)
+ * after anything already queued, resampled to AUDIO_SAMPLE_RATE.
  *
  * @param samples Pointer to signed 8-bit sample array
  * @param sample_count Number of samples
@@ -142,4 +194,47 @@ uint8_t sound_get_volume(void);
 esp_err_t sound_play_sample(const int8_t *samples, uint32_t sample_count,
                             uint32_t sample_rate, uint8_t volume);
 
+/**
+ * @brief Queue a sample and report when it ends (non-blocking)
+ *
+ * Same as sound_play_sample(); done (if not NULL) is called exactly once.
+ *
+ * @param done Completion callback, or NULL
+ * @param arg Argument passed to done
+ * @return ESP_OK on success (done is not called on error)
+ */
+esp_err_t sound_play_sample_async(const int8_t *samples, uint32_t sample_count,
+                                  uint32_t sample_rate, uint8_t volume,
+                                  sound_done_cb_t done, void *arg);
+
+/**
+ * @brief Queue a spoken prompt (non-blocking)
+ *
+ * With barge_in, whatever the UI bus is playing or has queued is cancelled
+ * and the prompt starts at the next mixer block. Otherwise the prompt
+ * follows what is queued, after a short pause.
+ *
+ * @param samples Pointer to signed 8-bit sample array
+ * @param sample_count Number of samples
+ * @param sample_rate Sample rate in Hz
+ * @param volume Volume level 0-100
+ * @param barge_in true to interrupt the current prompt
+ * @return ESP_OK on success
+ */
+esp_err_t sound_play_prompt(const int8_t *samples, uint32_t sample_count,
+                            uint32_t sample_rate, uint8_t volume, bool barge_in);
+
+/**
+ * @brief Queue a run of short beeps (non-blocking)
+ *
+ * Stands in for spoken prompts in builds without them: the listener
+ * counts the beeps.
+ *
+ * @param count Number of beeps (1 or more)
+ * @param volume Volume level 0-100
+ * @param barge_in true to interrupt whatever the UI bus is playing
+ * @return ESP_OK on success
+ */
+esp_err_t sound_play_count_beeps(uint8_t count, uint8_t volume, bool barge_in);
+
 #endif // SOUND_H
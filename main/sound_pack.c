@@ -0,0 +1,210 @@
+/**
+ * @file sound_pack.c
+ * @brief Memory-mapped sound bank implementation
+ */
+
+#include "sound_pack.h"
+#include "adpcm.h"
+
+#include <string.h>
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "SOUND_PACK";
+
+#define SOUND_PACK_PARTITION_LABEL      "sounds"
+#define SOUND_PACK_PARTITION_SUBTYPE    0x40
+
+static const uint8_t *pack = NULL;              // Mapped partition
+static const sound_pack_entry_t *entries = NULL;
+static uint16_t entry_count = 0;
+static esp_partition_mmap_handle_t pack_handle;
+
+// Pack profiles, pointing into the mapping
+static sound_profile_def_t profiles[SOUND_PACK_MAX_PROFILES];
+static int profile_count = 0;
+
+/**
+ * @brief Encoded size of a clip
+ */
+static uint32_t clip_bytes(const sound_pack_entry_t *e)
+{
+    if (e->format == SOUND_FORMAT_IMA_ADPCM) {
+        return adpcm_encoded_bytes(e->sample_count);
+    }
+    return e->sample_count;
+}
+
+/**
+ * @brief Check that a directory entry lies inside the pack
+ */
+static bool entry_valid(const sound_pack_entry_t *e, uint32_t total_size)
+{
+    if (memchr(e->name, '\0', sizeof(e->name)) == NULL) return false;
+    if (e->format > SOUND_FORMAT_IMA_ADPCM) return false;
+    if (e->sample_count == 0 || e->offset > total_size) return false;
+    if (clip_bytes(e) > total_size - e->offset) return false;
+    if (e->loop_end > e->sample_count || e->loop_begin > e->loop_end) return false;
+    return true;
+}
+
+/**
+ * @brief Fill a sound sample from a clip index (none -> empty sample)
+ */
+static bool clip_sample(uint16_t index, sound_sample_t *sample)
+{
+    memset(sample, 0, sizeof(*sample));
+    if (index == SOUND_PACK_NO_CLIP) {
+        return true;
+    }
+    if (index >= entry_count) {
+        return false;
+    }
+    const sound_pack_entry_t *e = &entries[index];
+    sample->samples = (const int8_t *)(pack + e->offset);
+    sample->sample_count = e->sample_count;
+    sample->sample_rate = e->sample_rate;
+    sample->format = (sound_format_t)e->format;
+    return true;
+}
+
+/**
+ * @brief Build a profile definition from a pack record
+ */
+static bool build_profile(const sound_pack_profile_t *rec, sound_profile_def_t *def)
+{
+    if (memchr(rec->name, '\0', sizeof(rec->name)) == NULL ||
+        memchr(rec->description, '\0', sizeof(rec->description)) == NULL) {
+        return false;
+    }
+
+    memset(def, 0, sizeof(*def));
+    def->name = rec->name;
+    def->description = rec->description;
+    def->cylinder_count = rec->cylinder_count ? rec->cylinder_count : 6;
+
+    if (!clip_sample(rec->idle, &def->idle) || !clip_sample(rec->rev, &def->rev) ||
+        !clip_sample(rec->knock, &def->knock) || !clip_sample(rec->start, &def->start) ||
+        !clip_sample(rec->jake_brake, &def->jake_brake) ||
+        !clip_sample(rec->shifting, &def->shifting) ||
+        !clip_sample(rec->wastegate, &def->wastegate)) {
+        return false;
+    }
+
+    // The mixer needs the engine layers; idle and knock must be PCM8
+    if (def->idle.samples == NULL || def->rev.samples == NULL ||
+        def->knock.samples == NULL || def->start.samples == NULL ||
+        def->idle.format != SOUND_FORMAT_PCM8 || def->knock.format != SOUND_FORMAT_PCM8) {
+        return false;
+    }
+    def->has_jake_brake = (def->jake_brake.samples != NULL);
+    return true;
+}
+
+esp_err_t sound_pack_init(void)
+{
+    if (pack != NULL) {
+        return ESP_OK;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           SOUND_PACK_PARTITION_SUBTYPE,
+                                                           SOUND_PACK_PARTITION_LABEL);
+    if (part == NULL) {
+        ESP_LOGI(TAG, "No sound pack partition, using built-in sounds");
+        return ESP_OK;
+    }
+
+    int64_t start = esp_timer_get_time();
+    const void *map;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA,
+                                       &map, &pack_handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to map sound pack: %s", esp_err_to_name(err));
+        return ESP_OK;
+    }
+
+    const uint8_t *base = map;
+    const sound_pack_header_t *hdr = map;
+    const char *reason = NULL;
+
+    if (hdr->magic != SOUND_PACK_MAGIC) {
+        reason = "no pack flashed";
+    } else if (hdr->version != SOUND_PACK_VERSION) {
+        reason = "unsupported version";
+    } else if (hdr->total_size < sizeof(*hdr) || hdr->total_size > part->size) {
+        reason = "bad size";
+    } else if ((uint64_t)hdr->entry_count * sizeof(sound_pack_entry_t) +
+               (uint64_t)hdr->profile_count * sizeof(sound_pack_profile_t) >
+               hdr->total_size - sizeof(*hdr)) {
+        reason = "directory out of range";
+    } else if (esp_rom_crc32_le(0, base + sizeof(*hdr), hdr->total_size - sizeof(*hdr)) != hdr->crc32) {
+        reason = "CRC mismatch";
+    }
+
+    if (reason == NULL) {
+        const sound_pack_entry_t *dir = (const sound_pack_entry_t *)(base + sizeof(*hdr));
+        for (int i = 0; i < hdr->entry_count && reason == NULL; i++) {
+            if (!entry_valid(&dir[i], hdr->total_size)) {
+                reason = "bad clip entry";
+            }
+        }
+    }
+
+    if (reason != NULL) {
+        ESP_LOGI(TAG, "Sound pack not used (%s), using built-in sounds", reason);
+        esp_partition_munmap(pack_handle);
+        return ESP_OK;
+    }
+
+    pack = base;
+    entries = (const sound_pack_entry_t *)(base + sizeof(*hdr));
+    entry_count = hdr->entry_count;
+
+    const sound_pack_profile_t *recs = (const sound_pack_profile_t *)(entries + entry_count);
+    for (int i = 0; i < hdr->profile_count && profile_count < SOUND_PACK_MAX_PROFILES; i++) {
+        if (build_profile(&recs[i], &profiles[profile_count])) {
+            profile_count++;
+        } else {
+            ESP_LOGW(TAG, "Skipping invalid pack profile %d", i);
+        }
+    }
+
+    ESP_LOGI(TAG, "Sound pack mapped: %u clips, %d profiles, %lu bytes in %lu us",
+             entry_count, profile_count, (unsigned long)hdr->total_size,
+             (unsigned long)(esp_timer_get_time() - start));
+    return ESP_OK;
+}
+
+bool sound_pack_is_loaded(void)
+{
+    return pack != NULL;
+}
+
+bool sound_pack_find(const char *name, sound_pack_clip_t *clip)
+{
+    for (int i = 0; i < entry_count; i++) {
+        if (strncmp(entries[i].name, name, SOUND_PACK_NAME_LEN) == 0) {
+            clip_sample(i, &clip->sample);
+            clip->loop_begin = entries[i].loop_begin;
+            clip->loop_end = entries[i].loop_end ? entries[i].loop_end : entries[i].sample_count;
+            return true;
+        }
+    }
+    return false;
+}
+
+int sound_pack_profile_count(void)
+{
+    return profile_count;
+}
+
+const sound_profile_def_t *sound_pack_get_profile(int index)
+{
+    if (index < 0 || index >= profile_count) {
+        return NULL;
+    }
+    return &profiles[index];
+}
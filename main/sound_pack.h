@@ -0,0 +1,123 @@
+/**
+ * @file sound_pack.h
+ * @brief Memory-mapped sound bank in the "sounds" flash partition
+ *
+ * The pack is built by tools/soundpack-build.js and flashed on its own
+ * (parttool.py write_partition --partition-name sounds ...), so engine
+ * profiles and horns can change without a firmware build or OTA.
+ *
+ * Layout (little endian, all offsets from the partition start):
+ *   sound_pack_header_t
+ *   sound_pack_entry_t   [entry_count]     clip directory
+ *   sound_pack_profile_t [profile_count]   engine profiles (clip indices)
+ *   clip data
+ *
+ * Clips are referenced zero-copy from the mapped partition. Pack profiles
+ * follow the built-in ones in sound_profiles_get(); pack horns replace the
+ * built-in horn of the same name.
+ */
+
+#ifndef SOUND_PACK_H
+#define SOUND_PACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sounds/sound_profiles.h"
+
+#define SOUND_PACK_MAGIC        0x50444E53  // "SNDP"
+#define SOUND_PACK_VERSION      1
+#define SOUND_PACK_NAME_LEN     24
+#define SOUND_PACK_DESC_LEN     48
+#define SOUND_PACK_NO_CLIP      0xFFFF
+#define SOUND_PACK_MAX_PROFILES 8
+
+/**
+ * @brief Pack header
+ */
+typedef struct {
+    uint32_t magic;             // SOUND_PACK_MAGIC
+    uint16_t version;           // SOUND_PACK_VERSION
+    uint16_t entry_count;
+    uint16_t profile_count;
+    uint16_t reserved0;
+    uint32_t total_size;        // Bytes including this header
+    uint32_t crc32;             // CRC-32 of bytes [sizeof(header), total_size)
+    uint32_t reserved[3];
+} sound_pack_header_t;
+
+/**
+ * @brief Clip directory entry
+ */
+typedef struct {
+    char name[SOUND_PACK_NAME_LEN];     // NUL-terminated, e.g. "horn_dixie"
+    uint32_t offset;                    // Clip data offset
+    uint32_t sample_count;              // Decoded samples
+    uint32_t sample_rate;
+    uint32_t loop_begin;
+    uint32_t loop_end;
+    uint8_t format;                     // sound_format_t
+    uint8_t reserved[3];
+} sound_pack_entry_t;
+
+/**
+ * @brief Engine profile record
+ */
+typedef struct {
+    char name[SOUND_PACK_NAME_LEN];
+    char description[SOUND_PACK_DESC_LEN];
+    uint16_t idle;                      // Clip indices (SOUND_PACK_NO_CLIP = none)
+    uint16_t rev;
+    uint16_t knock;
+    uint16_t start;
+    uint16_t jake_brake;
+    uint16_t shifting;
+    uint16_t wastegate;
+    uint8_t cylinder_count;
+    uint8_t reserved;
+} sound_pack_profile_t;
+
+/**
+ * @brief A clip found in the pack
+ */
+typedef struct {
+    sound_sample_t sample;
+    uint32_t loop_begin;
+    uint32_t loop_end;
+} sound_pack_clip_t;
+
+/**
+ * @brief Map and validate the sound pack partition
+ *
+ * A missing, blank or invalid pack is not an error: the built-in sounds
+ * are used and ESP_OK is returned.
+ * @return ESP_OK
+ */
+esp_err_t sound_pack_init(void);
+
+/**
+ * @brief Check whether a valid pack is mapped
+ */
+bool sound_pack_is_loaded(void);
+
+/**
+ * @brief Find a clip by name
+ * @param name Entry name
+ * @param clip Filled when found
+ * @return true if found
+ */
+bool sound_pack_find(const char *name, sound_pack_clip_t *clip);
+
+/**
+ * @brief Number of engine profiles in the pack
+ */
+int sound_pack_profile_count(void);
+
+/**
+ * @brief Get a pack engine profile
+ * @param index 0 .. sound_pack_profile_count() - 1
+ * @return Profile, or NULL if out of range
+ */
+const sound_profile_def_t *sound_pack_get_profile(int index);
+
+#endif // SOUND_PACK_H
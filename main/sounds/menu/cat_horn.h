@@ -1,267 +0,0 @@
-// TTS sound: cat_horn
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_cat_hornSampleRate = 11025;
-const unsigned int menu_cat_hornSampleCount = 4152;
-const signed char menu_cat_hornSamples[] = {
-1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 2, 5, 3, 3, 2, -1, -2, -2, -1, 0, 0, 1, 1,
-0, 0, 1, 0, -1, 0, -1, -1, -1, 0, 0, 1, 1, 0, 0, 0,
-0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1,
-0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 4, 4, 3, 2, 0, -2, -2, -1, 0, 0, 0, 2, 0, 0, 1,
-0, 0, 0, -1, -1, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, -1,
-0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 4,
-3, 3, 2, -1, -1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0,
-0, -2, -1, -1, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, -1, 0,
-0, 0, 1, 1, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 6, 3, 3, 2,
-0, -1, -1, 0, 1, 1, 1, 2, 1, 1, 2, 0, 0, -1, -1, -2,
--1, 0, 0, 0, 1, 1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 1,
-1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
--1, 0, 0, -1, 0, 0, 0, 0, 1, 5, 5, 4, 3, 1, 0, 0,
-1, 2, 2, 2, 2, 2, 1, 2, 2, 1, 0, 0, -1, -2, -1, 0,
-0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1,
-0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 1, 4, 6, 5, 4, 3, 2, 1, 1, 2, 2,
-2, 2, 3, 2, 2, 2, 2, 1, 0, -1, -1, -1, -1, 0, 0, -1,
--1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1,
-1, 1, 1, 3, 7, 7, 5, 4, 3, 2, 2, 3, 3, 3, 2, 2,
-3, 2, 2, 2, 2, 1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1,
--2, -2, -2, -2, -2, -3, -3, -2, -2, -2, -2, -1, -1, -1, -2, -1,
--1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-3, 6, 7, 7, 5, 4, 3, 3, 3, 4, 4, 3, 3, 3, 3, 2,
-2, 3, 2, 1, -1, -1, -1, -2, -1, -1, -1, -2, -2, -2, -2, -2,
--3, -2, -3, -3, -3, -3, -2, -2, -2, -1, -1, -2, -1, -1, -1, -1,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 7, 7,
-7, 6, 5, 4, 3, 3, 4, 4, 3, 3, 3, 3, 2, 3, 2, 2,
-1, 0, -1, -1, -2, -2, -1, -2, -2, -2, -2, -2, -3, -3, -3, -3,
--3, -3, -3, -3, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0,
-0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 5, 8, 8, 8, 7, 5,
-5, 4, 4, 5, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 1, 0,
-0, 0, -1, -1, -1, -1, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -1, -1, -1, 0,
-0, 0, 0, 0, 0, 1, 2, 5, 8, 8, 8, 8, 7, 6, 5, 6,
-6, 6, 7, 7, 7, 7, 7, 6, 6, 5, 4, 3, 3, 2, 2, 2,
-1, 1, 1, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -1,
--1, -1, -1, 2, 5, 7, 8, 9, 9, 8, 7, 6, 6, 5, 6, 6,
-7, 7, 7, 7, 7, 6, 6, 5, 4, 3, 3, 2, 2, 1, 1, 1,
-1, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -3, -3, -3, -4, -3,
--3, -4, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -1, -1, 0,
-2, 5, 7, 9, 10, 10, 9, 9, 8, 7, 7, 7, 7, 7, 8, 8,
-8, 8, 7, 7, 6, 5, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0,
--1, -2, -2, -3, -3, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
--4, -4, -4, -3, -3, -3, -3, -2, -2, -2, -2, -1, 2, 5, 7, 10,
-11, 11, 11, 10, 9, 8, 8, 7, 8, 8, 9, 9, 9, 9, 8, 8,
-7, 6, 4, 4, 3, 2, 2, 1, 1, 0, 0, -1, -1, -2, -2, -3,
--3, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4,
--3, -3, -3, -2, -2, -2, -1, 0, 3, 6, 8, 11, 13, 14, 13, 12,
-11, 10, 9, 9, 9, 9, 10, 10, 10, 10, 9, 8, 7, 6, 5, 4,
-3, 2, 1, 1, 0, 0, -1, -1, -2, -3, -3, -4, -4, -5, -5, -5,
--5, -5, -5, -5, -5, -5, -5, -5, -4, -4, -4, -3, -3, -3, -2, -2,
--2, -1, -1, 0, 4, 7, 10, 13, 16, 17, 17, 17, 15, 14, 12, 11,
-10, 10, 11, 11, 11, 11, 10, 9, 8, 6, 5, 4, 2, 1, 0, 0,
--1, -2, -2, -3, -4, -4, -5, -5, -5, -6, -6, -6, -6, -7, -6, -6,
--6, -6, -5, -5, -4, -4, -4, -3, -2, -2, -1, -1, -1, 0, 0, 2,
-6, 10, 14, 20, 23, 26, 26, 25, 23, 20, 16, 14, 12, 11, 10, 11,
-11, 11, 10, 10, 8, 6, 4, 2, 0, -1, -3, -4, -5, -6, -7, -7,
--8, -8, -9, -9, -9, -9, -8, -8, -8, -7, -6, -6, -6, -5, -5, -4,
--3, -3, -2, -1, 0, 1, 1, 2, 3, 3, 3, 5, 10, 15, 21, 28,
-33, 36, 37, 35, 31, 26, 20, 14, 10, 7, 6, 6, 7, 7, 7, 7,
-5, 3, 0, -2, -5, -7, -9, -11, -12, -13, -14, -14, -15, -15, -15, -15,
--13, -12, -10, -8, -6, -5, -4, -3, -2, -2, -2, -1, 0, 2, 3, 5,
-6, 7, 8, 8, 8, 8, 8, 9, 15, 21, 28, 36, 43, 46, 45, 41,
-34, 26, 15, 7, 2, -2, -4, -2, -1, 0, 1, 0, -2, -4, -8, -10,
--13, -15, -16, -18, -19, -19, -20, -20, -20, -18, -16, -13, -9, -6, -3, 0,
-1, 2, 2, 1, 1, 1, 2, 3, 5, 6, 8, 9, 10, 11, 10, 10,
-10, 8, 7, 9, 15, 22, 30, 40, 47, 49, 47, 41, 32, 21, 10, 1,
--5, -8, -8, -5, -3, -1, 0, 0, -2, -5, -8, -10, -11, -12, -13, -13,
--13, -14, -14, -14, -14, -12, -10, -7, -3, -1, 1, 3, 3, 2, 2, 1,
-0, 1, 1, 2, 4, 5, 6, 7, 6, 7, 6, 5, 5, 4, 3, 4,
-7, 16, 26, 37, 48, 55, 56, 51, 42, 29, 15, 3, -5, -9, -9, -6,
--2, 3, 4, 4, 3, -2, -5, -9, -11, -13, -13, -14, -13, -14, -15, -15,
--15, -14, -12, -9, -6, -2, 0, 2, 3, 2, 1, 0, -1, -1, -1, 1,
-2, 4, 6, 7, 7, 8, 6, 5, 5, 4, 3, 3, 4, 11, 21, 30,
-42, 53, 57, 56, 49, 37, 25, 10, -2, -7, -9, -8, -3, 2, 6, 9,
-7, 5, 0, -5, -9, -12, -14, -15, -15, -15, -14, -14, -14, -13, -13, -11,
--8, -5, -2, 1, 2, 2, 2, 0, -1, -2, -3, -1, 0, 2, 5, 6,
-7, 9, 7, 6, 6, 4, 3, 3, 2, 2, 8, 16, 27, 38, 49, 57,
-59, 53, 44, 32, 16, 2, -6, -11, -11, -8, -2, 4, 9, 9, 9, 6,
-0, -5, -10, -14, -16, -17, -18, -16, -16, -15, -14, -12, -10, -8, -5, -3,
-0, 2, 1, 1, 0, -2, -3, -3, -3, -1, 1, 3, 6, 7, 8, 9,
-8, 6, 6, 4, 2, 2, 1, 4, 13, 23, 33, 46, 54, 56, 53, 43,
-30, 17, 3, -8, -11, -13, -9, -3, 3, 9, 12, 10, 8, 4, -3, -8,
--12, -16, -17, -19, -18, -16, -15, -14, -11, -9, -6, -3, -1, 0, 1, 0,
-0, -2, -3, -4, -5, -4, -2, 0, 3, 6, 7, 9, 9, 8, 6, 4,
-2, 1, 0, -1, -1, 3, 12, 23, 33, 45, 53, 55, 52, 41, 28, 16,
-1, -9, -12, -13, -8, -2, 4, 11, 14, 13, 11, 7, 0, -6, -12, -16,
--18, -20, -20, -18, -16, -13, -10, -6, -3, 0, 1, 1, 1, -1, -3, -5,
--6, -7, -7, -5, -3, -1, 2, 3, 5, 6, 6, 6, 5, 4, 3, 2,
-0, 0, 1, 0, 1, 10, 20, 31, 43, 51, 54, 52, 42, 29, 17, 3,
--6, -10, -11, -6, 1, 6, 12, 16, 15, 12, 7, 1, -5, -11, -16, -18,
--19, -19, -19, -15, -12, -9, -5, -2, -1, 0, 0, -1, -2, -4, -6, -6,
--7, -6, -4, -2, 2, 5, 7, 8, 9, 8, 7, 5, 3, 2, 1, 0,
-0, 1, 2, 3, 4, 11, 23, 33, 43, 51, 52, 48, 37, 23, 10, -1,
--9, -11, -8, -3, 6, 11, 15, 18, 15, 9, 4, -3, -9, -13, -18, -19,
--18, -18, -15, -12, -9, -5, -2, -2, 0, -1, -4, -5, -7, -10, -10, -9,
--8, -5, -1, 2, 5, 7, 7, 8, 7, 5, 3, 2, 1, 0, 1, 1,
-2, 3, 4, 5, 5, 6, 15, 26, 35, 44, 50, 48, 42, 30, 15, 5,
--3, -9, -6, -1, 4, 13, 16, 16, 16, 11, 3, -2, -8, -13, -14, -17,
--17, -14, -13, -11, -7, -7, -5, -2, -4, -4, -4, -7, -8, -8, -10, -9,
--6, -5, -2, 2, 3, 5, 6, 5, 4, 4, 2, 1, 2, 0, 2, 3,
-2, 4, 5, 4, 5, 5, 3, 8, 20, 31, 40, 49, 49, 45, 35, 20,
-6, -2, -8, -8, -3, 2, 10, 15, 14, 14, 10, 2, -2, -8, -13, -14,
--14, -16, -14, -13, -12, -9, -8, -7, -4, -3, -4, -4, -6, -8, -8, -9,
--9, -6, -4, -2, 2, 3, 5, 6, 4, 4, 4, 2, 2, 2, 2, 2,
-3, 4, 4, 5, 5, 5, 4, 4, 4, 8, 20, 33, 42, 48, 48, 40,
-30, 17, 5, -1, -2, 1, 6, 10, 13, 16, 14, 10, 6, 2, -2, -5,
--9, -11, -12, -14, -15, -14, -13, -11, -8, -7, -6, -5, -5, -7, -9, -10,
--10, -10, -9, -6, -4, -1, 1, 2, 3, 4, 4, 3, 3, 3, 2, 3,
-3, 4, 5, 5, 6, 6, 6, 5, 6, 5, 4, 3, 3, 10, 24, 35,
-43, 45, 40, 32, 22, 10, 2, 1, 1, 4, 7, 8, 10, 11, 9, 7,
-4, 1, -1, -5, -9, -12, -14, -15, -15, -14, -12, -9, -7, -6, -5, -6,
--6, -7, -9, -10, -9, -8, -8, -7, -6, -4, -2, 0, 2, 3, 4, 4,
-4, 2, 2, 3, 2, 3, 3, 4, 5, 6, 6, 5, 6, 5, 5, 4,
-3, 8, 21, 33, 41, 43, 38, 31, 22, 13, 6, 4, 5, 7, 8, 7,
-7, 8, 9, 8, 6, 3, 1, -1, -6, -11, -14, -15, -14, -14, -14, -12,
--10, -8, -8, -8, -8, -8, -9, -9, -10, -9, -7, -6, -4, -2, -1, 1,
-3, 3, 4, 4, 4, 4, 4, 3, 4, 5, 5, 6, 6, 6, 7, 7,
-6, 5, 5, 4, 3, 3, 11, 25, 36, 42, 40, 31, 24, 17, 10, 7,
-6, 5, 8, 6, 4, 7, 9, 13, 14, 10, 4, 0, -6, -9, -12, -15,
--14, -13, -13, -12, -11, -9, -5, -4, -5, -6, -9, -10, -9, -10, -10, -8,
--7, -5, -2, -1, 1, 3, 4, 5, 4, 3, 3, 3, 3, 3, 4, 4,
-5, 6, 6, 7, 7, 7, 6, 5, 4, 3, 2, 6, 16, 28, 37, 37,
-30, 23, 19, 18, 18, 14, 9, 4, 1, 0, 2, 5, 9, 10, 8, 3,
--2, -4, -5, -6, -9, -13, -17, -18, -16, -13, -11, -9, -8, -7, -8, -8,
--8, -7, -7, -7, -9, -9, -8, -5, -2, 0, 2, 3, 4, 5, 6, 6,
-6, 6, 6, 5, 5, 6, 6, 7, 8, 7, 7, 7, 7, 7, 6, 5,
-3, 2, 5, 15, 26, 33, 32, 24, 18, 18, 19, 19, 14, 6, 1, -2,
--1, 2, 5, 6, 6, 4, 1, -1, -2, -2, -4, -9, -14, -17, -17, -14,
--11, -11, -11, -10, -10, -7, -5, -5, -5, -6, -7, -8, -7, -6, -3, -2,
--1, 0, 1, 3, 6, 8, 7, 6, 6, 5, 6, 7, 6, 5, 5, 5,
-6, 6, 7, 7, 6, 6, 5, 3, 3, 3, 8, 18, 27, 30, 27, 20,
-19, 21, 23, 20, 12, 4, 0, 2, 4, 6, 6, 4, 3, 3, 3, 2,
-0, -2, -7, -12, -15, -16, -14, -13, -13, -14, -14, -12, -8, -5, -5, -8,
--9, -9, -8, -6, -6, -7, -6, -5, -3, 0, 2, 4, 5, 5, 6, 5,
-6, 7, 6, 6, 5, 4, 5, 6, 7, 7, 6, 6, 6, 6, 6, 6,
-3, 2, 5, 14, 25, 29, 28, 22, 20, 25, 28, 26, 18, 7, 3, 6,
-9, 9, 6, 2, 2, 4, 6, 5, 3, -1, -4, -7, -9, -11, -10, -11,
--11, -13, -14, -12, -8, -6, -6, -8, -10, -8, -6, -5, -5, -7, -8, -6,
--3, -1, 0, 0, 1, 2, 4, 4, 4, 5, 4, 4, 4, 4, 4, 5,
-4, 4, 3, 3, 4, 4, 4, 3, 1, 1, 3, 10, 19, 23, 23, 21,
-20, 25, 29, 27, 20, 13, 10, 12, 14, 14, 10, 6, 6, 8, 10, 9,
-5, 1, -1, -3, -4, -5, -7, -8, -9, -10, -10, -9, -7, -6, -7, -8,
--9, -8, -6, -6, -6, -8, -8, -5, -3, -1, -1, -3, -1, 0, 2, 3,
-2, 1, 1, 2, 3, 3, 3, 3, 2, 3, 3, 4, 4, 3, 2, 2,
-1, 2, 2, 1, 3, 11, 18, 21, 22, 22, 23, 28, 30, 28, 23, 18,
-17, 19, 20, 19, 15, 13, 13, 14, 15, 12, 8, 5, 3, 3, 2, -1,
--3, -4, -4, -4, -4, -3, -3, -4, -4, -5, -5, -4, -4, -4, -5, -4,
--3, -1, 0, 0, 0, 0, 1, 3, 3, 2, 2, 2, 2, 3, 3, 3,
-3, 3, 3, 3, 4, 3, 2, 2, 1, 2, 2, 1, 0, 0, 1, 8,
-15, 18, 19, 21, 25, 28, 28, 26, 21, 20, 22, 23, 24, 21, 19, 19,
-19, 20, 19, 15, 11, 7, 6, 5, 3, 1, -2, -4, -3, -3, -2, -3,
--5, -6, -6, -5, -4, -5, -6, -6, -5, -3, -1, 0, 1, 1, 2, 4,
-5, 6, 5, 5, 5, 6, 7, 8, 7, 7, 6, 7, 8, 7, 5, 4,
-3, 3, 3, 2, 1, 0, -1, -1, 1, 6, 10, 12, 14, 16, 20, 24,
-24, 24, 23, 23, 24, 25, 25, 24, 23, 23, 23, 23, 22, 20, 17, 15,
-13, 11, 8, 5, 3, 1, 0, 0, -1, -3, -4, -5, -5, -5, -6, -6,
--7, -7, -6, -5, -4, -3, -3, -1, 0, 2, 3, 3, 4, 5, 6, 7,
-7, 7, 7, 7, 9, 8, 8, 8, 7, 7, 6, 5, 5, 3, 2, 2,
-1, 1, 1, 3, 8, 10, 13, 15, 18, 22, 23, 24, 24, 23, 24, 24,
-24, 24, 23, 23, 23, 22, 22, 20, 18, 16, 14, 12, 10, 7, 5, 3,
-2, 1, 0, -1, -3, -4, -4, -4, -5, -5, -6, -5, -5, -4, -3, -2,
--1, 0, 1, 3, 4, 5, 5, 6, 7, 7, 8, 8, 8, 9, 9, 9,
-9, 8, 7, 7, 6, 6, 5, 4, 2, 2, 1, 0, -1, -1, 2, 5,
-9, 12, 16, 20, 24, 27, 30, 31, 31, 31, 32, 32, 33, 32, 32, 31,
-31, 30, 28, 26, 22, 19, 16, 13, 10, 6, 2, 1, -2, -4, -5, -8,
--9, -10, -11, -11, -13, -13, -13, -13, -11, -10, -9, -7, -6, -3, -1, 0,
-2, 3, 5, 7, 8, 9, 10, 11, 12, 13, 14, 14, 14, 13, 13, 12,
-11, 10, 9, 8, 6, 5, 4, 2, 2, 3, 6, 8, 10, 13, 16, 18,
-20, 22, 23, 23, 23, 24, 24, 25, 24, 24, 24, 24, 24, 22, 20, 18,
-16, 13, 11, 9, 6, 4, 2, 1, -1, -3, -4, -6, -7, -7, -9, -10,
--10, -11, -10, -10, -10, -9, -8, -7, -6, -5, -3, -3, -2, 0, 0, 2,
-3, 3, 5, 5, 6, 7, 7, 8, 7, 7, 7, 7, 7, 6, 5, 5,
-4, 3, 3, 2, 4, 7, 9, 11, 14, 17, 21, 23, 24, 26, 25, 26,
-26, 26, 27, 26, 26, 26, 25, 25, 23, 20, 19, 16, 13, 11, 8, 5,
-2, 0, -1, -3, -4, -6, -8, -9, -10, -11, -12, -13, -12, -12, -12, -11,
--10, -9, -8, -7, -5, -4, -3, -2, 0, 1, 2, 3, 5, 5, 6, 8,
-8, 8, 9, 8, 9, 9, 8, 8, 7, 7, 6, 5, 5, 4, 3, 4,
-6, 8, 10, 12, 15, 17, 19, 21, 22, 22, 23, 23, 24, 25, 24, 24,
-24, 24, 23, 22, 21, 19, 17, 15, 13, 10, 8, 6, 4, 2, 0, -1,
--4, -5, -6, -8, -9, -10, -11, -11, -12, -11, -11, -11, -10, -10, -9, -8,
--7, -6, -5, -4, -2, -1, 0, 1, 1, 2, 3, 4, 5, 5, 5, 6,
-6, 6, 6, 6, 6, 6, 5, 5, 4, 4, 5, 7, 8, 10, 12, 14,
-17, 19, 20, 21, 22, 23, 24, 24, 24, 24, 23, 23, 22, 22, 20, 19,
-17, 15, 14, 12, 9, 7, 5, 3, 1, -1, -2, -4, -6, -6, -8, -9,
--9, -10, -11, -11, -11, -11, -11, -10, -10, -9, -8, -7, -6, -5, -4, -3,
--2, -1, -1, 0, 1, 2, 3, 4, 4, 4, 5, 5, 6, 6, 6, 6,
-5, 5, 5, 5, 4, 5, 7, 8, 10, 12, 13, 16, 18, 20, 21, 22,
-23, 24, 25, 25, 24, 24, 23, 22, 21, 19, 18, 16, 14, 12, 10, 7,
-5, 3, 1, -1, -3, -4, -6, -8, -9, -10, -11, -12, -12, -12, -12, -12,
--12, -12, -12, -11, -10, -9, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0,
-1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-5, 7, 8, 9, 10, 12, 14, 16, 18, 19, 20, 22, 23, 24, 25, 25,
-25, 25, 25, 24, 23, 22, 21, 19, 18, 16, 14, 12, 10, 8, 6, 4,
-2, 0, -1, -3, -4, -6, -7, -8, -9, -10, -10, -11, -11, -11, -11, -10,
--10, -10, -10, -9, -8, -8, -7, -7, -6, -5, -4, -3, -3, -2, -1, 0,
-0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 6, 7, 8,
-10, 11, 13, 14, 16, 17, 18, 19, 20, 21, 21, 21, 21, 21, 21, 21,
-20, 19, 18, 17, 16, 15, 14, 12, 11, 9, 8, 6, 5, 3, 2, 0,
--1, -2, -3, -4, -5, -6, -6, -7, -7, -8, -8, -8, -8, -7, -7, -7,
--6, -6, -5, -4, -4, -3, -2, -2, -1, 0, 1, 1, 2, 3, 3, 4,
-4, 4, 5, 5, 5, 5, 5, 5, 7, 8, 8, 9, 10, 11, 13, 14,
-15, 15, 16, 16, 17, 17, 17, 17, 17, 18, 18, 17, 17, 16, 16, 15,
-15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 5, 4, 3, 2, 1,
-1, 0, 0, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1,
-0, 0, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 6, 6,
-6, 6, 6, 6, 7, 8, 8, 9, 9, 10, 11, 11, 12, 12, 12, 12,
-12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 10, 10, 9, 9, 8,
-7, 7, 6, 6, 5, 4, 4, 4, 3, 3, 2, 2, 2, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3,
-3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
-5, 6, 6, 6, 7, 7, 8, 8, 9, 9, 8, 9, 9, 9, 9, 9,
-9, 9, 10, 10, 9, 9, 9, 9, 9, 8, 8, 8, 7, 7, 7, 6,
-6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3,
-3, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 5, 6,
-6, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1, 1, 2, 2, 2,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 2, 2, 3, 2, 2, 2, 2, 2, 2,
-2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0
-};
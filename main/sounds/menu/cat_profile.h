@@ -1,341 +0,0 @@
-// TTS sound: cat_profile
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_cat_profileSampleRate = 11025;
-const unsigned int menu_cat_profileSampleCount = 5336;
-const signed char menu_cat_profileSamples[] = {
--1, 0, 0, 0, -2, -3, -3, -2, 1, 0, 0, -1, -3, -1, 1, 1,
-2, -2, -1, -1, 1, 1, 1, -1, -1, -2, -1, -1, 1, -1, -2, -1,
--1, 1, -1, -1, -1, 1, 0, -1, -2, -1, -1, 0, 1, 1, 0, 0,
-0, 0, 1, 2, 0, -2, -1, 0, 0, 1, 1, -1, -2, -1, -1, -1,
-0, 1, 2, 0, -1, 0, 0, 1, 1, 1, -1, -3, -1, 2, 2, 0,
-0, 0, -2, 0, 2, 2, 3, 0, 0, 0, -2, -1, 2, 1, 0, 1,
-1, -1, -1, 0, 1, 1, 2, 1, -2, -4, -1, 3, 3, 0, 1, -2,
--3, 0, 2, 4, 3, 0, -1, -2, -3, 0, 3, 2, 0, 1, -1, -2,
--1, 1, 3, 2, 2, -1, -5, -5, 1, 2, 3, 3, -2, -4, -3, -1,
-3, 2, 1, -2, -3, -2, -1, 2, 3, 1, 0, 1, -2, 0, 2, 3,
-2, -1, -3, 0, 1, 0, -1, -2, -1, -1, 2, 2, 1, 0, -1, -1,
-0, 3, 1, -2, 1, 3, 1, 2, 1, -2, -3, 1, 3, 2, 0, -1,
--1, 0, 3, 3, 1, -1, 0, -1, -1, -3, -1, 1, 1, 2, 1, 2,
-1, -4, -4, -1, 1, 5, 5, -1, -4, -3, -1, 4, 6, 4, -1, -4,
--4, 1, 2, 4, 3, -1, -4, -4, -3, 1, 8, 8, -1, -5, -6, -4,
-1, 4, 7, 1, -5, -6, -4, -3, 5, 7, 5, -2, -7, -7, -6, 0,
-7, 7, 6, -3, -9, -6, -1, 5, 9, 6, -3, -10, -8, -2, 6, 10,
-6, -1, -6, -7, -3, 3, 8, 6, -2, -5, -3, -1, 3, 6, 3, -3,
--4, -2, -1, 2, 3, 2, 1, 0, 0, 0, -1, 2, 2, 1, -3, -4,
--3, 0, 3, 4, 4, 2, -4, -7, -4, 0, 5, 8, 2, -5, -5, -4,
-0, 6, 8, 3, -5, -7, -5, 2, 8, 8, 4, -2, -8, -6, 0, 5,
-7, 4, -2, -5, -4, 1, 5, 6, 3, 0, -4, -5, -5, 0, 4, 4,
-2, -1, -1, -2, -3, -1, 1, 2, 4, 2, -3, -4, -1, 0, 4, 5,
-3, -3, -6, -5, -1, 4, 5, 1, -4, -6, -3, 1, 6, 6, 1, -3,
--5, -1, 1, 1, 2, 0, -1, -1, -1, -2, 0, 3, 4, 2, -1, -5,
--4, 1, 4, 3, 0, -3, -6, -4, 1, 3, 5, 1, -2, -4, -3, 2,
-5, 5, 2, -1, -1, 1, 2, 2, 1, 0, -1, 0, 0, -1, -1, 0,
-1, 2, 0, -1, 1, 2, 3, 2, 0, 0, 0, 1, 1, 2, 1, 0,
-0, 1, 6, 9, 8, 5, 2, 2, 3, 5, 6, 5, 3, 1, 1, 1,
-2, 3, 2, 1, -1, -2, -2, -2, -1, 0, -2, -2, -3, -4, -3, -2,
--2, -2, -3, -3, -3, -3, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 11,
-17, 21, 21, 17, 15, 14, 16, 16, 14, 11, 8, 6, 4, 4, 4, 4,
-4, 2, 0, -2, -3, -3, -3, -4, -6, -7, -9, -9, -9, -8, -8, -8,
--8, -8, -6, -4, -1, 1, 3, 2, 2, 2, 3, 4, 5, 5, 4, 4,
-4, 4, 3, 4, 4, 5, 5, 4, 3, 2, 3, 9, 20, 33, 42, 42,
-38, 32, 29, 30, 30, 27, 21, 13, 7, 2, 0, -2, -1, -1, -1, -4,
--8, -11, -12, -11, -9, -10, -13, -16, -19, -18, -15, -14, -12, -10, -9, -8,
--6, -5, -2, 1, 3, 4, 4, 4, 4, 6, 7, 8, 8, 8, 7, 7,
-8, 7, 7, 7, 6, 6, 4, 3, 7, 21, 39, 55, 59, 50, 39, 31,
-30, 32, 29, 22, 12, 2, -6, -11, -14, -12, -9, -7, -8, -13, -17, -18,
--16, -14, -15, -17, -20, -20, -20, -19, -16, -14, -9, -5, -3, -2, 0, 3,
-7, 9, 10, 9, 9, 9, 9, 9, 9, 8, 9, 8, 8, 7, 6, 6,
-6, 5, 3, 2, 0, 2, 14, 34, 53, 61, 54, 42, 32, 28, 28, 25,
-19, 10, 1, -9, -16, -20, -17, -11, -8, -11, -16, -20, -18, -15, -12, -12,
--13, -14, -14, -16, -16, -14, -8, -3, -1, 0, -1, 1, 6, 8, 9, 10,
-9, 10, 8, 6, 6, 5, 7, 7, 5, 4, 3, 2, 4, 3, 1, 2,
-0, 0, -1, 8, 30, 52, 64, 62, 47, 36, 31, 28, 26, 18, 9, 2,
--11, -21, -24, -20, -7, 1, 0, -3, -9, -9, -5, -6, -5, -6, -10, -12,
--18, -21, -17, -10, -3, 0, -1, 0, 2, 4, 7, 8, 8, 9, 6, 3,
-0, -1, 1, 3, 4, 3, 2, 2, 3, 3, 4, 3, 3, 4, 0, -3,
-0, 17, 43, 63, 69, 47, 35, 25, 19, 14, 10, 6, -3, -16, -26, -27,
--17, -5, 2, 4, 1, -2, -5, -7, -7, -6, -4, -6, -13, -20, -20, -16,
--8, -3, 1, 4, 5, 4, 5, 4, 7, 10, 8, 5, 0, -3, -2, -1,
-0, 3, 3, 3, 4, 0, 2, 4, 4, 5, 2, -1, -2, 5, 27, 50,
-63, 66, 56, 44, 34, 23, 17, 15, 9, 3, -10, -23, -25, -21, -11, -2,
-1, 4, 3, -3, -6, -8, -7, -4, -7, -12, -17, -20, -18, -14, -9, -3,
-3, 5, 6, 4, 4, 8, 8, 8, 6, 2, 0, -2, -4, -2, 0, 2,
-5, 3, 2, 3, 3, 3, 3, 2, 3, 0, -4, 4, 23, 45, 60, 62,
-55, 46, 34, 22, 15, 11, 9, 3, -10, -20, -23, -21, -13, -6, 1, 6,
-5, 0, -6, -9, -8, -6, -9, -12, -15, -17, -18, -16, -11, -3, 4, 7,
-7, 6, 6, 7, 6, 6, 6, 4, 2, -2, -4, -2, 0, 3, 6, 7,
-7, 6, 4, 3, 3, 3, 2, 0, -2, -3, 7, 28, 45, 57, 60, 54,
-45, 31, 18, 13, 9, 5, -1, -12, -17, -20, -21, -14, -7, 2, 7, 4,
-1, -4, -8, -9, -11, -11, -9, -14, -16, -16, -15, -9, -4, 1, 8, 8,
-9, 8, 6, 8, 8, 8, 9, 6, 5, 2, -1, 0, 1, 3, 5, 5,
-5, 3, 1, 1, 0, 1, 0, -2, 1, 13, 30, 43, 52, 55, 52, 41,
-27, 16, 11, 7, 2, -3, -8, -12, -17, -18, -14, -6, 0, 4, 3, 1,
--2, -9, -11, -12, -12, -11, -12, -14, -12, -12, -10, -5, 0, 5, 7, 8,
-8, 6, 4, 3, 3, 3, 3, 2, 2, 1, 1, 1, 1, 4, 4, 5,
-5, 3, 3, 1, -1, 0, -2, -2, 7, 22, 36, 46, 52, 53, 46, 33,
-23, 15, 10, 5, 1, -3, -7, -13, -15, -14, -11, -5, -2, 1, 2, -1,
--6, -11, -14, -15, -15, -14, -12, -12, -11, -10, -8, -5, -1, 3, 5, 8,
-7, 6, 5, 3, 2, 3, 3, 4, 4, 4, 4, 2, 3, 3, 4, 5,
-5, 4, 3, 1, 0, -1, -3, 2, 14, 27, 39, 47, 51, 49, 38, 27,
-20, 12, 8, 4, 1, -1, -7, -12, -13, -15, -12, -8, -5, -1, -1, -4,
--7, -12, -15, -16, -16, -12, -11, -9, -7, -7, -6, -5, -3, 0, 3, 6,
-7, 7, 6, 4, 3, 3, 3, 4, 5, 6, 6, 5, 4, 3, 3, 2,
-3, 3, 3, 2, 1, -1, -2, -1, 10, 21, 31, 42, 47, 47, 40, 30,
-22, 12, 6, 6, 5, 6, 4, 1, -1, -7, -10, -10, -10, -7, -5, -4,
--4, -9, -12, -15, -18, -18, -16, -13, -9, -7, -4, -4, -5, -4, -4, -2,
-1, 3, 6, 7, 6, 6, 5, 4, 3, 4, 6, 7, 7, 8, 7, 5,
-4, 3, 2, 2, 2, 2, 2, 3, 7, 13, 18, 24, 29, 31, 30, 26,
-22, 16, 10, 8, 5, 4, 3, 2, 2, -1, -3, -5, -6, -8, -7, -7,
--6, -6, -7, -8, -10, -12, -12, -12, -12, -10, -8, -6, -5, -4, -3, -3,
--2, -2, 0, 1, 2, 4, 5, 5, 5, 5, 4, 4, 4, 5, 6, 6,
-7, 7, 6, 6, 5, 4, 3, 4, 9, 12, 17, 22, 25, 26, 24, 22,
-19, 14, 11, 10, 8, 8, 7, 6, 5, 1, 0, -2, -5, -6, -6, -5,
--5, -5, -5, -6, -8, -9, -10, -11, -11, -11, -9, -8, -7, -6, -5, -6,
--5, -5, -4, -4, -3, -1, -1, 0, 0, 1, 1, 1, 2, 3, 3, 4,
-4, 4, 4, 4, 4, 5, 4, 4, 7, 10, 11, 13, 15, 14, 14, 14,
-13, 12, 11, 11, 10, 10, 8, 7, 6, 5, 4, 3, 2, 2, 1, 0,
--1, -2, -2, -3, -4, -4, -4, -5, -5, -5, -6, -6, -6, -6, -6, -6,
--6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -3, -2, -2, -2, -1, -1,
--1, 0, 0, 1, 1, 1, 2, 1, 2, 6, 7, 6, 7, 8, 7, 8,
-8, 9, 8, 8, 9, 8, 8, 8, 7, 7, 6, 6, 5, 5, 4, 4,
-3, 2, 2, 1, 1, 0, 0, -1, -1, -2, -2, -3, -2, -3, -3, -3,
--4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -4, -3,
--2, -3, -2, -1, -2, -2, -1, -1, -1, 1, 5, 3, 1, 3, 3, 3,
-5, 5, 5, 4, 5, 5, 5, 4, 4, 6, 6, 3, 5, 5, 4, 3,
-6, 4, 1, 2, 3, 2, 2, 2, 2, -1, -1, 0, -1, 0, 0, -3,
--4, -2, -2, -1, -2, -2, -5, -3, -3, -4, -3, -4, -3, -3, -3, -4,
--3, -3, -2, -2, -2, -4, -2, -1, 1, -1, -1, -1, -1, 1, 1, 0,
-0, 2, 2, 2, 2, 2, 1, 4, 2, 3, 0, 3, 2, 2, 2, 2,
-3, 3, -1, 1, 1, 0, 2, 2, -2, -1, 2, -2, 0, 0, 0, -3,
--1, -1, -2, -1, 0, -3, -1, -3, 0, -2, 0, -1, -1, -3, 2, 0,
--2, -1, 0, 0, -1, 0, 0, -1, 1, 1, 0, 2, 1, 1, -1, 1,
-2, 3, 2, -1, 2, 2, 2, 1, 0, 1, 2, -1, 2, 0, 1, 0,
-1, -1, 0, 1, -1, -1, 2, 0, -1, 0, -1, 0, -2, 0, 0, 1,
--2, -1, 1, -1, 1, 2, 0, -1, 1, 2, 1, 0, 1, 1, 0, 1,
-2, -1, 1, -1, 2, 0, 0, 1, 0, 1, 0, -2, 1, -1, 0, 2,
--1, -2, 0, 2, -3, 1, 1, 0, -2, 0, 0, 0, 1, 0, -2, 0,
--1, 2, -1, 1, 0, -1, 0, 2, 0, -2, 1, 0, 0, -1, 1, -1,
--2, 2, 0, -2, -1, 0, 0, -1, 1, 1, -2, 0, -1, 0, 0, -1,
-0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1,
-1, 0, 0, 0, 2, 0, 0, 1, -1, 1, 1, 1, -2, -1, 1, 1,
-1, 1, -2, 2, 0, 1, 0, -1, 1, 0, 0, 1, 0, 0, 1, -1,
-1, -1, 0, 1, 0, 0, 1, -1, 1, -1, 0, 1, -1, 1, 0, 0,
-1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 1, 1, 0, -1, 1, 0,
-0, 1, 1, -1, 0, 1, 0, 0, 1, 0, 0, -2, 3, 0, -1, 0,
-0, 1, 0, 1, 0, -2, 1, 0, -1, 1, -1, -1, 0, -1, 1, 0,
--1, 0, 0, 0, 0, 0, 1, -2, 0, 1, 0, 0, 1, 0, 0, 0,
-0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, -2, 1, -1,
-0, 0, 0, 1, -1, -1, 1, -1, -1, 1, 0, -1, -1, 0, 0, -1,
-0, 1, -1, 0, 0, 0, -1, -1, 0, 1, -1, 0, 1, -1, -1, 0,
-0, 0, 0, 1, -1, 1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 1, 0, 0, -1, 2, 1, 1, 0, -1, 1, -1, 2, 0, -1,
-0, -1, 0, 0, 1, -1, -1, -1, 0, 0, 1, -1, -1, -1, 0, -1,
-0, 0, 0, 1, -1, 1, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0,
--1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 1, -1, 0,
-1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1,
--1, 1, 0, -1, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0,
-1, -2, 1, 1, 1, 0, -1, 1, -1, 1, 1, -1, -1, 0, 0, 1,
-0, 0, -1, 0, 0, -1, 1, 0, 0, -1, 1, -1, 1, 0, 0, -1,
-0, 1, 0, 0, 0, 1, -1, 1, 0, 0, 1, 0, 0, 1, -1, 1,
--1, 0, 1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0,
--1, 1, 1, 0, -1, 1, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0,
-0, 0, -2, 2, 0, 0, 0, -1, 1, 0, 1, 1, -1, 0, 0, -1,
-1, 0, 1, 0, -1, 1, 0, 1, 0, -2, 0, -1, 0, 1, 0, -1,
-0, 0, 0, -1, 1, 0, -1, 1, 1, 0, 0, 1, 0, 0, 0, 0,
-1, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, 0, 1, 1, 0,
--1, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 1, -1, 0,
-1, 1, 0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 1, 0,
-0, 0, -1, -1, 0, 0, 1, 0, 0, 0, -2, 1, 0, 0, 1, -2,
-0, 0, 2, 0, 0, -1, -1, 1, 2, -1, -1, 0, 0, 0, 1, 1,
--2, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0,
-1, 1, 0, 1, -1, 1, -2, 0, 1, 0, 0, -1, 1, -1, 0, 1,
-0, 1, 0, 0, 1, 0, -1, 1, 0, -1, 0, 1, 0, 0, -1, 1,
--1, 0, 1, 0, 1, 1, 0, 1, 0, -1, 0, 0, 0, -1, 1, 1,
-0, 0, 0, 0, 0, 0, 0, -2, -2, 1, -1, 0, 1, -1, 0, 0,
-0, 1, -1, 0, -1, 0, 0, 0, 0, 1, -1, 0, 2, -1, 1, 1,
-1, 0, 0, 1, -1, -1, 1, 0, 1, -1, -1, -1, -1, 1, 1, -1,
--2, -1, 0, 1, 1, 1, -1, -1, 0, -1, 0, -1, 0, 1, 1, 0,
-1, 1, 1, 1, 0, -2, -1, 0, 2, 1, 1, 0, 0, 0, 0, 0,
--1, 0, -1, 0, 0, 1, 1, 0, 1, 0, 0, 0, -1, 0, 1, -1,
--1, 0, 0, 0, -1, 0, -1, -2, 1, 0, 0, -1, -1, 0, 0, 1,
-2, 0, 1, 0, -1, -1, -2, 0, 0, -1, 1, 1, -1, -1, -1, -1,
--2, -1, -1, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1,
-1, 2, 3, 2, 3, 4, 3, 1, 1, 1, 2, 1, 2, 2, 0, 1,
-0, -1, -2, -4, -4, -4, -4, -4, -3, -1, -1, 0, 2, 3, 2, 2,
-2, 1, 0, 1, 1, 2, 2, 3, 4, 4, 5, 5, 6, 6, 4, 3,
-2, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1,
--1, -3, -2, -2, -2, -1, 0, 6, 20, 29, 33, 34, 28, 18, 5, -3,
--4, -7, -7, -2, -1, 0, 1, 3, 6, 4, 3, 1, -4, -9, -12, -13,
--13, -12, -8, -3, -1, 2, 4, 4, 4, 2, 1, 0, -3, -4, -3, -2,
--2, 0, 2, 2, 1, 3, 4, 2, 2, 1, -1, -2, -3, -2, 0, -1,
-0, 2, 1, 1, 1, 1, 2, -1, -2, 8, 31, 54, 65, 68, 60, 33,
-2, -18, -24, -23, -18, -7, 4, 3, 2, 7, 11, 12, 11, 6, -3, -16,
--26, -27, -23, -16, -6, 4, 8, 10, 10, 8, 6, 2, -1, -6, -11, -11,
--9, -5, 2, 8, 11, 12, 9, 6, 2, -2, -4, -4, -5, -6, -4, -1,
-1, 3, 6, 7, 5, 2, -1, -2, -5, -5, -4, 3, 30, 57, 68, 70,
-57, 30, -3, -27, -29, -23, -16, -2, 8, 10, 9, 9, 15, 16, 8, -1,
--13, -25, -31, -27, -14, -1, 7, 15, 16, 9, 4, 0, -2, -6, -11, -10,
--10, -10, -2, 5, 11, 13, 11, 9, 2, -5, -6, -6, -7, -4, -2, 0,
-3, 4, 7, 7, 4, 2, -1, -5, -7, -6, -3, -2, -1, 7, 32, 58,
-66, 65, 52, 20, -13, -32, -32, -18, -8, 9, 23, 19, 16, 16, 13, 7,
--4, -13, -20, -30, -26, -13, -1, 10, 15, 17, 11, 1, -3, -7, -11, -12,
--11, -9, -4, 1, 7, 12, 14, 10, 4, -1, -6, -10, -8, -4, -3, 1,
-4, 6, 6, 6, 5, 2, -2, -5, -6, -6, -5, -2, 3, 5, 6, 6,
-12, 37, 58, 58, 48, 29, 0, -26, -31, -15, 2, 11, 21, 24, 15, 6,
-6, 7, -1, -12, -17, -20, -22, -14, 2, 12, 14, 10, 7, 0, -10, -10,
--7, -9, -8, -6, 0, 3, 5, 11, 11, 5, 0, -5, -7, -8, -6, -1,
-2, 2, 5, 6, 6, 3, 0, -2, -4, -6, -6, -3, 1, 1, 2, 5,
-4, 0, -1, 10, 39, 55, 54, 48, 23, -5, -21, -23, -6, 4, 9, 18,
-15, 9, 11, 10, 8, 0, -14, -17, -21, -19, -6, 4, 11, 10, 6, 4,
--3, -7, -5, -8, -9, -8, -7, 0, 5, 7, 11, 8, 2, 0, -4, -6,
--5, -5, 0, 0, 1, 6, 6, 4, 4, 1, -2, -5, -5, -4, -2, 1,
-2, 3, 3, 3, 2, -1, 1, 22, 49, 55, 51, 37, 11, -10, -20, -12,
-0, 4, 8, 11, 11, 12, 14, 14, 7, -8, -18, -21, -20, -11, -1, 7,
-9, 5, 4, 2, -1, -3, -7, -11, -11, -11, -3, 4, 7, 10, 7, 3,
-1, -3, -3, -4, -6, -3, -3, 1, 5, 6, 7, 4, 1, 0, -5, -3,
--2, -4, -1, 1, 0, 3, 4, 4, 1, -2, 9, 36, 54, 54, 43, 25,
-3, -13, -13, -2, 3, 1, 4, 10, 12, 13, 19, 16, -1, -15, -17, -15,
--13, -7, 2, 4, 2, 4, 9, 7, 1, -4, -9, -12, -13, -6, 2, 4,
-4, 6, 6, 3, 2, 0, -1, -6, -9, -4, -1, 2, 5, 6, 5, 1,
-0, 1, 0, -5, -3, -3, -3, 0, 3, 5, 3, 2, 2, -2, 4, 30,
-53, 57, 48, 33, 16, 1, -5, 0, 0, -6, -5, 4, 15, 21, 21, 19,
-2, -11, -15, -15, -11, -11, -9, -3, 0, 6, 11, 10, 6, -4, -10, -11,
--12, -6, -4, 0, 2, 2, 7, 9, 6, 2, -2, -6, -9, -6, 0, 0,
-1, 4, 5, 4, 4, 3, 1, -4, -4, 0, 0, 1, 4, 4, 2, 2,
-4, 3, -2, 6, 34, 50, 49, 41, 27, 13, 0, -3, 3, -2, -10, -4,
-6, 15, 20, 20, 14, -1, -11, -12, -11, -9, -12, -9, -4, 0, 8, 12,
-10, 3, -8, -8, -8, -9, -6, -4, -2, 0, 2, 11, 9, 4, 1, -5,
--8, -8, -6, -2, -2, -2, 3, 5, 7, 5, 2, 1, -6, -7, -2, -3,
--2, -1, 2, 3, 2, 6, 4, -1, 7, 34, 48, 45, 35, 25, 13, 3,
-3, 7, -2, -10, -4, 7, 15, 18, 18, 12, -3, -8, -6, -7, -10, -12,
--9, -6, 0, 8, 12, 7, -1, -5, -5, -7, -8, -6, -6, -7, -2, 6,
-9, 7, 3, 1, -2, -4, -4, -2, -3, -6, -1, 4, 5, 5, 5, 3,
--1, -3, -1, -1, -4, -3, 0, -1, 1, 3, 6, 2, -2, 1, 18, 41,
-46, 38, 30, 17, 8, 6, 8, 3, -7, -7, 2, 10, 17, 21, 17, 5,
--3, -2, -3, -8, -10, -13, -11, -5, 4, 9, 8, 3, -2, -3, -3, -5,
--6, -8, -10, -5, 1, 5, 7, 5, 2, 1, -2, 1, -2, -4, -5, -5,
-0, 3, 4, 6, 3, 1, 1, 1, 0, -2, -4, -2, -3, -1, 3, 4,
-2, 1, 0, 6, 27, 41, 39, 30, 21, 15, 8, 8, 10, 0, -5, -3,
-6, 14, 17, 16, 10, 1, -2, -2, -2, -6, -12, -11, -7, -2, 5, 8,
-4, -1, -3, -2, -2, -5, -6, -7, -9, -3, 2, 5, 5, 2, 1, 0,
--1, 1, -1, -4, -5, -3, 1, 3, 4, 5, 1, 0, 1, 3, 2, -2,
--2, -1, -2, 0, 4, 3, 1, 0, 1, 3, 21, 39, 39, 32, 25, 17,
-11, 7, 10, 5, -5, -4, 5, 12, 16, 16, 14, 5, -3, 0, -1, -6,
--11, -11, -8, -6, 2, 8, 5, 1, -3, -1, -1, -5, -5, -6, -10, -7,
--1, 5, 3, 1, 2, -1, -3, 0, 0, -3, -7, -5, 0, 0, 3, 5,
-2, 0, -1, 2, 1, -2, -1, -2, -3, -2, 3, 3, 1, 2, 1, 0,
-2, 22, 37, 36, 32, 26, 18, 10, 8, 13, 4, -4, -2, 4, 10, 14,
-17, 16, 3, 0, 1, -1, -6, -8, -8, -11, -7, 3, 8, 5, 3, 1,
--2, -6, -3, -3, -7, -10, -7, -3, 2, 3, 6, 4, -1, -2, 1, -1,
--3, -3, -3, -5, -2, 4, 5, 2, 3, 2, 0, -1, 0, 1, -3, -3,
--1, 0, 1, 4, 2, 2, 0, 0, 6, 25, 36, 35, 30, 24, 12, 8,
-9, 9, 2, -2, -1, 2, 7, 16, 19, 13, 4, -1, -3, -6, -5, -6,
--8, -10, -8, 0, 3, 4, 5, 0, -5, -8, -5, -5, -6, -6, -5, -5,
--1, 3, 6, 4, 1, 0, -3, -3, -1, -1, -1, -2, -1, 1, 3, 5,
-5, 3, 0, -1, -1, -1, -1, 0, -2, -2, -2, 0, 2, 3, 0, 1,
-9, 25, 33, 35, 32, 20, 8, 1, 4, 7, 5, 6, 5, 4, 8, 14,
-17, 13, 7, -1, -8, -10, -7, -4, -4, -4, -3, -3, 0, 4, 4, 0,
--5, -8, -10, -10, -5, -3, -2, -1, -2, 1, 2, 2, 4, 1, -4, -5,
--5, -3, -1, 2, 3, 2, 1, 3, 3, 2, 2, 1, -1, -3, -2, 0,
-0, 3, 3, 1, 1, 1, 1, 0, 0, 9, 23, 31, 35, 33, 23, 11,
-3, 3, 4, 4, 7, 6, 5, 6, 11, 14, 13, 9, 2, -6, -11, -10,
--7, -6, -3, -2, -3, -2, 1, 5, 5, 2, -2, -7, -11, -10, -5, -3,
-0, 3, 2, 1, 1, 2, 2, 1, -1, -3, -5, -4, -2, 1, 4, 5,
-4, 3, 2, 0, 0, 1, -1, -1, -1, -2, 0, 1, 2, 4, 2, 1,
-0, -1, 7, 22, 30, 35, 33, 27, 15, 3, 0, 4, 5, 10, 8, 3,
-4, 7, 10, 10, 10, 4, -6, -11, -12, -11, -7, -2, 1, -1, -3, -2,
--3, -4, -2, -3, -6, -9, -9, -8, -6, -1, 3, 3, 3, 0, 0, -1,
--2, 0, 0, -2, -1, 0, 0, 2, 4, 6, 4, 2, 2, 0, -1, 0,
-0, 1, 0, 2, 1, 0, 1, 2, 1, 0, -1, 3, 14, 23, 32, 36,
-31, 19, 8, 0, -2, -1, 6, 10, 11, 10, 10, 9, 9, 10, 9, 4,
--3, -7, -12, -12, -8, -3, 1, 2, 2, 0, -4, -5, -4, -6, -7, -7,
--8, -9, -7, -3, 0, 2, 3, 2, 0, -3, -3, -2, -2, -1, 1, 1,
-1, 1, 3, 4, 3, 4, 3, 0, 0, -1, -1, 0, 1, 3, 2, 2,
-3, 2, 1, 1, 1, 0, 1, 12, 22, 28, 35, 33, 23, 12, 3, -1,
--1, 3, 10, 11, 11, 12, 10, 9, 10, 9, 7, 0, -4, -9, -12, -9,
--6, -2, 3, 3, 2, 0, -3, -4, -7, -6, -7, -8, -8, -7, -5, -3,
--1, 3, 2, 1, 1, -3, -4, -4, -4, -2, -2, 0, 2, 1, 3, 3,
-3, 3, 2, 1, 0, -2, 0, 0, 0, 2, 2, 3, 3, 2, 2, 1,
-0, 2, 10, 19, 26, 32, 33, 24, 14, 7, 4, 3, 8, 15, 17, 15,
-15, 13, 10, 10, 11, 10, 6, 2, -1, -7, -7, -4, -1, 1, 3, 3,
-0, -4, -4, -6, -7, -6, -7, -7, -8, -7, -5, -5, -2, 0, -2, -1,
--3, -4, -5, -5, -3, -3, -2, 0, 0, 0, 1, 2, 2, 1, 2, 1,
-0, 1, 1, 2, 3, 3, 4, 3, 3, 3, 1, 2, 2, 3, 12, 18,
-25, 30, 29, 24, 15, 8, 4, 1, 3, 7, 9, 12, 12, 12, 10, 9,
-10, 7, 4, 1, -4, -7, -8, -7, -4, -2, 1, 2, 0, -1, -3, -6,
--7, -7, -7, -8, -8, -6, -6, -4, -1, -1, 0, 1, -1, -3, -4, -4,
--4, -3, -1, 0, 0, 2, 2, 2, 3, 3, 3, 2, 1, 1, 0, 0,
-1, 2, 2, 3, 4, 3, 2, 2, 1, 1, 6, 13, 18, 24, 28, 25,
-19, 12, 7, 2, 2, 5, 8, 9, 11, 11, 9, 9, 9, 8, 6, 3,
--1, -6, -8, -9, -8, -6, -2, 0, 0, 0, -3, -5, -7, -8, -8, -9,
--8, -8, -7, -6, -5, -3, -1, 0, 0, -1, -2, -3, -4, -4, -3, -1,
-0, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2, 1, 1, 1, 2, 3,
-4, 4, 4, 3, 2, 2, 1, 3, 9, 13, 19, 24, 23, 20, 15, 10,
-5, 2, 4, 5, 7, 9, 9, 9, 8, 7, 7, 5, 4, 2, -2, -5,
--7, -8, -7, -5, -2, -1, -1, -1, -4, -6, -7, -8, -8, -7, -7, -6,
--6, -5, -4, -3, -1, -1, -1, -1, -2, -2, -3, -3, -2, -1, 0, 1,
-1, 1, 1, 1, 2, 2, 3, 2, 2, 2, 1, 1, 2, 2, 3, 3,
-3, 3, 2, 2, 3, 7, 12, 17, 21, 22, 20, 16, 11, 7, 4, 4,
-6, 7, 9, 11, 10, 9, 8, 7, 6, 4, 2, 0, -3, -5, -7, -6,
--5, -4, -2, -1, -2, -3, -5, -7, -9, -9, -9, -9, -8, -7, -6, -6,
--5, -4, -4, -3, -3, -3, -3, -3, -4, -3, -2, -1, 0, 1, 2, 3,
-3, 3, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
-3, 3, 4, 8, 11, 15, 19, 20, 19, 16, 12, 8, 6, 6, 6, 7,
-9, 10, 10, 10, 9, 8, 7, 5, 4, 2, 0, -1, -3, -3, -3, -3,
--2, -1, -1, -2, -3, -4, -6, -7, -7, -7, -7, -7, -6, -6, -5, -5,
--5, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0, 1,
-1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 3, 4, 3, 3,
-5, 7, 10, 13, 15, 16, 16, 14, 13, 11, 10, 9, 8, 9, 10, 10,
-10, 10, 10, 9, 9, 8, 6, 5, 4, 2, 1, 1, 0, 0, 0, 0,
-0, -1, -1, -2, -3, -4, -5, -5, -5, -6, -6, -6, -5, -5, -5, -5,
--5, -5, -5, -5, -6, -5, -5, -5, -5, -4, -4, -4, -3, -3, -2, -2,
--2, -2, -2, -1, -1, -1, 0, 0, 0, 1, 1, 1, 1, 2, 4, 6,
-8, 10, 12, 12, 12, 11, 10, 9, 9, 9, 9, 9, 10, 10, 10, 10,
-10, 10, 10, 9, 8, 7, 6, 6, 5, 4, 4, 4, 3, 3, 3, 2,
-2, 1, 0, 0, -1, -2, -2, -3, -3, -3, -3, -3, -4, -4, -4, -4,
--4, -5, -5, -5, -5, -5, -5, -5, -5, -4, -4, -4, -4, -4, -4, -3,
--3, -3, -3, -3, -2, -2, -2, -1, -1, -1, 0, 0, 2, 3, 5, 7,
-7, 8, 8, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8,
-8, 8, 7, 7, 6, 5, 5, 5, 5, 5, 4, 4, 4, 3, 3, 2,
-2, 1, 1, 0, 0, -1, -1, -1, -1, -2, -2, -2, -2, -3, -3, -3,
--3, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -3,
--3, -3, -3, -3, -2, -2, -2, -2, -2, -1, 0, 2, 3, 4, 5, 5,
-5, 5, 4, 4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 7, 6, 6,
-6, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2,
-1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -2,
--2, -2, -2, -2, -2, -2, -2, -1, 0, 1, 2, 3, 3, 4, 3, 3,
-3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 4, 4,
-4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 1, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -1, -1, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
-1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, 0, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 2, 1, 2,
-2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 0, 0, 0, 0, 0, 0, 0
-};
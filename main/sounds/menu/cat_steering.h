@@ -1,336 +0,0 @@
-// TTS sound: cat_steering
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_cat_steeringSampleRate = 11025;
-const unsigned int menu_cat_steeringSampleCount = 5258;
-const signed char menu_cat_steeringSamples[] = {
--1, 2, -1, 1, -1, 1, 0, 0, 0, -1, 0, -1, 1, -1, 1, -1,
-2, -1, 0, 1, -1, 0, 0, 2, -1, 1, 1, 0, -1, 1, 0, 0,
--1, 2, -2, 2, -1, 2, 0, -1, 4, -3, 3, -3, 1, -1, 0, 0,
-0, 0, 3, -2, 1, -2, 1, -1, 2, -3, 2, -2, 2, 1, 0, 1,
-0, -1, 1, -1, 1, 0, 0, 1, -2, 2, -1, 0, 0, 2, -3, 4,
--4, 5, -5, 2, -1, -1, 0, 0, -1, -1, 0, 1, 0, -1, 1, -1,
--1, 0, 0, -1, 2, -2, 3, -4, 5, -5, 5, -4, 4, -4, 3, -3,
-3, -2, 1, 1, -1, 2, -2, 2, -1, 2, -3, 2, 0, 0, 1, 1,
-0, -1, 0, 2, -3, 2, -1, 1, 1, -2, 4, -3, 2, 1, -1, 2,
--3, 1, -1, -1, 1, 0, -1, 4, -3, 1, -1, -1, 0, 1, -2, 2,
--2, 4, -3, 3, -1, 1, -2, 2, -2, 2, 0, 0, 2, -1, 2, -1,
-2, -2, 2, -3, 3, -2, 2, 1, -1, 3, -3, 4, -3, 2, -2, 1,
--1, 0, 0, 0, 2, 0, 0, 0, -2, 1, -2, 3, -4, 2, 1, -3,
-4, -4, 5, -4, 3, -1, -1, 0, 1, -2, 2, -4, 6, -7, 7, -5,
-2, 0, -2, 4, -5, 2, -1, 0, 1, 0, 0, -1, 1, 0, 0, 0,
-0, -1, -1, 2, -2, 0, -1, 1, -1, -2, 3, -3, 3, -2, 1, 0,
--2, 4, -2, 0, 1, -1, 1, 3, -3, 5, -6, 5, -3, 1, 0, -1,
-0, 1, -2, 4, -4, 2, 3, -7, 9, -11, 9, -6, 3, -2, -1, 0,
-1, -1, 2, -1, -1, 1, 0, 0, -3, 3, -4, 4, -5, 4, -3, 0,
-4, -5, 4, -4, 3, -2, 0, 2, -2, 1, 1, 1, -4, 2, -4, 5,
--5, 4, -1, -1, 1, -1, 0, -1, -1, 3, -4, 4, -1, -1, 4, -6,
-8, -8, 6, -5, 0, 1, -2, 2, -3, 3, -2, 2, -4, 3, -3, 4,
--3, 1, -2, 0, 1, -1, 1, 0, 0, 2, -3, 4, -5, 6, -7, 6,
--3, 1, 1, 1, 1, -2, 2, 0, -1, 1, 1, -2, 5, -4, 6, -5,
-3, 1, -2, 3, -4, 2, -2, -1, 3, -4, 4, -1, 0, 2, -3, 4,
--3, 1, 2, -3, 2, 2, -4, 6, -7, 7, -6, 5, -3, 1, -1, 3,
--3, 5, -5, 3, 3, -5, 8, -8, 5, -5, 2, 4, -4, 4, -2, 0,
-2, -3, 3, -3, 0, 3, -3, 2, -3, 1, 2, -5, 7, -8, 5, -3,
-1, -1, -1, 2, -2, 2, -2, 3, -3, 2, 2, -4, 4, -3, 2, -1,
-0, 3, -3, 3, -3, 4, -5, 3, -1, -2, 4, -2, 4, -5, 3, -3,
-3, -1, 4, -6, 8, -5, 7, -6, 2, -1, 0, -3, 4, -6, 4, 0,
-1, 0, -1, 1, -3, 5, -1, -1, 1, 1, 2, -1, 0, 0, 0, -2,
-2, -3, 0, -1, 4, -4, 2, 2, -3, 0, 4, -6, 6, -8, 10, -8,
-3, 0, -3, 7, -7, 7, -3, -1, 6, -5, 6, -7, 7, -5, 3, 1,
--4, 6, -6, 8, -5, 1, 1, -3, 3, -2, -2, 4, -8, 9, -7, 0,
-4, -6, 5, -3, 1, 1, -2, 2, 0, -4, 3, -1, -2, 6, -8, 8,
--5, 4, -3, 3, -3, 2, -3, 4, -5, 5, -3, 2, -1, -2, 1, -1,
--2, 5, -7, 5, -2, 0, 1, -2, 4, -6, 6, -5, 2, -2, 0, 0,
-1, 0, 0, 1, -2, 3, -2, 0, 1, -3, 4, -4, 3, -2, 0, 1,
--2, 0, 1, -1, 1, -2, 1, 0, 0, 0, 0, -1, 1, -1, 0, 0,
--1, 2, -2, 1, 2, -3, 2, 0, 0, 0, -1, 2, -2, 2, 0, 0,
-1, -1, 1, 3, -2, 2, 1, -2, 1, -1, 1, 1, -1, 1, -1, 2,
-0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, -1, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0,
-1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, -1, 0, 1, -1,
-0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, -1, 1, 0, -1, 0, 0, 2, -3, -2, 1, -5, 1, 2, -4, -1,
-4, 0, -2, 3, 2, 0, 0, 5, -3, 0, 4, 1, -2, 4, -3, 0,
-6, -4, 2, 3, -3, 4, -2, -2, 2, -3, 1, 0, -3, 4, -2, -4,
-4, -3, -1, 4, -4, -1, 1, 1, 3, -2, 0, 5, -2, 1, 7, -6,
--6, 4, 5, -15, 9, 4, -15, 12, 0, -11, 13, -10, -2, 8, -10, -2,
-9, -10, 5, 2, -2, 9, -8, 10, 5, -7, 9, 3, -8, 8, 3, -12,
-17, -11, -1, 8, -12, -2, 12, -1, -8, 4, 5, -10, 2, 1, -9, 9,
--14, 8, 0, -9, 12, -8, -4, 5, -11, 6, -2, -13, 10, 2, -5, 2,
-11, -2, 1, 2, 11, -10, 3, 11, -2, -5, 13, -6, 5, 7, -9, 17,
--7, -1, 17, -17, 5, 9, -15, 7, -3, -4, 12, -17, 1, 11, -17, 2,
-9, -17, 1, 3, 0, 2, -11, 10, 7, -16, 12, 9, -12, 7, 7, -3,
-3, -2, 6, 5, -6, -1, 5, 0, -8, 9, 2, -8, 1, 8, -3, -8,
-6, -5, -1, 0, -3, 1, -1, -4, 10, -1, -4, 2, 4, -1, 4, -2,
-4, 0, -3, 10, -2, -5, 4, 3, -5, 3, 0, 3, 0, -4, 11, -2,
--5, 9, 3, -1, 1, 4, 1, -3, 2, 3, -2, -5, 0, 0, -2, -4,
--2, -3, -5, -5, -2, -9, -4, -7, -9, -9, -8, -6, -10, -13, -7, -3,
--10, -10, -7, -4, -8, -8, -3, -4, -5, -2, -1, -1, 0, 7, 1, -2,
-12, 10, 3, 6, 14, 13, 9, 12, 17, 10, 13, 16, 12, 8, 10, 11,
-6, 4, 6, 3, 1, -1, 4, 14, 5, 5, 16, 20, 21, 16, 22, 30,
-24, 22, 25, 21, 20, 15, 13, 9, 3, 2, -1, -8, -10, -11, -13, -15,
--17, -17, -16, -14, -15, -15, -11, -9, -10, -7, -6, -5, -3, -3, -2, -2,
--2, -1, 0, -2, 0, 0, 0, 1, 2, 2, 2, 5, 5, 3, 7, 7,
-6, 9, 20, 27, 17, 24, 38, 39, 34, 34, 41, 44, 34, 31, 31, 25,
-22, 13, 7, 5, -4, -7, -12, -18, -21, -22, -22, -24, -27, -24, -21, -20,
--20, -18, -14, -12, -10, -9, -8, -4, -4, -3, -1, -2, 0, 2, 1, 2,
-3, 5, 5, 5, 6, 9, 9, 8, 11, 11, 9, 11, 11, 21, 30, 22,
-23, 34, 41, 41, 31, 35, 45, 37, 29, 25, 21, 21, 9, 0, -3, -10,
--12, -19, -25, -25, -29, -28, -27, -29, -27, -24, -20, -16, -16, -14, -9, -7,
--4, -3, -3, 0, 2, 2, 2, 2, 4, 5, 4, 5, 6, 7, 8, 8,
-8, 10, 10, 10, 10, 10, 9, 8, 14, 30, 27, 17, 28, 40, 45, 35,
-28, 39, 42, 33, 22, 16, 16, 13, 2, -10, -14, -15, -19, -26, -31, -30,
--30, -27, -27, -27, -23, -20, -16, -13, -10, -7, -6, -1, 2, 2, 2, 3,
-7, 8, 6, 6, 6, 8, 10, 6, 6, 8, 8, 9, 6, 6, 7, 6,
-8, 5, 0, 7, 24, 28, 17, 19, 35, 47, 42, 28, 33, 42, 41, 30,
-14, 13, 18, 8, -5, -17, -18, -15, -23, -30, -31, -32, -26, -24, -25, -21,
--20, -13, -4, -4, -2, -1, 5, 13, 9, 7, 8, 10, 15, 9, 5, 7,
-6, 8, 5, 0, 2, 2, 3, 3, -1, 0, 2, 2, 2, -1, -1, 16,
-31, 22, 17, 28, 47, 52, 37, 29, 39, 47, 40, 21, 11, 14, 14, 3,
--12, -21, -18, -17, -23, -31, -35, -26, -22, -24, -23, -21, -15, -9, -7, -5,
--3, 0, 5, 7, 7, 6, 7, 9, 10, 9, 7, 6, 6, 8, 7, 4,
-3, 3, 5, 6, 0, 0, 2, 2, 2, -1, 5, 26, 29, 19, 22, 35,
-53, 48, 30, 31, 41, 44, 32, 10, 7, 12, 9, -3, -20, -23, -16, -18,
--24, -32, -31, -22, -19, -19, -21, -17, -9, -7, -4, -4, -3, 2, 4, 5,
-6, 5, 6, 8, 8, 8, 6, 5, 7, 8, 6, 5, 4, 4, 5, 4,
-2, 1, 2, 1, 0, 0, 7, 25, 29, 21, 21, 33, 50, 51, 33, 26,
-34, 43, 37, 14, 2, 4, 10, 4, -14, -26, -22, -15, -15, -25, -31, -25,
--17, -14, -16, -18, -13, -8, -4, -3, -4, -2, 0, 3, 5, 4, 4, 4,
-4, 8, 9, 6, 6, 5, 7, 10, 6, 5, 4, 4, 6, 4, 2, 1,
--1, 1, 9, 25, 29, 22, 22, 31, 48, 53, 38, 24, 24, 33, 37, 20,
--1, -8, -3, 3, -6, -23, -29, -24, -15, -14, -22, -26, -21, -13, -8, -10,
--12, -11, -7, -3, -1, -1, -2, -2, 0, 3, 5, 5, 3, 3, 5, 8,
-10, 8, 5, 6, 8, 9, 9, 4, 2, 4, 4, 4, 3, -2, -2, 9,
-33, 33, 26, 22, 30, 47, 52, 39, 22, 14, 21, 27, 19, 0, -15, -16,
--7, -6, -14, -25, -29, -20, -13, -11, -15, -19, -16, -10, -7, -5, -8, -9,
--7, -6, -2, 0, -1, -2, -2, 0, 5, 8, 7, 4, 3, 8, 12, 12,
-9, 5, 5, 9, 10, 7, 3, -1, -1, 0, 0, 4, 17, 28, 32, 27,
-22, 28, 41, 47, 38, 21, 11, 14, 20, 16, 1, -14, -19, -13, -7, -11,
--19, -24, -21, -13, -9, -10, -13, -14, -11, -7, -7, -6, -7, -8, -7, -7,
--5, -1, 0, -1, -1, -1, 4, 9, 9, 7, 6, 7, 10, 12, 11, 9,
-5, 5, 8, 7, 6, 3, 0, 0, 4, 16, 30, 36, 34, 26, 24, 34,
-45, 45, 32, 14, 5, 9, 14, 10, -4, -19, -23, -17, -10, -9, -16, -22,
--21, -15, -9, -7, -10, -13, -14, -11, -8, -7, -7, -8, -10, -9, -6, -2,
-1, 2, 0, 0, 3, 9, 13, 13, 10, 8, 8, 12, 14, 12, 8, 5,
-4, 6, 7, 5, 2, -1, -1, 5, 19, 33, 39, 34, 25, 24, 33, 43,
-43, 29, 10, 0, 3, 10, 9, -3, -18, -23, -18, -9, -6, -10, -17, -19,
--15, -9, -5, -7, -11, -14, -14, -12, -9, -7, -8, -10, -10, -9, -4, 1,
-4, 3, 2, 2, 6, 11, 12, 11, 7, 5, 7, 10, 11, 9, 5, 2,
-3, 5, 6, 6, 3, 0, 2, 14, 30, 41, 40, 30, 23, 28, 39, 44,
-36, 17, 1, -1, 5, 10, 4, -10, -20, -20, -13, -5, -4, -10, -15, -16,
--13, -9, -7, -9, -15, -20, -22, -19, -13, -10, -10, -14, -15, -10, -2, 5,
-7, 3, 0, 3, 8, 13, 13, 9, 5, 5, 7, 10, 11, 9, 6, 5,
-6, 8, 9, 8, 6, 3, 3, 14, 31, 43, 43, 32, 22, 27, 39, 45,
-37, 16, -1, -3, 5, 10, 5, -9, -20, -19, -10, -1, -1, -7, -13, -16,
--14, -10, -9, -12, -16, -21, -23, -19, -14, -9, -9, -12, -13, -8, -1, 6,
-8, 3, 0, 1, 6, 11, 11, 7, 3, 3, 7, 11, 12, 10, 7, 6,
-8, 10, 10, 8, 6, 3, 2, 5, 19, 36, 44, 39, 28, 24, 33, 46,
-45, 29, 7, -2, 4, 14, 14, 1, -12, -13, -5, 4, 6, -1, -9, -11,
--10, -9, -10, -14, -19, -21, -24, -23, -19, -15, -12, -12, -14, -13, -6, 1,
-4, 1, -4, -4, 1, 6, 7, 3, 0, 1, 5, 10, 12, 10, 9, 9,
-11, 12, 12, 10, 8, 6, 5, 3, 4, 13, 29, 40, 39, 31, 26, 34,
-46, 44, 28, 9, -1, 4, 12, 9, -4, -14, -13, -4, 4, 4, -3, -9,
--8, -7, -7, -11, -16, -20, -22, -23, -23, -20, -16, -14, -13, -13, -10, -3,
-2, 3, -1, -4, -2, 2, 5, 4, 0, -2, 2, 8, 11, 11, 9, 9,
-11, 12, 12, 11, 8, 6, 5, 3, 3, 3, 2, 10, 28, 42, 44, 36,
-30, 36, 48, 47, 32, 11, 0, 6, 13, 9, -2, -13, -10, 1, 8, 6,
-0, -7, -6, -4, -7, -12, -18, -22, -23, -25, -24, -20, -18, -15, -14, -14,
--8, -2, 0, 0, -4, -7, -2, 2, 3, 1, -3, -1, 6, 11, 13, 12,
-8, 11, 15, 15, 14, 10, 6, 7, 7, 6, 6, 4, 2, 2, 5, 22,
-42, 44, 36, 27, 31, 48, 53, 35, 12, 0, 5, 18, 16, -1, -12, -10,
-3, 13, 10, -1, -7, -6, -2, -4, -8, -16, -21, -24, -23, -21, -17, -15,
--16, -14, -10, -3, 1, -2, -8, -9, -4, 1, 1, -6, -8, -4, 3, 10,
-9, 5, 6, 9, 14, 15, 10, 7, 5, 6, 8, 7, 4, 2, 2, 4,
-6, 5, 8, 24, 39, 40, 33, 29, 37, 50, 45, 26, 11, 9, 17, 20,
-8, -4, -5, 2, 12, 13, 3, -3, -2, 1, 1, -5, -15, -20, -20, -18,
--17, -18, -20, -19, -15, -10, -5, -5, -8, -8, -6, -3, -2, -5, -8, -7,
--3, 1, 2, 2, 2, 5, 10, 12, 10, 8, 7, 8, 9, 8, 5, 3,
-3, 4, 5, 5, 5, 3, 3, 10, 27, 40, 36, 28, 29, 43, 53, 42,
-20, 10, 16, 24, 19, 1, -9, -3, 10, 14, 5, -4, -3, 2, 6, 0,
--11, -17, -17, -15, -15, -19, -22, -21, -17, -11, -8, -8, -8, -7, -4, -2,
--2, -4, -6, -7, -3, 0, 0, -1, 0, 3, 8, 10, 9, 8, 9, 9,
-10, 9, 5, 2, 2, 3, 3, 1, -1, -1, 0, 2, 3, 13, 29, 32,
-28, 29, 36, 49, 47, 28, 19, 20, 25, 23, 7, -3, 1, 8, 12, 6,
--2, 0, 6, 7, 3, -7, -12, -11, -11, -13, -19, -23, -20, -17, -13, -11,
--13, -11, -6, -4, -2, -4, -7, -5, -4, -3, -2, -4, -4, 0, 3, 6,
-6, 5, 8, 10, 10, 10, 7, 6, 7, 5, 5, 3, 1, 1, 3, 4,
-3, 1, 1, 10, 28, 33, 27, 25, 34, 50, 51, 32, 21, 24, 29, 28,
-12, -2, 1, 8, 11, 6, -3, -3, 3, 7, 3, -6, -12, -11, -10, -11,
--17, -23, -23, -18, -13, -13, -16, -15, -10, -3, -1, -5, -7, -4, 0, 2,
--2, -5, -2, 2, 5, 5, 3, 4, 8, 10, 10, 7, 6, 8, 8, 6,
-5, 2, 2, 4, 2, 1, 1, 0, 1, 1, 9, 26, 30, 25, 26, 38,
-51, 49, 32, 23, 30, 34, 26, 10, 1, 6, 13, 9, 2, -4, -2, 7,
-8, -2, -9, -10, -6, -5, -13, -20, -20, -16, -13, -13, -16, -15, -9, -4,
--3, -4, -5, -3, 1, 2, 0, -3, -1, 3, 3, 3, 2, 3, 6, 8,
-7, 6, 6, 7, 7, 6, 4, 2, 2, 3, 2, 0, -1, -1, 1, 1,
--1, 2, 16, 28, 27, 25, 34, 48, 54, 43, 34, 38, 41, 35, 23, 12,
-12, 14, 11, 5, -2, -1, 4, 4, -1, -7, -8, -5, -7, -12, -18, -19,
--16, -17, -17, -18, -18, -12, -10, -7, -7, -7, -3, 0, 0, 0, -1, 1,
-3, 3, 3, 2, 3, 6, 7, 7, 6, 6, 8, 10, 7, 4, 5, 7,
-4, 2, 1, 0, 1, 1, 0, 0, -3, -1, 12, 23, 23, 20, 30, 46,
-51, 41, 34, 39, 44, 38, 24, 16, 15, 16, 15, 5, -2, 1, 6, 6,
--1, -7, -4, -1, -4, -11, -17, -15, -12, -15, -18, -20, -18, -12, -11, -12,
--11, -9, -4, -1, -3, -3, -2, 1, 4, 0, -2, 2, 4, 5, 5, 3,
-4, 9, 8, 6, 6, 6, 7, 7, 3, 3, 4, 2, 3, 3, -1, -1,
-2, 0, -1, 9, 24, 23, 20, 32, 47, 50, 40, 37, 45, 45, 36, 26,
-20, 19, 19, 14, 4, 1, 5, 10, 3, -4, -1, 3, 0, -5, -10, -11,
--10, -12, -15, -19, -20, -14, -14, -17, -16, -13, -8, -7, -8, -7, -5, -1,
--2, -3, -2, -1, 1, 4, 0, 0, 6, 5, 5, 5, 5, 8, 7, 7,
-6, 5, 6, 6, 5, 2, 3, 4, 1, 2, 1, -1, 13, 27, 18, 19,
-39, 48, 47, 39, 41, 50, 45, 35, 27, 21, 23, 22, 8, 0, 6, 9,
-4, -2, -4, 1, 2, -4, -7, -10, -10, -7, -15, -21, -18, -17, -16, -19,
--20, -16, -12, -11, -10, -10, -8, 0, -3, -5, -2, -1, 2, 1, 0, 1,
-3, 5, 4, 5, 7, 9, 11, 9, 13, 11, 11, 14, 10, 8, 10, 8,
-5, 5, 4, 1, 3, 2, 18, 27, 14, 28, 46, 46, 44, 40, 48, 50,
-37, 30, 24, 22, 19, 9, 2, -3, 6, 3, -7, -4, -1, 3, -4, -9,
--3, -8, -10, -11, -18, -20, -17, -17, -23, -22, -15, -12, -13, -13, -5, -1,
--3, 1, 2, 1, 5, 4, 2, 0, 3, 6, 1, 1, 6, 6, 6, 7,
-8, 8, 11, 8, 8, 8, 6, 7, 5, 1, 2, 4, -1, -2, 0, -2,
-11, 23, 14, 24, 39, 47, 46, 39, 46, 54, 41, 33, 26, 25, 22, 11,
-3, 0, 4, 3, -5, -6, 0, 4, -4, -7, -4, -5, -8, -12, -17, -20,
--16, -19, -27, -24, -17, -18, -21, -15, -10, -9, -5, -4, -4, 0, 3, 0,
--2, 2, 4, 1, 0, 2, 6, 5, 4, 8, 8, 10, 11, 9, 11, 9,
-10, 8, 6, 5, 5, 5, 0, 2, 1, -2, 6, 20, 17, 14, 37, 45,
-39, 41, 46, 51, 42, 33, 29, 26, 20, 11, 4, 0, 2, 3, -9, -5,
-2, 2, -4, -4, 0, -1, -7, -12, -12, -14, -18, -18, -24, -22, -18, -19,
--19, -17, -7, -8, -9, -2, -3, 1, 1, 0, -1, 1, 5, -3, -1, 5,
-5, 1, 3, 11, 9, 8, 13, 10, 11, 12, 11, 5, 7, 11, 3, -1,
-5, 3, -1, -2, 1, 3, 20, 18, 12, 37, 46, 42, 37, 45, 57, 38,
-31, 30, 27, 21, 7, 5, 4, 4, 0, -7, -1, 2, 2, -3, -4, 2,
--2, -8, -14, -12, -10, -21, -24, -21, -19, -20, -25, -17, -14, -12, -8, -12,
--3, 0, -4, -3, -1, 3, -3, -1, 1, -2, 3, 2, 2, 3, 10, 9,
-4, 11, 13, 8, 10, 7, 10, 8, 3, 6, 2, 3, 3, -2, 3, 0,
-0, 6, 21, 17, 16, 40, 43, 39, 39, 47, 52, 34, 31, 31, 27, 17,
-7, 7, 6, 7, -3, -5, 9, 6, -4, -1, 5, 3, -11, -8, -8, -13,
--18, -21, -20, -20, -20, -20, -18, -13, -10, -10, -8, -2, -2, -3, -4, -1,
-1, -3, -4, -2, 3, -2, -2, 5, 5, 7, 6, 6, 13, 10, 7, 9,
-11, 6, 4, 7, 3, 1, 1, 2, -2, -1, 2, -3, -2, 8, 21, 8,
-15, 45, 36, 28, 38, 52, 42, 22, 34, 34, 20, 6, 12, 15, -1, 3,
-2, 4, 6, 0, 4, 1, 6, -2, -9, -2, -10, -13, -19, -17, -14, -24,
--17, -15, -16, -10, -11, -6, -7, 0, -4, -6, 3, -4, -4, -1, -3, 1,
--4, 5, 2, 4, 7, 9, 9, 8, 11, 10, 7, 9, 3, 9, 2, 1,
-5, 2, -1, 2, 5, -1, 2, 4, 2, 1, 17, 17, 7, 30, 39, 27,
-28, 43, 50, 22, 28, 39, 25, 7, 15, 17, 4, -1, 8, 5, 1, 3,
-7, -2, 6, 1, -8, -6, -5, -14, -21, -16, -13, -25, -22, -14, -12, -18,
--12, -2, -8, -6, -5, 0, -3, -9, -2, -3, -6, -4, -4, 2, -2, 3,
-5, 6, 9, 7, 9, 10, 6, 9, 4, 6, 3, 2, 3, 2, 3, 1,
-3, 5, 3, 3, 3, 4, 9, 16, 10, 17, 33, 28, 24, 32, 42, 31,
-18, 30, 33, 11, 8, 20, 16, -1, 3, 16, 8, -1, 4, 12, 3, -7,
-0, 0, -9, -14, -8, -9, -18, -13, -11, -11, -12, -10, -4, -8, -7, -2,
--6, -6, -4, -4, -6, -6, -1, -2, -5, 2, 3, 0, 3, 5, 6, 4,
-4, 5, 5, 2, 2, 2, 4, 0, 2, 3, 4, 0, 1, 3, 2, -1,
-1, 1, -1, 1, 13, 7, 10, 26, 27, 22, 29, 38, 33, 20, 29, 31,
-17, 12, 19, 20, 7, 7, 18, 12, 4, 8, 11, 5, -4, 2, -1, -8,
--10, -8, -8, -13, -13, -5, -10, -10, -6, -4, -6, -6, -3, -2, -5, -3,
-1, 0, -2, 3, 4, 3, 4, 5, 5, 5, 4, 5, 4, 4, 3, 3,
-4, 3, 3, 2, 4, 3, 0, 2, 2, -1, -1, 0, 0, -2, -3, 0,
-1, 6, 8, 9, 21, 25, 23, 27, 32, 32, 24, 25, 30, 23, 15, 18,
-22, 15, 9, 16, 16, 7, 3, 8, 4, -6, -6, -2, -7, -13, -9, -5,
--10, -12, -6, -5, -10, -10, -6, -7, -11, -8, -4, -6, -6, -3, 1, -1,
--2, 3, 3, 0, 1, 4, 2, 0, 3, 4, 2, 3, 5, 4, 2, 4,
-4, 2, 1, 2, 2, -1, 1, 1, 0, -1, 0, 1, -2, -2, 3, 5,
-4, 8, 18, 21, 19, 24, 31, 29, 23, 26, 29, 23, 18, 22, 24, 18,
-15, 20, 18, 11, 8, 10, 6, -1, -3, 0, -5, -9, -7, -5, -7, -9,
--7, -6, -9, -10, -9, -8, -10, -9, -6, -6, -5, -3, -2, -1, 0, 0,
-1, 1, 2, 2, 2, 4, 4, 4, 5, 6, 5, 4, 4, 5, 3, 1,
-3, 2, 0, 1, 2, 1, -1, 0, 1, -1, -3, -2, 1, 4, 4, 9,
-16, 19, 20, 24, 28, 27, 24, 26, 27, 23, 20, 23, 23, 20, 18, 21,
-21, 17, 12, 11, 9, 1, -1, -1, -4, -6, -5, -4, -6, -7, -7, -6,
--8, -9, -8, -7, -7, -6, -4, -1, -1, 1, 3, 4, 4, 4, 5, 6,
-5, 6, 7, 8, 7, 8, 9, 8, 7, 6, 6, 4, 3, 2, 2, 1,
-0, 0, 0, -1, -3, -2, -3, -4, -5, -4, -2, 1, 4, 9, 15, 19,
-22, 25, 27, 28, 27, 27, 27, 27, 27, 27, 28, 27, 26, 26, 24, 20,
-17, 14, 10, 6, 3, 1, -1, -3, -4, -5, -6, -8, -8, -9, -10, -11,
--11, -11, -10, -9, -7, -5, -4, -2, 0, 1, 2, 3, 5, 5, 7, 7,
-8, 9, 10, 11, 11, 11, 11, 10, 10, 9, 8, 7, 6, 5, 4, 3,
-2, 1, 0, -1, -2, -3, -4, -4, -3, 0, 3, 7, 11, 16, 18, 20,
-22, 23, 22, 22, 23, 24, 23, 23, 25, 25, 24, 23, 22, 19, 16, 13,
-11, 8, 5, 3, 2, -1, -2, -3, -4, -6, -7, -8, -8, -10, -9, -9,
--9, -8, -7, -5, -4, -3, -2, 0, 0, 1, 2, 3, 4, 5, 6, 7,
-7, 8, 8, 8, 8, 7, 7, 6, 6, 5, 4, 3, 3, 2, 1, 0,
--1, -1, -2, -3, -3, -4, -2, 1, 4, 8, 12, 16, 18, 20, 22, 23,
-22, 22, 23, 23, 22, 22, 23, 22, 20, 18, 16, 13, 10, 8, 5, 3,
-1, -1, -2, -4, -5, -6, -8, -9, -9, -10, -10, -10, -10, -9, -8, -7,
--6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 3, 4, 5, 5, 5, 5,
-5, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 0, 0, -1, -2, -2,
--2, -3, -3, -3, -1, 2, 5, 8, 12, 14, 17, 18, 20, 21, 21, 22,
-22, 22, 22, 22, 22, 21, 20, 18, 16, 13, 11, 9, 6, 4, 2, 1,
--1, -3, -4, -5, -7, -8, -9, -9, -9, -9, -9, -8, -8, -7, -6, -5,
--5, -4, -3, -3, -2, -1, 0, 1, 1, 2, 3, 3, 3, 4, 4, 4,
-4, 3, 3, 3, 3, 2, 2, 2, 1, 1, 0, 0, -1, -1, -1, -2,
--2, -1, 2, 5, 7, 10, 13, 15, 16, 17, 18, 19, 19, 20, 20, 20,
-20, 20, 19, 18, 17, 15, 13, 11, 9, 7, 5, 4, 2, 1, -1, -2,
--3, -5, -6, -7, -7, -8, -8, -8, -7, -7, -6, -6, -5, -4, -3, -2,
--1, -1, 1, 2, 2, 3, 4, 5, 5, 6, 6, 6, 6, 6, 6, 6,
-5, 5, 5, 4, 3, 3, 2, 1, 1, 0, -1, -1, -2, -2, -1, 0,
-2, 4, 6, 8, 10, 10, 12, 12, 13, 13, 14, 15, 15, 16, 16, 16,
-16, 15, 15, 13, 12, 11, 10, 8, 7, 6, 5, 4, 2, 1, 0, -1,
--2, -3, -4, -4, -5, -5, -5, -5, -5, -4, -4, -4, -3, -3, -2, -1,
-0, 0, 1, 2, 2, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6,
-5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 1, 2, 3, 4, 6,
-7, 8, 8, 9, 9, 10, 10, 10, 11, 11, 12, 12, 12, 12, 12, 11,
-11, 10, 9, 8, 7, 7, 6, 6, 5, 4, 3, 2, 1, 1, 0, -1,
--1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, 0,
-0, 1, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 3, 3, 3, 3, 2, 3, 4, 5, 6, 7, 8, 8, 8,
-9, 9, 9, 9, 10, 10, 10, 11, 11, 11, 11, 11, 11, 10, 10, 9,
-9, 8, 8, 7, 7, 6, 6, 5, 5, 4, 3, 3, 2, 2, 1, 1,
-1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
-4, 4, 4, 3, 4, 5, 5, 6, 6, 7, 7, 7, 8, 8, 8, 8,
-8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 6, 6, 5, 5, 5,
-5, 4, 4, 4, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-7, 7, 7, 7, 7, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4,
-4, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
-4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6,
-6, 6, 6, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 4, 4,
-4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
-1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-1, 1, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
-2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -1,343 +0,0 @@
-// TTS sound: cat_volume
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_cat_volumeSampleRate = 11025;
-const unsigned int menu_cat_volumeSampleCount = 5374;
-const signed char menu_cat_volumeSamples[] = {
--1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 0, 1, 1, 3, 2, 2, 2, 2, 2, 2, 3, 2, 2,
-2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 2, 3, 2, 2, 2, 2, 2, 2, 2,
-2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 4, 3, 2, 2, 2, 1,
-1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0,
--1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1,
-0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 6, 5, 6, 7,
-5, 4, 4, 4, 3, 2, 3, 2, 1, 2, 1, 0, 0, 1, 0, -1,
--1, -2, -2, -3, -3, -3, -3, -3, -3, -3, -2, -3, -2, -2, -2, -1,
--1, -1, -1, -1, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 1, 2,
-1, 2, 1, 1, 2, 1, 0, 1, 0, 0, 0, 0, 0, 5, 12, 16,
-21, 23, 22, 18, 14, 11, 7, 4, 4, 2, 0, -1, -2, -4, -5, -5,
--5, -4, -3, -2, -3, -4, -4, -7, -8, -8, -9, -8, -7, -5, -4, -3,
--1, 0, 1, 2, 3, 4, 3, 4, 4, 2, 2, 2, 1, 1, 2, 2,
-2, 3, 3, 2, 2, 1, 1, 1, 0, -1, -1, -1, -3, -2, 4, 17,
-29, 42, 55, 57, 49, 37, 20, 5, -9, -15, -13, -13, -10, -5, -6, -7,
--7, -7, -4, -4, -2, 1, -2, -7, -10, -14, -19, -19, -14, -10, -5, 2,
-8, 8, 8, 9, 7, 4, 4, 4, 3, 0, 1, 0, -3, -1, 1, 0,
-2, 6, 6, 5, 5, 4, 1, -3, -2, -4, -6, -3, -2, -4, -2, 9,
-27, 40, 55, 70, 66, 50, 33, 11, -11, -24, -26, -22, -18, -11, -2, 0,
--1, 3, 4, 3, 4, 6, 2, -5, -10, -16, -23, -24, -19, -13, -6, 3,
-12, 14, 13, 12, 9, 3, 0, -1, -3, -4, -4, -3, -3, -2, 1, 3,
-4, 8, 9, 7, 6, 4, -1, -4, -5, -7, -6, -4, -3, -1, 1, 3,
-16, 36, 51, 66, 75, 66, 43, 15, -10, -31, -43, -36, -21, -9, 5, 18,
-17, 11, 8, 4, -3, -5, -3, -6, -13, -17, -18, -23, -23, -12, -3, 5,
-16, 21, 19, 13, 6, -1, -8, -12, -9, -7, -6, 0, 4, 3, 5, 8,
-6, 6, 7, 6, 2, -1, -2, -6, -10, -6, -3, -3, 3, 7, 6, 7,
-18, 34, 42, 54, 65, 53, 31, 12, -13, -34, -40, -32, -17, -3, 13, 26,
-20, 13, 10, -3, -11, -11, -12, -12, -13, -12, -12, -16, -13, -4, -1, 7,
-18, 17, 15, 10, 1, -7, -14, -14, -11, -8, -1, 7, 9, 10, 10, 7,
-1, -2, -2, -6, -7, -4, -6, -5, -2, -1, 1, 2, 4, 6, 4, 10,
-28, 38, 47, 61, 56, 37, 18, -5, -26, -37, -34, -18, -5, 8, 24, 25,
-14, 9, 1, -11, -15, -12, -11, -13, -11, -8, -12, -13, -6, 0, 4, 11,
-17, 16, 8, 2, -4, -14, -17, -13, -12, -7, 0, 5, 8, 8, 8, 6,
-4, 1, -1, -2, -5, -5, -5, -5, -3, -1, 1, 6, 6, 5, 10, 20,
-34, 43, 55, 59, 42, 23, 3, -22, -36, -37, -26, -8, 6, 21, 30, 20,
-12, 4, -10, -17, -16, -15, -12, -11, -8, -6, -11, -6, 1, 1, 8, 14,
-11, 7, -1, -7, -13, -18, -11, -5, -2, 10, 14, 12, 11, 7, 1, -3,
--6, -4, -4, -4, 1, 0, -2, 1, 1, 0, 3, 5, 4, 3, 11, 27,
-35, 46, 60, 50, 31, 14, -10, -30, -37, -30, -16, -2, 16, 27, 22, 17,
-8, -6, -13, -15, -16, -13, -11, -8, -8, -9, -5, -2, 2, 10, 12, 12,
-11, 2, -5, -11, -16, -14, -9, -1, 7, 11, 15, 13, 6, 3, -1, -7,
--5, -4, -4, -1, -1, 1, 1, -1, 3, 3, 1, 5, 3, 4, 20, 32,
-41, 56, 54, 41, 21, -3, -21, -36, -36, -19, -6, 9, 27, 28, 19, 11,
--1, -13, -19, -17, -12, -12, -7, -1, -7, -6, -1, -2, 3, 10, 11, 10,
-5, 0, -8, -15, -13, -10, -7, 4, 10, 12, 14, 10, 3, -1, -6, -6,
--6, -5, 0, 1, 0, 3, 0, 0, 2, 1, 3, 3, 9, 28, 36, 46,
-61, 52, 33, 17, -9, -30, -37, -32, -17, -4, 15, 30, 24, 19, 12, -6,
--15, -16, -18, -15, -10, -6, -5, -7, -5, -3, -2, 5, 11, 11, 10, 6,
-0, -9, -14, -13, -12, -6, 4, 11, 12, 13, 11, 4, -2, -4, -6, -7,
--4, 0, 0, 1, 2, 1, 0, 1, 3, 2, 3, 17, 32, 42, 58, 66,
-55, 39, 18, -8, -28, -37, -31, -18, -3, 16, 27, 26, 20, 10, -4, -14,
--17, -17, -16, -12, -8, -8, -9, -8, -5, -3, 4, 10, 12, 12, 8, 1,
--7, -14, -14, -13, -9, 2, 9, 10, 15, 13, 5, 1, -2, -5, -6, -4,
--1, -1, 2, 4, 3, 4, 5, 5, 4, 6, 20, 34, 43, 61, 67, 54,
-38, 17, -9, -30, -35, -28, -19, -1, 19, 25, 23, 20, 8, -7, -14, -16,
--18, -16, -10, -8, -11, -9, -8, -9, -5, 2, 8, 11, 12, 11, 2, -6,
--10, -14, -14, -8, -1, 6, 11, 14, 13, 6, 2, 0, -7, -7, -3, -3,
--2, 2, 2, -1, -1, 1, 0, -1, 9, 26, 39, 53, 71, 69, 52, 37,
-11, -17, -30, -33, -27, -13, 5, 21, 25, 22, 18, 5, -7, -11, -15, -15,
--13, -11, -10, -13, -14, -12, -12, -7, 3, 7, 9, 14, 12, 5, -1, -12,
--16, -15, -9, -5, 2, 8, 9, 9, 8, 5, 2, 0, 0, -1, -1, 0,
--2, -2, -2, -2, 0, 0, 4, 19, 35, 48, 65, 74, 65, 49, 28, 1,
--22, -32, -30, -22, -6, 13, 22, 25, 22, 13, 1, -9, -12, -15, -16, -11,
--11, -14, -14, -16, -15, -11, -5, 3, 7, 10, 12, 5, -2, -5, -12, -15,
--10, -6, -1, 5, 10, 10, 8, 7, 4, 0, 1, 2, 1, 1, 3, 0,
--3, -2, -2, -3, 0, 7, 21, 37, 53, 69, 73, 63, 48, 25, -1, -19,
--27, -27, -18, -3, 11, 17, 20, 17, 8, -1, -6, -9, -12, -11, -10, -12,
--16, -18, -19, -20, -15, -7, -1, 6, 12, 11, 8, 3, -3, -8, -10, -7,
--6, -2, 4, 4, 6, 6, 5, 4, 4, 5, 5, 4, 5, 3, 0, -2,
--3, -4, -4, -1, 8, 24, 39, 55, 69, 70, 61, 45, 23, 2, -14, -21,
--20, -15, -4, 5, 8, 10, 9, 4, 2, 0, -2, -2, -5, -8, -13, -20,
--23, -25, -23, -16, -10, -2, 4, 6, 8, 6, 3, 2, -2, -3, -2, -3,
--2, -1, 0, 1, 1, 3, 5, 6, 8, 9, 7, 6, 5, 1, -2, -2,
--2, -4, -2, 3, 14, 29, 43, 59, 66, 62, 53, 37, 17, 1, -9, -16,
--18, -16, -14, -12, -9, -6, -5, 0, 2, 3, 4, 0, -5, -11, -18, -20,
--24, -23, -19, -16, -11, -4, -1, 3, 5, 7, 8, 7, 7, 6, 2, 3,
-0, -2, 0, 0, 1, 4, 6, 7, 8, 9, 8, 6, 6, 4, 1, 0,
--1, -3, -3, 7, 18, 27, 41, 48, 45, 43, 36, 27, 21, 15, 10, 2,
--3, -7, -12, -12, -10, -9, -6, -2, -1, -2, -2, -3, -6, -9, -10, -14,
--16, -16, -15, -16, -14, -9, -8, -5, 0, 2, 3, 5, 7, 5, 5, 6,
-3, 2, 4, 2, 2, 4, 3, 4, 5, 6, 6, 4, 5, 4, 2, 2,
-1, -1, 4, 16, 22, 29, 36, 36, 33, 32, 31, 26, 21, 17, 9, 1,
--2, -6, -9, -9, -9, -9, -9, -7, -5, -7, -4, -5, -8, -8, -9, -11,
--13, -12, -13, -14, -12, -10, -8, -6, -3, 0, 1, 4, 5, 6, 6, 6,
-7, 5, 4, 3, 2, 1, 1, 1, 0, 1, 1, 1, 2, 2, 3, 3,
-2, 2, 7, 17, 22, 26, 32, 32, 33, 35, 34, 32, 26, 22, 15, 10,
-7, 1, -3, -6, -9, -10, -11, -10, -10, -11, -9, -9, -10, -8, -10, -10,
--10, -11, -11, -12, -11, -10, -10, -8, -6, -4, -3, 0, 2, 4, 6, 8,
-9, 9, 11, 10, 10, 11, 8, 9, 7, 6, 6, 4, 3, 2, 2, 1,
--1, 0, 3, 13, 16, 18, 25, 28, 31, 34, 35, 34, 30, 29, 26, 20,
-15, 9, 4, -1, -5, -7, -13, -14, -15, -17, -16, -16, -15, -15, -13, -11,
--10, -11, -8, -7, -8, -7, -5, -6, -7, -5, -4, -6, -4, -3, -4, -2,
--1, 0, 1, 2, 5, 4, 6, 7, 7, 8, 8, 9, 7, 7, 9, 5,
-5, 5, 3, 8, 16, 13, 14, 23, 27, 27, 29, 33, 32, 29, 34, 29,
-23, 22, 21, 15, 8, 4, -4, -10, -10, -16, -20, -19, -20, -22, -22, -19,
--17, -19, -13, -10, -12, -6, -4, -3, -2, 1, 3, 0, 3, 4, 1, 3,
-2, 2, 1, 1, 2, -1, 0, 3, -1, 1, 3, 2, 2, 4, 5, 4,
-6, 6, 4, 8, 16, 15, 12, 22, 27, 25, 26, 32, 34, 30, 32, 33,
-27, 27, 25, 18, 14, 11, 6, -2, -5, -7, -14, -18, -18, -21, -24, -23,
--23, -24, -23, -20, -18, -17, -12, -10, -10, -5, -2, -2, 0, 3, 3, 3,
-6, 5, 4, 5, 5, 3, 3, 4, 2, 1, 2, 2, 1, 1, 3, 1,
-2, 5, 3, 2, 6, 11, 12, 9, 18, 23, 21, 24, 28, 32, 32, 30,
-34, 32, 30, 28, 24, 23, 18, 12, 10, 4, 1, -5, -9, -11, -16, -18,
--20, -21, -22, -23, -23, -21, -20, -18, -16, -14, -11, -9, -7, -4, -3, 0,
-0, 3, 3, 3, 5, 3, 4, 3, 3, 3, 1, 2, 1, 0, 2, 0,
-1, 2, 1, 2, 3, 4, 6, 12, 12, 12, 21, 24, 23, 26, 32, 33,
-31, 33, 35, 32, 28, 29, 25, 20, 17, 11, 7, 3, -2, -7, -11, -14,
--18, -21, -22, -22, -24, -23, -23, -21, -19, -18, -16, -12, -10, -9, -6, -3,
--3, -1, 1, 1, 1, 2, 2, 0, 1, 2, -1, -2, 0, -2, -3, -3,
-0, -1, -3, 2, 3, 1, 5, 6, 7, 16, 14, 15, 25, 27, 26, 28,
-35, 37, 30, 34, 37, 31, 29, 27, 23, 20, 13, 10, 5, 0, -4, -10,
--14, -15, -20, -23, -24, -23, -25, -27, -23, -20, -22, -19, -15, -11, -12, -10,
--3, -3, -3, 0, 3, 3, 1, 5, 5, 2, 4, 4, 2, 2, 2, 3,
-0, 2, 3, 1, 3, 4, 4, 5, 5, 8, 7, 9, 19, 14, 15, 26,
-27, 23, 27, 34, 33, 27, 32, 33, 27, 25, 23, 19, 16, 10, 6, 0,
--3, -6, -15, -16, -16, -22, -25, -24, -24, -26, -25, -21, -23, -20, -15, -15,
--13, -7, -6, -5, -2, 3, 1, 1, 6, 6, 4, 6, 6, 5, 4, 5,
-5, 3, 3, 5, 2, 3, 4, 4, 4, 3, 6, 7, 5, 6, 9, 14,
-16, 11, 20, 27, 23, 21, 28, 36, 29, 24, 33, 31, 22, 20, 21, 17,
-9, 5, 4, -3, -9, -11, -16, -19, -22, -23, -25, -27, -24, -25, -25, -20,
--19, -18, -13, -11, -9, -6, -2, -1, 0, 4, 6, 4, 6, 9, 7, 5,
-8, 7, 5, 4, 6, 4, 1, 4, 4, 1, 4, 4, 3, 4, 5, 5,
-3, 5, 9, 13, 13, 11, 20, 26, 22, 23, 28, 35, 30, 24, 31, 32,
-23, 18, 19, 18, 8, 3, 1, -4, -9, -14, -17, -20, -22, -23, -27, -25,
--22, -24, -22, -20, -16, -13, -14, -9, -4, -4, -1, 1, 4, 5, 4, 8,
-8, 5, 9, 8, 5, 5, 7, 6, 2, 3, 7, 2, 1, 5, 4, 3,
-4, 4, 4, 4, 6, 4, 2, 9, 19, 12, 8, 25, 30, 21, 22, 33,
-39, 27, 26, 35, 29, 24, 20, 18, 15, 6, 4, -1, -10, -9, -13, -20,
--23, -23, -20, -28, -29, -19, -22, -23, -19, -14, -11, -11, -7, -2, -1, 2,
-4, 5, 7, 7, 9, 9, 6, 9, 9, 5, 6, 7, 5, 2, 2, 5,
-3, -1, 1, 3, 2, -1, 1, 4, 0, 0, 3, 1, 5, 16, 13, 9,
-21, 33, 27, 21, 33, 44, 32, 25, 34, 36, 24, 18, 21, 15, 5, 3,
--1, -9, -14, -13, -18, -29, -24, -21, -27, -30, -26, -18, -22, -23, -12, -11,
--11, -6, 0, 0, -2, 8, 10, 2, 7, 13, 9, 5, 8, 12, 6, 3,
-8, 5, 1, 2, 3, 1, -2, 1, 3, -2, -1, 3, 1, -2, 1, 3,
-0, -2, 13, 20, 6, 13, 20, 35, 30, 22, 30, 43, 26, 31, 38, 28,
-20, 22, 19, 6, 0, 6, -3, -18, -15, -10, -18, -27, -22, -15, -23, -24,
--15, -14, -15, -12, -5, -4, -9, -1, 6, 0, 0, 5, 9, 4, 1, 7,
-7, 1, 3, 6, 2, -2, 4, 4, -3, 0, 3, 3, 0, -1, 5, 2,
--1, 3, 3, 2, 2, 2, 3, 4, 18, 25, 15, 22, 36, 43, 38, 32,
-44, 47, 37, 37, 33, 28, 23, 18, 16, 1, -7, 0, -8, -19, -21, -20,
--19, -25, -23, -20, -23, -18, -14, -14, -14, -12, -2, -3, -7, -2, 1, 1,
-1, 1, 3, 0, 2, 6, 1, -1, 3, 4, 5, 2, 2, 7, 4, 6,
-8, 4, 5, 6, 7, 7, 1, 4, 6, 1, 0, 2, -1, 0, 10, 23,
-16, 12, 29, 41, 36, 32, 37, 43, 36, 34, 36, 25, 17, 19, 16, 5,
--7, -4, -3, -14, -17, -15, -19, -19, -17, -15, -18, -21, -11, -8, -13, -13,
--7, -3, -6, -5, 0, -3, -4, 3, 4, 0, -2, 4, 7, 3, 3, 7,
-6, 4, 8, 9, 5, 4, 8, 9, 4, 3, 6, 4, 3, 3, 2, 1,
--2, 1, 2, -4, -3, 11, 23, 16, 15, 28, 37, 35, 34, 37, 36, 31,
-33, 32, 21, 12, 13, 14, 5, -4, -4, -6, -11, -11, -10, -14, -19, -15,
--10, -14, -18, -16, -13, -13, -15, -12, -13, -16, -12, -7, -9, -12, -10, -3,
--5, -4, 0, 0, 0, 3, 7, 7, 3, 7, 10, 8, 8, 8, 8, 7,
-7, 11, 7, 3, 6, 7, 5, 3, 3, 4, 1, 2, 15, 23, 17, 18,
-27, 31, 30, 28, 29, 24, 18, 22, 21, 11, 5, 5, 6, 3, -2, -1,
--4, -8, -3, -2, -6, -9, -10, -6, -8, -11, -9, -13, -14, -10, -10, -11,
--13, -12, -7, -8, -7, -5, -7, -5, -1, -1, 0, -1, 0, 3, 4, 4,
-4, 3, 4, 6, 6, 6, 6, 5, 6, 7, 7, 6, 4, 5, 6, 5,
-4, 4, 1, 5, 18, 24, 22, 24, 29, 33, 35, 34, 32, 27, 21, 23,
-22, 15, 9, 6, 5, 5, 4, 2, -1, -5, -3, 0, -3, -7, -10, -10,
--10, -11, -11, -14, -18, -15, -13, -13, -13, -14, -13, -11, -8, -6, -8, -9,
--7, -5, -4, -3, -4, -4, -2, 0, 2, 3, 2, 3, 4, 5, 7, 6,
-6, 6, 6, 7, 7, 6, 5, 4, 5, 6, 4, 4, 14, 23, 24, 27,
-31, 33, 34, 35, 35, 31, 23, 22, 22, 17, 13, 10, 7, 5, 4, 5,
-4, -1, -3, -1, -3, -5, -4, -8, -11, -11, -12, -10, -13, -15, -13, -13,
--13, -10, -10, -10, -10, -9, -6, -6, -6, -4, -4, -4, -2, 0, 1, 0,
-0, 3, 3, 3, 5, 5, 4, 5, 7, 7, 5, 6, 6, 5, 5, 6,
-5, 4, 3, 3, 8, 20, 25, 26, 28, 30, 33, 35, 35, 34, 27, 21,
-22, 20, 16, 15, 12, 8, 6, 8, 9, 6, 2, 1, -1, -4, -4, -5,
--9, -12, -13, -12, -13, -13, -13, -14, -15, -13, -11, -10, -10, -11, -9, -9,
--8, -5, -5, -6, -5, -3, -1, 0, 1, 2, 1, 2, 5, 5, 5, 5,
-5, 5, 6, 7, 7, 6, 5, 6, 5, 5, 6, 5, 3, 7, 19, 24,
-26, 30, 31, 31, 33, 35, 35, 27, 21, 21, 17, 15, 16, 13, 9, 6,
-7, 8, 5, 4, 4, -3, -5, -4, -6, -7, -10, -12, -13, -15, -13, -11,
--12, -13, -13, -12, -10, -10, -8, -8, -10, -8, -6, -6, -3, -3, -3, -2,
--1, 1, 3, 2, 4, 4, 2, 5, 6, 5, 6, 5, 5, 6, 5, 6,
-6, 4, 4, 4, 4, 4, 4, 9, 19, 23, 27, 30, 31, 32, 33, 33,
-32, 26, 21, 20, 16, 15, 15, 13, 10, 8, 7, 8, 6, 5, 3, -1,
--4, -5, -6, -7, -9, -11, -12, -13, -13, -11, -11, -11, -10, -11, -11, -9,
--9, -8, -8, -8, -7, -7, -5, -3, -3, -2, -2, 0, 1, 1, 3, 3,
-2, 3, 4, 3, 5, 5, 4, 5, 4, 5, 5, 5, 5, 5, 3, 3,
-3, 6, 15, 22, 25, 30, 31, 30, 32, 34, 35, 32, 27, 24, 20, 17,
-19, 18, 15, 13, 11, 10, 8, 8, 8, 4, 0, -2, -5, -6, -7, -8,
--10, -12, -13, -12, -12, -11, -11, -11, -12, -12, -11, -10, -10, -9, -8, -9,
--8, -6, -6, -3, -3, -2, -1, -1, 0, 2, 2, 3, 4, 3, 3, 4,
-6, 7, 7, 7, 8, 7, 7, 8, 8, 7, 6, 6, 12, 20, 26, 31,
-34, 33, 32, 34, 34, 33, 30, 26, 21, 17, 15, 16, 15, 14, 12, 9,
-7, 6, 6, 4, 2, -1, -4, -8, -9, -9, -10, -11, -11, -12, -13, -13,
--11, -10, -11, -10, -11, -11, -10, -8, -6, -6, -4, -3, -3, -2, 0, 1,
-2, 2, 3, 3, 2, 4, 5, 5, 5, 6, 5, 5, 5, 5, 6, 5,
-5, 4, 3, 3, 4, 3, 2, 3, 10, 17, 22, 28, 31, 30, 30, 31,
-30, 29, 28, 25, 20, 17, 16, 16, 15, 15, 15, 11, 9, 8, 6, 4,
-3, 0, -3, -5, -7, -7, -8, -8, -8, -8, -9, -10, -9, -9, -8, -8,
--7, -8, -8, -7, -6, -5, -4, -3, -3, -3, -2, 0, 0, 1, 2, 2,
-2, 2, 3, 3, 3, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 2,
-2, 2, 1, 3, 11, 17, 23, 29, 30, 30, 31, 31, 31, 30, 29, 27,
-24, 21, 20, 20, 19, 18, 17, 14, 10, 7, 5, 3, 1, 0, -3, -6,
--7, -8, -8, -8, -8, -8, -10, -10, -10, -10, -9, -8, -7, -7, -7, -6,
--5, -4, -3, -2, -1, -1, 0, 0, 1, 2, 3, 3, 3, 4, 4, 4,
-4, 5, 5, 4, 4, 4, 3, 3, 3, 3, 2, 1, 1, 1, 0, 0,
-1, 6, 13, 18, 24, 27, 27, 27, 27, 27, 27, 26, 25, 24, 21, 20,
-19, 18, 18, 17, 13, 11, 8, 5, 3, 1, 0, -2, -4, -5, -7, -8,
--7, -7, -8, -8, -9, -10, -10, -10, -9, -8, -7, -6, -5, -5, -4, -3,
--1, -1, 0, 1, 1, 1, 2, 3, 3, 4, 4, 4, 4, 4, 4, 3,
-3, 3, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, -1, -1, 4, 10,
-16, 22, 25, 27, 27, 26, 26, 27, 26, 26, 25, 23, 22, 20, 19, 18,
-16, 13, 11, 7, 4, 2, 0, -2, -3, -5, -6, -7, -8, -8, -9, -9,
--9, -9, -9, -8, -8, -7, -6, -4, -3, -2, -1, -1, 0, 1, 2, 2,
-3, 4, 4, 4, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
-1, 0, 0, -1, -2, -2, -3, -3, -3, -3, -4, -3, 2, 8, 13, 19,
-23, 25, 25, 25, 25, 25, 25, 26, 26, 25, 24, 23, 22, 20, 18, 15,
-12, 9, 6, 3, 1, -1, -2, -4, -5, -6, -8, -8, -9, -9, -10, -10,
--9, -9, -8, -7, -6, -5, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6,
-6, 7, 7, 6, 7, 6, 6, 6, 5, 4, 4, 3, 2, 2, 1, 0,
-0, -1, -2, -2, -3, -3, -3, -3, -3, -4, -1, 4, 9, 15, 20, 23,
-24, 25, 25, 25, 25, 25, 26, 26, 25, 25, 24, 22, 21, 18, 15, 12,
-8, 5, 2, -1, -2, -4, -6, -7, -9, -10, -11, -12, -12, -12, -12, -11,
--10, -10, -8, -7, -6, -4, -3, -2, 0, 1, 2, 3, 4, 5, 6, 6,
-6, 7, 7, 7, 6, 6, 6, 5, 4, 4, 3, 2, 2, 1, 0, 0,
--1, -1, -2, -3, -3, -3, -3, -4, -3, 0, 4, 9, 15, 19, 22, 23,
-24, 24, 24, 24, 24, 25, 24, 24, 23, 22, 20, 18, 16, 14, 11, 8,
-6, 4, 2, 0, -2, -3, -4, -6, -7, -8, -9, -9, -9, -9, -8, -8,
--7, -7, -6, -5, -4, -3, -2, -1, 0, 1, 1, 2, 3, 3, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 1, 0, 0,
-0, -1, -1, -1, -1, -2, -2, 0, 4, 8, 14, 18, 22, 24, 25, 26,
-26, 25, 25, 25, 25, 25, 24, 23, 21, 20, 17, 15, 12, 9, 7, 5,
-3, 1, -1, -3, -4, -5, -6, -6, -7, -7, -7, -7, -7, -6, -6, -5,
--5, -4, -3, -2, -2, -1, 0, 0, 1, 2, 2, 3, 3, 3, 4, 4,
-4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0,
--1, -1, -1, -1, -1, -2, -1, 3, 7, 12, 18, 21, 24, 27, 26, 27,
-27, 26, 26, 26, 26, 26, 25, 24, 23, 20, 18, 16, 12, 10, 7, 5,
-3, 1, -1, -2, -3, -5, -6, -7, -8, -9, -9, -9, -9, -9, -8, -7,
--7, -5, -5, -4, -3, -2, -1, 0, 0, 1, 2, 3, 3, 4, 4, 4,
-5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 1, 0, 0, 0, -1,
--1, -2, -2, -2, -3, -2, 1, 5, 9, 14, 18, 21, 23, 24, 24, 24,
-24, 25, 25, 25, 25, 25, 24, 23, 21, 19, 17, 14, 11, 9, 6, 4,
-3, 1, -1, -2, -4, -5, -7, -7, -8, -9, -9, -8, -8, -7, -7, -6,
--5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 6, 6, 7, 7,
-7, 7, 6, 6, 6, 5, 5, 4, 3, 3, 2, 1, 1, 0, -1, -1,
--2, -2, -3, -3, -3, -1, 3, 7, 11, 15, 18, 20, 21, 22, 22, 23,
-23, 24, 25, 25, 26, 25, 25, 23, 21, 19, 16, 14, 11, 9, 7, 6,
-4, 2, 0, -1, -3, -5, -6, -7, -8, -8, -9, -8, -8, -7, -6, -6,
--5, -4, -3, -2, -1, 0, 1, 3, 4, 5, 6, 6, 7, 7, 7, 8,
-8, 8, 8, 7, 7, 6, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2,
-1, 1, 0, 0, 1, 4, 8, 11, 14, 17, 18, 19, 20, 20, 21, 21,
-22, 23, 23, 24, 24, 23, 22, 20, 18, 16, 14, 12, 10, 8, 7, 5,
-3, 2, 0, -2, -3, -5, -6, -6, -7, -7, -7, -7, -6, -6, -5, -4,
--3, -2, -1, 0, 1, 3, 4, 5, 7, 7, 8, 9, 9, 10, 10, 10,
-10, 10, 10, 9, 8, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -2,
--3, -4, -4, -4, -2, 1, 4, 7, 10, 12, 13, 14, 15, 17, 18, 19,
-21, 22, 23, 23, 23, 23, 22, 21, 19, 18, 16, 15, 13, 11, 9, 8,
-6, 4, 1, 0, -2, -4, -5, -6, -7, -7, -8, -8, -8, -8, -8, -7,
--6, -6, -4, -3, -2, -1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 9,
-10, 10, 10, 10, 9, 9, 8, 8, 7, 6, 5, 4, 3, 2, 1, 0,
--1, -2, -3, -1, 1, 3, 6, 7, 9, 10, 10, 11, 13, 14, 15, 16,
-17, 18, 18, 19, 19, 18, 17, 17, 15, 15, 14, 12, 11, 10, 8, 6,
-5, 3, 2, 0, -1, -2, -3, -4, -5, -6, -6, -6, -6, -6, -6, -6,
--5, -4, -4, -3, -2, -1, 0, 1, 2, 3, 4, 4, 5, 6, 6, 7,
-7, 7, 7, 7, 7, 7, 6, 6, 5, 5, 4, 3, 3, 2, 1, 0,
--1, -1, 0, 2, 4, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
-17, 18, 17, 17, 17, 16, 15, 14, 13, 12, 11, 10, 8, 6, 4, 3,
-1, 0, -2, -3, -4, -6, -6, -7, -8, -8, -8, -8, -8, -8, -7, -7,
--6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 7, 7,
-8, 8, 8, 8, 7, 7, 6, 6, 5, 4, 3, 3, 2, 1, 0, -1,
--1, 1, 3, 5, 6, 7, 8, 9, 9, 11, 12, 13, 14, 15, 15, 16,
-16, 16, 16, 16, 15, 14, 13, 13, 12, 10, 9, 8, 7, 5, 4, 2,
-1, 0, -1, -2, -3, -4, -5, -5, -6, -6, -6, -6, -6, -6, -6, -5,
--4, -4, -3, -2, -1, 0, 1, 1, 2, 3, 4, 4, 5, 6, 6, 6,
-7, 7, 7, 7, 7, 6, 6, 5, 5, 4, 4, 3, 2, 1, 1, 1,
-3, 4, 5, 6, 7, 7, 8, 8, 9, 10, 11, 11, 11, 12, 12, 12,
-12, 12, 11, 11, 10, 9, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
--1, -1, -2, -3, -3, -4, -4, -4, -5, -5, -5, -4, -4, -4, -4, -3,
--3, -2, -2, -1, 0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 1, 1, 2, 3, 5,
-6, 7, 7, 8, 8, 9, 10, 11, 11, 12, 12, 12, 12, 12, 12, 11,
-11, 10, 9, 8, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -2, -3,
--3, -4, -4, -5, -5, -5, -5, -5, -5, -5, -5, -4, -4, -4, -3, -3,
--2, -1, -1, 0, 0, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 3, 4, 5, 5, 6,
-6, 7, 8, 8, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9,
-8, 8, 7, 6, 6, 5, 4, 3, 2, 1, 0, 0, -1, -2, -2, -3,
--3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -2, -2, -1,
--1, 0, 0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3, 4, 4, 4, 5, 5,
-6, 6, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7,
-6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, -1, -1,
--1, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 1, 1, 1, 2, 3, 3, 3, 4, 4, 4, 4, 5,
-5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5,
-5, 4, 4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5,
-5, 5, 5, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 4, 4, 4,
-3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 1, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4,
-5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3,
-3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
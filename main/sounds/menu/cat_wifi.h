@@ -1,304 +0,0 @@
-// TTS sound: cat_wifi
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_cat_wifiSampleRate = 11025;
-const unsigned int menu_cat_wifiSampleCount = 4748;
-const signed char menu_cat_wifiSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2,
-3, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 3, 3,
-2, 2, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1,
--1, -1, -1, -1, -1, 0, 0, 0, 0, 1, 3, 4, 6, 9, 11, 13,
-14, 15, 16, 16, 16, 16, 15, 14, 13, 12, 11, 10, 8, 7, 5, 3,
-1, -1, -3, -4, -5, -5, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6,
--6, -5, -5, -4, -4, -4, -4, -3, -3, -3, -3, -3, -3, -2, -2, -1,
--1, 0, 0, 1, 1, 2, 3, 5, 8, 12, 16, 20, 24, 27, 29, 31,
-31, 30, 28, 26, 23, 21, 18, 15, 13, 10, 7, 4, 1, -2, -5, -8,
--9, -11, -12, -12, -12, -11, -11, -10, -10, -10, -10, -10, -10, -9, -9, -8,
--7, -6, -5, -4, -4, -3, -2, -1, -1, 0, 0, 1, 2, 3, 4, 5,
-6, 6, 6, 7, 9, 12, 15, 20, 25, 30, 33, 36, 37, 35, 32, 29,
-24, 18, 13, 8, 4, 0, -3, -5, -8, -10, -12, -13, -15, -15, -15, -15,
--14, -13, -11, -9, -8, -7, -6, -5, -5, -5, -4, -4, -3, -2, -1, 0,
-1, 2, 3, 4, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4,
-4, 5, 9, 13, 19, 25, 31, 36, 38, 38, 35, 28, 21, 14, 5, -1,
--6, -9, -10, -11, -10, -10, -11, -11, -11, -12, -12, -11, -10, -8, -7, -5,
--3, -2, -1, -1, -1, -2, -1, -1, -1, 0, 2, 3, 5, 5, 6, 6,
-4, 4, 4, 2, 2, 2, 1, 2, 1, 2, 1, 0, 0, -1, 1, 9,
-17, 28, 41, 51, 57, 58, 53, 43, 28, 12, -1, -12, -20, -21, -20, -16,
--11, -8, -6, -5, -8, -9, -10, -12, -11, -8, -6, -3, -1, 0, 0, -2,
--3, -3, -4, -3, 0, 3, 5, 8, 9, 8, 7, 5, 3, 1, -1, -1,
--1, 0, 1, 1, 2, 2, 1, 0, 0, -1, -1, -1, 3, 15, 25, 39,
-55, 64, 66, 63, 51, 33, 13, -6, -20, -28, -30, -25, -17, -10, -3, 1,
-2, -1, -5, -7, -9, -10, -8, -5, -3, -2, -1, -2, -4, -5, -4, -2,
-0, 4, 8, 9, 10, 10, 7, 3, 1, -3, -4, -4, -3, 0, 0, 1,
-1, 0, -1, -1, -1, -1, 0, 0, 1, 1, 8, 23, 35, 51, 67, 73,
-68, 55, 34, 11, -13, -32, -35, -34, -27, -12, 1, 8, 12, 9, 5, -2,
--10, -10, -10, -9, -5, -2, -2, -3, -6, -6, -7, -6, -1, 4, 8, 10,
-11, 10, 5, -2, -5, -8, -9, -8, -3, 1, 3, 6, 6, 3, 1, -1,
--1, -1, -1, 0, 1, 0, -1, -1, 7, 26, 43, 59, 76, 78, 62, 40,
-13, -14, -35, -44, -36, -23, -9, 8, 18, 18, 14, 5, -2, -8, -12, -9,
--5, -4, -4, -6, -9, -12, -13, -9, -2, 4, 8, 11, 10, 3, -1, -7,
--9, -8, -6, -1, 5, 5, 6, 5, 2, 1, -1, -1, 1, 1, 1, 2,
-0, -3, -3, -3, -2, 0, 12, 38, 58, 70, 78, 70, 45, 13, -16, -32,
--40, -38, -18, 1, 12, 18, 19, 15, 4, -5, -4, -5, -8, -6, -6, -10,
--14, -11, -4, 2, 9, 16, 17, 12, 5, -3, -7, -11, -11, -6, -2, 2,
-3, 4, 5, 3, 4, 4, 3, 2, -2, -3, -4, -7, -5, -2, -1, 3,
-3, 5, 4, 1, 12, 40, 57, 68, 72, 59, 32, -1, -27, -31, -30, -23,
--2, 14, 17, 15, 10, 9, 4, -3, -1, -2, -13, -19, -21, -19, -13, -6,
-8, 15, 13, 12, 7, 0, -5, -9, -7, -6, -7, -5, -1, 1, 4, 6,
-9, 10, 5, 2, 0, -6, -7, -6, -4, -2, 0, 2, 6, 3, 3, 5,
-1, 0, 12, 40, 60, 66, 66, 52, 23, -8, -26, -23, -18, -14, 2, 9,
-8, 8, 9, 16, 15, 4, 1, -10, -25, -27, -24, -12, -2, 3, 12, 14,
-8, 6, 3, 2, -2, -8, -9, -10, -10, -6, 0, 8, 10, 9, 11, 5,
--1, -2, -5, -5, -6, -6, -2, -2, 0, 5, 7, 5, 4, 4, 0, -6,
--3, 20, 52, 67, 70, 62, 36, 3, -18, -22, -16, -14, -9, -1, -1, 4,
-12, 20, 25, 14, 2, -10, -25, -26, -23, -14, -2, 2, 5, 10, 8, 11,
-9, 5, 2, -9, -13, -13, -13, -3, 1, 6, 13, 8, 6, 6, 2, 1,
--4, -6, -5, -8, -6, 1, 2, 6, 7, 6, 4, 1, -1, -4, -9, -2,
-31, 59, 65, 60, 46, 27, 3, -11, -6, -6, -16, -17, -11, -2, 6, 16,
-28, 22, 5, -7, -12, -17, -19, -16, -9, -7, -7, 0, 11, 15, 13, 10,
-5, -4, -12, -11, -7, -6, -5, 0, 4, 4, 6, 11, 9, 3, 0, -4,
--7, -7, -6, -2, -2, -1, 4, 5, 6, 5, 3, 2, -3, -6, 11, 46,
-63, 59, 50, 38, 21, 4, 1, 2, -11, -22, -21, -11, 1, 11, 20, 22,
-9, -1, -4, -8, -10, -14, -18, -14, -15, -6, 6, 12, 14, 10, 5, 3,
--3, -5, -4, -7, -10, -7, -3, 4, 6, 8, 10, 7, 5, 2, 0, -1,
--5, -6, -6, -4, -1, 1, 5, 4, 3, 4, 2, 0, 1, 22, 54, 58,
-52, 41, 33, 26, 11, 6, 3, -17, -25, -19, -6, 4, 7, 11, 12, 4,
-1, 3, -1, -9, -18, -19, -15, -12, -3, 6, 6, 5, 7, 9, 8, 3,
--1, -5, -10, -10, -6, -2, -2, 0, 3, 6, 7, 6, 6, 4, -2, -4,
--3, -3, -5, -4, -2, -1, 1, 3, 6, 4, -1, 7, 36, 55, 49, 42,
-39, 37, 28, 19, 13, -3, -18, -18, -10, -2, -4, -1, 5, 4, 5, 7,
-6, -3, -14, -16, -11, -14, -13, -8, -5, -1, 5, 12, 14, 8, 6, 6,
-5, -1, -5, -3, -6, -8, -1, 3, 3, 2, 6, 8, 6, 3, 2, 1,
--4, -6, -3, -4, -5, -4, 0, 3, 0, 2, 5, 22, 44, 44, 41, 38,
-38, 39, 26, 17, 8, -6, -11, -8, -3, -6, -9, -2, 5, 4, 6, 3,
-0, -4, -8, -6, -11, -17, -13, -11, -8, -6, -3, 3, 1, 4, 9, 5,
-4, 1, 0, 2, -4, -2, -1, -1, 0, 0, 6, 6, 2, 6, 6, 3,
-1, 0, 0, -3, -4, -2, -2, -1, -4, 0, 11, 31, 40, 34, 37, 41,
-43, 36, 23, 17, 4, -4, -3, -4, -11, -15, -7, 2, 0, 1, 2, 1,
--1, -3, -5, -11, -19, -17, -15, -16, -16, -14, -8, -3, 0, 4, 6, 4,
-6, 7, 4, 2, -1, 0, -1, -1, 1, 2, 3, 5, 7, 8, 7, 6,
-5, 5, 2, 0, -2, -3, -3, -2, -5, 0, 18, 31, 29, 30, 37, 43,
-39, 30, 24, 16, 6, 3, -1, -8, -14, -12, -4, -4, -6, -2, 0, 1,
--1, -3, -5, -12, -14, -14, -17, -18, -19, -16, -11, -9, -5, -2, 2, 5,
-6, 8, 5, 4, 4, 3, 3, 0, 1, 3, 2, 6, 5, 7, 8, 7,
-9, 7, 5, 5, 2, 1, -2, -4, -3, 3, 14, 15, 16, 23, 30, 34,
-30, 27, 25, 20, 16, 11, 4, -1, -5, -3, -3, -6, -6, -3, -1, -1,
--2, -1, -4, -6, -6, -9, -12, -15, -15, -13, -14, -14, -11, -8, -5, -3,
-0, 1, 1, 3, 4, 3, 2, 2, 2, 2, 1, 2, 3, 4, 4, 6,
-6, 7, 7, 8, 7, 6, 5, 4, 6, 15, 15, 15, 16, 22, 26, 23,
-22, 23, 19, 18, 15, 13, 8, 4, 5, 4, 0, -1, -2, 0, -3, -2,
--3, -5, -6, -6, -6, -8, -11, -10, -9, -10, -10, -10, -9, -9, -8, -5,
--5, -5, -4, -2, -1, -2, -1, 1, 1, 1, 2, 2, 2, 2, 3, 4,
-3, 3, 4, 4, 4, 4, 4, 4, 5, 12, 13, 12, 13, 17, 20, 19,
-17, 19, 17, 16, 16, 15, 12, 8, 9, 9, 6, 5, 3, 3, 2, 1,
-1, -1, -2, -3, -2, -3, -5, -6, -5, -6, -6, -7, -7, -8, -8, -7,
--8, -7, -7, -6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -3, -1, -2,
--1, -1, 0, 0, 0, 1, 1, 1, 4, 8, 7, 7, 8, 11, 12, 12,
-13, 13, 12, 13, 14, 13, 11, 11, 11, 10, 9, 8, 7, 6, 6, 6,
-4, 3, 3, 2, 2, 1, 0, 0, -1, -2, -2, -2, -3, -4, -3, -4,
--4, -5, -5, -4, -6, -5, -5, -5, -5, -5, -5, -5, -5, -4, -4, -4,
--4, -3, -4, -2, -2, -2, -2, -2, 1, 3, 0, 1, 2, 4, 5, 4,
-4, 4, 4, 6, 6, 5, 5, 5, 6, 6, 6, 6, 5, 5, 5, 5,
-4, 5, 4, 3, 4, 3, 4, 3, 2, 3, 1, 2, 2, 1, 1, 0,
-1, 0, 0, -1, 1, -1, -2, -1, -2, -1, 0, 0, -2, -3, -1, 0,
-0, 0, -3, 1, 1, 1, 0, -1, 1, 0, 0, 1, 0, 1, 1, 2,
-0, 0, 3, 1, -1, 1, 1, 1, 1, 0, 0, -1, 2, 2, -1, -1,
-1, 0, 0, 2, 0, -2, 0, 0, 1, 0, 0, 1, -1, -1, 2, 0,
--1, -1, -1, 1, 0, 1, 0, -1, -1, 2, 0, 0, 1, 0, 0, 1,
-2, 1, -1, 1, 1, 2, 2, 0, 2, 0, 0, 2, 1, -1, 1, 0,
-0, -1, 1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -2, -2, 0,
-0, 0, -1, 0, -3, 0, 0, -1, -1, -1, 0, 1, 1, -1, 0, 1,
-1, 1, 1, -1, 0, 1, 2, 0, 1, 0, 0, 1, 1, 0, 0, 1,
-1, 0, 1, 1, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1,
--2, 0, 0, -1, 0, 1, -2, -1, 2, -1, -1, 1, 1, -1, -1, 1,
-0, 0, 1, -1, 0, -1, 1, 0, 0, 0, 0, -1, 2, 0, -1, -1,
-1, 0, 0, 0, 1, -2, 0, 0, 0, 1, 0, 0, -2, 0, 1, 1,
-1, -1, 1, 2, 1, 0, 0, 0, 1, -1, 2, 0, 1, 0, 1, 0,
-0, 1, -1, -1, 2, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0,
-1, -1, 1, 1, 0, -1, 1, 2, 0, 0, 0, 1, 0, 1, 2, -1,
-0, -1, 2, 0, 0, 1, 0, 0, 0, -1, 1, -1, 0, 1, 0, -1,
-1, 1, -2, 1, 0, 1, -2, 0, 0, -1, 1, 0, -1, 0, -1, 2,
--1, 1, 0, 0, -1, 2, 0, -1, 0, 0, 0, -1, 1, 0, -2, 1,
-0, -1, 0, -1, 0, -1, 1, 1, -1, 1, -1, 1, 0, 0, 0, 0,
-0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1,
-0, -1, 1, 0, 0, 1, -1, 1, 0, 1, -1, -1, 0, 1, 1, 1,
--1, 2, 0, 1, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 0, 0,
-0, 1, 0, -1, 1, -1, 1, -1, 0, 1, -1, 1, 0, 0, 1, 0,
--1, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, -1, 0, 0, 0, 0,
-1, -1, -1, 1, 0, 0, 0, 0, 1, -2, 2, 0, 0, 0, 0, 1,
-0, 1, 0, -2, 0, 1, -1, 1, 0, -1, 1, -1, 0, 1, -1, 0,
--1, 1, 0, 0, 1, -1, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -2, 0, 0, 0, 0,
-0, 0, 0, -1, 1, -1, 0, 0, 1, -1, -1, 0, 0, 0, -1, 1,
--1, -1, 1, 0, -1, -1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0,
-0, 1, -1, 1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
-1, 0, 0, -1, 1, 1, 1, 0, 0, 1, -1, 1, 1, -1, 0, 0,
-0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1,
-0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 1,
-0, -1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, 1, 1,
--1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, 0,
-0, 0, -1, 1, -1, 0, 0, 1, -1, 0, 0, 1, 0, 0, 1, -1,
-0, 1, 1, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 1, 0, 0,
--1, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, -1, 1, 0,
-0, -1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, -1, 1, 0, 0,
-1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0,
-1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 1,
--2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, -2, 1, 1,
-0, 0, -1, 1, 0, 0, 1, -2, 0, 0, 0, 1, 0, -1, 0, 0,
-0, -1, 1, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, 1,
-0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 0,
-0, 0, 0, -1, 2, 0, 0, 0, 1, 0, 1, 1, -1, -1, 1, 1,
-0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 1, -2, 0, 0, 0, 0,
--1, -1, 0, -1, 1, 0, -1, 1, -2, 1, 0, 0, 1, -1, 0, 0,
-1, 1, 0, 0, -1, 0, 2, 0, -1, 0, 0, 0, 1, 1, -1, -1,
-0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, -1, 0, 1,
-1, 1, 0, 1, -1, -1, 1, 1, 0, -1, 1, 0, 0, 1, 0, 0,
-0, 0, 1, 0, -1, 0, 1, -1, 0, 1, 1, 0, -1, 1, 0, 0,
-0, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0,
-1, 0, 0, 0, 1, -1, -2, 0, -1, -1, 1, 0, 0, 0, -1, 1,
-0, -1, -1, -1, -1, -1, -1, 1, 0, 0, 1, 1, 0, 1, 1, 1,
-1, 1, 0, -2, -1, -1, 0, 1, 0, 0, 0, -1, 0, 0, -1, -1,
--2, -1, -1, 0, 1, 1, 1, 0, -1, -2, -2, -2, -1, 0, 1, 2,
-2, 3, 3, 2, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, -1, -1, -1,
--1, 0, 0, 0, 1, 0, 0, 7, 19, 27, 32, 34, 28, 17, 5, -2,
--5, -8, -5, -2, -1, 0, 1, 3, 4, 3, 3, 1, -4, -8, -12, -13,
--13, -12, -8, -4, -1, 1, 3, 4, 3, 2, 1, -1, -2, -3, -3, -2,
-0, 2, 3, 5, 6, 5, 4, 3, 1, -1, -1, -2, -2, -2, -2, 1,
-0, 0, 3, 2, 1, 1, 0, -1, -3, -2, 13, 38, 57, 68, 71, 57,
-27, -3, -20, -26, -26, -17, -2, 5, 4, 7, 9, 10, 10, 10, 6, -4,
--18, -25, -27, -26, -17, -4, 4, 9, 11, 12, 9, 3, 1, -2, -7, -11,
--10, -8, -6, 0, 9, 11, 10, 12, 7, 1, -2, -4, -5, -7, -5, -2,
--2, 1, 4, 6, 6, 5, 3, 1, -4, -4, -5, -5, -4, 4, 29, 55,
-67, 73, 62, 34, 1, -25, -31, -28, -20, -2, 11, 12, 13, 13, 13, 9,
-2, -3, -15, -27, -29, -26, -16, -4, 7, 16, 16, 10, 6, 0, -6, -7,
--10, -9, -9, -8, 0, 4, 8, 14, 12, 9, 4, -4, -5, -8, -9, -4,
--2, 0, 3, 5, 7, 5, 3, 4, -1, -5, -4, -6, -6, -3, 1, 2,
-3, 18, 47, 62, 64, 62, 41, 5, -22, -29, -22, -13, 2, 23, 26, 17,
-15, 14, 7, -2, -6, -11, -23, -28, -20, -9, 1, 9, 17, 17, 5, -3,
--5, -10, -13, -11, -7, -5, -5, 2, 10, 9, 9, 10, 4, -3, -8, -7,
--7, -7, 0, 4, 4, 5, 5, 6, 4, -1, -1, -2, -6, -7, -6, -2,
--1, 1, 6, 5, 1, 12, 38, 54, 55, 51, 33, 0, -26, -29, -16, -4,
-11, 27, 26, 15, 9, 7, 3, -5, -8, -10, -21, -22, -11, -2, 7, 13,
-15, 10, -3, -8, -9, -12, -11, -6, -2, -2, 0, 6, 9, 8, 6, 3,
--1, -9, -9, -4, -4, 0, 5, 6, 7, 3, 3, 3, -3, -4, -3, -4,
--4, -3, 3, 5, 2, 4, 4, 0, -4, -4, 11, 37, 53, 59, 52, 27,
--3, -23, -26, -14, 1, 15, 23, 22, 15, 9, 7, 5, -3, -9, -15, -21,
--20, -9, 3, 11, 13, 12, 4, -5, -10, -10, -9, -9, -4, 0, 1, 3,
-9, 9, 5, 2, -1, -6, -9, -5, -2, 0, 2, 6, 6, 3, 3, 3,
--1, -3, -4, -3, -4, -2, 3, 3, 3, 4, 2, 1, -2, -3, -1, 11,
-41, 55, 55, 48, 24, -5, -23, -22, -6, 4, 14, 24, 19, 12, 11, 10,
-7, -4, -10, -14, -21, -17, -5, 6, 9, 9, 10, 2, -7, -6, -6, -11,
--11, -8, -4, -2, 2, 12, 9, 3, 2, -3, -7, -8, -5, 0, -2, 0,
-6, 5, 3, 6, 4, -1, -3, -4, -3, -4, -1, 3, 3, 3, 3, 2,
-2, -1, -2, -2, 0, 23, 50, 55, 52, 40, 13, -10, -19, -10, 1, 5,
-15, 20, 15, 16, 19, 15, 5, -8, -15, -20, -19, -9, 2, 8, 8, 6,
-5, 0, -4, -5, -9, -12, -13, -11, -3, 3, 7, 9, 7, 1, -3, -4,
--4, -6, -5, -3, -1, 0, 4, 8, 6, 4, 2, -1, -5, -5, -2, -1,
--1, 1, 2, 4, 3, 3, 3, 0, -4, -4, -2, 16, 43, 53, 51, 40,
-18, -3, -15, -8, 1, 4, 10, 16, 16, 17, 20, 21, 7, -7, -12, -18,
--18, -7, 0, 5, 6, 5, 6, 3, 0, -2, -9, -13, -14, -11, -4, 1,
-6, 7, 4, 2, -1, -1, -3, -7, -5, -3, -1, 3, 7, 8, 5, 2,
-2, -1, -3, -1, -1, -2, -1, 2, 4, 4, 4, 4, 0, -2, -2, -2,
--3, -1, 19, 43, 51, 48, 37, 17, -4, -13, -6, 2, 3, 9, 16, 17,
-20, 22, 20, 8, -9, -14, -15, -15, -7, 1, 5, 4, 4, 8, 5, 2,
-0, -6, -11, -12, -6, -3, 0, 4, 6, 2, 3, 3, 0, -3, -7, -6,
--4, -5, 1, 5, 3, 3, 3, 3, 0, -2, -1, -3, -5, -2, 1, 2,
-2, 3, 5, 0, -1, 1, -1, -3, -3, 5, 26, 45, 50, 43, 27, 9,
--4, -8, 0, 5, 4, 8, 16, 24, 27, 24, 18, 1, -12, -12, -9, -7,
--4, -1, 3, 3, 9, 13, 6, -3, -9, -13, -13, -10, -5, -1, -2, 0,
-5, 5, 4, 1, -3, -9, -11, -5, -2, -2, 1, 3, 3, 2, 4, 6,
--2, -5, -3, -4, -3, 1, 3, 4, 0, 4, 5, 1, 0, -1, -5, -5,
--5, 1, 19, 38, 44, 38, 28, 16, 4, 0, 2, 1, 0, 5, 13, 22,
-25, 23, 15, 5, -3, -6, -5, -6, -7, -4, 0, 5, 10, 11, 6, -1,
--7, -9, -8, -8, -8, -6, -4, 0, 4, 6, 4, -1, -4, -5, -6, -6,
--4, -3, -3, 0, 4, 4, 3, 0, -2, -3, -3, -2, -2, -2, -1, 0,
-3, 4, 3, 2, -1, -1, -1, -1, -1, -1, 0, 16, 36, 40, 33, 24,
-15, 7, 2, 5, 6, -2, 2, 14, 22, 24, 20, 15, 5, -4, 0, -1,
--6, -8, -7, 0, 6, 9, 10, 3, -3, -5, -5, -5, -7, -10, -7, -4,
-1, 5, 4, 1, -3, -2, 0, -4, -5, -6, -6, -3, 2, 4, 3, 1,
-1, 2, 1, -1, -2, -3, -4, 0, 2, 3, 2, 1, 2, 2, 2, 2,
--2, -3, -2, 0, 15, 31, 31, 27, 22, 19, 13, 8, 7, 4, -4, 2,
-13, 17, 16, 14, 15, 10, 6, 7, -1, -9, -9, -6, -1, -1, 0, 3,
-1, 2, 3, 0, -5, -11, -9, -6, -8, -6, -3, -3, -1, 2, 3, 0,
--4, -4, -4, -4, -4, -3, -4, -1, 2, 4, 3, 2, 1, 1, -1, 0,
-0, -2, -2, 0, 2, 3, 2, 3, 2, 1, 2, 1, 1, 9, 22, 23,
-19, 19, 21, 17, 13, 11, 7, 0, 3, 10, 10, 8, 9, 12, 11, 8,
-8, 3, -4, -5, -2, -3, -5, -4, -2, 0, 0, 2, 0, -4, -6, -4,
--5, -8, -8, -6, -6, -2, -1, -1, -1, -2, -1, 0, -2, -3, -4, -3,
--2, -2, -1, 0, 0, 2, 2, 2, 1, 0, 2, 0, 0, 1, 0, 0,
-1, 2, 3, 1, 1, 3, 11, 20, 19, 16, 18, 19, 18, 13, 10, 7,
-3, 7, 10, 8, 7, 9, 10, 11, 8, 7, 2, -2, 0, -1, -5, -6,
--5, -2, -2, -1, -1, -3, -3, -3, -3, -6, -8, -8, -6, -6, -4, -5,
--4, -2, 0, 0, -2, -3, -1, -2, -2, -2, -3, -2, 1, 1, 1, 2,
-3, 3, 2, 3, 2, 0, 1, 2, 1, 1, 1, 3, 2, 3, 2, 3,
-13, 20, 14, 15, 18, 19, 15, 12, 11, 6, 3, 10, 7, 4, 6, 8,
-10, 7, 7, 5, 0, 1, 0, -4, -7, -7, -4, -5, -6, -4, -5, -4,
--3, -3, -5, -8, -6, -6, -8, -8, -7, -6, -4, -3, -2, -2, -1, 0,
-1, -1, -1, -1, -1, 0, 0, 0, 1, 3, 4, 4, 3, 4, 4, 4,
-3, 3, 2, 2, 2, 3, 1, 1, 2, 6, 12, 11, 9, 14, 17, 15,
-12, 10, 10, 7, 7, 6, 3, 3, 6, 8, 6, 4, 6, 6, 3, 2,
-0, -3, -4, -3, -4, -7, -6, -3, -3, -5, -4, -3, -4, -4, -4, -6,
--7, -7, -4, -6, -7, -4, -3, -2, -2, -1, -1, 0, 0, 1, -2, -1,
--1, 0, 0, 0, 1, 2, 2, 3, 3, 3, 3, 3, 3, 2, 1, 3,
-2, 0, 2, 7, 10, 8, 10, 14, 14, 14, 12, 11, 10, 8, 8, 6,
-3, 6, 6, 6, 5, 5, 7, 6, 5, 4, 1, 1, 0, -2, -3, -6,
--3, -3, -5, -4, -3, -2, -2, -3, -3, -3, -4, -4, -5, -6, -5, -5,
--5, -5, -4, -3, -3, -2, -1, -2, -1, -1, -1, -1, -2, -1, -1, -1,
-0, 0, 1, 2, 1, 2, 2, 2, 3, 2, 1, 2, 5, 8, 6, 7,
-11, 12, 12, 10, 11, 12, 10, 9, 8, 6, 7, 7, 6, 5, 6, 8,
-7, 5, 6, 6, 4, 3, 2, 1, 0, 0, -1, -2, -2, -1, -2, -2,
--2, -2, -2, -3, -3, -3, -4, -4, -4, -5, -5, -5, -4, -4, -4, -3,
--3, -3, -3, -2, -2, -3, -3, -2, -2, -3, -1, -1, -1, -1, 0, 0,
-0, 1, 1, 0, 1, 3, 5, 4, 4, 8, 8, 7, 7, 9, 9, 7,
-7, 8, 6, 7, 7, 6, 6, 7, 7, 6, 5, 6, 6, 5, 4, 4,
-4, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -2,
--3, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -2, -3, -2, -2, -2, -2, -1, -1, -1, -1, 1, 3,
-1, 2, 5, 6, 4, 4, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
-5, 6, 5, 5, 6, 5, 5, 4, 4, 4, 3, 3, 3, 3, 3, 2,
-2, 2, 1, 2, 1, 1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
--2, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -1, 1, 0, 0, 2, 3, 2, 2, 3,
-3, 2, 3, 3, 3, 3, 3, 4, 4, 3, 4, 4, 3, 4, 3, 3,
-2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
--2, -2, -2, -2, -2, -3, -3, -2, -3, -3, -3, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -2, -2, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2,
--1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -1,153 +0,0 @@
-// TTS sound: menu_back
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_menu_backSampleRate = 11025;
-const unsigned int menu_menu_backSampleCount = 2322;
-const signed char menu_menu_backSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0,
-0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
--1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-0, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 1, 1,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0,
--1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 3, 3, 3, 4,
-4, 4, 3, 2, 2, 1, 1, 1, 1, 2, 1, 0, 0, 0, -1, 0,
-0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -2,
--2, -1, -1, 0, 0, -1, 0, -1, 1, -1, -1, -2, -2, -1, 0, -1,
--1, -1, 0, 1, 2, 2, 0, 1, 2, 1, 1, 0, 0, -2, -2, -1,
--1, 0, -2, -1, -1, 0, 2, 2, 2, 2, 3, 5, 6, 5, 5, 3,
-3, 3, 4, 4, 1, 1, 1, 2, 2, 1, 2, 2, 0, 2, 2, 1,
-0, -1, -1, -2, -2, -2, -2, -3, -2, 4, 10, 10, 10, 11, 11, 11,
-12, 11, 9, 3, 1, 1, 1, -1, -2, -2, -4, -3, -2, 0, -1, -2,
--2, -3, -3, -3, -4, -4, -6, -6, -5, -4, -3, -3, -3, -2, -1, 0,
-1, 1, 1, -2, -1, 0, -1, 0, -2, -1, 0, -1, 2, 2, 1, 2,
-1, 3, 3, 1, 2, 0, 0, -1, -1, 0, -1, -2, -1, 8, 27, 33,
-31, 31, 31, 31, 28, 24, 21, 5, -5, -7, -7, -9, -13, -14, -11, -11,
--4, 0, 1, 0, -5, -3, -2, -6, -8, -11, -8, -6, -6, 0, 3, 2,
-4, 8, 10, 8, 5, 6, 3, 0, 1, 0, -3, -3, -4, 1, 0, 0,
-4, 1, 2, 3, 1, 4, -2, -3, 0, -4, -2, -3, -4, -1, -2, 1,
-1, 8, 38, 56, 55, 48, 44, 48, 39, 27, 23, 2, -18, -24, -17, -10,
--19, -18, -6, -4, 4, 11, 12, 5, -7, -3, -1, -10, -13, -16, -15, -11,
--7, 5, 6, 2, 6, 11, 13, 9, 3, 1, -4, -7, -3, -2, -5, -7,
--3, 4, 5, 5, 6, 5, 2, 0, 4, 1, -6, -6, -5, -3, -3, -1,
-2, -1, 1, 4, 4, 10, 34, 65, 59, 44, 44, 36, 28, 16, 4, -7,
--31, -29, -10, -7, -4, -6, 4, 11, 9, 20, 14, -6, -11, -13, -5, -12,
--19, -9, -12, -6, 8, 12, 13, 4, 5, 10, 5, 2, -5, -9, -10, -9,
--1, 1, -2, 2, 2, 8, 10, 6, 2, -1, -3, -3, -3, -2, -6, -10,
--11, -4, 0, -1, -2, 0, 0, 0, 4, 4, 5, 41, 71, 67, 54, 42,
-42, 27, 9, 8, -15, -38, -31, -13, 3, -4, 0, 16, 11, 15, 21, 10,
--3, -24, -17, -7, -16, -15, -9, -5, 2, 7, 22, 15, 1, 3, 5, 1,
--7, -10, -8, -15, -6, 5, 5, 0, -2, 7, 6, 2, 4, -3, -8, -8,
--4, 5, -4, -3, 1, 3, 5, 5, 5, 1, -7, 0, 0, 0, -5, 6,
-51, 75, 68, 58, 44, 34, 20, 8, 0, -30, -42, -28, -9, 5, 8, 12,
-17, 13, 21, 18, 6, -17, -28, -17, -13, -15, -6, -4, 0, 4, 17, 22,
-6, -4, -3, -8, -8, -6, -6, -9, -9, 4, 13, 10, 8, 3, 0, 1,
-0, -2, -7, -10, -8, -2, 6, 5, 3, 3, 3, 4, 2, 1, -1, -11,
--5, 1, 0, -1, 12, 57, 79, 64, 55, 41, 21, 8, 0, -8, -31, -40,
--18, 2, 12, 19, 21, 19, 8, 9, 10, -9, -26, -28, -19, -9, -5, 10,
-10, 5, 13, 16, 13, 0, -11, -13, -16, -9, -2, -3, 1, 2, 8, 15,
-10, 5, -2, -7, -7, -5, -4, -5, -5, -1, 5, 8, 8, 6, -1, -2,
--1, -3, -2, -6, -6, -1, 2, 5, 4, 4, 30, 68, 72, 54, 36, 21,
-9, -3, -4, -11, -31, -24, 3, 20, 24, 21, 18, 6, -1, 4, -4, -20,
--27, -21, -5, 1, 10, 15, 8, 4, 9, 9, 1, -13, -14, -13, -11, -1,
-8, 5, 3, 5, 11, 8, 2, -3, -9, -11, -7, 0, 0, -1, 2, 4,
-7, 7, 5, 3, -4, -4, -1, -1, -3, 0, 1, -1, 4, 8, 1, -2,
-17, 57, 69, 56, 42, 26, 10, 1, 0, -5, -26, -24, -3, 14, 24, 23,
-20, 5, -4, 2, -1, -16, -25, -22, -7, -2, 12, 19, 7, 2, 7, 6,
-0, -9, -13, -15, -13, 2, 8, 7, 5, 5, 12, 11, 4, 3, -9, -11,
--4, -1, 3, 1, 2, 6, 3, 9, 6, -3, -4, -9, -4, 0, -3, 2,
-1, 1, 3, 4, 8, -4, -7, 17, 55, 69, 57, 40, 24, 8, 3, 1,
--5, -25, -24, -1, 17, 27, 24, 17, 5, -6, 0, -2, -18, -23, -22, -8,
-5, 12, 15, 7, -1, -1, 0, 0, -11, -16, -11, -7, 3, 11, 11, 6,
--1, 3, 5, -4, -5, -7, -11, -4, 3, 8, 7, 1, 4, 4, 0, 0,
--3, -6, -8, -5, 4, 4, 2, 4, 3, 0, 1, 2, -2, -8, 14, 57,
-72, 56, 40, 26, 8, -4, -1, -3, -26, -26, 0, 19, 27, 28, 20, 2,
--12, -6, -5, -20, -23, -19, -6, 7, 17, 23, 11, -5, -2, -2, -7, -14,
--13, -8, -9, 5, 20, 14, 5, 2, 1, -4, -7, -4, -8, -11, -4, 7,
-12, 7, 7, 2, -2, -3, -2, -3, -8, -8, 1, 2, 5, 8, 5, 0,
--4, -4, -1, -4, -8, -1, 31, 65, 67, 54, 34, 10, -3, -8, -4, -9,
--17, -3, 15, 29, 36, 25, 12, -8, -17, -13, -14, -17, -15, -7, 6, 14,
-22, 18, 1, -7, -13, -11, -11, -11, -8, -3, 2, 14, 16, 12, 2, -6,
--7, -9, -8, -4, -5, -2, 3, 9, 13, 6, 3, -3, -8, -6, -4, -3,
--1, -2, 5, 6, 6, 7, 0, -3, -5, -7, -1, -2, -2, 2, 18, 59,
-68, 55, 35, 12, -2, -10, -6, 1, -10, -3, 14, 28, 34, 26, 15, -6,
--22, -17, -12, -13, -10, -6, 7, 11, 18, 18, 3, -12, -15, -14, -10, -10,
--3, 2, 1, 10, 16, 11, 1, -7, -9, -10, -11, 0, 1, 0, 5, 8,
-11, 7, -1, -3, -8, -10, -4, 0, 2, 0, 4, 7, 5, 3, 1, -3,
--7, -7, -1, -1, 1, 3, 3, 17, 51, 62, 48, 29, 12, -2, -8, -1,
-6, -1, -1, 14, 27, 28, 21, 11, -7, -18, -17, -9, -9, -8, -5, 3,
-11, 12, 11, 2, -11, -15, -15, -10, -5, -6, 0, 4, 7, 10, 8, 2,
--6, -12, -7, -5, -3, 1, 1, 5, 7, 6, 7, 2, -5, -6, -6, -2,
--2, 1, 3, 3, 4, 6, 4, 0, -5, -4, -5, -3, 0, 3, 4, 2,
-3, 24, 46, 44, 29, 18, 9, 3, 1, 7, 7, -2, 3, 18, 23, 21,
-13, 5, -5, -12, -7, -3, -8, -8, -3, 4, 7, 8, 4, -2, -10, -11,
--7, -7, -6, -5, -2, 2, 4, 7, 5, -3, -6, -5, -4, -3, -2, -1,
-1, 2, 5, 4, 0, -2, -3, -4, -3, -2, -1, 0, 1, 3, 4, 2,
-1, -1, -2, -2, -2, -1, -1, 0, 2, 1, 2, 10, 33, 41, 33, 20,
-13, 9, 4, 4, 7, 2, 0, 8, 19, 23, 15, 6, 3, -5, -6, -4,
--6, -8, -9, 0, 7, 6, 4, -1, -4, -7, -10, -9, -10, -10, -7, -2,
-3, 4, 2, 0, -2, -4, -5, -5, -6, -6, -2, 2, 4, 5, 4, 3,
-1, 0, 0, -2, -3, -1, 0, 2, 4, 4, 3, 2, 2, 0, -1, -2,
--1, -2, -1, 3, 2, 0, 8, 28, 40, 30, 18, 13, 9, 5, 4, 7,
-2, 0, 8, 21, 23, 14, 7, 4, 0, -3, -5, -4, -9, -9, -1, 6,
-8, 2, -2, -2, -4, -7, -7, -8, -10, -9, -2, 3, 3, 0, 0, -1,
--2, -3, -4, -5, -5, -4, 1, 4, 4, 2, 2, 3, 1, 0, -1, -2,
--2, -1, 1, 4, 3, 2, 2, 2, 2, 1, -2, -2, -2, -1, 0, 1,
-1, 4, 22, 33, 26, 15, 9, 12, 10, 4, 4, 3, 1, 6, 14, 20,
-13, 4, 4, 4, 2, -4, -7, -5, -8, -4, 4, 4, 1, -2, -3, 0,
--3, -7, -9, -10, -6, -3, -1, 1, -1, -1, 0, 0, 0, -5, -5, -3,
--2, 0, 1, 1, 2, 2, 4, 4, 1, 1, -2, 0, 2, 0, 2, 0,
-2, 3, 2, 4, 1, 0, 0, 0, 1, -1, -1, 0, 0, 8, 23, 26,
-20, 10, 11, 16, 11, 3, 2, 1, 4, 8, 13, 14, 8, 5, 7, 7,
-4, -4, -7, -6, -4, -1, 0, 1, 0, -1, 2, 2, -2, -7, -9, -7,
--5, -6, -5, -4, -2, 0, 1, 1, -1, -4, -3, -3, -2, -3, -5, -2,
-1, 2, 3, 2, 2, 2, 1, 1, 0, -1, -1, 0, 2, 3, 2, 2,
-2, 3, 3, 1, 0, 0, -1, 1, -1, 2, 11, 19, 17, 12, 11, 16,
-16, 9, 5, 4, 6, 6, 7, 10, 9, 7, 8, 10, 10, 3, -1, -2,
-0, -1, -4, -4, -2, -1, -1, -1, -2, -3, -5, -5, -4, -6, -8, -9,
--6, -3, -4, -4, -4, -3, -2, -3, -2, -4, -4, -4, -2, -1, -1, -1,
-0, 2, 2, 2, 1, 1, 2, 2, 2, 1, 1, 2, 2, 3, 3, 3,
-2, 3, 3, 3, 2, 1, 2, 6, 10, 8, 6, 5, 8, 9, 7, 3,
-2, 4, 4, 4, 4, 3, 3, 3, 5, 4, 2, -1, 0, 1, 0, -2,
--3, -2, -1, -1, -2, -2, -3, -3, -2, -2, -3, -4, -5, -4, -3, -3,
--4, -4, -3, -2, -2, -3, -3, -2, -2, -1, -1, -2, -2, -1, 0, 1,
-0, 0, 0, 1, 2, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 1, 2, 4, 6, 6, 4, 4, 6, 7, 5, 3, 3, 4, 4,
-3, 3, 3, 3, 3, 4, 4, 2, 2, 2, 2, 2, 0, 0, 0, 1,
-1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3, -3, -2,
--2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -2, -1, -1,
--1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0,
-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 1,
-0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0
-};
@@ -1,299 +0,0 @@
-// TTS sound: menu_cancel
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_menu_cancelSampleRate = 11025;
-const unsigned int menu_menu_cancelSampleCount = 4658;
-const signed char menu_menu_cancelSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, -1, 1, 1, -1, 0, 0, 0, -2, 0,
-0, -1, 1, 0, 0, 0, 1, -1, 2, 0, -1, -1, 1, -1, 0, 1,
-1, -1, 0, 0, 0, 0, 1, -1, -1, 1, 0, 0, 0, 2, -2, 1,
-0, 0, -1, 1, -1, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1,
-0, -2, -1, 0, 0, -2, 1, -4, 0, -2, -1, 1, -2, 2, -1, -1,
-3, 0, 0, 2, -2, 2, 0, 3, -2, 2, 0, 0, -2, 1, -2, 1,
--4, 0, 0, -1, 0, -2, 1, -1, 2, -3, 1, -1, 1, -2, 1, 0,
-1, 0, 2, -1, 2, 1, 2, -5, 3, 0, -2, -2, 3, -3, -1, 0,
-1, -4, 1, 0, -2, 3, -2, 3, 0, 2, 1, 1, 2, -2, 0, 3,
--1, -1, 0, 4, -3, 0, 3, 0, -1, 3, -2, 3, 0, -3, 2, 2,
--4, -1, 4, -1, -3, 4, -1, 0, 1, 2, -1, -3, 2, 1, -3, 0,
-1, 3, -5, 2, 3, -2, 3, 0, 0, 3, -1, -2, 4, -2, -2, 1,
-4, -4, 1, 3, -2, 2, 0, 2, -3, -2, 2, -1, -6, 6, -3, -4,
-4, -2, -1, 2, -2, 1, -2, 2, -3, 1, 2, -1, -1, 4, 1, -3,
-7, 0, 1, 1, 0, 1, 2, -3, 0, 0, 0, -3, -1, 1, -2, -1,
-1, -1, 2, -1, 3, -5, 4, 4, -5, 2, 7, -3, -2, 4, 4, -5,
-3, 1, -2, 3, 0, 2, 0, 3, -1, 2, -1, 2, -5, 4, -5, 0,
-0, 0, 3, -2, -2, 6, -4, 0, 3, -2, -2, 4, -1, -2, 4, 0,
-0, 0, 3, -1, 2, -3, 5, -4, 1, -1, 1, -3, 2, 3, -4, -1,
-7, -4, -1, 2, -1, 3, -8, 5, -3, -1, -3, 4, -4, 3, -4, 5,
--4, -1, 1, -2, -1, 4, -7, 6, 0, -1, -1, 5, 0, -4, 2, 1,
--3, 1, 1, -3, 4, 0, 1, -1, 4, 2, -4, -1, 8, -4, -1, 3,
-4, -3, 0, 5, -3, 0, 3, -2, 0, 3, 0, 0, 1, 3, 1, -2,
-4, -3, 1, 0, -2, 0, 0, 2, 0, -4, 6, -1, -2, 1, 2, -4,
-2, 3, -4, 0, 5, 0, -5, 3, 3, -3, 2, 2, -2, 4, 1, -1,
-1, 5, -1, -1, 1, 4, -1, 0, 3, 2, 1, 3, 2, 0, 1, -1,
-1, -2, 0, -1, 0, 2, -1, -2, 3, -1, -1, 1, -1, -2, 2, 0,
--4, 2, 3, 0, -4, 5, 0, -1, 0, 0, -2, 0, -1, 0, -3, 5,
--1, -1, 2, 0, 3, -5, 0, 1, -2, -1, -1, -3, 2, 0, 2, -2,
-2, 2, -3, 2, 2, -3, -1, 0, 1, -6, 0, 2, -4, 1, -1, 1,
--1, 0, 4, -3, 2, 4, -1, 4, 3, 1, 4, 1, 4, 0, 3, 3,
--2, 2, 4, 0, 3, -2, 4, -1, 1, 4, 0, 3, 0, 2, 0, 0,
-3, -3, -1, 2, 3, 8, 4, 6, 13, 12, 12, 8, 11, 12, 8, 5,
-7, 5, 6, 2, 5, 3, 4, 6, 3, 2, 3, 3, 1, -3, 1, -2,
--4, -3, -4, -4, -5, -4, -4, -6, -3, -3, -5, -4, -4, -3, -6, -5,
--3, -7, -4, -3, -5, -2, -3, -2, -1, -3, 2, -1, 0, 1, 0, 2,
-1, 0, 7, 16, 16, 14, 25, 32, 28, 27, 28, 29, 24, 22, 18, 14,
-14, 14, 9, 8, 10, 12, 9, 8, 9, 7, 4, 5, -3, -5, -4, -8,
--12, -12, -11, -12, -14, -8, -8, -12, -5, -3, -7, -8, -5, -6, -10, -6,
--5, -9, -6, -1, -2, -5, 3, 3, 2, 4, 5, 5, 3, 5, 5, -1,
-11, 27, 24, 24, 36, 46, 44, 38, 37, 36, 30, 27, 18, 12, 10, 16,
-9, 5, 11, 13, 9, 10, 7, 3, -2, -2, -8, -18, -16, -14, -20, -21,
--17, -16, -15, -12, -10, -13, -12, -8, -10, -15, -11, -10, -11, -9, -5, -5,
--3, 3, 5, 4, 5, 10, 8, 6, 9, 7, 6, 8, 7, 6, 13, 37,
-40, 33, 43, 57, 54, 43, 38, 34, 25, 22, 16, 5, 2, 11, 10, 5,
-7, 8, 8, 4, -2, -8, -16, -21, -17, -29, -31, -26, -25, -22, -20, -16,
--13, -14, -7, -11, -14, -10, -13, -9, -10, -8, -4, -4, 4, 8, 4, 12,
-13, 13, 13, 12, 10, 9, 11, 8, 6, 10, 10, 7, 16, 41, 51, 38,
-46, 60, 56, 43, 33, 27, 15, 13, 13, -2, -6, 1, 4, 4, -1, -1,
--2, -5, -7, -15, -21, -27, -25, -23, -29, -26, -22, -19, -9, -13, -10, -7,
--8, -4, -5, -10, -6, -8, 0, -1, -2, 6, 6, 11, 16, 8, 13, 14,
-10, 11, 7, 8, 5, 6, 9, 6, 4, 6, 13, 42, 52, 40, 41, 54,
-54, 41, 24, 17, 5, 7, 6, 0, -10, 0, 11, 11, 6, 7, -1, -2,
--3, -9, -24, -28, -22, -21, -22, -21, -17, -12, -6, -1, -4, -10, -3, -4,
--7, -9, -8, -10, -5, 0, 4, 0, 7, 11, 12, 10, 10, 8, 5, 6,
-9, -2, 1, 7, 3, 5, 8, 4, 9, 41, 63, 41, 36, 49, 43, 36,
-30, 14, -4, 1, 15, 5, -6, 5, 9, 9, 14, 13, -5, -12, 0, -6,
--26, -23, -22, -25, -17, -10, -13, -17, -7, 6, -5, -11, -2, -10, -12, -4,
--6, -11, -9, 3, 7, 1, 5, 13, 5, 9, 15, 4, -1, 5, 6, 3,
-1, 7, 1, 3, 12, 6, 8, 41, 64, 42, 38, 48, 37, 36, 32, 14,
--2, -1, 12, 7, -1, 6, 4, 9, 17, 10, -2, -9, -9, -9, -18, -23,
--25, -24, -19, -9, -9, -14, -7, -3, -1, -4, -8, -9, -11, -8, -2, -10,
--7, 1, 2, 6, 10, 7, 7, 7, 10, 6, 2, 3, 2, 0, 5, 5,
-1, 6, 8, 3, 11, 44, 61, 42, 41, 42, 34, 39, 32, 13, -1, -4,
-12, 9, 1, 6, 4, 6, 16, 14, 0, -13, -11, -8, -18, -20, -22, -28,
--20, -7, -7, -12, -10, -2, -4, -3, -4, -10, -15, -9, -2, -6, -6, 2,
-1, 7, 13, 11, 7, 9, 8, 7, 8, 4, -1, 3, 5, 4, 6, 7,
-4, 4, 12, 41, 61, 44, 39, 41, 33, 38, 33, 14, -2, -6, 9, 8,
-3, 6, -2, 6, 15, 11, 4, -12, -15, -8, -17, -20, -21, -26, -24, -11,
--5, -9, -12, -3, -4, -2, 6, -4, -11, -6, -4, 1, 0, -1, 2, 2,
-11, 14, 9, 9, 5, 9, 10, 4, 6, -1, -1, 6, 5, 4, 2, 2,
-8, 33, 59, 46, 34, 38, 33, 34, 33, 19, -3, -8, 6, 6, 5, 6,
-0, 2, 10, 17, 5, -10, -10, -14, -17, -13, -22, -27, -23, -16, -8, -7,
--8, -9, -7, -2, -2, -4, -9, -12, -8, -5, -2, -1, -2, 3, 7, 9,
-14, 8, 5, 9, 6, 6, 7, 1, 2, 3, 5, 7, 6, 4, 8, 32,
-54, 46, 40, 38, 29, 33, 34, 21, 1, -5, 1, 3, 8, 7, 0, 1,
-7, 12, 7, -5, -16, -21, -21, -20, -20, -28, -31, -22, -14, -7, -5, -8,
--10, -9, -1, -2, -9, -9, -13, -9, 0, 3, 1, 2, 8, 10, 13, 17,
-12, 5, 8, 9, 6, 6, 6, 1, 3, 9, 8, 6, 9, 29, 46, 43,
-45, 35, 26, 32, 30, 22, 6, -3, -1, 0, 6, 8, 0, -3, 3, 6,
-3, 0, -10, -21, -20, -16, -19, -22, -23, -23, -19, -10, -5, -8, -10, -7,
--7, -5, -2, -6, -11, -8, -3, -1, 3, 6, 3, 6, 12, 13, 13, 11,
-8, 6, 8, 9, 7, 4, 4, 5, 7, 8, 10, 24, 38, 38, 39, 36,
-29, 30, 29, 23, 12, 3, 2, -2, 2, 6, 1, 0, 2, 5, 7, 5,
-1, -8, -13, -11, -15, -17, -19, -22, -21, -18, -12, -10, -10, -9, -9, -7,
--4, -5, -7, -10, -8, -7, -5, -2, -3, -2, 1, 4, 7, 9, 9, 8,
-7, 9, 8, 8, 7, 6, 5, 5, 6, 9, 16, 22, 26, 30, 32, 35,
-36, 36, 35, 30, 27, 24, 21, 20, 17, 15, 13, 11, 12, 11, 9, 8,
-5, 2, 0, -1, -3, -6, -8, -10, -11, -11, -11, -11, -12, -11, -11, -11,
--9, -10, -10, -10, -9, -9, -8, -6, -7, -6, -4, -4, -2, -1, -1, 0,
-0, 2, 2, 2, 3, 3, 3, 3, 7, 13, 17, 20, 24, 26, 30, 33,
-35, 35, 33, 32, 30, 29, 28, 26, 22, 19, 17, 16, 14, 12, 9, 5,
-3, 1, -1, -2, -5, -7, -9, -9, -9, -10, -10, -10, -11, -10, -9, -8,
--7, -6, -6, -5, -3, -2, -1, 0, 0, 1, 3, 4, 5, 5, 5, 5,
-6, 7, 6, 6, 5, 5, 4, 5, 10, 14, 16, 19, 23, 26, 29, 32,
-34, 33, 32, 32, 32, 31, 30, 27, 24, 22, 20, 18, 15, 13, 9, 6,
-4, 2, -1, -3, -5, -8, -9, -9, -10, -11, -11, -11, -11, -9, -8, -8,
--8, -6, -5, -4, -2, -1, -1, 0, 2, 3, 4, 5, 5, 5, 6, 6,
-6, 6, 6, 6, 5, 5, 5, 7, 11, 14, 17, 20, 24, 27, 30, 33,
-34, 34, 34, 34, 34, 33, 31, 28, 26, 23, 21, 18, 15, 12, 8, 6,
-3, 1, -2, -5, -7, -9, -10, -11, -12, -13, -14, -14, -14, -13, -13, -12,
--11, -10, -8, -7, -5, -4, -3, -1, 0, 2, 3, 4, 5, 6, 6, 7,
-7, 7, 7, 7, 7, 6, 6, 8, 11, 13, 16, 19, 22, 25, 28, 31,
-32, 33, 34, 34, 34, 33, 32, 29, 27, 25, 22, 20, 17, 13, 10, 7,
-4, 2, -1, -3, -5, -7, -8, -9, -10, -11, -12, -12, -12, -11, -10, -10,
--9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 1, 2, 2, 3, 3, 4,
-4, 4, 4, 4, 4, 4, 4, 5, 8, 10, 12, 14, 17, 19, 22, 24,
-26, 27, 27, 28, 29, 29, 28, 27, 26, 25, 24, 22, 20, 18, 16, 14,
-12, 10, 7, 5, 3, 1, 0, -2, -3, -5, -5, -7, -7, -7, -8, -8,
--8, -7, -7, -7, -6, -5, -4, -4, -2, -2, -1, 0, 0, 2, 2, 3,
-3, 4, 4, 4, 5, 5, 5, 6, 9, 10, 12, 13, 14, 15, 16, 16,
-17, 17, 17, 17, 16, 16, 15, 14, 14, 13, 11, 11, 9, 8, 7, 6,
-4, 4, 2, 2, 1, 0, -1, -2, -2, -3, -3, -3, -4, -4, -4, -4,
--4, -4, -4, -4, -4, -4, -3, -3, -2, -3, -2, -2, -1, -1, -1, 0,
--1, 0, 0, 0, 1, 0, 2, 3, 4, 3, 4, 5, 4, 6, 5, 6,
-6, 5, 7, 5, 6, 5, 5, 5, 5, 4, 4, 3, 4, 2, 3, 1,
-2, 0, 1, 1, 0, 0, -1, 0, -1, -1, -1, -2, -1, -2, -2, -1,
--3, -1, -3, -1, -3, -1, -3, 0, -2, -2, -2, -1, -2, 0, -1, 0,
--1, 0, -1, 0, 0, 0, 1, 0, 2, 1, 1, 2, 0, 2, 1, 2,
-2, 1, 3, 0, 4, 0, 4, 1, 1, 2, 1, 2, 3, 1, 4, 0,
-3, 0, 3, 3, 1, 4, 1, 5, 2, 4, 2, 4, 1, 4, 0, 4,
-0, 4, -1, 4, -2, 3, 0, 0, 2, -1, 1, 0, -1, 1, -2, 0,
--2, -1, -1, -1, -1, -2, -1, -2, -1, -1, -2, -2, -2, -1, 0, -2,
-0, -1, 0, -1, 2, 0, 0, 2, -1, 3, -1, 3, 1, 1, 2, 2,
-1, 1, 2, 0, 2, 0, 3, -1, 0, 2, -2, 1, -1, 0, -1, 0,
-0, -1, -1, -1, -2, 0, -3, 1, -3, 1, -2, -1, 1, -3, 2, -1,
-1, 0, 0, 1, -1, 2, -2, 3, -1, 2, 0, 1, 0, 1, 2, 1,
-0, 2, 0, 0, 2, -2, 4, -5, 4, -3, 1, -2, 2, -3, 0, -2,
--1, 0, -2, 1, -1, -3, 2, -4, 2, -4, 0, -2, -1, 0, -1, 1,
--2, 1, -2, 0, -2, 1, -2, 2, -1, 3, -3, 3, -2, 1, -1, 2,
--1, 2, -2, 4, -1, 3, 1, -1, 2, 0, 3, -1, 2, 0, 2, -1,
-3, -2, 0, 0, -2, 1, -1, 1, -1, -2, 2, -3, 1, -2, 0, -2,
-0, -1, 0, -3, 3, -3, 3, -3, 1, 0, -2, 4, -4, 4, -4, 2,
-0, -1, 3, -3, 4, -2, 1, 1, -2, 3, -2, 2, 0, 1, -2, 2,
--2, 2, -2, 3, -1, 0, 1, -2, 3, -3, 3, -2, 0, 0, -1, 0,
-0, -1, 1, -2, 1, 0, -2, 3, -3, 2, -2, 2, -1, 0, 0, 2,
--2, 3, -2, 2, -3, 4, -1, 1, 0, -1, 2, -3, 4, -2, 0, 0,
--2, 1, -1, 1, -2, 0, 0, 1, -2, 2, 0, -2, 3, -3, 4, -5,
-5, -2, 2, -1, 3, -3, 3, -3, 5, -5, 5, -3, 2, 0, 0, 2,
--2, 3, 0, -1, 1, -1, 1, -1, 1, 0, -1, 2, -2, 2, -3, 1,
-0, -1, 0, -1, 0, 2, -2, 2, -1, 1, -1, 3, -1, 0, 2, -2,
-3, -3, 3, -1, 0, 0, 1, -1, 0, 1, -3, 4, -5, 6, -5, 3,
-1, -3, 2, -2, 3, -1, 1, 0, 1, -2, 4, -2, -1, 1, -4, 3,
--3, 3, -3, 1, 1, 0, 1, -1, 3, -5, 7, -6, 5, -3, 3, -1,
-1, 0, 1, 0, 1, 1, 0, 1, 1, 0, 0, -1, 1, -2, 1, -1,
-2, 1, -1, 2, -3, 4, -5, 3, -2, 2, 0, -1, 4, -4, 4, -1,
-1, 0, -2, 4, -3, 3, -1, 2, -2, 2, -1, 0, 0, -1, 2, -4,
-4, -4, 3, -4, 3, -4, 0, -1, -1, 1, -3, 3, -4, 2, -1, 1,
--1, 1, -1, 1, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 1,
--2, 5, -6, 3, -4, 3, -2, 0, 1, -2, 0, 3, -3, 2, -3, 1,
-1, -2, 4, -4, 4, -1, 2, 0, -2, 1, -2, 2, 0, -1, 2, -2,
-2, -2, 2, -2, 3, -2, 3, -2, 2, -3, 3, -2, 0, 1, -1, 2,
--3, 3, -1, 0, 0, 1, -2, 4, -2, 3, -3, 3, -4, 3, -3, 2,
--3, 4, -2, 1, 0, -1, 1, -1, 2, -1, -4, 2, -1, -2, 2, 0,
--2, 2, -2, 3, -3, 0, 2, -4, 4, -2, 0, 2, -3, 5, -3, 4,
--3, 2, 0, 1, 1, 0, 0, -2, 1, 0, 0, 1, -2, 0, -1, -1,
-4, -5, 1, -3, 1, 2, -2, 7, -7, 6, -3, 3, -4, 0, -1, 0,
-2, 1, 0, 0, 1, 3, 0, -1, -2, -3, 4, -2, 3, -2, 0, 2,
--1, 1, -4, -2, 2, -2, 5, -4, 4, -2, 2, 2, -2, 0, 0, -4,
-5, -3, 2, -5, 2, 0, -2, 1, -1, -4, 1, 3, -2, -1, -3, 3,
--3, 3, 5, -5, 3, -1, 4, -6, 0, -2, -1, -1, 2, 1, -4, 1,
--1, -1, -3, 0, -2, -2, 3, 3, -3, 5, -1, 2, -1, 4, -1, -1,
-0, 4, -2, 3, 2, 1, 1, 2, 3, -6, 1, 1, 0, 0, 0, 1,
--5, 3, 2, -3, -3, -2, -2, -2, 1, 0, -3, 1, 5, -2, 4, 1,
-2, -2, 5, 1, -3, 3, 2, 1, 0, 2, 0, 0, 1, 4, -4, 2,
-0, -2, 0, -2, 1, -4, 0, 2, -1, 0, -1, 0, 0, 2, 0, -2,
--2, -1, -1, -2, 0, -2, -4, 3, -2, 1, -3, 0, -2, -1, 3, 0,
--1, 1, 1, -1, -2, -2, -1, -3, 1, 1, -1, -2, -1, -2, -2, -2,
--1, -3, -1, 1, -2, 0, 0, 1, 0, 2, 2, 0, 0, 3, 2, 1,
-3, 4, -1, 3, 2, 1, 4, 4, 4, 0, 4, 2, 0, 1, 2, -1,
-0, 7, 11, 13, 18, 20, 15, 13, 13, 11, 6, 6, 4, 0, -2, 0,
--1, -2, 0, 1, -2, -2, -1, -3, -5, -6, -6, -9, -9, -8, -8, -8,
--7, -5, -5, -4, -2, -2, -1, 0, 0, 0, 0, 0, 1, 0, 1, 1,
-1, 2, 3, 3, 4, 4, 4, 3, 3, 3, 2, 2, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, -1, 0, 7, 18, 27, 38, 45, 42, 35, 27,
-18, 9, 5, 5, 2, 0, 1, -2, -2, -1, 2, 3, 4, 3, -2, -8,
--12, -16, -19, -18, -16, -14, -12, -9, -8, -7, -4, -2, -1, 1, 0, 0,
--2, -2, -2, -3, 0, 2, 3, 5, 6, 7, 6, 7, 6, 6, 5, 4,
-3, 1, 1, 1, 0, 1, 1, 2, 1, 1, 1, 0, -1, -2, -2, 6,
-17, 27, 39, 47, 46, 39, 30, 19, 7, 2, 3, 1, 3, 5, 5, 4,
-2, 3, 3, 2, 3, 1, -3, -7, -12, -16, -18, -17, -14, -12, -7, -5,
--4, -3, -2, -3, -2, -2, -2, -3, -2, -2, -4, -1, 0, 0, 3, 6,
-6, 6, 6, 6, 3, 4, 3, 2, 1, 2, 1, 1, 1, 1, 1, 1,
-3, 3, 2, 3, 2, 0, 1, 11, 19, 28, 42, 49, 46, 41, 32, 17,
-5, -2, -4, -6, -3, 3, 2, 2, 4, 2, 1, 1, 2, -1, -4, -6,
--11, -16, -16, -17, -16, -12, -8, -4, -3, 0, 1, -2, -1, 0, -2, -2,
--1, -1, -2, -1, 1, 0, 2, 5, 5, 6, 7, 6, 5, 3, 3, 1,
-0, 1, 1, -1, 1, 2, 1, 1, 1, 2, 0, 0, 1, -2, -1, 6,
-15, 23, 37, 47, 48, 44, 36, 23, 8, -1, -5, -8, -6, 1, 3, 4,
-6, 6, 3, 1, 2, -1, -4, -3, -7, -13, -14, -16, -18, -16, -12, -8,
--4, 0, 4, 2, 2, 1, -3, -5, -4, -5, -5, -3, -1, 0, 2, 4,
-4, 5, 6, 6, 6, 6, 5, 4, 2, 1, 0, -1, -1, 0, 0, 2,
-3, 3, 2, 3, 2, -1, -1, 2, 11, 19, 32, 44, 47, 46, 40, 27,
-13, 0, -7, -10, -9, -2, 3, 6, 10, 9, 6, 3, -1, -3, -5, -5,
--5, -8, -10, -12, -16, -17, -17, -15, -11, -6, 0, 3, 4, 5, 1, -2,
--5, -7, -7, -7, -4, 0, 1, 4, 6, 5, 5, 6, 5, 5, 4, 6,
-4, 3, 3, 1, -1, 0, -1, -1, 0, 1, 3, 4, 4, 3, 0, 0,
-3, 9, 17, 29, 41, 45, 46, 42, 30, 16, 4, -6, -11, -11, -4, 1,
-7, 13, 13, 10, 7, 2, -2, -5, -6, -7, -9, -9, -11, -15, -15, -15,
--15, -11, -6, -2, 2, 4, 4, 2, -2, -4, -8, -10, -8, -6, -3, 0,
-4, 5, 5, 6, 7, 5, 7, 7, 7, 7, 7, 5, 2, 0, 0, -1,
--1, 2, 3, 4, 6, 5, 4, 3, 0, -2, -3, 3, 11, 20, 33, 42,
-44, 44, 36, 23, 9, -2, -9, -12, -9, -1, 4, 9, 14, 12, 9, 5,
-1, -3, -6, -5, -7, -9, -8, -10, -14, -14, -13, -11, -7, -2, 3, 5,
-7, 6, 1, -3, -6, -10, -10, -8, -5, -1, 2, 6, 7, 6, 6, 4,
-2, 2, 2, 1, 1, 2, 1, 0, 0, 0, -1, 1, 2, 2, 4, 4,
-3, 2, 1, -1, -3, 0, 8, 15, 26, 39, 44, 45, 41, 30, 16, 3,
--6, -11, -12, -5, 1, 6, 13, 15, 12, 9, 4, -1, -5, -6, -7, -9,
--9, -8, -11, -12, -11, -11, -9, -5, -1, 1, 3, 4, 0, -3, -5, -8,
--10, -8, -6, -4, 0, 4, 5, 5, 6, 5, 2, 1, 1, 0, 1, 1,
-1, 1, 2, 1, 1, 1, 2, 2, 3, 4, 3, 2, 1, 0, -2, -3,
--1, 6, 13, 23, 34, 40, 41, 37, 28, 16, 4, -5, -10, -10, -5, 2,
-9, 15, 17, 16, 12, 6, 0, -5, -7, -8, -9, -7, -7, -8, -8, -8,
--8, -7, -4, -2, -1, 1, 2, -1, -3, -5, -8, -10, -9, -7, -4, 0,
-3, 5, 6, 6, 4, 2, 2, 0, -1, 0, 1, 1, 2, 3, 3, 2,
-3, 3, 2, 3, 3, 2, 2, 2, 0, -1, -1, -1, 1, 8, 15, 24,
-33, 38, 37, 34, 25, 14, 3, -5, -9, -8, -3, 4, 10, 15, 17, 15,
-10, 5, -1, -5, -7, -9, -9, -8, -7, -8, -9, -9, -9, -9, -7, -5,
--3, -1, 0, -2, -3, -6, -8, -10, -9, -8, -5, -1, 2, 4, 5, 5,
-3, 2, 1, 0, 0, 0, 1, 2, 3, 4, 3, 3, 3, 2, 2, 3,
-3, 3, 3, 2, 2, 1, 0, -1, 0, 4, 10, 18, 27, 33, 35, 34,
-28, 20, 10, 2, -3, -6, -3, 2, 6, 12, 14, 14, 11, 7, 2, -2,
--5, -7, -8, -8, -7, -8, -8, -9, -9, -9, -8, -6, -4, -3, -2, -2,
--4, -5, -7, -9, -9, -8, -6, -3, 0, 2, 4, 4, 4, 3, 1, 1,
-0, 0, 1, 2, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3, 3, 3,
-2, 2, 1, 0, -1, 1, 6, 11, 18, 25, 29, 30, 27, 22, 14, 7,
-1, -2, -3, 0, 3, 7, 10, 11, 10, 8, 4, 1, -2, -4, -6, -6,
--7, -7, -8, -8, -9, -9, -8, -7, -6, -4, -3, -3, -3, -4, -6, -7,
--8, -7, -6, -5, -2, 0, 1, 3, 3, 2, 2, 2, 1, 1, 2, 2,
-3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 2, 1,
-0, 1, 4, 8, 13, 20, 24, 26, 26, 22, 17, 11, 5, 1, -1, 0,
-2, 4, 8, 9, 9, 8, 6, 2, -1, -3, -5, -6, -6, -6, -7, -8,
--8, -9, -9, -8, -7, -6, -5, -5, -5, -5, -6, -7, -8, -7, -7, -6,
--4, -3, -1, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 4,
-4, 4, 4, 4, 4, 5, 4, 4, 4, 4, 3, 3, 2, 1, 1, 4,
-6, 9, 13, 16, 18, 19, 18, 15, 12, 9, 6, 4, 4, 4, 5, 6,
-7, 8, 7, 6, 5, 3, 2, 1, -1, -2, -2, -3, -4, -4, -5, -5,
--5, -5, -5, -5, -4, -4, -5, -5, -6, -6, -6, -6, -6, -6, -5, -4,
--3, -3, -2, -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 1, 1,
-2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 3, 4, 6, 9, 12,
-15, 17, 17, 17, 16, 13, 11, 9, 8, 8, 8, 8, 9, 10, 10, 9,
-9, 8, 7, 5, 4, 3, 2, 1, 0, -1, -1, -1, -1, -1, -2, -2,
--2, -3, -3, -4, -5, -5, -6, -6, -6, -6, -6, -5, -5, -5, -5, -5,
--5, -5, -5, -4, -4, -4, -4, -3, -3, -3, -2, -2, -2, -1, -1, -1,
-0, 0, 0, 0, 1, 1, 1, 1, 2, 3, 5, 7, 10, 12, 13, 14,
-13, 12, 11, 10, 9, 9, 9, 10, 10, 11, 11, 11, 11, 10, 9, 9,
-8, 7, 6, 5, 5, 4, 3, 3, 2, 2, 2, 1, 1, 0, -1, -1,
--2, -2, -3, -4, -4, -4, -4, -4, -5, -5, -5, -5, -5, -5, -5, -5,
--5, -5, -5, -5, -5, -5, -4, -4, -4, -4, -4, -3, -3, -3, -3, -2,
--2, -2, -2, -1, -1, -1, 0, 2, 4, 5, 7, 8, 8, 8, 7, 7,
-6, 6, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 6,
-5, 5, 5, 4, 4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, -1,
--1, -1, -1, -2, -2, -2, -2, -3, -3, -3, -3, -3, -4, -4, -4, -4,
--4, -4, -4, -4, -4, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -2,
--2, -2, -2, -1, 0, 2, 3, 4, 5, 5, 5, 5, 4, 4, 4, 5,
-5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 4, 4,
-4, 4, 4, 4, 4, 3, 3, 2, 2, 2, 1, 1, 1, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -2, -1,
--1, 0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4,
-4, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3,
-3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0,
-1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
--1, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0, 1, 1, 1,
-2, 2, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3,
-3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
-1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0
-};
@@ -1,236 +0,0 @@
-// TTS sound: menu_confirm
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_menu_confirmSampleRate = 11025;
-const unsigned int menu_menu_confirmSampleCount = 3660;
-const signed char menu_menu_confirmSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 2, 1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 6, 8, 9, 11,
-9, 5, 2, 0, -1, -2, -2, -1, -3, -5, -4, -3, -2, 0, 2, 2,
-1, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 1,
-2, 2, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, -1, 0, 1, 1,
-0, 1, 1, -1, 0, -1, 1, -1, -1, 1, -1, -1, 1, 8, 22, 24,
-28, 31, 18, 10, 4, 0, 0, -5, -2, -6, -14, -13, -13, -8, -3, 2,
-9, 6, 1, 1, -3, -4, -4, -3, -2, -6, -6, -6, -5, 0, 5, 9,
-11, 10, 8, 6, 2, 3, 3, 0, 0, -2, -5, -6, -5, -3, 0, 1,
-5, 4, 1, 2, 0, 0, 1, -2, -1, -3, -5, -3, -5, -1, 14, 27,
-33, 40, 39, 28, 16, 7, 6, 2, -4, -2, -9, -19, -20, -17, -12, -5,
-4, 10, 6, 2, 0, -4, -7, -6, -3, -7, -10, -11, -12, -12, -8, 1,
-6, 8, 11, 10, 8, 5, 6, 6, 3, 3, 1, -3, -5, -6, -3, -1,
-1, 6, 4, 4, 4, 1, 2, 1, 1, 1, -3, -3, -5, -7, -2, 13,
-27, 35, 44, 43, 31, 20, 12, 9, 3, 0, 0, -11, -21, -23, -25, -20,
--11, -1, 7, 5, 3, 2, -4, -6, -4, -2, -3, -8, -10, -13, -17, -11,
--4, 2, 7, 11, 12, 9, 7, 8, 7, 6, 7, 5, 0, -4, -6, -6,
--4, -1, 3, 5, 4, 3, 2, 1, 1, 2, 2, 0, -1, -5, -8, -1,
-14, 26, 38, 49, 47, 37, 27, 19, 12, 7, 6, 5, -5, -13, -19, -24,
--23, -15, -5, 0, 3, 5, 0, -5, -7, -6, -5, -6, -5, -7, -13, -15,
--12, -10, -5, 3, 9, 10, 9, 10, 7, 5, 7, 9, 6, 4, 3, -2,
--6, -4, -3, 0, 2, 4, 5, 2, 1, 1, -3, -2, -2, -2, -4, -6,
-2, 14, 22, 37, 46, 45, 39, 30, 22, 14, 7, 7, 3, -4, -10, -16,
--21, -22, -18, -9, -4, 0, 3, 1, -3, -6, -6, -6, -8, -5, -5, -10,
--11, -11, -10, -8, -1, 5, 8, 9, 10, 9, 6, 6, 8, 6, 5, 4,
-3, 0, -3, -2, -1, -1, 2, 3, 3, 2, 2, 1, 0, -1, 1, -1,
--2, 8, 19, 26, 38, 45, 43, 36, 28, 22, 13, 6, 7, 2, -5, -11,
--15, -20, -23, -18, -11, -8, -3, 0, 0, -4, -7, -5, -7, -8, -4, -5,
--8, -9, -9, -7, -8, -2, 4, 5, 8, 10, 9, 7, 6, 8, 6, 5,
-7, 5, 1, 0, -2, -2, -3, -1, 1, 0, 1, 1, 0, -1, -2, -1,
--1, -3, 3, 14, 23, 33, 44, 47, 42, 35, 28, 19, 10, 8, 7, 0,
--6, -10, -17, -22, -22, -17, -13, -9, -2, -1, -4, -4, -6, -8, -7, -6,
--3, -4, -5, -4, -7, -7, -5, -2, 1, 4, 9, 9, 7, 9, 7, 6,
-6, 7, 7, 5, 4, 3, -1, -2, -2, -3, -2, -1, 1, 0, -1, 0,
--2, -3, -3, 0, 8, 19, 29, 41, 47, 47, 41, 33, 25, 16, 11, 9,
-4, 0, -6, -13, -19, -24, -23, -20, -17, -10, -7, -6, -5, -7, -7, -9,
--6, -4, -4, -1, -2, -3, -5, -5, -3, -2, 1, 5, 7, 8, 9, 8,
-7, 6, 7, 7, 6, 6, 5, 3, 1, -1, -2, -2, -3, -2, -1, -2,
--1, -2, -3, -3, -4, 3, 12, 22, 35, 45, 49, 48, 40, 33, 23, 15,
-13, 9, 7, 3, -4, -10, -19, -24, -26, -26, -21, -16, -10, -8, -9, -8,
--10, -11, -9, -7, -3, -1, 1, 2, -1, -2, -2, -3, -1, 2, 6, 7,
-8, 10, 7, 6, 7, 5, 6, 7, 8, 7, 4, 4, 1, -2, -2, -3,
--2, -2, -2, -1, -4, -4, -4, -1, 7, 14, 25, 33, 36, 40, 36, 32,
-27, 23, 22, 19, 18, 15, 9, 4, -4, -10, -15, -18, -17, -17, -15, -12,
--13, -13, -14, -15, -14, -13, -9, -6, -4, -2, -2, -2, -2, -3, -2, -1,
-1, 4, 4, 6, 6, 5, 5, 5, 5, 5, 6, 8, 8, 9, 9, 8,
-7, 6, 5, 4, 4, 4, 4, 3, 4, 7, 9, 14, 20, 23, 26, 27,
-28, 25, 22, 22, 19, 18, 16, 14, 11, 6, 2, -2, -7, -9, -11, -12,
--12, -13, -12, -13, -13, -13, -14, -12, -11, -9, -7, -6, -3, -3, -3, -2,
--2, -1, 0, 1, 2, 3, 4, 4, 3, 4, 3, 3, 3, 3, 4, 4,
-4, 4, 3, 3, 2, 2, 2, 1, 2, 2, 4, 6, 8, 12, 14, 17,
-19, 20, 21, 20, 21, 21, 20, 20, 19, 17, 15, 12, 10, 7, 4, 1,
--1, -3, -4, -5, -7, -8, -9, -10, -11, -11, -10, -10, -9, -8, -8, -7,
--6, -5, -5, -4, -3, -2, -1, -1, 0, 0, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 4, 6, 7,
-8, 9, 10, 11, 11, 12, 13, 13, 13, 13, 13, 12, 11, 10, 8, 7,
-6, 4, 3, 1, 0, -2, -3, -5, -6, -7, -7, -8, -8, -8, -8, -8,
--8, -8, -7, -7, -6, -5, -5, -4, -3, -2, -2, -1, -1, 0, 0, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
-3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 7, 7, 6, 6, 6, 5,
-5, 4, 4, 3, 2, 1, 1, 0, 0, -1, -2, -2, -2, -3, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -1, -1, -1, -1,
-0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, -2, -2, 0, 0, -2, -1, 1, 0, 0, 2, 2,
-0, 1, 1, 0, 0, 2, 1, 1, 1, 0, 2, 2, 2, 2, 1, 2,
-0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1,
--2, -1, 1, 1, 0, 1, 1, 1, 2, 3, 1, 1, 2, 2, 2, 4,
--1, 1, -1, 0, -2, -2, -2, 0, 0, -1, -1, 1, 1, 2, 0, -1,
--3, -1, 2, 0, 1, 0, 0, 1, 1, -1, -1, 0, 1, 0, 0, 0,
-3, 0, 2, 0, 0, 0, 0, 0, -1, 1, 1, 1, -1, -1, 3, -1,
-1, -1, -1, 1, -2, 1, 0, -1, 1, -1, 1, 2, 1, 3, 1, 2,
-2, 1, 2, -2, -1, 1, -1, -1, -1, 2, 3, -2, -1, 0, 0, 0,
-1, -3, -1, 2, 1, -2, 1, 3, 2, -2, 1, -2, 2, 0, -2, -2,
--1, 1, 0, -1, 2, 1, -2, 2, 1, -2, -3, 2, 1, -2, -4, 0,
--3, 0, 0, -1, -3, 3, 2, -1, -1, 5, 3, -2, 3, 0, 2, 0,
-4, -2, 3, 0, 2, 1, 1, 1, 1, 0, 3, -3, 1, 0, -1, -1,
--2, 0, 1, -1, -3, -1, 0, 0, -1, -1, -1, -1, 2, 2, -2, 0,
-4, 1, 0, 2, 2, -2, -2, 4, -3, -1, 2, -2, -1, 0, 0, 1,
--3, 1, -1, 0, -2, 0, -1, 2, -3, 1, 2, 0, 2, 3, 2, 1,
-2, 2, 0, 2, -2, 3, -1, 0, -1, 0, -2, 1, 4, -1, -3, 3,
-0, -1, -3, -1, 2, -6, 1, -2, -1, 2, -3, -2, -1, -3, 1, -4,
--2, -3, 1, 2, -4, 0, 6, 3, -1, 4, 3, 2, 1, 6, -1, 3,
-2, 3, 2, 2, 4, 3, 1, 5, -1, 2, 1, 0, -1, -2, 0, 1,
--3, -3, -2, -1, -2, -3, -2, -3, -3, 1, 0, -4, -1, 4, 0, -2,
-2, 2, 2, 2, 2, 0, 2, 4, 2, 2, 0, 0, 2, 1, 1, 1,
-4, 0, 3, 2, 0, 0, -1, -1, 0, -1, -2, 0, 1, 2, 1, 2,
-0, 0, 1, 3, -2, 0, 1, 1, 0, 0, -1, 0, 1, 1, -1, 0,
-2, 4, 1, 0, 3, 2, 2, 1, 2, 0, 2, 2, -2, 1, 1, 0,
-0, -1, 1, 0, 5, 16, 9, 11, 22, 23, 23, 18, 22, 24, 16, 18,
-13, 10, 11, 8, 6, 3, 4, 8, 1, 3, 1, 1, 1, -2, -3, -5,
--6, -5, -9, -10, -10, -9, -9, -11, -10, -8, -8, -7, -7, -7, -5, -5,
--5, -3, -4, -3, -1, 0, -1, 1, 2, 3, 2, 3, 6, 3, 5, 6,
-4, 7, 3, 5, 5, 4, 2, 5, 17, 27, 19, 28, 38, 43, 38, 35,
-37, 31, 27, 23, 13, 10, 9, 6, 4, -1, 3, 3, 2, -1, 0, -2,
--4, -7, -10, -15, -14, -17, -20, -18, -20, -17, -15, -14, -11, -9, -6, -6,
--4, -1, -5, 0, 0, 0, 0, -1, 5, 4, 3, 9, 8, 8, 10, 10,
-11, 7, 9, 10, 4, 6, 6, 2, 5, 0, 1, 7, 28, 31, 25, 37,
-50, 48, 43, 35, 37, 26, 22, 15, 2, 0, 2, -2, -4, -7, 0, 1,
--3, -2, -3, -6, -9, -11, -13, -21, -19, -17, -20, -19, -17, -10, -9, -10,
-0, -1, -1, 3, 2, 3, 0, 2, 4, 1, 1, 6, 4, 4, 9, 8,
-7, 8, 10, 8, 4, 8, 4, 1, 3, 1, -2, -1, 1, -2, -4, 2,
-24, 39, 28, 34, 47, 51, 47, 34, 27, 21, 18, 10, -6, -10, -6, -5,
--8, -10, -6, -1, 0, -1, -4, -6, -5, -8, -12, -17, -16, -15, -15, -13,
--13, -8, -3, -1, 2, 2, 5, 5, 5, 4, 4, 1, 1, 5, -1, 1,
-4, 2, 5, 4, 8, 3, 5, 7, 2, 4, 1, -3, -4, -3, -3, -10,
--6, -4, -6, -1, 20, 55, 40, 33, 59, 67, 58, 47, 35, 23, 18, 20,
--5, -23, -10, -4, -14, -14, -6, -6, -1, 7, -1, -11, 0, 1, -15, -17,
--14, -14, -18, -15, -7, -15, -6, 8, 0, 1, 8, 11, 7, 1, 9, 3,
--3, 2, 4, -2, -1, 6, 2, 3, 6, 8, 1, 4, 10, -1, 0, 2,
--3, 1, -7, -2, -2, -4, -2, -3, 2, 26, 56, 40, 27, 59, 70, 54,
-35, 30, 25, 12, 11, -8, -28, -16, -2, -14, -25, -7, 6, -3, 3, 6,
--3, 2, 7, -5, -16, -10, -6, -13, -17, -7, -7, -9, 4, 5, -3, 6,
-15, 8, -2, 10, 7, -4, 0, 0, -5, -6, 0, 0, -7, 0, 7, -1,
-2, 4, 5, 2, 1, 4, -3, -2, 4, -7, -4, 1, -3, -4, 9, 40,
-47, 30, 42, 63, 62, 49, 31, 30, 23, 13, 3, -20, -21, -8, -14, -18,
--19, -3, 6, 2, 7, 8, 9, 14, 6, -1, -4, -6, -2, -14, -18, -8,
--9, -8, -5, -2, 5, 2, 11, 6, 3, 13, 3, 2, 1, -2, 0, -9,
--3, -1, -10, 1, 0, -1, 1, 5, 4, -1, 7, 4, -4, 3, 3, -4,
--4, 0, 0, -8, -1, 32, 49, 26, 38, 67, 65, 54, 44, 40, 31, 25,
-14, -13, -17, -5, -13, -27, -24, -5, -3, -5, 0, 7, 9, 12, 10, -1,
-2, 5, -6, -12, -12, -10, -9, -11, -12, -6, 3, 0, 2, 6, 9, 7,
-8, 6, 0, 4, 2, -5, -5, -4, 0, -7, -5, 3, -3, -1, 6, 4,
-0, 4, 9, 1, -1, 6, -1, -4, 0, 0, -6, -5, 9, 33, 32, 23,
-41, 58, 55, 40, 34, 39, 28, 17, 4, -9, -6, -7, -16, -21, -17, -3,
--3, -8, 2, 7, 11, 7, 4, 4, 3, 2, -7, -9, -8, -9, -7, -13,
--8, -3, 0, 0, 0, 6, 5, 6, 6, -1, 3, 5, -1, -7, -3, 2,
--7, -6, 0, -3, -1, 3, 1, 0, 4, 5, 2, 0, 3, 3, -4, 0,
--1, -3, -2, -3, 15, 35, 25, 24, 47, 56, 46, 36, 38, 37, 25, 17,
-0, -6, 1, -8, -21, -18, -5, -5, -10, -2, 2, 5, 9, 2, -1, 4,
-3, -7, -14, -6, -8, -14, -13, -10, -7, -6, -1, 0, -2, 9, 9, -1,
-5, 8, 4, 0, -2, 1, -2, -4, -2, -5, -1, 1, -1, 1, 1, 4,
-4, 1, 2, 4, 2, 0, -1, 0, -2, 0, -3, -6, 8, 29, 28, 17,
-37, 54, 48, 39, 36, 42, 34, 26, 11, 0, 9, 3, -12, -17, -4, 2,
--12, -6, 1, 4, 5, 2, 2, 0, 6, 1, -13, -6, -3, -8, -15, -13,
--2, -8, -9, -2, -1, 1, 3, 4, 2, 3, 8, 1, -2, 3, 0, -2,
--3, -2, -1, -1, 0, -1, -1, 4, 3, 0, 2, 5, 3, 1, 2, 2,
-0, 2, 0, -4, 1, 7, 20, 23, 17, 33, 44, 43, 33, 33, 44, 33,
-19, 17, 12, 10, 1, -4, -6, -5, 0, -7, -8, 1, 4, 1, -3, 2,
-4, -1, -3, -6, -5, -5, -9, -13, -10, -5, -9, -9, -6, -1, 1, -3,
-1, 4, 3, 2, 1, 3, 1, 1, 0, -3, 0, 0, -1, -1, -2, 3,
-2, 0, 2, 3, 4, 1, 2, 2, 2, 2, -2, -1, 2, -1, -3, 8,
-24, 16, 14, 35, 44, 34, 30, 41, 40, 28, 26, 21, 14, 13, 9, -2,
--6, 4, -1, -10, -4, 2, 1, -5, -1, 0, -3, -1, -7, -11, -7, -6,
--14, -18, -9, -8, -16, -12, -5, -7, -6, -3, -1, -2, 2, 2, -1, 1,
-4, 2, -2, 1, 4, -1, 0, 1, 2, 3, 1, 4, 2, 2, 6, 2,
-1, 4, 4, 1, -1, 3, 3, -4, 0, 14, 19, 9, 19, 35, 32, 28,
-32, 39, 34, 28, 28, 22, 20, 18, 8, 5, 6, 6, -2, -5, 2, 1,
--5, -3, -1, -2, -4, -4, -6, -6, -5, -7, -11, -9, -5, -11, -11, -7,
--6, -6, -8, -4, -2, -3, -2, -2, 1, 1, -1, 1, 1, 1, 1, 1,
-1, 1, 3, 1, 1, 3, 2, 2, 3, 2, 4, 3, 3, 2, 3, 4,
-0, 1, 4, 12, 14, 8, 18, 28, 26, 24, 26, 34, 28, 23, 23, 21,
-20, 14, 8, 8, 8, 5, 0, -2, 3, 0, -4, -3, -1, -1, -5, -6,
--4, -6, -6, -8, -10, -6, -8, -9, -9, -8, -4, -8, -8, -3, -4, -4,
--3, -3, -1, -4, -1, -1, -3, 1, -1, -1, 0, 1, 3, -2, 2, 5,
-0, 2, 4, 4, 1, 2, 5, 1, 0, 4, 1, 0, 2, 9, 13, 6,
-13, 24, 23, 21, 23, 30, 28, 22, 25, 23, 20, 18, 13, 11, 9, 9,
-5, 0, 3, 4, -3, -4, -1, 0, -5, -8, -3, -4, -9, -8, -8, -7,
--10, -10, -8, -9, -8, -8, -8, -6, -5, -4, -6, -3, 0, -3, -2, 0,
-0, 1, 0, 1, 2, 2, 3, 1, 3, 4, 3, 2, 3, 4, 2, 2,
-4, 2, 2, 3, 2, 2, 0, 4, 11, 8, 8, 16, 22, 20, 18, 26,
-31, 24, 22, 27, 27, 20, 17, 20, 17, 11, 12, 10, 8, 7, 5, 4,
-1, 4, 3, -4, -1, 0, -3, -6, -5, -3, -8, -9, -6, -7, -8, -8,
--7, -6, -8, -5, -5, -6, -4, -3, -4, -4, -2, 0, -3, -2, 2, 0,
--1, 1, 2, 1, 0, 2, 3, 2, 2, 4, 3, 3, 3, 3, 3, 2,
-3, 3, 7, 8, 7, 10, 16, 16, 15, 17, 22, 21, 18, 19, 20, 19,
-15, 14, 15, 13, 10, 9, 9, 8, 6, 5, 4, 4, 3, 1, 1, 0,
-0, -2, -3, -2, -3, -4, -5, -5, -5, -6, -5, -4, -5, -4, -4, -4,
--4, -3, -3, -4, -3, -2, -3, -2, -1, -1, -2, -1, 0, -1, 0, 0,
-1, 0, 0, 2, 1, 1, 2, 1, 1, 1, 1, 3, 6, 5, 5, 9,
-13, 10, 11, 15, 16, 13, 13, 16, 15, 12, 11, 12, 11, 9, 9, 9,
-8, 8, 7, 6, 6, 6, 5, 3, 3, 3, 1, 0, 0, 0, -1, -3,
--1, -1, -3, -3, -2, -2, -4, -4, -2, -4, -4, -3, -4, -3, -4, -3,
--3, -4, -2, -2, -3, -2, -1, -2, -2, -1, 0, -2, -1, 0, 0, -1,
--1, 1, 0, -1, 1, 3, 4, 3, 4, 8, 9, 7, 8, 11, 11, 8,
-9, 11, 10, 8, 8, 10, 9, 8, 8, 9, 8, 8, 7, 7, 7, 6,
-5, 5, 5, 4, 2, 2, 3, 2, 1, 1, 2, 1, -1, 0, 0, -1,
--1, -1, -1, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -1,
--2, -3, -2, -1, -2, -2, -1, -1, -2, -2, 0, -1, -1, -1, 0, 1,
-2, 1, 3, 5, 5, 4, 5, 7, 6, 4, 6, 7, 6, 5, 6, 6,
-5, 5, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 3, 2, 3,
-3, 2, 1, 2, 2, 1, 1, 1, 1, 0, -1, 0, 0, -1, -1, -1,
--1, -1, -2, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -1, -2, -2, -1, 1, 0, 0, 2, 3, 2, 2,
-3, 4, 3, 2, 4, 4, 3, 3, 4, 4, 4, 3, 4, 5, 4, 4,
-4, 4, 4, 3, 4, 4, 3, 3, 3, 3, 3, 2, 3, 2, 2, 2,
-2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1,
--1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -2, -1, 0, -1, 0, 1, 2, 1, 1, 2, 2, 1, 1, 2, 2,
-1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, -2, -1, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -1, -2, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 1,
-0, 1, 1, 1, 1, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
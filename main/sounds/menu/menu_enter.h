@@ -1,269 +0,0 @@
-// TTS sound: menu_enter
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_menu_enterSampleRate = 11025;
-const unsigned int menu_menu_enterSampleCount = 4187;
-const signed char menu_menu_enterSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 2,
-2, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 2,
-2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 0,
-0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 3, 4, 6, 7, 8, 10,
-11, 13, 15, 17, 18, 18, 19, 19, 18, 18, 18, 17, 16, 14, 12, 10,
-7, 5, 4, 2, -1, -3, -5, -7, -8, -10, -10, -11, -12, -12, -12, -12,
--12, -11, -10, -9, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 0, 1,
-1, 2, 2, 2, 3, 2, 2, 3, 6, 10, 13, 16, 18, 20, 22, 25,
-28, 32, 34, 35, 36, 35, 34, 33, 32, 31, 29, 25, 22, 18, 13, 10,
-6, 3, 0, -4, -7, -10, -14, -16, -17, -18, -18, -19, -19, -19, -19, -18,
--17, -15, -13, -12, -10, -9, -7, -6, -4, -2, -1, 1, 1, 2, 3, 3,
-4, 4, 4, 5, 5, 4, 6, 10, 15, 19, 22, 24, 28, 30, 33, 38,
-41, 42, 44, 44, 43, 42, 39, 38, 37, 32, 29, 25, 19, 15, 9, 5,
-2, -3, -7, -10, -15, -17, -20, -22, -21, -22, -23, -23, -23, -22, -21, -19,
--16, -15, -13, -11, -10, -7, -6, -4, -1, 0, 1, 3, 3, 3, 5, 4,
-5, 6, 5, 6, 5, 5, 10, 15, 19, 22, 23, 25, 28, 29, 33, 35,
-34, 34, 32, 30, 29, 25, 24, 22, 17, 14, 11, 7, 4, 1, -1, -3,
--6, -7, -9, -10, -11, -11, -12, -11, -12, -13, -11, -11, -12, -10, -10, -10,
--9, -9, -8, -7, -7, -6, -5, -5, -4, -3, -3, -2, -1, -1, 1, 1,
-3, 5, 4, 5, 8, 21, 38, 42, 42, 46, 46, 50, 51, 49, 46, 34,
-28, 29, 23, 18, 14, 9, 9, 8, 7, 9, 4, 1, 2, 0, -4, -9,
--12, -15, -21, -22, -22, -26, -28, -28, -25, -25, -25, -21, -19, -19, -16, -14,
--11, -12, -12, -7, -8, -8, -4, -4, -2, 0, 4, 7, 6, 8, 13, 12,
-13, 14, 13, 13, 23, 49, 55, 46, 50, 55, 55, 52, 48, 40, 20, 15,
-23, 13, 2, 0, 0, 2, 2, 5, 3, -9, -8, -3, -9, -19, -24, -26,
--30, -31, -28, -28, -33, -28, -17, -14, -15, -13, -9, -6, -8, -3, -3, -9,
--4, 1, 1, 1, 3, 9, 9, 11, 16, 13, 14, 13, 14, 15, 8, 7,
-11, 6, 4, 12, 37, 49, 42, 47, 52, 50, 51, 43, 30, 14, 8, 12,
-3, -8, -7, -5, -1, 2, 5, 1, -3, 1, 1, -6, -16, -22, -20, -24,
--27, -22, -24, -25, -14, -10, -10, -9, -5, -1, -4, -3, -4, -7, -4, -4,
--1, -4, -2, 6, 5, 7, 10, 12, 10, 9, 13, 8, 4, 8, 5, 2,
-4, 2, 3, 25, 52, 46, 43, 56, 57, 52, 46, 35, 16, 9, 14, 6,
--8, -9, 0, 3, 3, 10, 4, 0, 6, 5, -5, -16, -20, -21, -25, -24,
--28, -29, -18, -15, -10, -6, -9, -1, 1, 1, -3, -8, -4, -6, -5, -3,
--7, -1, 3, 8, 8, 7, 13, 14, 8, 13, 8, 2, 5, 5, 3, -2,
-0, 6, 11, 48, 54, 39, 55, 63, 60, 48, 35, 29, 7, 12, 12, -10,
--10, -1, 6, 5, 0, 10, 2, 3, 11, -12, -18, -17, -20, -22, -33, -25,
--25, -22, -9, -13, -12, -4, 0, 3, -7, -2, -3, -9, -1, -6, -8, -3,
-0, 6, 5, 7, 12, 10, 15, 13, 7, 8, 7, 7, 3, 0, 4, 0,
-5, 3, 10, 48, 50, 41, 57, 61, 56, 47, 42, 30, 10, 21, 15, -6,
--1, 6, 6, 3, 11, 11, -1, 6, 10, -10, -19, -12, -21, -28, -25, -26,
--28, -24, -11, -13, -19, -3, -3, -8, -3, -4, -9, -9, -2, -6, -12, -1,
-2, -1, 8, 7, 11, 11, 12, 16, 7, 8, 11, 6, 5, 2, 5, 5,
-1, 7, 14, 39, 50, 45, 55, 61, 60, 54, 39, 29, 18, 17, 9, -4,
--5, -2, 3, 6, 2, 4, 5, 5, 4, -9, -14, -17, -24, -24, -32, -32,
--29, -24, -17, -19, -13, -8, -4, -4, -4, -4, -8, -4, -4, -8, -7, -2,
-1, 2, 7, 8, 10, 16, 14, 14, 11, 8, 9, 6, 0, 3, -1, 1,
-3, 0, 10, 33, 47, 41, 49, 60, 54, 53, 45, 27, 19, 18, 14, -2,
--5, 2, 1, 4, 9, 4, 2, 7, 8, -7, -14, -12, -24, -26, -25, -31,
--33, -25, -17, -19, -17, -9, -6, -5, -5, -5, -8, -8, -5, -5, -9, -6,
--4, -2, 3, 4, 5, 8, 13, 12, 9, 13, 8, 8, 10, 6, 5, 4,
-7, 6, 2, 16, 35, 37, 40, 49, 51, 51, 49, 43, 27, 20, 23, 9,
-2, 3, -1, 1, 5, 5, 1, 2, 6, -1, -6, -10, -18, -21, -23, -25,
--30, -29, -22, -23, -18, -13, -14, -11, -8, -7, -9, -11, -7, -10, -9, -5,
--7, -3, 1, 5, 6, 8, 12, 11, 11, 13, 10, 10, 9, 9, 7, 5,
-8, 7, 6, 9, 17, 31, 33, 36, 42, 43, 46, 43, 36, 28, 22, 21,
-14, 7, 6, 3, 6, 8, 4, 4, 3, 2, 0, -4, -9, -15, -16, -17,
--22, -22, -21, -21, -17, -14, -13, -12, -9, -7, -8, -7, -6, -8, -7, -5,
--4, -5, -1, 2, 2, 4, 8, 7, 7, 10, 8, 6, 7, 7, 6, 4,
-5, 5, 4, 6, 5, 7, 19, 26, 27, 32, 37, 39, 42, 39, 34, 32,
-27, 26, 22, 15, 13, 9, 11, 9, 7, 4, 3, 2, -3, -6, -9, -12,
--13, -15, -15, -16, -14, -11, -11, -9, -8, -6, -5, -5, -3, -3, -3, -1,
-0, 0, 2, 4, 5, 6, 8, 7, 7, 8, 7, 6, 5, 6, 4, 3,
-4, 2, 2, 2, 1, 1, 1, 6, 13, 16, 20, 24, 28, 32, 33, 32,
-31, 30, 30, 27, 25, 23, 21, 20, 18, 16, 14, 11, 8, 6, 2, -1,
--4, -6, -8, -10, -11, -11, -11, -11, -11, -11, -10, -10, -9, -8, -7, -5,
--4, -2, -1, 1, 2, 4, 5, 6, 7, 7, 8, 8, 8, 8, 8, 7,
-7, 6, 6, 5, 4, 4, 3, 2, 2, 3, 8, 11, 15, 20, 26, 32,
-36, 39, 42, 44, 46, 45, 45, 45, 44, 42, 40, 38, 35, 31, 27, 23,
-18, 13, 7, 3, -2, -6, -9, -13, -15, -18, -20, -21, -22, -23, -23, -23,
--23, -22, -20, -18, -16, -14, -11, -9, -7, -4, -2, 1, 3, 5, 7, 9,
-11, 11, 12, 13, 13, 13, 13, 13, 12, 11, 10, 9, 11, 14, 16, 19,
-24, 28, 32, 34, 37, 39, 40, 41, 40, 39, 39, 38, 36, 34, 32, 29,
-24, 20, 16, 11, 6, 1, -3, -6, -9, -12, -15, -17, -18, -20, -21, -22,
--22, -22, -22, -20, -19, -18, -16, -14, -12, -11, -9, -7, -6, -4, -3, -1,
-0, 2, 3, 3, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5,
-8, 11, 15, 19, 25, 30, 34, 37, 40, 42, 43, 44, 44, 44, 43, 42,
-40, 38, 35, 31, 26, 22, 17, 11, 6, 1, -3, -7, -11, -14, -17, -19,
--22, -24, -25, -26, -26, -26, -25, -23, -22, -20, -17, -15, -13, -11, -9, -7,
--5, -3, -1, 0, 3, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-5, 5, 5, 4, 7, 10, 13, 18, 23, 29, 33, 36, 40, 42, 43, 44,
-44, 44, 44, 43, 42, 41, 38, 34, 29, 25, 20, 14, 9, 4, 0, -4,
--8, -10, -13, -16, -18, -21, -22, -23, -24, -24, -23, -22, -20, -19, -16, -14,
--13, -11, -10, -8, -6, -5, -3, -1, 0, 2, 3, 4, 4, 4, 5, 4,
-5, 4, 4, 4, 4, 4, 4, 3, 4, 6, 9, 12, 17, 22, 27, 31,
-35, 38, 40, 42, 42, 43, 43, 42, 42, 41, 39, 37, 33, 30, 25, 20,
-14, 9, 5, 0, -4, -7, -10, -13, -15, -17, -19, -21, -22, -23, -23, -22,
--22, -20, -18, -16, -14, -13, -11, -9, -8, -6, -5, -3, -2, 0, 1, 3,
-3, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 4, 3, 3, 3, 3,
-6, 8, 11, 17, 22, 26, 31, 35, 38, 40, 41, 42, 42, 42, 42, 41,
-40, 38, 36, 33, 29, 25, 19, 14, 9, 4, 0, -4, -7, -10, -12, -13,
--16, -18, -19, -21, -22, -23, -22, -21, -21, -17, -16, -15, -11, -10, -9, -7,
--4, -3, -2, 1, 2, 4, 5, 6, 8, 6, 8, 8, 6, 7, 7, 6,
-6, 4, 5, 4, 3, 3, 2, 5, 10, 7, 16, 23, 23, 30, 35, 38,
-40, 40, 43, 42, 42, 42, 41, 41, 39, 36, 33, 30, 26, 19, 16, 11,
-4, 1, -3, -8, -10, -12, -15, -16, -17, -19, -21, -20, -21, -20, -20, -18,
--15, -15, -11, -8, -7, -4, -3, -1, 2, 1, 3, 6, 4, 7, 8, 7,
-9, 8, 8, 8, 7, 7, 5, 5, 4, 1, 2, 2, -1, 0, -1, 0,
-6, 5, 9, 20, 21, 25, 31, 35, 39, 37, 39, 42, 39, 38, 37, 36,
-36, 30, 29, 29, 22, 18, 15, 10, 6, 0, -3, -6, -10, -12, -13, -14,
--16, -17, -17, -17, -17, -18, -16, -15, -14, -13, -10, -9, -5, -5, -3, 1,
-0, 1, 3, 4, 5, 5, 6, 7, 6, 7, 6, 6, 7, 4, 3, 3,
-2, 0, -1, -1, -2, -3, -3, -4, -3, -1, 5, 3, 10, 21, 20, 24,
-32, 35, 36, 35, 39, 41, 35, 36, 37, 34, 31, 28, 28, 25, 19, 17,
-13, 9, 3, -1, -2, -7, -9, -11, -13, -13, -16, -16, -15, -16, -15, -16,
--15, -12, -13, -11, -7, -7, -4, -2, -1, 3, 2, 5, 5, 5, 8, 6,
-8, 9, 6, 9, 8, 6, 9, 6, 5, 5, 4, 3, 1, 1, 2, -2,
--2, -1, -2, 3, 6, 4, 14, 21, 20, 25, 33, 36, 32, 34, 39, 35,
-31, 34, 32, 31, 27, 24, 26, 22, 15, 14, 10, 8, 1, -4, -2, -7,
--13, -12, -12, -13, -17, -15, -12, -15, -15, -13, -12, -11, -12, -8, -6, -6,
--4, -2, 2, 2, 2, 6, 7, 6, 6, 8, 10, 7, 6, 11, 7, 5,
-8, 6, 5, 4, 3, 3, 0, 1, 0, -2, -1, -3, -4, 1, 5, 3,
-7, 19, 21, 18, 27, 33, 30, 28, 32, 35, 28, 25, 31, 26, 23, 22,
-21, 21, 16, 12, 12, 8, 5, 0, -2, -2, -9, -9, -9, -11, -12, -12,
--10, -11, -13, -9, -10, -10, -7, -7, -6, -3, -3, -1, 1, 2, 4, 4,
-7, 7, 6, 7, 9, 8, 7, 7, 9, 6, 5, 8, 6, 4, 5, 4,
-3, 1, 0, 1, -2, -2, -1, -4, -3, 2, 7, 4, 10, 23, 22, 20,
-30, 34, 32, 27, 31, 35, 28, 23, 28, 28, 21, 18, 22, 21, 13, 10,
-12, 7, 1, -1, -2, -4, -10, -10, -9, -12, -12, -11, -13, -8, -10, -10,
--8, -5, -6, -6, -3, 1, -2, 1, 4, 5, 5, 6, 8, 9, 8, 9,
-9, 8, 8, 7, 7, 6, 5, 5, 4, 2, 2, 0, 0, -1, -3, -2,
--3, -5, -4, -5, -5, -3, 5, 6, 5, 16, 27, 21, 22, 33, 38, 29,
-26, 36, 35, 23, 24, 29, 24, 18, 17, 20, 15, 9, 9, 8, 3, -1,
--3, -4, -8, -10, -10, -11, -13, -11, -12, -11, -10, -10, -7, -7, -6, -3,
--5, -2, 0, -1, 2, 3, 4, 6, 5, 6, 9, 6, 7, 8, 7, 7,
-5, 6, 7, 2, 3, 4, 1, 0, 1, 0, -2, -3, -2, -3, -6, -4,
--5, -8, -4, 5, 8, 4, 13, 28, 26, 22, 29, 38, 34, 28, 29, 32,
-26, 20, 23, 21, 14, 15, 15, 11, 6, 6, 6, 1, -4, -2, -5, -10,
--10, -10, -11, -12, -12, -10, -11, -11, -7, -7, -9, -5, -3, -4, -3, -1,
-1, 0, 2, 5, 4, 2, 7, 8, 5, 5, 9, 8, 4, 4, 8, 5,
-2, 4, 4, 2, 0, 2, 2, -2, -1, 1, -1, -3, -2, 0, -3, -5,
-1, 10, 11, 9, 19, 30, 31, 29, 32, 39, 36, 29, 31, 29, 23, 21,
-20, 16, 11, 10, 11, 11, 5, 2, 4, 1, -4, -5, -6, -9, -11, -10,
--11, -14, -12, -11, -10, -12, -11, -8, -7, -9, -6, -4, -5, -4, -2, -1,
--1, -1, 2, 2, 1, 3, 4, 4, 3, 4, 6, 4, 4, 5, 5, 3,
-3, 4, 3, 1, 2, 3, 1, 0, 2, 1, -1, -1, 0, 0, -3, 4,
-17, 16, 13, 23, 32, 33, 29, 31, 36, 29, 25, 28, 24, 15, 12, 14,
-13, 3, 1, 5, 2, -3, -3, -3, -5, -8, -7, -5, -11, -13, -10, -9,
--12, -13, -12, -9, -11, -10, -7, -7, -9, -5, -3, -3, -4, -2, 2, 0,
-0, 3, 2, 3, 4, 4, 5, 3, 3, 4, 2, 3, 2, 0, 1, 0,
-0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -2, 3, 13,
-19, 19, 23, 31, 37, 37, 37, 37, 35, 31, 30, 29, 21, 14, 14, 13,
-8, 3, 1, 0, -2, -3, -3, -6, -10, -8, -8, -10, -12, -13, -13, -13,
--13, -11, -12, -13, -10, -8, -7, -7, -7, -4, -4, -2, 0, 0, -1, 1,
-2, 4, 3, 2, 5, 5, 5, 6, 6, 6, 5, 5, 7, 5, 4, 5,
-4, 4, 3, 3, 3, 1, 1, 2, 1, 0, -1, -1, -1, -1, 9, 18,
-17, 19, 27, 32, 34, 31, 33, 32, 25, 23, 25, 19, 13, 7, 8, 7,
-1, 1, 1, -4, -4, -2, -2, -5, -9, -7, -7, -10, -10, -10, -13, -14,
--14, -11, -12, -14, -12, -10, -11, -9, -6, -6, -6, -4, -1, 0, -1, 0,
-2, 2, 3, 4, 5, 4, 4, 6, 7, 5, 6, 6, 6, 6, 5, 5,
-5, 2, 3, 3, 2, 1, 0, 0, 0, -1, 0, 0, -2, -1, 8, 16,
-18, 19, 24, 26, 27, 28, 29, 26, 19, 17, 18, 15, 10, 7, 5, 3,
-1, 2, 3, -1, -3, -2, -2, -2, -4, -5, -7, -9, -9, -8, -10, -12,
--13, -12, -11, -11, -10, -10, -11, -10, -9, -8, -6, -6, -6, -5, -4, -2,
--1, -1, 0, 1, 1, 3, 4, 5, 5, 4, 5, 6, 6, 6, 7, 6,
-5, 6, 6, 6, 5, 4, 4, 3, 3, 3, 3, 1, 1, 0, 3, 12,
-18, 19, 22, 24, 24, 26, 26, 27, 23, 16, 15, 14, 11, 11, 9, 7,
-4, 1, 3, 4, 3, 1, 0, -3, -4, -4, -4, -5, -8, -10, -11, -12,
--11, -10, -10, -11, -12, -11, -9, -8, -7, -6, -6, -6, -5, -3, -2, -2,
--1, -1, -1, 1, 2, 3, 3, 3, 3, 4, 5, 6, 6, 6, 5, 5,
-5, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 0, 1, 6,
-12, 16, 20, 21, 22, 21, 21, 23, 23, 20, 16, 13, 10, 7, 7, 7,
-5, 2, 0, 0, 0, -1, 0, -1, -3, -5, -5, -6, -7, -7, -8, -10,
--11, -11, -10, -10, -9, -9, -8, -8, -8, -6, -4, -3, -3, -2, -2, -2,
--1, 1, 1, 1, 2, 2, 2, 3, 4, 5, 4, 5, 5, 4, 5, 5,
-5, 5, 4, 4, 4, 3, 3, 3, 3, 2, 1, 1, 1, 0, 0, 1,
-7, 12, 15, 19, 21, 21, 20, 20, 21, 21, 18, 16, 13, 9, 7, 6,
-6, 5, 3, 2, 0, -1, -1, 0, -1, -2, -3, -5, -7, -7, -7, -8,
--8, -8, -9, -10, -10, -9, -8, -7, -7, -6, -6, -6, -5, -4, -3, -2,
--1, -1, -1, 0, 0, 1, 2, 3, 3, 3, 3, 4, 4, 5, 5, 4,
-4, 4, 4, 4, 4, 4, 4, 3, 2, 2, 1, 0, 0, 0, -1, -2,
--1, 2, 7, 11, 16, 19, 20, 18, 18, 18, 18, 17, 17, 15, 12, 8,
-7, 6, 4, 5, 5, 3, 2, 0, 0, -1, -1, -1, -2, -3, -5, -6,
--7, -7, -7, -7, -7, -8, -8, -8, -8, -7, -6, -5, -5, -5, -5, -4,
--3, -2, 0, 0, 0, 1, 1, 1, 2, 2, 4, 4, 3, 4, 3, 3,
-4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 1, 1, 0,
-0, 0, 2, 7, 11, 14, 18, 20, 19, 19, 18, 18, 18, 17, 16, 14,
-11, 9, 7, 5, 5, 5, 4, 2, 1, -1, -3, -4, -4, -4, -4, -5,
--6, -7, -8, -9, -8, -8, -8, -7, -7, -8, -7, -7, -7, -5, -4, -3,
--3, -3, -3, -2, -2, -1, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3,
-4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 1, 2,
-1, 1, 1, 1, 5, 8, 11, 15, 18, 19, 19, 18, 18, 17, 16, 17,
-16, 14, 12, 10, 7, 6, 5, 5, 4, 4, 3, 1, -1, -2, -2, -4,
--3, -3, -4, -5, -6, -7, -7, -7, -6, -6, -6, -6, -6, -6, -6, -5,
--4, -4, -3, -2, -2, -2, -1, -1, 0, 1, 1, 2, 2, 2, 2, 2,
-2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
-1, 0, 0, 0, 2, 5, 8, 11, 15, 16, 17, 17, 17, 16, 16, 16,
-16, 15, 14, 12, 10, 9, 8, 7, 6, 5, 4, 3, 1, 0, -1, -2,
--3, -3, -4, -4, -4, -5, -6, -6, -6, -6, -5, -5, -5, -5, -4, -4,
--4, -3, -3, -2, -2, -1, -1, -1, 0, 0, 0, 0, 1, 2, 1, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 2, 5, 7, 11, 13, 14, 15, 14, 14, 14, 13,
-14, 14, 13, 13, 13, 11, 10, 8, 7, 6, 5, 5, 4, 2, 2, 0,
--1, -2, -2, -3, -3, -3, -4, -4, -5, -4, -5, -5, -4, -4, -4, -4,
--3, -3, -3, -3, -2, -2, -2, -1, -1, -1, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 0, 0, 1, 2, 4, 7, 10, 12, 13, 13, 13, 13, 12, 12,
-12, 13, 13, 13, 12, 11, 10, 8, 7, 6, 5, 5, 4, 3, 2, 1,
-0, -1, -1, -2, -2, -2, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3,
--3, -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-0, 0, 0, 0, 0, 2, 4, 6, 9, 11, 12, 13, 13, 12, 12, 12,
-12, 13, 13, 13, 13, 12, 11, 10, 9, 8, 7, 6, 6, 5, 4, 3,
-2, 1, 1, 0, -1, -2, -2, -2, -2, -3, -3, -3, -3, -3, -4, -3,
--3, -3, -3, -3, -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
-1, 1, 1, 1, 2, 3, 5, 7, 8, 9, 9, 9, 9, 8, 8, 8,
-8, 9, 9, 9, 9, 8, 7, 6, 6, 5, 4, 4, 4, 3, 3, 2,
-2, 1, 0, 0, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3, -3, -3,
--3, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 3, 4, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7,
-7, 8, 8, 8, 7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 4, 3,
-3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 2, 3, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-6, 6, 6, 6, 5, 5, 5, 4, 4, 4, 4, 4, 4, 3, 3, 3,
-2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1,
--1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, 1, 2, 3, 3, 4, 4, 4, 3, 3, 3, 4, 4, 4, 5,
-5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3,
-3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-0, 0, 1, 1, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 3,
-3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-0, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
-2, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
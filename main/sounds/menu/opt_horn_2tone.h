@@ -1,329 +0,0 @@
-// TTS sound: opt_horn_2tone
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_2toneSampleRate = 11025;
-const unsigned int menu_opt_horn_2toneSampleCount = 5146;
-const signed char menu_opt_horn_2toneSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 3, -3, 2, 0, -2, 4, -2, 1, 1, -1, 2,
-2, -2, 2, -2, 0, -1, 1, 0, -2, 1, 1, -2, 5, -5, 4, 1,
--2, 3, -2, -1, -2, 0, 3, 0, 0, 1, -3, 2, -2, 0, 1, -4,
-4, -2, 0, -1, 1, 0, -3, 2, 1, -2, -1, 3, -11, 14, -11, 8,
--4, -3, 7, -16, 8, -5, -5, 13, -18, 17, -8, 5, -1, 5, -5, 3,
--4, 1, -3, 1, 3, 0, -2, 1, -2, -1, 0, 4, -7, -2, 6, -8,
-8, -4, 8, -9, 10, -6, -1, 0, -5, 5, -2, 2, 1, 2, 1, 4,
-0, 0, -4, 7, -9, 8, -14, 10, -7, 2, -1, -3, -7, 7, -11, 3,
-0, -10, 20, -25, 20, -6, -3, 12, -9, -1, 10, -13, 20, -20, 13, 0,
--9, 11, -14, 7, -2, -9, 8, -9, -1, 11, -21, 18, -10, 5, -1, -5,
-6, -3, -4, 8, -8, 6, 3, -3, 5, -3, 7, 0, -12, 15, -9, -1,
-2, 0, -5, 6, -6, 8, -16, 11, 0, -10, 13, -14, 16, -6, -2, 14,
--21, 22, -15, 5, 5, -10, 11, -10, 11, -10, 2, 6, -8, 10, -6, -1,
-10, -12, 4, 4, -5, -1, 5, -1, -3, -1, 7, -6, 4, -2, 5, -7,
--2, 8, -2, -7, 4, 2, 2, -10, 8, 2, -11, 20, -15, 6, 4, -8,
-8, -2, -6, 9, -6, 9, -9, 1, 8, -11, 12, -12, 10, -8, -1, 11,
--11, -6, 20, -17, 3, 8, -13, 15, -9, -1, 10, -17, 16, -4, -9, 16,
--16, 10, 2, -9, 9, 0, -1, 5, -6, 0, 11, -9, 0, -1, -2, 8,
--12, 3, 3, -7, 11, -7, -3, 8, -6, 14, -23, 17, 7, -16, 13, 2,
--8, 4, 2, 6, -15, 5, 12, -13, 6, -3, 8, -7, 2, 6, -6, -4,
-9, -8, 4, -7, 6, 2, -6, 13, -14, -2, 15, -13, 3, 3, -10, 10,
--1, -1, 2, -4, 9, -2, -6, 4, 1, 1, -6, 9, -9, 3, 0, 2,
--8, 4, 13, -17, 2, 11, -8, 0, -3, 4, 7, -25, 26, -11, -9, 10,
-4, -8, 1, -6, 19, -21, -3, 20, -17, 7, 6, -17, 17, -8, 2, 4,
--12, 14, -9, -1, 8, -11, 8, 0, -7, 11, -9, 4, 4, -9, 14, -14,
-0, 19, -15, 1, 7, -3, 3, -9, 13, -4, -10, 14, -3, -3, 1, 4,
-1, -4, 0, 13, -16, 7, -2, 2, -3, -4, 7, -3, 2, 4, -14, 9,
-2, -4, 4, -7, 1, 7, 2, -11, 6, 1, 9, -13, 1, 8, -5, 7,
--4, -5, 11, -4, 2, 0, -5, 9, -5, -1, 2, -1, 1, 4, -4, 3,
-1, 1, 2, -9, 3, 5, -6, 0, -1, 3, 7, -11, 0, 5, -3, 3,
-1, -9, 4, 7, 0, -9, 0, 12, -2, -10, 6, 0, 0, 0, -3, -2,
--2, 6, 3, -13, 5, 5, -1, 1, -7, 11, -7, -3, 9, -7, -1, 3,
--2, 2, -4, 5, 3, -8, 4, 0, 3, 0, -5, 0, 4, -1, -3, -2,
--1, 3, 1, -5, 1, -1, 4, 4, -8, 3, 3, 3, 5, -3, -1, 7,
-1, 3, -4, 0, 4, -5, 6, -5, 0, 1, -3, 7, -1, -5, 6, -1,
-2, 1, -1, 4, -3, 4, 3, -3, 1, 5, 8, 4, -5, 9, 11, 6,
-5, 3, 8, 10, 6, 8, 1, 4, 9, 6, 1, -2, 5, 6, -1, -3,
-1, 1, -2, 0, -2, -4, -2, 1, -2, -7, -3, 1, -4, -5, -5, -3,
--1, -3, -4, -3, -6, 0, -1, 1, 6, 2, 7, 9, 13, 17, 12, 17,
-21, 19, 21, 18, 19, 20, 16, 17, 12, 9, 10, 6, 4, -1, -3, -2,
--6, -8, -8, -11, -10, -11, -11, -11, -12, -9, -8, -9, -7, -7, -4, -4,
--3, -2, -3, -1, 3, 8, 8, 5, 10, 17, 19, 18, 16, 21, 25, 23,
-22, 21, 20, 20, 18, 16, 11, 6, 8, 6, -1, -5, -6, -6, -8, -13,
--13, -14, -15, -12, -14, -14, -13, -12, -7, -8, -10, -5, -4, -2, -2, -2,
-0, 0, 8, 18, 14, 13, 20, 32, 37, 29, 33, 42, 43, 41, 39, 39,
-36, 32, 33, 27, 16, 11, 11, 7, -3, -12, -13, -16, -21, -23, -27, -29,
--29, -27, -24, -27, -27, -21, -16, -14, -14, -11, -6, -3, -1, 1, 1, 4,
-17, 25, 20, 20, 31, 43, 44, 38, 43, 50, 48, 49, 47, 41, 37, 33,
-34, 25, 10, 7, 5, -1, -11, -21, -21, -27, -31, -30, -36, -38, -38, -35,
--28, -33, -31, -23, -20, -14, -14, -11, -4, -4, 4, 5, 6, 21, 26, 26,
-29, 35, 47, 46, 45, 53, 50, 49, 51, 48, 44, 35, 31, 30, 20, 10,
-4, -3, -8, -15, -21, -26, -32, -32, -33, -36, -36, -37, -33, -29, -28, -25,
--23, -20, -13, -11, -9, -7, -4, -1, 0, 8, 19, 20, 20, 27, 36, 43,
-42, 46, 50, 48, 50, 52, 49, 43, 36, 36, 31, 19, 13, 4, -1, -9,
--16, -19, -29, -35, -33, -36, -37, -39, -38, -33, -33, -28, -23, -22, -17, -11,
--6, -3, -2, 2, 6, 8, 16, 27, 28, 26, 33, 39, 45, 45, 45, 51,
-45, 44, 48, 41, 36, 28, 24, 24, 10, 4, -1, -11, -14, -21, -23, -28,
--37, -34, -34, -35, -35, -35, -30, -27, -25, -18, -17, -14, -9, -5, 1, 1,
-3, 6, 9, 19, 28, 29, 27, 32, 42, 47, 46, 49, 49, 46, 46, 48,
-44, 34, 26, 25, 20, 10, 3, -5, -13, -19, -23, -25, -33, -38, -38, -37,
--35, -37, -35, -31, -29, -24, -18, -14, -12, -9, -2, 3, 5, 5, 9, 12,
-21, 32, 30, 29, 34, 40, 47, 46, 46, 47, 41, 43, 45, 38, 30, 23,
-20, 16, 7, 0, -6, -16, -19, -22, -26, -31, -37, -36, -34, -34, -33, -32,
--29, -26, -22, -16, -14, -11, -6, -3, 2, 5, 6, 8, 11, 24, 30, 26,
-30, 34, 40, 44, 44, 47, 44, 38, 44, 43, 35, 29, 22, 20, 14, 5,
-2, -8, -17, -18, -22, -25, -31, -36, -33, -34, -34, -31, -31, -29, -26, -21,
--15, -14, -12, -7, -2, 1, 4, 6, 6, 12, 24, 28, 24, 28, 34, 39,
-42, 43, 45, 41, 38, 43, 42, 34, 27, 22, 20, 13, 6, 1, -7, -15,
--17, -19, -25, -31, -33, -32, -32, -32, -31, -30, -28, -25, -19, -16, -14, -11,
--7, -2, 1, 4, 6, 7, 14, 26, 26, 24, 30, 35, 39, 42, 42, 42,
-39, 39, 42, 38, 30, 25, 22, 19, 11, 5, -1, -9, -14, -16, -20, -26,
--31, -31, -30, -31, -31, -31, -29, -26, -22, -17, -17, -14, -9, -6, -2, 2,
-1, 4, 8, 15, 25, 23, 22, 29, 34, 39, 40, 40, 41, 38, 41, 42,
-37, 31, 26, 25, 22, 13, 6, 0, -5, -9, -14, -18, -25, -29, -27, -28,
--31, -32, -32, -29, -26, -23, -21, -20, -15, -11, -7, -4, -3, -1, 3, 7,
-15, 20, 17, 19, 29, 33, 34, 34, 36, 38, 36, 38, 38, 32, 27, 26,
-24, 19, 10, 6, 3, -3, -7, -11, -15, -21, -22, -20, -23, -26, -26, -23,
--22, -21, -19, -16, -16, -12, -8, -7, -6, -4, -1, 1, 3, 8, 11, 8,
-11, 18, 20, 19, 20, 23, 24, 23, 25, 25, 21, 19, 21, 20, 15, 11,
-10, 8, 4, 1, 0, -4, -8, -8, -8, -12, -14, -13, -13, -15, -15, -13,
--13, -13, -11, -9, -9, -9, -7, -5, -4, -2, 1, 2, 2, 5, 8, 8,
-9, 11, 12, 12, 13, 15, 14, 12, 13, 13, 12, 10, 9, 9, 7, 5,
-5, 3, 1, 0, 0, -1, -3, -3, -3, -4, -5, -4, -4, -5, -5, -4,
--4, -4, -4, -3, -4, -3, -2, -2, -2, -1, 0, 0, 0, 1, 2, 2,
-2, 3, 3, 3, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2,
-2, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, 0, 0, 0, 1, 2, 2, 3, 3, 3, 4, 4, 5, 5,
-5, 5, 5, 5, 5, 4, 4, 4, 3, 3, 2, 2, 1, 0, 0, -1,
--1, -1, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2,
--1, -1, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1,
-1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
-0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1,
-1, 0, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -2, 1,
--1, -1, 0, -1, -1, -2, 1, 1, -1, 0, 2, -1, 0, 3, 1, 0,
-2, 0, 1, 0, 2, 1, 0, -1, 4, -2, 0, 0, -2, 0, -1, 1,
-0, -1, -1, 3, -2, 1, 3, -1, 2, 1, 1, 2, -1, 2, 0, 0,
-3, -1, 7, -5, 4, 3, -2, -3, 7, -6, 0, -3, 0, -4, -1, 1,
--1, -2, -2, 2, -5, 0, 6, -7, -1, 3, -3, 4, -3, 10, -9, 10,
--2, 0, 0, -3, 2, 0, 0, 1, 2, 0, 4, 3, -2, -1, 0, -3,
-4, -6, 5, -2, -1, 5, -4, 0, -3, 2, 0, -2, 5, 0, 0, 9,
--2, 4, -4, 2, 4, -7, 3, -1, -2, 9, -8, 4, 0, -7, 9, -2,
--9, 6, 0, -2, 1, 2, 2, -2, 0, 7, -10, 4, 2, -7, 3, -4,
-4, -1, -4, 11, -5, -6, 16, -8, -2, 1, 0, -1, -4, 1, 4, -13,
-7, 5, -12, 10, -1, 3, -3, 1, 7, -1, 0, 7, -6, 8, 2, 3,
--1, -4, 10, -9, 1, 0, -5, -1, 3, -1, -2, 2, -1, -3, 7, -4,
-2, -4, 3, 4, -8, 4, -1, 5, -3, 2, 7, -5, 5, 6, 0, -4,
-5, 3, -1, 0, -1, 4, -8, 4, 7, -9, 2, -3, 1, 1, -6, 4,
--2, -1, 10, -7, -1, 4, -5, 6, 1, -8, 6, 0, -1, 5, -3, 4,
--4, -1, 7, -7, 0, 2, -6, 3, -3, 2, 0, -3, 7, 1, -9, 13,
--4, -7, 5, -2, 2, -5, 0, 7, -12, 5, 10, -15, 6, -2, 2, -1,
--6, 11, -5, -6, 11, -3, -2, 3, -4, 4, -5, 2, 5, -8, 4, 6,
--5, 4, -2, 0, 1, -4, 5, -2, -2, 3, 2, -6, 5, 1, -3, 2,
--2, 2, 2, -1, 6, -6, -1, 7, 0, 3, -4, 1, 7, 0, 3, 0,
--6, 5, -4, 2, -1, -6, 3, 4, -2, 5, -5, 1, 6, -2, 4, -3,
--3, 5, -2, 1, 2, -6, 2, 0, -1, 5, -4, -3, 2, -3, 2, 0,
--4, 0, -3, 4, 6, -5, -1, 4, -2, 3, 3, 0, -4, -1, 4, 3,
--5, 1, 3, -3, -1, 6, -2, -5, -2, 2, 2, -3, 2, -1, -7, 2,
-3, -2, -1, -4, 2, 1, -3, 4, -1, -5, 1, 2, -1, -1, -3, 4,
--1, -1, 7, 0, -2, 4, 4, 3, 0, 0, 3, 1, -2, 6, 0, -2,
-1, 2, 0, -2, 4, 4, -4, 0, 3, -2, -3, -2, 3, -4, -5, 3,
--1, -7, 1, 1, -4, -5, -6, 1, -6, -3, 3, -2, -5, 1, 1, -3,
--7, -6, 1, -7, -4, 2, -2, -7, -3, -1, -2, -7, -4, -1, -4, -3,
-0, 1, -2, -1, 3, 4, -1, 0, 2, 2, 3, 5, 7, 2, 0, 8,
-10, 6, 5, 5, 5, 4, 5, 10, 3, -4, 0, 1, -1, -2, -2, -5,
--4, 2, -1, -4, -5, -5, -4, -3, 5, 9, 2, 4, 9, 10, 8, 7,
-6, 5, 1, 6, 8, 3, 2, 5, 6, 7, 7, 7, 5, 1, 4, 5,
-1, 0, -1, -1, -1, 0, 0, -2, -3, -2, -1, -2, -4, -4, -5, -5,
--4, -4, -5, -6, -5, -4, -4, -3, -3, -4, -4, -2, -1, -2, 2, 16,
-17, 15, 19, 21, 20, 20, 22, 21, 14, 10, 14, 14, 12, 11, 12, 11,
-10, 13, 14, 10, 6, 5, 5, 2, -1, -2, -5, -8, -8, -6, -7, -10,
--9, -8, -10, -9, -8, -10, -12, -12, -11, -12, -13, -12, -13, -12, -9, -7,
--8, -6, -4, -4, -1, 14, 27, 25, 28, 32, 32, 32, 35, 35, 31, 19,
-20, 24, 19, 19, 19, 16, 15, 14, 19, 19, 11, 9, 7, 1, 1, -1,
--6, -11, -16, -14, -13, -15, -15, -16, -19, -16, -15, -14, -14, -17, -18, -16,
--14, -11, -11, -10, -9, -9, -4, 0, 0, 3, 2, 3, 19, 41, 47, 48,
-51, 51, 50, 52, 57, 52, 35, 27, 26, 23, 20, 21, 18, 8, 6, 11,
-13, 10, 5, 0, -7, -12, -13, -13, -20, -29, -32, -32, -31, -30, -26, -26,
--30, -27, -20, -18, -16, -15, -16, -15, -13, -8, -3, -3, -3, 0, 3, 7,
-11, 15, 15, 24, 52, 63, 63, 68, 64, 56, 54, 54, 54, 41, 22, 17,
-14, 8, 13, 15, 9, 1, -1, 4, 3, -3, -6, -14, -26, -30, -29, -30,
--34, -38, -36, -36, -34, -24, -19, -19, -18, -16, -13, -10, -8, -3, -8, -13,
--9, -6, -2, 3, 7, 10, 8, 12, 20, 19, 19, 37, 58, 60, 61, 67,
-56, 44, 45, 45, 38, 26, 16, 11, 3, 2, 11, 11, 5, 1, 0, -2,
--5, -6, -8, -20, -28, -30, -32, -32, -30, -28, -28, -29, -22, -16, -13, -9,
--7, -10, -10, -8, -6, -5, -6, -4, -2, -3, 3, 10, 12, 13, 14, 16,
-15, 14, 15, 21, 39, 56, 59, 60, 55, 43, 36, 37, 36, 28, 17, 8,
--1, -5, 2, 7, 8, 6, 1, -3, -5, -6, -5, -12, -20, -26, -32, -32,
--26, -26, -21, -19, -21, -15, -10, -8, -2, -4, -7, -7, -8, -5, -1, 0,
-3, 4, 2, 7, 12, 13, 16, 17, 13, 11, 10, 9, 12, 31, 53, 58,
-59, 58, 44, 30, 29, 31, 26, 15, 7, -1, -10, -5, 5, 10, 10, 7,
-3, -3, -9, -7, -7, -17, -24, -27, -32, -31, -23, -16, -14, -14, -11, -8,
--9, -5, -1, -4, -6, -8, -9, -7, -6, 0, 5, 4, 7, 10, 11, 13,
-13, 14, 13, 6, 6, 7, 6, 29, 54, 58, 62, 60, 42, 26, 22, 25,
-23, 14, 10, 3, -10, -8, 6, 13, 14, 16, 10, -2, -11, -11, -11, -18,
--22, -23, -29, -32, -24, -14, -12, -8, -4, -6, -9, -7, -5, -5, -7, -9,
--10, -11, -10, -3, 3, 5, 9, 12, 10, 10, 11, 11, 10, 7, 6, 4,
-1, 13, 40, 55, 62, 68, 57, 33, 23, 20, 17, 16, 17, 10, -1, -7,
--2, 5, 12, 21, 21, 10, -1, -9, -16, -19, -20, -20, -23, -28, -26, -21,
--18, -10, -2, -2, -4, -6, -9, -13, -14, -13, -12, -12, -10, -6, -3, -1,
-5, 11, 10, 11, 13, 10, 5, 6, 5, 2, 2, 5, 5, 16, 41, 58,
-64, 69, 59, 36, 21, 16, 12, 12, 12, 11, 5, -3, 0, 8, 13, 19,
-23, 15, 1, -8, -17, -25, -26, -23, -25, -27, -24, -24, -23, -16, -10, -8,
--6, -6, -11, -16, -18, -19, -18, -16, -11, -6, -3, 0, 5, 7, 9, 12,
-12, 11, 9, 7, 5, 3, 5, 7, 6, 11, 30, 49, 60, 69, 68, 49,
-31, 22, 12, 9, 14, 15, 9, 6, 5, 3, 8, 15, 20, 18, 10, 2,
--10, -23, -27, -27, -29, -25, -20, -19, -18, -15, -12, -11, -10, -8, -9, -14,
--15, -17, -22, -20, -14, -11, -6, 2, 5, 6, 9, 9, 9, 9, 9, 8,
-5, 5, 6, 4, 6, 10, 11, 14, 30, 50, 58, 64, 65, 46, 27, 19,
-9, 6, 13, 15, 12, 11, 8, 6, 6, 10, 14, 12, 7, 1, -10, -22,
--28, -30, -31, -26, -20, -16, -15, -13, -13, -15, -14, -12, -13, -14, -14, -17,
--19, -18, -15, -10, -6, 2, 7, 7, 9, 10, 6, 6, 8, 6, 6, 8,
-7, 7, 9, 10, 11, 13, 19, 35, 50, 57, 63, 56, 38, 25, 15, 6,
-8, 14, 17, 16, 15, 13, 9, 7, 11, 12, 8, 6, 0, -12, -21, -26,
--29, -29, -23, -17, -14, -13, -12, -14, -17, -17, -16, -16, -16, -16, -16, -19,
--17, -13, -11, -6, 2, 5, 5, 8, 8, 4, 4, 6, 5, 5, 9, 10,
-9, 10, 12, 12, 13, 15, 18, 30, 42, 50, 55, 51, 38, 28, 18, 11,
-12, 14, 14, 16, 15, 11, 10, 8, 7, 7, 6, 3, -2, -9, -17, -22,
--25, -26, -23, -20, -17, -15, -14, -16, -16, -17, -18, -18, -16, -16, -16, -15,
--15, -13, -10, -6, -2, 2, 5, 6, 7, 7, 6, 6, 7, 8, 9, 10,
-11, 12, 12, 13, 14, 14, 13, 14, 19, 30, 41, 47, 49, 43, 32, 24,
-16, 10, 11, 12, 11, 12, 10, 7, 6, 4, 4, 3, 1, -1, -6, -12,
--16, -21, -24, -23, -22, -20, -17, -15, -15, -15, -15, -15, -15, -14, -13, -14,
--12, -11, -11, -8, -6, -3, 1, 3, 5, 7, 7, 8, 8, 8, 9, 9,
-9, 11, 11, 11, 12, 11, 12, 12, 11, 10, 10, 8, 11, 22, 31, 38,
-43, 40, 31, 25, 16, 10, 9, 8, 7, 8, 6, 4, 3, 2, 2, 2,
-1, -1, -4, -9, -13, -16, -19, -20, -19, -17, -16, -14, -13, -13, -12, -11,
--11, -10, -10, -9, -9, -8, -7, -5, -4, -1, 1, 3, 5, 6, 6, 7,
-8, 8, 8, 8, 8, 9, 8, 9, 9, 8, 9, 9, 7, 7, 8, 5,
-4, 10, 19, 26, 35, 39, 36, 29, 24, 16, 11, 9, 8, 7, 7, 7,
-5, 3, 4, 4, 3, 2, 2, -3, -7, -9, -12, -15, -14, -14, -13, -12,
--11, -11, -11, -10, -9, -9, -9, -8, -8, -8, -7, -6, -5, -3, -2, 0,
-1, 3, 4, 4, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7, 6, 7,
-7, 6, 6, 6, 4, 3, 3, 5, 13, 24, 31, 39, 41, 36, 32, 26,
-20, 17, 14, 12, 12, 11, 9, 9, 7, 7, 7, 5, 3, 1, -4, -8,
--9, -12, -14, -14, -14, -14, -13, -12, -12, -12, -12, -11, -11, -11, -10, -9,
--9, -9, -6, -5, -4, -2, 0, 0, 2, 3, 3, 4, 5, 5, 5, 6,
-7, 8, 9, 9, 10, 9, 8, 8, 8, 6, 6, 6, 4, 4, 3, 2,
-4, 11, 19, 25, 31, 33, 29, 26, 22, 16, 14, 12, 10, 10, 8, 6,
-7, 6, 5, 6, 5, 2, 0, -3, -7, -8, -10, -11, -10, -10, -10, -10,
--10, -10, -9, -8, -9, -8, -8, -8, -8, -7, -7, -6, -5, -4, -3, -1,
-0, 0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5,
-5, 4, 4, 4, 3, 3, 2, 2, 1, 1, 4, 12, 20, 26, 31, 32,
-28, 26, 22, 19, 16, 15, 13, 12, 10, 8, 9, 8, 8, 8, 6, 3,
-1, -2, -5, -7, -7, -9, -10, -10, -10, -11, -10, -10, -9, -9, -9, -9,
--8, -9, -9, -7, -7, -6, -4, -4, -3, -2, -1, 0, 1, 1, 2, 2,
-3, 3, 4, 4, 4, 5, 5, 4, 5, 5, 4, 5, 4, 4, 4, 3,
-2, 3, 3, 1, 1, 4, 11, 18, 23, 27, 28, 26, 25, 24, 22, 21,
-20, 17, 15, 13, 11, 11, 11, 11, 9, 8, 6, 3, 2, 0, -2, -3,
--5, -6, -7, -8, -9, -8, -8, -8, -9, -9, -9, -9, -8, -8, -8, -7,
--7, -7, -6, -5, -4, -3, -2, -2, -1, 0, 0, 1, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 1,
-1, 2, 6, 13, 18, 21, 23, 24, 23, 23, 23, 22, 21, 20, 17, 15,
-14, 14, 14, 13, 12, 10, 8, 6, 4, 3, 2, 0, -2, -3, -4, -5,
--6, -6, -6, -7, -7, -8, -7, -7, -6, -6, -6, -6, -5, -4, -4, -3,
--2, -2, -1, 0, 0, 0, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3,
-3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 5,
-10, 13, 16, 18, 18, 19, 20, 20, 20, 21, 19, 16, 15, 15, 14, 14,
-13, 10, 8, 6, 4, 3, 2, 1, -1, -3, -4, -5, -5, -5, -6, -6,
--6, -7, -7, -6, -5, -5, -4, -4, -4, -3, -2, -1, 0, 1, 1, 1,
-2, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 2, 2, 2,
-2, 1, 1, 0, 0, -1, -1, -1, -1, -1, -1, -2, -1, 2, 5, 7,
-9, 10, 11, 13, 15, 16, 17, 17, 17, 17, 17, 16, 16, 16, 15, 13,
-12, 11, 9, 8, 7, 5, 3, 2, 0, -1, -2, -3, -4, -4, -5, -6,
--6, -5, -5, -5, -5, -5, -4, -3, -2, -2, -1, 0, 0, 1, 2, 3,
-3, 4, 4, 4, 4, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 2,
-1, 1, 0, 0, -1, -1, -2, -2, -3, -3, -3, -1, 1, 3, 5, 7,
-8, 9, 11, 13, 14, 15, 16, 16, 16, 16, 17, 16, 16, 15, 14, 12,
-11, 10, 8, 7, 5, 3, 1, 0, -1, -3, -4, -5, -7, -7, -8, -8,
--8, -9, -9, -9, -8, -7, -6, -6, -5, -4, -3, -2, -1, 0, 1, 2,
-3, 4, 5, 6, 6, 7, 7, 7, 7, 7, 7, 6, 6, 5, 5, 4,
-3, 3, 2, 1, 0, 0, -1, -2, -3, -3, -1, 0, 1, 2, 3, 4,
-5, 7, 8, 9, 10, 11, 11, 12, 12, 13, 13, 12, 12, 12, 11, 11,
-10, 9, 8, 7, 6, 4, 4, 2, 1, 0, -1, -2, -3, -3, -4, -5,
--5, -6, -6, -6, -6, -5, -5, -5, -4, -4, -3, -3, -2, -1, 0, 0,
-1, 2, 3, 3, 4, 4, 5, 5, 6, 6, 6, 6, 6, 5, 5, 5,
-4, 4, 3, 3, 2, 2, 1, 1, 1, 2, 3, 4, 5, 5, 6, 7,
-8, 9, 9, 10, 10, 10, 11, 11, 11, 11, 10, 10, 9, 9, 9, 8,
-7, 6, 5, 4, 3, 2, 1, 0, 0, -1, -2, -2, -3, -3, -4, -4,
--4, -4, -4, -4, -4, -4, -3, -3, -2, -2, -2, -1, -1, 0, 0, 1,
-1, 1, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2,
-2, 2, 2, 1, 1, 0, 0, 2, 3, 4, 4, 5, 6, 7, 8, 9,
-10, 10, 10, 11, 11, 12, 12, 11, 11, 11, 10, 10, 10, 9, 8, 7,
-6, 5, 5, 4, 2, 1, 1, 0, -1, -1, -2, -3, -3, -4, -4, -4,
--4, -4, -4, -4, -4, -3, -3, -3, -2, -2, -1, -1, 0, 0, 0, 1,
-1, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-2, 2, 2, 1, 1, 2, 3, 3, 4, 4, 5, 6, 7, 8, 8, 9,
-9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 8, 7, 7, 6,
-5, 4, 4, 3, 2, 1, 1, 0, -1, -1, -1, -2, -2, -2, -2, -3,
--3, -3, -3, -2, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0, 1, 1,
-1, 2, 2, 2, 2, 2, 3, 2, 3, 3, 2, 2, 2, 2, 2, 2,
-2, 1, 1, 1, 2, 3, 3, 4, 4, 5, 6, 7, 7, 8, 8, 9,
-9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 8, 8, 8,
-7, 6, 6, 5, 4, 4, 3, 3, 2, 1, 1, 1, 0, 0, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1,
-1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 3, 3, 4, 4, 4, 5, 5, 6, 7, 7, 7, 7, 8, 8, 8,
-9, 8, 8, 8, 8, 8, 8, 8, 7, 7, 6, 6, 6, 5, 5, 4,
-4, 3, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1,
--1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-3, 3, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 7,
-7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 5, 5, 5, 4, 4, 4,
-3, 3, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
-3, 3, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6,
-6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 3, 3, 3, 3, 2,
-2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
-3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5,
-4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 1,
-1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3,
-3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 2,
-2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
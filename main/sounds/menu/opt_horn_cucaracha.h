@@ -1,505 +0,0 @@
-// TTS sound: opt_horn_cucaracha
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_cucarachaSampleRate = 11025;
-const unsigned int menu_opt_horn_cucarachaSampleCount = 7964;
-const signed char menu_opt_horn_cucarachaSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 5, 5, 4, 4, 4, 4,
-3, 3, 2, 2, 1, 1, 1, 0, 0, -1, -1, -1, -2, -2, -2, -2,
--2, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 0, 0, 0, 1, 2, 3, 5, 6, 7, 8, 9,
-9, 10, 10, 11, 11, 11, 11, 10, 9, 8, 7, 6, 4, 3, 2, 1,
-0, -2, -2, -4, -5, -5, -6, -6, -6, -6, -6, -6, -5, -5, -5, -5,
--4, -4, -3, -2, -2, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 3, 5, 7, 10, 13, 15, 18, 19, 21, 21, 21, 22, 22, 21, 21,
-20, 18, 16, 13, 9, 6, 3, 0, -3, -5, -7, -9, -10, -12, -13, -14,
--14, -14, -14, -13, -12, -10, -9, -8, -6, -5, -4, -2, -1, 0, 2, 3,
-3, 4, 5, 5, 4, 5, 4, 4, 4, 4, 4, 7, 9, 13, 17, 20,
-22, 24, 25, 26, 25, 25, 25, 24, 23, 21, 18, 15, 12, 7, 3, -1,
--4, -7, -9, -12, -14, -15, -16, -17, -17, -18, -17, -15, -13, -12, -9, -7,
--5, -3, -1, 0, 2, 3, 5, 6, 7, 8, 8, 8, 7, 7, 6, 6,
-5, 4, 3, 4, 6, 9, 13, 17, 21, 24, 27, 27, 28, 27, 27, 26,
-25, 24, 21, 18, 15, 10, 6, 1, -4, -7, -10, -13, -14, -16, -17, -18,
--19, -20, -20, -19, -17, -16, -13, -10, -8, -5, -3, -1, 0, 2, 4, 5,
-7, 8, 9, 10, 9, 9, 8, 7, 6, 6, 5, 4, 4, 7, 11, 14,
-22, 26, 29, 33, 32, 31, 30, 29, 27, 25, 24, 21, 17, 13, 8, 2,
--3, -8, -12, -15, -16, -18, -18, -18, -18, -18, -17, -16, -15, -12, -10, -7,
--4, -2, 0, 1, 3, 3, 3, 5, 5, 5, 6, 6, 6, 6, 5, 5,
-4, 3, 3, 3, 2, 2, 7, 12, 17, 27, 33, 36, 40, 38, 36, 32,
-29, 26, 22, 19, 17, 11, 6, 1, -6, -11, -16, -18, -20, -21, -18, -19,
--18, -16, -17, -16, -14, -13, -11, -9, -6, -4, -3, 0, 0, 0, 2, 2,
-3, 4, 6, 7, 7, 8, 8, 6, 7, 7, 4, 5, 6, 4, 4, 9,
-16, 22, 33, 43, 44, 46, 44, 36, 28, 21, 15, 9, 6, 4, -1, -6,
--8, -14, -20, -20, -20, -20, -16, -11, -10, -8, -6, -8, -10, -10, -9, -10,
--6, -3, -2, 2, 3, 3, 4, 4, 4, 5, 6, 7, 7, 8, 7, 6,
-4, 3, 1, 0, 1, 1, 0, 1, 5, 17, 28, 42, 58, 63, 62, 56,
-39, 23, 7, -7, -12, -14, -16, -11, -8, -9, -8, -14, -15, -15, -15, -12,
--10, -7, -9, -10, -11, -15, -15, -12, -10, -3, 2, 7, 10, 10, 9, 6,
-4, 2, 1, 2, 3, 3, 5, 4, 2, 4, 2, 0, 2, 3, 2, 2,
-2, 6, 18, 33, 48, 63, 68, 60, 46, 25, -1, -18, -28, -30, -23, -14,
--1, 5, 6, 6, 0, -6, -8, -11, -10, -12, -13, -10, -17, -18, -13, -13,
--6, 4, 10, 14, 15, 13, 6, -1, -4, -7, -10, -5, 0, 2, 5, 9,
-9, 4, 6, 6, 0, 0, 2, -1, -5, -2, 11, 25, 42, 66, 76, 67,
-53, 29, -6, -30, -40, -41, -31, -12, 8, 17, 19, 20, 10, -3, -5, -11,
--16, -12, -14, -15, -16, -15, -10, -7, 3, 13, 16, 17, 15, 6, -4, -11,
--14, -15, -11, -3, 4, 8, 12, 12, 8, 6, 2, 0, -3, -3, -3, -4,
--5, -4, 3, 25, 46, 63, 83, 81, 54, 28, -7, -42, -55, -49, -33, -9,
-20, 42, 42, 37, 30, 7, -11, -16, -23, -29, -24, -18, -17, -12, 1, 9,
-10, 20, 24, 12, 6, -3, -16, -23, -23, -15, -10, -1, 14, 16, 15, 18,
-9, 1, -1, -6, -9, -9, -8, -5, -4, -1, 14, 37, 54, 72, 85, 70,
-40, 10, -26, -53, -55, -40, -17, 10, 36, 46, 37, 26, 10, -12, -22, -23,
--25, -23, -17, -11, -10, -5, 6, 10, 14, 20, 16, 5, -3, -13, -21, -22,
--16, -5, 2, 12, 20, 16, 12, 9, 0, -6, -7, -8, -7, -7, -3, 1,
--1, 5, 21, 39, 56, 71, 77, 57, 26, -3, -35, -53, -47, -28, -2, 20,
-36, 40, 23, 8, -5, -22, -25, -20, -19, -14, -11, -8, -6, -3, 6, 12,
-13, 15, 10, -1, -10, -17, -19, -16, -7, 3, 11, 16, 16, 12, 6, -1,
--6, -5, -7, -7, -2, -1, 0, 2, 3, 14, 37, 53, 66, 75, 58, 27,
--3, -32, -50, -46, -26, 1, 21, 34, 36, 20, 1, -10, -21, -26, -21, -13,
--11, -11, -5, -4, -4, 4, 11, 13, 11, 7, 0, -13, -19, -14, -12, -5,
-8, 15, 16, 13, 10, 2, -6, -6, -6, -8, -3, 1, 0, 2, 3, 6,
-26, 47, 59, 70, 66, 39, 6, -23, -42, -48, -34, -3, 20, 34, 42, 31,
-9, -10, -21, -28, -29, -19, -10, -8, -3, 2, 2, 4, 9, 11, 8, 2,
--5, -13, -19, -16, -9, -1, 9, 17, 17, 13, 7, -1, -7, -10, -9, -6,
--3, 2, 5, 5, 4, 5, 16, 38, 52, 61, 66, 48, 13, -14, -34, -45,
--37, -8, 18, 32, 39, 36, 15, -7, -17, -24, -28, -20, -9, -7, -6, 1,
-3, 3, 8, 12, 8, 1, -4, -12, -20, -16, -8, -2, 8, 17, 16, 12,
-6, 0, -7, -11, -7, -4, -5, 2, 6, 2, 3, 8, 22, 43, 55, 65,
-64, 35, 6, -20, -43, -41, -26, -1, 26, 37, 39, 30, 8, -9, -20, -26,
--23, -18, -12, -7, -6, 0, 6, 7, 12, 13, 5, -3, -10, -18, -20, -14,
--4, 4, 12, 18, 15, 8, 4, -3, -9, -8, -6, -5, -1, 1, 3, 4,
-6, 23, 45, 56, 65, 63, 37, 4, -23, -39, -42, -27, 3, 26, 35, 39,
-29, 6, -11, -20, -25, -25, -20, -12, -9, -7, 2, 6, 9, 14, 12, 4,
--5, -14, -20, -19, -14, -3, 8, 14, 17, 15, 7, 1, -3, -7, -8, -6,
--4, -2, 1, 3, 5, 15, 39, 56, 62, 66, 49, 13, -16, -34, -42, -32,
--7, 21, 35, 36, 32, 15, -7, -16, -19, -22, -18, -12, -8, -7, -3, 4,
-11, 11, 12, 9, -3, -14, -17, -18, -16, -5, 7, 12, 13, 13, 8, 1,
--3, -4, -5, -7, -5, -1, -1, 0, 4, 10, 30, 50, 60, 64, 55, 26,
--6, -27, -36, -33, -13, 14, 28, 34, 32, 17, 0, -11, -16, -19, -18, -16,
--13, -10, -5, 4, 12, 15, 15, 11, -2, -12, -18, -20, -16, -6, 4, 10,
-12, 13, 8, 3, 0, -3, -4, -5, -6, -5, -3, -1, 3, 15, 39, 55,
-62, 65, 48, 15, -12, -30, -36, -26, -6, 19, 31, 31, 28, 15, -1, -9,
--14, -17, -18, -18, -15, -14, -9, 4, 10, 12, 14, 7, -5, -14, -19, -19,
--14, -5, 3, 8, 10, 10, 8, 3, 3, 1, -3, -4, -4, -7, -4, -1,
-11, 36, 52, 60, 63, 46, 17, -8, -26, -29, -21, -4, 16, 24, 25, 22,
-12, 2, -3, -7, -10, -15, -19, -19, -19, -13, 0, 9, 14, 16, 9, -3,
--14, -20, -21, -16, -8, 0, 5, 7, 8, 7, 5, 5, 3, 1, -2, -6,
--7, -7, -5, 9, 33, 48, 56, 58, 44, 18, -5, -17, -21, -16, -2, 13,
-19, 18, 16, 11, 5, 1, 0, -5, -13, -19, -22, -21, -15, -5, 7, 12,
-12, 8, -2, -10, -14, -15, -12, -8, -5, -1, 0, 1, 5, 8, 8, 8,
-6, 0, -5, -7, -7, -1, 17, 37, 47, 51, 46, 30, 9, -5, -9, -9,
--3, 6, 11, 10, 9, 8, 8, 7, 6, 4, -4, -14, -20, -22, -20, -12,
--2, 4, 7, 5, 1, -5, -9, -9, -8, -7, -6, -5, -4, -3, 0, 5,
-8, 9, 8, 5, 1, -3, -4, -2, 9, 26, 35, 41, 41, 30, 18, 5,
-1, 2, 2, 7, 9, 7, 4, 3, 5, 6, 6, 6, 1, -7, -14, -18,
--17, -15, -8, -3, -1, -1, -4, -6, -7, -7, -5, -5, -5, -6, -7, -6,
--4, 0, 4, 6, 7, 6, 3, 2, 1, 1, 8, 18, 25, 29, 30, 26,
-20, 12, 10, 10, 10, 11, 10, 8, 5, 2, 4, 5, 6, 6, 3, -2,
--8, -11, -12, -12, -10, -7, -6, -8, -9, -9, -10, -8, -7, -5, -5, -7,
--8, -8, -6, -5, -2, 1, 2, 2, 2, 1, 2, 2, 5, 10, 13, 16,
-17, 16, 14, 12, 13, 13, 14, 14, 12, 10, 8, 7, 7, 7, 8, 7,
-6, 4, 1, -1, -2, -2, -2, -3, -4, -5, -7, -8, -8, -7, -6, -6,
--6, -7, -8, -8, -8, -7, -6, -5, -4, -4, -5, -4, -4, -2, 2, 7,
-10, 13, 14, 13, 13, 12, 14, 16, 17, 17, 16, 14, 13, 12, 13, 14,
-14, 14, 13, 11, 9, 7, 7, 7, 7, 7, 5, 3, 1, 0, 0, 0,
-0, -1, -2, -3, -5, -6, -6, -6, -5, -5, -6, -6, -7, -8, -7, -6,
--4, -2, -1, 0, 0, -1, -1, -1, 0, 2, 3, 3, 2, 2, 1, 2,
-3, 3, 3, 3, 2, 2, 1, 2, 2, 2, 2, 2, 1, 0, 0, 0,
-1, 1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 3, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 0, -1, -1, -1, 1, 1, 1, 2, 0, -1, -2, -2, 0, 1, 1,
-0, 0, -1, 0, 1, 2, 1, -1, -1, -2, 0, 1, 2, 1, -1, -2,
--1, 0, 2, 2, 0, -1, -1, -1, 0, 1, 1, 0, -1, -1, -1, 0,
-1, 0, 0, -2, -2, -3, -1, 4, 5, 4, 0, -4, -4, -1, 1, 1,
-1, 0, 0, 1, 3, 4, 1, 0, -3, -3, -1, 1, 3, 1, 2, 0,
-0, -3, -2, 1, 0, 3, -1, -1, 1, 4, 8, 1, -3, -8, -2, 6,
-10, 7, 2, -2, -1, -1, 0, 0, -4, -5, -4, -2, 1, 5, 3, 3,
--4, -4, 2, 4, 9, 5, 1, -1, -3, 2, 2, 2, -1, -5, -6, 0,
-3, 1, -3, -7, -6, -2, 3, 2, -2, -2, 2, 4, 4, 5, 1, 0,
-3, 7, 4, 1, -3, -2, -2, 0, 4, -1, -6, -3, -3, -1, -3, -3,
--3, -1, 3, 0, -4, -2, -2, 3, 6, 3, 1, -3, -1, 4, 3, 3,
--2, -3, -4, 0, 2, 3, -1, -3, -1, -1, 3, 4, 4, 1, -1, -1,
-0, 4, 0, 3, -2, -2, -2, -1, -1, -1, 5, 3, -1, -2, -4, -1,
-0, 0, 3, -4, -3, -2, -2, -1, 2, 1, -3, -3, -4, 2, 2, 6,
-4, -2, -2, -1, 2, 0, -2, -3, -1, -2, 2, 2, -1, -5, -6, -2,
-0, 3, 0, -2, -1, -1, 1, 5, 2, 1, -1, 2, 1, 2, 1, 1,
-1, 1, 2, -3, -5, 0, 2, 5, -1, -3, -4, -4, 5, 3, -1, -6,
--9, -1, 4, 6, -1, -7, -6, -1, 5, 9, 0, -4, -6, 1, 5, 5,
-2, -4, -3, -2, 5, 5, 2, -2, -5, -1, -1, 2, 2, -1, -3, -4,
-2, 1, 2, 1, -1, 1, 1, 2, 4, 0, -3, 0, 1, 1, 0, 1,
--1, -2, 1, 0, 3, 0, 1, -1, -2, -1, -2, 0, 0, -1, -1, -3,
-1, 1, -1, 2, 0, -1, 0, 3, 3, 0, -1, 1, 2, 3, 2, -1,
--6, 0, 4, 5, 0, -4, -4, -3, 5, 5, -2, -6, -8, -1, 6, 6,
--1, -7, -4, 1, 5, 8, 3, -5, -4, 0, 6, 5, 3, -2, -5, -1,
-3, 4, 1, -2, -1, -3, 3, 2, 0, 0, -1, 2, 1, 1, 2, -2,
-1, 1, 1, 1, -2, -1, 1, 0, -1, -2, -2, 0, 1, 2, -2, -4,
--1, 2, 3, 1, 1, -2, -1, 4, 6, 1, -1, -3, 1, 2, 4, 4,
--3, -6, 0, 2, 3, -1, -5, -4, -5, 3, 5, 1, -2, -6, -4, 3,
-7, 8, -1, -5, -4, -1, 8, 7, 0, -6, -10, -2, 4, 7, 1, -6,
--7, -4, 3, 9, 6, -2, -6, -4, 3, 6, 9, 2, -3, -5, -1, 7,
-7, 5, -1, -5, -1, 1, 5, 4, -1, -4, -5, -2, 4, 5, 2, -3,
--5, -2, 0, 2, 3, 2, -2, -3, 2, 4, 5, 6, 4, 1, 0, 4,
-7, 6, 3, 2, -1, 0, 2, 4, 2, -2, -3, -5, -4, -2, -1, -2,
--5, -8, -7, -7, -3, 0, -2, -3, -6, -5, -1, 2, 5, 2, -3, -3,
--2, 5, 6, 5, 1, -3, -3, 1, 5, 6, 2, -2, -4, -1, 3, 5,
-3, 1, 3, 5, 7, 9, 8, 7, 5, 6, 8, 8, 6, 5, 3, 3,
-3, 3, 3, 0, 0, -1, -1, -1, -1, -2, -3, -4, -3, -3, -3, -3,
--4, -4, -4, -4, -3, -3, -2, -2, -3, -2, -2, -1, -1, -1, -1, -1,
-0, -1, -1, 2, 8, 13, 14, 16, 18, 20, 22, 27, 31, 29, 25, 24,
-22, 21, 19, 17, 12, 4, -1, -3, -6, -9, -12, -15, -19, -21, -20, -18,
--18, -18, -17, -15, -15, -11, -7, -6, -4, -3, -2, 0, 1, 3, 4, 3,
-3, 3, 4, 3, 4, 9, 16, 18, 20, 23, 26, 27, 31, 37, 38, 35,
-32, 30, 27, 23, 21, 18, 9, 1, -4, -10, -14, -18, -21, -26, -31, -31,
--30, -29, -28, -25, -23, -22, -18, -12, -8, -4, -1, 2, 4, 6, 9, 11,
-11, 11, 11, 11, 10, 9, 10, 16, 20, 21, 23, 24, 26, 27, 31, 36,
-34, 32, 30, 25, 23, 19, 16, 12, 3, -4, -10, -15, -19, -23, -26, -30,
--34, -34, -32, -31, -29, -25, -23, -20, -16, -9, -5, -1, 3, 6, 8, 11,
-14, 16, 15, 15, 16, 14, 12, 12, 15, 20, 21, 23, 24, 24, 26, 27,
-33, 34, 32, 30, 26, 22, 19, 16, 13, 6, -2, -8, -15, -19, -22, -25,
--29, -34, -34, -35, -33, -30, -27, -24, -22, -17, -12, -7, -1, 2, 7, 8,
-11, 15, 16, 17, 18, 17, 16, 14, 13, 13, 16, 22, 23, 24, 24, 24,
-26, 28, 33, 33, 29, 27, 22, 19, 16, 13, 9, 1, -5, -12, -17, -21,
--24, -26, -30, -33, -33, -33, -31, -27, -24, -21, -19, -14, -9, -5, 2, 5,
-8, 10, 12, 15, 15, 17, 18, 15, 15, 13, 12, 13, 18, 22, 22, 23,
-25, 24, 25, 29, 33, 31, 28, 26, 21, 16, 14, 11, 6, -3, -9, -15,
--22, -26, -28, -30, -34, -37, -36, -36, -34, -29, -25, -21, -18, -12, -7, -2,
-3, 9, 12, 14, 17, 18, 20, 20, 20, 20, 17, 15, 14, 15, 19, 21,
-23, 23, 22, 22, 23, 26, 28, 27, 25, 21, 17, 13, 10, 7, 2, -4,
--10, -16, -21, -25, -27, -28, -31, -31, -31, -31, -28, -25, -21, -17, -14, -9,
--5, -1, 4, 7, 11, 13, 15, 17, 17, 17, 17, 16, 15, 13, 11, 11,
-14, 17, 18, 21, 21, 21, 20, 23, 25, 25, 25, 23, 19, 15, 11, 9,
-4, 0, -4, -10, -16, -20, -23, -25, -28, -28, -28, -29, -28, -26, -23, -20,
--16, -12, -8, -4, -1, 3, 6, 8, 11, 13, 14, 15, 14, 14, 13, 12,
-11, 10, 13, 15, 16, 19, 19, 19, 19, 20, 22, 23, 23, 23, 21, 17,
-14, 11, 8, 4, 0, -3, -9, -13, -17, -20, -22, -24, -24, -25, -25, -24,
--23, -21, -18, -15, -11, -8, -5, -1, 1, 4, 7, 8, 10, 11, 12, 12,
-11, 11, 10, 9, 10, 11, 12, 14, 15, 16, 15, 15, 17, 18, 19, 20,
-19, 18, 15, 13, 11, 8, 6, 4, 1, -3, -6, -9, -13, -15, -16, -17,
--18, -18, -18, -18, -18, -16, -14, -13, -10, -7, -5, -3, -1, 1, 2, 4,
-5, 6, 7, 7, 7, 7, 7, 8, 9, 9, 11, 11, 11, 11, 12, 12,
-12, 13, 14, 13, 13, 12, 11, 9, 8, 7, 5, 4, 2, 1, -2, -4,
--5, -7, -8, -9, -9, -10, -10, -10, -10, -10, -10, -9, -8, -7, -6, -5,
--4, -3, -2, -1, 0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 6, 6,
-7, 7, 7, 7, 7, 8, 7, 7, 7, 6, 6, 5, 5, 4, 4, 3,
-2, 2, 1, 0, -1, -1, -2, -2, -3, -3, -3, -4, -4, -4, -4, -4,
--4, -3, -3, -3, -3, -3, -2, -2, -2, -1, -1, -1, 0, 0, 0, 1,
-1, 1, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2,
-2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, -1, -1,
-0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 0, 0, -2, -1, -1, 0,
-1, 1, 0, 0, -1, 0, 0, 1, 1, 0, 0, -1, -1, 1, 2, 2,
-0, -1, -1, -1, 0, 1, 0, -1, -2, -2, -1, 0, 1, 1, 0, -1,
--2, -1, -1, 1, 3, 2, 2, 0, -1, 0, 0, 1, 0, -2, -1, 0,
-1, 1, 1, 0, -1, -1, -1, 1, 2, 1, 2, 0, -2, -2, -1, 0,
-1, 2, 2, 0, 0, -1, -1, 1, 2, 1, 1, 0, -1, 0, 1, 2,
-1, 0, -1, 0, 1, 3, 2, -3, -3, -1, 2, 4, 2, 0, -4, -3,
-0, -1, -1, -4, -5, -1, 1, 2, 1, 1, 1, 0, 2, 4, 1, 1,
-1, 0, 1, 1, 3, 3, 2, -1, -1, -1, 0, 2, 1, 1, -1, -2,
--1, 0, 1, 2, 1, -1, 0, -1, 2, 2, 2, 3, -1, -1, -1, -1,
-1, 1, 1, 1, 0, -2, -2, -2, 0, 0, 1, 0, -2, -1, 0, 1,
-2, 2, 0, -1, 1, 2, 2, 2, 1, 0, 0, 0, 1, 1, -1, 1,
-0, -1, -1, -2, 0, 1, 1, 1, 0, 1, 0, 0, 1, 0, 1, 2,
-1, 2, 1, 0, 2, 1, 3, 3, 1, 2, 0, 0, 1, 0, 1, 0,
-0, 1, 0, -1, -1, -2, -1, -1, 0, -1, -2, -1, 0, 0, 0, 0,
-0, 0, 1, 2, 3, 1, 1, 0, 0, 1, 1, 2, 1, 1, 1, 0,
-0, 0, 1, 1, 0, 0, 0, 3, 7, 8, 7, 6, 4, 5, 5, 6,
-6, 5, 4, 2, 1, 1, 1, 1, 2, 1, 0, -2, -2, -2, -2, -1,
--2, -2, -3, -4, -4, -3, -3, -2, -2, -2, -2, -2, -2, -1, -1, 0,
-0, -1, -1, -2, -1, -1, 0, 0, 0, 0, 0, 2, 9, 17, 21, 23,
-20, 18, 17, 17, 17, 16, 14, 12, 9, 4, 1, -1, -1, 0, 0, 0,
--3, -5, -6, -7, -7, -6, -6, -7, -8, -9, -10, -11, -9, -8, -7, -5,
--5, -5, -4, -4, -2, 0, 1, 2, 2, 2, 3, 3, 4, 4, 5, 6,
-11, 22, 34, 42, 44, 41, 38, 35, 34, 33, 29, 24, 19, 12, 6, -1,
--7, -9, -10, -10, -10, -13, -14, -16, -17, -16, -16, -15, -14, -14, -14, -15,
--15, -14, -13, -11, -8, -6, -4, -3, -1, 1, 2, 5, 7, 8, 10, 9,
-8, 7, 6, 6, 6, 12, 24, 38, 50, 53, 50, 44, 39, 37, 36, 33,
-28, 21, 13, 5, -4, -12, -17, -19, -18, -17, -18, -20, -22, -23, -22, -20,
--18, -16, -14, -13, -13, -12, -12, -11, -8, -5, -2, 1, 2, 3, 5, 6,
-8, 10, 11, 12, 13, 12, 11, 9, 7, 6, 10, 22, 37, 51, 57, 53,
-46, 39, 35, 33, 31, 26, 20, 12, 4, -5, -14, -20, -24, -22, -20, -19,
--20, -22, -24, -23, -21, -17, -14, -12, -10, -8, -7, -7, -6, -5, -2, 1,
-5, 6, 7, 7, 7, 9, 9, 10, 11, 11, 11, 10, 8, 7, 5, 5,
-11, 22, 37, 51, 55, 52, 45, 37, 33, 31, 29, 26, 19, 11, 3, -6,
--14, -21, -24, -23, -21, -19, -19, -21, -22, -22, -20, -16, -13, -10, -8, -6,
--5, -4, -4, -3, -2, 1, 4, 6, 7, 6, 6, 7, 8, 9, 9, 9,
-9, 9, 8, 6, 5, 6, 14, 27, 42, 54, 57, 53, 45, 37, 34, 32,
-29, 26, 19, 11, 3, -6, -14, -21, -25, -24, -21, -18, -18, -20, -22, -22,
--20, -16, -13, -10, -7, -5, -4, -4, -4, -4, -3, 0, 3, 6, 7, 6,
-6, 6, 6, 7, 8, 8, 8, 8, 8, 7, 5, 6, 14, 26, 41, 52,
-55, 51, 43, 36, 31, 28, 26, 23, 18, 13, 6, -3, -12, -20, -24, -23,
--20, -17, -15, -16, -18, -19, -19, -16, -13, -10, -7, -4, -1, -1, -2, -3,
--3, -1, 1, 4, 6, 7, 6, 5, 5, 5, 5, 5, 6, 6, 7, 7,
-6, 4, 15, 27, 43, 54, 57, 54, 46, 38, 33, 29, 26, 23, 19, 15,
-9, 1, -8, -17, -23, -25, -22, -18, -15, -14, -15, -17, -17, -16, -15, -12,
--8, -4, 0, 2, 2, 0, -2, -2, 0, 2, 5, 6, 7, 7, 6, 4,
-3, 2, 2, 3, 5, 5, 5, 5, 10, 19, 32, 45, 52, 53, 48, 40,
-33, 28, 25, 22, 19, 15, 11, 5, -2, -10, -17, -21, -22, -19, -15, -13,
--12, -13, -14, -15, -14, -12, -9, -6, -3, 0, 2, 2, 1, -1, -1, 0,
-2, 4, 6, 6, 6, 5, 4, 3, 2, 2, 2, 3, 4, 4, 7, 14,
-25, 38, 48, 51, 49, 41, 34, 28, 24, 22, 20, 16, 12, 6, 0, -6,
--13, -17, -19, -18, -15, -13, -12, -12, -14, -15, -14, -12, -9, -7, -4, -2,
--1, 0, 0, 0, -1, 0, 2, 4, 5, 6, 5, 4, 3, 3, 3, 3,
-4, 3, 3, 3, 3, 5, 12, 22, 36, 48, 53, 52, 46, 37, 30, 26,
-23, 21, 17, 13, 7, 0, -6, -13, -17, -19, -19, -16, -13, -12, -12, -14,
--15, -14, -12, -9, -7, -5, -3, -2, -2, -1, -1, -1, -1, 1, 3, 4,
-5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 5, 11, 22, 35,
-46, 50, 47, 39, 29, 23, 19, 18, 16, 12, 7, 0, -5, -11, -15, -18,
--18, -17, -13, -10, -9, -10, -11, -12, -11, -9, -6, -4, -4, -3, -3, -2,
--2, -2, -1, -1, 1, 3, 5, 5, 4, 4, 3, 4, 5, 5, 4, 4,
-3, 3, 3, 4, 10, 21, 35, 47, 51, 47, 37, 27, 20, 16, 13, 11,
-6, 1, -5, -10, -14, -18, -19, -18, -14, -10, -7, -6, -8, -9, -10, -9,
--7, -6, -5, -5, -4, -3, -3, -3, -3, -2, 0, 3, 5, 6, 6, 5,
-5, 5, 5, 6, 5, 4, 4, 3, 3, 2, 2, 10, 22, 38, 51, 54,
-48, 37, 25, 17, 13, 9, 5, 0, -5, -9, -13, -16, -18, -17, -14, -8,
--4, -3, -5, -7, -8, -9, -8, -8, -8, -8, -7, -6, -4, -4, -3, -2,
-1, 4, 6, 7, 7, 6, 6, 6, 5, 4, 4, 3, 3, 3, 2, 1,
-0, 0, 4, 15, 31, 46, 53, 49, 37, 24, 13, 7, 4, 0, -3, -7,
--9, -12, -14, -14, -12, -7, -1, 2, 1, -2, -5, -8, -9, -10, -11, -11,
--9, -7, -6, -4, -3, -1, 2, 4, 7, 7, 6, 5, 5, 4, 3, 2,
-1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 8, 21, 36, 47, 47, 36,
-23, 12, 4, 0, -3, -6, -6, -6, -6, -8, -9, -6, -1, 4, 5, 3,
--2, -5, -8, -10, -12, -13, -11, -8, -5, -3, -2, -1, 2, 4, 6, 6,
-4, 3, 2, 1, -1, -2, -2, 0, 2, 2, 2, 3, 3, 4, 4, 2,
-1, 6, 22, 42, 56, 57, 45, 29, 15, 3, -5, -9, -9, -7, -4, -6,
--7, -7, -2, 5, 8, 8, 4, -2, -7, -12, -17, -18, -15, -11, -6, -2,
--1, 1, 4, 6, 7, 6, 4, 3, 0, -2, -4, -5, -4, 0, 2, 3,
-5, 5, 5, 5, 4, 2, 1, -1, 4, 21, 43, 57, 59, 46, 28, 12,
--3, -12, -15, -13, -6, -2, -4, -4, -2, 3, 9, 11, 8, 3, -3, -11,
--18, -22, -20, -12, -5, -1, 3, 5, 6, 8, 6, 3, 3, 1, -2, -5,
--8, -7, -3, -1, 3, 6, 6, 8, 7, 3, 2, -1, -2, -2, -4, 0,
-22, 49, 65, 67, 53, 32, 12, -9, -24, -25, -17, -7, 0, 0, 1, 6,
-11, 12, 10, 8, 2, -7, -18, -26, -25, -17, -8, 0, 7, 11, 13, 10,
-5, 1, 0, -2, -5, -8, -9, -7, -4, 0, 4, 7, 11, 11, 7, 2,
--1, -4, -4, -5, -6, -6, -2, 13, 58, 74, 73, 58, 32, 4, -21, -36,
--33, -19, -5, 5, 9, 11, 14, 14, 10, 9, 5, -4, -15, -26, -30, -22,
--13, -2, 10, 17, 18, 15, 6, -1, -4, -7, -9, -9, -8, -6, -2, 0,
-6, 11, 12, 11, 7, 0, -4, -7, -10, -7, -4, -2, 2, 6, 27, 62,
-81, 78, 64, 36, 2, -27, -45, -39, -19, -1, 10, 17, 19, 18, 14, 8,
-5, 1, -9, -23, -30, -29, -21, -10, 4, 17, 23, 21, 11, 1, -5, -10,
--12, -12, -10, -4, -2, 0, 6, 10, 13, 13, 7, 2, -3, -10, -12, -9,
--6, 0, 4, 4, 8, 27, 59, 78, 77, 63, 36, -1, -32, -45, -36, -15,
-4, 16, 22, 22, 17, 9, 5, 3, -2, -14, -25, -29, -27, -18, -4, 10,
-22, 23, 16, 5, -4, -10, -13, -13, -9, -6, -3, 0, 3, 9, 12, 13,
-10, 4, -2, -9, -12, -10, -6, -1, 4, 6, 6, 16, 44, 70, 77, 70,
-50, 16, -20, -41, -41, -22, -2, 13, 23, 26, 18, 10, 6, 2, -2, -12,
--22, -27, -28, -21, -7, 8, 20, 23, 16, 8, -3, -12, -14, -13, -10, -5,
--2, 0, 4, 8, 12, 12, 9, 5, -3, -10, -12, -10, -7, 0, 5, 8,
-7, 8, 30, 59, 71, 69, 56, 28, -8, -35, -39, -25, -8, 8, 21, 25,
-17, 10, 6, 3, -1, -10, -18, -23, -28, -23, -8, 5, 16, 22, 17, 8,
--2, -11, -13, -12, -10, -5, -2, 0, 5, 7, 10, 12, 9, 3, -2, -9,
--12, -9, -6, -1, 6, 7, 6, 6, 16, 46, 68, 68, 61, 40, 4, -25,
--36, -29, -10, 3, 14, 23, 17, 10, 8, 6, 3, -5, -16, -22, -27, -26,
--12, 3, 14, 20, 17, 9, 0, -8, -11, -11, -8, -6, -6, -2, 3, 6,
-10, 13, 11, 4, -2, -8, -10, -10, -6, 1, 3, 5, 7, 4, 9, 33,
-60, 68, 63, 48, 21, -11, -29, -26, -12, -3, 6, 16, 15, 10, 11, 12,
-8, 0, -14, -22, -27, -28, -17, -1, 10, 14, 15, 10, 2, -4, -6, -6,
--9, -9, -9, -6, -1, 5, 12, 14, 11, 6, -1, -6, -8, -9, -4, -1,
--1, 3, 5, 3, 6, 23, 51, 66, 64, 53, 33, 6, -16, -20, -13, -5,
-0, 6, 10, 14, 13, 14, 15, 5, -11, -22, -27, -27, -20, -8, 3, 8,
-9, 7, 5, 3, -1, -4, -8, -12, -13, -9, -3, 4, 10, 13, 11, 7,
-3, -1, -4, -5, -4, -5, -4, 0, 3, 5, 6, 14, 40, 60, 60, 58,
-45, 17, -4, -15, -16, -9, -9, -6, 3, 5, 10, 18, 19, 13, -1, -15,
--24, -27, -25, -17, -8, -3, 0, 5, 7, 9, 10, 4, -3, -8, -14, -15,
--7, -2, 3, 7, 9, 9, 8, 8, 6, 2, -3, -6, -7, -7, -3, 1,
-3, 8, 27, 49, 58, 60, 51, 32, 11, -5, -10, -10, -13, -16, -13, -7,
-2, 11, 19, 19, 9, -3, -14, -18, -22, -22, -20, -19, -16, -10, -1, 9,
-13, 12, 8, 1, -4, -7, -7, -6, -7, -5, -3, 2, 8, 12, 14, 12,
-8, 3, 0, -2, -3, -3, -5, -5, 7, 32, 50, 56, 56, 47, 32, 18,
-10, 3, -7, -21, -29, -27, -21, -10, 0, 6, 5, 1, -1, -2, -4, -9,
--18, -25, -28, -27, -20, -11, -5, -1, 2, 4, 8, 12, 11, 7, 3, -3,
--5, -2, 1, 2, 4, 4, 6, 10, 11, 14, 12, 8, 4, 0, 2, 16,
-30, 32, 34, 35, 31, 30, 30, 27, 19, 8, 1, 0, -1, -1, -1, -4,
--7, -6, -4, -2, -4, -7, -11, -13, -14, -13, -13, -15, -17, -16, -14, -11,
--8, -7, -7, -6, -5, -3, 0, 0, -1, 0, 0, 2, 4, 4, 5, 4,
-5, 7, 7, 8, 9, 13, 19, 19, 19, 22, 23, 21, 21, 20, 18, 14,
-13, 13, 10, 8, 8, 6, 4, 4, 3, 1, 0, -1, -2, -3, -4, -5,
--6, -7, -7, -7, -8, -8, -8, -9, -8, -8, -8, -7, -7, -7, -6, -6,
--6, -4, -4, -4, -3, -2, -2, -1, -1, -1, 1, 3, 7, 6, 6, 9,
-9, 9, 11, 11, 11, 10, 10, 11, 10, 9, 10, 9, 8, 8, 7, 7,
-5, 5, 4, 3, 2, 1, 0, -1, -1, -2, -3, -4, -4, -5, -5, -5,
--6, -6, -6, -6, -6, -7, -6, -6, -6, -5, -5, -5, -4, -3, -4, -3,
--2, -1, 2, 2, 0, 3, 3, 3, 4, 4, 4, 5, 4, 6, 5, 4,
-5, 4, 3, 4, 3, 2, 2, 2, 0, 1, 0, -1, -1, -2, -2, -2,
--3, -3, -2, -4, -3, -3, -4, -3, -3, -3, -3, -3, -1, -2, -1, -1,
--1, 0, 1, -1, 2, 1, 0, 2, 5, 5, 1, 3, 5, 2, 2, 4,
-3, 2, 3, 3, 1, -1, 2, -1, -3, 2, -3, -2, 0, -2, -3, -1,
--2, -3, -3, -1, 0, -4, 2, 2, -2, 1, 1, -1, 2, 1, 0, 5,
--1, 0, 4, 0, -2, 6, 4, -5, 3, 4, -4, 0, 2, -1, 0, -5,
-3, 0, -7, 1, 4, -5, -2, 1, 0, -5, 3, -1, -2, 0, 1, -3,
-2, 2, -5, 2, 6, -4, -4, 11, -4, -3, 4, 7, -11, 2, 6, -4,
--5, 7, -1, -5, 1, 5, -6, -2, 4, -2, 0, -4, 7, -2, -3, 4,
-1, -2, -3, 3, 1, -1, -2, 3, 3, -4, 1, 4, -2, -2, 6, -4,
-2, 3, -7, 7, 2, -10, 3, 7, -8, 0, 5, 0, -4, -3, 8, -3,
--9, 12, -5, -8, 7, 5, -10, 1, 10, -11, 4, 3, 1, -11, 12, -5,
-2, -1, 0, 3, 0, -2, 6, -4, -3, 3, 2, 1, -5, 3, 2, -3,
--1, 6, -8, -1, 6, -2, -4, 3, 4, -10, 5, 11, -15, -4, 15, -6,
--5, 3, 8, -6, -7, 11, 12, -28, 15, 16, -22, 5, 12, -3, -10, 4,
-12, -10, -4, 15, -11, -3, 11, -9, -4, 6, -3, -3, 4, -7, 9, -7,
--3, 5, 3, -9, 6, -1, 0, -6, 6, 2, -10, 11, -1, -8, 6, 7,
--14, 7, 6, -11, 11, -9, 3, 9, -11, 2, 7, 2, -15, 10, 4, -2,
--10, 13, 2, -14, 0, 25, -16, -13, 17, 4, -9, -14, 31, -15, -21, 24,
-2, -19, 4, 12, -11, 3, 4, -2, -10, 18, -1, -19, 19, 1, -14, 4,
-21, -23, 2, 9, 3, -7, 1, 1, -1, -1, 12, -18, 7, 5, -7, 8,
--6, 8, -8, 6, 3, 3, -15, 10, 0, 3, -6, -3, 12, -7, 6, -6,
--4, 11, -8, -4, 18, -18, -6, 24, -3, -29, 29, 1, -12, -11, 27, -5,
--27, 23, 8, -21, 1, 15, 2, -25, 19, 10, -24, 6, 25, -23, -12, 30,
--9, -10, -4, 22, -5, -24, 15, 16, -21, -6, 21, -6, -15, 4, 25, -15,
--24, 27, 17, -35, 3, 33, -15, -30, 32, 13, -28, -11, 36, -1, -37, 15,
-36, -36, -19, 38, 1, -27, 0, 33, -13, -28, 22, 30, -42, -3, 40, -17,
--21, 19, 17, -21, -19, 30, 13, -47, 18, 26, -26, -9, 20, 3, -16, -9,
-24, -2, -23, 11, 14, -15, -2, 6, 7, -3, -16, 25, 2, -17, 6, 13,
--8, -6, 10, -1, 1, -12, 14, -2, -9, 1, 11, 4, -19, 3, 20, -11,
--15, 15, 3, -6, -17, 23, -2, -22, 4, 28, -21, -12, 12, 9, -11, -10,
-21, -3, -20, 11, 22, -18, -8, 15, 3, -13, 6, 11, -12, -9, 17, 4,
--24, 11, 6, -4, -7, 4, 8, -11, -1, 17, -10, -5, 9, 2, 5, -8,
-4, 6, -3, -5, 12, -4, -7, 0, 14, -7, -3, -2, 6, 4, -7, 3,
-0, -2, -8, 10, -1, -9, -8, 8, 2, -7, -4, 5, -1, -6, 7, 1,
--8, -5, 10, 0, -7, -4, 9, 1, -4, 6, 6, -4, 0, 10, 2, -4,
-2, 10, 1, -5, 6, 11, -6, 0, 11, 1, 0, 4, 10, -3, -2, 9,
-10, -3, 0, 7, 13, 6, 3, 4, 8, 4, 7, 8, 1, 2, 6, 8,
-1, -1, 3, 2, -1, 1, 1, 2, 13, 10, 8, 12, 16, 13, 14, 12,
-11, 6, 5, 9, 4, -2, 0, 3, -1, 0, 0, 1, -1, -1, 2, -1,
--5, -3, -5, -4, -6, -9, -7, -6, -9, -6, -3, -9, -5, -3, -1, -4,
--3, -1, 0, -2, -1, 2, 0, -2, 2, 3, 2, 2, 3, 5, 5, 2,
-6, 5, 2, 4, 6, 2, 2, 4, 1, 2, 2, 1, 1, 0, 0, 2,
--1, -2, 0, -1, 0, 17, 23, 15, 18, 28, 29, 27, 23, 22, 17, 9,
-11, 12, 1, -3, 1, 3, 2, 0, 3, 5, 1, 2, 6, 0, -6, -7,
--7, -9, -12, -12, -12, -13, -11, -7, -5, -6, -6, -2, 0, -1, -1, -2,
--1, -3, -2, 0, -1, -2, 1, 3, 3, 4, 5, 6, 6, 6, 6, 6,
-3, 3, 4, 2, 1, 1, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0,
-0, -3, 3, 23, 34, 31, 31, 32, 35, 37, 30, 23, 14, 3, 4, 7,
-3, -2, -5, 0, 5, 7, 6, 4, -2, -4, -2, -4, -12, -17, -19, -17,
--15, -14, -11, -12, -12, -4, 1, 0, -2, -3, -3, -1, -2, -2, -3, -5,
--5, 2, 5, 3, 4, 6, 7, 6, 6, 7, 3, -2, 1, 4, 0, -1,
-1, 1, 0, 3, 5, 3, 0, 1, 2, 1, -1, -2, -3, -3, -3, -2,
--1, 9, 30, 34, 30, 32, 34, 33, 28, 23, 18, 5, -4, 2, 6, 0,
--1, 2, 4, 7, 9, 10, 5, -5, -6, -3, -8, -15, -15, -17, -18, -15,
--7, -4, -8, -7, -1, 0, -2, -1, -3, -7, -9, -5, -1, -4, -4, -1,
-2, 3, 6, 9, 6, 3, 4, 6, 4, 2, 1, 1, -1, 1, 5, 3,
-2, 2, 4, 5, 2, 2, 1, -2, -2, -1, -1, -2, -3, -2, -2, 2,
-21, 35, 31, 27, 31, 30, 26, 22, 19, 11, -3, -3, 7, 6, 4, 6,
-6, 7, 7, 11, 11, -2, -8, -7, -9, -11, -11, -12, -12, -14, -7, 1,
-0, -3, -3, -3, -4, -4, -3, -4, -11, -9, -3, -2, -1, 2, 2, 2,
-3, 6, 8, 2, -1, 2, 0, 0, 2, 2, 0, 0, 5, 10, 8, 6,
-7, 5, 1, 2, 4, 1, -4, -3, -1, 0, 1, 2, 2, -1, 7, 29,
-33, 28, 26, 22, 18, 16, 15, 14, 1, -8, 0, 5, 6, 9, 9, 6,
-2, 5, 10, 4, -5, -8, -12, -12, -8, -6, -7, -9, -9, -3, 1, 1,
-1, -4, -7, -6, -3, -1, -3, -4, -4, -4, 1, 5, 6, 3, 1, 1,
-2, 3, 4, 1, -2, -2, 1, 3, 3, 4, 2, 0, 1, 4, 4, 2,
--1, -2, -2, -1, 0, 2, 0, -3, -1, 1, 2, 0, 0, 3, 19, 28,
-28, 28, 23, 18, 16, 14, 14, 8, -2, -2, 0, 2, 7, 9, 7, 3,
-2, 5, 3, -2, -4, -10, -13, -12, -7, -5, -6, -6, -5, -4, -1, 0,
--1, -4, -8, -8, -5, -4, -4, -2, -3, -2, 1, 4, 5, 4, 2, 0,
-0, 0, 2, 1, 0, 0, 1, 3, 5, 4, 4, 2, 1, 1, 2, 1,
-0, -1, -1, -1, 1, 2, 2, 1, 0, 0, 0, 0, 2, 14, 24, 23,
-24, 22, 16, 13, 11, 11, 8, 1, 1, 3, 4, 9, 12, 10, 7, 4,
-4, 2, -1, -3, -7, -10, -9, -6, -3, -2, -2, -3, -3, -2, -2, -3,
--4, -7, -9, -7, -5, -3, -2, -1, -2, -3, 0, 1, 0, -1, -2, -3,
--3, -1, 1, 1, 1, 2, 1, 2, 3, 3, 3, 1, 0, 1, 1, 1,
-3, 1, 1, 2, 2, 2, 2, 1, 0, -1, -1, 0, 10, 23, 24, 23,
-20, 16, 12, 9, 11, 10, 1, 0, 3, 5, 9, 11, 13, 8, 2, 4,
-4, -1, -2, -4, -8, -10, -6, -1, -1, -2, -1, -3, -6, -4, -2, -6,
--8, -9, -8, -7, -4, 0, 0, -2, -1, -1, -1, -1, 0, -1, -4, -3,
-0, 0, 2, 3, 3, 2, 2, 4, 4, 2, 1, 1, 0, 0, 2, 4,
-2, 1, 2, 2, 2, 2, 2, 2, 0, 0, 1, 6, 16, 19, 19, 18,
-12, 8, 7, 8, 8, 5, 3, 4, 4, 8, 11, 12, 9, 4, 2, 1,
--2, 0, -2, -5, -6, -4, -2, 0, 0, 0, -3, -6, -5, -4, -6, -6,
--6, -8, -7, -5, -2, -1, -2, -2, -2, -4, -3, -1, -2, -2, -2, -1,
-1, 2, 4, 4, 2, 2, 2, 2, 2, 2, 3, 1, 1, 3, 3, 4,
-4, 3, 2, 2, 2, 2, 1, 1, 0, 0, 3, 13, 16, 16, 15, 12,
-6, 4, 6, 7, 4, 3, 3, 4, 5, 10, 11, 8, 4, 2, 1, -1,
--1, -1, -3, -5, -4, -1, 0, 0, 1, -2, -4, -6, -5, -5, -6, -6,
--6, -7, -5, -2, -2, -2, -2, -4, -4, -4, -3, -3, -3, -3, -3, -1,
-0, 1, 2, 2, 0, 1, 0, 1, 1, 1, 2, 2, 1, 4, 4, 3,
-3, 3, 2, 2, 2, 3, 1, 2, 2, 3, 9, 15, 15, 14, 11, 8,
-5, 5, 8, 6, 4, 5, 5, 6, 9, 11, 10, 5, 3, 2, 0, 0,
-1, -1, -2, -3, -1, 0, 0, 1, -1, -4, -5, -6, -5, -5, -6, -6,
--6, -6, -3, -3, -3, -3, -4, -5, -5, -5, -3, -4, -4, -3, -2, -1,
-0, 0, 1, 0, 0, 1, 1, 1, 2, 1, 2, 2, 3, 4, 4, 4,
-4, 3, 3, 3, 3, 3, 3, 3, 6, 10, 12, 12, 10, 8, 5, 5,
-6, 7, 5, 4, 4, 4, 5, 8, 7, 5, 3, 2, 0, 0, 0, 0,
--2, -2, -2, -2, -1, 0, -1, -3, -5, -5, -5, -6, -5, -5, -6, -6,
--5, -4, -4, -4, -4, -5, -6, -4, -4, -5, -4, -3, -3, -2, -1, 0,
-0, -1, 0, 0, 0, 1, 1, 1, 1, 2, 3, 3, 3, 4, 3, 3,
-3, 3, 3, 3, 3, 3, 4, 8, 11, 11, 10, 9, 6, 5, 5, 7,
-6, 5, 5, 5, 4, 7, 7, 7, 5, 3, 2, 1, 1, 2, 0, -1,
--1, -1, -1, 0, 0, -1, -4, -4, -4, -5, -4, -4, -5, -5, -5, -4,
--4, -4, -4, -5, -5, -5, -4, -5, -4, -4, -3, -3, -3, -2, -2, -1,
--1, -1, -1, -1, 0, 0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 3,
-3, 3, 4, 3, 3, 5, 8, 9, 9, 8, 7, 5, 5, 7, 7, 6,
-6, 5, 5, 5, 7, 7, 6, 4, 4, 2, 2, 3, 2, 1, 0, 0,
-0, 0, 1, 0, -1, -2, -2, -3, -3, -3, -3, -4, -4, -4, -4, -4,
--4, -4, -4, -5, -5, -5, -5, -5, -4, -4, -4, -4, -3, -3, -3, -3,
--3, -3, -2, -2, -2, -1, -1, -1, -1, 0, 0, 1, 0, 1, 1, 1,
-1, 2, 2, 4, 6, 7, 7, 6, 6, 5, 5, 6, 6, 5, 5, 5,
-5, 6, 7, 7, 6, 5, 5, 4, 4, 4, 4, 3, 3, 2, 2, 2,
-2, 2, 1, 0, 0, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3,
--3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
--4, -3, -3, -3, -3, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0,
-0, 1, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 5,
-5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 3, 3, 4, 4, 3,
-3, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1,
--2, -2, -2, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -2, -2, -1, 0,
-1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, -1, -1,
--1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, 0, 0,
-0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -1,266 +0,0 @@
-// TTS sound: opt_horn_dixie
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_dixieSampleRate = 11025;
-const unsigned int menu_opt_horn_dixieSampleCount = 4139;
-const signed char menu_opt_horn_dixieSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 2, -1, 1, 1, -1, 3, 0, 0, 2, 0, 2,
-3, -1, 1, -1, 0, -1, 0, 0, -2, 0, 1, -2, 3, -3, 1, 2,
--1, 1, 0, -1, -3, 0, 2, 1, 0, 2, -2, 2, 0, 1, 0, -2,
-2, -1, 0, -1, 1, 1, -2, 1, 1, -1, -1, 2, -10, 7, -4, 3,
--2, -3, 4, -12, 1, -4, -5, 7, -9, 7, -3, 4, -3, 8, -4, 1,
--2, 1, -4, 1, 2, 3, -1, 0, 1, -2, 0, 5, -4, -5, 4, -5,
-4, -4, 10, -9, 9, -4, 0, -3, -3, 1, 0, 0, 0, 3, 2, 3,
-4, 1, -3, 5, -4, 3, -12, 2, -8, -2, -6, -4, -11, -5, -6, -8,
--5, -13, 2, -13, -2, -4, -5, -2, 0, -6, 3, -8, 11, -6, 4, 1,
-1, 3, -2, 3, 0, -3, 2, 0, -3, 2, -7, 3, -5, 4, -6, -1,
--4, -1, -5, -3, -3, -3, -1, -1, -1, -1, -1, 3, 2, -1, 4, 2,
-3, 0, 5, 1, 1, 3, 2, 2, 13, 15, 6, 16, 20, 22, 19, 22,
-24, 17, 20, 23, 11, 10, 9, 8, 1, -6, -2, -9, -11, -10, -14, -15,
--17, -11, -13, -16, -11, -10, -7, -8, -5, -3, -5, 1, 4, -1, 1, 3,
-4, 4, 5, 6, 3, 6, 8, 4, 4, 6, 5, 4, 1, 6, 1, 0,
-3, 1, -1, -3, 1, 1, 14, 25, 11, 20, 32, 37, 37, 32, 37, 36,
-33, 34, 22, 14, 10, 8, 1, -14, -15, -19, -23, -23, -30, -30, -27, -26,
--18, -22, -20, -9, -7, -2, 1, 2, 7, 5, 13, 11, 5, 9, 9, 8,
-6, 1, 4, 0, 1, 2, -4, -4, -2, 0, -1, -6, 0, 0, -1, 1,
-0, 1, -1, 1, 9, 25, 27, 20, 30, 41, 49, 42, 36, 42, 38, 34,
-28, 18, 7, 2, 2, -11, -23, -26, -26, -27, -32, -32, -31, -29, -19, -17,
--14, -10, -4, 6, 7, 8, 12, 14, 19, 17, 16, 14, 11, 12, 12, 4,
-1, 1, 0, -3, -6, -6, -7, -5, -6, -6, -5, -7, -2, -1, -3, -3,
-2, 2, -3, 15, 36, 28, 21, 38, 55, 48, 40, 46, 42, 32, 35, 27,
-8, -4, 1, -1, -26, -29, -25, -33, -34, -33, -29, -33, -30, -11, -13, -15,
--7, 5, 9, 6, 12, 16, 12, 18, 19, 14, 8, 9, 15, 7, -5, 4,
-2, -4, -5, -3, -5, -12, -3, 0, -10, -7, -2, 2, -4, -5, 5, 0,
--4, 6, 21, 38, 21, 27, 48, 49, 51, 39, 41, 44, 29, 33, 17, 1,
-1, -6, -8, -26, -33, -23, -30, -30, -32, -31, -20, -23, -13, -8, -12, 0,
-6, 12, 7, 6, 19, 15, 13, 13, 10, 13, 6, 9, 6, -4, 1, 2,
--1, -4, -9, 1, -4, -6, -3, -7, 0, -2, -3, 1, -5, 1, 2, -1,
-2, 24, 37, 18, 24, 46, 58, 44, 30, 49, 48, 34, 26, 21, 16, -2,
-1, -5, -24, -28, -25, -21, -37, -38, -27, -26, -23, -24, -15, -11, -9, 1,
-4, 2, 5, 14, 17, 8, 10, 16, 14, 8, 7, 11, 4, 2, 6, 1,
-0, -6, 3, 1, -8, -2, -3, 0, -4, -5, 1, -4, -3, -2, -3, 4,
-12, 14, 11, 14, 28, 35, 24, 24, 32, 36, 28, 18, 23, 18, 13, 6,
-2, -3, -12, -8, -12, -21, -22, -19, -16, -21, -21, -17, -13, -12, -9, -7,
--6, 0, 1, 4, 2, 3, 9, 6, 8, 4, 6, 8, 5, 5, 3, 4,
-4, 2, 3, 1, 1, 2, 1, 1, 0, 0, 3, 0, 0, 0, 5, 11,
-5, 7, 12, 18, 18, 13, 18, 21, 19, 18, 15, 16, 12, 11, 9, 4,
-0, 0, -1, -4, -10, -9, -8, -9, -13, -12, -10, -9, -10, -9, -8, -7,
--5, -4, -4, -3, -2, 0, 0, -1, 0, 1, 2, 1, 1, 1, 2, 3,
-2, 2, 3, 3, 4, 4, 3, 3, 4, 5, 3, 4, 4, 7, 7, 5,
-7, 9, 11, 9, 9, 11, 11, 11, 10, 9, 8, 8, 8, 6, 4, 3,
-3, 2, 0, -2, -1, -3, -3, -4, -5, -4, -5, -4, -5, -5, -5, -4,
--4, -4, -4, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 2, 3, 2, 3,
-4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 5, 5, 4, 4,
-3, 3, 2, 1, 1, 1, 0, 0, -1, -1, -1, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2,
-2, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
--2, -2, -2, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0,
--1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0,
-1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, -1, -2,
--2, 1, 4, 1, -1, -1, -1, 2, 5, 3, -1, -2, -1, 2, 2, 1,
-1, -3, -1, 1, 2, -2, -4, -3, 0, 3, 4, 2, -2, -3, 2, 2,
-5, 2, 0, 0, 1, 4, 2, -1, -3, -2, 1, 4, 0, -4, -5, -5,
--1, 0, -1, -2, -3, -3, 0, 2, 2, 0, 1, 3, 2, 3, 4, 6,
-1, 3, -1, 0, 0, 4, 1, 1, -4, -2, 0, 2, 4, -1, -1, -2,
--1, 0, 0, -1, -2, -2, 0, 2, 2, -1, -2, -2, 0, 2, 1, -1,
--4, 1, 4, 4, 1, 0, -1, 0, 2, 6, 4, -2, -1, 3, 6, 0,
-0, -6, 0, -3, 4, -5, 1, -3, 0, -2, 2, 0, 4, -1, 1, -5,
-0, 3, 4, 2, -3, -2, 0, 4, 3, -2, -3, -2, 1, 3, 0, 1,
--3, 0, 2, 0, 2, -2, 1, -1, 0, 3, 0, 2, -6, 4, -2, 3,
-0, -2, 0, -3, 3, 2, -1, 0, -2, 0, 4, -1, 6, -5, 3, -1,
-5, 0, 0, -4, 1, -2, 3, 1, -2, 4, -3, 1, 0, -1, 2, 1,
--2, -2, -1, 6, -4, 5, -4, 3, -4, 5, -4, 4, -4, 3, -4, 2,
--3, 6, -5, 4, -3, 1, -1, 5, -1, -3, 0, 0, 4, -5, 3, -8,
-3, -1, 5, -7, 1, -1, 5, -3, 5, -1, -2, 3, -1, 4, -4, 5,
--2, 0, -1, 1, 4, 0, -2, 3, -5, 7, -3, 2, -2, -3, 3, -1,
--1, 2, -2, 0, -2, 1, 0, 0, -1, 0, -4, 5, 0, 3, -7, 3,
--2, 5, 0, 1, -5, -4, 6, -2, 2, -4, 0, -2, 4, -1, 3, -5,
-0, -1, 3, -2, 4, -7, 6, -8, 8, -2, 0, 1, -1, 3, 0, 2,
-0, -4, 5, -5, 8, -6, 3, -3, 1, -1, 1, 3, 1, -6, 6, -7,
-7, -4, -2, 4, -10, 10, -7, 5, -3, 0, -1, 1, -3, 4, -4, 2,
--5, 4, 0, 3, -2, 2, 1, -2, 6, -6, 5, -5, 5, -2, 1, -1,
-1, 0, 3, -2, 3, -4, 5, -2, 1, 0, -1, 0, 0, -2, 5, -3,
-1, -1, -1, 2, -1, 0, -1, -3, 4, 0, 2, -4, 2, -1, 1, 4,
--4, 4, -4, 4, -1, -3, 4, -5, 7, -6, 1, 0, -4, 7, -6, 8,
--10, 8, -5, 3, -2, -3, 3, -3, 5, -3, 2, -2, 3, 0, 2, -4,
-2, -4, 7, -4, 2, -2, -1, 3, 0, -1, 0, -4, 4, -3, 4, -2,
-1, -1, 2, 1, 0, -1, 0, 0, -1, 3, -5, 5, -5, 5, -2, -1,
-1, -4, 6, -4, 3, -3, 0, -1, 1, -3, 4, -7, 5, -6, 6, -3,
-2, -2, 0, 2, 0, 0, -2, -1, 1, -1, 2, -3, 2, -2, 2, 0,
--2, 4, -4, 2, 0, 2, -1, 2, -1, 2, -3, 6, -5, 2, -6, 4,
--4, 3, 1, -2, 2, -3, 6, -7, 5, -4, 1, -2, 1, 0, 0, 0,
-2, -1, 0, 0, 1, -2, 4, -4, 2, -3, 2, 2, -4, 7, -8, 8,
--6, 5, -3, -2, 2, -1, 3, -2, 2, -1, 0, 2, 0, -2, 1, -3,
-5, -4, 4, -2, 0, 1, 0, -1, -1, -1, 1, -2, 2, -1, -2, 3,
--3, 5, -5, 3, -1, -2, 1, -1, -1, 4, -6, 8, -8, 8, -7, 6,
--4, 1, -1, 0, -1, 1, -1, 2, -1, 0, 0, 0, 0, 2, -2, 0,
-0, -1, 4, -5, 8, -9, 8, -6, 4, -3, -1, 1, -3, 3, -2, 2,
--4, 5, -3, 2, -2, -1, 1, -2, 4, -2, 1, -1, 2, 0, -1, 3,
--2, 2, -1, 2, -1, 0, 1, -1, 2, 0, 0, -1, -1, 1, -2, 1,
--1, -1, 2, -4, 4, -4, 3, -2, 1, -1, 1, -2, 2, -3, 3, -2,
-0, 1, -1, 1, -1, 1, 1, -1, 2, -3, 1, 0, 0, 2, -2, 4,
--2, 1, 1, -2, 2, -2, 2, -1, -1, 4, -5, 6, -6, 4, -1, -1,
-2, -3, 1, 2, -1, 4, -6, 5, -3, 3, 2, -3, 4, -3, 6, -3,
-2, -2, 2, -3, 4, -5, 4, -6, 7, -4, 2, -1, 1, -2, 1, -2,
-2, -3, 3, -1, -2, 2, 0, 2, -3, 3, -3, 1, 1, 2, -1, -1,
-2, -1, -1, 2, -3, 4, -7, 9, -7, 4, -3, 2, -2, 1, 1, 0,
-0, 0, 1, 1, -3, 5, -4, 2, 1, -1, 3, -3, 3, -2, 0, 2,
-0, -1, 3, -3, 3, -2, 0, 0, -1, 2, -3, 1, -1, 1, 0, 1,
-0, -2, 1, -1, 0, 1, -1, 1, -4, 5, -4, 3, -1, 0, 1, -2,
-4, -5, 4, -5, 4, -2, 2, -1, 1, 0, 3, -3, 2, -4, 2, 0,
-0, 1, -1, 1, 1, -1, 2, -4, 2, 0, -1, 3, -3, 5, -4, 6,
--4, 2, -4, 2, -2, 1, -1, 0, 2, 2, -1, 1, -4, 2, -1, 1,
--2, 0, 4, -4, 6, -4, 4, -5, 4, -3, 0, -1, 2, -3, 3, -4,
-6, -7, 8, -5, 3, -4, 5, -3, -1, 2, -3, 3, -5, 6, -5, 0,
-3, -4, 3, 0, 3, 0, -3, 5, -3, 3, 3, -4, 4, -1, 6, -3,
-0, 1, -2, -2, 2, -4, 0, 1, 2, -1, -1, 4, -4, 1, 1, -1,
--4, 5, -4, 5, -6, 5, -1, -1, 5, -4, 4, -1, 2, 3, -6, 6,
--5, 5, -2, 0, -1, -1, 2, -1, 1, -3, 2, -4, 4, -5, 1, -2,
-2, 3, -1, 0, 0, 0, 0, 2, -4, 1, 0, 5, -4, 3, 0, 2,
--2, 3, -5, 0, 0, 1, -5, 1, -1, 3, -3, 5, -3, 0, 1, 3,
--3, -4, 5, -5, 5, -6, 6, -7, 3, 5, -7, 3, -5, 5, -6, 2,
-1, -4, 4, 1, 0, -2, 4, -1, -1, 0, 2, -3, 2, 1, 2, -3,
-5, -1, -2, 1, -1, 0, -3, 4, -2, 0, 1, -1, 3, -4, 4, -4,
-0, 4, -3, 6, -7, 8, -6, 6, 0, 0, -1, 3, 3, 0, -2, 1,
-0, 1, -1, -3, -2, -1, 6, -7, 5, -6, 6, -2, 3, -2, -1, 3,
-3, -2, 0, 0, 2, -1, 1, -3, 2, 1, 0, -2, -2, 1, 0, -1,
-0, -5, 4, 0, 1, -4, 2, 3, -1, 4, -1, 0, 1, 3, 0, -3,
-4, -1, 3, -5, 5, -5, 2, -1, -2, -1, -1, 4, -5, -2, 1, 0,
--3, 1, -2, -2, 1, 1, -1, -2, 2, 1, -1, 1, 0, -1, 4, -1,
-1, -2, 5, -1, 1, 3, 0, 2, 1, 1, 0, 0, 2, 0, -1, -1,
-0, -1, 0, 0, 2, -6, 5, -3, 3, -4, 1, 0, -3, 1, -3, 0,
--4, 2, 0, -3, -2, 1, -2, 1, -3, 2, -3, 2, 1, -1, 0, -2,
-0, -1, -2, -2, -3, 1, -4, -4, -5, -2, -5, -4, -6, -4, -4, -4,
--3, -4, -2, -2, 0, 0, -1, 0, 4, 3, 4, 2, 7, 1, 8, 5,
-6, 4, 5, 9, 3, 2, 8, 2, 4, 3, 1, -2, -2, -2, -6, -5,
--5, -6, -8, -6, -6, -9, -6, -4, 3, 2, 4, 7, 13, 16, 18, 16,
-21, 22, 24, 20, 20, 19, 17, 16, 11, 9, 5, 5, 0, -3, -6, -7,
--9, -10, -13, -12, -13, -11, -13, -12, -9, -9, -7, -7, -5, -3, -2, 0,
-0, 2, 2, 3, 5, 2, 4, 4, 4, 3, 2, 2, 2, 1, 1, 0,
-0, -1, -1, -1, -2, 0, -1, -2, -1, 0, -2, -1, 1, 11, 13, 12,
-17, 27, 29, 29, 30, 34, 34, 34, 30, 27, 24, 22, 17, 9, 7, 2,
--1, -8, -11, -13, -15, -16, -18, -18, -18, -18, -14, -14, -13, -10, -6, -5,
--5, 1, 3, 1, 4, 7, 6, 5, 9, 7, 4, 6, 7, 2, 2, 3,
-1, -1, -1, 0, -4, -2, -2, -5, -4, -2, -2, -3, -3, 0, -1, -1,
--1, 0, 6, 17, 14, 13, 24, 32, 31, 28, 33, 37, 33, 31, 27, 25,
-24, 18, 10, 6, 5, 0, -6, -10, -10, -11, -15, -17, -15, -13, -13, -13,
--11, -7, -5, -4, 0, 0, 3, 6, 5, 6, 7, 9, 7, 4, 9, 5,
-4, 3, 2, 1, -1, 0, -4, -3, -1, -5, -5, -3, -2, -6, -3, -1,
--3, -2, 1, -1, 1, 1, 1, 3, 12, 19, 11, 18, 32, 31, 27, 27,
-38, 35, 26, 29, 27, 23, 17, 12, 9, 4, 3, -5, -10, -7, -12, -15,
--15, -14, -14, -15, -11, -11, -8, -4, -4, -3, 0, 5, 3, 4, 8, 8,
-7, 6, 10, 5, 5, 6, 3, 2, 2, 0, -1, -4, -1, -3, -7, -3,
--5, -6, -6, -5, -3, -6, -4, -1, -4, -1, -2, 2, -2, -1, 12, 17,
-9, 14, 30, 30, 21, 29, 36, 32, 27, 29, 26, 23, 21, 14, 8, 9,
-6, -4, -8, -5, -7, -16, -14, -11, -13, -15, -12, -10, -9, -8, -4, -4,
-0, 2, 3, 4, 5, 9, 5, 7, 7, 6, 6, 4, 4, 2, 1, 2,
--3, -1, -1, -3, -5, -4, -1, -6, -5, -2, -3, -2, -3, -1, 0, -2,
-0, 2, 2, 0, 1, 10, 16, 9, 13, 27, 28, 20, 25, 34, 30, 25,
-27, 26, 25, 19, 14, 13, 9, 7, -2, -4, -2, -6, -12, -13, -10, -10,
--14, -12, -10, -7, -8, -9, -2, -1, -1, -1, 4, 6, 4, 4, 8, 7,
-6, 6, 6, 5, 5, 3, 1, 2, 2, -1, -3, 1, -3, -3, -3, -2,
--3, -4, -3, -2, -3, -2, -2, -1, 0, 0, 0, 0, 8, 14, 8, 11,
-26, 26, 19, 23, 36, 30, 23, 29, 31, 25, 20, 19, 17, 11, 10, 2,
-0, 1, -5, -12, -9, -7, -14, -16, -11, -10, -16, -11, -7, -10, -7, -4,
--3, -2, 1, 4, 0, 5, 9, 3, 6, 8, 9, 4, 4, 9, 4, 1,
-4, 3, 0, -1, 1, -1, -4, -1, -4, -4, -2, -3, -4, -2, -1, -3,
--2, 1, -1, -1, 10, 11, 6, 14, 25, 20, 16, 26, 33, 22, 24, 30,
-27, 20, 19, 21, 13, 11, 9, 3, 1, 0, -5, -9, -8, -8, -14, -13,
--10, -13, -13, -11, -10, -9, -8, -5, -5, -2, 0, 1, 2, 4, 6, 4,
-5, 8, 6, 5, 5, 7, 5, 3, 5, 3, 3, 0, 1, 1, -1, -3,
--1, -2, -3, -3, -2, -2, -5, -2, -1, -4, -2, -1, -1, 6, 8, 6,
-10, 20, 20, 14, 23, 31, 24, 21, 27, 29, 21, 17, 22, 18, 11, 9,
-8, 5, 0, -3, -5, -7, -7, -12, -14, -11, -11, -16, -15, -9, -11, -14,
--9, -5, -8, -7, -2, -1, -1, 0, 3, 4, 3, 5, 4, 6, 7, 5,
-6, 6, 6, 4, 3, 5, 3, 0, 1, 2, 0, -3, -1, 0, -3, -3,
--2, -2, -4, -2, -2, -4, -1, 7, 4, 2, 14, 19, 13, 15, 25, 28,
-18, 23, 30, 25, 19, 21, 24, 17, 11, 13, 10, 5, 2, -1, -1, -6,
--8, -10, -11, -10, -14, -15, -11, -12, -14, -13, -7, -8, -10, -5, -2, -4,
--3, 1, 2, 1, 3, 6, 5, 5, 6, 6, 5, 7, 6, 4, 5, 5,
-3, 1, 3, 2, -1, 1, 0, -2, -2, -2, -3, -4, -2, -3, -6, -3,
-0, 2, 0, 4, 11, 11, 10, 16, 21, 20, 18, 23, 26, 21, 21, 22,
-22, 17, 14, 15, 11, 8, 4, 2, 2, -4, -6, -7, -7, -10, -13, -11,
--11, -13, -13, -12, -10, -11, -10, -7, -7, -5, -5, -2, 0, 0, 0, 3,
-3, 5, 3, 6, 7, 5, 5, 6, 7, 4, 3, 5, 5, 1, 2, 3,
-2, 0, 0, 2, -1, -2, 0, -1, -2, -3, 0, 4, 1, 3, 8, 11,
-10, 12, 18, 19, 17, 20, 23, 22, 20, 19, 21, 18, 15, 13, 13, 10,
-5, 4, 3, -1, -4, -5, -6, -8, -11, -9, -9, -11, -11, -9, -10, -10,
--8, -7, -6, -5, -3, -3, -2, -1, 0, 0, 2, 2, 2, 2, 3, 4,
-1, 2, 3, 2, 1, 2, 2, 1, 0, 1, 1, -1, 1, 0, 0, 0,
--1, 0, 0, 0, 0, 0, 5, 4, 2, 9, 11, 10, 10, 17, 19, 14,
-18, 23, 19, 18, 19, 20, 18, 14, 15, 13, 10, 8, 5, 4, 2, -1,
--4, -3, -5, -8, -9, -7, -9, -11, -9, -7, -9, -10, -6, -5, -8, -5,
--4, -3, -3, -3, -1, -2, -1, 0, 0, 1, 0, 0, 1, 1, 0, 0,
-1, 1, 0, 0, 1, 1, 0, 0, 2, 1, 1, 1, 2, 2, 0, 2,
-3, 4, 4, 4, 8, 9, 8, 10, 12, 15, 12, 14, 17, 16, 14, 15,
-16, 14, 11, 11, 11, 8, 6, 5, 5, 2, -1, -1, -1, -3, -5, -5,
--4, -7, -7, -6, -6, -7, -7, -5, -4, -6, -5, -3, -3, -3, -4, -1,
--2, -3, -2, -1, -1, -2, -2, 0, -1, -2, -1, -1, -1, -1, -1, 0,
--1, 0, 1, 0, 1, 0, 1, 2, 1, 1, 2, 2, 2, 5, 5, 3,
-7, 9, 7, 8, 13, 13, 10, 13, 16, 13, 12, 15, 14, 11, 11, 12,
-9, 7, 8, 6, 3, 3, 2, 0, -1, 0, -3, -3, -2, -3, -5, -4,
--3, -5, -5, -3, -3, -5, -3, -3, -3, -4, -3, -3, -3, -3, -2, -3,
--3, -2, -3, -3, -2, -2, -3, -2, -1, -2, -2, -1, 0, -1, -1, 1,
-0, 0, 1, 1, 1, 1, 2, 1, 2, 5, 3, 4, 7, 7, 6, 8,
-11, 10, 8, 12, 13, 10, 11, 13, 11, 10, 10, 11, 9, 7, 7, 6,
-5, 3, 3, 3, 2, 0, 0, 0, 0, -2, -2, -1, -2, -3, -2, -2,
--3, -3, -2, -2, -4, -2, -3, -3, -3, -3, -3, -3, -2, -3, -3, -2,
--2, -3, -3, -1, -2, -3, -1, 0, -2, -1, 0, 0, -1, 0, 1, 0,
-0, 1, 1, 0, 2, 3, 1, 3, 5, 5, 4, 7, 8, 7, 7, 9,
-10, 8, 8, 10, 9, 7, 8, 8, 7, 5, 6, 6, 4, 3, 4, 3,
-2, 1, 2, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1,
--2, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2,
--1, -2, -2, -1, -1, -2, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0,
-1, 2, 1, 3, 4, 3, 4, 5, 6, 5, 6, 7, 7, 6, 7, 7,
-7, 6, 6, 7, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 3, 3,
-2, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 1, 1, 0, 3,
-3, 2, 3, 4, 4, 4, 4, 5, 5, 4, 5, 5, 5, 4, 4, 4,
-4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 3, 2, 1, 2, 2,
-1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, -1,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, 0, 1, 0, 0, 2, 2, 2, 2, 3,
-3, 3, 3, 4, 4, 3, 4, 4, 3, 3, 4, 4, 3, 3, 3, 3,
-3, 3, 2, 3, 3, 2, 2, 2, 2, 2, 1, 2, 2, 1, 1, 1,
-1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
--1, -1, 0, 0, 1, 0, 0, 1, 2, 1, 2, 2, 3, 2, 2, 3,
-3, 2, 3, 3, 3, 2, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0,
-0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
-2, 1, 1, 2, 2, 2, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -1,510 +0,0 @@
-// TTS sound: opt_horn_mantge
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_mantgeSampleRate = 11025;
-const unsigned int menu_opt_horn_mantgeSampleCount = 8046;
-const signed char menu_opt_horn_mantgeSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 6, 6,
-6, 7, 7, 6, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 0,
-0, -1, -1, -1, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3,
--2, -2, -2, -2, -1, -1, -1, 0, 0, 0, 1, 1, 1, 1, 2, 5,
-7, 9, 10, 11, 13, 14, 15, 17, 19, 19, 19, 19, 18, 18, 17, 17,
-16, 14, 12, 11, 9, 8, 6, 4, 3, 1, -1, -2, -4, -5, -5, -7,
--7, -8, -8, -8, -8, -7, -7, -6, -6, -5, -4, -3, -2, -2, -1, 0,
-1, 2, 2, 3, 3, 4, 4, 4, 4, 5, 8, 11, 14, 16, 18, 19,
-20, 22, 24, 25, 25, 25, 24, 23, 22, 21, 20, 19, 16, 14, 12, 9,
-8, 6, 3, 2, -1, -3, -4, -6, -6, -7, -8, -8, -9, -9, -9, -8,
--8, -7, -6, -5, -5, -4, -2, -1, 0, 1, 1, 2, 3, 3, 4, 4,
-5, 5, 5, 5, 5, 8, 12, 15, 17, 20, 20, 22, 24, 26, 28, 29,
-27, 27, 26, 24, 24, 22, 21, 19, 15, 12, 10, 7, 5, 3, 0, -2,
--5, -7, -8, -9, -10, -10, -11, -12, -12, -12, -10, -9, -9, -7, -7, -6,
--4, -3, -1, 0, 1, 2, 3, 3, 5, 5, 5, 6, 6, 6, 6, 5,
-8, 13, 16, 19, 21, 22, 24, 26, 27, 30, 31, 29, 29, 27, 25, 25,
-23, 22, 20, 16, 13, 11, 8, 6, 5, 2, 0, -3, -5, -6, -7, -8,
--8, -10, -10, -10, -10, -8, -8, -7, -6, -6, -5, -3, -3, -1, 0, 0,
-2, 2, 2, 4, 4, 5, 5, 5, 4, 5, 4, 6, 11, 15, 18, 21,
-22, 24, 27, 28, 31, 33, 31, 31, 29, 27, 27, 25, 22, 20, 15, 12,
-9, 5, 3, 1, -3, -5, -8, -11, -11, -12, -13, -12, -14, -14, -13, -13,
--11, -10, -9, -7, -7, -6, -4, -3, -1, 1, 1, 2, 3, 3, 4, 5,
-5, 5, 5, 5, 4, 4, 5, 9, 13, 16, 19, 20, 22, 26, 28, 31,
-33, 33, 32, 31, 30, 29, 28, 25, 23, 18, 14, 12, 8, 6, 3, -1,
--4, -6, -9, -10, -11, -12, -13, -14, -14, -14, -13, -12, -11, -10, -9, -9,
--8, -6, -4, -3, -2, -1, -1, 0, 1, 2, 3, 2, 3, 3, 3, 3,
-3, 3, 8, 14, 17, 21, 22, 24, 27, 29, 31, 33, 30, 28, 27, 25,
-24, 21, 19, 16, 13, 10, 9, 6, 4, 3, 0, -1, -3, -4, -4, -6,
--8, -8, -9, -10, -9, -10, -10, -11, -11, -10, -10, -10, -9, -9, -9, -7,
--7, -6, -5, -5, -3, -3, -2, -1, -1, 0, 1, 0, 5, 21, 26, 26,
-28, 30, 32, 35, 33, 29, 24, 17, 17, 17, 13, 10, 6, 6, 7, 7,
-9, 6, 2, 1, 1, -1, -5, -9, -11, -16, -16, -15, -16, -18, -18, -16,
--14, -13, -10, -11, -11, -9, -8, -7, -7, -8, -6, -6, -4, -2, -1, 0,
-2, 3, 6, 7, 6, 3, 9, 32, 50, 47, 41, 46, 51, 51, 49, 41,
-24, 12, 16, 21, 11, 1, 1, 4, 7, 10, 10, 2, -7, -4, -1, -10,
--18, -25, -26, -25, -23, -20, -22, -24, -16, -9, -7, -8, -9, -7, -7, -5,
--4, -6, -8, -8, 0, 4, 1, 4, 8, 8, 11, 15, 18, 11, 8, 14,
-18, 41, 58, 46, 41, 51, 57, 55, 40, 33, 20, 7, 17, 15, -4, -5,
--2, 7, 6, 2, 7, -6, -8, 4, -9, -18, -22, -24, -19, -24, -21, -18,
--22, -12, -5, -4, -6, -7, 0, -4, -4, 1, -9, -8, -2, 0, 1, -2,
-6, 8, 5, 14, 11, 5, 9, 9, 7, 1, 12, 45, 50, 41, 49, 50,
-52, 53, 43, 28, 9, 10, 17, 4, -3, -1, -2, 7, 12, 10, 3, -3,
-3, 2, -10, -16, -22, -23, -21, -17, -20, -21, -13, -6, -3, -2, -5, -4,
--3, -1, -3, -9, -10, -6, -2, -1, -2, 1, -1, 5, 10, 2, 4, 3,
-2, 6, -2, 6, 37, 53, 47, 44, 53, 55, 53, 49, 28, 10, 11, 17,
-10, -4, -1, 6, 6, 17, 16, 3, 0, 7, 2, -10, -16, -21, -25, -19,
--15, -19, -21, -12, -2, -3, -6, -2, -4, -8, -3, -3, -13, -14, -4, -3,
--6, -6, -3, 0, 2, 6, 4, -1, 0, 5, 5, -2, 18, 55, 49, 43,
-53, 52, 53, 49, 40, 22, 2, 14, 18, 1, 3, 3, 8, 14, 16, 17,
-0, -2, 10, -8, -14, -16, -25, -23, -18, -13, -17, -20, -4, -2, -5, -1,
--4, -9, -8, -3, -8, -15, -8, -5, -7, -2, 2, 2, 0, 10, 9, 2,
-5, 5, 1, 0, 8, 41, 55, 46, 49, 52, 51, 54, 45, 26, 7, 9,
-15, 7, 1, 2, 3, 10, 17, 17, 6, -2, 2, -1, -11, -18, -23, -26,
--21, -15, -14, -18, -13, -3, 1, -5, -4, -4, -11, -8, -2, -11, -15, -9,
--2, -2, 1, 6, 3, 2, 13, 11, 2, 3, 2, 5, 36, 63, 48, 38,
-51, 56, 50, 44, 33, 7, 0, 20, 15, -4, 1, 6, 9, 15, 18, 9,
--8, -4, 6, -13, -22, -21, -26, -23, -15, -11, -16, -18, -4, 3, -6, -5,
--4, -13, -10, -3, -8, -14, -8, 2, -2, 2, 10, 5, 4, 11, 13, 3,
-0, 6, 19, 54, 61, 44, 46, 49, 49, 50, 36, 18, -2, 8, 18, 5,
-2, 5, 3, 13, 20, 12, -3, -7, -4, -8, -16, -22, -27, -29, -16, -11,
--15, -14, -9, -4, -1, -4, -6, -11, -13, -6, -6, -11, -9, -5, -1, 3,
-7, 7, 5, 6, 11, 8, 3, 3, 2, 14, 55, 64, 46, 46, 51, 46,
-48, 41, 17, -4, 7, 14, 7, 4, 5, 3, 12, 19, 16, -1, -8, -6,
--11, -16, -20, -30, -29, -21, -12, -10, -14, -10, -5, -3, -1, -6, -14, -13,
--10, -7, -7, -9, -4, 2, 6, 13, 10, 7, 9, 15, 7, 3, 19, 49,
-58, 54, 51, 42, 42, 52, 42, 23, 7, 6, 11, 10, 11, 6, -1, 9,
-17, 13, 3, -8, -9, -13, -15, -17, -30, -29, -22, -18, -11, -14, -16, -8,
--7, -6, -4, -11, -16, -11, -7, -7, -10, -3, -3, 3, 16, 14, 10, 13,
-10, 13, 16, 40, 64, 52, 50, 52, 42, 48, 45, 33, 16, 5, 17, 13,
-6, 13, 6, 2, 11, 15, 5, -10, -8, -10, -22, -17, -20, -34, -29, -17,
--17, -17, -14, -12, -13, -8, -4, -11, -17, -10, -10, -10, -5, -4, -4, 1,
-7, 11, 8, 6, 7, 7, 16, 50, 65, 49, 47, 49, 44, 45, 46, 28,
-6, 9, 16, 14, 11, 9, 7, 6, 14, 19, 2, -10, -7, -14, -18, -17,
--25, -33, -27, -17, -15, -18, -12, -13, -14, -4, -5, -14, -14, -13, -11, -9,
--6, -5, -4, 0, 8, 11, 9, 8, 9, 18, 47, 63, 51, 43, 45, 41,
-43, 44, 29, 9, 8, 17, 17, 12, 14, 7, 4, 16, 15, 1, -6, -10,
--16, -18, -14, -23, -33, -25, -18, -19, -14, -12, -17, -15, -6, -8, -13, -14,
--14, -12, -9, -4, -4, -6, 2, 6, 9, 11, 8, 12, 40, 64, 60, 53,
-46, 40, 43, 46, 38, 16, 5, 13, 16, 16, 18, 10, 4, 12, 19, 9,
--3, -10, -16, -20, -17, -20, -31, -33, -22, -19, -18, -13, -15, -19, -12, -5,
--13, -16, -14, -16, -13, -5, -5, -6, -2, 5, 9, 10, 10, 21, 49, 63,
-57, 54, 45, 40, 47, 45, 29, 14, 12, 14, 16, 20, 18, 6, 10, 16,
-14, 6, -2, -13, -17, -18, -17, -26, -33, -27, -26, -20, -14, -18, -18, -16,
--12, -10, -14, -13, -17, -16, -9, -7, -5, -5, 0, 6, 7, 12, 23, 49,
-60, 55, 56, 48, 44, 48, 43, 30, 17, 14, 16, 16, 20, 16, 10, 13,
-17, 14, 9, 0, -9, -13, -15, -19, -26, -30, -29, -26, -22, -17, -20, -19,
--15, -14, -10, -13, -16, -16, -15, -13, -9, -8, -7, -4, 4, 5, 8, 22,
-44, 50, 51, 56, 49, 47, 53, 47, 32, 24, 22, 17, 18, 23, 14, 10,
-16, 17, 15, 11, 3, -5, -11, -11, -16, -26, -28, -28, -29, -24, -21, -22,
--23, -18, -13, -17, -14, -15, -19, -15, -13, -12, -13, -11, -5, -4, 1, 11,
-26, 36, 41, 47, 49, 48, 54, 51, 41, 36, 30, 26, 25, 24, 19, 16,
-19, 20, 18, 18, 12, 6, 3, 2, -3, -10, -15, -18, -23, -20, -21, -22,
--20, -19, -17, -15, -15, -17, -17, -15, -15, -14, -12, -11, -10, -7, -1, 8,
-17, 23, 28, 32, 36, 40, 41, 39, 35, 33, 32, 30, 30, 27, 24, 25,
-24, 24, 21, 18, 15, 11, 9, 5, 0, -3, -7, -8, -8, -9, -10, -11,
--11, -11, -10, -11, -12, -13, -13, -12, -12, -11, -11, -10, -7, -5, -1, 5,
-11, 17, 22, 29, 34, 37, 40, 42, 42, 42, 41, 40, 38, 36, 34, 32,
-29, 26, 22, 18, 14, 10, 6, 2, -2, -6, -9, -10, -13, -14, -15, -16,
--16, -16, -16, -15, -14, -13, -12, -10, -8, -7, -4, -3, -1, 0, 5, 11,
-15, 21, 27, 34, 40, 44, 47, 49, 50, 51, 50, 49, 47, 45, 42, 40,
-37, 33, 28, 23, 18, 12, 6, 0, -5, -10, -13, -17, -20, -22, -24, -25,
--25, -26, -26, -27, -26, -24, -23, -21, -18, -16, -13, -10, -6, 0, 8, 14,
-21, 29, 37, 44, 49, 53, 56, 58, 59, 59, 58, 56, 54, 51, 48, 44,
-38, 32, 26, 20, 13, 6, -1, -6, -11, -15, -19, -22, -25, -26, -28, -29,
--30, -30, -30, -28, -26, -24, -22, -19, -16, -13, -10, -7, -1, 5, 11, 18,
-25, 33, 39, 43, 47, 49, 51, 51, 51, 50, 49, 46, 44, 41, 38, 33,
-28, 22, 17, 11, 5, -1, -6, -9, -13, -16, -18, -20, -21, -22, -23, -23,
--24, -23, -22, -20, -19, -17, -15, -12, -10, -8, -6, -1, 4, 9, 15, 21,
-27, 33, 37, 40, 42, 44, 44, 44, 43, 42, 41, 39, 37, 34, 30, 25,
-21, 16, 11, 6, 1, -3, -6, -9, -12, -14, -15, -16, -17, -18, -19, -19,
--19, -18, -17, -16, -14, -12, -11, -9, -8, -5, -1, 3, 7, 12, 18, 23,
-28, 32, 35, 37, 38, 39, 39, 39, 38, 37, 36, 34, 31, 28, 24, 20,
-16, 11, 6, 2, -2, -5, -8, -10, -12, -13, -14, -15, -16, -16, -16, -16,
--15, -14, -13, -12, -10, -9, -8, -6, -4, -1, 3, 6, 11, 16, 21, 25,
-28, 31, 33, 35, 36, 36, 36, 36, 35, 33, 32, 30, 27, 24, 21, 16,
-12, 8, 4, 0, -3, -5, -8, -10, -11, -13, -14, -15, -15, -16, -16, -15,
--15, -14, -13, -12, -11, -10, -9, -7, -4, -1, 2, 6, 10, 13, 17, 20,
-22, 24, 26, 27, 28, 28, 28, 28, 28, 27, 25, 23, 21, 19, 16, 13,
-10, 8, 5, 2, 0, -2, -4, -5, -7, -8, -9, -10, -10, -10, -10, -10,
--10, -10, -9, -8, -8, -7, -5, -3, -1, 1, 3, 6, 9, 11, 13, 15,
-16, 18, 19, 20, 21, 21, 21, 21, 21, 20, 19, 18, 17, 15, 13, 11,
-10, 8, 6, 4, 2, 1, -1, -2, -3, -4, -5, -6, -7, -7, -7, -8,
--8, -8, -7, -7, -7, -5, -3, -1, 1, 4, 6, 9, 12, 14, 16, 18,
-20, 22, 23, 24, 25, 26, 26, 26, 26, 25, 25, 23, 22, 21, 19, 17,
-16, 14, 11, 10, 7, 5, 4, 2, 0, -2, -3, -5, -6, -7, -8, -9,
--9, -10, -10, -9, -8, -7, -6, -4, -2, 0, 2, 4, 6, 7, 8, 10,
-12, 13, 14, 15, 17, 17, 18, 18, 18, 18, 17, 17, 16, 15, 14, 13,
-11, 10, 8, 7, 5, 4, 2, 1, 0, -2, -3, -4, -5, -6, -7, -7,
--8, -8, -7, -7, -6, -6, -4, -3, -2, -1, 0, 1, 2, 4, 5, 6,
-7, 8, 9, 10, 11, 11, 12, 12, 12, 12, 12, 12, 12, 11, 10, 10,
-9, 8, 7, 6, 5, 5, 4, 3, 2, 1, 0, 0, -1, -2, -2, -2,
--3, -2, -2, -2, -2, -1, -1, -1, 0, 0, 1, 1, 1, 2, 2, 3,
-3, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 2, 2, 2,
-2, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
--1, 1, -2, 2, 0, 1, 2, -1, -2, 4, -1, 3, -1, 1, 2, -4,
-5, -4, -1, 0, -5, 0, -2, 0, -2, 1, 1, 0, -1, 4, 0, 0,
-4, -2, 2, 0, 3, -1, 3, 1, 0, 3, 1, 1, 2, -1, 4, -3,
-1, 0, -2, 0, -3, -1, 0, 3, -5, 3, -1, 1, -5, -1, 1, 4,
--5, 6, 6, -2, 12, -2, 10, -4, 10, 0, -2, 7, -5, 8, -10, 9,
--7, -1, 1, -8, 2, -12, 0, -6, -5, 0, -3, -9, 4, -10, 4, -4,
--2, 9, -10, 11, -1, 2, 7, 1, -2, 8, -7, 16, -15, 16, -11, 6,
-4, -7, 0, 3, -3, 0, -9, 13, -18, 7, -5, -1, -6, 6, -6, 0,
--4, 10, -14, 9, -3, 3, -1, 2, 2, 1, 4, 3, 1, 0, 8, -10,
-8, -4, 1, -4, 3, 1, -8, 6, -1, -5, 10, -12, 13, -8, 4, -2,
-1, -3, 1, 0, 4, -5, 4, -1, 6, -8, 6, 0, -3, 9, -9, 7,
-0, 2, -5, 5, -1, -3, 2, 5, -9, 5, 3, -6, 6, -6, 10, -13,
-4, 4, -4, -9, 15, -12, 1, 5, -4, 1, 0, 2, -1, -6, 14, -14,
-6, 2, -4, 1, 0, 7, -11, 12, -1, -2, 1, 4, -1, -5, 10, -5,
--3, 6, -7, 4, -5, 3, 2, -11, 9, -6, 4, -5, 2, 6, -12, 15,
--7, -1, -1, 7, -10, 8, -2, 1, -4, 11, -6, 1, -1, 4, -8, 7,
-2, -7, 2, 3, -1, -4, 5, -4, -3, 6, -1, -7, 5, 1, 3, -9,
-7, 2, -8, 10, -5, -6, 11, -2, -9, 2, 9, -6, -10, 10, 3, -16,
-15, -1, -15, 14, -4, 3, -13, 17, 0, -19, 22, -4, -11, 6, -1, 2,
--6, 2, 3, -8, 11, -8, -6, 9, -4, -2, -3, 4, 6, -12, 4, 9,
--11, 8, -3, 6, -8, 7, 1, -5, 5, 5, -8, 5, 3, -1, -3, -3,
-10, -5, 0, -2, -1, 5, -4, -1, 3, -8, 6, -5, -2, 4, -4, -1,
--2, 10, -2, -12, 14, 1, -7, 3, 5, -5, 1, 7, -3, -7, 15, -7,
--3, 8, -2, -3, -2, 10, -8, -5, 12, -9, -2, 5, -4, -1, 3, -1,
--6, 4, 8, -9, -4, 9, -1, -5, 2, -2, 2, -3, 1, 3, -6, 6,
--7, 3, 2, -2, 2, -3, 2, 6, -7, 2, -2, 2, 3, -8, 3, 2,
--1, -4, -1, 4, -3, -5, 3, -4, 6, -4, -4, 6, 2, -3, -1, 6,
-0, -4, 4, 2, -1, 4, 0, -1, -1, 8, -7, 1, 3, 0, -2, 2,
-5, -5, 1, 5, -4, 0, 2, -3, 1, 0, -2, -3, 2, -1, -4, 0,
-1, -5, 3, 1, -4, -1, 6, -3, -3, 7, 2, -6, 6, 5, -3, 1,
-4, 0, -1, 2, 5, -5, 3, 1, -3, 3, 0, -1, -1, 2, -1, 1,
-2, -4, 0, 3, -4, 0, 1, -1, -2, 2, -2, -2, 3, 1, -4, 3,
-3, 0, 1, 4, 3, -3, 7, 4, 0, 3, 4, 3, 1, 4, 5, -3,
-4, 1, -3, 3, 0, -4, -2, 3, -2, -7, 5, 1, -5, 1, 5, -2,
-0, 5, 4, -3, 4, 3, -3, 5, -2, 2, 4, 3, -1, 4, 6, -1,
-2, 6, 1, 2, 4, 9, 5, 5, 13, 11, 12, 14, 16, 18, 16, 17,
-19, 18, 17, 15, 14, 15, 9, 7, 8, 3, 1, -2, -2, -6, -9, -7,
--11, -11, -11, -14, -11, -12, -12, -11, -10, -7, -9, -8, -3, -5, -4, -2,
--2, -1, 5, 9, 3, 9, 18, 14, 14, 21, 24, 23, 22, 28, 26, 25,
-24, 24, 22, 20, 16, 12, 13, 8, 2, 1, 0, -5, -11, -8, -10, -17,
--15, -13, -17, -19, -14, -13, -17, -12, -9, -12, -9, -5, -6, -6, -3, -1,
-4, 6, 2, 12, 18, 12, 16, 23, 26, 20, 24, 31, 24, 25, 26, 24,
-23, 18, 16, 14, 12, 7, 2, 2, 0, -8, -9, -8, -13, -16, -15, -14,
--16, -18, -13, -15, -15, -11, -12, -10, -9, -8, -5, -7, -3, 2, 5, 4,
-5, 18, 16, 11, 22, 28, 25, 21, 30, 34, 24, 26, 29, 25, 20, 17,
-18, 13, 5, 5, 3, -3, -8, -8, -10, -16, -15, -16, -18, -19, -18, -15,
--18, -17, -11, -14, -12, -8, -8, -6, -7, -3, 0, 5, 6, 3, 15, 21,
-14, 17, 30, 31, 22, 29, 37, 30, 24, 31, 32, 22, 19, 22, 15, 8,
-7, 3, -2, -4, -11, -11, -12, -19, -19, -18, -19, -22, -21, -15, -18, -20,
--11, -12, -14, -10, -4, -7, -9, -1, -2, 4, 11, 1, 14, 25, 15, 17,
-30, 36, 25, 27, 42, 35, 28, 31, 35, 30, 19, 21, 21, 11, 5, 2,
-2, -5, -15, -12, -13, -21, -24, -22, -19, -27, -26, -17, -22, -21, -18, -14,
--10, -16, -8, -2, -8, -5, -1, 9, 11, -1, 16, 30, 14, 17, 34, 39,
-26, 25, 48, 39, 24, 37, 37, 31, 21, 20, 26, 12, 2, 6, 5, -8,
--17, -9, -13, -27, -25, -18, -25, -31, -24, -20, -25, -26, -16, -15, -19, -12,
--8, -9, -5, -4, -3, 6, 14, 3, 9, 33, 22, 13, 36, 43, 30, 27,
-47, 46, 25, 36, 44, 29, 23, 25, 24, 12, 6, 6, -1, -6, -12, -15,
--17, -21, -26, -27, -24, -28, -30, -24, -23, -25, -21, -17, -15, -14, -13, -6,
--6, -8, -1, 4, 11, 5, 8, 30, 21, 16, 32, 38, 35, 28, 44, 47,
-32, 39, 40, 36, 31, 24, 26, 20, 11, 7, 4, -2, -10, -13, -16, -21,
--24, -27, -28, -29, -28, -30, -29, -24, -25, -23, -19, -16, -13, -14, -6, -4,
--8, -1, 6, 13, 3, 12, 34, 18, 18, 38, 38, 31, 32, 47, 41, 30,
-41, 40, 31, 29, 28, 24, 15, 13, 9, 0, -1, -8, -13, -16, -19, -22,
--27, -25, -26, -31, -26, -26, -27, -23, -21, -20, -17, -14, -13, -10, -6, -7,
--4, 8, 9, 2, 17, 28, 18, 20, 37, 41, 28, 35, 50, 39, 33, 42,
-40, 32, 26, 29, 23, 13, 13, 5, -2, -3, -13, -16, -17, -23, -28, -27,
--27, -32, -32, -25, -29, -30, -20, -20, -23, -14, -9, -13, -9, 0, -3, -4,
-12, 14, 2, 19, 33, 18, 21, 40, 39, 29, 36, 48, 40, 33, 40, 39,
-32, 27, 25, 23, 16, 7, 5, 2, -6, -14, -13, -15, -26, -26, -23, -29,
--31, -28, -27, -28, -27, -24, -22, -19, -17, -15, -10, -8, -8, -4, -1, 2,
-11, 8, 9, 27, 25, 18, 32, 40, 35, 33, 43, 47, 36, 38, 43, 35,
-31, 30, 25, 20, 14, 9, 2, -3, -5, -16, -18, -17, -28, -28, -26, -30,
--32, -29, -26, -31, -26, -19, -23, -20, -11, -11, -12, -5, 0, -5, -1, 12,
-12, 3, 18, 30, 17, 21, 37, 34, 29, 35, 42, 36, 35, 37, 34, 34,
-27, 24, 22, 18, 11, 3, 6, -1, -12, -9, -13, -19, -22, -22, -23, -25,
--26, -24, -24, -22, -22, -20, -15, -15, -15, -10, -6, -9, -6, -2, -3, -1,
-7, 5, 5, 15, 16, 12, 20, 27, 23, 23, 31, 31, 27, 31, 32, 27,
-28, 27, 22, 20, 20, 13, 8, 9, 4, -3, -3, -5, -10, -12, -14, -14,
--18, -17, -17, -19, -15, -16, -16, -13, -12, -11, -10, -8, -6, -6, -5, -2,
-4, 2, 2, 13, 15, 11, 18, 24, 25, 24, 28, 32, 31, 31, 31, 30,
-30, 27, 24, 23, 21, 17, 12, 10, 8, 2, -1, -3, -5, -9, -11, -11,
--12, -14, -14, -14, -13, -13, -12, -12, -10, -9, -8, -8, -6, -4, -6, -4,
--2, 1, 0, 0, 6, 8, 7, 10, 14, 16, 14, 17, 20, 19, 20, 21,
-20, 20, 19, 18, 16, 15, 14, 10, 8, 8, 5, 1, 0, -1, -3, -6,
--6, -7, -7, -8, -9, -8, -8, -7, -7, -6, -5, -5, -5, -3, -2, -2,
--2, 0, 2, 1, 2, 5, 6, 6, 8, 11, 11, 12, 14, 14, 15, 16,
-16, 15, 15, 15, 14, 12, 12, 11, 8, 7, 6, 4, 2, 1, 0, -2,
--3, -4, -6, -6, -6, -7, -8, -7, -7, -7, -7, -6, -6, -6, -5, -4,
--3, -3, -2, 0, 0, 2, 3, 4, 5, 7, 8, 9, 10, 12, 12, 13,
-14, 14, 14, 15, 15, 14, 13, 13, 12, 11, 10, 9, 7, 6, 4, 3,
-2, 0, -1, -2, -3, -4, -5, -5, -6, -6, -6, -6, -6, -6, -6, -6,
--5, -5, -5, -4, -3, -2, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7,
-8, 9, 10, 10, 10, 11, 11, 10, 10, 10, 9, 9, 8, 7, 7, 6,
-5, 4, 3, 2, 1, 0, 0, -1, -2, -2, -3, -3, -3, -4, -4, -4,
--4, -4, -4, -4, -4, -3, -3, -2, -2, -1, -1, 0, 1, 1, 2, 3,
-3, 4, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5,
-4, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0, -1, -1, -1, -1,
--1, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 1, 1,
-1, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 3, 3, 3,
-3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, -1,
--1, -1, -1, -1, -2, -2, -1, -2, -2, -1, 0, 0, -2, -1, 0, -2,
--1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1,
-1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
-1, 0, 1, 1, 0, 0, 0, 2, 0, 1, 1, 0, 1, 1, 0, -1,
-0, 1, -1, 0, 2, 1, 2, -1, -2, 1, -2, -2, 4, -2, -3, 5,
--1, -4, 5, 1, -4, 0, 1, -3, 1, 2, -2, 0, 1, -1, 1, 0,
-0, 1, -3, 1, 3, -3, -2, 4, -2, -2, 1, 1, -3, -1, 0, -1,
--1, 0, -2, 2, -4, -1, 2, -2, -2, 1, 0, -3, 4, -3, 1, 2,
--1, 2, 0, 2, -4, 2, 3, -1, 0, 2, 4, -3, 1, 4, -2, 2,
-2, -1, 3, 1, -4, 5, 1, -6, 4, 4, -5, 0, 5, -5, 1, 2,
--1, -2, -2, 0, 1, -6, -1, 5, -4, -6, 6, 1, -12, 2, 3, -6,
--4, 6, -6, 0, 3, -3, -2, 8, -8, 1, 7, -2, -4, 8, -1, 1,
-4, -1, 4, -4, 4, 6, -1, -2, 5, 1, -2, 0, 7, -8, -3, 9,
--9, 1, 3, -5, -5, 9, -5, -7, 7, 0, -6, -1, 5, -6, 4, -6,
-3, 6, -12, 5, 10, -15, 8, 5, -8, 3, 5, -8, 5, -1, 4, -8,
-7, 5, -13, 8, 6, -7, -1, 10, -5, -2, 8, -8, 9, -7, 2, 1,
-2, -7, 7, 6, -11, -2, 18, -17, 0, 10, -9, 4, -7, 9, -6, -2,
--6, 18, -17, -1, 10, -3, -11, 10, -5, 1, -1, 1, 1, -7, 3, 2,
--5, 1, 4, -10, 12, -13, 12, -5, -5, 12, -9, 2, 2, 5, -12, 8,
--1, 2, -10, 12, -8, 6, -8, 6, -3, 1, -3, 0, 0, -1, 6, -11,
-4, 1, -1, -6, 5, 2, -8, 4, 2, -5, 0, 4, 2, -7, 3, 3,
--2, -7, 10, -10, 8, -10, 7, -2, 1, -5, 3, -4, 4, 2, -9, 4,
-2, -1, -6, 5, 2, -7, 2, 5, -3, -3, 4, 5, -11, 0, 19, -13,
--10, 24, -3, -22, 17, 15, -26, 3, 19, -6, -15, 17, 4, -13, 4, 6,
-5, -20, 18, -1, -10, 2, 9, -6, -4, 4, 7, -6, -9, 21, -17, 6,
--6, 11, -5, -7, 6, 4, -1, -13, 14, 2, -12, 10, 0, -3, 3, 0,
--5, 13, -9, -5, 12, 5, -19, 7, 13, -12, -2, 7, 7, -17, 2, 16,
--7, -23, 29, -4, -22, 20, -1, -9, 0, 12, -3, -15, 11, 13, -17, 3,
-16, -20, 19, -3, 2, -7, 8, 7, -5, -15, 28, -15, -7, 14, 4, -18,
-6, 15, -21, 4, 12, -6, -17, 23, -4, -13, -2, 20, -5, -15, 8, 13,
--4, -21, 30, 0, -20, 8, 20, -10, -16, 20, 6, -12, -3, 19, -9, -6,
-9, 1, 1, -9, 12, 7, -18, 11, 8, -6, -5, 7, 6, -9, 0, 10,
--5, -9, 14, -7, -2, -7, 10, -2, -10, 4, 3, -14, 7, -1, -6, 0,
--6, 12, -20, 10, 3, -9, 0, 6, -5, -2, 7, -4, 0, -2, 10, -10,
-4, -1, 9, -14, 7, 2, 3, -11, 5, 3, -1, -5, -4, 14, -15, 1,
-5, -6, -2, 3, -1, 4, -11, 12, 0, -6, 12, 0, -5, 9, 6, -6,
-8, 2, 4, -6, 18, -6, 3, 1, 6, 7, -1, 0, 6, 6, -11, 10,
-8, -2, -12, 14, 5, -9, 3, 5, -2, -6, 8, 4, -11, 3, 11, -10,
-2, 5, 3, -7, 4, 7, -2, -4, 4, 4, 3, 11, -2, 9, 16, 11,
-6, 16, 18, 13, 10, 19, 16, 9, 14, 14, 6, 12, 6, 3, 4, 1,
-3, -5, -6, 0, -8, -10, -5, -6, -12, -8, -5, -11, -8, -5, -5, -10,
--1, -3, -5, -3, 1, -1, -1, 1, 1, 3, 0, 2, 2, 11, 15, -1,
-12, 28, 15, 12, 28, 31, 21, 24, 32, 29, 23, 24, 26, 18, 14, 14,
-10, 1, -1, 0, -9, -16, -13, -16, -23, -24, -21, -22, -28, -24, -16, -23,
--21, -11, -15, -12, -7, -7, -4, -2, -2, 4, 3, 6, 7, 5, 6, 8,
-15, 21, 5, 19, 35, 21, 24, 34, 40, 36, 30, 40, 44, 33, 29, 34,
-29, 20, 14, 12, 6, -3, -8, -15, -17, -24, -32, -32, -34, -37, -39, -38,
--32, -35, -33, -25, -24, -21, -14, -11, -7, -2, 1, 5, 7, 10, 14, 11,
-15, 16, 12, 17, 26, 24, 12, 31, 42, 23, 29, 43, 46, 33, 32, 52,
-42, 27, 34, 38, 24, 14, 16, 11, -1, -8, -13, -18, -23, -35, -35, -34,
--44, -45, -42, -40, -42, -41, -32, -29, -30, -21, -12, -13, -8, 3, 2, 6,
-14, 12, 16, 20, 17, 21, 18, 24, 35, 23, 22, 43, 40, 28, 38, 51,
-46, 32, 43, 54, 35, 29, 39, 31, 20, 12, 11, 7, -9, -15, -15, -25,
--34, -37, -37, -43, -48, -44, -44, -44, -44, -37, -31, -33, -23, -15, -17, -5,
--2, -1, 11, 9, 14, 19, 16, 22, 20, 19, 23, 27, 35, 21, 26, 50,
-33, 26, 44, 51, 38, 28, 50, 47, 22, 33, 36, 21, 14, 12, 9, -5,
--11, -11, -24, -28, -29, -39, -40, -39, -44, -44, -42, -37, -38, -37, -24, -25,
--23, -10, -9, -5, 1, 6, 11, 9, 16, 21, 13, 22, 21, 15, 24, 29,
-29, 17, 35, 47, 22, 33, 48, 42, 34, 35, 51, 34, 26, 37, 26, 19,
-15, 7, 5, -5, -14, -14, -24, -28, -32, -39, -33, -42, -44, -34, -41, -36,
--33, -29, -22, -25, -14, -8, -7, -2, 3, 10, 8, 10, 18, 18, 14, 17,
-22, 17, 12, 27, 34, 10, 23, 48, 26, 22, 40, 48, 34, 21, 52, 42,
-19, 31, 31, 25, 6, 7, 16, -8, -14, -12, -19, -23, -38, -30, -28, -45,
--36, -35, -36, -32, -36, -24, -20, -24, -14, -9, -2, -4, 0, 14, 7, 9,
-16, 17, 16, 11, 22, 17, 7, 23, 28, 15, 14, 39, 32, 16, 35, 43,
-33, 26, 37, 44, 24, 23, 32, 24, 9, 10, 10, -3, -8, -15, -15, -21,
--32, -27, -33, -33, -35, -37, -27, -34, -31, -21, -22, -19, -14, -6, -6, -3,
-6, 6, 7, 12, 15, 12, 14, 20, 13, 12, 17, 15, 17, 24, 12, 24,
-35, 17, 27, 34, 32, 31, 23, 40, 30, 17, 29, 21, 15, 8, 5, 6,
--9, -12, -12, -20, -22, -30, -29, -25, -36, -33, -25, -30, -29, -23, -16, -19,
--16, -3, -8, -3, 6, 3, 8, 10, 13, 12, 11, 20, 9, 14, 16, 6,
-16, 16, 20, 8, 18, 38, 8, 21, 40, 23, 24, 27, 36, 23, 16, 30,
-16, 11, 11, 2, 7, -10, -11, -7, -22, -19, -26, -26, -20, -35, -27, -20,
--28, -24, -20, -10, -18, -16, 3, -5, -7, 7, 7, 6, 5, 15, 13, 6,
-15, 13, 10, 11, 7, 12, 9, 14, 15, 6, 27, 19, 11, 30, 25, 23,
-23, 28, 29, 17, 24, 21, 14, 12, 5, 7, -4, -10, -5, -18, -20, -20,
--26, -23, -30, -27, -23, -29, -23, -20, -20, -14, -15, -5, -5, -5, 5, 4,
-7, 10, 8, 17, 10, 10, 18, 12, 8, 12, 13, 5, 10, 22, 6, 6,
-30, 16, 7, 27, 28, 17, 18, 29, 26, 10, 21, 23, 8, 6, 10, 3,
--8, -6, -8, -18, -18, -21, -23, -22, -28, -24, -22, -25, -21, -19, -14, -14,
--13, -2, -5, -1, 3, 5, 9, 6, 12, 14, 7, 15, 12, 11, 12, 7,
-13, 5, 6, 18, 7, 5, 20, 17, 10, 16, 27, 19, 14, 26, 24, 16,
-16, 20, 15, 4, 7, 7, -4, -6, -9, -9, -17, -22, -17, -22, -26, -23,
--21, -21, -26, -15, -13, -17, -10, -5, -3, -3, 0, 9, 5, 4, 13, 12,
-10, 10, 15, 11, 7, 12, 9, 5, 8, 8, 15, 4, 8, 23, 11, 10,
-23, 20, 16, 17, 24, 21, 12, 17, 17, 9, 6, 4, 3, -3, -12, -6,
--11, -21, -18, -16, -20, -25, -20, -13, -23, -19, -9, -12, -13, -7, 0, -2,
--4, 7, 8, 3, 9, 12, 10, 7, 11, 12, 7, 7, 9, 7, 2, 4,
-9, 10, 2, 8, 20, 8, 9, 23, 19, 12, 17, 27, 14, 11, 21, 14,
-8, 7, 7, 2, -6, -5, -7, -12, -15, -17, -14, -19, -23, -15, -14, -19,
--17, -7, -9, -14, -3, 2, -6, 1, 8, 6, 3, 8, 13, 6, 5, 13,
-8, 4, 7, 8, 4, 2, 5, 3, 5, 9, 0, 10, 17, 3, 13, 20,
-13, 14, 18, 21, 13, 13, 19, 10, 7, 9, 3, 1, -4, -5, -6, -12,
--14, -13, -14, -18, -17, -13, -16, -16, -11, -9, -10, -8, -2, -2, -3, 3,
-3, 4, 5, 7, 7, 6, 7, 7, 6, 6, 5, 5, 4, 2, 2, 2,
-3, 7, 3, 5, 14, 8, 8, 17, 16, 14, 16, 19, 16, 14, 15, 13,
-10, 7, 6, 3, -2, -4, -5, -8, -11, -14, -11, -16, -17, -12, -14, -16,
--12, -8, -12, -8, -2, -5, -3, 1, 2, 3, 2, 8, 5, 4, 7, 7,
-4, 5, 5, 6, 1, 2, 5, -1, 1, 6, 6, 2, 8, 14, 8, 9,
-18, 16, 14, 15, 20, 16, 11, 15, 13, 8, 6, 3, 4, -4, -6, -4,
--9, -12, -13, -11, -14, -17, -12, -13, -14, -10, -11, -6, -6, -6, 0, -1,
--1, 3, 3, 4, 3, 6, 5, 3, 6, 5, 3, 4, 3, 1, 3, 2,
-0, 1, 4, 6, 2, 7, 13, 10, 8, 16, 18, 13, 13, 20, 17, 9,
-15, 15, 6, 5, 7, 2, -4, -4, -5, -10, -12, -12, -14, -14, -15, -14,
--12, -14, -11, -9, -9, -6, -5, -2, -2, 1, 3, 2, 5, 4, 4, 7,
-5, 4, 4, 6, 2, 2, 5, 2, -1, 3, 1, 0, 4, 8, 1, 6,
-15, 8, 9, 17, 17, 14, 15, 20, 15, 12, 15, 11, 8, 4, 4, 1,
--4, -6, -8, -10, -14, -16, -13, -19, -17, -15, -16, -16, -12, -10, -10, -7,
--3, -3, -1, 2, 3, 4, 6, 7, 6, 7, 7, 6, 6, 6, 3, 4,
-3, 2, 1, 3, 0, -1, 3, 5, 4, 3, 11, 11, 9, 14, 17, 15,
-14, 18, 19, 13, 13, 15, 10, 5, 5, 3, -4, -6, -7, -11, -14, -15,
--15, -18, -19, -16, -17, -17, -14, -11, -11, -9, -5, -2, -2, 1, 5, 4,
-5, 8, 8, 7, 8, 8, 7, 5, 6, 4, 4, 3, 2, 2, 1, 0,
-0, 1, 2, 3, 2, 5, 7, 6, 8, 10, 10, 9, 10, 11, 9, 8,
-8, 6, 3, 2, 1, -2, -4, -5, -7, -9, -10, -11, -11, -12, -12, -10,
--10, -9, -7, -6, -5, -3, -1, 0, 1, 3, 4, 4, 4, 6, 5, 5,
-5, 5, 4, 3, 4, 3, 1, 2, 1, 0, 0, 0, 0, 0, 2, 0,
-2, 5, 3, 4, 7, 7, 5, 7, 8, 5, 6, 6, 4, 3, 3, 2,
--1, -1, -2, -4, -5, -5, -6, -7, -7, -7, -7, -7, -6, -5, -5, -4,
--3, -1, -1, 0, 1, 1, 2, 3, 3, 3, 3, 3, 4, 3, 2, 3,
-2, 1, 2, 1, 0, 0, 1, 0, -1, 2, 2, -1, 3, 4, 2, 4,
-6, 6, 4, 6, 7, 5, 5, 6, 4, 3, 3, 2, 0, -1, -2, -2,
--4, -5, -5, -5, -7, -6, -5, -6, -7, -5, -4, -5, -3, -1, -2, -2,
-1, 1, 0, 2, 3, 2, 2, 3, 4, 2, 2, 3, 2, 1, 2, 2,
-1, 0, 2, 1, -1, 1, 4, 1, 1, 7, 6, 3, 6, 10, 7, 5,
-11, 10, 5, 8, 9, 4, 3, 4, 3, -1, -1, -1, -4, -6, -6, -6,
--8, -9, -8, -7, -9, -9, -6, -6, -7, -4, -2, -4, -1, 0, 0, 1,
-1, 3, 3, 3, 4, 4, 5, 3, 4, 5, 2, 2, 4, 1, 2, 2,
-2, 0, 1, 5, 3, 1, 7, 8, 5, 9, 12, 11, 9, 12, 14, 10,
-9, 11, 10, 4, 5, 6, 1, -4, -3, -2, -10, -10, -7, -13, -14, -13,
--11, -14, -14, -8, -10, -11, -6, -4, -5, -3, 0, 2, 1, 4, 5, 5,
-8, 5, 7, 8, 6, 6, 8, 5, 4, 6, 5, 2, 3, 3, 1, 0,
-2, 3, 4, 1, 7, 9, 5, 9, 13, 11, 9, 13, 15, 9, 10, 13,
-8, 6, 5, 4, 0, -3, -3, -6, -10, -12, -11, -14, -16, -13, -15, -14,
--14, -12, -10, -10, -7, -5, -4, -2, 1, 3, 4, 4, 8, 6, 6, 10,
-7, 6, 8, 7, 4, 5, 7, 1, 2, 4, 1, 0, 2, 0, -1, 1,
-5, 4, 0, 11, 9, 6, 12, 15, 13, 11, 17, 16, 9, 13, 14, 7,
-6, 7, 1, -1, -2, -7, -8, -10, -13, -14, -14, -16, -17, -13, -15, -15,
--11, -11, -8, -7, -3, -3, -1, 2, 4, 4, 7, 6, 7, 8, 8, 5,
-8, 7, 3, 6, 5, 1, 2, 4, 0, -1, 2, 1, 0, 0, 1, 4,
-6, 0, 9, 15, 5, 11, 20, 14, 10, 19, 20, 11, 12, 18, 9, 5,
-7, 5, 0, -5, -4, -5, -12, -14, -9, -14, -18, -14, -12, -16, -16, -8,
--9, -12, -5, -2, -5, -2, 2, 3, 2, 4, 8, 4, 5, 7, 5, 5,
-4, 5, 4, 2, 2, 2, 1, 0, 1, 2, -1, 1, 2, 1, 3, 8,
-5, 5, 15, 12, 9, 17, 19, 15, 15, 21, 17, 12, 15, 14, 8, 7,
-5, 1, -1, -5, -8, -8, -13, -16, -14, -16, -18, -19, -13, -16, -18, -10,
--10, -11, -7, -3, -3, -3, 3, 4, 2, 5, 7, 6, 6, 6, 8, 6,
-4, 5, 6, 2, 2, 5, 2, 0, 3, 2, 0, 3, 2, 1, 4, 9,
-5, 5, 16, 12, 7, 18, 20, 12, 14, 23, 14, 9, 15, 15, 3, 5,
-7, -1, -7, -3, -7, -13, -14, -12, -17, -19, -17, -16, -16, -17, -13, -10,
--12, -9, -4, -4, -4, 1, 5, 1, 4, 7, 8, 4, 7, 10, 5, 4,
-8, 4, 2, 4, 3, 1, 2, 1, 1, 2, 1, 0, 3, 3, 0, 5,
-12, 4, 6, 20, 12, 8, 21, 21, 14, 16, 24, 17, 12, 17, 14, 7,
-5, 5, 2, -6, -7, -6, -13, -17, -14, -16, -20, -20, -15, -18, -20, -12,
--12, -13, -9, -5, -4, -4, 2, 2, 3, 4, 6, 7, 6, 6, 8, 5,
-5, 6, 5, 3, 2, 4, 3, -1, 4, 3, 0, 3, 3, 4, 2, 5,
-6, 5, 11, 10, 7, 18, 16, 10, 19, 22, 14, 16, 22, 16, 11, 15,
-13, 6, 4, 6, -1, -7, -5, -7, -14, -14, -13, -18, -19, -17, -16, -17,
--18, -11, -12, -13, -8, -4, -5, -4, 2, 3, 2, 6, 7, 8, 6, 8,
-9, 7, 5, 7, 7, 2, 5, 5, 1, 2, 2, 3, -1, 2, 3, 1,
-1, 4, 2, 2, 6, 9, 6, 8, 16, 13, 11, 19, 19, 15, 17, 21,
-16, 15, 14, 12, 10, 6, 3, 2, -2, -7, -7, -9, -14, -14, -14, -16,
--18, -14, -16, -16, -11, -13, -10, -8, -5, -5, -1, 1, 0, 3, 5, 3,
-4, 6, 5, 4, 4, 3, 4, 2, 1, 2, 1, -1, 1, 2, -1, 1,
-2, 1, 3, 4, 3, 5, 6, 5, 10, 13, 6, 15, 18, 12, 15, 21,
-20, 14, 20, 21, 13, 13, 16, 11, 5, 5, 4, -4, -6, -6, -9, -15,
--14, -14, -17, -20, -16, -16, -19, -15, -12, -13, -12, -6, -6, -6, -1, 1,
-0, 3, 4, 4, 5, 5, 5, 6, 4, 3, 5, 2, 1, 3, 3, 0,
-1, 3, 1, 1, 4, 3, 2, 5, 6, 4, 5, 7, 8, 11, 8, 12,
-17, 14, 14, 20, 20, 15, 18, 21, 17, 12, 18, 14, 7, 9, 6, 1,
--1, -2, -6, -9, -10, -12, -14, -14, -16, -16, -15, -16, -14, -13, -12, -10,
--8, -7, -6, -2, -3, -1, 2, 1, 1, 5, 4, 1, 4, 6, 0, 2,
-5, 2, -1, 3, 3, -2, 1, 4, 0, 1, 4, 3, 1, 4, 5, 3,
-3, 6, 9, 8, 7, 15, 15, 11, 17, 21, 18, 15, 22, 22, 14, 17,
-20, 13, 8, 12, 9, -1, 2, -1, -6, -9, -9, -11, -15, -16, -13, -16,
--18, -15, -13, -15, -13, -10, -8, -10, -5, -2, -4, -2, 2, 2, -1, 4,
-6, 1, 2, 6, 3, 1, 3, 5, -1, 0, 4, 1, 0, 2, 3, 1,
-1, 5, 3, 3, 5, 5, 4, 5, 9, 12, 6, 12, 19, 12, 13, 22,
-21, 14, 19, 24, 16, 15, 19, 15, 10, 10, 8, 5, 1, -2, -2, -6,
--10, -10, -11, -14, -15, -13, -14, -16, -13, -12, -13, -10, -7, -7, -7, -3,
--2, -3, 0, 1, 0, 2, 2, 2, 2, 2, 1, 3, 0, -1, 2, 1,
--2, 1, 2, -1, 0, 2, 2, 1, 3, 5, 3, 3, 7, 5, 4, 10,
-11, 6, 13, 17, 13, 14, 20, 19, 17, 20, 22, 19, 18, 19, 17, 15,
-11, 12, 9, 5, 3, 1, -1, -6, -7, -7, -12, -13, -12, -12, -16, -14,
--13, -14, -14, -11, -10, -9, -9, -6, -5, -5, -3, -2, -1, -1, 0, 1,
-0, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 0, 3, 1, 2, 4,
-3, 3, 6, 4, 5, 5, 8, 9, 9, 9, 15, 14, 14, 17, 20, 20,
-17, 20, 22, 19, 16, 20, 17, 13, 11, 13, 7, 3, 4, 1, -4, -5,
--6, -8, -12, -11, -12, -14, -15, -12, -13, -14, -11, -11, -10, -10, -6, -7,
--6, -3, -3, -3, -1, 0, 0, -1, 1, 1, 0, 2, 0, 0, 1, 0,
-0, 0, 0, 1, 1, 1, 2, 2, 2, 4, 3, 4, 4, 5, 4, 5,
-9, 8, 7, 13, 13, 11, 15, 17, 16, 15, 18, 18, 17, 16, 17, 15,
-13, 11, 12, 8, 5, 4, 3, -1, -3, -3, -5, -8, -8, -9, -11, -10,
--11, -11, -10, -11, -9, -8, -8, -7, -6, -4, -5, -4, -2, -2, -2, -1,
--1, -1, -2, -1, -1, -2, -2, -1, -1, -2, -2, -1, -2, -1, 0, 0,
-1, 1, 1, 2, 3, 2, 4, 4, 4, 5, 9, 7, 8, 11, 12, 10,
-14, 16, 15, 14, 16, 17, 15, 15, 15, 14, 12, 10, 10, 8, 5, 4,
-3, 2, -2, -2, -2, -5, -7, -5, -7, -8, -8, -7, -8, -8, -7, -7,
--7, -6, -6, -5, -4, -5, -4, -3, -4, -4, -3, -2, -3, -3, -2, -3,
--3, -3, -2, -2, -2, -2, -1, -1, -2, 0, 0, 0, 1, 2, 2, 3,
-3, 4, 4, 5, 8, 5, 8, 10, 9, 10, 12, 12, 12, 13, 15, 12,
-12, 14, 12, 11, 11, 10, 9, 8, 7, 5, 4, 3, 1, 0, 0, -2,
--3, -3, -4, -5, -5, -5, -6, -5, -6, -5, -5, -5, -5, -5, -4, -5,
--4, -4, -4, -4, -3, -4, -3, -4, -3, -3, -3, -3, -3, -3, -3, -2,
--2, -1, -2, -1, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 5, 4,
-4, 8, 7, 6, 9, 10, 10, 9, 12, 12, 11, 11, 12, 11, 10, 10,
-10, 8, 7, 6, 6, 4, 3, 2, 2, 0, -1, -1, -1, -3, -3, -2,
--3, -4, -3, -3, -4, -4, -3, -3, -4, -3, -3, -4, -3, -3, -4, -4,
--3, -4, -4, -4, -4, -4, -4, -3, -4, -4, -3, -3, -3, -3, -2, -2,
--2, -1, -1, 0, -1, 1, 1, 1, 1, 3, 3, 2, 5, 6, 5, 7,
-8, 8, 8, 9, 10, 9, 9, 10, 9, 9, 9, 9, 8, 7, 7, 7,
-6, 5, 5, 5, 4, 3, 4, 3, 2, 2, 2, 1, 1, 1, 1, 0,
-0, 0, -1, -1, -1, -2, -2, -2, -2, -3, -3, -3, -3, -3, -4, -3,
--4, -4, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2,
--2, -2, -2, -1, 0, 0, 0, 1, 2, 2, 2, 4, 4, 3, 5, 6,
-5, 5, 6, 6, 5, 5, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4,
-3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 0,
-0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -2, -1, -2, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1,
-0, -1, 0, 1, 1, 1, 2, 3, 2, 2, 4, 3, 3, 3, 3, 4,
-3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-2, 1, 1, 2, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
--1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
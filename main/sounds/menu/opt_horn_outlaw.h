@@ -1,279 +0,0 @@
-// TTS sound: opt_horn_outlaw
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_outlawSampleRate = 11025;
-const unsigned int menu_opt_horn_outlawSampleCount = 4342;
-const signed char menu_opt_horn_outlawSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 4,
-2, 2, 0, -1, 0, 0, 0, -1, -1, 0, 1, 1, 1, 0, -1, -1,
--1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-1, 1, -1, 1, 0, 0, 0, -1, 1, -1, -1, 4, 10, 12, 7, 4,
-2, -2, -2, 0, -1, -4, -4, 0, 2, 3, 4, 1, -1, -3, -3, -1,
--3, -3, -2, -1, 1, 2, 3, 2, 0, 0, -1, -1, -1, -2, 0, 1,
-2, 3, 2, 2, 0, 0, -1, -1, 0, -3, -1, 1, 0, 1, 2, 1,
-1, -2, 1, -1, -2, 0, -2, 0, 0, -1, 10, 23, 21, 14, 8, 0,
--6, -4, 0, -1, -7, -5, 1, 4, 7, 9, 3, -3, -6, -5, -4, -5,
--4, -4, -2, 1, 5, 6, 2, 0, -2, -5, -2, -2, 0, -2, -1, 2,
-2, 4, 4, 2, 0, -3, 0, -2, -2, 0, -2, 0, 1, 1, 4, 0,
-0, 0, -3, 1, -3, 0, 1, -4, 3, 20, 43, 39, 23, 14, -4, -12,
--8, -2, 1, -11, -6, 4, 7, 15, 15, 7, -5, -16, -10, -9, -8, -2,
--5, -1, 2, 5, 13, 8, 0, -5, -9, -7, -7, 0, 3, -2, 1, 6,
-5, 6, 4, 1, -5, -8, -3, -1, 0, 1, 2, 3, 1, 4, 4, 0,
--2, -4, -3, -4, -1, 3, 1, 3, 32, 55, 45, 30, 15, -8, -18, -16,
--1, 1, -7, -2, 5, 7, 16, 17, 11, -8, -20, -17, -16, -11, -1, 2,
-3, 0, 6, 12, 6, 1, -3, -10, -14, -8, 0, 3, 5, 6, 5, 5,
-3, 3, 2, -5, -8, -6, -3, 0, 4, 6, 5, 1, 1, 3, -1, -4,
--1, -4, -6, 1, 1, 1, 13, 43, 61, 46, 32, 9, -22, -30, -21, -3,
-4, 4, 14, 10, 6, 15, 13, 4, -10, -21, -22, -23, -10, 4, 7, 10,
-9, 6, 4, -1, -1, -7, -13, -11, -9, -2, 7, 7, 12, 9, 2, 1,
--1, -3, -7, -6, -3, -4, 1, 6, 6, 6, 3, 2, -1, -6, -3, -4,
--4, -1, 1, 5, 4, 22, 63, 70, 60, 46, 15, -19, -34, -21, -3, -1,
-15, 23, 11, 10, 14, 11, 0, -12, -16, -26, -30, -15, -2, 4, 10, 15,
-12, -1, -3, -1, -14, -14, -8, -7, -4, 1, 12, 13, 5, 11, 6, -6,
--6, -5, -6, -7, -3, 7, 3, 4, 11, 4, -1, -3, -4, -5, -9, -3,
-1, -2, 1, 6, 30, 63, 68, 62, 43, 5, -23, -34, -22, -6, 4, 21,
-19, 9, 14, 10, 7, 3, -7, -16, -29, -27, -16, -8, 7, 15, 15, 10,
-2, -1, -9, -12, -8, -10, -8, -4, 2, 8, 9, 13, 10, 4, -1, -7,
--7, -7, -6, 2, 1, 4, 6, 5, 6, 3, 1, -1, -4, -4, -8, -4,
-2, -2, 2, 19, 49, 67, 65, 57, 28, -10, -28, -29, -16, -3, 11, 22,
-14, 9, 12, 9, 6, 1, -5, -18, -30, -26, -17, -6, 6, 16, 18, 7,
-1, 0, -11, -12, -5, -9, -9, -6, -2, 2, 3, 12, 14, 6, 3, -2,
--7, -10, -8, -1, -2, 2, 7, 5, 3, 4, 5, 1, -3, -1, -5, -7,
--3, -3, 5, 34, 63, 69, 65, 49, 14, -18, -30, -24, -13, 0, 15, 16,
-10, 8, 12, 11, 7, 5, -7, -22, -29, -28, -19, -7, 6, 19, 14, 6,
-1, -7, -11, -12, -5, -3, -10, -4, -1, -4, 5, 12, 13, 9, 4, 2,
--9, -12, -5, -4, -1, 4, 7, 4, 1, 6, 4, -1, 3, 0, -5, -5,
--6, -3, 13, 50, 69, 65, 63, 37, -3, -24, -27, -17, -10, 5, 21, 9,
-4, 11, 9, 9, 8, 7, -7, -29, -30, -31, -28, -9, 6, 17, 15, 10,
-9, -7, -10, -4, -7, -6, -6, -5, -5, -7, 4, 11, 11, 15, 11, 3,
--5, -9, -7, -9, -4, 4, 3, 4, 4, 4, 3, 1, 4, 2, -3, -2,
--6, -8, 8, 41, 59, 65, 69, 46, 8, -14, -23, -22, -14, 8, 24, 15,
-11, 11, -2, -3, 6, 10, 6, -3, -9, -22, -32, -21, -10, -1, 13, 17,
-14, 2, -5, -6, -12, -8, 2, -1, 0, -2, -4, -2, -3, 6, 12, 8,
-9, 4, -4, -8, -9, -4, -3, 2, 7, 3, 3, 1, -2, 1, 0, 2,
-1, -2, 9, 30, 48, 65, 74, 66, 40, 13, -9, -25, -28, -16, -2, 7,
-11, 12, 6, -1, -1, 3, 2, 2, 0, -9, -20, -25, -24, -19, -8, 6,
-14, 14, 12, 6, -3, -8, -8, -6, -3, 0, 1, 1, -3, -1, 2, 3,
-7, 10, 8, 4, -1, -5, -8, -8, -3, -1, 3, 4, 1, -1, -5, -6,
--4, -5, 8, 26, 36, 49, 54, 46, 29, 11, -4, -16, -19, -11, -5, 0,
-7, 7, 3, 0, 1, 0, 0, 4, 1, -5, -9, -14, -18, -16, -10, -3,
-5, 10, 12, 8, 3, 0, -5, -7, -4, -1, 0, 1, 2, 0, -2, 1,
-2, 2, 5, 4, 1, -4, -6, -9, -10, -7, -3, 1, 4, 5, 6, 2,
-0, -1, -4, 0, 11, 25, 37, 48, 50, 41, 27, 11, -6, -16, -17, -14,
--8, -1, 4, 5, 2, 0, -1, -4, -2, 2, 0, -1, -4, -9, -14, -15,
--12, -7, -1, 7, 11, 10, 8, 4, -2, -5, -5, -5, -3, 0, 3, 2,
-1, 1, -2, -2, 2, 1, 3, 5, 4, 1, -1, -3, -5, -6, -2, -1,
-1, 4, 4, 2, 1, 5, 15, 23, 36, 47, 44, 39, 27, 8, -7, -18,
--21, -20, -13, -2, 3, 6, 7, 3, -3, -3, -4, -5, -2, 0, -2, -6,
--7, -12, -16, -12, -8, -3, 4, 11, 12, 11, 9, 3, -3, -4, -5, -6,
--2, 2, 3, 3, 4, 2, -1, -1, 0, 0, 2, 4, 2, 1, 0, -3,
--5, -4, -4, -2, 0, 3, 3, 6, 14, 19, 27, 37, 37, 35, 30, 17,
-4, -6, -15, -18, -17, -11, -5, -1, 5, 4, 1, 0, -4, -6, -5, -5,
--3, -1, 0, -2, -3, -3, -6, -5, -2, -1, 3, 6, 7, 6, 5, 3,
--1, -2, -2, -3, -1, 1, 1, 2, 3, 1, 0, -1, -2, -1, -1, 1,
-1, 1, 2, -1, -1, -1, -3, -2, -1, 1, 8, 14, 22, 29, 31, 32,
-28, 20, 13, 4, -2, -6, -9, -8, -7, -6, -4, -5, -5, -6, -8, -7,
--7, -5, -3, -2, 0, 1, 0, 0, -2, -3, -2, -1, 0, 2, 4, 5,
-4, 4, 3, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, -1, -1, -2,
--2, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 2, 5, 8, 13,
-16, 18, 19, 17, 14, 11, 7, 4, 1, -1, -2, -2, -3, -3, -4, -5,
--6, -7, -7, -7, -6, -4, -3, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-1, 2, 3, 3, 3, 2, 2, 1, 1, 1, 1, 0, 1, 1, 1, 1,
-1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-1, 4, 7, 10, 12, 14, 14, 13, 11, 9, 6, 4, 2, 0, 0, -1,
--1, -2, -3, -4, -5, -6, -7, -6, -5, -5, -3, -2, -1, -1, 0, 0,
--1, 0, 0, 0, 1, 2, 2, 3, 3, 2, 2, 1, 1, 0, 0, 0,
-0, 1, 1, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-0, 0, -1, 1, 2, 4, 7, 9, 10, 12, 11, 11, 9, 7, 5, 4,
-2, 1, 1, 0, -1, -1, -3, -4, -5, -6, -7, -6, -6, -5, -4, -3,
--2, -1, -1, -1, -1, -1, -1, 0, 1, 2, 2, 3, 3, 3, 3, 2,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1, -1,
--1, -1, 0, 0, 0, -1, -1, 0, 1, 2, 5, 6, 8, 9, 10, 9,
-8, 7, 6, 4, 3, 3, 2, 2, 1, 0, -1, -2, -3, -5, -5, -6,
--6, -5, -5, -3, -3, -2, -2, -2, -2, -1, -1, -1, 0, 1, 2, 2,
-3, 3, 3, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
--1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 1, 2, 3, 5,
-7, 8, 9, 9, 9, 8, 7, 6, 5, 5, 4, 4, 3, 2, 1, 0,
--1, -2, -4, -4, -5, -5, -4, -4, -3, -3, -3, -3, -3, -3, -3, -2,
--1, -1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
-2, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, -1, -1,
-0, 1, 2, 3, 4, 5, 6, 6, 6, 5, 5, 5, 5, 5, 5, 4,
-4, 3, 2, 1, 0, -1, -1, -2, -2, -2, -2, -2, -3, -3, -3, -3,
--3, -3, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 3, 4, 6, 8, 9, 10, 11, 10, 10,
-9, 9, 8, 8, 7, 6, 5, 4, 2, 1, 0, -2, -3, -4, -5, -5,
--5, -5, -5, -5, -5, -5, -4, -4, -3, -2, -1, -1, 0, 0, 0, 0,
-1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 5, 8,
-10, 11, 12, 13, 12, 12, 11, 10, 10, 9, 8, 6, 5, 3, 1, -1,
--2, -4, -5, -5, -6, -6, -6, -6, -6, -6, -6, -6, -5, -4, -3, -3,
--2, -1, -1, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
-1, 2, 1, 1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1,
--1, -1, 1, 4, 7, 12, 16, 19, 21, 21, 21, 20, 18, 17, 15, 15,
-13, 11, 9, 6, 3, 0, -4, -6, -8, -9, -9, -9, -9, -9, -9, -9,
--9, -9, -9, -8, -6, -5, -3, -2, -1, -1, 0, 0, 0, 1, 1, 2,
-3, 3, 3, 4, 4, 3, 3, 3, 3, 4, 3, 4, 3, 3, 3, 2,
-2, 1, 0, 0, -1, 0, 0, -1, -1, 2, 5, 9, 15, 20, 23, 26,
-27, 26, 24, 22, 20, 17, 16, 14, 11, 9, 5, 1, -2, -6, -10, -11,
--12, -13, -13, -12, -12, -11, -10, -11, -10, -9, -8, -6, -5, -3, -1, 0,
-1, 1, 1, 2, 2, 3, 3, 4, 5, 5, 5, 5, 4, 4, 3, 2,
-3, 2, 2, 2, 2, 1, 1, 0, -1, -1, -1, -2, -1, -1, -2, -1,
--1, 3, 8, 14, 21, 27, 31, 33, 33, 31, 28, 24, 21, 18, 15, 13,
-10, 7, 3, -2, -6, -10, -12, -14, -14, -13, -13, -11, -10, -11, -10, -10,
--10, -9, -9, -6, -4, -3, -1, 0, 1, 1, 1, 2, 2, 2, 4, 4,
-5, 6, 6, 5, 4, 4, 3, 2, 3, 3, 2, 3, 2, 1, 1, 0,
--1, -2, -2, -2, -2, -1, -2, -2, 1, 7, 14, 23, 32, 37, 40, 38,
-33, 26, 19, 13, 7, 4, 4, 2, 1, 0, -3, -7, -10, -12, -14, -13,
--11, -10, -7, -5, -6, -6, -7, -9, -9, -9, -8, -5, -3, -1, 1, 2,
-2, 1, 2, 1, 1, 3, 4, 5, 6, 6, 6, 5, 4, 3, 1, 1,
-2, 1, 2, 2, 1, 1, 1, 0, -2, -1, -2, -2, -1, -1, -2, -1,
--1, 2, 12, 22, 35, 47, 52, 53, 47, 36, 23, 9, 0, -6, -8, -5,
--3, 0, 2, 0, -1, -4, -7, -9, -10, -9, -8, -9, -8, -9, -12, -12,
--14, -15, -14, -11, -8, -4, -1, 4, 3, 3, 2, -1, -1, 0, -1, 2,
-4, 5, 5, 6, 6, 4, 4, 5, 2, 3, 4, 1, 2, 1, -1, -1,
--2, -1, -2, -1, 1, -1, -1, 1, -2, -2, -1, 4, 17, 27, 42, 54,
-54, 52, 40, 21, 7, -8, -16, -15, -13, -5, 3, 7, 10, 8, 4, -2,
--9, -13, -17, -20, -19, -19, -18, -14, -11, -8, -4, -1, 3, 4, 4, 4,
-1, -2, -2, -5, -5, -1, 0, 3, 7, 8, 9, 9, 8, 6, 3, 2,
-0, -2, 0, -1, -2, 1, 1, 0, 2, 2, 1, 1, 0, -1, -2, -3,
--3, -4, -3, -3, -2, 3, 17, 32, 46, 63, 64, 54, 39, 15, -9, -24,
--29, -25, -14, 4, 17, 22, 25, 20, 8, -1, -8, -16, -19, -18, -17, -16,
--13, -10, -8, -5, 1, 4, 5, 6, 6, 1, -4, -7, -10, -12, -7, -3,
-0, 6, 10, 10, 10, 9, 5, 1, 0, -2, -4, -3, -1, -1, 0, 4,
-5, 4, 5, 6, 2, 0, 0, -3, -6, -3, -3, -4, -1, 2, 0, 0,
-6, 18, 30, 44, 60, 60, 50, 36, 12, -13, -25, -29, -23, -9, 8, 22,
-26, 26, 19, 5, -5, -12, -18, -18, -16, -15, -12, -10, -8, -5, -3, 1,
-4, 5, 6, 4, -2, -6, -8, -11, -12, -7, -2, 2, 8, 11, 10, 9,
-5, 2, -1, -4, -4, -3, -3, 0, 2, 2, 3, 4, 3, 3, 4, 1,
--1, 0, -2, -4, -3, -3, -2, -1, 1, 3, 1, 2, 7, 19, 33, 47,
-61, 59, 46, 29, 3, -20, -28, -29, -19, 0, 15, 24, 25, 19, 8, -6,
--13, -16, -19, -14, -8, -9, -8, -7, -8, -9, -4, 2, 4, 6, 9, 2,
--3, -5, -12, -13, -8, -4, 2, 6, 11, 12, 7, 6, 2, -4, -3, -3,
--4, 0, 0, 1, 3, 1, 3, 2, 1, 3, 2, 1, 1, -3, -2, -3,
--5, -2, 0, 1, 4, 5, 5, 3, 2, 13, 27, 39, 57, 63, 50, 34,
-9, -17, -31, -32, -20, -3, 16, 31, 31, 25, 15, -2, -14, -17, -18, -16,
--11, -5, -6, -7, -4, -5, -5, 3, 5, 5, 7, 2, -5, -9, -12, -13,
--11, -3, 4, 7, 12, 12, 7, 4, -1, -5, -3, -4, -1, 3, 2, 4,
-4, 2, 1, 2, 2, 1, 2, 2, -1, -2, -2, -4, -3, -1, -1, 3,
-3, 2, 3, 0, -3, -2, 7, 25, 41, 56, 67, 56, 33, 11, -17, -35,
--34, -23, -4, 17, 31, 36, 26, 14, 1, -16, -20, -17, -16, -10, -6, -5,
--6, -10, -7, -6, -5, 3, 6, 4, 4, -2, -9, -13, -15, -10, -4, 1,
-11, 14, 10, 9, 4, -3, -6, -5, -4, -3, 2, 6, 3, 3, 5, 1,
-0, 3, 2, 0, 1, 0, -2, -4, -3, -2, -2, 1, 4, 2, 3, 3,
-0, -2, -3, -3, 9, 31, 45, 59, 66, 50, 25, 0, -26, -38, -34, -18,
-5, 24, 35, 36, 22, 7, -7, -21, -22, -18, -14, -7, -4, -4, -3, -7,
--4, 1, 1, 7, 9, 2, -3, -7, -14, -16, -11, -5, 3, 10, 15, 14,
-8, 3, 0, -8, -9, -3, -4, -1, 6, 4, 3, 5, 2, 1, 1, 2,
-3, 1, 1, 2, -4, -5, -1, -3, -2, 5, 4, 3, 4, 2, -2, -4,
--4, -4, 0, 21, 42, 51, 64, 64, 36, 9, -13, -35, -41, -25, -4, 15,
-31, 39, 30, 12, -1, -15, -24, -22, -15, -10, -7, -3, -2, -7, -5, 0,
-1, 5, 9, 6, -1, -7, -10, -13, -13, -2, 5, 8, 15, 15, 8, 3,
--2, -6, -8, -6, 1, 1, 2, 8, 4, 0, 4, 1, -2, 1, 2, 0,
--4, -1, -2, -6, -2, 2, 0, 2, 6, 3, -1, -1, -2, -5, -5, -2,
-0, 10, 33, 49, 57, 64, 51, 22, -4, -26, -38, -35, -16, 11, 27, 37,
-41, 23, 1, -9, -22, -29, -21, -12, -7, -3, -1, -1, -5, -4, 4, 3,
-3, 8, 1, -9, -12, -14, -15, -10, 2, 10, 12, 17, 14, 3, -2, -5,
--11, -9, -3, 1, 3, 7, 8, 4, 2, 2, 0, -1, 1, 0, -1, -2,
--3, -2, -3, -1, 4, 3, 4, 5, 2, -2, -3, -5, -5, -3, -2, 1,
-10, 30, 45, 55, 62, 50, 24, -2, -25, -38, -33, -16, 7, 28, 38, 36,
-23, 3, -13, -23, -26, -20, -12, -6, -1, -2, -3, -5, -4, 1, 3, 6,
-7, 0, -7, -11, -16, -14, -6, 1, 10, 16, 15, 10, 2, -7, -13, -13,
--9, -3, 3, 9, 9, 6, 5, -1, -3, -1, -2, 0, 2, -1, 0, -2,
--3, -1, 0, 2, 6, 4, 3, 1, -4, -4, -6, -5, 0, 1, 2, 5,
-10, 29, 43, 51, 59, 47, 20, -2, -26, -38, -29, -14, 11, 32, 36, 35,
-19, -3, -15, -25, -26, -15, -8, -3, 1, -2, -3, -6, -6, 2, 4, 5,
-7, -1, -10, -12, -16, -13, -3, 4, 13, 17, 13, 8, 0, -7, -9, -8,
--4, 1, 4, 6, 7, 3, 0, 1, 0, 0, 2, 2, 0, -2, -3, -4,
--4, 0, 2, 3, 5, 4, 0, -1, -3, -6, -6, -4, -2, -1, 0, 2,
-10, 28, 44, 51, 56, 45, 18, -5, -24, -33, -25, -9, 14, 29, 31, 29,
-16, -4, -13, -18, -19, -13, -7, -4, -3, -7, -6, -3, -3, 4, 8, 6,
-3, -3, -11, -15, -14, -9, -2, 6, 12, 13, 9, 4, 0, -6, -7, -3,
--2, 0, 4, 3, 3, 2, 1, 3, 2, 1, 3, 1, -3, -3, -4, -4,
--2, 1, 3, 3, 3, 2, 0, -3, -3, -2, -2, -2, 1, 2, 0, 0,
-11, 28, 39, 50, 56, 41, 17, -2, -21, -30, -22, -4, 13, 24, 29, 25,
-10, -3, -9, -15, -15, -9, -6, -6, -7, -5, -5, -5, 2, 7, 5, 4,
-2, -7, -13, -12, -10, -7, 0, 8, 10, 7, 6, 4, -2, -4, -2, -2,
--2, 0, 2, 0, 0, 3, 3, 2, 4, 4, 1, -1, -2, -3, -5, -2,
-1, 1, 2, 3, 2, 0, -1, -1, -2, -2, -1, 0, -1, 0, 0, 0,
-9, 26, 37, 45, 48, 36, 16, -2, -16, -19, -15, -2, 13, 20, 20, 18,
-8, -1, -5, -8, -7, -7, -8, -8, -11, -11, -6, -4, 2, 7, 5, 4,
--1, -8, -9, -11, -10, -3, 0, 4, 6, 5, 4, 2, 0, 1, -1, 0,
-1, -2, -1, 0, -1, 2, 3, 4, 5, 3, 1, 0, -3, -3, -2, -2,
-1, 1, 1, 2, 0, 0, 1, -1, -1, 0, -1, -2, -1, -1, -1, 0,
-10, 26, 35, 42, 46, 33, 13, -2, -12, -16, -12, 2, 14, 16, 17, 16,
-7, -1, -3, -3, -7, -8, -6, -10, -13, -10, -5, -3, 1, 6, 5, 0,
--3, -6, -10, -11, -7, -3, -1, 2, 5, 3, 2, 3, 2, 1, 1, 1,
-0, -2, -1, 1, 0, 2, 4, 5, 3, 2, 2, -1, -3, 0, -1, -2,
-1, 1, 0, 0, 1, 1, -1, 0, 1, -2, -2, -1, -1, -2, -1, 2,
-10, 23, 34, 39, 40, 31, 15, 1, -6, -7, -4, 5, 14, 15, 14, 12,
-8, 2, 1, 0, -3, -6, -8, -10, -13, -11, -6, -3, 0, 2, 2, -3,
--6, -7, -10, -10, -7, -4, -3, -1, 1, 1, 1, 2, 3, 1, 0, 1,
--1, -2, 0, 1, 2, 3, 5, 5, 3, 3, 2, 1, 1, 2, 2, 2,
-2, 2, 1, 1, 1, 1, 1, 1, 1, 0, -1, -1, -1, -2, -1, 5,
-14, 19, 25, 27, 21, 11, 3, -2, -5, -2, 4, 9, 10, 10, 10, 6,
-3, 3, 1, -1, -3, -4, -7, -9, -6, -4, -3, 0, 2, 0, -2, -4,
--6, -8, -7, -5, -3, -2, 0, 1, -1, 0, 1, 0, 0, 0, 0, -1,
--2, 0, 0, 1, 3, 4, 3, 3, 2, 2, 1, 0, 1, 1, 0, 1,
-2, 1, 1, 2, 1, 0, 1, 1, -1, -1, -1, 0, -2, -1, 3, 10,
-14, 19, 21, 18, 10, 4, 0, -2, -1, 4, 7, 9, 9, 9, 7, 5,
-4, 4, 1, -1, -3, -5, -6, -6, -3, -1, 0, 2, 1, -2, -5, -6,
--7, -8, -6, -4, -4, -3, -2, -2, -2, -1, 0, -1, -2, -2, -2, -3,
--3, -1, 0, 1, 2, 3, 3, 2, 1, 1, 1, 1, 1, 1, 1, 2,
-2, 2, 2, 3, 2, 2, 1, 1, 0, 0, 0, 0, 0, 2, 6, 10,
-12, 14, 13, 8, 4, 2, 0, 0, 3, 5, 6, 6, 6, 6, 4, 4,
-4, 2, 0, -1, -2, -4, -4, -2, 0, 0, 1, 1, -1, -3, -4, -5,
--5, -5, -4, -3, -3, -3, -2, -2, -1, -1, -1, -1, -2, -3, -3, -3,
--2, 0, 0, 1, 1, 2, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 3, 7, 9, 11,
-11, 9, 6, 3, 2, 2, 2, 4, 5, 5, 5, 5, 5, 5, 4, 3,
-2, 0, -2, -2, -3, -2, -1, 0, 0, 0, 0, -2, -3, -3, -4, -4,
--4, -4, -4, -4, -3, -2, -2, -2, -2, -2, -3, -3, -3, -3, -3, -2,
--1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 2, 4, 5, 5, 6, 5,
-4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 1, 0,
--1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -1, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 2, 2,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
--1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0
-};
@@ -1,361 +0,0 @@
-// TTS sound: opt_horn_peterbilt
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_peterbiltSampleRate = 11025;
-const unsigned int menu_opt_horn_peterbiltSampleCount = 5656;
-const signed char menu_opt_horn_peterbiltSamples[] = {
--2, 0, 0, 0, 1, 1, 0, -1, 0, 0, 0, 2, 0, -3, -1, 0,
-1, 0, 2, -2, 0, 1, 0, -1, -1, -1, 0, 1, 0, 0, 0, 1,
-2, 1, 0, 0, 0, 1, -1, -3, -1, 1, -1, -1, -5, -3, -1, -1,
-0, -3, -2, -1, -3, 1, 1, -1, 1, -3, 0, 0, 3, 1, -3, -2,
-1, -1, 0, -3, 0, -2, -3, 0, -1, 0, -2, -3, 0, 2, 0, -2,
--4, 1, 0, -1, 0, -1, 0, 1, 0, 1, 1, 4, -3, -3, 3, 2,
--3, -2, 0, 1, -2, 1, -2, -2, 2, 1, 0, -2, 1, 3, 0, 0,
-1, 0, 1, -2, 1, 2, -1, -3, 1, 2, -1, -2, 2, 1, 3, -1,
-0, 3, -1, 0, 2, -1, -1, 2, 3, -2, -1, 3, 2, 0, 1, 1,
--2, -2, 5, 0, -5, -1, 5, -1, -4, 2, 2, 0, 1, -1, 1, 2,
--1, 0, 0, 1, 0, 1, 0, -1, 1, 1, 1, 0, 2, 0, -3, 0,
-4, -5, -1, 2, -1, 0, 0, 0, 0, -2, 1, -2, 0, 0, -1, 0,
-1, -1, 1, 1, -1, 1, 2, 2, -1, 0, 3, 3, -2, -2, 1, 1,
--2, -2, 0, 1, 0, -1, -1, 1, 1, 1, -4, 1, 7, -1, -5, 5,
-4, -3, -2, 6, -1, -2, 2, 0, 0, 2, 2, -2, 1, 4, 2, -4,
-3, 0, 0, -1, 0, 0, 0, 3, -1, -6, 5, 1, -4, 0, 2, -2,
-0, 2, 0, -1, 3, 1, -2, 3, 2, 0, -4, 5, 0, -3, 0, 3,
--3, 1, 4, -2, -5, 7, 1, -5, 0, 3, 1, -6, 2, 1, -4, -2,
-4, -3, 0, -1, 2, -3, -2, 1, -1, -2, 4, -6, 1, 3, 0, -4,
-4, 3, -4, -1, 5, -3, -2, 2, -1, 1, 1, 1, -1, 1, 5, -4,
--2, 8, -1, -4, 3, 5, -4, -2, 7, -2, -4, 4, 0, -2, 3, 2,
--1, 0, 4, 1, -3, 5, -2, -1, 1, 0, -2, 0, 3, 0, -6, 5,
-1, -4, 1, 3, -4, 0, 5, -3, -3, 6, 1, -6, 3, 4, -3, 0,
-4, -1, 2, 1, -1, 1, 4, -2, -1, 3, 2, -2, 0, 4, 0, -1,
-3, 2, 0, 1, 0, 1, -1, 0, -1, 0, 3, -3, -2, 4, -2, -2,
-2, -1, -2, 2, 1, -4, 3, 3, -3, -3, 6, -1, -2, 2, 1, -3,
-1, 1, -1, -2, 4, -3, -1, 4, -2, 1, -1, 2, 0, -1, 1, 0,
--3, 2, -1, 0, -1, 1, 0, -2, 4, 0, -3, 2, 1, -2, -3, 2,
-0, -4, 2, -2, -1, 0, -1, 2, -1, 2, 1, 0, 5, 1, 0, 6,
-2, 2, 2, 4, 1, -1, 4, 3, -2, 4, -1, 2, -1, 1, 4, 1,
-2, 1, 4, 2, 1, 5, 1, 2, 3, 3, 6, 2, 4, 9, 5, 7,
-8, 10, 9, 7, 10, 10, 8, 8, 7, 8, 5, 3, 5, 2, 1, -1,
-0, -2, -5, -3, -5, -5, -5, -7, -6, -6, -6, -6, -5, -3, -5, -4,
--2, -3, -1, -2, -1, 1, -2, 1, 0, -1, 1, -1, 0, 1, -1, 1,
-0, 1, 0, -1, 2, 3, 8, 4, 7, 17, 11, 12, 19, 20, 20, 17,
-24, 23, 18, 20, 18, 17, 13, 8, 10, 5, 0, -3, -3, -5, -12, -12,
--10, -16, -16, -14, -16, -15, -13, -12, -12, -9, -6, -8, -6, 1, -1, -2,
-3, 5, 1, 3, 7, 4, 2, 6, 5, 2, 2, 5, 1, 1, 3, -1,
-2, 6, 10, 6, 9, 23, 15, 15, 28, 26, 25, 25, 30, 29, 23, 25,
-21, 18, 17, 6, 9, 3, -6, -7, -12, -14, -19, -22, -20, -26, -23, -23,
--25, -19, -20, -18, -13, -10, -8, -7, -1, 1, -1, 5, 6, 5, 5, 8,
-7, 4, 6, 6, 3, 4, 3, 1, 2, 2, 2, 0, 3, 11, 13, 8,
-16, 28, 23, 21, 34, 38, 31, 29, 40, 36, 23, 28, 26, 17, 11, 4,
-3, -7, -13, -18, -22, -23, -33, -32, -29, -36, -32, -31, -30, -23, -27, -18,
--12, -14, -6, -3, 2, 3, 3, 11, 7, 9, 11, 7, 12, 7, 6, 8,
-3, 7, 2, 2, 8, 1, 4, 6, 7, 12, 20, 17, 17, 37, 33, 22,
-40, 47, 36, 30, 42, 41, 22, 21, 24, 15, 2, -7, -4, -13, -28, -29,
--31, -34, -42, -46, -35, -37, -43, -37, -25, -22, -31, -14, -2, -11, -4, 7,
-11, 8, 7, 21, 16, 8, 16, 15, 11, 7, 8, 11, 2, 3, 7, 1,
-4, 4, 3, 8, 7, 13, 24, 16, 21, 37, 34, 26, 38, 47, 35, 27,
-38, 36, 19, 13, 18, 8, -10, -10, -12, -24, -32, -35, -33, -42, -43, -38,
--41, -35, -34, -30, -21, -19, -13, -8, 0, 5, 3, 14, 15, 14, 16, 16,
-18, 12, 11, 14, 6, 7, 5, 2, 2, 0, 1, -1, 0, 5, 2, 4,
-9, 17, 22, 12, 27, 42, 25, 31, 44, 40, 33, 30, 37, 28, 17, 18,
-9, 3, -5, -15, -17, -23, -30, -37, -34, -34, -43, -38, -31, -34, -31, -22,
--16, -18, -9, 1, -3, 3, 13, 10, 9, 17, 16, 11, 12, 14, 10, 3,
-7, 8, -3, 0, 3, -1, -3, 0, 3, 2, 2, 6, 11, 16, 23, 17,
-24, 42, 30, 26, 43, 45, 31, 26, 42, 31, 11, 18, 16, 3, -9, -7,
--11, -28, -25, -29, -36, -32, -37, -37, -33, -28, -30, -28, -13, -15, -18, -2,
-3, -3, 3, 14, 9, 6, 14, 13, 9, 8, 10, 7, 2, 5, 2, -1,
-3, -1, -1, 2, 2, 3, 4, 7, 8, 12, 23, 21, 16, 33, 39, 25,
-32, 44, 39, 27, 32, 37, 24, 15, 16, 13, 2, -8, -8, -13, -24, -26,
--28, -32, -33, -35, -34, -31, -30, -29, -24, -17, -17, -13, -5, -3, -2, 3,
-8, 6, 7, 12, 10, 7, 10, 8, 5, 5, 5, 2, 1, 2, 2, -1,
-2, 5, 2, 6, 8, 8, 16, 25, 18, 19, 40, 34, 26, 39, 43, 36,
-30, 35, 34, 23, 20, 15, 10, 4, -6, -11, -16, -20, -27, -33, -29, -34,
--38, -34, -32, -30, -31, -24, -19, -19, -10, -9, -4, 2, 1, 5, 10, 9,
-8, 12, 11, 6, 9, 9, 4, 3, 6, 2, 0, 4, 2, 2, 4, 6,
-8, 6, 13, 21, 21, 18, 27, 38, 31, 29, 41, 41, 33, 32, 35, 30,
-22, 19, 14, 8, 2, -7, -13, -14, -21, -29, -29, -29, -35, -36, -31, -32,
--31, -27, -23, -20, -17, -10, -7, -6, 1, 2, 4, 8, 7, 9, 8, 9,
-9, 5, 5, 5, 3, 1, 1, 2, -1, -1, 2, 1, 1, 3, 5, 8,
-15, 16, 15, 23, 30, 29, 27, 35, 40, 31, 32, 36, 30, 26, 22, 19,
-12, 7, 3, -6, -10, -12, -20, -24, -25, -27, -30, -30, -28, -28, -27, -23,
--21, -18, -14, -9, -8, -5, 0, 2, 2, 4, 7, 6, 4, 6, 5, 2,
-2, 1, -1, -4, -2, -4, -7, -5, -5, -5, -5, -3, 3, 6, 6, 10,
-17, 21, 22, 26, 32, 33, 32, 36, 36, 34, 33, 31, 27, 23, 20, 16,
-9, 4, 1, -5, -10, -13, -17, -20, -22, -23, -23, -25, -24, -22, -22, -18,
--16, -13, -11, -8, -5, -3, 0, 2, 3, 5, 6, 6, 7, 7, 6, 6,
-5, 4, 3, 2, 1, 0, -1, -2, -2, 0, -1, 0, 2, 4, 5, 7,
-9, 11, 13, 15, 17, 17, 19, 20, 20, 19, 19, 18, 17, 15, 13, 11,
-9, 6, 4, 1, -1, -3, -6, -8, -10, -11, -12, -14, -14, -14, -15, -15,
--14, -14, -13, -12, -11, -10, -9, -7, -6, -5, -3, -3, -1, 0, 1, 1,
-2, 3, 3, 3, 4, 5, 6, 5, 6, 7, 7, 7, 8, 8, 9, 9,
-9, 9, 9, 9, 9, 9, 8, 8, 8, 7, 7, 6, 5, 5, 3, 3,
-2, 1, 0, -1, -2, -3, -3, -4, -5, -5, -6, -7, -7, -7, -7, -7,
--7, -7, -7, -7, -7, -6, -6, -5, -5, -5, -4, -4, -3, -2, -2, -2,
--1, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 2, 3,
-3, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1, -1, 0, 0, -1, -1,
-0, -1, -1, -2, -1, -2, -3, -2, -3, -2, -2, -3, -2, -1, -2, -1,
--1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-0, 1, 0, 0, 2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1,
--3, 1, 2, -2, -1, -1, -1, 0, 0, 1, 0, -1, 1, 3, -1, 4,
-2, 1, 4, 2, 4, 2, 1, 3, 1, 4, 2, -1, 1, 1, -3, -1,
--1, -3, -1, -3, -3, -1, -1, -3, -3, -1, -2, -2, -2, -2, -3, -2,
--2, -2, 1, -1, 0, 2, 0, 2, 1, 0, 0, 2, 2, 1, 1, 2,
-4, 1, 3, 4, 0, 3, 2, 2, 1, 2, 3, 1, 0, 0, 5, -2,
-0, 2, -2, 3, 1, 3, -1, -1, 3, 3, 3, 2, 0, 8, 4, 5,
-3, 2, 6, 1, 1, 3, -1, 1, 2, 0, 0, -2, 3, -1, -2, -1,
--1, -1, -2, -2, 0, -4, -2, 3, 6, -1, 0, 5, 4, 3, 2, 4,
-2, 1, 3, 3, 0, 1, 1, 3, 0, -1, 2, 1, -1, -1, 1, -2,
--1, -1, 0, -1, -4, 0, 0, -3, -1, -1, -1, -1, -2, 1, -1, -2,
-0, 2, -1, 0, 1, 0, 2, -1, 2, 1, 0, 2, 1, 1, 1, -1,
-3, -1, -1, 2, 5, 8, 1, 3, 7, 6, 5, 3, 4, 3, 1, 3,
-2, 0, -1, 0, 2, -1, -3, 0, -1, -2, -2, -1, -3, -3, -2, -2,
--1, -4, -2, 0, -2, -2, 0, -1, 0, 0, -1, 2, 1, -1, 2, 1,
-1, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0,
-0, 8, 9, 1, 4, 7, 8, 7, 1, 4, 4, 0, 2, 2, -2, -1,
--1, -1, 0, -3, -2, -1, -2, -1, -3, -2, -2, -3, -2, -2, -2, -2,
--2, -1, 0, -1, 0, 0, 0, 1, 1, 2, 0, 1, 2, 1, 2, 1,
-1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, -1, 0, 3, 10,
-7, 2, 5, 8, 9, 6, 3, 2, 1, 3, 1, -1, -2, -2, -2, -1,
--2, -2, -2, -3, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--1, -1, -1, -1, -1, 0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1,
-2, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 4, 11, 12, 9, 9,
-11, 15, 16, 13, 10, 8, 9, 10, 7, 4, 2, 1, 1, 1, 0, -1,
--2, -3, -2, -2, -2, -2, -4, -5, -5, -4, -4, -4, -5, -5, -5, -3,
--3, -2, -3, -2, -1, 0, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 1, 1, 3, 9, 20, 23, 23, 21, 23, 30,
-33, 30, 24, 18, 15, 14, 10, 6, 0, -5, -7, -9, -11, -11, -12, -13,
--14, -14, -12, -10, -9, -10, -10, -9, -8, -5, -4, -5, -4, -4, -1, 1,
-2, 2, 3, 3, 5, 6, 6, 7, 6, 6, 6, 5, 6, 6, 4, 3,
-2, 1, 2, 1, 0, -1, 3, 17, 28, 30, 26, 22, 26, 35, 38, 32,
-21, 10, 9, 9, 7, 1, -8, -14, -15, -15, -13, -13, -15, -15, -16, -14,
--10, -8, -6, -7, -9, -7, -5, -2, 1, -1, -3, -2, 0, 4, 5, 4,
-4, 3, 5, 7, 7, 7, 6, 4, 5, 5, 4, 5, 3, 1, 0, 0,
-0, 0, -1, 1, 13, 27, 35, 34, 26, 26, 34, 42, 43, 32, 18, 10,
-10, 10, 7, -3, -13, -18, -18, -16, -15, -16, -17, -18, -18, -15, -11, -8,
--5, -7, -8, -7, -4, 0, 1, -1, -2, -2, 1, 4, 6, 5, 4, 4,
-5, 7, 8, 7, 6, 5, 4, 5, 5, 4, 3, 1, 0, 0, 0, 0,
--1, 1, 11, 27, 35, 35, 27, 25, 33, 42, 44, 34, 19, 10, 9, 10,
-7, -1, -12, -17, -19, -18, -17, -17, -17, -17, -18, -16, -13, -9, -5, -5,
--8, -8, -6, -1, 2, 1, -1, -2, -1, 3, 5, 6, 4, 4, 4, 5,
-7, 8, 7, 6, 5, 4, 4, 4, 4, 3, 0, -1, -1, -1, -1, -2,
-4, 19, 31, 36, 32, 25, 28, 38, 45, 42, 28, 14, 9, 10, 11, 5,
--8, -16, -19, -18, -16, -17, -18, -18, -18, -16, -14, -11, -7, -5, -5, -7,
--7, -4, 0, 3, 0, -3, -3, 0, 3, 3, 0, -2, -1, 2, 4, 3,
-1, 1, 3, 5, 5, 3, 2, 3, 4, 3, 2, 0, 0, 1, 1, 2,
-13, 27, 36, 37, 29, 26, 34, 44, 48, 38, 20, 11, 10, 12, 12, -1,
--14, -20, -20, -16, -16, -19, -21, -21, -19, -15, -14, -11, -7, -6, -6, -7,
--6, -1, 3, 4, 1, -2, -1, 4, 7, 8, 5, 2, 3, 6, 9, 9,
-6, 4, 4, 5, 6, 4, 3, 2, 1, 1, 0, -1, -2, -2, -2, -1,
-9, 23, 33, 35, 30, 26, 31, 41, 47, 41, 26, 15, 11, 13, 13, 5,
--8, -16, -19, -17, -15, -18, -20, -19, -18, -14, -13, -12, -8, -4, -2, -2,
--4, -3, 0, 3, 4, 1, -2, -2, 1, 4, 4, 2, 0, 1, 3, 6,
-5, 4, 4, 4, 5, 5, 4, 3, 3, 3, 3, 1, -1, -1, -1, 1,
-8, 19, 29, 33, 31, 28, 30, 37, 44, 42, 34, 22, 15, 13, 12, 7,
--3, -12, -18, -20, -22, -25, -27, -28, -26, -23, -22, -21, -20, -15, -9, -4,
--3, -4, -3, 1, 5, 8, 7, 5, 4, 6, 8, 8, 6, 5, 5, 6,
-6, 5, 4, 4, 5, 6, 5, 4, 2, 2, 3, 3, 2, 0, -2, -2,
-1, 8, 17, 25, 28, 27, 25, 25, 28, 32, 35, 33, 29, 22, 16, 12,
-8, 5, 2, -2, -6, -11, -16, -20, -21, -19, -17, -17, -17, -18, -17, -15,
--12, -9, -6, -4, -3, -2, -1, 0, 1, 3, 4, 5, 5, 4, 3, 3,
-4, 5, 5, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2,
-1, 2, 4, 7, 10, 13, 15, 16, 18, 19, 21, 23, 24, 25, 24, 23,
-22, 20, 17, 15, 13, 11, 8, 5, 2, -1, -4, -6, -7, -9, -10, -10,
--11, -12, -12, -12, -11, -10, -9, -8, -7, -7, -6, -5, -4, -3, -2, -1,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, 0, 1, 2, 3, 4, 6, 8, 10, 11, 13, 15, 16, 18, 19,
-20, 21, 21, 21, 21, 20, 19, 18, 17, 15, 13, 11, 9, 7, 4, 2,
-0, -1, -3, -5, -5, -6, -7, -8, -9, -9, -9, -9, -9, -8, -8, -7,
--6, -6, -5, -4, -4, -3, -2, -2, -2, -2, -1, -1, -1, -1, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -1, 0, 1, 3, 4, 6, 7, 9, 10,
-12, 13, 14, 15, 16, 16, 16, 16, 16, 15, 14, 13, 12, 11, 9, 7,
-6, 4, 2, 1, -1, -2, -3, -4, -5, -6, -6, -7, -7, -7, -7, -6,
--6, -6, -5, -4, -4, -3, -3, -2, -2, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -2, -2, -2, -2, -2, -3, -3, -2, -2, -1, 0, 1, 2, 4,
-5, 6, 8, 9, 10, 11, 12, 13, 14, 14, 14, 14, 13, 13, 12, 11,
-10, 8, 7, 6, 4, 3, 1, 0, -2, -3, -4, -5, -6, -6, -6, -7,
--7, -7, -6, -6, -6, -5, -5, -4, -3, -3, -2, -2, -1, -1, -1, -1,
-0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -2, -2, -1, -1, 0,
-1, 2, 3, 4, 5, 6, 8, 9, 10, 12, 13, 13, 14, 15, 15, 15,
-15, 15, 14, 13, 13, 12, 10, 9, 8, 6, 5, 3, 2, 1, -1, -2,
--3, -4, -5, -5, -6, -6, -6, -7, -7, -6, -6, -6, -5, -5, -5, -4,
--4, -3, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -3,
--3, -2, -2, -2, -2, -1, -1, 0, 0, 1, 2, 2, 3, 4, 5, 6,
-6, 7, 8, 8, 8, 9, 9, 9, 9, 9, 9, 8, 8, 8, 7, 6,
-6, 5, 4, 4, 3, 2, 1, 1, 0, -1, -1, -2, -2, -2, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2,
--2, -2, -1, -1, -1, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3,
-3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4,
-4, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 2, 2,
-2, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3,
-3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 3, 2,
-2, 2, 2, 3, 3, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 1, 6,
-8, 7, 6, 8, 8, 9, 10, 9, 6, 3, 4, 4, 2, 1, 0, -2,
--3, -2, 0, -2, -3, -3, -4, -3, -2, -2, -3, -4, -4, -4, -3, -2,
--1, -1, -2, 1, 2, 2, 2, 3, 3, 3, 3, 5, 3, 2, 2, 2,
-1, 1, 1, 1, 0, -1, 1, 0, -1, 0, 0, -1, -1, 0, 0, -3,
--1, 9, 21, 22, 21, 24, 26, 27, 31, 31, 26, 17, 12, 11, 8, 2,
--3, -10, -13, -14, -12, -11, -15, -18, -15, -13, -10, -7, -7, -9, -10, -7,
--3, -4, -4, -4, -6, -4, 1, 1, 1, 1, 2, 3, 6, 9, 8, 6,
-6, 7, 8, 7, 6, 4, 1, 1, 2, 2, 0, -2, -2, -3, -2, -1,
--1, -4, -4, 9, 27, 32, 31, 33, 33, 36, 39, 41, 35, 18, 8, 6,
-2, -3, -9, -15, -23, -25, -15, -10, -12, -13, -11, -9, -4, 1, 3, -2,
--8, -7, -2, -3, -5, -6, -8, -10, -5, 1, 3, 1, 0, 5, 7, 9,
-13, 11, 6, 4, 6, 8, 3, 2, 0, -5, -3, -2, 0, -1, -5, -3,
--2, 0, 3, 0, 0, 10, 35, 48, 47, 47, 46, 44, 44, 45, 41, 20,
-1, -4, -6, -11, -17, -20, -27, -32, -20, -7, -7, -7, -8, -5, -2, 1,
-8, 0, -10, -10, -10, -7, -6, -7, -8, -14, -7, 5, 6, 7, 7, 7,
-8, 10, 17, 14, 3, 2, 2, 1, 0, 2, -2, -10, -10, -3, -1, -3,
--1, -2, -6, -2, 3, 3, -2, 3, 30, 43, 43, 48, 46, 40, 35, 40,
-42, 19, 2, -1, -10, -15, -13, -11, -21, -27, -16, -6, -4, -1, 2, -3,
--7, 1, 5, -1, -9, -11, -12, -15, -10, -2, -7, -11, -5, 2, 5, 9,
-13, 10, 3, 7, 12, 10, 6, 3, 1, -4, -3, 5, 3, -3, -3, 0,
-1, 1, 7, 5, -2, -3, 2, 1, -2, -2, 8, 28, 38, 45, 50, 43,
-38, 36, 39, 33, 15, 5, -6, -16, -16, -12, -13, -20, -19, -12, -8, 0,
-4, 4, -1, -5, 0, 1, -5, -8, -11, -16, -18, -11, -5, -7, -6, 0,
-0, 4, 9, 14, 10, 4, 7, 4, 1, 3, 2, -2, -7, -4, 0, 0,
-1, 4, 3, 0, 4, 6, 4, 2, 1, 0, -5, -2, -2, -2, 17, 37,
-43, 48, 50, 45, 36, 35, 39, 23, 8, 0, -12, -19, -16, -12, -14, -17,
--12, -7, -2, 6, 11, 6, 0, -3, -4, -9, -9, -10, -15, -19, -17, -11,
--6, -3, 5, 5, 2, 8, 12, 9, 9, 8, 1, -3, -2, 0, -4, -3,
--1, -3, -2, 3, 6, 6, 4, 7, 2, 1, 4, 2, -3, -2, -4, -6,
--7, -2, 14, 33, 45, 54, 52, 47, 38, 32, 31, 24, 12, 3, -9, -17,
--18, -12, -8, -5, -2, 0, 0, 3, 8, 5, 1, -3, -11, -15, -17, -16,
--15, -17, -13, -12, -8, -1, 4, 8, 7, 8, 8, 4, 5, 4, 1, -1,
--4, -4, -4, -2, 2, 2, 4, 5, 5, 7, 7, 6, 5, 2, 0, -3,
--4, -4, -6, -5, -4, -5, -2, 14, 34, 45, 58, 61, 49, 37, 28, 20,
-15, 7, 4, -8, -18, -17, -14, -9, 0, 7, 8, 3, 7, 5, 0, 1,
--4, -10, -18, -21, -19, -20, -16, -8, -8, -4, 0, 4, 7, 7, 11, 7,
-1, 3, -2, -4, -2, -3, -4, -3, -2, 1, 1, 7, 8, 6, 8, 6,
-3, 2, 0, -1, -3, -3, -3, -5, -3, 0, -2, 0, 4, 10, 28, 41,
-54, 60, 53, 41, 26, 16, 10, 3, 4, -1, -9, -10, -12, -9, -1, 5,
-11, 9, 8, 4, -2, -4, -8, -11, -12, -18, -18, -18, -20, -6, -3, 4,
-8, 8, 9, 7, 6, 4, 0, -1, -3, -6, -4, -4, -4, -1, 3, 5,
-5, 9, 8, 5, 7, 4, 1, -1, -2, -3, -5, -4, -1, -4, -1, 3,
-0, 2, 4, 3, 16, 30, 40, 52, 55, 46, 34, 22, 12, 2, 1, 3,
--3, -3, -3, -7, -4, 2, 6, 10, 13, 12, 5, 0, -5, -12, -14, -15,
--17, -15, -13, -11, -8, -5, -1, 1, 3, 5, 3, 2, 1, -2, -3, -5,
--5, -5, -5, -1, 0, 1, 6, 5, 5, 8, 5, 4, 5, 2, 0, 0,
--1, -2, -3, 0, -1, -1, 2, 2, 2, 2, 2, 5, 15, 26, 37, 47,
-50, 42, 34, 23, 10, 3, 2, 0, 0, 2, 3, -1, 0, 1, 0, 3,
-7, 6, 3, 1, -4, -10, -13, -14, -16, -14, -11, -9, -7, -4, -3, -2,
-0, 1, 0, 1, 1, -1, -3, -2, -4, -4, -2, -1, 0, 3, 3, 5,
-5, 4, 5, 5, 3, 3, 3, 1, 2, 1, 0, 0, 0, 1, 0, 1,
-2, 1, 1, 1, 2, 13, 21, 31, 44, 45, 43, 37, 25, 14, 6, 2,
-0, 0, 2, 1, 1, 1, -1, 0, 1, 2, 4, 3, 1, -3, -8, -10,
--14, -15, -13, -13, -10, -7, -6, -3, -4, -1, 0, 0, 2, 2, 1, 1,
-0, 0, -1, 0, 1, 0, 3, 4, 3, 5, 4, 4, 4, 2, 4, 2,
-1, 3, 0, 0, 1, -1, 0, 0, 0, 0, 0, 1, -1, -1, 5, 12,
-19, 32, 40, 42, 41, 35, 24, 15, 8, 3, 1, 1, 2, 2, 2, 1,
-0, 1, 3, 6, 7, 8, 7, 3, -2, -7, -11, -13, -13, -11, -9, -6,
--5, -4, -3, -3, -2, -2, -1, 0, -1, -1, -1, -2, -2, -2, -2, 0,
-0, 2, 3, 3, 4, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 0,
-0, 1, 0, 1, 1, 1, 1, 0, 2, 7, 13, 21, 30, 34, 35, 32,
-27, 18, 12, 7, 3, 3, 4, 3, 3, 2, 0, -1, -2, -2, -2, -2,
--1, -3, -5, -7, -9, -11, -11, -11, -10, -8, -6, -5, -4, -3, -3, -3,
--2, -1, -1, 0, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 4, 4,
-3, 3, 3, 2, 2, 3, 2, 1, 2, 1, 0, 0, 0, -1, 0, 0,
--1, -1, -1, 0, 4, 10, 15, 23, 27, 28, 28, 23, 17, 12, 7, 5,
-4, 4, 4, 3, 2, 1, -1, -2, -3, -2, -3, -2, -2, -4, -5, -6,
--9, -9, -9, -9, -7, -5, -5, -4, -3, -3, -3, -3, -2, -1, 0, 1,
-2, 2, 1, 2, 1, 2, 2, 2, 3, 3, 4, 3, 3, 3, 2, 2,
-2, 2, 2, 2, 1, 1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-5, 9, 13, 19, 21, 21, 20, 16, 12, 9, 8, 6, 5, 6, 4, 3,
-1, -1, -2, -3, -3, -3, -3, -2, -3, -4, -5, -7, -8, -8, -8, -7,
--6, -5, -5, -5, -4, -4, -4, -3, -2, -1, 0, 1, 2, 1, 2, 2,
-2, 3, 3, 3, 4, 3, 4, 3, 3, 3, 2, 3, 3, 2, 3, 1,
-1, 1, 0, 0, -1, -1, -1, -2, -2, -2, -2, -2, 0, 2, 4, 6,
-7, 7, 7, 7, 5, 5, 5, 5, 5, 4, 4, 2, 2, 1, 0, 1,
-1, 1, 1, 0, 0, -1, -2, -1, -2, -2, -2, -2, -2, -3, -3, -3,
--4, -3, -3, -2, -2, -2, -1, -2, -2, -1, -1, -1, -1, 0, -1, 0,
-0, 0, 0, 1, 2, 2, 2, 2, 2, 3, 4, 3, 5, 5, 6, 6,
-6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 3, 1, 2, 1, 1,
-1, 1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1,
-1, 2, 2, 2, 2, 3, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0,
--1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, 0, -1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 2, 0, -1, 0, -1, 0,
-0, -1, -1, -1, 2, 1, -1, 1, 2, -1, 1, 3, 1, -1, 2, 0,
-1, -1, 0, 1, -2, -1, 2, -2, 0, -2, -1, 0, -1, 2, 1, 0,
--1, 3, -2, 3, 2, -1, 3, 1, 3, 1, -1, 1, -1, -3, 3, -3,
-2, -1, 1, -5, 1, -1, -2, -2, -1, 0, -4, 0, 3, -5, 8, -5,
-6, 0, -2, 10, -5, 6, 2, 1, 6, 3, 0, 4, -5, 2, -3, 1,
--2, -5, 1, -2, 0, 3, -6, 4, 1, -1, 4, -3, -1, -4, 1, 5,
-0, 1, 2, -2, 7, -5, 2, -5, -3, 0, 0, -1, -1, -2, 3, -4,
-2, -2, -2, 2, -1, 3, 0, 2, 3, 2, 2, 1, -4, 2, -2, 1,
--3, 1, 0, -1, 2, 0, -1, 4, -4, 6, -3, 0, 0, 0, -1, -1,
-2, 1, -2, 4, -1, 1, 0, 1, 3, -6, 4, -5, 1, -3, 0, -1,
--1, 3, 2, -3, 4, -4, 3, -1, 1, -2, 0, 3, -2, 4, -1, 4,
--4, 4, -2, -1, 0, -1, -2, 0, -4, 5, -8, 8, -4, 2, -1, 3,
--1, -2, 1, -1, -1, -2, 3, -3, -2, 5, -3, 0, -2, 0, 1, -4,
-6, -2, -3, 5, -2, 2, -4, 2, 0, -4, 4, -3, -2, -1, 0, 2,
--4, 4, -4, 2, 0, 1, 1, -4, 3, -1, 0, 2, -3, 2, -3, 1,
-1, -5, 4, -5, 2, -2, 0, 1, -3, 0, 1, -2, 3, -3, 2, -2,
-0, 1, -1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, -2, 1,
--2, 2, -3, 1, -1, 0, 1, -1, 1, 1, -1, 2, -1, 2, -2, 1,
-1, 0, 1, 0, 1, -2, 2, 1, 0, 0, -1, 1, -1, 1, 2, -4,
-0, -2, 0, 0, -2, 1, -3, 2, 2, -2, 2, 0, 2, 0, 1, 1,
--1, 1, 1, 0, -1, 1, 0, -1, 0, 0, 0, -1, 0, 1, -1, 0,
-1, -1, 0, 0, 1, -1, -1, 2, 0, 0, 0, 0, 1, -2, 2, 0,
--2, 2, 0, 2, -2, 1, 1, -1, 3, 0, -1, 1, 0, 4, -2, 0,
-1, -2, 1, 0, 0, -2, -1, 2, -1, 0, 1, -1, 0, 0, 1, -2,
-0, 0, 0, -1, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, -1, 1,
-0, 1, 0, 1, 0, 0, 1, 0, -2, 0, 0, 1, -1, 0, 0, 0,
-1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 1,
-0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0,
-0, 1, 0, -1, 1, 1, 0, 0, 1, 0, -1, 1, 1, -1, 0, 0,
-0, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 0,
-1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 1, 0, 0, 0,
-0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
-0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, 0, -1,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -1,225 +0,0 @@
-// TTS sound: opt_horn_truck
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_horn_truckSampleRate = 11025;
-const unsigned int menu_opt_horn_truckSampleCount = 3486;
-const signed char menu_opt_horn_truckSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 2, -1, -1, 1, 0, 1, 1, -1, 1, 1, 0, 3,
--1, -1, 0, 0, -2, 1, 1, -2, -1, 2, 0, 2, -2, 0, 3, 0,
--1, 1, 0, -3, 0, 4, 2, -2, -1, 0, 1, -1, 0, 1, -2, 0,
-1, 0, -2, 1, 1, -2, -1, 3, 0, -3, 2, -5, 6, 0, -2, -3,
-2, 3, -7, -2, 4, -1, 3, -8, 4, 3, 2, -10, 7, 3, -6, -2,
-3, 2, -2, 0, 2, -1, -3, 2, 1, -2, 3, -4, -5, 6, 1, 1,
--5, 5, -4, 4, 0, -4, 1, -2, 2, 1, 3, -5, 3, 3, 0, 0,
-0, -4, 4, -1, 4, -10, 3, 2, 2, -6, -1, -3, 2, 1, -3, 4,
--6, 4, -4, 1, 4, 1, -5, 3, -5, 6, 1, 0, -4, -1, 4, -1,
--1, -5, 4, -1, -1, -4, 6, -2, 0, -7, 5, 5, 1, -9, -2, 7,
-1, -2, -4, 5, 2, -2, 1, -1, 4, 0, 0, -8, 2, 8, -2, -8,
-3, 0, 3, -5, 3, -3, 0, 3, -3, 7, -8, 5, 1, 0, 2, -6,
-8, -10, 3, 3, 4, -6, -8, 12, -3, -3, 0, 2, 4, -3, -3, 4,
-4, -8, 1, 6, -4, -2, 5, 1, -6, 0, 4, 2, -4, 1, 0, -5,
-0, 10, -1, -8, -3, 9, 2, -7, 5, -3, 8, -7, 0, 5, 0, -8,
-5, 2, -3, 0, 6, -3, -7, 4, 3, 4, -7, 3, -4, -4, 7, 5,
--8, -2, 2, -4, 9, -4, 1, 0, -6, 2, 2, 3, -3, -6, 5, -1,
-1, 2, 3, -8, 3, 7, -2, 1, -9, 7, 5, -5, -6, -2, 6, 1,
--3, -2, 3, -1, 2, -3, 2, 1, 6, -12, 2, 11, 2, -7, -1, 1,
--3, 5, 6, -5, -7, 1, 2, 8, -4, 2, -4, 0, 4, 3, 1, -8,
--4, 4, 7, -3, -1, -2, 6, -5, -8, 7, 5, -1, 1, -8, -3, 8,
-7, -1, -5, -3, 1, 5, 1, 0, -1, -8, 6, -1, 2, -2, -2, -3,
-2, 11, -4, -10, 0, 7, 0, 0, -6, 6, -7, 1, 2, 0, -3, 6,
--2, -1, -5, 3, 5, -7, -1, 3, 2, 6, -12, -1, 8, 1, 0, -1,
--1, -6, 2, 5, 3, -3, -2, -3, 2, 5, 1, -1, -4, 4, -3, -2,
-8, 5, -6, -2, 0, 0, 1, 7, -1, -7, -3, 2, 7, 2, 2, -7,
--1, 0, 9, 1, -2, -9, -2, 6, 4, 1, -3, 1, 0, -6, 0, 5,
-3, 1, -3, -10, 0, 14, 0, -2, -6, 1, -1, 0, 5, 0, 1, -1,
--4, 3, 2, -1, 0, 0, -1, -2, 0, 1, 4, -1, 1, -1, -2, 5,
-1, 2, -6, -5, 2, 4, 2, -1, -2, 3, -1, -4, 1, 2, 2, 5,
--5, -7, 4, 6, 3, -2, 0, -2, -4, 2, 3, 3, -1, -4, -5, -1,
-6, 5, 0, -4, -4, -1, 6, 4, 3, -7, -8, 0, 5, 7, 1, -8,
--7, 1, 9, 6, -1, -7, -9, 3, 9, 5, -6, -7, -3, -1, 6, 4,
-0, -3, -6, 0, 3, 6, 5, -3, -5, -1, 4, 8, 5, -5, -8, -3,
-3, 7, 3, -4, -11, -2, 4, 10, 2, -7, -4, -1, 4, 3, 1, -2,
--2, -3, 1, 0, 3, 1, 0, -1, -1, -2, 4, 5, -3, -5, -4, 3,
-2, 1, -2, -5, -2, 4, 2, -2, -4, -2, 1, 3, 4, -2, -2, -1,
-1, -1, -2, -1, 1, 0, -1, 0, -1, -2, -3, -1, -1, -1, 0, -2,
-0, 1, -1, 0, 0, 0, 1, -1, -1, -1, 1, 1, 1, 0, 0, 1,
-7, 10, 6, 2, 3, 6, 9, 8, 5, 2, 1, 5, 6, 5, 3, 2,
-1, 2, 3, 3, 1, 0, -1, -2, -1, 0, -1, -2, -4, -4, -4, -2,
--2, -3, -4, -4, -4, -2, -2, -2, -3, -3, 0, 1, 2, 1, 1, 1,
-3, 3, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 3, 11, 17, 19,
-16, 13, 15, 19, 20, 18, 12, 8, 9, 9, 8, 7, 4, 3, 3, 2,
-2, 2, 1, 0, -2, -5, -5, -5, -5, -7, -8, -10, -9, -8, -7, -8,
--8, -8, -6, -6, -5, -5, -4, -3, -3, -2, -2, -1, 0, 0, 1, 1,
-2, 2, 4, 4, 4, 4, 4, 4, 4, 7, 18, 29, 37, 38, 34, 34,
-37, 40, 38, 30, 20, 15, 13, 11, 10, 6, 3, 3, 2, 2, 1, 0,
-0, -2, -7, -11, -14, -14, -14, -16, -21, -24, -24, -22, -18, -16, -16, -15,
--13, -10, -7, -5, -4, -2, -2, -1, 0, 1, 3, 5, 6, 6, 7, 9,
-11, 12, 12, 12, 11, 10, 17, 33, 47, 55, 52, 44, 40, 43, 45, 42,
-31, 17, 8, 4, 3, 3, 0, -3, -5, -6, -8, -8, -8, -8, -11, -18,
--26, -30, -31, -27, -25, -26, -27, -26, -21, -14, -8, -5, -3, -2, 1, 2,
-4, 6, 7, 8, 9, 8, 9, 10, 13, 16, 15, 14, 13, 13, 14, 13,
-11, 8, 7, 17, 35, 51, 58, 51, 39, 34, 35, 36, 32, 19, 4, -5,
--11, -10, -9, -10, -10, -10, -13, -16, -17, -15, -11, -11, -16, -22, -26, -23,
--19, -15, -14, -14, -13, -8, -3, 1, 4, 6, 8, 8, 8, 8, 8, 10,
-11, 10, 8, 7, 7, 9, 11, 10, 8, 7, 6, 6, 4, 3, 1, 4,
-20, 44, 62, 66, 54, 38, 30, 32, 34, 29, 15, -1, -12, -17, -17, -12,
--7, -3, -4, -9, -13, -11, -7, -3, -5, -14, -22, -24, -21, -15, -12, -11,
--10, -8, -4, 0, 3, 7, 10, 9, 7, 4, 3, 6, 7, 6, 5, 2,
-2, 5, 6, 7, 7, 5, 5, 4, 2, 2, 1, 0, 9, 30, 57, 73,
-69, 51, 35, 30, 34, 35, 25, 8, -8, -18, -18, -13, -6, 1, 2, -2,
--8, -11, -6, -1, -2, -8, -18, -25, -24, -18, -13, -9, -7, -6, -4, -1,
-3, 7, 10, 9, 5, 1, -1, 0, 4, 4, 3, 1, 1, 3, 5, 6,
-7, 7, 5, 3, 0, 0, 1, -1, 1, 16, 45, 71, 79, 65, 45, 33,
-31, 30, 21, 5, -10, -19, -22, -20, -12, -1, 8, 7, 1, -5, -4, 1,
-1, -6, -15, -23, -24, -20, -15, -10, -3, 0, 1, 2, 3, 8, 11, 9,
-4, -1, -4, -3, -2, -1, 1, 1, 2, 3, 3, 5, 7, 7, 5, 1,
--2, -2, -2, 0, 1, 1, 15, 49, 79, 90, 77, 50, 35, 32, 26, 17,
-3, -12, -21, -26, -25, -11, 6, 16, 16, 6, -3, -1, 1, -2, -7, -17,
--23, -24, -24, -17, -6, 3, 7, 6, 3, 5, 8, 10, 6, 0, -4, -8,
--9, -6, -3, 2, 5, 4, 3, 5, 6, 8, 10, 8, 6, 3, -2, -3,
-0, 0, 0, 9, 39, 74, 89, 79, 55, 35, 29, 23, 13, 4, -8, -19,
--25, -26, -14, 7, 20, 19, 9, 0, -1, -1, -3, -8, -15, -21, -25, -26,
--17, -5, 5, 9, 7, 4, 5, 6, 7, 5, 0, -4, -9, -10, -7, -3,
-3, 6, 2, 2, 3, 3, 5, 5, 1, -1, -4, -7, -5, -2, 0, 2,
--1, 8, 44, 79, 90, 80, 51, 29, 22, 11, 7, 5, -7, -16, -25, -26,
--6, 15, 24, 23, 11, 0, -4, -8, -9, -9, -14, -20, -26, -25, -13, 0,
-10, 13, 12, 7, 5, 3, 1, 3, -3, -11, -16, -17, -9, 1, 5, 8,
-8, 5, 4, 4, 4, 5, 1, -4, -8, -9, -6, -2, 1, 5, 4, 12,
-47, 81, 89, 76, 48, 23, 10, 1, -4, -1, -6, -18, -25, -21, -2, 18,
-27, 23, 14, 1, -10, -14, -14, -10, -11, -19, -22, -18, -9, 6, 14, 15,
-13, 2, -5, -4, -4, -3, -1, -8, -11, -7, -5, 4, 11, 12, 10, 5,
--1, -1, 0, -1, 0, -4, -7, -4, -5, -1, 6, 6, 4, 4, 18, 57,
-83, 77, 62, 37, 14, 3, -2, 1, 4, -8, -22, -23, -12, 7, 20, 23,
-20, 8, -8, -15, -13, -10, -8, -13, -16, -15, -11, -1, 9, 16, 15, 7,
-0, -3, -4, -2, -3, -2, -5, -8, -5, 0, 7, 11, 9, 7, 3, -2,
--2, -1, -1, -1, -4, -5, -3, -2, 1, 6, 7, 3, -1, 7, 44, 76,
-75, 65, 47, 22, 8, 2, 7, 12, -4, -20, -22, -16, 0, 14, 24, 23,
-5, -9, -14, -12, -7, -8, -13, -15, -21, -18, -6, 7, 15, 11, 6, 1,
--4, -2, 0, 1, 2, -7, -11, -4, -1, 5, 11, 10, 7, 1, -2, 1,
-2, 0, 0, -4, -6, -4, -3, 1, 6, 4, 2, 0, 1, 28, 68, 77,
-68, 55, 28, 10, 6, 8, 17, 5, -17, -19, -17, -10, 9, 22, 22, 7,
--7, -12, -12, -9, -7, -8, -14, -24, -19, -10, 1, 12, 11, 7, 3, -5,
--3, 1, 2, 2, -5, -7, -7, -5, 6, 9, 8, 9, 1, -2, 2, 1,
-2, 2, -2, -5, -6, -4, 2, 3, 3, 5, 0, -4, 2, 28, 71, 79,
-64, 55, 31, 8, 5, 14, 18, 0, -17, -19, -18, -10, 8, 26, 21, 2,
--6, -10, -12, -10, -7, -6, -17, -27, -18, -8, 0, 11, 10, 8, 2, -7,
-0, 4, 0, 1, -3, -7, -8, -4, 7, 10, 7, 8, 3, -1, 1, 1,
-4, 3, -6, -8, -10, -9, -1, 1, 3, 3, -2, -2, -2, 6, 42, 73,
-71, 61, 45, 23, 8, 6, 16, 13, -8, -17, -18, -15, -2, 14, 25, 16,
--3, -7, -10, -12, -9, -7, -11, -21, -24, -13, -2, 2, 12, 12, 3, -1,
--3, 1, 3, -1, -1, -5, -9, -6, 1, 10, 8, 3, 2, -1, -4, -1,
-4, 2, -2, -6, -5, -2, -2, 4, 7, 0, 0, 0, -1, 0, 1, 21,
-59, 69, 62, 57, 37, 17, 7, 10, 17, -1, -17, -14, -16, -13, 6, 20,
-21, 6, -5, -3, -10, -16, -6, -8, -19, -24, -19, -7, -2, 4, 15, 10,
--3, 0, 4, 4, 3, 0, 0, -6, -11, 0, 6, 8, 8, 6, 6, -1,
-1, 7, 1, 0, -2, -7, -5, -4, -1, 4, 3, 1, 0, -1, 2, 0,
--1, 17, 50, 64, 62, 60, 40, 18, 10, 10, 15, 4, -11, -12, -16, -14,
-4, 18, 19, 10, 1, -6, -12, -12, -7, -7, -20, -23, -18, -16, -7, 7,
-11, 6, 1, 1, -1, -1, 1, 1, -4, -9, -8, -2, 1, 7, 10, 9,
-5, 1, 4, 4, 1, 2, -2, -3, -7, -5, 4, 1, 1, 8, 1, -3,
-3, 2, -2, -1, 19, 55, 62, 60, 60, 37, 16, 9, 14, 15, 0, -7,
--9, -19, -11, 6, 19, 18, 8, 4, -6, -14, -11, -8, -8, -21, -22, -16,
--17, -7, 6, 11, 6, 0, 1, -1, -3, 1, 0, -3, -9, -8, -2, 0,
-8, 10, 8, 7, 1, 2, 5, 1, 0, 1, -3, -7, -3, 1, 2, 2,
-4, 4, 0, -2, 2, 2, -3, 6, 40, 61, 58, 63, 53, 26, 13, 14,
-18, 8, -5, -3, -13, -19, 0, 14, 19, 13, 7, 3, -13, -14, -7, -10,
--14, -22, -20, -16, -18, -1, 12, 4, 2, 4, -1, -5, -3, 3, -1, -9,
--5, -5, -4, 3, 9, 12, 6, 5, 5, 1, 2, 4, -1, -1, -3, -4,
--1, 2, 4, 4, 4, 3, 0, 1, 0, -1, -1, -3, 4, 34, 58, 60,
-60, 51, 26, 11, 13, 17, 9, -2, -4, -13, -17, -3, 14, 19, 14, 11,
-2, -13, -13, -7, -9, -15, -18, -18, -19, -17, 0, 8, 4, 6, 3, -3,
--5, -3, 3, -3, -7, -7, -9, -5, 0, 6, 12, 7, 4, 4, 2, 1,
-2, 5, 0, -6, -3, -2, -3, 4, 5, 5, 3, 0, 2, -1, 0, 3,
--4, -3, 14, 44, 59, 56, 59, 44, 17, 12, 16, 15, 5, 0, -2, -16,
--14, 6, 16, 15, 14, 11, -5, -16, -8, -6, -14, -15, -18, -25, -27, -15,
--3, 0, 4, 5, -2, -7, -5, -1, -1, -3, -2, -8, -10, -2, 0, 8,
-11, 8, 8, 3, 1, 6, 3, 4, 2, -2, -2, -4, 0, 5, 3, 5,
-5, -1, 0, 0, 0, 1, -2, -3, 6, 33, 51, 56, 59, 46, 25, 15,
-12, 15, 12, 6, 2, -10, -10, 0, 7, 18, 19, 12, 3, -8, -9, -11,
--9, -8, -16, -19, -19, -17, -9, -2, 5, 3, -1, -3, -6, -6, -4, -2,
--2, -7, -7, -4, -4, 3, 8, 8, 6, 5, 3, 2, 3, 4, 3, 2,
--2, -2, 0, 1, 3, 5, 4, 3, 0, 0, 1, 0, 2, 1, -2, 5,
-27, 40, 42, 47, 39, 21, 14, 16, 17, 9, 8, 5, -7, -8, 3, 10,
-13, 13, 11, 2, -7, -6, -5, -8, -10, -12, -15, -20, -14, -6, -3, -1,
-0, -1, -7, -7, -2, -2, -5, -4, -4, -8, -6, 0, 3, 5, 5, 6,
-5, 1, 4, 5, 3, 2, 1, 0, -1, 1, 4, 5, 4, 4, 3, 3,
-1, 2, 2, 0, -1, -2, -3, 0, 19, 33, 35, 39, 34, 22, 14, 13,
-16, 11, 5, 4, -3, -7, 2, 9, 13, 12, 9, 5, -4, -5, -2, -7,
--8, -12, -15, -15, -14, -6, -2, -2, -2, -6, -8, -9, -8, -4, -5, -9,
--9, -8, -6, -3, 2, 6, 3, 2, 4, 2, 2, 4, 4, 2, 0, 0,
-2, 3, 5, 7, 5, 4, 4, 3, 4, 2, 3, 2, -2, -1, -1, -2,
-3, 17, 29, 31, 32, 30, 20, 11, 11, 14, 8, 3, 3, -2, -4, 3,
-11, 13, 10, 10, 4, -3, -4, -3, -6, -10, -13, -13, -15, -11, -5, -2,
--2, -2, -4, -5, -5, -5, -4, -7, -9, -8, -8, -4, -2, 2, 4, 2,
-3, 4, 3, 4, 3, 3, 0, -1, 1, 1, 3, 5, 5, 4, 5, 4,
-4, 3, 3, 2, 0, -2, -1, 0, 0, 0, 6, 17, 23, 25, 26, 20,
-14, 10, 9, 10, 5, 4, 1, -2, 1, 5, 10, 10, 8, 6, 1, -2,
--2, -4, -6, -9, -11, -12, -11, -7, -3, -3, -2, -3, -4, -4, -5, -4,
--6, -7, -7, -8, -5, -3, 0, 2, 1, 2, 3, 2, 4, 3, 1, 0,
--2, 0, 0, 1, 4, 2, 4, 4, 4, 5, 4, 5, 2, 0, 1, -1,
--1, 1, 1, 0, -1, 4, 14, 20, 22, 22, 17, 12, 8, 10, 11, 7,
-4, 1, 0, 1, 5, 10, 10, 6, 4, 2, -1, -1, -2, -4, -8, -10,
--10, -9, -6, -3, -3, -5, -6, -5, -5, -5, -4, -6, -8, -9, -7, -5,
--4, -2, -1, -1, -1, 1, 3, 2, 2, 1, 1, 1, 1, 3, 4, 3,
-4, 4, 5, 5, 6, 6, 4, 3, 3, 3, 2, 2, 3, 1, 0, 1,
-3, 11, 16, 17, 17, 13, 11, 9, 9, 10, 6, 3, 1, -1, 1, 2,
-5, 5, 2, 2, 1, 1, 2, 0, -1, -5, -6, -6, -6, -6, -5, -6,
--6, -6, -5, -3, -3, -3, -4, -5, -5, -4, -3, -3, -3, -3, -3, -2,
--1, 0, 1, 1, 1, 1, 2, 3, 3, 3, 3, 2, 2, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3, 6, 7, 7,
-8, 8, 8, 7, 9, 8, 6, 5, 4, 4, 3, 3, 3, 2, 1, 1,
-1, 1, 1, 0, -1, -1, -2, -2, -2, -3, -3, -4, -4, -4, -4, -3,
--4, -4, -4, -3, -3, -3, -2, -2, -3, -2, -2, -2, -1, -1, -1, -1,
-0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2,
-2, 1, 2, 1, 1, 1, 1, 1, 1, 3, 4, 5, 6, 5, 6, 6,
-6, 7, 7, 6, 5, 5, 5, 4, 4, 4, 3, 2, 2, 2, 2, 1,
-1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
-1, 1, 1, 1, 0, 1, 2, 3, 3, 3, 4, 4, 5, 6, 6, 6,
-6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 3, 3, 2,
-2, 2, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
--1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1,
-0, 0, -1, -1, 0, 1, 1, 0, -1, -1, 0, 1, 1, 0, -1, 0,
-0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
-1, 1, 1, 1, 2, 1, 0, 0, 0, 1, -1, 1, -1, 0
-};
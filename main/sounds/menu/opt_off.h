@@ -1,163 +0,0 @@
-// TTS sound: opt_off
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_offSampleRate = 11025;
-const unsigned int menu_opt_offSampleCount = 2486;
-const signed char menu_opt_offSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-1, 1, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 2, 1, 0, -1, -1, -2, -1, 0, 0, 1, 2, 6, 8, 8, 9,
-7, 1, -2, -5, -7, -6, -3, 1, 4, 4, 4, 3, -1, -2, -2, -3,
--3, -2, -2, -1, -1, 0, 1, 1, 2, 3, 2, 1, -1, -2, -2, -3,
--2, 1, 1, 2, 3, 2, 1, 0, 0, -2, -1, 0, -1, -1, 0, 0,
-0, 1, 2, 0, 1, 4, 15, 22, 22, 27, 20, 4, -5, -15, -19, -15,
--9, 4, 11, 10, 12, 8, -3, -5, -6, -8, -5, -4, -4, -3, -4, -3,
-1, 2, 5, 9, 6, 3, -1, -6, -8, -8, -5, 0, 4, 8, 11, 9,
-6, 2, -3, -5, -5, -5, -2, -1, 0, 3, 1, 1, 4, 1, 0, 7,
-23, 33, 33, 39, 30, 4, -10, -22, -28, -20, -9, 8, 20, 16, 16, 10,
--5, -9, -9, -11, -7, -6, -3, -2, -8, -4, 2, 1, 7, 13, 8, 3,
--2, -8, -13, -13, -8, 1, 5, 8, 12, 8, 2, 0, -3, -5, -5, -3,
-0, -1, -1, 1, 1, 0, 3, 5, 2, 3, 16, 32, 37, 41, 44, 25,
-0, -14, -26, -30, -20, -4, 14, 20, 19, 19, 6, -8, -11, -12, -13, -9,
--5, -4, -6, -6, -2, 1, 3, 10, 13, 8, 1, -5, -12, -16, -15, -6,
-3, 6, 13, 16, 7, 1, 0, -6, -9, -5, -1, -1, 0, 3, 2, -1,
-1, 4, 3, 2, 8, 26, 39, 42, 50, 44, 15, -5, -20, -31, -29, -16,
-6, 19, 20, 23, 17, -3, -10, -11, -15, -13, -8, -5, -5, -9, -6, 0,
-0, 4, 13, 11, 5, 0, -6, -12, -16, -11, -2, 3, 8, 14, 13, 5,
-2, 0, -5, -7, -3, 0, -2, 0, 2, 0, 0, 2, 4, 4, 2, 14,
-39, 46, 50, 58, 39, 8, -13, -28, -32, -28, -10, 16, 23, 21, 26, 12,
--9, -11, -14, -16, -12, -11, -6, -7, -13, -8, -6, -6, 4, 9, 9, 7,
-1, -4, -11, -15, -10, -5, 1, 9, 12, 12, 9, 4, 1, -2, -4, -2,
--1, -1, 0, 0, 0, 0, 1, 4, 5, 1, 11, 36, 49, 57, 67, 54,
-22, -4, -25, -35, -33, -18, 7, 22, 24, 27, 18, 0, -8, -13, -15, -15,
--14, -8, -10, -14, -7, -3, -2, 7, 12, 11, 7, 1, -5, -13, -16, -10,
--6, 0, 9, 12, 12, 10, 5, 3, -2, -5, -2, -3, -5, -1, 0, -1,
-1, 4, 4, 4, 3, 7, 26, 45, 57, 66, 58, 35, 6, -21, -33, -31,
--22, 1, 20, 26, 26, 18, 6, -6, -15, -16, -16, -17, -15, -14, -14, -11,
--7, 0, 7, 11, 12, 8, 0, -7, -13, -15, -13, -7, 1, 9, 11, 12,
-13, 7, 2, 1, -2, -4, -4, -3, -2, -2, 0, 3, 4, 4, 7, 6,
-0, 3, 24, 45, 56, 65, 63, 37, 4, -19, -32, -32, -22, 1, 22, 26,
-24, 20, 6, -6, -11, -12, -12, -14, -14, -13, -15, -14, -8, 1, 8, 11,
-13, 10, -1, -10, -13, -16, -14, -6, 1, 8, 10, 11, 11, 6, 2, 1,
--1, -3, -4, -3, -3, -3, -1, 3, 4, 6, 6, 6, 3, -3, 6, 32,
-48, 60, 71, 56, 26, -5, -28, -35, -33, -17, 12, 26, 27, 27, 16, 0,
--10, -13, -12, -13, -14, -11, -14, -17, -11, -4, 3, 11, 14, 14, 6, -6,
--11, -16, -18, -11, -1, 4, 9, 12, 12, 7, 2, 2, 0, -4, -2, -3,
--3, -3, -2, 2, 3, 4, 8, 6, 4, 1, -4, 0, 20, 42, 57, 67,
-62, 37, 6, -20, -35, -32, -19, 2, 23, 29, 26, 18, 4, -7, -12, -12,
--10, -10, -12, -12, -14, -15, -8, 2, 8, 12, 15, 8, -3, -11, -16, -17,
--14, -4, 5, 8, 11, 12, 7, 2, 0, -1, -2, -3, -2, -2, -3, -2,
-1, 2, 4, 6, 5, 2, -1, -5, -8, -3, 19, 47, 62, 71, 68, 40,
-4, -23, -37, -36, -23, 2, 27, 33, 30, 23, 7, -8, -14, -13, -11, -12,
--11, -11, -15, -15, -7, 2, 10, 15, 15, 9, -4, -14, -19, -20, -15, -5,
-6, 13, 13, 11, 9, 1, -4, -2, -3, -4, -2, 3, 4, 4, 7, 11,
-7, 5, 5, 1, -4, -5, -4, -5, -3, 16, 44, 58, 68, 70, 50, 14,
--17, -35, -40, -32, -7, 21, 35, 35, 30, 16, -4, -16, -17, -15, -15, -11,
--7, -10, -12, -7, 1, 8, 11, 14, 12, -2, -13, -17, -20, -18, -7, 5,
-14, 15, 15, 12, 2, -5, -4, -6, -6, -2, 1, 1, 0, 1, 4, 4,
-4, 6, 4, 0, -3, -6, -6, -7, -3, 15, 40, 58, 68, 69, 50, 15,
--16, -35, -39, -30, -6, 22, 37, 37, 29, 15, -5, -18, -18, -15, -13, -8,
--4, -6, -9, -7, 0, 5, 10, 13, 10, -3, -15, -20, -24, -20, -6, 6,
-15, 19, 14, 7, -3, -11, -10, -8, -5, 1, 5, 4, 2, 1, 1, 2,
-3, 5, 6, 1, -3, -5, -7, -7, -2, 2, 10, 32, 51, 58, 62, 53,
-27, -3, -25, -33, -28, -16, 10, 32, 34, 30, 22, 3, -13, -18, -16, -13,
--13, -10, -7, -12, -13, -4, 4, 8, 11, 12, 5, -10, -17, -17, -18, -11,
-1, 12, 14, 11, 10, 4, -6, -7, -3, -3, -2, 1, 3, 0, -2, 1,
-3, 3, 5, 5, 3, -1, -6, -5, -5, -5, 1, 5, 7, 24, 43, 53,
-58, 53, 34, 6, -19, -29, -28, -20, 2, 22, 28, 26, 19, 8, -6, -14,
--12, -10, -11, -9, -7, -9, -9, -4, 3, 8, 10, 10, 5, -6, -12, -15,
--14, -9, -1, 7, 11, 9, 7, 4, -2, -4, -3, -2, -1, -1, 0, 0,
--2, 0, 3, 3, 4, 6, 2, -2, -3, -4, -6, -3, 1, 3, 2, 2,
-10, 28, 40, 51, 57, 46, 23, -1, -19, -25, -22, -7, 14, 24, 26, 23,
-13, 0, -9, -10, -7, -9, -8, -5, -10, -12, -8, -2, 4, 7, 10, 9,
--2, -9, -11, -15, -13, -4, 3, 7, 7, 7, 6, -1, -3, 1, -2, -1,
-1, -1, -1, -3, -1, 3, 3, 5, 7, 4, 1, -2, -4, -3, -4, -2,
-3, 2, 2, 3, 1, 9, 29, 41, 50, 54, 43, 19, -4, -18, -21, -18,
--2, 16, 23, 22, 18, 8, -1, -7, -7, -4, -7, -8, -8, -12, -13, -9,
--2, 5, 7, 9, 6, -4, -9, -12, -13, -9, -3, 2, 6, 5, 4, 3,
--1, 0, 1, 0, 1, -1, -2, -1, -3, -1, 3, 4, 5, 5, 3, 0,
--2, -3, -3, -2, 0, 1, 1, 1, 1, 1, -1, 5, 23, 38, 45, 51,
-45, 25, 3, -11, -16, -15, -6, 11, 19, 18, 16, 11, 2, -4, -4, -2,
--6, -9, -9, -12, -13, -9, -2, 5, 6, 7, 5, -3, -10, -10, -10, -9,
--4, 2, 3, 2, 3, 3, 1, 1, 3, 2, 0, -2, -1, -3, -3, 0,
-3, 4, 4, 5, 3, 0, -2, -1, -2, -1, -1, 1, 1, -1, 0, 2,
--1, 0, 8, 22, 34, 42, 48, 41, 22, 5, -7, -12, -10, 0, 13, 18,
-17, 16, 9, 2, -1, -1, -2, -5, -8, -10, -14, -14, -9, -4, 2, 4,
-4, 2, -5, -9, -9, -10, -9, -4, 0, 0, 0, 2, 3, 1, 3, 4,
-2, 1, -1, -1, -2, -2, 2, 4, 4, 5, 4, 3, 1, -1, 0, 0,
--1, 1, 0, -2, 0, -1, 0, 0, 0, 1, 9, 21, 30, 35, 37, 30,
-16, 3, -4, -5, -4, 3, 13, 13, 12, 11, 7, 4, 1, 1, 0, -6,
--9, -10, -13, -12, -7, -3, 1, 1, 1, -1, -7, -8, -7, -8, -7, -5,
--3, -1, -2, 0, 2, 2, 2, 4, 2, -1, -2, -2, -3, -2, 1, 3,
-4, 5, 5, 4, 2, 1, 1, 0, 0, 0, 0, 0, 0, 1, 2, 1,
-2, 1, 1, 6, 16, 24, 28, 30, 25, 14, 4, -1, -2, -1, 5, 11,
-12, 11, 9, 7, 3, 2, 2, 0, -3, -6, -8, -10, -10, -7, -3, -1,
--1, -1, -4, -7, -10, -10, -9, -8, -7, -4, -4, -4, -3, -1, 0, 0,
-1, 1, -1, -2, -2, -1, -1, 2, 4, 4, 5, 5, 4, 3, 3, 2,
-2, 2, 2, 2, 2, 2, 2, 3, 3, 2, 2, 1, 6, 14, 19, 23,
-25, 21, 12, 4, 0, -1, 0, 4, 9, 10, 9, 9, 7, 5, 4, 3,
-2, -2, -5, -7, -9, -9, -6, -3, -1, 0, -1, -2, -6, -8, -8, -9,
--9, -7, -6, -5, -5, -3, -2, -1, -1, 0, 0, -2, -2, -2, -2, -1,
-0, 2, 4, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3,
-3, 4, 4, 3, 2, 3, 7, 12, 15, 18, 18, 14, 9, 5, 3, 3,
-3, 6, 8, 7, 7, 7, 5, 4, 4, 3, 2, -1, -3, -5, -7, -6,
--4, -3, -2, -1, -3, -4, -5, -7, -7, -7, -7, -6, -6, -6, -5, -4,
--4, -3, -2, -1, -1, -2, -3, -2, -2, -2, 0, 1, 1, 2, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 4, 5, 4, 4, 3,
-6, 10, 13, 15, 17, 14, 11, 7, 5, 4, 4, 6, 8, 7, 6, 6,
-5, 5, 5, 4, 3, 1, -1, -3, -5, -6, -4, -4, -3, -3, -3, -4,
--5, -6, -5, -7, -8, -8, -8, -8, -8, -7, -6, -6, -5, -4, -5, -5,
--4, -4, -4, -4, -3, -3, -2, -1, 0, 0, 0, 2, 2, 2, 2, 2,
-2, 3, 3, 4, 4, 4, 5, 5, 5, 5, 5, 8, 10, 10, 11, 10,
-8, 8, 7, 8, 7, 6, 7, 6, 6, 7, 6, 7, 5, 5, 4, 2,
-2, 1, 0, 0, 0, -1, -1, -1, -1, -2, -3, -3, -4, -5, -5, -5,
--6, -5, -6, -6, -6, -6, -5, -6, -5, -6, -5, -6, -5, -5, -5, -4,
--4, -4, -3, -3, -2, -2, -2, -2, -1, 0, -1, 0, 1, 2, 1, 1,
-2, 2, 3, 3, 3, 2, 3, 5, 5, 3, 5, 4, 4, 5, 6, 4,
-4, 5, 4, 4, 4, 5, 5, 2, 4, 3, 2, 2, 1, 2, 1, 1,
-2, 1, -1, 0, 1, -1, 1, 0, -1, -1, -1, 0, -2, -2, -2, -2,
-0, -1, -1, 0, -3, -1, 0, -2, 0, 0, -1, -2, -1, 0, 0, 0,
-1, 0, -2, -1, 0, 0, 2, 0, -1, -1, 1, 1, 1, 2, -1, -1,
-0, 0, 0, 1, -1, 1, 1, 1, 0, 1, 0, 1, 0, 0, -1, 0,
-1, 1, 0, 1, 0, 0, 1, 0, -1, -1, 1, 0, 1, 1, 1, 0,
-1, -1, 0, -2, 1, 0, 0, 1, 1, 2, 0, -2, 0, -1, 0, 2,
-0, -1, 0, 2, -1, 1, 0, 1, -2, 0, 0, 0, 1, 0, -1, 0,
--1, 2, -1, 1, 0, -1, -1, 2, 0, -1, 0, -1, 0, -1, 1, 0,
--1, 1, -1, 0, 1, 1, 0, -2, 0, 1, 1, 1, -2, 2, 0, 1,
-0, 0, 0, 0, -1, 1, 0, 0, 1, 1, -1, 1, 1, -2, 1, 0,
-1, -2, 1, 0, 0, -1, 0, 2, 0, -1, 1, 1, 0, 1, 2, -1,
--1, 1, 1, 0, -1, 1, 0, -1, 1, 1, -1, -1, -1, 1, -1, 0,
-1, 0, 1, -1, -1, 0, -1, 1, 2, -2, 0, 1, 1, -1, 1, 1,
-0, -2, 1, -1, 0, 1, -1, 0, -1, 0, 1, -1, 1, 0, -2, 1,
-1, 0, -1, 0, 0, 0, -1, 2, -2, -1, 2, -2, 0, -1, 0, 0,
--1, 2, 0, -1, 1, -1, 1, 0, -1, 0, 0, 0, 1, 0, 1, 1,
--1, 1, -1, 0, 0, -1, 1, -1, 1, 0, 0, -1, 0, 1, -1, 0,
-0, -1, 1, 1, 1, -2, 0, 0, 1, 2, -1, 0, 1, 1, 1, -1,
--1, 0, -2, 1, 0, 0, 0, 1, -1, 1, -2, 1, 1, -1, 1, -1,
-0, 1, -1, 1, 0, -1, 1, -1, 0, 1, 0, -1, 0, 0, 1, 0,
-0, -1, -1, 2, 1, -1, 0, 0, 0, 0, 2, 1, -2, 1, 0, 0,
-0, 1, 1, -1, -2, 3, -1, 0, 0, -1, 1, 0, 1, -1, -2, 1,
-0, 0, 1, -1, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 2,
--2, 1, 1, -1, 1, 0, 0, 0, 0, 1, 0, 1, -1, 1, 0, 0,
-0, 1, -1, 0, 2, 0, -2, 1, -1, 0, 0, 0, 2, -3, 1, 0,
--1, -1, 1, 0, -1, -1, 0, 1, -1, 1, 1, -2, 1, 0, 0, -1,
--1, 1, 0, -1, 1, 1, -1, -1, 0, 0, -1, 0, 1, -1, 1, 0,
-0, 1, -1, 0, 0, 1, -1, 0, 0, 1, 0, 1, 0, -1, -1, 1,
-1, 0, -1, 0, 0, -1, 2, -1, -2, 0, -1, 1, 0, 1, -1, -1,
-0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 0,
-0, 0, -1, 1, -2, 0, 1, 0, 0, -1, 2, 0, 0, 1, 0, 0,
-0, 0, 1, 0, -1, 1, 0, -1, 0, 1, 0, -1, 1, 0, 0, 0,
-1, -1, -1, 0, 0, 0, 0, 0, 1, -1, 1, 0, -1, 1, 0, 0,
-0, 1, 0, -1, 0, 1
-};
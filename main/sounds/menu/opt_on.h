@@ -1,216 +0,0 @@
-// TTS sound: opt_on
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_onSampleRate = 11025;
-const unsigned int menu_opt_onSampleCount = 3334;
-const signed char menu_opt_onSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 1,
-1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-1, 0, 0, -1, -1, -1, 0, 0, 0, 2, 4, 5, 6, 7, 6, 2,
-1, -2, -4, -3, -2, -1, 1, 2, 2, 1, 0, -1, -1, -2, -2, -2,
--2, -1, -2, -2, -1, 0, 0, 1, 1, 1, 1, 0, -1, -1, -1, 0,
-0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 2, 6, 10, 12, 13, 10,
-4, 0, -4, -6, -5, -2, 1, 3, 4, 3, 1, 0, -1, -3, -2, -2,
--3, -3, -3, -4, -3, -2, 0, 1, 2, 3, 2, 1, 0, -1, -1, -1,
-0, 1, 2, 2, 2, 1, 1, 1, 0, 0, 1, 0, 0, 0, -1, -1,
-0, 0, 0, 1, 1, 0, -1, 0, -2, -2, 0, 0, 6, 13, 15, 18,
-18, 9, 3, -3, -8, -7, -4, 1, 6, 6, 6, 5, 0, -2, -2, -5,
--3, -2, -5, -5, -5, -7, -4, -1, 0, 3, 3, 1, -1, -4, -5, -5,
--4, -1, 2, 2, 4, 4, 1, 1, 1, -1, 1, 1, 0, 1, 0, 0,
-0, 0, 2, 1, 2, 3, 0, -1, -1, -2, -2, -1, -1, 5, 17, 22,
-26, 29, 20, 7, -1, -10, -12, -6, 0, 7, 13, 12, 9, 3, -2, -5,
--6, -5, -4, -4, -3, -5, -7, -4, -4, -3, 2, 3, 1, 1, -3, -7,
--7, -6, -5, -1, 4, 4, 4, 4, 1, -1, -1, -1, -1, 1, 2, 2,
-1, 1, 1, 0, 1, 3, 1, 2, 2, -2, -1, 0, -3, -1, 3, 12,
-29, 36, 40, 40, 23, 6, -4, -16, -14, -1, 6, 17, 23, 18, 12, 4,
--5, -8, -8, -7, -4, -3, -4, -7, -8, -9, -7, -3, 0, 1, 3, -2,
--8, -8, -12, -12, -4, -1, 2, 7, 5, 3, 1, -3, -2, -2, -2, 4,
-3, 1, 6, 1, -1, 4, 0, -1, 4, -1, -2, -1, -2, -2, 0, 0,
-2, 14, 33, 44, 51, 54, 34, 13, 0, -16, -17, -2, 8, 20, 29, 26,
-18, 8, -2, -6, -10, -7, -3, -7, -6, -5, -15, -13, -7, -9, -3, 5,
-0, -3, -4, -13, -17, -14, -12, -6, 1, 5, 7, 4, 2, -1, -4, -1,
-2, 2, 6, 6, 2, 3, 2, 0, 3, 5, 6, 8, 7, 5, 1, -1,
-0, -3, -1, 6, 20, 43, 56, 64, 64, 40, 15, 2, -15, -16, 2, 12,
-20, 31, 26, 16, 11, 2, -3, -3, -4, -4, -7, -13, -15, -19, -21, -13,
--8, -3, 4, 3, -3, -9, -17, -22, -22, -18, -10, -4, 1, 4, 2, 0,
-0, -3, -2, 2, 3, 3, 3, 1, 0, 0, 2, 5, 6, 10, 13, 7,
-5, 6, -1, -3, 2, 0, 0, 14, 34, 48, 63, 70, 54, 30, 13, -6,
--16, -6, 6, 13, 24, 26, 19, 12, 7, 2, -1, -2, 0, -6, -12, -13,
--21, -24, -17, -13, -7, 3, 4, -1, -3, -10, -19, -18, -16, -15, -7, -1,
--1, 0, 2, -1, -1, 2, 2, 4, 5, 3, 2, 0, -2, 0, 2, 5,
-9, 9, 9, 9, 4, 1, 1, 0, -1, 1, 5, 18, 41, 57, 63, 66,
-48, 21, 6, -8, -15, -3, 8, 14, 22, 21, 14, 9, 6, 2, 2, 2,
--2, -7, -14, -20, -25, -24, -17, -10, -2, 4, 4, 0, -5, -14, -17, -17,
--16, -11, -5, -4, -1, 1, -2, -1, 2, 3, 5, 6, 6, 1, 0, -1,
--3, 0, 4, 6, 9, 10, 9, 7, 3, 3, 0, -2, 0, -1, -3, 11,
-35, 48, 62, 72, 54, 29, 15, -5, -15, -3, 6, 11, 22, 24, 16, 11,
-9, 5, 3, 5, 4, -3, -11, -16, -22, -27, -20, -11, -7, 2, 7, 1,
--4, -9, -16, -19, -16, -12, -9, -5, -2, -3, -4, -1, 0, 1, 5, 7,
-4, 3, 0, -5, -5, -4, -1, 4, 7, 11, 10, 7, 6, 2, -1, 1,
-1, 1, 3, 1, 3, 21, 41, 54, 69, 68, 47, 28, 8, -9, -10, -2,
-8, 19, 24, 24, 18, 11, 7, 4, 2, 4, 1, -6, -11, -19, -25, -23,
--20, -13, -2, 2, 3, 2, -7, -14, -16, -16, -13, -6, 0, 1, 1, 0,
--2, -5, -1, 4, 5, 8, 10, 5, 1, 0, -1, -3, 3, 7, 8, 10,
-10, 5, 3, 1, 0, 0, 1, 4, 3, 1, 3, 12, 31, 50, 63, 67,
-55, 33, 12, -4, -13, -7, 5, 15, 23, 27, 21, 13, 8, 4, 1, 3,
-3, 0, -6, -12, -20, -25, -22, -16, -9, 0, 4, 2, -2, -9, -16, -20,
--19, -15, -11, -6, -2, -2, -3, -2, -3, -1, 2, 4, 5, 5, 3, 0,
--2, -2, 0, 2, 7, 10, 9, 10, 8, 3, 3, 2, 0, 3, 4, 3,
-3, 3, 14, 35, 50, 63, 70, 53, 31, 13, -10, -17, -7, 1, 14, 27,
-26, 22, 16, 6, 1, 0, -1, 0, -2, -8, -14, -21, -25, -22, -17, -10,
-0, 3, 2, -1, -9, -17, -19, -21, -19, -10, -6, -4, 0, 0, -3, -1,
-0, 1, 5, 5, 5, 4, 1, -2, -1, -1, 2, 8, 10, 11, 10, 5,
-0, -2, -5, -4, 0, 2, 4, 5, 4, 12, 30, 44, 56, 64, 51, 34,
-16, -3, -10, -5, 2, 15, 24, 26, 24, 18, 10, 6, 2, 2, 1, -1,
--6, -12, -18, -21, -22, -16, -10, -4, 2, 2, -4, -8, -15, -21, -20, -18,
--14, -9, -6, -3, -3, -4, -3, -3, -2, 1, 3, 3, 3, 1, -1, -2,
-0, 2, 5, 9, 11, 10, 10, 8, 4, 3, 3, 3, 4, 5, 5, 4,
-3, 9, 26, 41, 54, 63, 55, 37, 20, 2, -9, -5, 2, 11, 20, 23,
-20, 14, 8, 5, 2, 2, 4, -1, -7, -11, -19, -26, -24, -21, -16, -7,
--2, -1, -4, -8, -14, -20, -20, -17, -16, -11, -6, -6, -6, -4, -4, -2,
-2, 5, 6, 6, 6, 3, -1, 0, 1, 2, 7, 11, 11, 13, 12, 9,
-7, 6, 5, 6, 5, 5, 4, 3, 2, 1, 6, 24, 39, 52, 60, 50,
-32, 16, -1, -9, -4, 2, 10, 16, 17, 13, 9, 6, 5, 4, 5, 4,
--1, -7, -15, -23, -26, -24, -20, -12, -5, -2, -1, -4, -10, -14, -16, -17,
--15, -11, -9, -9, -7, -7, -6, -2, 1, 4, 8, 8, 7, 4, 1, 0,
-0, 2, 5, 7, 10, 12, 10, 10, 9, 7, 7, 6, 5, 4, 3, 2,
-1, 0, 0, 6, 22, 37, 47, 51, 44, 26, 12, 2, -5, -1, 7, 10,
-12, 13, 10, 6, 7, 7, 7, 7, 5, -2, -9, -15, -21, -23, -20, -15,
--10, -5, -2, -4, -7, -9, -13, -14, -13, -12, -11, -10, -9, -9, -8, -5,
--1, 2, 6, 8, 7, 6, 4, 1, 2, 2, 3, 6, 8, 8, 10, 10,
-9, 9, 10, 8, 8, 7, 5, 3, 2, 1, 1, 1, 2, 11, 26, 37,
-45, 46, 35, 20, 9, 0, -1, 4, 7, 9, 11, 8, 6, 7, 6, 8,
-9, 5, 1, -4, -13, -18, -19, -20, -17, -11, -7, -4, -2, -4, -7, -8,
--10, -11, -10, -11, -11, -11, -10, -9, -5, -1, 2, 5, 6, 5, 4, 4,
-2, 1, 2, 3, 3, 5, 7, 7, 8, 10, 9, 9, 9, 7, 5, 5,
-3, 1, 2, 1, 1, 2, 2, 6, 18, 31, 40, 44, 38, 24, 12, 5,
-0, 1, 5, 5, 4, 5, 6, 5, 9, 11, 8, 6, 2, -6, -12, -15,
--18, -19, -18, -14, -11, -10, -6, -6, -8, -7, -7, -11, -10, -10, -13, -12,
--10, -9, -6, -2, 1, 3, 5, 6, 5, 5, 5, 3, 3, 5, 4, 5,
-7, 7, 9, 10, 10, 11, 10, 7, 6, 4, 1, 1, 1, 0, 1, 1,
--1, 0, 4, 15, 26, 33, 37, 31, 20, 13, 7, 5, 8, 8, 5, 6,
-4, 5, 8, 11, 10, 9, 7, 2, -3, -7, -11, -14, -13, -14, -12, -10,
--9, -8, -7, -7, -7, -8, -9, -10, -11, -12, -12, -11, -8, -6, -4, -2,
--1, 1, 2, 2, 3, 4, 2, 2, 3, 2, 4, 6, 6, 7, 8, 8,
-8, 9, 8, 7, 5, 5, 5, 3, 3, 3, 2, 2, 3, 1, 6, 20,
-27, 32, 37, 29, 19, 17, 14, 10, 12, 9, 4, 3, 5, 7, 9, 12,
-11, 7, 5, 1, -4, -7, -9, -12, -15, -13, -13, -12, -9, -8, -8, -7,
--7, -8, -9, -10, -11, -12, -11, -9, -9, -6, -4, -2, 0, 2, 2, 3,
-3, 3, 3, 3, 3, 3, 4, 5, 6, 7, 8, 8, 8, 8, 8, 6,
-5, 5, 3, 3, 3, 2, 2, 2, 2, 1, 8, 21, 27, 32, 34, 28,
-26, 26, 24, 20, 15, 10, 6, 6, 11, 12, 12, 13, 11, 10, 8, 6,
-2, -4, -7, -10, -14, -13, -11, -13, -11, -8, -9, -9, -7, -8, -10, -11,
--11, -13, -13, -11, -10, -9, -6, -3, -3, 0, 3, 1, 1, 3, 3, 0,
-1, 3, 1, 5, 5, 6, 8, 8, 8, 7, 7, 7, 5, 4, 3, 3,
-2, 2, 3, 1, 3, 2, 3, 14, 21, 23, 27, 25, 23, 25, 26, 23,
-17, 14, 10, 8, 13, 12, 12, 13, 10, 10, 10, 8, 6, 2, -2, -6,
--8, -8, -9, -8, -8, -8, -7, -6, -6, -6, -7, -8, -9, -8, -8, -8,
--7, -6, -6, -3, -1, -1, 0, 1, 1, 1, 1, 2, 2, 1, 2, 2,
-2, 4, 4, 4, 4, 3, 4, 3, 3, 2, 1, 0, 1, 1, 0, 1,
-0, 0, 0, 5, 13, 16, 21, 24, 22, 26, 29, 28, 27, 23, 20, 18,
-19, 20, 17, 15, 13, 11, 11, 10, 8, 3, 0, -2, -4, -5, -6, -8,
--10, -9, -8, -8, -7, -7, -8, -8, -7, -6, -5, -5, -4, -4, -2, 0,
-1, 2, 3, 3, 4, 5, 6, 5, 5, 5, 4, 5, 5, 5, 5, 4,
-4, 3, 3, 3, 2, 1, 0, 0, 0, -2, -2, -3, -4, -4, -4, -3,
-1, 6, 9, 12, 15, 18, 21, 24, 24, 24, 24, 24, 24, 25, 25, 24,
-24, 23, 22, 22, 20, 17, 14, 11, 9, 6, 4, 2, -1, -3, -4, -4,
--5, -6, -7, -8, -8, -8, -8, -7, -7, -7, -5, -4, -2, -1, 1, 2,
-3, 5, 7, 8, 9, 10, 11, 12, 13, 14, 14, 14, 14, 14, 13, 13,
-12, 11, 10, 8, 8, 6, 5, 4, 2, 1, -1, -2, 0, 3, 5, 7,
-9, 11, 14, 16, 18, 19, 19, 20, 21, 22, 24, 24, 24, 25, 25, 26,
-26, 25, 23, 21, 20, 18, 16, 14, 11, 9, 7, 6, 4, 2, 0, -2,
--4, -5, -7, -8, -10, -11, -12, -12, -12, -11, -11, -11, -11, -10, -8, -8,
--7, -6, -5, -3, -1, 0, 2, 3, 4, 6, 7, 9, 10, 10, 11, 11,
-12, 12, 12, 12, 11, 11, 11, 10, 10, 12, 15, 17, 18, 20, 22, 24,
-25, 25, 25, 25, 25, 24, 24, 24, 24, 22, 22, 22, 21, 20, 19, 17,
-15, 13, 11, 9, 7, 5, 3, 2, 0, -1, -2, -4, -5, -6, -6, -7,
--8, -9, -9, -9, -8, -8, -7, -7, -6, -5, -4, -3, -2, -1, 0, 1,
-3, 4, 4, 5, 6, 7, 9, 9, 10, 10, 11, 11, 11, 11, 11, 11,
-10, 10, 9, 9, 8, 9, 12, 14, 15, 17, 20, 22, 24, 25, 27, 27,
-27, 27, 27, 27, 27, 27, 26, 26, 26, 25, 24, 23, 21, 19, 17, 15,
-13, 10, 8, 6, 4, 3, 1, -1, -3, -4, -5, -6, -7, -9, -9, -10,
--10, -10, -10, -10, -9, -9, -8, -7, -6, -5, -4, -3, -2, 0, 1, 2,
-3, 4, 5, 7, 7, 8, 9, 9, 10, 10, 10, 10, 10, 10, 9, 9,
-8, 8, 11, 13, 14, 16, 19, 21, 23, 25, 27, 27, 28, 28, 28, 28,
-28, 28, 27, 26, 26, 25, 24, 23, 21, 19, 17, 15, 13, 11, 8, 6,
-4, 2, 0, -2, -4, -5, -6, -7, -9, -10, -11, -11, -12, -12, -12, -12,
--11, -11, -10, -9, -8, -7, -6, -5, -4, -3, -1, 0, 1, 2, 3, 5,
-6, 6, 7, 8, 8, 9, 9, 9, 9, 9, 9, 9, 8, 7, 8, 10,
-11, 13, 14, 16, 19, 21, 22, 24, 25, 26, 26, 27, 27, 27, 26, 26,
-25, 25, 23, 22, 20, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1, -1,
--3, -5, -6, -7, -8, -9, -10, -11, -11, -12, -12, -12, -12, -11, -11, -10,
--9, -9, -8, -7, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6,
-6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 9, 10, 11, 13, 15,
-17, 19, 21, 23, 24, 26, 27, 28, 29, 29, 28, 28, 27, 27, 26, 24,
-23, 21, 19, 17, 15, 13, 11, 8, 6, 4, 2, 0, -2, -4, -6, -7,
--8, -10, -11, -11, -12, -12, -12, -13, -13, -12, -12, -12, -11, -10, -10, -9,
--8, -7, -6, -5, -4, -3, -2, -2, -1, 0, 1, 2, 2, 3, 3, 3,
-4, 4, 4, 5, 5, 5, 6, 7, 9, 10, 12, 14, 16, 18, 21, 22,
-24, 25, 27, 28, 29, 29, 29, 29, 29, 28, 27, 26, 24, 23, 21, 19,
-17, 15, 12, 10, 8, 6, 4, 2, 0, -2, -4, -5, -7, -8, -9, -10,
--10, -11, -12, -12, -12, -12, -12, -11, -11, -10, -10, -9, -8, -8, -7, -6,
--5, -4, -3, -3, -2, -1, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2,
-2, 2, 3, 4, 5, 6, 7, 9, 10, 12, 13, 14, 15, 16, 17, 18,
-18, 19, 19, 19, 19, 19, 18, 18, 17, 16, 16, 14, 13, 12, 11, 10,
-9, 7, 6, 5, 4, 3, 1, 0, -1, -2, -2, -3, -4, -4, -5, -5,
--5, -5, -5, -5, -5, -5, -4, -4, -4, -3, -3, -2, -1, -1, 0, 1,
-1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6, 7, 8,
-8, 9, 10, 11, 12, 13, 14, 14, 15, 15, 16, 16, 16, 16, 16, 16,
-16, 15, 15, 14, 14, 13, 13, 12, 11, 10, 9, 8, 7, 7, 6, 5,
-4, 3, 3, 2, 1, 1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-0, 0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 4, 5, 5, 5,
-6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 9, 10, 10,
-11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 10, 10,
-10, 9, 9, 8, 8, 7, 7, 7, 6, 6, 5, 5, 4, 4, 4, 3,
-3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 4, 5, 5, 5, 6, 6, 7, 7, 7, 7, 7, 7,
-8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 6, 6, 6, 5,
-5, 5, 5, 4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 2, 1,
-1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-0, -1, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 1,
-1, 2, 2, 2, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5,
-5, 5, 5, 5, 5, 5, 4, 5, 5, 4, 4, 4, 4, 4, 3, 3,
-3, 3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
-3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
--1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, 0, 1, 0, 1, 1, 1, 1, 1, 2, 1, 1,
-1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0,
-1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0
-};
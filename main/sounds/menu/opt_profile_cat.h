@@ -1,215 +0,0 @@
-// TTS sound: opt_profile_cat
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_profile_catSampleRate = 11025;
-const unsigned int menu_opt_profile_catSampleCount = 3320;
-const signed char menu_opt_profile_catSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, -1, 0, -1, -3, 1, 0, -2, 1, -2, -2, -1, -1,
-1, -1, 1, 0, -2, 3, 0, 0, 2, -2, 0, 0, 3, -2, 1, 0,
-0, -3, 0, -2, 1, -4, 0, 0, 0, 0, -2, 0, 1, 2, -2, 0,
-0, 0, -2, 1, 1, 1, 1, 2, 0, 1, 1, 3, -6, 2, 0, -2,
--4, 4, -3, -2, 0, 2, -5, 0, 1, -2, 2, -1, 3, 1, 2, 2,
-1, 2, -1, -2, 3, -1, -2, -1, 5, -3, -2, 3, 0, -2, 4, -2,
-2, 1, -2, 0, 2, -3, -2, 5, 0, -3, 4, 1, -1, 1, 3, 0,
--5, 2, 3, -4, -1, 2, 3, -6, 2, 4, -3, 3, 2, -1, 3, 0,
--2, 3, -1, -2, 1, 4, -4, 0, 4, -2, 1, 1, 3, -4, -3, 3,
--1, -8, 6, -1, -5, 4, 0, -1, 2, -1, 1, -2, 3, -3, 0, 1,
-0, -2, 4, 2, -3, 7, 1, 0, 1, 1, 1, 2, -3, 0, -1, 0,
--3, -2, 1, -2, -1, 1, -1, 2, 0, 3, -6, 4, 5, -4, 1, 8,
--1, -3, 5, 5, -6, 3, 2, -3, 1, 1, 2, -2, 3, 1, 1, -2,
-3, -6, 3, -4, 0, -1, 1, 3, -2, -3, 6, -4, 0, 3, -1, -4,
-4, 0, -2, 4, 2, 1, -1, 4, -1, 2, -4, 6, -5, 1, -1, 1,
--4, 3, 4, -4, -2, 8, -4, -2, 1, -1, 2, -9, 6, -4, -2, -2,
-5, -5, 4, -3, 4, -5, -1, 1, -2, -2, 5, -8, 6, 0, 0, -2,
-6, -1, -4, 2, 2, -4, 1, 2, -3, 3, 1, 2, -2, 3, 4, -5,
--3, 9, -3, -2, 3, 5, -5, 0, 7, -4, -2, 4, -1, -3, 3, 3,
--1, -1, 5, 2, -4, 4, -3, 0, -1, -1, -1, -1, 4, 1, -7, 6,
-0, -2, -1, 3, -5, 1, 4, -5, 0, 6, 2, -7, 2, 5, -3, 0,
-3, -2, 4, 1, 0, -2, 4, 1, -3, -1, 4, 1, -1, 2, 2, 1,
-3, 2, -2, 0, -1, 2, -5, -1, 1, 1, 2, -2, -1, 4, -1, 0,
-0, -1, -2, 3, 1, -5, 4, 4, 1, -6, 5, 1, -1, -1, 0, -3,
-0, 0, 1, -5, 7, 0, -1, 0, 0, 5, -8, -1, 0, -2, 0, 0,
--2, 1, 2, 5, -3, 1, 3, -3, 1, 0, -3, -2, 1, 3, -7, 0,
-5, -2, 1, -3, 5, -1, -1, 5, -4, 2, 4, 1, 3, 1, 3, 3,
--2, 3, -2, 2, -1, -4, 4, -2, 3, 0, -3, 6, 1, -2, 2, -2,
-3, -4, 1, -1, -3, 3, 0, -2, 0, 3, 11, 3, 0, 6, 7, 6,
--1, 1, 4, 3, 2, 2, 0, 5, 2, 6, -1, 0, 3, 2, -2, -4,
--2, 1, -5, -1, -2, -2, 0, -2, -1, -5, -2, 1, -6, -3, -2, -3,
--1, -2, -3, -1, -3, 2, -1, -2, 0, -1, 2, -3, 0, 2, -1, 2,
-0, 2, 1, 1, 3, 1, 0, 3, 4, 18, 9, 9, 15, 19, 17, 10,
-9, 13, 7, 9, 5, 4, 6, 8, 9, 5, 4, 8, 5, 2, 0, -3,
-0, -5, -6, -6, -7, -6, -5, -6, -6, -8, -2, -2, -6, -6, -3, -3,
--4, -5, -2, -6, -1, 0, -1, -3, 0, 4, 0, 1, 2, 2, 3, 1,
-4, 1, 0, 6, 2, 2, 2, 12, 26, 19, 19, 28, 31, 31, 22, 22,
-19, 13, 18, 10, 8, 8, 10, 15, 9, 7, 10, 7, 7, 0, -3, -4,
--8, -7, -9, -12, -11, -9, -6, -8, -10, -7, -9, -9, -9, -10, -11, -10,
--8, -7, -8, -4, -2, -1, 1, 1, 2, 1, 3, 5, 1, 3, 4, 5,
-5, 5, 7, 6, 6, 9, 23, 34, 30, 33, 37, 42, 37, 28, 25, 17,
-16, 13, 11, 5, 6, 12, 14, 8, 7, 2, 0, -4, -11, -14, -20, -20,
--16, -18, -17, -15, -12, -7, -10, -8, -12, -12, -10, -12, -11, -11, -9, -3,
--3, 1, 5, 3, 8, 6, 7, 4, 5, 5, 4, 5, 6, 5, 8, 8,
-10, 8, 7, 7, 9, 27, 40, 35, 34, 39, 45, 37, 24, 19, 11, 7,
-6, 4, 2, 0, 5, 11, 8, 3, -2, -1, -7, -13, -15, -20, -20, -16,
--13, -8, -12, -7, -2, -2, -6, -6, -9, -7, -11, -5, -5, -6, -1, 3,
-5, 8, 4, 7, 5, 5, 2, 2, 1, 1, 2, 5, 4, 5, 5, 7,
-6, 3, 2, 0, 15, 42, 43, 35, 32, 34, 35, 18, 11, 0, -9, -3,
-5, 8, 5, 3, 16, 14, 11, 1, -8, -14, -15, -14, -12, -19, -11, -5,
-3, 3, 0, 0, -3, -5, -5, -8, -12, -11, -6, 2, 1, 4, 5, 7,
-7, 6, 2, -2, -6, 1, -2, -1, 1, 3, 4, 7, 7, 6, -3, -1,
-0, -2, -6, 3, 37, 63, 60, 52, 46, 42, 31, 15, 2, -14, -18, -4,
-13, 16, 11, 16, 23, 16, 7, -4, -19, -28, -25, -15, -13, -16, -5, 7,
-9, 10, 5, -2, -11, -13, -9, -12, -16, -9, 1, 6, 10, 12, 9, 5,
-2, 2, -4, -10, -8, -3, 3, 3, 6, 8, 7, 6, 5, 2, -5, -8,
--3, -4, -5, 5, 39, 69, 66, 52, 42, 35, 25, 6, -5, -17, -21, -6,
-15, 21, 17, 15, 21, 14, 5, -10, -22, -30, -26, -14, -8, -6, 1, 8,
-14, 12, 4, -4, -14, -17, -11, -10, -10, -6, 3, 11, 13, 12, 7, -1,
--4, -3, -6, -9, -9, -3, 3, 9, 9, 7, 5, 3, 1, 0, -5, -9,
--6, -2, -1, 8, 39, 70, 66, 51, 38, 31, 18, 2, -7, -16, -21, -6,
-16, 25, 19, 16, 17, 10, 0, -9, -22, -31, -26, -12, -1, -2, 4, 10,
-11, 10, 3, -5, -13, -17, -9, -5, -4, -1, 7, 12, 10, 11, 8, -3,
--7, -5, -4, -7, -5, 0, 4, 5, 9, 9, 3, -2, -2, -2, -6, -7,
--4, 1, -1, 2, 15, 50, 70, 59, 42, 32, 20, 12, 0, -9, -19, -15,
-2, 20, 25, 18, 12, 10, 5, -4, -14, -25, -28, -15, 0, 8, 9, 7,
-10, 11, 5, -1, -11, -17, -16, -9, 2, 2, 3, 9, 10, 11, 8, -1,
--7, -10, -7, -5, -3, 1, 1, 4, 10, 9, 4, 0, -5, -6, -5, -3,
--4, -2, 0, 3, 6, 20, 57, 68, 53, 34, 24, 18, 6, -4, -8, -19,
--13, 9, 23, 21, 13, 9, 4, -4, -6, -14, -26, -25, -13, 1, 6, 6,
-9, 4, 4, 5, -4, -11, -16, -14, -3, 1, 5, 8, 5, 8, 8, 6,
-0, -9, -8, -6, -4, 2, 2, 2, 4, 7, 7, 3, -2, -4, -7, -4,
--3, 0, -1, 0, 4, 4, 7, 38, 67, 56, 33, 21, 13, 5, -3, -4,
--12, -17, 0, 21, 25, 19, 7, 4, -4, -9, -8, -17, -26, -18, -2, 10,
-8, 9, 8, -1, -1, 2, -6, -15, -16, -6, 1, 5, 9, 8, 5, 3,
-5, 4, -6, -9, -9, -3, 1, 4, 6, 4, 2, 6, 4, 0, -4, -7,
--7, -5, -1, 3, 2, 1, 3, 4, 4, 28, 61, 57, 35, 23, 15, 6,
--3, 0, -6, -18, -6, 17, 22, 19, 11, 4, -7, -9, -6, -13, -21, -19,
--7, 6, 9, 10, 8, -3, -3, 0, -3, -11, -14, -9, -1, 4, 12, 9,
-3, 2, 3, 3, -3, -8, -7, -7, -1, 7, 6, 6, 2, 2, 3, 0,
--2, -4, -9, -3, -1, 4, 4, 1, 4, 2, -2, 7, 31, 55, 47, 32,
-23, 9, 5, 1, 0, -9, -15, -1, 14, 18, 19, 10, 2, -7, -8, -4,
--14, -19, -15, -5, 4, 9, 10, 7, -4, -1, -1, -4, -9, -11, -7, -2,
-3, 11, 9, 2, 2, 3, 0, -4, -5, -5, -6, -2, 7, 6, 3, 4,
-2, 1, -1, -2, -3, -5, -5, 0, 3, 4, 1, 3, 2, -1, -1, 14,
-42, 48, 38, 29, 15, 8, 4, 2, -2, -13, -8, 6, 15, 19, 14, 8,
--2, -8, -3, -10, -15, -16, -12, -1, 5, 9, 10, 0, -2, -2, -3, -7,
--11, -6, -7, -1, 8, 9, 6, 2, 2, 3, -5, -2, -3, -7, -4, 2,
-6, 5, 2, 6, 1, -2, 1, -4, -3, -5, -2, 2, 2, 2, 4, 0,
-3, -2, -1, 6, 33, 46, 40, 29, 20, 8, 5, 1, 3, -8, -9, 5,
-14, 16, 18, 11, 1, -8, -4, -6, -15, -14, -10, -4, 1, 9, 12, 0,
--3, -1, -5, -7, -9, -7, -7, -5, 7, 10, 4, 5, 3, -2, -3, -2,
--3, -7, -5, 3, 3, 5, 6, 3, 1, -1, 0, -1, -5, -4, -2, 0,
-2, 4, 4, 0, -2, -3, -4, 1, 24, 41, 35, 28, 21, 12, 6, 4,
-4, -5, -10, 2, 11, 14, 16, 13, 4, -5, -3, -3, -11, -13, -10, -5,
--2, 6, 10, 3, -2, -2, -3, -7, -8, -7, -6, -6, 2, 8, 5, 4,
-4, 0, -2, -3, -1, -5, -5, 0, 3, 4, 6, 3, -1, -4, -2, -2,
--4, -3, -3, -1, 0, 5, 4, 1, 0, 0, -3, -2, 4, 27, 38, 34,
-29, 20, 10, 6, 3, 4, -5, -7, 4, 11, 15, 16, 13, 4, -6, -4,
--5, -11, -11, -10, -4, -1, 5, 10, 3, -2, -2, -5, -6, -9, -6, -6,
--5, 2, 8, 7, 6, 4, 0, -2, -4, -1, -5, -4, 0, 2, 4, 7,
-4, 5, -2, -1, -1, -3, -4, -1, -1, 1, 2, 6, 3, 0, 1, -1,
--3, -3, 12, 32, 34, 31, 25, 13, 7, 5, 7, 0, -6, -2, 6, 11,
-17, 16, 8, -2, -4, -3, -8, -9, -9, -8, -4, 2, 8, 7, -1, -1,
--4, -6, -7, -5, -7, -7, -2, 5, 5, 5, 4, 1, -3, -3, -1, -4,
--3, -2, 1, 2, 5, 6, 3, -1, 1, -2, -2, -1, -2, -2, 1, 2,
-3, 4, 2, 0, -1, 0, -3, 1, 20, 33, 30, 27, 19, 11, 4, 7,
-7, -2, -5, 2, 8, 13, 17, 14, 4, -4, -1, -5, -7, -8, -9, -7,
--3, 5, 8, 2, 1, -3, -6, -6, -5, -4, -9, -5, 0, 3, 5, 5,
-2, 0, -4, 0, -2, -4, -3, -1, 0, 3, 7, 5, 1, 0, 1, -2,
--2, -1, -1, -3, 0, 3, 4, 2, 4, 2, -1, -1, 0, 4, 14, 17,
-16, 13, 10, 10, 8, 7, 4, -2, -2, 2, 4, 7, 6, 5, 2, 0,
-2, 0, -4, -5, -7, -6, -2, 1, 0, -1, 0, -1, -1, -1, -1, -5,
--5, -4, -2, -1, 1, 1, 0, 0, 3, 1, 0, 0, -2, -3, -1, 0,
--1, 0, 2, 4, 3, 4, 3, 1, -1, -1, -2, -2, -1, 0, 1, 4,
-5, 5, 5, 3, 2, 0, 0, -1, -1, 1, 2, 2, 2, 4, 4, 3,
-3, 0, 0, 1, 5, 5, 2, 2, 3, 6, 9, 8, 9, 7, 9, 10,
-8, 7, 4, -1, 0, 0, 0, 1, 0, 2, 0, 2, 4, 3, 1, 1,
--1, 0, -1, -1, -1, -3, -2, -1, -1, 1, 1, 0, -2, -2, -1, -2,
--2, -2, -4, -3, 0, 1, 1, 2, 2, 0, 2, 5, 3, 1, 1, 1,
-1, 2, 4, 4, 0, 2, 4, 3, 2, 1, -1, -2, 0, 2, -2, -2,
--2, -3, -1, 0, 0, -2, -3, -1, -1, -2, -1, -3, -4, -3, -1, 0,
--1, -1, 0, 0, 1, 3, 2, 1, 1, 2, 2, 2, 3, 2, 2, 2,
-3, 2, 2, 1, 2, 3, 3, 3, 2, 1, 0, 0, 0, -1, -2, -2,
--2, -3, -2, -1, -2, -3, -2, -3, -3, -2, -1, -3, -3, -2, -2, -2,
--2, -2, -2, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0,
-0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 2, 2, 2, 1, 1,
-2, 2, 2, 2, 1, 1, 0, 1, 1, 0, -1, -2, -2, -1, -1, -2,
--3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1,
--1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 0, 0, 1, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1,
-0, 1, -1, 0, -1, 0, 2, -1, -1, -1, 0, 0, 0, 2, -1, 0,
-1, 0, -1, -1, -1, 1, 0, 1, 0, 1, 0, 2, 0, 0, -2, 0,
-0, 1, 0, 1, 0, 1, 0, -1, -2, -1, 0, -1, 0, -1, 2, 0,
-1, 1, -1, 1, 1, -4, 5, -3, -1, 0, -2, 2, -3, 0, 1, -7,
-5, -1, -3, 2, -6, 6, -6, 5, 2, -3, 4, 0, 1, -2, -5, 1,
--2, -2, 3, -1, -1, -2, 0, -2, -4, -1, -1, -2, 2, 0, 1, 3,
--1, 4, 0, 3, -1, 3, -1, 4, 1, 3, 2, 2, 3, 2, 1, -2,
-2, -1, 1, -2, 0, -1, -3, 3, -2, -3, -1, -5, 1, -3, 0, -3,
--2, 3, 1, 0, 4, 0, 2, 2, 3, 0, 0, 3, 1, 1, 2, -1,
-3, 0, 2, 2, -3, 4, -3, 2, -1, -2, 1, -3, 0, 0, -1, -1,
--1, 0, 2, -2, -1, -1, -1, 1, 0, -2, 2, -4, 4, 1, -3, 3,
--6, 5, -4, 3, 2, -5, 4, 1, 0, 0, -5, 3, -2, -1, 2, -3,
-0, -2, 1, -1, -3, 0, 0, -2, 3, -1, 0, 1, 0, 2, 0, 2,
--1, 1, 0, 2, -1, 2, 0, 0, -1, 2, -2, 2, -2, 3, -1, 0,
-3, -3, 2, -2, 1, 0, -2, 1, 0, -1, 1, -2, 1, -2, 2, 0,
--2, 0, 2, 0, -1, 1, 1, -1, 1, 3, 0, -2, 2, 0, 0, -1,
-1, 0, -2, 1, 3, -4, 1, -1, 1, -1, 0, 3, -3, 0, 1, 2,
--1, -1, 2, -1, -1, 3, -1, -1, -1, 4, -1, -1, 2, 0, -1, 0,
-2, -1, -1, 3, 0, -3, 2, 1, 0, -2, 2, 1, -3, 3, 1, -3,
--1, -1, 1, -2, 0, 1, -3, 2, 2, -1, 1, 1, 2, -1, 1, 1,
--1, 1, 1, 0, 0, -1, 2, 0, 0, 2, -1, 0, 0, 1, 0, -2,
-1, 0, -2, 2, -1, 1, -2, 2, 1, -2, 1, 0, 0, 1, 1, 2,
--4, 1, 1, 1, 1, -1, 2, -1, 2, 3, -2, 0, 0, 0, 1, -3,
-1, -2, 1, 1, 0, 1, -2, 1, 2, -1, 1, -2, 1, -1, 0, 3,
--2, 0, -1, 2, 0, -1, 1, -2, 0, 1, 0, -1, -2, 2, -1, 0,
-2, -1, -1, 0, 1, 0, -2, 2, -2, -1, 1, 0, -1, -1, 1, 0,
--1, 1, -1, 0, 0, 1, 1, -2, 1, 1, 0, 1, 0, 1, -2, 0,
-1, -1, 0, -1, 1, -1, 0, 2, -1, 0, 0, 1, 0, -1, 1, -1,
--1, 0, 0, -1, -1, 1, 0, -1, -1, 0, -1, -1, 1, 0, -1, 0,
-0, 1, 0, 1, 1, -2, 0, 0, 1, 0, -1, 1, -1, 0, 1, -1,
-0, -1, 0, 0, -1, 1, -1, 0, 0, 0, 1, -1, 0, 0, 0, 0,
-0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1,
-1, 0, 1, 0, 0, 1, 1, 1, -1, 0, 0, 0, 1, 0, 0, -1,
-0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1,
-0, -1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, -1,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1,
-0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, -1,
--1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0
-};
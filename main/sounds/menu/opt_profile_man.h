@@ -1,240 +0,0 @@
-// TTS sound: opt_profile_man
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_profile_manSampleRate = 11025;
-const unsigned int menu_opt_profile_manSampleCount = 3722;
-const signed char menu_opt_profile_manSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 1,
-1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 10,
-10, 11, 12, 12, 12, 12, 12, 12, 11, 10, 10, 8, 7, 6, 4, 4,
-2, 1, 0, -1, -2, -3, -5, -5, -5, -6, -6, -6, -7, -6, -6, -6,
--5, -5, -5, -4, -4, -4, -3, -3, -2, -2, -1, -1, -1, -1, 0, 0,
-0, 0, 0, 0, 0, -1, 1, 6, 10, 14, 17, 20, 23, 25, 28, 33,
-37, 39, 41, 41, 40, 39, 37, 37, 36, 34, 31, 27, 22, 18, 13, 10,
-7, 3, -1, -4, -9, -12, -15, -17, -17, -18, -19, -19, -20, -20, -20, -19,
--17, -15, -14, -12, -11, -10, -8, -7, -5, -2, -1, 0, 2, 2, 3, 4,
-4, 6, 6, 6, 7, 6, 7, 14, 19, 24, 28, 30, 33, 36, 37, 42,
-46, 47, 50, 49, 47, 46, 42, 41, 41, 36, 33, 29, 22, 18, 12, 7,
-5, 0, -4, -7, -11, -15, -18, -21, -21, -21, -22, -22, -22, -23, -22, -21,
--19, -16, -14, -13, -10, -9, -7, -5, -4, 0, 2, 3, 5, 5, 5, 7,
-7, 8, 9, 9, 10, 9, 7, 10, 17, 22, 27, 30, 32, 34, 36, 38,
-43, 47, 48, 50, 49, 46, 44, 40, 39, 39, 34, 32, 27, 21, 16, 10,
-6, 4, -1, -4, -7, -12, -15, -18, -21, -20, -21, -21, -20, -21, -21, -20,
--20, -16, -14, -12, -8, -7, -6, -4, -2, 1, 4, 6, 8, 9, 10, 10,
-10, 11, 12, 12, 12, 12, 10, 10, 12, 19, 24, 28, 32, 33, 35, 36,
-37, 43, 45, 46, 48, 46, 44, 42, 37, 38, 37, 32, 31, 26, 19, 16,
-9, 5, 4, -1, -3, -6, -11, -14, -17, -19, -18, -19, -19, -17, -18, -18,
--18, -17, -14, -12, -10, -6, -5, -4, -2, -1, 1, 3, 5, 6, 8, 7,
-7, 8, 8, 8, 8, 8, 8, 7, 5, 7, 13, 20, 25, 29, 33, 34,
-36, 38, 43, 47, 49, 50, 51, 47, 43, 41, 39, 37, 34, 31, 28, 22,
-18, 15, 11, 9, 7, 4, 2, -2, -5, -7, -10, -11, -12, -14, -15, -18,
--20, -20, -21, -22, -21, -20, -21, -20, -20, -19, -18, -17, -14, -13, -13, -10,
--9, -8, -6, -5, -3, -1, -1, 1, 2, 2, 2, 7, 19, 31, 44, 47,
-47, 46, 44, 45, 44, 38, 33, 27, 20, 17, 14, 13, 14, 12, 12, 12,
-9, 7, 6, 2, -1, -6, -11, -15, -21, -25, -25, -28, -29, -27, -26, -25,
--23, -21, -18, -17, -16, -14, -14, -14, -13, -13, -12, -11, -8, -6, -4, 0,
-2, 5, 9, 11, 12, 15, 19, 20, 18, 19, 18, 15, 23, 46, 58, 56,
-57, 56, 53, 51, 51, 48, 34, 20, 16, 14, 6, 4, 4, 1, -2, 1,
-3, 2, -5, -7, -7, -15, -20, -21, -27, -33, -34, -31, -30, -30, -27, -21,
--18, -17, -12, -7, -9, -10, -6, -5, -7, -8, -4, -2, -3, 2, 7, 6,
-8, 13, 14, 14, 13, 15, 13, 9, 11, 10, 6, 6, 5, 5, 12, 35,
-53, 49, 45, 49, 48, 46, 43, 35, 18, 3, 3, 7, -1, -6, -5, -3,
-0, 6, 10, 3, -3, -3, -3, -7, -16, -21, -24, -27, -24, -20, -21, -20,
--15, -7, -5, -3, -4, -6, -4, -5, -5, -4, -12, -8, -3, -4, 1, 2,
-4, 8, 8, 12, 10, 7, 8, 4, 5, 4, 1, 1, -1, 3, 4, 0,
-10, 35, 53, 49, 42, 47, 49, 46, 40, 30, 11, -1, 4, 8, -2, -6,
--4, 2, 9, 11, 10, 4, -3, 1, 1, -9, -18, -24, -26, -20, -18, -18,
--19, -13, -5, -1, 2, 1, -5, 0, 1, -2, -6, -11, -5, -4, -5, 4,
-0, -1, 9, 10, 11, 5, 5, 9, 2, 2, 4, -6, 0, 0, 0, 3,
-0, 1, 4, 11, 44, 51, 38, 40, 46, 46, 45, 31, 20, 4, 2, 12,
-6, -7, -6, 2, 8, 10, 8, 3, -2, -1, 4, -8, -20, -17, -16, -16,
--15, -13, -13, -11, -1, 4, -3, -3, -1, 2, -2, -4, -5, -9, -6, 1,
--2, -2, 1, 5, 7, 6, 7, 5, 2, 6, 4, -1, -2, -1, 0, -1,
-3, 1, -2, 6, 4, -1, 17, 46, 48, 32, 41, 51, 43, 42, 34, 14,
-4, 13, 16, 0, -5, 5, 8, 11, 14, 8, 0, 4, 9, -4, -14, -14,
--17, -16, -12, -15, -16, -13, -2, 2, -5, -3, 1, -6, -1, -2, -9, -10,
--6, -1, -3, -6, 3, 3, 2, 10, 8, 0, 5, 6, 3, -1, -1, 2,
--1, 2, 4, -1, 2, 6, 6, 3, 0, 6, 31, 54, 39, 33, 48, 50,
-49, 42, 23, 10, 10, 22, 9, -8, 2, 7, 9, 17, 10, 2, 1, 9,
-5, -11, -18, -16, -15, -15, -14, -17, -17, -6, 0, -2, -6, -5, 0, -3,
--6, -5, -12, -11, -1, -2, -5, -3, 2, 5, 4, 6, 5, -1, 4, 6,
--1, -2, 2, 0, 0, 4, 4, 0, 3, 7, 3, 3, 1, 1, 24, 51,
-43, 34, 44, 50, 51, 42, 28, 13, 7, 17, 13, -3, -1, 4, 12, 15,
-11, 8, 2, 3, 7, -6, -16, -18, -17, -14, -15, -17, -14, -11, -1, 4,
--3, -4, -2, -2, -3, -4, -9, -14, -4, 1, -5, -1, 4, 3, 6, 11,
-7, 1, 3, 6, 2, -1, -1, 0, -1, 2, 6, 1, 2, 4, 6, 4,
-0, 0, 15, 47, 51, 29, 41, 49, 45, 46, 33, 11, 4, 17, 17, -1,
--3, 6, 6, 15, 18, 7, 3, 7, 8, 1, -15, -14, -14, -18, -11, -11,
--17, -11, -3, 3, -5, -6, 1, -8, -5, -1, -13, -12, -6, -3, -4, -3,
-5, 0, 2, 13, 4, 0, 6, 3, 1, 0, 2, -1, 0, 3, 5, 3,
-3, 6, 3, 3, 6, -2, -1, 20, 50, 47, 31, 42, 50, 43, 42, 31,
-9, -1, 15, 17, -4, -3, 10, 7, 13, 19, 8, -4, -1, 9, -6, -23,
--16, -17, -24, -10, -8, -19, -12, 1, 1, -5, -6, -3, -10, -7, -2, -12,
--14, -5, -2, 0, 1, 2, 5, 5, 10, 8, 1, 0, 5, 2, -1, 2,
-1, -1, 6, 8, 0, -1, 5, 1, 0, 3, -6, -5, 21, 54, 44, 29,
-44, 42, 41, 46, 23, 4, 0, 11, 15, -1, -1, 4, 9, 21, 17, 7,
-0, -3, 4, -5, -19, -21, -21, -17, -11, -9, -14, -12, 0, 2, -1, -7,
--7, -8, -9, -4, -9, -15, -5, -2, 1, 4, 2, 3, 5, 6, 8, 1,
--3, 1, 3, 0, 1, 3, 1, 2, 10, 7, 2, 4, 5, 2, 1, 2,
--2, -8, 15, 50, 47, 34, 43, 42, 40, 46, 30, 6, -2, 9, 12, 3,
-0, 5, 6, 17, 21, 11, -4, -1, 2, -6, -17, -19, -24, -20, -12, -7,
--14, -13, -2, 1, -2, -4, -7, -12, -11, -4, -9, -15, -6, -3, 1, 4,
-5, 5, 2, 10, 10, -1, 3, 1, -1, 4, 2, 3, 1, 5, 10, 5,
-6, 6, 2, 3, 2, 3, -4, -6, 7, 36, 54, 39, 36, 41, 40, 43,
-34, 13, -1, 0, 13, 8, 1, 3, 5, 13, 22, 14, 2, -3, -4, -4,
--10, -20, -25, -22, -15, -8, -11, -9, -8, -4, 2, -3, -9, -9, -15, -8,
--5, -12, -10, -4, 0, 3, 7, 7, 3, 5, 10, 5, 0, 0, 2, -2,
-4, 7, 1, 2, 10, 8, 5, 7, 5, -2, 3, 3, -2, -3, -5, 6,
-38, 53, 42, 38, 35, 38, 39, 31, 14, -2, -4, 10, 13, 4, 4, 8,
-12, 20, 17, 3, -5, -10, -5, -11, -20, -23, -21, -17, -6, -7, -7, -10,
--5, 0, -5, -9, -9, -18, -11, -5, -10, -9, -3, 0, 3, 8, 8, 3,
-3, 8, 5, 1, 1, 2, -2, 5, 9, 5, 5, 11, 7, 9, 9, 5,
--1, 3, 1, -1, 0, -2, -2, 14, 46, 52, 33, 37, 36, 29, 35, 27,
-5, -7, 2, 11, 8, 6, 9, 8, 10, 23, 15, -5, -7, -6, -11, -15,
--16, -21, -26, -11, -2, -9, -9, -3, -7, -5, -1, -9, -16, -14, -10, -10,
--11, -6, -4, -5, 5, 9, 3, 3, 6, 4, 2, 3, 3, -2, 0, 7,
-5, 4, 9, 8, 6, 9, 9, 4, 1, 2, 2, -2, 1, 1, -4, 5,
-35, 49, 37, 36, 35, 27, 31, 30, 16, -4, -3, 9, 6, 8, 12, 6,
-6, 17, 18, 4, -4, -5, -14, -18, -14, -18, -27, -19, -11, -10, -8, -5,
--7, -10, -7, -4, -12, -17, -12, -12, -13, -4, -2, -5, 0, 8, 8, 4,
-8, 7, 0, 3, 9, 1, -1, 7, 7, 4, 10, 12, 7, 7, 10, 9,
-2, 2, 5, -2, -2, 4, -1, -5, 5, 30, 45, 37, 34, 32, 22, 29,
-33, 15, 0, 0, 4, 7, 12, 15, 4, 4, 16, 15, 9, 2, -8, -13,
--12, -12, -12, -21, -20, -13, -9, -6, -4, -8, -10, -9, -6, -8, -14, -15,
--13, -11, -7, -2, -3, -3, 2, 7, 5, 6, 6, 0, 2, 6, 3, 3,
-4, 4, 6, 9, 11, 10, 5, 8, 9, 4, 5, 5, -1, -2, 3, 3,
--2, 0, 10, 30, 41, 36, 32, 24, 20, 26, 24, 13, 1, -2, 1, 7,
-13, 12, 5, 7, 10, 11, 10, -1, -10, -11, -15, -13, -10, -18, -19, -13,
--8, -5, -4, -5, -11, -11, -6, -9, -11, -13, -13, -11, -5, -1, 0, -2,
-2, 5, 6, 8, 6, 3, 0, 3, 7, 3, 5, 7, 4, 8, 12, 11,
-7, 7, 6, 5, 6, 5, 0, -1, 0, 2, 1, 0, 4, 18, 37, 37,
-32, 26, 20, 19, 23, 21, 7, -3, 1, 4, 8, 14, 11, 5, 7, 10,
-10, 5, -3, -9, -14, -13, -10, -12, -16, -15, -11, -9, -5, -4, -8, -11,
--10, -9, -10, -11, -11, -14, -11, -5, -2, -1, -1, 1, 3, 3, 7, 6,
-0, 2, 5, 2, 5, 9, 4, 5, 10, 11, 8, 10, 10, 4, 5, 8,
-4, 2, 1, 3, 0, 1, 4, 12, 28, 38, 34, 30, 25, 22, 23, 22,
-16, 4, -1, 2, 5, 10, 13, 8, 5, 6, 9, 7, 0, -5, -14, -18,
--13, -13, -16, -16, -16, -14, -9, -6, -5, -11, -12, -10, -12, -10, -10, -13,
--13, -9, -3, -1, 1, 1, 3, 4, 7, 9, 5, 4, 4, 5, 6, 8,
-9, 4, 7, 10, 9, 10, 10, 7, 3, 6, 6, 2, 2, 2, -1, -1,
-3, 0, 5, 25, 29, 27, 30, 23, 19, 21, 23, 14, 3, 4, 1, 3,
-11, 11, 6, 6, 8, 8, 8, 3, -2, -11, -12, -10, -13, -11, -12, -15,
--11, -7, -5, -6, -7, -9, -11, -9, -10, -13, -13, -12, -11, -7, -2, -2,
--1, 1, 1, 3, 3, 4, 2, -1, 2, 3, 2, 6, 7, 4, 9, 10,
-8, 9, 8, 6, 4, 5, 5, 2, 3, 2, 0, 3, 3, 1, 11, 26,
-28, 29, 31, 23, 22, 26, 22, 16, 7, 5, 4, 8, 13, 11, 9, 8,
-9, 9, 8, 4, -5, -9, -12, -11, -11, -11, -11, -15, -8, -5, -6, -3,
--8, -9, -11, -10, -8, -13, -9, -11, -10, -3, -2, 2, 1, 1, 3, 2,
-4, 3, 1, 0, 0, 3, 3, 6, 7, 5, 7, 9, 7, 6, 7, 3,
-2, 2, 3, 2, 2, 1, 2, 1, 4, 4, 10, 22, 23, 27, 26, 24,
-27, 25, 26, 19, 12, 12, 10, 13, 15, 14, 12, 9, 13, 12, 9, 7,
-0, -5, -6, -6, -8, -9, -9, -10, -8, -6, -4, -6, -7, -7, -12, -10,
--9, -11, -10, -11, -8, -7, -3, 0, -3, 1, 0, -1, 2, 0, 1, -1,
-0, 2, 1, 5, 4, 3, 5, 4, 6, 4, 4, 4, 0, 2, 1, 1,
-1, 1, 1, 0, 2, 1, 3, 13, 17, 20, 24, 24, 26, 29, 30, 28,
-22, 21, 20, 18, 20, 19, 16, 15, 15, 14, 14, 11, 9, 3, 1, 1,
--3, -3, -4, -8, -8, -9, -7, -8, -10, -8, -11, -11, -9, -9, -9, -9,
--8, -7, -6, -2, -2, -2, 0, 0, 1, 2, 4, 3, 2, 4, 4, 5,
-5, 5, 5, 4, 6, 4, 4, 4, 2, 2, 2, 1, 1, 0, 0, -1,
--1, -1, -1, 4, 10, 13, 17, 20, 22, 25, 27, 29, 27, 25, 26, 25,
-26, 27, 26, 24, 23, 23, 22, 19, 17, 13, 9, 7, 5, 2, 0, -2,
--4, -5, -5, -5, -6, -7, -8, -8, -8, -7, -6, -7, -6, -4, -3, -1,
-1, 2, 3, 4, 6, 6, 8, 9, 8, 8, 9, 10, 10, 10, 9, 8,
-8, 8, 7, 6, 5, 4, 2, 2, 1, 0, -1, -2, -3, -3, -4, -3,
-0, 4, 7, 9, 12, 16, 19, 21, 23, 23, 24, 25, 26, 27, 28, 29,
-29, 29, 29, 29, 27, 25, 23, 20, 18, 15, 13, 10, 7, 5, 3, 1,
--1, -3, -5, -7, -8, -9, -10, -11, -11, -12, -12, -10, -10, -9, -8, -8,
--6, -5, -3, -1, 0, 1, 3, 5, 6, 7, 9, 10, 11, 12, 13, 14,
-13, 14, 14, 13, 13, 13, 12, 11, 10, 9, 8, 7, 8, 11, 12, 14,
-16, 18, 20, 21, 22, 22, 22, 22, 22, 22, 23, 23, 23, 22, 23, 23,
-22, 21, 19, 17, 16, 14, 12, 10, 8, 6, 4, 3, 2, 0, -1, -3,
--4, -5, -6, -7, -8, -9, -9, -9, -9, -8, -8, -8, -7, -6, -5, -4,
--3, -2, -1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 10, 10,
-10, 10, 10, 9, 9, 9, 8, 7, 8, 10, 13, 15, 17, 20, 22, 25,
-27, 28, 28, 29, 29, 29, 29, 30, 29, 28, 28, 28, 28, 27, 25, 23,
-21, 19, 17, 14, 12, 9, 6, 5, 3, 1, -1, -3, -4, -6, -7, -8,
--9, -10, -11, -11, -11, -11, -11, -10, -10, -8, -7, -6, -5, -4, -3, -1,
-1, 2, 3, 5, 6, 7, 9, 10, 11, 11, 12, 12, 13, 13, 13, 13,
-12, 12, 11, 11, 10, 11, 13, 15, 17, 19, 21, 23, 25, 26, 27, 27,
-27, 27, 27, 27, 27, 26, 25, 25, 25, 24, 23, 21, 19, 17, 16, 14,
-11, 9, 7, 5, 3, 2, 0, -2, -3, -4, -5, -6, -7, -7, -8, -8,
--8, -8, -8, -8, -8, -7, -6, -5, -5, -4, -3, -2, -1, 0, 1, 2,
-3, 4, 5, 5, 6, 6, 7, 7, 8, 8, 8, 8, 8, 7, 8, 7,
-6, 7, 9, 11, 13, 15, 17, 20, 22, 24, 26, 27, 28, 28, 29, 29,
-29, 28, 28, 27, 26, 25, 24, 22, 20, 18, 16, 14, 12, 9, 7, 4,
-2, 1, -2, -4, -6, -7, -8, -10, -11, -12, -13, -13, -13, -13, -13, -13,
--12, -12, -11, -10, -9, -8, -7, -6, -4, -3, -2, -1, 0, 1, 2, 4,
-4, 5, 6, 6, 7, 7, 7, 7, 7, 7, 7, 6, 6, 5, 7, 8,
-9, 11, 12, 14, 17, 18, 21, 22, 23, 25, 25, 27, 27, 27, 27, 26,
-26, 25, 24, 23, 21, 20, 18, 16, 14, 12, 9, 8, 5, 4, 1, -1,
--3, -4, -6, -7, -8, -10, -11, -11, -12, -12, -12, -12, -12, -12, -11, -11,
--10, -9, -8, -7, -6, -5, -5, -4, -3, -2, -1, 0, 1, 2, 2, 3,
-3, 4, 4, 5, 5, 5, 5, 5, 5, 5, 7, 8, 10, 11, 13, 15,
-18, 20, 21, 23, 25, 26, 27, 28, 28, 28, 28, 28, 28, 27, 25, 24,
-22, 21, 19, 16, 14, 12, 9, 7, 5, 3, 0, -2, -4, -5, -7, -9,
--10, -11, -12, -12, -13, -13, -14, -14, -13, -13, -13, -12, -12, -11, -10, -9,
--8, -7, -6, -5, -4, -3, -2, -2, -1, 0, 1, 1, 2, 3, 3, 3,
-4, 4, 4, 4, 4, 5, 7, 8, 9, 10, 12, 14, 16, 18, 19, 20,
-22, 23, 24, 25, 25, 25, 26, 26, 26, 25, 24, 23, 22, 21, 20, 18,
-17, 15, 14, 12, 10, 9, 7, 5, 4, 2, 1, -1, -2, -3, -4, -5,
--6, -6, -7, -7, -7, -7, -7, -7, -7, -7, -6, -6, -6, -5, -5, -4,
--3, -2, -2, -1, 0, 0, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5,
-6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 16, 16, 17, 17, 17,
-17, 17, 17, 16, 16, 15, 14, 14, 13, 12, 11, 10, 9, 8, 7, 6,
-5, 4, 3, 3, 2, 1, 0, 0, -1, -1, -2, -2, -2, -3, -3, -3,
--3, -2, -2, -2, -2, -1, -1, 0, 0, 1, 1, 2, 2, 3, 3, 4,
-4, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8, 8, 9, 9,
-10, 10, 11, 12, 12, 12, 12, 12, 13, 13, 12, 12, 12, 12, 12, 12,
-11, 11, 10, 10, 10, 9, 8, 8, 7, 7, 6, 6, 5, 4, 4, 4,
-3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4,
-4, 4, 4, 5, 4, 4, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8,
-8, 8, 9, 9, 9, 9, 9, 8, 8, 8, 8, 8, 8, 7, 7, 7,
-7, 6, 6, 5, 5, 5, 5, 4, 4, 3, 3, 3, 3, 2, 2, 2,
-2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 2, 2, 3, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 5,
-5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4,
-3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
-0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1,
-1, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -2, -1, -1, -2, -1, 0, 0, 0, 1, 1, 1, 1, 2,
-1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0,
-0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -1,302 +0,0 @@
-// TTS sound: opt_profile_unimog
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_profile_unimogSampleRate = 11025;
-const unsigned int menu_opt_profile_unimogSampleCount = 4720;
-const signed char menu_opt_profile_unimogSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 1, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
--1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 5, 8, 5, 7, 4,
--1, 0, 0, 1, 0, -1, 0, -2, -1, 1, 2, 1, 0, 0, -2, -3,
--1, -1, -2, -1, -1, -1, -1, 1, 1, 0, 1, 0, 0, 1, 2, 1,
-0, 1, 0, 0, 1, 1, 2, -1, 1, 1, -2, 0, 2, -1, 0, -1,
-0, 0, -2, 2, -1, -2, 2, -2, -1, 1, 4, 19, 21, 17, 18, 5,
--2, 0, 0, 3, 0, -2, -2, -6, -2, 7, 6, 4, 2, -3, -8, -8,
--3, -4, -6, -3, -7, -5, -1, 1, 5, 2, 1, 0, -5, -1, -1, -1,
-1, -1, 0, 0, 3, 4, 4, 4, 2, 0, 0, -1, 1, 0, 0, 1,
--2, 1, 1, 1, 3, -1, 1, 0, -4, 3, 20, 33, 30, 29, 22, 1,
--1, 4, 5, 4, 0, -2, -9, -9, 7, 9, 8, 7, -2, -10, -13, -7,
--4, -12, -7, -6, -15, -6, 5, 3, 2, 5, 1, -8, -4, 3, -3, -4,
-2, -2, -5, 3, 8, 6, 5, 7, 3, -2, 1, 4, -1, -2, 1, -2,
--2, 1, 4, 3, 1, 2, 0, -3, -2, 14, 38, 39, 38, 35, 11, 3,
-7, 5, 8, 1, -5, -9, -12, 2, 12, 12, 13, 3, -7, -9, -8, -7,
--9, -12, -14, -18, -10, -1, 1, 6, 5, -1, -1, -4, -1, 2, -5, -5,
--3, -6, -1, 6, 8, 6, 6, 6, 3, 2, 4, 3, -2, -5, 1, -3,
--4, 8, 3, 0, 6, 1, -1, 3, 25, 52, 43, 40, 38, 9, 4, 11,
-12, 8, -5, -4, -9, -13, 11, 17, 9, 9, 0, -9, -12, -8, -5, -17,
--18, -15, -18, -10, 3, 5, 1, 0, 3, -6, -3, 5, -5, -8, -3, -5,
--4, 4, 10, 7, 5, 8, 6, 2, 4, 5, -1, -5, -1, -2, -2, 3,
-5, 6, 3, 5, 7, -2, 6, 38, 52, 44, 45, 35, 9, 3, 17, 16,
-1, -2, -3, -15, -7, 15, 15, 9, 5, -1, -9, -13, -6, -7, -20, -21,
--17, -15, -12, 2, 6, -3, -1, 1, -2, -1, -2, -1, -7, -12, -2, 1,
-0, 9, 7, 7, 5, 6, 10, 2, 1, 2, -6, -3, 0, 0, 2, 2,
-3, 3, 2, 5, 1, 11, 43, 51, 43, 44, 28, 8, 9, 18, 13, 0,
-1, -6, -14, 3, 17, 12, 9, 7, -3, -10, -7, -4, -13, -21, -18, -19,
--18, -5, 2, -1, -2, -1, 0, -3, -1, 1, -8, -9, -5, -7, 1, 4,
-6, 8, 5, 10, 9, 6, 9, 3, -1, -2, 0, 1, -2, 4, 5, -2,
-5, 8, 0, 3, 23, 48, 46, 44, 44, 20, 7, 16, 18, 10, 1, 0,
--8, -10, 8, 17, 11, 9, 5, -4, -9, -3, -7, -16, -18, -21, -20, -13,
--8, -2, -1, -6, -2, -2, -5, -2, -6, -10, -10, -10, -6, -4, 1, 3,
-2, 7, 7, 8, 9, 6, 4, 2, 1, 0, 1, 3, 1, 3, 6, 4,
-7, 6, 8, 31, 53, 47, 45, 42, 20, 13, 20, 22, 11, 0, 2, -8,
--6, 13, 15, 12, 7, 4, -1, -9, -1, -5, -21, -19, -22, -27, -20, -12,
--11, -14, -8, -3, -10, -2, 2, -9, -10, -8, -9, -9, -5, 0, -3, -1,
-7, 8, 8, 12, 12, 5, 5, 9, 4, 1, 7, 3, -1, 5, 8, 5,
-4, 17, 40, 47, 50, 51, 34, 20, 22, 22, 16, 10, 3, -7, -9, 2,
-12, 12, 10, 8, -1, -3, 2, -3, -11, -19, -25, -26, -25, -16, -11, -16,
--13, -9, -7, -2, 1, -1, -9, -11, -9, -9, -5, -3, -4, -4, -1, 6,
-9, 11, 13, 10, 6, 7, 9, 7, 5, 4, 2, 0, 4, 8, 6, 5,
-20, 45, 47, 48, 53, 32, 20, 29, 25, 15, 10, 7, -2, -5, 13, 17,
-9, 13, 12, 2, 2, 8, 0, -15, -18, -19, -27, -23, -11, -18, -20, -14,
--11, -8, -6, 0, -6, -16, -9, -9, -13, -6, -7, -10, -8, -2, 5, 6,
-9, 10, 6, 7, 9, 12, 7, 4, 7, 1, 1, 10, 8, 4, 9, 29,
-47, 48, 56, 55, 37, 39, 45, 35, 26, 17, 6, -3, 2, 13, 9, 5,
-8, 3, 2, 8, 8, -3, -14, -19, -24, -26, -23, -22, -29, -30, -23, -20,
--14, -7, -8, -14, -13, -9, -8, -9, -8, -9, -13, -10, 1, 2, 3, 8,
-8, 8, 13, 18, 14, 12, 13, 7, 7, 10, 8, 7, 3, 7, 24, 34,
-40, 44, 41, 39, 42, 46, 40, 30, 22, 12, 8, 11, 10, 7, 3, 2,
-2, 4, 9, 6, -1, -5, -10, -12, -12, -14, -20, -23, -24, -24, -19, -15,
--15, -16, -15, -13, -10, -8, -7, -8, -11, -11, -10, -6, -5, -3, -1, -2,
-1, 4, 5, 5, 4, 3, 2, 4, 4, 4, 3, 1, 6, 16, 23, 26,
-29, 31, 33, 37, 41, 39, 33, 31, 27, 25, 25, 25, 21, 16, 15, 14,
-13, 14, 11, 5, 2, 0, -2, -3, -4, -7, -11, -11, -10, -10, -9, -9,
--11, -12, -10, -8, -8, -7, -7, -9, -8, -6, -4, -5, -4, -4, -4, -2,
-1, 0, 1, 1, 1, 1, 3, 4, 2, 2, 2, 3, 10, 17, 20, 23,
-26, 30, 34, 38, 40, 37, 34, 33, 32, 31, 30, 27, 22, 19, 19, 18,
-15, 13, 8, 4, 2, 1, -1, -5, -7, -10, -11, -10, -10, -11, -12, -11,
--11, -10, -7, -6, -7, -6, -4, -3, -1, 1, 2, 1, 3, 5, 6, 7,
-8, 7, 6, 8, 9, 8, 7, 7, 5, 4, 5, 9, 15, 18, 22, 25,
-28, 33, 36, 37, 36, 34, 32, 31, 30, 29, 26, 23, 21, 19, 18, 16,
-14, 10, 7, 5, 3, 0, -2, -5, -7, -8, -9, -8, -9, -9, -9, -10,
--8, -7, -6, -5, -5, -4, -3, -1, 0, 1, 2, 2, 4, 6, 6, 6,
-7, 6, 6, 7, 7, 7, 6, 5, 4, 4, 6, 13, 18, 21, 25, 28,
-32, 36, 38, 39, 36, 34, 33, 31, 30, 28, 25, 23, 20, 19, 17, 15,
-12, 8, 4, 2, 0, -3, -6, -8, -10, -11, -10, -11, -11, -11, -11, -11,
--10, -8, -8, -8, -7, -6, -5, -3, -2, -1, 0, 1, 2, 4, 5, 5,
-5, 5, 5, 6, 6, 5, 5, 5, 4, 5, 13, 20, 23, 28, 32, 35,
-38, 42, 42, 39, 36, 35, 33, 31, 30, 26, 25, 23, 21, 23, 20, 16,
-14, 11, 7, 5, 3, -2, -7, -7, -9, -10, -10, -11, -12, -13, -12, -11,
--12, -11, -13, -13, -12, -12, -10, -11, -10, -8, -9, -4, -3, -4, -2, 0,
--1, 1, 3, 1, 1, 2, 4, 3, 3, 8, 29, 33, 37, 42, 45, 47,
-52, 48, 37, 32, 30, 25, 22, 21, 17, 11, 15, 20, 16, 17, 15, 8,
-6, 5, 1, -6, -11, -15, -20, -19, -16, -19, -20, -17, -17, -14, -11, -12,
--14, -15, -16, -14, -14, -15, -14, -16, -12, -8, -6, -2, -2, 0, 3, 3,
-6, 7, 2, 3, 4, 4, 4, 5, 6, 17, 38, 44, 44, 54, 57, 59,
-62, 59, 49, 36, 30, 31, 23, 18, 19, 12, 11, 19, 21, 18, 14, 10,
-6, 0, -1, -7, -19, -23, -25, -27, -24, -24, -24, -23, -21, -15, -13, -14,
--15, -16, -18, -17, -14, -16, -18, -15, -12, -11, -6, -2, -3, 0, 3, 5,
-6, 6, 6, 5, 4, 7, 7, 6, 7, 18, 39, 44, 46, 57, 59, 60,
-65, 63, 52, 38, 35, 33, 23, 22, 20, 12, 12, 18, 20, 18, 14, 11,
-7, 1, -1, -6, -18, -23, -25, -27, -26, -26, -24, -25, -24, -16, -13, -16,
--16, -17, -20, -18, -18, -18, -20, -20, -17, -12, -8, -4, -2, 1, 2, 7,
-9, 9, 8, 6, 6, 7, 7, 9, 8, 16, 38, 46, 48, 56, 60, 61,
-64, 64, 56, 43, 34, 32, 26, 22, 19, 15, 12, 13, 19, 20, 15, 12,
-8, 2, -2, -6, -12, -22, -27, -27, -28, -28, -26, -25, -25, -24, -19, -16,
--17, -17, -18, -20, -20, -19, -17, -19, -18, -15, -12, -7, -4, 0, 2, 2,
-6, 9, 9, 9, 9, 8, 8, 8, 9, 18, 34, 43, 46, 52, 57, 60,
-62, 61, 56, 46, 36, 33, 29, 24, 21, 18, 15, 14, 17, 20, 18, 15,
-12, 8, 4, 0, -3, -8, -16, -20, -21, -24, -23, -23, -23, -24, -24, -21,
--19, -19, -17, -19, -19, -19, -19, -17, -16, -17, -15, -14, -12, -8, -6, -3,
--2, -2, 2, 4, 4, 6, 7, 6, 7, 8, 17, 31, 37, 40, 45, 47,
-50, 54, 55, 53, 46, 38, 34, 31, 27, 25, 22, 16, 10, 9, 8, 8,
-7, 5, 2, -2, -4, -4, -4, -7, -9, -11, -15, -16, -16, -16, -16, -17,
--18, -18, -18, -16, -14, -15, -14, -14, -13, -11, -11, -9, -7, -8, -7, -6,
--5, -3, -2, -1, 0, 0, 0, 3, 3, 3, 5, 10, 25, 30, 37, 43,
-46, 51, 55, 60, 65, 66, 66, 65, 61, 59, 56, 52, 49, 43, 37, 31,
-24, 19, 15, 10, 5, 1, -4, -8, -11, -13, -15, -16, -18, -19, -19, -20,
--20, -19, -19, -17, -17, -17, -15, -15, -13, -11, -11, -9, -8, -8, -6, -5,
--4, -2, -2, -1, 0, -1, 0, 0, 0, 1, 1, 3, 8, 12, 16, 20,
-22, 26, 28, 31, 36, 38, 40, 42, 41, 41, 40, 38, 37, 35, 32, 29,
-24, 20, 16, 11, 7, 4, 0, -3, -7, -10, -12, -15, -16, -17, -18, -17,
--18, -18, -17, -17, -15, -13, -12, -10, -9, -8, -6, -5, -4, -3, -2, -1,
-0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 3, 9, 14, 18,
-22, 24, 28, 31, 34, 39, 43, 45, 47, 45, 44, 43, 40, 39, 38, 34,
-31, 25, 19, 14, 9, 5, 2, -2, -5, -9, -14, -16, -19, -20, -19, -20,
--20, -19, -20, -19, -18, -17, -13, -11, -9, -7, -6, -5, -2, -1, 1, 3,
-4, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 3, 4, 7, 12, 17,
-21, 24, 26, 28, 31, 34, 39, 42, 44, 44, 43, 42, 39, 37, 36, 34,
-31, 27, 22, 17, 11, 6, 3, 0, -3, -6, -11, -14, -17, -20, -20, -20,
--20, -19, -19, -20, -19, -18, -17, -14, -12, -9, -7, -6, -5, -4, -2, 0,
-2, 3, 4, 5, 5, 5, 5, 5, 6, 6, 6, 5, 4, 5, 9, 14,
-19, 22, 25, 28, 29, 32, 35, 39, 42, 44, 44, 43, 41, 38, 36, 35,
-33, 30, 27, 22, 17, 11, 7, 4, 1, -2, -5, -9, -12, -15, -17, -18,
--19, -18, -18, -18, -18, -17, -17, -15, -14, -12, -9, -7, -6, -4, -4, -2,
-0, 1, 3, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 5, 6, 11,
-16, 20, 24, 26, 28, 30, 32, 36, 40, 42, 44, 44, 43, 42, 39, 38,
-37, 34, 32, 29, 24, 20, 15, 10, 7, 3, 0, -3, -6, -10, -13, -16,
--17, -18, -18, -18, -18, -18, -18, -18, -16, -14, -13, -11, -9, -7, -5, -4,
--3, -1, 1, 3, 4, 5, 6, 6, 6, 7, 7, 7, 7, 7, 7, 9,
-14, 18, 22, 25, 27, 29, 30, 32, 35, 38, 39, 41, 40, 39, 37, 34,
-33, 31, 29, 27, 24, 20, 16, 11, 8, 5, 1, -1, -3, -6, -9, -12,
--14, -15, -16, -16, -16, -16, -16, -15, -15, -14, -13, -11, -9, -7, -5, -4,
--2, -1, 0, 2, 3, 4, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,
-11, 16, 20, 24, 27, 28, 30, 31, 33, 36, 38, 40, 41, 40, 38, 36,
-33, 32, 30, 27, 26, 22, 18, 15, 10, 6, 3, 0, -2, -4, -7, -9,
--12, -14, -15, -16, -16, -15, -15, -14, -14, -14, -12, -11, -10, -8, -7, -5,
--4, -3, -2, -1, 0, 1, 2, 3, 3, 4, 4, 4, 4, 5, 5, 4,
-5, 7, 16, 23, 28, 34, 36, 37, 38, 38, 40, 43, 43, 45, 44, 39,
-38, 32, 28, 26, 22, 20, 18, 13, 10, 6, 0, -2, -5, -7, -7, -9,
--11, -12, -14, -15, -15, -16, -15, -15, -16, -15, -15, -15, -14, -13, -12, -11,
--10, -8, -7, -6, -4, -3, -2, -1, 1, 2, 3, 4, 5, 5, 5, 6,
-7, 6, 8, 18, 29, 37, 45, 50, 48, 46, 42, 40, 40, 38, 38, 37,
-30, 25, 21, 14, 11, 9, 7, 6, 4, 0, -2, -8, -11, -12, -16, -19,
--19, -21, -24, -24, -24, -24, -24, -21, -19, -19, -17, -15, -15, -14, -11, -10,
--8, -5, -3, -1, 0, 3, 5, 6, 8, 10, 11, 11, 12, 13, 12, 12,
-13, 13, 11, 11, 18, 33, 44, 54, 62, 57, 46, 37, 33, 21, 17, 15,
-13, 12, 7, 7, 5, 2, 5, 6, 2, 1, -4, -13, -18, -23, -26, -24,
--22, -18, -14, -13, -11, -9, -10, -10, -9, -10, -11, -9, -9, -9, -7, -3,
--1, 1, 6, 8, 8, 9, 8, 7, 5, 5, 6, 4, 4, 7, 7, 6,
-8, 8, 6, 7, 6, 3, 7, 25, 40, 49, 59, 53, 30, 12, -1, -14,
--13, -1, 9, 13, 16, 17, 10, 2, 3, 2, -4, -2, -3, -14, -18, -19,
--23, -20, -12, -4, 1, 2, 4, 0, -9, -11, -12, -16, -12, -6, -5, -2,
-1, 3, 3, 3, 6, 7, 4, 5, 5, -1, -1, 0, -1, 1, 4, 8,
-9, 9, 10, 9, 3, 3, 1, -4, 1, 21, 38, 50, 64, 60, 36, 17,
-0, -16, -15, -2, 9, 18, 21, 21, 12, 2, 1, 1, -4, -1, 1, -9,
--15, -17, -22, -24, -14, -5, -1, 5, 8, 0, -9, -12, -16, -20, -12, -5,
--4, 0, 5, 2, 0, 2, 2, 3, 6, 7, 6, 3, 1, 0, -2, -1,
-4, 8, 8, 10, 9, 4, 0, 0, -2, -2, 1, 2, 11, 33, 46, 55,
-61, 44, 20, 5, -12, -18, -7, 5, 17, 25, 24, 19, 9, 0, -1, -4,
--5, -1, -4, -10, -13, -16, -18, -14, -6, 0, 3, 5, 2, -7, -14, -18,
--20, -17, -9, -2, 3, 6, 5, 1, -2, -4, -4, -1, 1, 2, 3, 2,
-0, 0, 1, 1, 5, 8, 6, 5, 4, 0, -3, -1, -1, 0, 3, 5,
-10, 29, 45, 53, 59, 47, 22, 4, -12, -19, -9, 6, 20, 29, 28, 22,
-10, -2, -5, -7, -8, -2, -3, -7, -8, -12, -13, -9, -4, 1, 3, 2,
--2, -9, -14, -14, -14, -9, 0, 2, 5, 6, 0, -2, -3, -6, -2, 1,
-1, 5, 4, 0, 1, 0, -1, 3, 5, 4, 5, 2, 0, -1, -3, -1,
-1, 0, 5, 4, -1, 10, 30, 40, 54, 61, 42, 19, 2, -15, -17, -3,
-16, 28, 33, 32, 19, -1, -7, -8, -12, -3, 7, 3, 0, -2, -11, -14,
--10, -4, 0, 2, 5, -1, -12, -11, -12, -15, -5, 4, 3, 5, 6, -2,
--7, -5, -6, -4, 2, 5, 4, 3, 1, -2, -3, -1, 2, 3, 4, 5,
-2, -1, -1, -2, 1, 3, 6, 7, 3, 1, 2, 13, 36, 50, 60, 60,
-34, 9, -9, -25, -16, 5, 19, 36, 39, 25, 10, -5, -15, -15, -9, 2,
-6, 4, 2, -7, -15, -12, -9, -5, 4, 6, 2, -4, -11, -15, -15, -10,
--1, 5, 7, 7, 2, -5, -8, -7, -5, -1, 6, 8, 5, 5, 2, -4,
--2, 1, 0, 4, 7, 3, 1, 1, -2, -3, 0, 3, 4, 2, 4, 1,
--4, 0, 17, 37, 51, 63, 58, 29, 5, -11, -27, -16, 9, 23, 36, 40,
-25, 5, -8, -14, -16, -8, 5, 7, 3, 2, -8, -17, -12, -9, -3, 5,
-5, 2, -5, -11, -13, -13, -8, 1, 5, 6, 6, 0, -6, -6, -6, -5,
-1, 7, 5, 4, 4, -2, -4, -1, 1, 1, 5, 7, 2, -1, 0, -2,
--4, 1, 4, 2, 3, 4, -1, -4, -2, 4, 25, 46, 56, 63, 48, 18,
--3, -19, -24, -5, 16, 31, 41, 33, 16, -2, -16, -20, -15, -4, 6, 7,
-5, -3, -14, -16, -14, -11, 0, 4, 2, 0, -9, -15, -15, -13, -5, 2,
-6, 8, 3, -3, -6, -10, -6, 0, 2, 8, 8, 3, 2, -2, -4, -1,
-2, 5, 6, 4, 4, -1, -4, 0, -1, -1, 6, 4, 2, 2, -1, -3,
--1, 11, 36, 49, 58, 60, 34, 7, -9, -23, -16, 6, 24, 38, 38, 25,
-9, -9, -15, -11, -6, 3, 11, 5, -3, -9, -15, -16, -10, -1, 3, 4,
-1, -6, -14, -17, -14, -9, -2, 5, 7, 3, -1, -5, -8, -8, -2, 2,
-3, 7, 6, -1, -1, -1, -3, -1, 3, 3, 1, 2, 1, -2, -2, 2,
-1, 1, 4, 3, -1, 0, -1, -2, -2, 1, 12, 32, 45, 55, 54, 34,
-10, -8, -19, -12, 4, 23, 35, 34, 25, 9, -7, -11, -9, -5, 5, 8,
-3, -3, -9, -15, -14, -8, -2, 3, 3, 0, -7, -15, -15, -14, -10, -1,
-3, 3, 4, -2, -6, -6, -7, -3, 2, 4, 5, 4, 1, -1, -2, -1,
-2, 4, 6, 6, 4, 1, -1, -1, 0, 1, 4, 4, 3, 3, 1, -3,
--2, 0, -1, 2, 18, 35, 42, 51, 47, 23, 3, -8, -16, -8, 12, 25,
-31, 29, 18, 3, -8, -8, -4, 0, 6, 6, -2, -10, -14, -15, -13, -5,
-3, 3, 0, -4, -13, -18, -16, -12, -6, 0, 4, 2, -2, -5, -7, -7,
--3, 2, 3, 4, 3, 1, -2, -2, 1, 2, 6, 7, 7, 4, 1, 0,
--1, 0, 4, 5, 4, 5, 3, -1, -1, -1, 0, 1, 2, 5, 17, 28,
-34, 38, 29, 15, 2, -7, -6, 3, 11, 19, 20, 13, 8, 1, -2, 1,
-2, 3, 3, -4, -9, -12, -13, -9, -4, 0, 3, -1, -5, -8, -14, -12,
--9, -7, -3, -1, -2, -3, -4, -4, -3, -1, 2, 2, 1, 2, -1, -2,
-0, 1, 4, 6, 5, 6, 4, 1, 3, 1, 3, 4, 3, 4, 3, 0,
-2, 1, 1, 3, 2, 0, 0, 0, 7, 22, 29, 35, 32, 19, 5, -4,
--6, -1, 8, 16, 17, 12, 7, 2, -1, 2, 5, 5, 3, -3, -9, -13,
--12, -8, -4, 0, 2, -2, -6, -9, -10, -10, -8, -5, -5, -5, -6, -5,
--4, -2, 1, 2, 1, 0, -1, -2, -1, 0, 2, 4, 4, 4, 3, 3,
-4, 4, 4, 4, 3, 3, 1, 2, 2, 1, 3, 4, 1, 1, 2, -1,
--1, -1, 4, 16, 25, 29, 30, 21, 10, 0, -3, 0, 6, 10, 13, 10,
-6, 3, 4, 6, 8, 8, 4, -4, -11, -13, -12, -7, -2, 1, -1, -4,
--7, -8, -8, -5, -4, -6, -7, -9, -10, -8, -4, 0, 2, 1, 1, -2,
--3, -2, 0, 1, 2, 2, 2, 1, 2, 4, 6, 6, 7, 5, 2, 2,
-2, 2, 3, 4, 4, 2, 2, 2, 1, 2, 3, 2, 1, 2, 9, 13,
-16, 19, 17, 12, 8, 6, 7, 7, 7, 8, 5, 2, 2, 2, 4, 5,
-6, 5, 0, -3, -4, -5, -4, -4, -3, -4, -6, -6, -6, -6, -4, -3,
--3, -5, -6, -6, -6, -5, -3, -2, -2, -2, -2, -2, -1, 0, 1, 2,
-2, 2, 1, 2, 3, 3, 4, 4, 4, 3, 3, 3, 4, 4, 4, 3,
-3, 2, 2, 2, 2, 2, 2, 1, 2, 5, 9, 11, 13, 13, 12, 9,
-8, 9, 9, 9, 8, 6, 4, 2, 3, 3, 3, 4, 3, 1, -1, -2,
--1, -1, -2, -2, -3, -5, -6, -6, -5, -5, -5, -4, -5, -6, -6, -5,
--4, -4, -3, -3, -4, -4, -3, -2, -2, -1, 0, -1, -1, -1, 0, 1,
-1, 2, 2, 1, 1, 1, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2,
-2, 2, 1, 2, 4, 7, 9, 10, 11, 11, 10, 10, 11, 12, 11, 11,
-9, 7, 5, 5, 5, 4, 3, 2, 0, -1, -2, -2, -2, -2, -3, -3,
--4, -4, -4, -4, -3, -3, -3, -3, -4, -4, -3, -3, -2, -2, -2, -2,
--2, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 1, 1, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3,
-3, 4, 4, 5, 5, 6, 7, 7, 8, 8, 8, 8, 8, 8, 8, 7,
-7, 6, 6, 5, 4, 3, 2, 2, 1, 0, 0, -1, -1, -1, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2,
--2, -1, -1, -1, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 5,
-5, 6, 6, 7, 7, 7, 8, 8, 8, 8, 7, 7, 7, 6, 6, 5,
-5, 4, 4, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
--2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2,
--2, -2, -1, -1, -1, 0, 0, 1, 1, 1, 2, 2, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 1, 1,
-0, 1, 1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, 0, 1,
-0, -1, -2, 0, 2, 1, 0, -2, -2, -1, -1, 0, 0, -2, -2, -1,
-1, 1, -2, -3, -2, 1, 1, 0, -3, -2, -2, 1, 1, 1, 0, -1,
-0, 1, 3, 2, -2, 0, 2, 4, 3, 3, 1, -1, 1, 3, 3, 1,
--1, -2, 2, 0, 3, 0, -2, -2, -2, -1, -1, 5, 3, -2, -2, -2,
-2, -1, -1, 0, -2, -2, 0, 0, -4, -2, 1, 2, -1, -2, -1, -7,
--4, -2, 2, 3, -1, -1, -1, 2, 0, 4, 0, -2, -4, 0, 2, 2,
-2, 1, -1, -3, -1, 1, 1, 1, -2, -1, 0, 5, -2, -2, 1, 3,
-3, 4, 3, -3, -2, 3, 4, 1, -2, -1, 2, 3, 5, 4, -1, -1,
-3, 3, 0, -6, -2, -3, 1, 1, 3, 4, 0, -3, -2, -1, 0, 2,
-1, -4, 0, 3, 2, 2, 1, 3, -3, -1, -1, 2, 0, -1, -2, -3,
-1, 2, -1, -2, 0, 1, 0, 1, 1, 2, -1, 3, 0, -3, -1, 1,
-0, 0, 0, -1, 0, -1, 2, 1, -2, -2, -1, 1, -1, 0, 0, 0,
--1, 3, 3, 0, 1, 2, 4, 1, 2, 0, 2, 0, 1, 3, -1, -1,
--2, 0, -3, 3, 4, -2, 0, 1, 6, 1, 1, 1, 3, 0, 2, 0,
-0, -2, -1, 1, 0, 2, 0, -3, -1, 0, 1, -1, 0, -3, 1, 2,
-0, 0, 0, 2, -1, 1, 0, 0, 0, -1, 0, -1, -1, 1, 0, 1,
-0, 0, -2, 3, 0, -1, -2, 0, 1, -2, -1, 0, -1, -1, -1, 0,
--2, -2, 0, 0, -1, -1, 0, 0, -1, 0, 1, 0, 0, 1, 2, 1,
-1, 1, 1, 0, 0, 1, 1, 0, -2, 1, 0, -1, 0, 0, 1, 0,
-0, 1, 1, -1, 0, 1, 0, -1, 0, 2, 0, 0, 0, 1, 0, 0,
-1, -1, -1, 0, 0, -2, -2, 0, -1, -2, -1, 0, -1, -2, 0, 0,
--2, -1, 0, 1, 0, -1, 1, 1, 0, 1, 2, 1, 0, 1, 1, 1,
-0, 1, 1, -1, 1, 1, 1, -1, 0, 1, -1, 0, 0, -1, -1, -1,
-0, -1, -1, -1, 0, 1, 0, -1, 1, 1, 1, 0, 0, 1, 1, -1,
-1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1,
-0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0,
-0, -1, 1, 1, -1, 0, 0, 1, 0, -1, 0, 0, -2, 0, -1, -1,
--1, 1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0,
-0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0,
-0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
-0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1,
-0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
-0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-};
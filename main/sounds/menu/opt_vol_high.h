@@ -1,190 +0,0 @@
-// TTS sound: opt_vol_high
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_vol_highSampleRate = 11025;
-const unsigned int menu_opt_vol_highSampleCount = 2918;
-const signed char menu_opt_vol_highSamples[] = {
--1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1,
--1, -1, 0, 2, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0,
-0, 0, 0, 0, 1, 0, -1, 0, -1, -1, 1, 1, 1, -1, 0, -1,
--2, -1, 0, 1, 2, 0, 1, 0, -1, 0, 0, -1, -1, -1, 0, 0,
-1, 2, 0, -1, -1, 0, -1, 1, 1, -1, -1, 0, 1, 1, 1, 0,
--1, -1, -1, -1, -1, -1, 1, 2, 1, 0, 0, 0, 0, 0, -1, -2,
--1, 0, 0, -1, 0, 1, 1, 1, -1, -2, -2, -1, 2, 1, 1, 1,
--2, 0, 0, 0, 1, -2, -1, 0, 1, 2, 0, -1, 0, -2, 0, -1,
-0, -1, -1, 0, 1, 1, 0, -2, 0, 1, 0, 0, -2, -1, -1, 0,
-2, 1, 1, 1, 0, 0, 0, 1, -2, -2, -1, 0, -1, 2, 1, 0,
--1, 0, -1, -2, -1, 1, 2, 1, 1, 2, 0, 0, 0, 0, -2, -4,
-0, 2, 1, 0, 2, 1, -1, 0, 1, 0, 1, 0, 1, 0, -2, -1,
-1, -1, 0, 2, 2, 0, 0, 1, 0, -1, 1, 2, -2, -4, 1, 1,
-0, 1, 1, -1, -2, 0, 1, -1, -2, 1, 0, 5, 8, 1, -3, -4,
--2, -1, -1, 2, 0, -1, 2, 2, 1, -1, -2, 0, -1, -1, 1, 0,
-0, 1, 2, 0, -1, -1, 0, -1, -1, 1, 1, -1, 1, 1, -1, 0,
-0, 0, 0, -1, 1, -1, 0, 1, 1, 0, 0, -1, 1, -1, 0, 1,
-0, 1, 0, 0, 0, 0, 0, -1, 0, 6, 8, 1, -1, -2, -3, -1,
-1, 3, -1, 0, 2, 2, 0, -1, -2, -1, -2, 0, 1, 1, 0, 1,
-1, 0, -1, -1, -1, -1, 0, 1, 1, 0, 1, 0, 1, 0, -1, 0,
-0, 0, 1, 1, 0, 0, 0, 1, -1, -1, 1, -1, 0, 1, 0, 0,
-0, 0, 0, 0, -1, 0, 0, 6, 9, 3, -1, -2, -2, -1, 0, 4,
-1, -1, 2, 2, 2, -2, -2, -1, -3, -2, 2, 0, 1, 0, 1, 0,
--3, -1, 0, -3, 0, 1, 2, 0, 0, 1, 0, -2, 0, 0, 0, 0,
-1, 2, 0, 0, 1, 0, -1, -1, 1, 0, -1, 2, 1, -1, 0, 1,
--1, -1, 0, 0, 0, 5, 11, 4, 0, -1, -2, -1, 1, 5, 2, -1,
-1, 4, 1, 0, -1, -2, -4, -1, 0, 2, 0, 1, 1, -1, -3, -1,
--2, -2, -1, 0, 0, -1, 1, 0, -1, -1, -1, -1, 0, 0, 1, 1,
-1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, -1, 0,
-0, -1, 1, 6, 11, 5, 1, 0, -2, -2, 3, 5, 2, 0, 2, 3,
-1, 0, 1, -2, -4, -2, 0, 0, -1, 1, 0, -3, -2, -2, -3, -3,
--2, -1, -2, -1, 0, 0, -1, -1, -1, 0, -2, 0, 1, 0, 1, 2,
-1, 0, 1, 1, 1, 0, 1, 2, 0, 2, 2, 1, 1, 0, 2, 0,
-0, 7, 11, 7, 5, 2, 0, -1, 1, 5, 3, 1, 1, 2, 3, 2,
-1, 1, -3, -4, -1, -1, -2, -1, -1, -2, -3, -2, -1, -3, -4, -2,
--3, -3, -2, 0, -2, -1, -1, -1, -2, -1, 0, 0, -1, 2, 1, 1,
-2, 1, 2, 1, 2, 2, 1, 2, 2, 1, 2, 2, 2, 1, 1, 8,
-17, 19, 17, 13, 10, 4, 5, 9, 11, 9, 8, 9, 8, 8, 9, 8,
-4, 0, -1, 0, -1, 0, 0, -2, -4, -4, -4, -4, -6, -6, -7, -8,
--8, -6, -6, -6, -6, -6, -6, -6, -5, -4, -4, -5, -3, -2, -3, -1,
-0, -1, 0, 1, 2, 1, 3, 6, 6, 5, 7, 6, 4, 11, 27, 31,
-30, 27, 23, 14, 11, 15, 18, 16, 14, 15, 15, 12, 14, 14, 8, 2,
--1, -2, -4, -4, -2, -3, -8, -8, -8, -9, -11, -11, -12, -15, -15, -13,
--12, -11, -11, -10, -9, -11, -9, -6, -6, -6, -5, -3, -3, -1, 2, 4,
-3, 4, 5, 5, 5, 6, 8, 7, 7, 8, 8, 15, 31, 37, 37, 33,
-24, 15, 9, 11, 17, 15, 14, 15, 13, 11, 11, 10, 7, -1, -6, -8,
--11, -10, -7, -8, -9, -11, -12, -12, -14, -14, -14, -16, -16, -15, -13, -11,
--9, -7, -6, -7, -5, -6, -6, -4, -4, 0, 2, 2, 6, 6, 6, 7,
-6, 7, 6, 6, 7, 7, 8, 7, 7, 15, 31, 40, 40, 36, 27, 12,
-3, 4, 10, 12, 14, 15, 13, 9, 8, 8, 5, -2, -7, -11, -14, -14,
--10, -8, -7, -7, -9, -12, -13, -14, -14, -14, -13, -13, -13, -13, -9, -7,
--5, -3, -1, -2, -3, -1, 0, -1, 2, 4, 6, 6, 6, 9, 7, 6,
-8, 8, 5, 6, 6, 6, 4, 12, 32, 43, 45, 43, 31, 13, -3, -5,
-3, 7, 12, 21, 18, 12, 7, 6, 3, -5, -8, -9, -16, -17, -16, -10,
--7, -5, -4, -8, -14, -16, -15, -16, -13, -9, -6, -5, -4, -1, 1, -1,
-0, -1, -2, -2, 0, 2, 4, 5, 8, 8, 7, 6, 6, 5, 3, 3,
-4, 3, 4, 4, 4, 13, 34, 50, 53, 48, 32, 8, -11, -15, -5, 5,
-15, 27, 24, 16, 10, 5, -2, -7, -11, -14, -19, -18, -11, -4, 1, 4,
-2, -4, -10, -15, -15, -15, -13, -8, -4, -1, 1, 4, 6, 4, 0, -1,
--4, -6, -4, 2, 4, 6, 8, 9, 7, 3, 4, 3, -1, -1, 0, 1,
-2, 3, 4, 13, 36, 57, 62, 53, 35, 6, -21, -26, -14, 4, 20, 32,
-34, 24, 13, 4, -4, -13, -19, -20, -20, -15, -5, 6, 12, 10, 5, -4,
--15, -20, -18, -15, -11, -4, 2, 4, 6, 9, 7, 1, -3, -6, -9, -9,
--3, 3, 8, 8, 10, 9, 3, 1, -1, -3, -3, -4, -1, 2, 3, 6,
-5, 13, 40, 60, 60, 53, 31, -1, -28, -32, -15, 2, 17, 32, 32, 20,
-11, 4, -4, -13, -21, -22, -22, -16, -3, 11, 16, 13, 7, -3, -15, -18,
--16, -14, -9, -3, 2, 6, 8, 10, 9, 2, -4, -9, -11, -8, -4, 3,
-8, 8, 9, 7, 3, 0, -2, -4, -5, -6, -2, 1, 3, 7, 6, 5,
-21, 51, 64, 57, 43, 16, -14, -31, -22, 0, 13, 20, 28, 24, 12, 7,
-8, -1, -15, -21, -21, -21, -11, 6, 16, 14, 7, 3, -7, -14, -14, -10,
--10, -10, -3, 2, 6, 11, 11, 7, 0, -8, -9, -7, -7, -1, 5, 5,
-5, 7, 7, 3, 0, -1, -4, -4, 0, 3, 6, 5, 5, 3, 2, 27,
-59, 62, 52, 36, 8, -20, -27, -9, 5, 8, 18, 21, 13, 12, 14, 11,
--2, -15, -21, -24, -19, -4, 7, 12, 10, 5, 2, -5, -8, -6, -11, -13,
--10, -6, 2, 7, 12, 12, 3, -1, -4, -8, -6, -4, -2, 1, -1, 2,
-7, 5, 3, 2, 0, -5, -7, -2, -2, -2, 2, 3, 1, 9, 40, 63,
-56, 46, 30, -3, -21, -17, -3, 6, 7, 16, 20, 12, 17, 21, 11, -6,
--17, -20, -22, -18, 0, 8, 4, 6, 7, 4, -1, -3, -5, -13, -17, -11,
--4, 0, 6, 11, 10, 0, -3, -2, -7, -8, -4, -5, -4, -1, 6, 8,
-5, 6, 2, -4, -4, -4, -2, -2, -3, 2, 3, 1, 6, 29, 55, 56,
-48, 37, 9, -14, -15, -6, 2, 5, 12, 18, 15, 17, 22, 15, 0, -12,
--19, -20, -17, -7, 4, 4, 4, 7, 5, 2, 0, -5, -12, -18, -15, -8,
--2, 3, 8, 8, 2, 1, 3, -1, -6, -6, -6, -7, -4, 4, 8, 6,
-5, 5, 0, -2, -1, -2, -4, -4, -1, 1, 2, 4, 17, 44, 57, 51,
-42, 21, -3, -14, -11, 0, 5, 7, 16, 18, 18, 22, 19, 8, -8, -18,
--18, -18, -10, 0, 3, 4, 5, 8, 7, 0, -4, -10, -17, -15, -10, -2,
-2, 4, 7, 4, 3, 3, -1, -3, -8, -9, -5, -3, 2, 6, 6, 5,
-4, 2, 1, -2, -3, -4, -4, -3, 0, 4, 4, 3, 13, 39, 54, 50,
-40, 22, 0, -12, -9, 3, 6, 7, 14, 17, 18, 22, 19, 8, -7, -17,
--16, -12, -8, 0, 3, 2, 3, 5, 8, 2, -6, -10, -16, -15, -7, -3,
-2, 4, 2, 3, 4, 3, 0, -4, -7, -8, -7, -1, 3, 4, 5, 4,
-2, 2, 2, 0, -3, -4, -4, -3, 2, 4, 3, 2, 10, 35, 53, 48,
-39, 23, 2, -7, -4, 5, 8, 5, 11, 18, 22, 25, 22, 11, -7, -15,
--11, -9, -5, -1, 0, 2, 2, 9, 11, 2, -6, -11, -15, -13, -9, 0,
-0, -3, 2, 4, 4, 4, -1, -5, -9, -11, -4, 0, 1, 3, 3, 3,
-3, 3, 4, -1, -5, -5, -3, -2, 2, 4, 4, 2, 3, 15, 40, 48,
-39, 28, 16, 2, -2, 4, 10, 5, 4, 13, 22, 22, 23, 18, 4, -9,
--9, -5, -4, -6, -1, 1, 0, 6, 12, 5, -3, -8, -10, -11, -9, -3,
--2, -5, -1, 3, 5, 4, 0, -3, -7, -10, -4, -1, -2, 0, 1, 1,
-1, 0, 1, -2, -6, -4, -2, -1, 0, 1, 2, 0, 0, 2, 5, 24,
-42, 39, 31, 22, 12, 4, 1, 7, 7, 1, 8, 19, 22, 23, 19, 12,
-0, -6, -2, -2, -6, -5, -1, 1, 4, 11, 9, 0, -5, -7, -8, -8,
--6, -5, -6, -5, 1, 6, 4, -1, -5, -7, -7, -6, -3, -4, -5, -2,
-1, 4, 4, 2, -1, -4, -4, -1, -1, -2, -2, 0, 2, 4, 5, 2,
-1, 19, 39, 36, 29, 23, 12, 5, 5, 11, 8, 0, 5, 16, 20, 21,
-20, 11, -1, -3, 1, 0, -6, -6, -3, 0, 4, 11, 8, -2, -5, -2,
--2, -5, -8, -7, -9, -5, 3, 5, 1, -2, -2, -1, -3, -1, -5, -8,
--6, -1, 2, 3, 1, 1, 0, 1, 2, 0, -3, -3, -3, 0, 2, 3,
-2, 0, 2, 18, 35, 32, 24, 19, 15, 10, 9, 10, 5, -1, 4, 15,
-20, 18, 14, 11, 5, 4, 3, -4, -10, -10, -6, 0, 3, 3, 1, -1,
-0, 1, -3, -8, -12, -11, -8, -4, -2, -3, -2, -1, 2, 1, -1, -4,
--6, -6, -4, -2, -1, -3, 0, 3, 3, 3, 3, -1, -2, 0, 0, 0,
--2, 0, 1, 2, 3, 6, 19, 30, 26, 24, 19, 17, 13, 9, 7, 2,
--1, 7, 12, 14, 13, 12, 13, 8, 7, 5, -4, -7, -6, -4, -2, -3,
-0, 0, 0, 3, 1, -2, -7, -8, -6, -7, -7, -6, -6, -2, -1, 2,
-1, -2, -3, -1, -3, -3, -4, -4, -3, 0, 3, 2, 1, 2, 3, 2,
-0, 0, 0, -2, 1, 3, 1, 0, 7, 21, 25, 20, 20, 20, 18, 16,
-13, 8, 2, 3, 10, 12, 8, 10, 11, 12, 11, 9, 5, -3, -4, -1,
--3, -6, -5, -3, -2, 0, 2, -1, -5, -4, -2, -6, -8, -9, -7, -7,
--4, -2, -2, -4, 0, 0, -1, -2, -3, -4, -3, -1, -1, -2, -1, 2,
-2, 4, 2, 2, 1, 2, 1, 1, -1, 0, 0, 3, 11, 21, 18, 17,
-20, 23, 19, 14, 11, 7, 4, 7, 9, 7, 5, 9, 13, 11, 9, 7,
-4, 0, 0, -2, -5, -8, -5, -2, -3, -3, -1, -3, -2, -3, -3, -7,
--9, -7, -7, -8, -6, -7, -4, -2, -1, -1, -2, -1, -1, -1, -2, -3,
--3, -1, -1, 1, 0, 1, 3, 4, 3, 3, 1, 3, 2, 1, 1, 3,
-15, 18, 14, 18, 21, 21, 19, 14, 13, 6, 7, 10, 5, 4, 7, 9,
-10, 8, 9, 6, 2, 4, 1, -4, -7, -7, -6, -6, -7, -6, -6, -3,
--3, -4, -6, -6, -6, -7, -8, -8, -10, -6, -5, -5, -3, -3, -1, 1,
--1, 0, -1, -1, 1, 0, 0, 0, 0, 4, 3, 3, 5, 4, 5, 5,
-4, 3, 2, 10, 16, 13, 13, 18, 21, 19, 15, 15, 12, 8, 11, 9,
-3, 4, 8, 11, 6, 5, 9, 7, 5, 3, 0, -4, -5, -2, -6, -10,
--7, -4, -5, -7, -5, -5, -6, -4, -5, -8, -9, -7, -6, -9, -9, -5,
--4, -4, -2, -2, -1, -1, 1, 0, -1, 0, 0, 1, 0, 1, 2, 3,
-4, 5, 3, 5, 5, 4, 4, 7, 11, 9, 9, 14, 16, 15, 13, 13,
-14, 11, 10, 10, 7, 6, 7, 8, 5, 5, 7, 7, 4, 4, 3, 2,
-0, -1, -2, -4, -4, -4, -5, -6, -5, -4, -4, -5, -5, -5, -6, -6,
--6, -7, -7, -6, -5, -6, -6, -4, -3, -3, -2, -2, -1, -1, -1, -1,
--1, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 5, 10, 7, 7, 11,
-14, 12, 11, 11, 13, 10, 10, 9, 8, 8, 9, 9, 7, 7, 9, 8,
-6, 6, 5, 5, 2, 2, 1, 0, -1, -1, -2, -3, -2, -1, -3, -3,
--3, -3, -4, -4, -5, -6, -6, -5, -6, -7, -6, -5, -6, -6, -5, -4,
--5, -4, -3, -5, -4, -3, -3, -4, -3, -2, -2, -2, -1, 0, -1, 1,
-5, 5, 4, 7, 10, 9, 8, 9, 11, 9, 9, 9, 8, 8, 8, 9,
-7, 8, 9, 9, 7, 8, 7, 6, 6, 5, 4, 3, 3, 3, 1, 1,
-2, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -4, -4, -4, -4,
--4, -4, -4, -3, -4, -4, -4, -4, -3, -4, -3, -3, -3, -3, -3, -3,
--2, -2, -2, -1, 2, 2, 1, 3, 6, 6, 5, 6, 7, 6, 6, 6,
-6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 8, 7, 6, 6, 6, 4,
-4, 4, 4, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 0, -1, 0,
-0, -1, -2, -1, -1, -2, -2, -1, -2, -2, -2, -2, -3, -3, -2, -3,
--3, -3, -3, -3, -3, -3, -2, -2, -2, 1, -1, 1, 3, 3, 2, 2,
-4, 4, 2, 3, 4, 3, 3, 4, 4, 4, 4, 5, 4, 4, 5, 5,
-4, 4, 4, 4, 3, 4, 4, 3, 3, 3, 3, 3, 2, 3, 2, 1,
-2, 1, 1, 1, 1, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1,
--1, -2, -1, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1,
-0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1,
-0, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0,
-0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
-1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0,
-0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0
-};
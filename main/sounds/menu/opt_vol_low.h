@@ -1,175 +0,0 @@
-// TTS sound: opt_vol_low
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_vol_lowSampleRate = 11025;
-const unsigned int menu_opt_vol_lowSampleCount = 2678;
-const signed char menu_opt_vol_lowSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3,
-3, 3, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 2, 1,
-1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
--1, -1, -1, -1, -1, 0, 1, 1, 2, 3, 4, 5, 6, 6, 7, 7,
-8, 8, 9, 9, 8, 8, 8, 7, 6, 5, 4, 4, 3, 2, 1, 0,
--1, -2, -3, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3,
--2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 1, 2, 4, 5, 7, 8, 9, 10, 11, 12, 12, 13,
-13, 14, 13, 13, 12, 11, 10, 8, 6, 5, 3, 2, 1, -1, -3, -4,
--5, -6, -7, -7, -8, -8, -7, -7, -7, -7, -6, -6, -5, -4, -3, -2,
--2, -1, 0, 0, 0, 0, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 3, 4, 6, 9, 10, 12, 14, 15, 16, 17, 18, 18, 18,
-19, 17, 16, 15, 12, 10, 8, 6, 4, 2, 0, -3, -5, -7, -8, -10,
--10, -11, -11, -11, -11, -11, -10, -9, -8, -7, -6, -5, -4, -2, -1, 0,
-1, 1, 2, 2, 3, 3, 3, 4, 4, 3, 3, 3, 2, 2, 2, 2,
-1, 2, 4, 6, 10, 14, 16, 18, 20, 21, 21, 22, 23, 23, 24, 23,
-21, 19, 15, 12, 9, 6, 3, 1, -2, -4, -7, -10, -12, -14, -14, -15,
--15, -14, -14, -13, -12, -11, -10, -8, -6, -5, -3, -1, 0, 2, 3, 3,
-4, 4, 5, 5, 6, 6, 5, 5, 5, 4, 4, 4, 4, 3, 3, 2,
-4, 8, 11, 16, 20, 22, 24, 25, 26, 25, 26, 28, 26, 26, 25, 20,
-17, 13, 8, 4, 2, -1, -5, -6, -9, -13, -14, -16, -18, -17, -17, -15,
--15, -13, -12, -11, -9, -8, -6, -3, -1, 0, 2, 3, 4, 4, 5, 5,
-5, 6, 6, 6, 6, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 3,
-8, 12, 17, 24, 26, 27, 28, 27, 26, 27, 27, 26, 24, 23, 16, 11,
-7, 1, -2, -5, -7, -9, -11, -13, -16, -18, -17, -18, -16, -14, -13, -11,
--10, -9, -8, -8, -5, -4, -2, 1, 1, 2, 3, 3, 3, 4, 5, 6,
-6, 8, 6, 6, 7, 5, 5, 6, 5, 4, 4, 4, 1, 1, 1, 1,
-9, 15, 22, 30, 32, 31, 30, 28, 26, 23, 24, 21, 16, 13, 6, 0,
--5, -9, -10, -12, -12, -11, -14, -14, -13, -15, -14, -12, -11, -10, -9, -8,
--9, -8, -6, -6, -4, -1, -1, 1, 2, 3, 4, 4, 7, 6, 7, 7,
-6, 7, 5, 4, 6, 4, 4, 4, 2, 2, 1, 1, 0, 0, 0, 0,
-10, 21, 29, 39, 44, 39, 33, 28, 21, 16, 16, 13, 7, 1, -3, -10,
--14, -11, -10, -10, -8, -8, -12, -14, -14, -12, -14, -11, -7, -12, -10, -8,
--9, -6, -1, 3, 1, 3, 6, 1, 3, 6, 5, 5, 6, 6, 4, 1,
-6, 4, 1, 7, 5, 2, 2, 2, 1, -2, 1, 2, -4, 0, -1, -5,
-2, 18, 33, 43, 58, 61, 52, 36, 29, 13, 2, 2, 1, -5, -7, -4,
--10, -3, 9, 8, 11, 9, -1, -10, -18, -18, -21, -19, -11, -14, -12, -7,
--5, 0, 4, 9, 9, 4, 3, -3, -8, -4, -4, -3, 2, 3, 4, 3,
-7, 9, 7, 10, 8, 2, 0, -2, -4, -6, -2, 1, -3, 1, 4, -1,
-0, 12, 33, 44, 57, 68, 50, 28, 15, -4, -15, -9, -2, -2, -4, 1,
--2, -6, 8, 15, 10, 12, 3, -12, -23, -26, -22, -22, -12, -2, -7, -3,
-3, 0, 5, 9, 8, 3, -2, -4, -12, -11, -4, -2, 3, 7, 8, 7,
-5, 8, 8, 4, 5, 1, -4, -6, -6, -3, -1, 2, 7, 4, 3, 4,
-1, -1, 2, 17, 33, 40, 53, 52, 33, 19, 7, -5, -8, -3, 1, -1,
--3, 0, -4, -2, 9, 11, 9, 6, -3, -14, -22, -19, -18, -14, -7, -4,
--4, -3, 0, 3, 3, 7, 6, 0, -4, -6, -9, -8, -2, 2, 3, 6,
-5, 2, 3, 2, 3, 2, 0, 1, -3, -5, -3, -3, 0, 3, 4, 3,
-1, 2, 0, -2, 0, 3, 18, 33, 43, 54, 49, 34, 20, 3, -5, -6,
--6, 1, 1, -2, 0, -1, 2, 9, 12, 12, 5, -4, -14, -21, -21, -18,
--14, -6, -4, -3, 0, 0, 2, 2, 1, -1, -8, -11, -12, -11, -7, -2,
-4, 5, 5, 8, 6, 4, 6, 4, 3, -1, -3, -3, -5, -3, 4, 3,
-6, 6, 5, 3, 1, 2, 1, -4, 0, 6, 22, 37, 47, 53, 46, 27,
-12, -2, -8, -8, -3, 1, 1, -1, 1, 1, 4, 11, 14, 9, 1, -9,
--19, -25, -23, -16, -11, -5, 0, -1, -2, 2, 2, 3, 3, 2, -4, -9,
--10, -9, -7, 0, 5, 8, 7, 8, 6, 4, 4, 4, 1, 0, -2, -4,
--5, -2, 2, 3, 5, 6, 5, 1, 1, 0, -2, -3, -1, 1, 19, 33,
-43, 51, 49, 31, 14, 0, -6, -10, -5, 4, 5, 2, 6, 5, 4, 10,
-14, 10, 3, -4, -13, -23, -22, -14, -12, -6, 2, 1, -2, 0, 3, 0,
-0, 2, -2, -9, -10, -8, -9, -5, 5, 6, 5, 7, 7, 2, 1, 3,
-2, -1, -2, 0, -4, -4, 3, 3, 3, 7, 6, 3, 0, 1, 0, -3,
--2, 0, 2, 17, 30, 38, 46, 44, 30, 16, 3, -4, -8, -5, 2, 3,
-3, 6, 4, 5, 9, 11, 9, 5, -2, -10, -18, -19, -16, -12, -7, -1,
-1, 0, 1, 0, 0, 0, 0, -2, -6, -8, -8, -9, -5, 1, 4, 6,
-8, 6, 4, 2, 1, 0, -1, -1, 0, -3, -2, 0, 0, 3, 6, 5,
-4, 3, 1, -1, -2, -2, -2, -2, -1, 4, 17, 26, 37, 45, 41, 29,
-18, 4, -5, -8, -4, 1, 3, 6, 8, 4, 6, 8, 9, 8, 6, -1,
--9, -16, -18, -17, -15, -7, -2, 0, 2, 1, -1, 0, 0, 1, 0, -3,
--4, -7, -9, -6, -3, 1, 5, 8, 8, 5, 3, 3, -1, 0, 1, 0,
--1, 0, -1, -1, 0, 3, 5, 4, 5, 3, 0, -2, -2, -3, -3, -2,
-0, 7, 18, 27, 35, 41, 37, 25, 15, 4, -5, -6, -2, 2, 3, 7,
-8, 5, 7, 10, 10, 11, 8, 3, -5, -14, -16, -17, -16, -8, -3, 0,
-2, 2, 0, -3, -3, -2, -4, -4, -4, -8, -9, -7, -5, -2, 2, 7,
-7, 6, 5, 2, -1, -1, 0, -1, 0, 1, 1, 0, 1, 3, 3, 4,
-6, 4, 2, 1, -1, -2, -3, -2, 0, 2, 12, 20, 26, 33, 34, 27,
-20, 11, 3, -3, -4, 0, 1, 3, 7, 7, 5, 6, 7, 5, 4, 3,
--1, -8, -11, -14, -16, -13, -8, -4, -2, 0, 1, -2, -3, -3, -4, -5,
--4, -5, -6, -6, -5, -3, -1, 2, 5, 5, 6, 5, 2, 0, 1, 0,
--1, 0, 1, 0, 0, 1, 1, 1, 3, 4, 3, 3, 2, -1, -2, -2,
--2, -2, -1, 1, 8, 14, 21, 29, 33, 30, 24, 17, 8, 0, -2, -1,
-0, 3, 8, 7, 6, 7, 6, 5, 5, 4, 1, -4, -7, -11, -15, -14,
--11, -9, -4, -1, 0, -1, -2, -4, -5, -7, -5, -5, -6, -5, -5, -5,
--3, -2, 1, 3, 5, 6, 5, 3, 3, 0, -1, 0, 1, 1, 3, 4,
-3, 4, 4, 4, 3, 4, 3, 2, 1, 1, -1, -1, -2, -1, 0, 6,
-13, 19, 25, 30, 28, 24, 17, 9, 2, -1, -1, 0, 2, 5, 7, 5,
-5, 5, 3, 3, 3, 2, -1, -4, -8, -12, -14, -13, -12, -9, -5, -2,
--1, -1, -2, -4, -6, -7, -6, -6, -5, -4, -4, -4, -2, -1, 0, 2,
-4, 5, 5, 5, 3, 1, 1, 1, 1, 2, 3, 4, 4, 5, 5, 4,
-3, 3, 3, 2, 2, 1, 0, -1, -1, -2, -1, 4, 9, 14, 21, 25,
-24, 22, 17, 10, 4, 1, 0, 0, 2, 6, 7, 7, 8, 6, 4, 3,
-2, 1, -1, -2, -5, -7, -9, -9, -10, -8, -5, -4, -2, -1, -2, -3,
--5, -6, -7, -7, -6, -5, -4, -3, -2, -1, -1, 0, 1, 2, 3, 3,
-3, 2, 2, 1, 1, 1, 1, 2, 3, 4, 5, 5, 4, 4, 3, 2,
-2, 1, 1, 1, 1, 1, 1, 2, 6, 10, 15, 20, 22, 22, 19, 14,
-9, 4, 1, 1, 1, 3, 6, 7, 8, 8, 5, 4, 2, 0, -1, -2,
--3, -4, -6, -7, -8, -8, -7, -6, -5, -3, -2, -2, -3, -4, -6, -7,
--7, -7, -6, -5, -2, -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 2,
-2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 3, 3, 3, 2, 1, 1,
-1, 1, 1, 2, 2, 6, 9, 12, 17, 19, 19, 18, 14, 10, 6, 2,
-1, 1, 2, 5, 7, 8, 9, 7, 5, 2, 0, -2, -3, -3, -3, -4,
--4, -4, -5, -6, -5, -6, -5, -4, -4, -4, -4, -4, -5, -6, -6, -6,
--5, -4, -3, -2, -1, 0, 0, 0, -1, 0, 0, 0, 1, 1, 2, 2,
-3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1,
-1, 2, 4, 6, 9, 13, 15, 15, 16, 14, 11, 8, 6, 4, 3, 4,
-6, 6, 8, 8, 7, 5, 4, 2, 0, 0, -1, -1, -2, -2, -2, -3,
--4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -5, -5, -5, -5, -4, -3,
--3, -2, -1, -2, -1, -1, -2, -2, -1, -1, 0, 0, 1, 1, 1, 2,
-1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4,
-6, 8, 12, 14, 14, 15, 14, 11, 9, 7, 5, 5, 5, 6, 7, 8,
-9, 8, 6, 5, 3, 1, 1, 0, 0, 0, 0, 0, -1, -1, -2, -3,
--4, -4, -4, -4, -3, -3, -4, -3, -4, -4, -5, -5, -5, -4, -4, -3,
--3, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, 0, 0, 0, 1, 1,
-1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 5, 7,
-9, 10, 11, 12, 11, 10, 8, 7, 6, 6, 6, 7, 7, 8, 8, 8,
-7, 6, 4, 3, 3, 2, 2, 2, 2, 1, 1, 1, 0, -1, -1, -2,
--2, -2, -2, -2, -2, -2, -3, -3, -3, -4, -4, -4, -4, -3, -3, -3,
--3, -2, -2, -2, -3, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, 0,
-0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 3, 4, 6, 7, 8,
-9, 9, 8, 7, 6, 6, 5, 5, 6, 6, 7, 7, 7, 7, 6, 6,
-5, 4, 4, 3, 3, 3, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0,
--1, -1, -1, -2, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -2,
--2, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5, 6, 7, 7,
-6, 5, 5, 5, 5, 5, 6, 6, 7, 7, 7, 7, 7, 6, 6, 5,
-5, 5, 4, 4, 4, 4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1,
-0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3, -3, -3, -3,
--3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3,
--2, -2, -2, -2, -2, -2, -1, 0, 1, 2, 3, 3, 3, 3, 3, 2,
-2, 2, 3, 3, 3, 4, 4, 5, 5, 5, 4, 4, 4, 4, 4, 3,
-4, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1,
-1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -2, -2, -2,
--2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -2, -2, -1, 0, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1,
-1, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2,
-2, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2,
--2, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0
-};
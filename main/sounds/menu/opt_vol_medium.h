@@ -1,306 +0,0 @@
-// TTS sound: opt_vol_medium
-// Generated by generate-tts-sounds.ps1
-// Optimized: 11025Hz, silence trimmed
-const unsigned int menu_opt_vol_mediumSampleRate = 11025;
-const unsigned int menu_opt_vol_mediumSampleCount = 4777;
-const signed char menu_opt_vol_mediumSamples[] = {
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
-2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2,
-1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 5, 6, 7, 9, 10,
-11, 14, 14, 16, 17, 17, 17, 16, 16, 16, 15, 14, 13, 11, 9, 7,
-5, 3, 2, -1, -2, -4, -6, -7, -8, -9, -10, -10, -11, -11, -11, -11,
--10, -10, -9, -8, -7, -6, -5, -5, -3, -2, -2, -1, 0, 1, 1, 2,
-2, 2, 2, 3, 3, 3, 3, 5, 9, 12, 14, 16, 19, 21, 23, 25,
-29, 30, 32, 33, 33, 32, 30, 29, 28, 26, 24, 21, 18, 14, 10, 6,
-3, 0, -3, -5, -9, -11, -14, -16, -16, -17, -18, -17, -17, -17, -17, -16,
--14, -13, -11, -9, -8, -7, -5, -4, -2, -1, 0, 2, 3, 3, 4, 4,
-5, 5, 5, 6, 5, 6, 10, 14, 17, 21, 24, 26, 30, 31, 34, 39,
-40, 41, 43, 41, 40, 38, 35, 35, 31, 27, 25, 19, 14, 10, 4, 1,
--3, -7, -9, -14, -17, -18, -21, -22, -22, -23, -21, -22, -22, -19, -19, -17,
--14, -13, -10, -8, -7, -4, -3, -2, 1, 2, 3, 5, 5, 6, 7, 6,
-7, 7, 6, 7, 8, 13, 19, 21, 25, 30, 34, 38, 41, 43, 46, 45,
-46, 46, 43, 42, 38, 35, 31, 25, 21, 17, 11, 7, 3, -1, -5, -10,
--12, -14, -17, -18, -19, -19, -20, -19, -18, -18, -16, -14, -13, -11, -9, -7,
--5, -4, -2, 1, 1, 3, 5, 5, 6, 6, 7, 7, 7, 7, 7, 6,
-6, 5, 6, 19, 22, 17, 29, 43, 44, 42, 47, 59, 55, 46, 53, 52,
-42, 39, 38, 35, 26, 21, 24, 17, 7, 9, 6, -1, -6, -6, -8, -16,
--16, -14, -19, -19, -18, -16, -17, -18, -10, -10, -12, -5, -3, -2, 0, 3,
-7, 4, 7, 13, 9, 11, 13, 13, 13, 10, 13, 12, 7, 9, 8, 4,
-3, 8, 18, 11, 12, 32, 35, 30, 36, 47, 50, 38, 43, 50, 39, 37,
-36, 32, 30, 24, 22, 18, 14, 13, 7, 3, 2, -3, -6, -10, -11, -12,
--16, -15, -16, -17, -15, -14, -12, -12, -10, -7, -6, -4, -3, 1, 3, 2,
-6, 8, 8, 9, 9, 13, 11, 10, 12, 11, 11, 7, 9, 10, 2, 4,
-15, 15, 8, 21, 37, 30, 29, 44, 50, 42, 39, 49, 49, 35, 36, 38,
-32, 26, 22, 23, 17, 11, 10, 5, 4, -2, -6, -4, -11, -15, -12, -17,
--17, -16, -16, -16, -15, -13, -11, -12, -8, -6, -6, -3, -1, 2, 2, 2,
-8, 6, 7, 10, 9, 10, 9, 10, 9, 8, 10, 6, 5, 7, 4, 14,
-14, 10, 26, 34, 28, 33, 47, 49, 38, 43, 54, 43, 34, 42, 39, 29,
-25, 25, 24, 14, 11, 11, 3, 2, -4, -8, -5, -13, -17, -15, -16, -19,
--23, -16, -16, -24, -15, -11, -17, -11, -6, -6, -6, -1, 4, 0, 4, 9,
-6, 9, 10, 12, 10, 11, 14, 9, 9, 14, 6, 4, 9, 9, 13, 9,
-17, 31, 24, 30, 41, 43, 45, 40, 49, 50, 39, 41, 39, 37, 31, 23,
-27, 21, 13, 10, 6, 7, -5, -8, -4, -13, -14, -17, -18, -15, -23, -19,
--17, -19, -16, -17, -11, -10, -12, -4, -4, -1, 0, 1, 7, 5, 7, 10,
-8, 12, 10, 10, 12, 9, 10, 8, 8, 8, 3, 5, 11, 12, 8, 17,
-33, 24, 26, 46, 45, 38, 45, 52, 47, 39, 47, 43, 33, 35, 30, 23,
-22, 17, 11, 6, 7, -1, -9, -5, -9, -17, -16, -13, -19, -21, -16, -17,
--18, -17, -14, -11, -13, -7, -6, -6, 0, -2, 0, 6, 4, 5, 7, 9,
-7, 7, 12, 7, 8, 9, 6, 9, 5, 3, 6, 5, 12, 8, 13, 29,
-24, 26, 40, 44, 45, 44, 52, 55, 46, 48, 48, 42, 37, 29, 28, 23,
-12, 8, 4, -1, -10, -14, -13, -20, -24, -23, -23, -25, -27, -22, -22, -23,
--18, -16, -14, -11, -8, -5, -3, -2, 4, 4, 4, 9, 8, 8, 10, 10,
-10, 8, 10, 9, 6, 8, 5, 6, 4, -1, 5, 8, 6, 7, 16, 26,
-19, 23, 40, 40, 35, 41, 50, 47, 36, 44, 45, 33, 30, 26, 23, 14,
-6, 6, -2, -9, -11, -17, -18, -21, -24, -25, -23, -23, -27, -21, -17, -21,
--17, -11, -9, -9, -6, 0, 0, -1, 3, 7, 6, 4, 8, 11, 6, 5,
-8, 8, 4, 1, 4, 4, -2, -3, 0, 0, -2, 7, 6, 7, 23, 23,
-24, 35, 41, 45, 41, 50, 55, 46, 46, 48, 43, 36, 27, 27, 21, 7,
-5, -1, -8, -13, -20, -21, -24, -28, -30, -30, -25, -29, -29, -21, -19, -19,
--16, -9, -6, -9, -1, 3, 0, 3, 6, 7, 6, 5, 9, 4, 5, 6,
-1, 4, 3, 0, 1, 0, 3, -2, 0, 6, 9, 11, 10, 26, 33, 24,
-36, 48, 48, 43, 48, 59, 49, 42, 46, 43, 35, 25, 21, 19, 5, -3,
--7, -12, -19, -29, -28, -28, -36, -34, -33, -33, -30, -29, -25, -21, -17, -13,
--12, -5, 0, -2, 1, 7, 6, 4, 7, 9, 6, 5, 7, 4, 2, 4,
-2, -1, 1, 2, -2, -1, 4, 0, -1, 11, 17, 8, 17, 35, 32, 26,
-42, 53, 43, 41, 54, 52, 42, 41, 42, 35, 25, 21, 16, 5, 2, -6,
--17, -17, -22, -30, -33, -30, -32, -38, -32, -27, -30, -27, -20, -17, -17, -10,
--4, -6, -1, 4, 3, 4, 7, 7, 5, 6, 7, 3, 3, 4, 0, 0,
-1, 0, -2, 0, 1, 0, 0, 2, 7, 12, 12, 15, 26, 32, 29, 34,
-44, 46, 42, 45, 49, 46, 41, 38, 36, 31, 23, 17, 10, 4, -1, -9,
--16, -20, -23, -28, -32, -33, -32, -33, -33, -30, -28, -25, -22, -18, -16, -12,
--8, -6, -4, -1, 1, 2, 2, 4, 4, 3, 3, 3, 2, 2, 1, 0,
-0, -1, 0, 0, 0, 1, 1, 3, 8, 12, 10, 16, 25, 26, 27, 30,
-37, 42, 40, 45, 43, 42, 41, 39, 34, 30, 28, 21, 14, 11, 6, 0,
--6, -9, -13, -17, -19, -21, -23, -24, -23, -23, -23, -20, -18, -17, -15, -12,
--9, -8, -5, -3, -1, 0, 2, 3, 2, 3, 4, 3, 2, 2, 2, 1,
-0, 1, -1, -1, -1, -1, -2, -1, 3, 3, 3, 8, 12, 14, 16, 21,
-24, 26, 29, 31, 32, 34, 35, 35, 32, 33, 32, 28, 25, 23, 20, 15,
-12, 9, 4, 1, -2, -6, -9, -11, -13, -15, -16, -16, -17, -17, -17, -16,
--15, -15, -13, -12, -11, -9, -8, -6, -5, -4, -3, -3, -1, -1, -1, 0,
-0, 0, 0, 1, 0, -1, 1, 2, 5, 5, 5, 10, 12, 13, 14, 17,
-19, 19, 20, 20, 21, 21, 18, 18, 16, 15, 14, 10, 8, 7, 4, 2,
--1, -1, -3, -5, -5, -7, -7, -7, -8, -9, -8, -7, -8, -8, -6, -6,
--5, -6, -5, -4, -4, -3, -3, -3, -3, -2, -1, -3, -1, -1, -2, -1,
--1, 0, -1, 0, 2, -1, 1, 2, 3, 11, 5, 9, 16, 17, 17, 17,
-25, 25, 21, 27, 26, 24, 24, 23, 19, 16, 17, 12, 6, 6, 3, -1,
--5, -7, -8, -13, -12, -15, -16, -14, -16, -15, -16, -14, -11, -12, -10, -8,
--6, -6, -3, -1, -2, 1, 2, 1, 2, 5, 3, 2, 4, 5, 3, 2,
-4, 4, 2, 4, 4, 2, 4, 4, 2, 8, 16, 9, 10, 26, 26, 21,
-26, 35, 35, 29, 34, 35, 31, 29, 25, 21, 17, 14, 7, -1, -2, -7,
--15, -17, -19, -20, -24, -28, -26, -27, -25, -24, -21, -18, -16, -12, -10, -6,
--1, -2, 3, 5, 6, 8, 7, 10, 9, 7, 11, 6, 7, 7, 5, 6,
-3, 5, 2, 1, 4, 1, 2, 2, 1, 5, 9, 16, 9, 17, 32, 26,
-25, 33, 41, 37, 31, 40, 37, 30, 29, 24, 19, 14, 8, 0, -5, -8,
--16, -22, -24, -25, -30, -33, -29, -28, -31, -27, -23, -20, -18, -14, -8, -7,
--2, 2, 1, 8, 9, 7, 10, 12, 11, 7, 10, 11, 5, 6, 7, 5,
-2, 3, 4, 0, 2, 3, 0, 2, 4, 1, 1, 9, 17, 9, 13, 29,
-28, 24, 29, 40, 39, 30, 37, 38, 31, 30, 23, 22, 17, 9, 2, -3,
--3, -15, -21, -17, -24, -29, -30, -26, -27, -34, -24, -22, -24, -18, -14, -10,
--9, -5, 2, 0, 4, 8, 6, 10, 10, 8, 10, 10, 9, 6, 8, 8,
-2, 5, 5, 1, 1, 2, 3, -1, 1, 5, -1, 2, 5, 11, 14, 9,
-21, 30, 25, 26, 34, 43, 34, 32, 43, 37, 30, 28, 27, 24, 10, 10,
-6, -4, -7, -14, -16, -20, -26, -25, -28, -28, -28, -28, -25, -22, -20, -18,
--13, -9, -8, -5, 0, 2, 2, 7, 7, 7, 9, 9, 8, 8, 9, 6,
-5, 6, 4, 2, 1, 2, 0, -2, 1, -1, -3, -1, -1, -1, 3, 11,
-8, 9, 25, 26, 22, 30, 40, 39, 31, 40, 43, 33, 31, 31, 28, 19,
-14, 12, 3, -1, -7, -13, -15, -18, -22, -24, -24, -24, -24, -24, -20, -18,
--19, -14, -11, -8, -6, -3, 1, 0, 4, 5, 4, 7, 6, 6, 5, 6,
-6, 2, 4, 3, 2, 1, 0, 2, 0, -1, 1, -1, 0, 1, -1, -1,
-4, 13, 8, 8, 27, 29, 21, 30, 42, 39, 30, 39, 44, 31, 30, 30,
-26, 18, 12, 12, 2, -2, -2, -12, -13, -13, -18, -20, -21, -17, -20, -22,
--16, -14, -16, -13, -8, -7, -6, -3, 0, 1, 3, 6, 4, 7, 9, 6,
-9, 8, 9, 9, 6, 7, 8, 6, 4, 3, 5, 2, 0, 1, 1, -1,
--3, -1, 1, 7, 9, 5, 20, 28, 22, 25, 36, 41, 29, 31, 41, 33,
-25, 25, 24, 19, 9, 9, 6, 0, -2, -6, -10, -7, -11, -16, -15, -11,
--16, -20, -13, -11, -17, -15, -10, -9, -11, -8, -3, -5, -4, 1, 0, 2,
-3, 4, 5, 4, 7, 6, 5, 9, 5, 6, 8, 4, 4, 5, 3, 2,
-3, 2, 0, 0, 1, 3, 11, 11, 9, 25, 30, 24, 28, 36, 41, 28,
-28, 36, 28, 21, 20, 19, 15, 9, 9, 6, 1, 4, 0, -7, -2, -4,
--9, -11, -10, -8, -16, -13, -10, -14, -12, -12, -10, -8, -9, -5, -7, -5,
-1, -5, -1, 2, 1, 1, 2, 5, 3, 4, 6, 3, 6, 5, 4, 4,
-5, 6, 3, 1, 5, 4, -1, 1, 11, 19, 13, 17, 34, 37, 33, 32,
-39, 40, 29, 26, 24, 19, 17, 8, 5, 3, 4, 2, -6, -2, -1, -5,
--6, -9, -6, -8, -14, -12, -12, -16, -13, -13, -15, -13, -9, -7, -11, -6,
--1, -4, -3, 1, 1, 1, 0, 5, 1, 2, 7, 4, 1, 8, 7, 4,
-4, 9, 6, 3, 7, 6, 1, 5, 4, 1, -2, 4, 16, 17, 12, 24,
-35, 36, 31, 32, 37, 33, 25, 21, 15, 13, 10, 2, -1, -1, 0, -1,
--6, -3, -2, -3, -5, -8, -8, -9, -11, -15, -15, -14, -15, -14, -14, -14,
--10, -8, -6, -6, -1, -1, 0, 1, -1, 2, 4, 1, 0, 4, 6, 2,
-5, 8, 5, 6, 9, 6, 6, 7, 6, 5, 2, 3, 3, -1, 1, 2,
-15, 22, 13, 25, 37, 36, 35, 31, 34, 31, 24, 19, 9, 7, 9, 0,
--5, -4, -1, -2, -3, -2, -5, -4, 0, -8, -11, -11, -13, -16, -18, -18,
--19, -18, -12, -14, -13, -6, -3, -2, -2, 2, 2, -1, 5, 3, -2, 3,
-4, 2, 3, 4, 8, 6, 7, 10, 7, 8, 10, 6, 6, 4, 3, 3,
-0, 0, -1, 0, 13, 23, 15, 20, 38, 39, 35, 33, 32, 29, 24, 20,
-7, 2, 7, 4, -5, -5, 3, 1, -1, 3, 0, -5, -2, 0, -10, -17,
--10, -14, -20, -18, -15, -16, -14, -6, -6, -10, 0, 3, 0, -2, 1, 2,
--2, -1, 3, -2, -1, 5, 4, 2, 6, 10, 7, 7, 11, 6, 5, 7,
-5, 1, 1, 2, 0, -2, 0, 0, 7, 25, 24, 20, 32, 40, 39, 33,
-31, 26, 17, 20, 13, -3, -2, 3, 1, -4, -1, 1, -2, 3, 5, -5,
--8, -5, -7, -15, -17, -16, -18, -18, -12, -12, -14, -7, 0, -2, -2, 0,
-2, 0, 0, 2, -2, -2, 1, 2, 0, 1, 6, 6, 6, 10, 7, 6,
-9, 7, 4, 2, 3, 2, -1, 1, 0, -1, -1, 1, 2, 9, 27, 26,
-23, 33, 39, 39, 34, 30, 23, 15, 19, 12, 0, -1, 1, 2, 0, 1,
-1, -1, 2, 5, -4, -9, -7, -11, -14, -16, -17, -18, -18, -10, -10, -12,
--5, -3, -1, 0, 0, 0, -2, 0, -1, -6, -3, -3, -3, -1, 1, 1,
-2, 6, 8, 4, 6, 7, 4, 3, 4, 1, -1, 0, 1, 0, -1, 1,
-2, 0, 5, 21, 28, 26, 30, 36, 39, 38, 35, 29, 16, 17, 18, 8,
-1, 1, 1, 2, 2, 5, -1, -2, 5, 2, -7, -8, -10, -14, -16, -13,
--15, -20, -15, -7, -9, -6, -3, -3, -3, 0, 2, -2, -5, -1, -1, -3,
-0, 1, -1, 2, 8, 6, 5, 7, 9, 6, 5, 7, 3, 0, 4, 2,
-1, 0, 1, 2, 1, 2, 3, -1, 2, 12, 28, 26, 25, 32, 35, 36,
-36, 31, 21, 12, 16, 13, 4, 3, 1, 0, 3, 7, 7, 0, 0, 2,
--1, -3, -8, -12, -16, -16, -14, -15, -17, -13, -13, -9, -5, -3, -5, -4,
--3, -1, -4, -2, -4, -5, -4, 0, 1, 0, 2, 5, 5, 8, 8, 7,
-5, 6, 7, 4, 3, 3, 1, 2, 3, 3, 3, 1, 4, 1, -2, 7,
-20, 26, 26, 29, 31, 28, 31, 33, 24, 13, 10, 10, 5, 4, 7, 1,
--2, 4, 8, 5, 3, 3, -1, -6, -4, -6, -13, -16, -15, -15, -15, -12,
--9, -11, -10, -4, -2, -5, -3, -3, -5, -6, -3, -2, -6, -5, 0, 0,
-1, 4, 6, 4, 4, 7, 7, 5, 5, 4, 2, 1, 4, 3, 2, 3,
-4, 3, 4, 4, 3, 1, 7, 22, 28, 29, 33, 32, 28, 31, 32, 26,
-15, 10, 8, 4, 6, 8, 4, 1, 2, 7, 6, 5, 5, -2, -9, -7,
--9, -12, -15, -17, -16, -17, -14, -7, -10, -9, -7, -6, -3, -2, -2, -2,
--6, -4, -2, -2, 0, 0, 1, 2, 3, 8, 8, 7, 8, 6, 6, 6,
-6, 6, 3, 2, 4, 2, 4, 5, 3, 2, 3, 3, 2, 2, 12, 23,
-26, 29, 31, 28, 27, 27, 27, 20, 11, 8, 5, 1, 5, 6, 5, 2,
-4, 6, 5, 5, 5, -2, -7, -9, -10, -12, -13, -13, -14, -16, -11, -8,
--6, -4, -5, -6, -5, -6, -4, -5, -7, -6, -7, -4, -2, -1, 3, 2,
-3, 5, 5, 6, 7, 5, 5, 2, 3, 4, 3, 4, 4, 4, 4, 4,
-6, 5, 3, 4, 1, 0, 6, 19, 25, 29, 31, 28, 24, 24, 24, 21,
-14, 8, 3, 0, 1, 6, 7, 5, 5, 4, 3, 4, 3, 0, -6, -10,
--13, -14, -14, -12, -13, -13, -12, -10, -6, -5, -4, -3, -6, -7, -6, -6,
--6, -5, -4, -5, -4, 1, 3, 3, 5, 6, 4, 5, 5, 6, 5, 3,
-4, 3, 2, 5, 6, 5, 5, 5, 5, 4, 4, 4, 2, 1, -1, 2,
-16, 24, 28, 32, 29, 23, 22, 21, 20, 14, 9, 4, -2, -2, 4, 6,
-7, 7, 5, 2, 2, 3, 2, -4, -9, -12, -15, -16, -12, -10, -11, -11,
--9, -8, -6, -3, -2, -5, -7, -7, -9, -9, -7, -5, -5, -4, -3, 0,
-2, 4, 6, 6, 4, 5, 4, 3, 4, 4, 3, 3, 3, 4, 5, 5,
-7, 6, 4, 5, 3, 3, 2, 1, 0, 5, 16, 24, 29, 32, 29, 23,
-21, 20, 17, 14, 9, 3, -1, -1, 2, 6, 7, 8, 6, 2, 1, 2,
-0, -2, -5, -10, -14, -15, -14, -11, -10, -9, -8, -9, -8, -5, -4, -4,
--4, -6, -7, -8, -7, -4, -2, -2, 0, 1, 1, 3, 5, 6, 6, 5,
-4, 4, 4, 4, 5, 5, 4, 5, 4, 5, 5, 6, 5, 4, 3, 2,
-1, 1, 1, 7, 16, 22, 26, 28, 25, 22, 20, 19, 18, 16, 11, 8,
-4, 2, 5, 6, 7, 8, 6, 3, 1, 0, -1, -2, -5, -7, -10, -12,
--12, -11, -9, -9, -8, -8, -9, -9, -7, -6, -6, -6, -6, -7, -7, -5,
--4, -2, -1, 0, 0, 0, 2, 3, 3, 4, 4, 4, 4, 4, 4, 5,
-5, 5, 5, 4, 4, 4, 4, 4, 4, 3, 2, 1, 1, 4, 9, 14,
-18, 21, 21, 20, 19, 19, 20, 19, 17, 15, 12, 9, 8, 9, 9, 8,
-7, 5, 3, 1, 1, 0, -1, -2, -3, -6, -7, -7, -7, -7, -6, -6,
--7, -8, -8, -7, -6, -5, -5, -5, -5, -4, -3, -3, -1, -1, 0, 0,
-0, 0, 1, 2, 2, 3, 2, 2, 2, 2, 2, 3, 3, 2, 2, 2,
-1, 1, 1, 1, 1, 1, 0, 0, 1, 6, 10, 13, 16, 17, 17, 17,
-18, 19, 20, 19, 18, 17, 14, 14, 14, 13, 12, 11, 9, 7, 5, 4,
-3, 2, 1, 0, -2, -4, -4, -4, -4, -4, -4, -5, -5, -5, -5, -4,
--3, -2, -2, -2, -1, -1, 0, 1, 2, 3, 3, 3, 3, 4, 4, 4,
-5, 4, 4, 3, 3, 3, 3, 3, 3, 2, 1, 1, 1, 0, 0, 0,
-0, -1, -2, -1, 2, 5, 7, 8, 10, 10, 12, 13, 15, 17, 18, 18,
-18, 17, 17, 18, 18, 17, 16, 14, 13, 11, 10, 9, 8, 6, 4, 2,
-0, -1, -2, -3, -4, -5, -6, -7, -8, -7, -7, -7, -6, -6, -6, -5,
--4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 5, 6, 6, 6, 7, 7,
-7, 7, 7, 6, 6, 5, 5, 4, 4, 3, 2, 1, 0, 0, -1, 0,
-2, 4, 5, 6, 7, 8, 9, 10, 13, 14, 14, 14, 14, 15, 15, 16,
-16, 16, 14, 13, 12, 11, 10, 10, 9, 7, 5, 3, 2, 1, 0, -1,
--2, -3, -5, -5, -6, -6, -6, -6, -6, -7, -6, -6, -5, -4, -4, -3,
--2, -2, -1, 0, 1, 2, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5,
-5, 5, 5, 5, 4, 4, 3, 3, 2, 2, 1, 2, 5, 6, 7, 8,
-8, 10, 11, 12, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 14, 13,
-12, 11, 10, 10, 8, 6, 5, 3, 2, 1, 0, -1, -2, -4, -5, -6,
--6, -6, -7, -7, -7, -7, -7, -7, -6, -5, -5, -4, -3, -3, -2, -1,
-0, 1, 2, 2, 2, 3, 3, 4, 5, 5, 5, 5, 5, 5, 5, 5,
-5, 4, 4, 4, 3, 2, 2, 4, 6, 8, 8, 9, 10, 11, 12, 14,
-16, 16, 16, 16, 16, 16, 16, 16, 16, 15, 13, 12, 11, 9, 9, 8,
-6, 4, 2, 1, 0, -2, -2, -3, -4, -6, -7, -7, -8, -8, -7, -8,
--7, -8, -7, -7, -6, -5, -4, -4, -3, -3, -2, -1, 0, 0, 1, 2,
-2, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 2,
-2, 1, 2, 4, 6, 7, 7, 8, 8, 10, 11, 13, 14, 15, 15, 15,
-15, 15, 16, 16, 16, 14, 13, 12, 11, 10, 9, 8, 7, 5, 3, 1,
-0, -1, -2, -3, -4, -6, -7, -7, -8, -8, -8, -8, -9, -9, -9, -8,
--7, -7, -6, -5, -5, -4, -4, -3, -2, -1, 0, 1, 1, 2, 2, 3,
-4, 4, 4, 4, 4, 4, 5, 5, 5, 4, 4, 4, 3, 3, 3, 5,
-7, 7, 8, 8, 9, 10, 12, 13, 14, 14, 15, 15, 15, 15, 16, 15,
-15, 14, 13, 12, 11, 10, 9, 8, 6, 4, 3, 1, 0, -1, -2, -3,
--4, -6, -7, -7, -7, -8, -8, -8, -8, -9, -9, -8, -7, -7, -6, -6,
--5, -5, -4, -3, -2, -2, -1, 0, 0, 1, 2, 2, 3, 3, 3, 3,
-3, 4, 4, 4, 4, 3, 3, 3, 2, 3, 3, 5, 6, 6, 7, 7,
-8, 9, 11, 12, 13, 13, 13, 13, 14, 14, 14, 14, 14, 12, 12, 11,
-10, 10, 8, 7, 6, 4, 3, 2, 0, 0, -1, -3, -4, -5, -6, -6,
--7, -7, -7, -8, -8, -8, -8, -7, -7, -7, -6, -6, -5, -5, -4, -3,
--3, -2, -2, -1, 0, 0, 1, 1, 2, 2, 2, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 4, 5, 6, 7, 7, 8, 9, 10, 11, 12,
-13, 13, 14, 14, 14, 14, 14, 14, 14, 13, 12, 11, 10, 9, 8, 7,
-5, 4, 2, 1, 0, -1, -2, -4, -5, -6, -6, -7, -7, -8, -8, -8,
--9, -9, -8, -8, -8, -7, -7, -7, -6, -5, -5, -4, -3, -3, -2, -2,
--1, -1, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 4, 5, 6, 6, 7, 8, 9, 10, 11, 12, 12, 13, 13, 14,
-14, 14, 15, 14, 13, 13, 12, 12, 11, 10, 9, 8, 6, 5, 4, 3,
-2, 0, -1, -2, -3, -4, -5, -6, -6, -7, -7, -8, -8, -8, -8, -8,
--8, -7, -7, -7, -6, -6, -5, -5, -4, -4, -4, -3, -3, -2, -2, -1,
--1, -1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 3, 4, 4,
-5, 6, 6, 8, 8, 10, 11, 11, 12, 12, 13, 13, 14, 14, 14, 14,
-13, 13, 12, 12, 11, 10, 9, 8, 6, 6, 5, 3, 2, 1, 0, -1,
--2, -3, -3, -4, -5, -5, -6, -6, -7, -7, -7, -7, -7, -7, -7, -6,
--6, -6, -5, -5, -5, -4, -4, -3, -3, -2, -2, -2, -1, -1, -1, 0,
-0, 0, 0, 1, 1, 1, 1, 1, 2, 3, 4, 4, 5, 5, 6, 7,
-8, 9, 9, 9, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 10, 10,
-9, 9, 8, 7, 7, 6, 5, 5, 4, 3, 2, 2, 1, 0, 0, -1,
--1, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3,
--3, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-0, 0, 1, 1, 2, 3, 3, 3, 4, 4, 5, 6, 6, 7, 7, 7,
-8, 8, 8, 8, 9, 8, 8, 8, 8, 8, 8, 7, 7, 6, 6, 5,
-5, 5, 4, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, -1, -1, -1,
--1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1,
--1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2,
-2, 3, 3, 3, 3, 4, 4, 5, 5, 6, 6, 6, 6, 6, 7, 7,
-7, 7, 7, 6, 6, 6, 6, 6, 6, 5, 5, 4, 4, 4, 3, 3,
-3, 2, 2, 2, 1, 1, 1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 3, 3, 3, 3,
-4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6,
-6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 3, 3, 2, 2, 2, 2,
-1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
-4, 4, 4, 4, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 3,
-3, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2,
-2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2,
-2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
--1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
--1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0
-};
@@ -6,28 +6,39 @@
  */
 
 #include "sound_profiles.h"
+#include "sound_pack.h"
+
+// Only the profiles selected under Kconfig "Crawler sound content" are
+// compiled in; the table stays indexed by the fixed sound_profile_t IDs
 
 // ===========================================================================
 // CAT 3408 - Caterpillar V8 diesel
 // ===========================================================================
+#if CONFIG_CRAWLER_SOUND_PROFILE_CAT3408
 #include "cat3408/cat_idle.h"   // cat_idleSamples, cat_idleSampleCount, cat_idleSampleRate
 #include "cat3408/cat_rev.h"    // cat_revSamples, cat_revSampleCount, cat_revSampleRate
 #include "cat3408/cat_knock.h"  // cat_knockSamples, cat_knockSampleCount, cat_knockSampleRate
+#endif
+#if CONFIG_CRAWLER_SOUND_PROFILE_CAT3408 || CONFIG_CRAWLER_SOUND_PROFILE_SYNTH_V8
 #include "cat3408/cat_start.h"  // cat_startSamples, cat_startSampleCount, cat_startSampleRate
+#endif
 
 // ===========================================================================
 // UNIMOG U1000 - Mercedes turbo diesel off-road
 // ===========================================================================
+#if CONFIG_CRAWLER_SOUND_PROFILE_UNIMOG
 #include "unimog/UnimogU1000TurboIdle.h"     // unimog_idleSamples, unimog_idleSampleCount, unimog_idleSampleRate
 #include "unimog/UnimogU1000TurboRev.h"      // unimog_revSamples, unimog_revSampleCount, unimog_revSampleRate
 #include "unimog/UnimogU1000TurboKnock.h"    // unimog_knockSamples, unimog_knockSampleCount, unimog_knockSampleRate
 #include "unimog/UnimogU1000TurboJakeBrake.h"// unimog_jakeSamples, unimog_jakeSampleCount, unimog_jakeSampleRate
 #include "unimog/UnimogU1000Start.h"         // unimog_startSamples, unimog_startSampleCount, unimog_startSampleRate
 #include "unimog/UnimogU1000TurboWastegate.h"// unimog_wastegateSamples, unimog_wastegateSampleCount, unimog_wastegateSampleRate
+#endif
 
 // ===========================================================================
 // MAN TGX - German truck
 // ===========================================================================
+#if CONFIG_CRAWLER_SOUND_PROFILE_MANTGX
 #include "mantgx/MANTGXidle.h"       // mantgx_idleSamples, mantgx_idleSampleCount, mantgx_idleSampleRate
 #include "mantgx/MANTGXrev.h"        // mantgx_revSamples, mantgx_revSampleCount, mantgx_revSampleRate
 #include "mantgx/MANTGXknock2.h"     // mantgx_knockSamples, mantgx_knockSampleCount, mantgx_knockSampleRate
@@ -35,14 +46,34 @@
 #include "mantgx/MANTGXjakebrake2.h" // mantgx_jakeSamples, mantgx_jakeSampleCount, mantgx_jakeSampleRate
 #include "mantgx/MANTGXshifting.h"   // mantgx_shiftingSamples, mantgx_shiftingSampleCount, mantgx_shiftingSampleRate
 #include "mantgx/MANTGXwastegate2.h" // mantgx_wastegateSamples, mantgx_wastegateSampleCount, mantgx_wastegateSampleRate
+#endif
+
+// ===========================================================================
+// Synth V8 - granular engine from 1.5KB of firing grains
+// ===========================================================================
+#if CONFIG_CRAWLER_SOUND_PROFILE_SYNTH_V8
+#include "synth/synth_v8_grains.h"  // synth_v8Grains, synth_v8GrainLength, synth_v8GrainCount, synth_v8GrainRate
+
+static const sound_synth_def_t synth_v8 = {
+    .grains = (const int8_t*)synth_v8Grains,
+    .grain_length = synth_v8GrainLength,
+    .grain_count = synth_v8GrainCount,
+    .grain_rate = synth_v8GrainRate,
+    .idle_firing_hz_x10 = 430,      // 650 rpm x 8 cylinders / 2 revolutions
+    .grain_pitch_pct = 30,
+    .jitter_pct = 6,
+    // Cross-plane V8 firing order 1-8-4-3-6-5-7-2: bank pairs fire unevenly
+    .firing_gain = { 255, 190, 220, 170, 240, 185, 215, 175 },
+};
+#endif
 
 // ===========================================================================
 // Profile Definitions
 // ===========================================================================
 
 static const sound_profile_def_t profiles[SOUND_PROFILE_COUNT] = {
-    // CAT 3408 (index 0)
-    {
+#if CONFIG_CRAWLER_SOUND_PROFILE_CAT3408
+    [SOUND_PROFILE_CAT_3408] = {
         .name = "CAT 3408",
         .description = "Caterpillar V8 diesel",
         .idle = {
@@ -76,8 +107,9 @@ static const sound_profile_def_t profiles[SOUND_PROFILE_COUNT] = {
         .shifting = { .samples = NULL, .sample_count = 0, .sample_rate = 0 },
         .wastegate = { .samples = NULL, .sample_count = 0, .sample_rate = 0 }
     },
-    // UNIMOG U1000 (index 1)
-    {
+#endif
+#if CONFIG_CRAWLER_SOUND_PROFILE_UNIMOG
+    [SOUND_PROFILE_UNIMOG_U1000] = {
         .name = "Unimog U1000",
         .description = "Mercedes turbo diesel off-road",
         .idle = {
@@ -115,8 +147,9 @@ static const sound_profile_def_t profiles[SOUND_PROFILE_COUNT] = {
             .sample_rate = unimog_wastegateSampleRate
         }
     },
-    // MAN TGX (index 2)
-    {
+#endif
+#if CONFIG_CRAWLER_SOUND_PROFILE_MANTGX
+    [SOUND_PROFILE_MAN_TGX] = {
         .name = "MAN TGX",
         .description = "German truck diesel",
         .idle = {
@@ -157,19 +190,50 @@ static const sound_profile_def_t profiles[SOUND_PROFILE_COUNT] = {
             .sample_count = mantgx_wastegateSampleCount,
             .sample_rate = mantgx_wastegateSampleRate
         }
-    }
+    },
+#endif
+#if CONFIG_CRAWLER_SOUND_PROFILE_SYNTH_V8
+    // Shares the CAT start sound, no loop recordings
+    [SOUND_PROFILE_SYNTH_V8] = {
+        .name = "Synth V8",
+        .description = "Granular synthesized V8",
+        .start = {
+            .samples = (const int8_t*)cat_startSamples,
+            .sample_count = cat_startSampleCount,
+            .sample_rate = cat_startSampleRate
+        },
+        .has_jake_brake = false,
+        .cylinder_count = 8,
+        .synth = &synth_v8
+    },
+#endif
 };
 
 const sound_profile_def_t* sound_profiles_get(sound_profile_t profile) {
     if (profile >= SOUND_PROFILE_COUNT) {
-        return &profiles[SOUND_PROFILE_CAT_3408];
+        // IDs past the built-ins select profiles from the flashed sound pack
+        const sound_profile_def_t *def = sound_pack_get_profile(profile - SOUND_PROFILE_COUNT);
+        return def ? def : &profiles[SOUND_PROFILE_DEFAULT];
     }
-    return &profiles[profile];
+    // Built-ins left out of this build (name NULL) fall back too
+    return profiles[profile].name ? &profiles[profile] : &profiles[SOUND_PROFILE_DEFAULT];
 }
 
 const char* sound_profiles_get_name(sound_profile_t profile) {
     if (profile >= SOUND_PROFILE_COUNT) {
-        return "Unknown";
+        const sound_profile_def_t *def = sound_pack_get_profile(profile - SOUND_PROFILE_COUNT);
+        return def ? def->name : "Unknown";
     }
-    return profiles[profile].name;
+    return profiles[profile].name ? profiles[profile].name : "Unknown";
+}
+
+bool sound_profiles_is_available(sound_profile_t profile) {
+    if (profile >= SOUND_PROFILE_COUNT) {
+        return sound_pack_get_profile(profile - SOUND_PROFILE_COUNT) != NULL;
+    }
+    return profiles[profile].name != NULL;
+}
+
+int sound_profiles_count(void) {
+    return SOUND_PROFILE_COUNT + sound_pack_profile_count();
 }
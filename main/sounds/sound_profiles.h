@@ -12,27 +12,76 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include "sdkconfig.h"
 
-// Sound profile enumeration
+// Sound profile enumeration. IDs are stored in NVS, presets and sound packs,
+// so they stay fixed whichever profiles the build compiles in (Kconfig
+// "Crawler sound content"); sound_profiles_is_available() tells them apart
 typedef enum {
     SOUND_PROFILE_CAT_3408 = 0,          // Caterpillar V8 diesel
     SOUND_PROFILE_UNIMOG_U1000,          // Mercedes Unimog U1000 turbo diesel
     SOUND_PROFILE_MAN_TGX,               // MAN TGX truck
+    SOUND_PROFILE_SYNTH_V8,              // Granular synthesized V8
     SOUND_PROFILE_COUNT
 } sound_profile_t;
 
+// First compiled-in profile: the default and the fallback for missing IDs
+#if CONFIG_CRAWLER_SOUND_PROFILE_CAT3408
+#define SOUND_PROFILE_DEFAULT   SOUND_PROFILE_CAT_3408
+#elif CONFIG_CRAWLER_SOUND_PROFILE_UNIMOG
+#define SOUND_PROFILE_DEFAULT   SOUND_PROFILE_UNIMOG_U1000
+#elif CONFIG_CRAWLER_SOUND_PROFILE_MANTGX
+#define SOUND_PROFILE_DEFAULT   SOUND_PROFILE_MAN_TGX
+#elif CONFIG_CRAWLER_SOUND_PROFILE_SYNTH_V8
+#define SOUND_PROFILE_DEFAULT   SOUND_PROFILE_SYNTH_V8
+#else
+#error "Crawler sound content: enable at least one engine profile"
+#endif
+
+// Sample encoding (zero = PCM8, so existing tables need no change)
+typedef enum {
+    SOUND_FORMAT_PCM8 = 0,              // Signed 8-bit samples
+    SOUND_FORMAT_IMA_ADPCM,             // 4-bit IMA-ADPCM blocks (see adpcm.h)
+} sound_format_t;
+
 // Sound sample structure
 typedef struct {
-    const int8_t *samples;
-    uint32_t sample_count;
+    const int8_t *samples;              // PCM8 samples, or ADPCM blocks (cast)
+    uint32_t sample_count;              // Decoded sample count
     uint32_t sample_rate;
+    sound_format_t format;
 } sound_sample_t;
 
+#define SOUND_MAX_CYLINDERS     12
+
+// Firing order and per-cylinder knock accent. Slot n of the engine cycle
+// fires cylinder order[n]; its knock plays at accent[order[n] - 1] percent
+// of the base knock level (e.g. cylinders sharing an exhaust junction)
+typedef struct {
+    uint8_t order[SOUND_MAX_CYLINDERS];     // 1-based cylinder numbers, 0 = unused slot
+    uint8_t accent[SOUND_MAX_CYLINDERS];    // Per cylinder (100 = base)
+} sound_firing_def_t;
+
+// Granular engine: the sound is built from single-firing grains, one
+// started per cylinder firing, sequenced by RPM and firing order instead
+// of resampling idle/rev loop recordings
+typedef struct {
+    const int8_t *grains;               // grain_count grains of grain_length samples
+    uint16_t grain_length;
+    uint8_t grain_count;                // Cylinder n fires grain n % grain_count
+    uint32_t grain_rate;                // Grain sample rate
+    uint16_t idle_firing_hz_x10;        // Firing frequency at idle RPM (x10)
+    uint8_t grain_pitch_pct;            // Grain pitch rise per 100% RPM over idle
+    uint8_t jitter_pct;                 // Random firing time jitter (0-25%)
+    uint8_t firing_gain[SOUND_MAX_CYLINDERS];  // Per firing slot (0-255)
+} sound_synth_def_t;
+
 // Sound profile structure
 typedef struct {
     const char *name;
     const char *description;
-    // Engine sounds (required)
+    // Engine sounds (required unless synth is set; idle and knock must be
+    // PCM8, the others may be IMA-ADPCM)
     sound_sample_t idle;
     sound_sample_t rev;
     sound_sample_t knock;
@@ -40,15 +89,25 @@ typedef struct {
     sound_sample_t jake_brake;
     bool has_jake_brake;
     uint8_t cylinder_count;         // For knock interval
+    const sound_firing_def_t *firing;   // NULL = even firing (or config v8_mode)
     // Effect sounds (optional - NULL samples means use generic fallback)
     sound_sample_t shifting;        // Gear shift sound
     sound_sample_t wastegate;       // Wastegate/blowoff sound
+    // Granular engine (optional - replaces idle/rev/knock when set)
+    const sound_synth_def_t *synth;
 } sound_profile_def_t;
 
-// Get profile definition by ID
+// Get profile definition by ID (SOUND_PROFILE_DEFAULT if not available)
 const sound_profile_def_t* sound_profiles_get(sound_profile_t profile);
 
 // Get profile name
 const char* sound_profiles_get_name(sound_profile_t profile);
 
+// Check whether an ID selects a compiled-in or sound pack profile
+bool sound_profiles_is_available(sound_profile_t profile);
+
+// One past the highest profile ID (built-ins followed by sound pack
+// profiles; built-ins left out of the build are skipped via is_available)
+int sound_profiles_count(void);
+
 #endif // SOUND_PROFILES_H
@@ -0,0 +1,103 @@
+// Firing grains for the granular engine synth
+// Generated by tools/grain-gen.js synth_v8 synth_v8_grains.h
+const unsigned int synth_v8GrainRate = 22050;
+const unsigned int synth_v8GrainLength = 384;
+const unsigned int synth_v8GrainCount = 4;
+const signed char synth_v8Grains[] = {
+0, 0, 3, 5, 7, 11, 20, 32, 42, 48, 61, 59, 59, 78, 73, 83,
+73, 87, 86, 92, 84, 90, 77, 76, 81, 75, 75, 84, 79, 92, 87, 97,
+99, 99, 110, 109, 108, 112, 115, 120, 117, 118, 110, 115, 118, 115, 114, 111,
+103, 103, 92, 93, 87, 77, 71, 70, 64, 68, 63, 58, 55, 54, 51, 56,
+61, 64, 62, 64, 66, 62, 65, 63, 61, 57, 60, 59, 55, 55, 54, 53,
+53, 45, 40, 42, 36, 35, 31, 34, 31, 27, 30, 31, 29, 27, 26, 25,
+26, 24, 27, 25, 27, 31, 31, 32, 34, 32, 30, 32, 33, 33, 30, 27,
+26, 28, 27, 27, 23, 23, 23, 22, 20, 17, 14, 11, 12, 11, 8, 9,
+9, 6, 5, 4, 4, 1, 1, 0, -1, -1, -3, -3, -5, -7, -10, -13,
+-12, -14, -17, -19, -19, -20, -22, -26, -28, -28, -32, -32, -34, -36, -38, -39,
+-41, -42, -44, -45, -46, -47, -48, -49, -51, -50, -51, -51, -53, -54, -54, -55,
+-54, -54, -54, -55, -56, -56, -55, -55, -56, -56, -56, -56, -57, -57, -56, -55,
+-55, -55, -54, -53, -52, -51, -50, -49, -48, -47, -45, -44, -43, -41, -40, -39,
+-38, -36, -34, -33, -31, -30, -29, -27, -26, -25, -24, -23, -22, -20, -19, -17,
+-16, -15, -14, -13, -12, -11, -9, -8, -7, -5, -4, -4, -3, -2, 0, 1,
+1, 3, 4, 4, 5, 6, 6, 7, 8, 8, 9, 10, 10, 10, 11, 11,
+12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16,
+16, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 17, 17, 17,
+17, 17, 17, 17, 17, 16, 16, 16, 16, 16, 16, 15, 15, 15, 15, 14,
+14, 14, 14, 13, 13, 13, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10,
+9, 9, 9, 8, 8, 7, 7, 7, 6, 6, 6, 5, 5, 5, 4, 4,
+4, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 2, 4, 6, 12, 14, 27, 41, 43, 54, 69, 83, 76, 84, 92, 96,
+87, 79, 85, 73, 78, 77, 74, 78, 72, 77, 78, 82, 82, 95, 102, 97,
+107, 106, 111, 107, 115, 114, 110, 111, 119, 117, 120, 117, 111, 101, 94, 88,
+88, 83, 85, 82, 73, 70, 65, 64, 68, 63, 66, 65, 59, 54, 59, 55,
+59, 53, 57, 54, 56, 52, 54, 52, 56, 58, 55, 48, 47, 48, 42, 42,
+38, 40, 33, 34, 34, 30, 29, 30, 26, 24, 25, 22, 21, 20, 23, 27,
+28, 28, 28, 27, 29, 32, 31, 32, 33, 34, 34, 31, 30, 29, 28, 26,
+24, 21, 19, 17, 18, 14, 11, 12, 10, 7, 6, 6, 4, 4, 2, 0,
+0, -3, -4, -5, -6, -6, -6, -6, -8, -9, -11, -13, -16, -17, -18, -21,
+-25, -25, -29, -31, -33, -36, -37, -40, -42, -44, -44, -46, -48, -50, -49, -49,
+-50, -50, -51, -51, -53, -53, -53, -54, -55, -56, -56, -57, -57, -57, -58, -58,
+-57, -57, -57, -57, -58, -58, -57, -56, -56, -55, -53, -52, -51, -50, -49, -48,
+-47, -45, -44, -43, -42, -40, -38, -37, -36, -35, -33, -31, -30, -28, -27, -26,
+-24, -23, -22, -21, -20, -18, -16, -15, -13, -12, -11, -9, -9, -8, -6, -5,
+-4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10,
+10, 11, 11, 11, 12, 12, 12, 13, 14, 14, 14, 15, 15, 15, 15, 16,
+16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 18, 19, 19, 19,
+19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 21, 20, 20, 21, 21, 21,
+21, 21, 21, 20, 21, 20, 20, 20, 20, 20, 20, 20, 19, 19, 19, 19,
+19, 18, 18, 18, 17, 17, 17, 17, 16, 16, 16, 15, 15, 14, 14, 13,
+13, 13, 12, 12, 11, 11, 11, 10, 10, 9, 9, 8, 8, 7, 7, 7,
+6, 6, 5, 5, 5, 4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1,
+1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+0, 1, 3, 5, 7, 17, 23, 28, 38, 50, 63, 65, 64, 81, 80, 92,
+96, 87, 79, 89, 80, 73, 84, 87, 97, 86, 90, 86, 95, 105, 112, 104,
+106, 104, 108, 109, 112, 119, 119, 120, 113, 118, 119, 117, 106, 107, 104, 92,
+86, 87, 80, 76, 72, 71, 68, 66, 57, 60, 55, 50, 51, 55, 57, 50,
+53, 50, 55, 52, 54, 50, 55, 50, 52, 51, 44, 43, 39, 39, 39, 33,
+37, 30, 31, 31, 27, 25, 26, 24, 22, 25, 26, 28, 29, 30, 28, 26,
+26, 24, 28, 30, 29, 30, 28, 28, 24, 24, 23, 21, 20, 18, 19, 17,
+13, 10, 11, 8, 5, 5, 1, -2, -2, -5, -7, -6, -7, -7, -9, -10,
+-14, -17, -20, -22, -21, -22, -24, -25, -30, -32, -35, -37, -40, -42, -44, -47,
+-49, -49, -52, -54, -56, -58, -59, -60, -61, -63, -63, -62, -62, -64, -63, -62,
+-63, -62, -63, -62, -62, -61, -60, -61, -59, -58, -58, -58, -59, -58, -57, -56,
+-55, -53, -51, -50, -50, -49, -48, -46, -45, -43, -40, -38, -36, -34, -32, -30,
+-29, -27, -25, -24, -22, -20, -18, -16, -14, -12, -11, -10, -9, -8, -7, -6,
+-5, -3, -1, 0, 1, 2, 3, 5, 6, 6, 7, 8, 8, 9, 10, 11,
+11, 12, 12, 13, 14, 14, 15, 15, 16, 16, 17, 17, 17, 17, 18, 18,
+18, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 21, 21, 21,
+21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24,
+24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+25, 24, 24, 24, 23, 23, 22, 22, 21, 21, 20, 20, 19, 19, 18, 17,
+16, 16, 15, 14, 14, 13, 12, 12, 11, 10, 10, 9, 8, 8, 7, 6,
+6, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, -1, -1, -2, -2,
+-2, -3, -3, -3, -4, -4, -4, -4, -4, -4, -5, -5, -5, -5, -5, -5,
+-5, -5, -5, -5, -5, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3,
+-3, -3, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0,
+0, 1, 4, 10, 17, 23, 32, 35, 38, 51, 60, 70, 77, 73, 61, 62,
+70, 76, 72, 69, 65, 67, 63, 67, 78, 87, 86, 91, 95, 105, 103, 106,
+109, 113, 116, 120, 115, 110, 112, 103, 105, 101, 94, 98, 88, 80, 84, 75,
+73, 66, 72, 66, 64, 64, 65, 62, 67, 65, 61, 59, 59, 59, 62, 63,
+66, 68, 63, 64, 61, 54, 51, 46, 48, 44, 39, 38, 33, 30, 27, 27,
+28, 31, 27, 30, 28, 28, 28, 32, 28, 27, 29, 32, 35, 34, 36, 33,
+33, 33, 29, 30, 30, 30, 26, 26, 25, 22, 22, 22, 19, 17, 19, 20,
+18, 17, 19, 20, 19, 19, 19, 18, 18, 19, 16, 15, 13, 13, 12, 12,
+9, 7, 6, 6, 2, 2, -2, -3, -4, -6, -8, -10, -12, -14, -14, -15,
+-17, -19, -18, -19, -21, -22, -23, -24, -26, -28, -28, -29, -30, -33, -35, -36,
+-38, -38, -40, -42, -42, -43, -43, -44, -45, -46, -46, -47, -48, -48, -48, -50,
+-50, -50, -49, -49, -50, -49, -50, -50, -50, -50, -49, -48, -47, -48, -47, -47,
+-47, -46, -45, -45, -45, -44, -42, -41, -40, -39, -39, -38, -36, -34, -34, -33,
+-31, -30, -29, -28, -27, -26, -24, -23, -22, -20, -19, -18, -16, -16, -15, -14,
+-13, -11, -10, -9, -8, -8, -7, -6, -4, -4, -3, -1, -1, 1, 1, 2,
+3, 4, 4, 5, 6, 6, 7, 7, 7, 8, 9, 9, 9, 10, 10, 10,
+11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 14, 14, 14, 15,
+15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+15, 15, 15, 15, 15, 15, 14, 14, 14, 14, 14, 13, 13, 13, 13, 13,
+12, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10, 9, 9, 9, 8, 8,
+8, 7, 7, 7, 7, 6, 6, 6, 5, 5, 5, 4, 4, 4, 4, 3,
+3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
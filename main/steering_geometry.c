@@ -0,0 +1,149 @@
+/**
+ * @file steering_geometry.c
+ * @brief Axle groups of the steering modes and the turning-center geometry
+ *
+ * With one servo per axle, both wheels of an axle share an angle, so the
+ * model works on the centerline: left/right Ackermann within an axle is
+ * left to the steering linkage.
+ */
+
+#include "steering_geometry.h"
+#include <math.h>
+
+// Modes are defined on axle groups; AXLE_GROUPS in config.h maps the axles
+static const int8_t mode_group_sign[STEER_MODE_COUNT][AXLE_GROUP_COUNT] = {
+    //                      front fixed  rear
+    [STEER_MODE_FRONT]    = { 1,    0,    0},
+    [STEER_MODE_REAR]     = { 0,    0,   -1},
+    [STEER_MODE_ALL_AXLE] = { 1,    0,   -1},
+    [STEER_MODE_CRAB]     = { 1,    1,    1},
+};
+
+static const uint8_t axle_groups[SERVO_COUNT] = AXLE_GROUPS;
+
+axle_group_t steering_geometry_axle_group(uint8_t axle)
+{
+    if (axle >= SERVO_COUNT) {
+        return AXLE_GROUP_FIXED;
+    }
+    return (axle_group_t)axle_groups[axle];
+}
+
+int8_t steering_geometry_axle_sign(steering_mode_t mode, uint8_t axle)
+{
+    if (mode >= STEER_MODE_COUNT || axle >= SERVO_COUNT) {
+        return 0;
+    }
+    return mode_group_sign[mode][axle_groups[axle]];
+}
+
+bool steering_geometry_valid(const steering_tuning_t *steering)
+{
+    if (steering->max_angle_deg < GEOMETRY_MIN_ANGLE_DEG ||
+        steering->max_angle_deg > GEOMETRY_MAX_ANGLE_DEG) {
+        return false;
+    }
+    for (int i = 1; i < SERVO_COUNT; i++) {
+        if (steering->axle_pos_mm[i] <= steering->axle_pos_mm[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Turning center along the vehicle, in mm from axle 1
+ *
+ * Front and rear steer turn around the middle of the axles that stay
+ * straight (the rear bogie of an 8x8, the rear axle of a 4x4). In all-axle
+ * mode the outer axles' distances to the center are in the all-axle rear
+ * ratio, so 100% puts it midway and 0% on the last axle (front steer only).
+ * @return false for crab, where all wheels are parallel
+ */
+static bool turn_center_mm(const steering_tuning_t *steering, steering_mode_t mode, double *center)
+{
+    const uint16_t *x = steering->axle_pos_mm;
+
+    switch (mode) {
+        case STEER_MODE_FRONT:
+        case STEER_MODE_REAR: {
+            int first = -1, last = -1;
+            for (int i = 0; i < SERVO_COUNT; i++) {
+                if (steering_geometry_axle_sign(mode, i) == 0) {
+                    if (first < 0) first = i;
+                    last = i;
+                }
+            }
+            if (first < 0) {
+                return false;
+            }
+            *center = (x[first] + x[last]) / 2.0;
+            return true;
+        }
+        case STEER_MODE_ALL_AXLE: {
+            double r = steering->all_axle_rear_ratio / 100.0;
+            *center = (x[SERVO_COUNT - 1] + r * x[0]) / (1.0 + r);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Position for a steering input in 0..1000 (odd-symmetric)
+ */
+static double axle_position(const steering_tuning_t *steering, steering_mode_t mode,
+                            uint8_t axle, double steer)
+{
+    if (steering_geometry_axle_sign(mode, axle) == 0) {
+        return 0.0;
+    }
+
+    double center;
+    if (!turn_center_mm(steering, mode, &center)) {
+        return steer;
+    }
+
+    // Reference: the steered axle furthest from the center gets the lock angle
+    double d_ref = 0.0;
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        if (steering_geometry_axle_sign(mode, i) != 0) {
+            double d = fabs(center - steering->axle_pos_mm[i]);
+            if (d > d_ref) d_ref = d;
+        }
+    }
+    if (d_ref <= 0.0) {
+        return 0.0;
+    }
+
+    // tan(angle) = d / R for every axle, R set by the reference axle. Axles
+    // behind the center (d < 0) steer against the input.
+    double max_angle = steering->max_angle_deg * M_PI / 180.0;
+    double d = center - steering->axle_pos_mm[axle];
+    double angle = atan(tan(max_angle * steer / 1000.0) * d / d_ref);
+    return 1000.0 * angle / max_angle;
+}
+
+int16_t steering_geometry_position(const steering_tuning_t *steering, steering_mode_t mode,
+                                   uint8_t axle, int16_t steer)
+{
+    double mag = (steer < 0) ? -steer : steer;
+    if (mag > 1000) mag = 1000;
+
+    long position = lround(axle_position(steering, mode, axle, mag));
+    if (position > 1000) position = 1000;
+    if (position < -1000) position = -1000;
+    return (int16_t)((steer < 0) ? -position : position);
+}
+
+void steering_geometry_build(const steering_tuning_t *steering, steering_mode_t mode,
+                             uint8_t axle, int16_t *table, int segments)
+{
+    for (int i = 0; i <= segments; i++) {
+        long position = lround(axle_position(steering, mode, axle, (1000.0 * i) / segments));
+        if (position > 1000) position = 1000;
+        if (position < -1000) position = -1000;
+        table[i] = (int16_t)position;
+    }
+}
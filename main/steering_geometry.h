@@ -0,0 +1,61 @@
+/**
+ * @file steering_geometry.h
+ * @brief Axle groups of the steering modes and the turning-center geometry
+ *
+ * Each steering mode has a turning center on the vehicle's centerline. An
+ * axle at distance d from it needs atan(d / R) to roll around the same
+ * point, so inner axles steer less and axles behind the center steer the
+ * other way. The outermost steered axle reaches max_angle_deg at full
+ * stick. Uses floating point trig; tuning.c samples it into tables on
+ * config change, nothing here runs per tick.
+ */
+
+#ifndef STEERING_GEOMETRY_H
+#define STEERING_GEOMETRY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "config.h"
+
+/**
+ * @brief Group an axle belongs to (AXLE_GROUPS in config.h)
+ */
+axle_group_t steering_geometry_axle_group(uint8_t axle);
+
+/**
+ * @brief Direction an axle follows the steering input in a mode
+ *   Front:    front group steers, the rest fixed (like a car)
+ *   Rear:     rear group steers reversed for intuitive control, the rest fixed
+ *   All-axle: front group opposite to rear group for tighter turning
+ *   Crab:     all axles same direction
+ * @return 1, -1, or 0 for an axle that stays straight
+ */
+int8_t steering_geometry_axle_sign(steering_mode_t mode, uint8_t axle);
+
+/**
+ * @brief Check that the axle positions and lock angle describe a vehicle
+ * Positions must increase front to rear and the angle must be within
+ * GEOMETRY_MIN_ANGLE_DEG..GEOMETRY_MAX_ANGLE_DEG.
+ */
+bool steering_geometry_valid(const steering_tuning_t *steering);
+
+/**
+ * @brief Axle position for a steering input (reference, uses trig)
+ * @param steering Steering settings with valid geometry
+ * @param mode Steering mode
+ * @param axle Axle index (0 to SERVO_COUNT - 1)
+ * @param steer Steering input (-1000 to +1000)
+ * @return Signed axle position (-1000 to +1000, 1000 = max_angle_deg)
+ */
+int16_t steering_geometry_position(const steering_tuning_t *steering, steering_mode_t mode,
+                                   uint8_t axle, int16_t steer);
+
+/**
+ * @brief Sample the position curve for positive input into a table
+ * @param table Receives segments + 1 signed positions for steer
+ *              0, 1000/segments, ... 1000 (the curve is odd-symmetric)
+ */
+void steering_geometry_build(const steering_tuning_t *steering, steering_mode_t mode,
+                             uint8_t axle, int16_t *table, int segments);
+
+#endif // STEERING_GEOMETRY_H
@@ -0,0 +1,426 @@
+/**
+ * @file stress.c
+ * @brief Synthetic load test of the control loop, WebSocket, flash and audio
+ */
+
+#include "stress.h"
+#include "config.h"
+#include "rc_input.h"
+#include "calibration.h"
+#include "tuning.h"
+#include "perf.h"
+#include "capture.h"
+#include "audio_mixer.h"
+#include "engine_sound.h"
+#include "sound.h"
+#include "web_server.h"
+#include "ota_update.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include "esp_ota_ops.h"
+#include "esp_log.h"
+
+static const char *TAG = "STRESS";
+
+#define STRESS_SWEEP_STEER_MS       2000    // Full steering sweep period
+#define STRESS_SWEEP_THROTTLE_MS    3100    // Throttle sweep, not a multiple of steering
+#define STRESS_STEP_MS              250     // Hold time of each full-scale step
+#define STRESS_PRESS_MIN_MS         20      // AUX storm press/release lengths, all well
+#define STRESS_PRESS_MAX_MS         200     // under the menu long-press
+#define STRESS_SAMPLE_MS            1000    // Perf stage windows are one second long
+#define STRESS_IDLE_POLL_MS         10      // Task wakeup without flash load
+
+/**
+ * @brief Report of a finished run
+ */
+typedef struct {
+    bool valid;
+    stress_config_t config;
+    uint32_t elapsed_ms;
+    uint32_t frames;
+    uint32_t flash_kb;          // Erased and rewritten (0 without flash load)
+    bool flash_skipped;         // No OTA slot, or an OTA update ran
+    perf_summary_t edge_to_output;
+    perf_summary_t tick_to_loop;
+    uint32_t control_max_us;    // Slowest control pass in any one-second window
+    uint32_t audio_mix_max_us;  // Slowest mixer block
+    uint32_t overruns[PERF_LOOP_COUNT];
+    uint32_t deadline_misses;
+    uint32_t shed_events;
+    uint32_t underruns;
+    uint8_t dma_fill_min;       // Lowest DMA fill seen at write time (blocks)
+    uint8_t audio_load_max_pct;
+    uint32_t capture_dropped;
+} stress_report_t;
+
+static volatile bool running = false;
+static volatile bool stop_requested = false;
+static stress_config_t run;
+static stress_report_t report;                  // Written by the task before running clears
+static esp_timer_handle_t frame_timer = NULL;
+static uint8_t *flash_buf = NULL;
+
+// Frame generator state (esp_timer task only)
+static int64_t start_us = 0;
+static volatile uint32_t frames = 0;
+static uint32_t rng = 0x2545F491;               // Fixed seed: runs are repeatable
+static bool aux_pressed[2];
+static uint32_t aux_toggle_ms[2];
+
+static const char *pattern_names[STRESS_PATTERN_COUNT] = {
+    [STRESS_PATTERN_SWEEP] = "sweep",
+    [STRESS_PATTERN_STEP] = "step",
+    [STRESS_PATTERN_AUX_STORM] = "auxStorm",
+};
+
+const char *stress_pattern_name(stress_pattern_t pattern)
+{
+    return pattern < STRESS_PATTERN_COUNT ? pattern_names[pattern] : NULL;
+}
+
+static uint32_t rng_next(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+/**
+ * @brief Triangle wave from -1000 to +1000 and back over period_ms
+ */
+static int16_t triangle(uint32_t t_ms, uint32_t period_ms)
+{
+    uint32_t phase = t_ms % period_ms;
+    int32_t v = (int32_t)(phase * 4000 / period_ms);
+    return (int16_t)(v < 2000 ? v - 1000 : 3000 - v);
+}
+
+/**
+ * @brief Pulse width that calibrates back to value on a channel
+ */
+static uint16_t value_to_pulse(rc_channel_t channel, int16_t value)
+{
+    const channel_calibration_t *c = &calibration_get_data()->channels[channel];
+
+    if (c->reversed) {
+        value = -value;
+    }
+    int32_t range = value >= 0 ? (int32_t)c->max - c->center : (int32_t)c->center - c->min;
+    return (uint16_t)(c->center + range * value / 1000);
+}
+
+/**
+ * @brief Toggle an AUX button at random intervals
+ */
+static int16_t aux_storm(int button, uint32_t t_ms)
+{
+    if ((int32_t)(t_ms - aux_toggle_ms[button]) >= 0) {
+        aux_pressed[button] = !aux_pressed[button];
+        aux_toggle_ms[button] = t_ms + STRESS_PRESS_MIN_MS +
+                                rng_next() % (STRESS_PRESS_MAX_MS - STRESS_PRESS_MIN_MS + 1);
+    }
+    return aux_pressed[button] ? 1000 : -1000;
+}
+
+/**
+ * @brief Build and inject one synthetic frame (esp_timer task)
+ */
+static void frame_timer_callback(void *arg)
+{
+    (void)arg;
+    uint32_t t_ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+    int16_t value[RC_CHANNEL_COUNT] = {
+        [RC_CH_AUX1] = -1000,
+        [RC_CH_AUX2] = -1000,
+        [RC_CH_AUX3] = 0,       // Neutral: engine revs, ESC held at neutral
+        [RC_CH_AUX4] = -1000,   // Engine toggle left alone
+    };
+
+    switch (run.pattern) {
+        case STRESS_PATTERN_STEP: {
+            uint32_t step = t_ms / STRESS_STEP_MS;
+            static const int16_t throttle_steps[4] = { 0, 1000, 0, -1000 };
+            value[RC_CH_STEERING] = (step & 1) ? 1000 : -1000;
+            value[RC_CH_THROTTLE] = throttle_steps[step & 3];
+            break;
+        }
+        case STRESS_PATTERN_AUX_STORM:
+            value[RC_CH_AUX1] = aux_storm(0, t_ms);
+            value[RC_CH_AUX2] = aux_storm(1, t_ms);
+            // Fall through: sticks sweep underneath the presses
+        default:
+            value[RC_CH_STEERING] = triangle(t_ms, STRESS_SWEEP_STEER_MS);
+            value[RC_CH_THROTTLE] = triangle(t_ms, STRESS_SWEEP_THROTTLE_MS);
+            break;
+    }
+
+    uint16_t pulse_us[RC_CHANNEL_COUNT];
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        pulse_us[i] = value_to_pulse((rc_channel_t)i, value[i]);
+    }
+    rc_input_inject_frame(pulse_us, RC_CHANNEL_COUNT);
+    frames++;
+}
+
+/**
+ * @brief Erase and rewrite the next chunk of the inactive OTA slot
+ * @return false if the slot is unavailable or an OTA update is running
+ */
+static bool flash_step(const esp_partition_t *part, size_t *offset)
+{
+    if (part == NULL || ota_get_progress().status == OTA_STATUS_IN_PROGRESS) {
+        return false;
+    }
+
+    perf_flash_begin();
+    esp_err_t err = esp_partition_erase_range(part, *offset, STRESS_FLASH_CHUNK);
+    if (err == ESP_OK) {
+        err = esp_partition_write(part, *offset, flash_buf, STRESS_FLASH_CHUNK);
+    }
+    perf_flash_end();
+
+    *offset += STRESS_FLASH_CHUNK;
+    if (*offset + STRESS_FLASH_CHUNK > part->size) {
+        *offset = 0;
+    }
+    return err == ESP_OK;
+}
+
+static void stress_task(void *arg)
+{
+    (void)arg;
+    const esp_partition_t *part = run.flash ? esp_ota_get_next_update_partition(NULL) : NULL;
+    size_t flash_offset = 0;
+    uint32_t flash_chunks = 0;
+    bool flash_skipped = run.flash && part == NULL;
+    bool started_engine = false;
+
+    audio_mixer_stats_t audio;
+    audio_mixer_get_stats(&audio);
+    uint32_t underruns_base = audio.underruns;
+    uint32_t dropped_base = capture_get_dropped();
+
+    stress_report_t r = {
+        .config = run,
+        .dma_fill_min = UINT8_MAX,
+    };
+
+    // Loads first, so the first synthetic frames already see them
+    if (run.ws) {
+        web_server_set_ws_stress(true);
+    }
+    if (run.sound && engine_sound_is_enabled() && engine_sound_get_state() == ENGINE_OFF) {
+        engine_sound_start();
+        started_engine = true;
+    }
+    perf_reset();
+    start_us = esp_timer_get_time();
+    esp_timer_start_periodic(frame_timer, 1000000 / run.rate_hz);
+
+    int64_t end_us = start_us + (int64_t)run.duration_s * 1000000;
+    int64_t next_sample_us = start_us + STRESS_SAMPLE_MS * 1000;
+    int64_t next_tone_us = start_us;
+    int64_t now = start_us;
+
+    while (!stop_requested && (now = esp_timer_get_time()) < end_us) {
+        if (run.flash && !flash_skipped) {
+            if (flash_step(part, &flash_offset)) {
+                flash_chunks++;
+            } else {
+                flash_skipped = true;
+                ESP_LOGW(TAG, "Flash load stopped");
+            }
+            vTaskDelay(1);
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(STRESS_IDLE_POLL_MS));
+        }
+
+        if (run.sound && now >= next_tone_us) {
+            next_tone_us = now + STRESS_UI_SOUND_MS * 1000;
+            sound_play_tone(880 + (frames % 8) * 110, STRESS_UI_SOUND_MS / 4, 50);
+        }
+
+        // Stage maxima only cover the last window, so keep the worst of each
+        if (now >= next_sample_us) {
+            next_sample_us += STRESS_SAMPLE_MS * 1000;
+            perf_stage_summary_t stage;
+            perf_get_stage(PERF_STAGE_CONTROL, &stage);
+            if (stage.max_us > r.control_max_us) r.control_max_us = stage.max_us;
+            perf_get_stage(PERF_STAGE_AUDIO_MIX, &stage);
+            if (stage.max_us > r.audio_mix_max_us) r.audio_mix_max_us = stage.max_us;
+            audio_mixer_get_stats(&audio);
+            if (audio.dma_fill_min < r.dma_fill_min) r.dma_fill_min = audio.dma_fill_min;
+            if (audio.load_max_pct > r.audio_load_max_pct) r.audio_load_max_pct = audio.load_max_pct;
+        }
+    }
+
+    esp_timer_stop(frame_timer);
+    rc_input_set_synthetic(false);
+    if (run.ws) {
+        web_server_set_ws_stress(false);
+    }
+    if (started_engine) {
+        engine_sound_stop();
+    }
+
+    r.valid = true;
+    r.elapsed_ms = (uint32_t)((now - start_us) / 1000);
+    r.frames = frames;
+    r.flash_kb = flash_chunks * (STRESS_FLASH_CHUNK / 1024);
+    r.flash_skipped = flash_skipped;
+    perf_get_summary(PERF_LAT_EDGE_TO_OUTPUT, &r.edge_to_output);
+    perf_get_summary(PERF_LAT_TICK_TO_LOOP, &r.tick_to_loop);
+    for (int i = 0; i < PERF_LOOP_COUNT; i++) {
+        r.overruns[i] = perf_get_overruns((perf_loop_t)i);
+    }
+    r.deadline_misses = perf_get_deadline_misses();
+    r.shed_events = perf_get_shed_events();
+    audio_mixer_get_stats(&audio);
+    r.underruns = audio.underruns - underruns_base;
+    r.capture_dropped = capture_get_dropped() - dropped_base;
+    if (r.dma_fill_min == UINT8_MAX) {
+        r.dma_fill_min = 0;
+    }
+    report = r;
+
+    ESP_LOGI(TAG, "Done: %lu frames in %lu ms, %lu deadline misses, %lu underruns, "
+             "edge-to-output p99 %lu us max %lu us",
+             (unsigned long)r.frames, (unsigned long)r.elapsed_ms,
+             (unsigned long)r.deadline_misses, (unsigned long)r.underruns,
+             (unsigned long)r.edge_to_output.p99_us, (unsigned long)r.edge_to_output.max_us);
+
+    free(flash_buf);
+    flash_buf = NULL;
+    __atomic_store_n(&running, false, __ATOMIC_SEQ_CST);
+    vTaskDelete(NULL);
+}
+
+esp_err_t stress_start(const stress_config_t *config)
+{
+    if (config->pattern >= STRESS_PATTERN_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!tuning_is_motor_stopped() || calibration_in_progress()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (__atomic_exchange_n(&running, true, __ATOMIC_SEQ_CST)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    run = *config;
+    if (run.rate_hz < STRESS_RATE_MIN_HZ) run.rate_hz = STRESS_RATE_MIN_HZ;
+    if (run.rate_hz > STRESS_RATE_MAX_HZ) run.rate_hz = STRESS_RATE_MAX_HZ;
+    if (run.duration_s < 1) run.duration_s = 1;
+    if (run.duration_s > STRESS_DURATION_MAX_S) run.duration_s = STRESS_DURATION_MAX_S;
+
+    esp_err_t err = ESP_OK;
+    if (frame_timer == NULL) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = frame_timer_callback,
+            .name = "stress",
+        };
+        err = esp_timer_create(&timer_args, &frame_timer);
+    }
+    if (err == ESP_OK && run.flash) {
+        flash_buf = malloc(STRESS_FLASH_CHUNK);
+        if (flash_buf == NULL) {
+            err = ESP_ERR_NO_MEM;
+        } else {
+            for (int i = 0; i < STRESS_FLASH_CHUNK; i++) {
+                flash_buf[i] = (uint8_t)i;
+            }
+        }
+    }
+    if (err != ESP_OK) {
+        __atomic_store_n(&running, false, __ATOMIC_SEQ_CST);
+        return err;
+    }
+
+    frames = 0;
+    stop_requested = false;
+    aux_pressed[0] = aux_pressed[1] = false;
+    aux_toggle_ms[0] = aux_toggle_ms[1] = 0;
+    rc_input_set_synthetic(true);
+
+    ESP_LOGW(TAG, "Started: %s at %u Hz for %u s%s%s%s", pattern_names[run.pattern],
+             run.rate_hz, run.duration_s, run.ws ? ", WebSocket" : "",
+             run.flash ? ", flash" : "", run.sound ? ", sound" : "");
+
+    BaseType_t ret = xTaskCreatePinnedToCore(stress_task, "stress", STRESS_TASK_STACK_SIZE, NULL,
+                                             STRESS_TASK_PRIORITY, NULL, STRESS_TASK_CORE);
+    if (ret != pdPASS) {
+        rc_input_set_synthetic(false);
+        free(flash_buf);
+        flash_buf = NULL;
+        __atomic_store_n(&running, false, __ATOMIC_SEQ_CST);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void stress_stop(void)
+{
+    stop_requested = true;
+}
+
+bool stress_is_running(void)
+{
+    return running;
+}
+
+static int append_summary(char *buf, size_t len, const char *key, const perf_summary_t *s)
+{
+    return snprintf(buf, len, ",\"%s\":{\"count\":%lu,\"min\":%lu,\"avg\":%lu,\"p99\":%lu,\"max\":%lu}",
+                    key, (unsigned long)s->count, (unsigned long)s->min_us, (unsigned long)s->avg_us,
+                    (unsigned long)s->p99_us, (unsigned long)s->max_us);
+}
+
+int stress_to_json(char *buf, size_t len)
+{
+    if (running) {
+        return snprintf(buf, len,
+            "{\"running\":true,\"pattern\":\"%s\",\"rateHz\":%u,\"durationS\":%u,"
+            "\"elapsedMs\":%lu,\"frames\":%lu}",
+            pattern_names[run.pattern], run.rate_hz, run.duration_s,
+            (unsigned long)((esp_timer_get_time() - start_us) / 1000), (unsigned long)frames);
+    }
+    if (!report.valid) {
+        return snprintf(buf, len, "{\"running\":false,\"last\":null}");
+    }
+
+    const stress_report_t *r = &report;
+    int n = snprintf(buf, len,
+        "{\"running\":false,\"last\":{\"pattern\":\"%s\",\"rateHz\":%u,\"durationS\":%u,"
+        "\"ws\":%s,\"flash\":%s,\"sound\":%s,\"elapsedMs\":%lu,\"frames\":%lu,"
+        "\"flashKB\":%lu,\"flashSkipped\":%s",
+        pattern_names[r->config.pattern], r->config.rate_hz, r->config.duration_s,
+        r->config.ws ? "true" : "false", r->config.flash ? "true" : "false",
+        r->config.sound ? "true" : "false", (unsigned long)r->elapsed_ms,
+        (unsigned long)r->frames, (unsigned long)r->flash_kb, r->flash_skipped ? "true" : "false");
+    if (n < (int)len) {
+        n += append_summary(buf + n, len - n, "edgeToOutput", &r->edge_to_output);
+    }
+    if (n < (int)len) {
+        n += append_summary(buf + n, len - n, "tickToLoop", &r->tick_to_loop);
+    }
+    if (n < (int)len) {
+        n += snprintf(buf + n, len - n,
+            ",\"controlMaxUs\":%lu,\"audioMixMaxUs\":%lu,\"overruns\":{\"control\":%lu,"
+            "\"housekeeping\":%lu},\"deadlineMisses\":%lu,\"shedEvents\":%lu,\"underruns\":%lu,"
+            "\"dmaFillMin\":%u,\"audioLoadMaxPct\":%u,\"captureDropped\":%lu}}",
+            (unsigned long)r->control_max_us, (unsigned long)r->audio_mix_max_us,
+            (unsigned long)r->overruns[PERF_LOOP_CONTROL],
+            (unsigned long)r->overruns[PERF_LOOP_HOUSEKEEPING],
+            (unsigned long)r->deadline_misses, (unsigned long)r->shed_events,
+            (unsigned long)r->underruns, r->dma_fill_min, r->audio_load_max_pct,
+            (unsigned long)r->capture_dropped);
+    }
+    return n;
+}
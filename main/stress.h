@@ -0,0 +1,84 @@
+/**
+ * @file stress.h
+ * @brief Synthetic load test of the control loop, WebSocket, flash and audio
+ *
+ * Replaces the receiver with generated RC frames (rc_input_set_synthetic)
+ * at a chosen rate and pattern, and optionally piles on the other loads the
+ * vehicle sees at its worst: every WebSocket client receiving keyframes and
+ * the capture stream, OTA-sized flash writes into the inactive OTA slot,
+ * and the engine running with horn presses and UI prompts on top. Latency,
+ * deadline misses, shedding and audio underruns over the run are reported
+ * by stress_to_json().
+ *
+ * The throttle-mode channel (AUX3) is held at center, so the ESC stays at
+ * neutral while the engine revs with the synthetic throttle; the steering
+ * servos do follow the pattern. The flash load overwrites whatever the
+ * inactive OTA slot holds (the rollback image).
+ */
+
+#ifndef STRESS_H
+#define STRESS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/**
+ * @brief Synthetic stick and button patterns
+ */
+typedef enum {
+    STRESS_PATTERN_SWEEP = 0,   // Throttle and steering triangle sweeps
+    STRESS_PATTERN_STEP,        // Full-scale steps (worst-case slew every few frames)
+    STRESS_PATTERN_AUX_STORM,   // Sweeps plus random short AUX1/AUX2 presses
+    STRESS_PATTERN_COUNT
+} stress_pattern_t;
+
+/**
+ * @brief One stress run
+ */
+typedef struct {
+    uint8_t pattern;            // stress_pattern_t
+    uint16_t rate_hz;           // Synthetic frame rate (STRESS_RATE_MIN_HZ..STRESS_RATE_MAX_HZ)
+    uint16_t duration_s;        // Run length (1..STRESS_DURATION_MAX_S)
+    bool ws;                    // Keyframes and capture stream to every WebSocket client
+    bool flash;                 // Continuous erase + write of the inactive OTA slot
+    bool sound;                 // Engine running, UI tones every STRESS_UI_SOUND_MS
+} stress_config_t;
+
+/**
+ * @brief Start a run (returns at once; the run ends on its own)
+ *
+ * Resets the perf counters so the report covers this run only.
+ * @param config Run parameters (rate and duration are clamped)
+ * @return ESP_ERR_INVALID_STATE if a run is active, the motor is turning
+ *         or calibration is in progress; ESP_ERR_INVALID_ARG for a bad
+ *         pattern; ESP_ERR_NO_MEM
+ */
+esp_err_t stress_start(const stress_config_t *config);
+
+/**
+ * @brief End the active run early (no-op when idle)
+ */
+void stress_stop(void);
+
+/**
+ * @brief Check whether a run is active
+ */
+bool stress_is_running(void);
+
+/**
+ * @brief Get the short name of a pattern (used in the JSON API)
+ * @return Name, or NULL past the last pattern
+ */
+const char *stress_pattern_name(stress_pattern_t pattern);
+
+/**
+ * @brief Write the state of the active run, or the report of the last one
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Number of characters written
+ */
+int stress_to_json(char *buf, size_t len);
+
+#endif // STRESS_H
@@ -0,0 +1,289 @@
+/**
+ * @file task_stats.c
+ * @brief Per-task CPU load, stack high-water marks and core idle time
+ *
+ * Run-time counters are esp_timer microseconds (the ESP-IDF default clock),
+ * so a task's delta over the period divided by the period is its share of
+ * the core it ran on. Tasks are matched between samples by task number;
+ * a task created during the period shows no load until the next one.
+ *
+ * With CONFIG_CRAWLER_HEAP_COUNT (menuconfig, which turns on the heap hooks)
+ * the heap calls every allocation and free through the hooks below, which count them per task number, so a task
+ * that touches the heap once it is running shows up in the report.
+ */
+
+#include "task_stats.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "TASK_STATS";
+
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static task_stats_t snapshot;
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY && CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+
+#if CONFIG_CRAWLER_HEAP_COUNT
+
+// Heap operations since boot, per task number (slot 0: before the scheduler
+// started, and task numbers past the table)
+static uint32_t heap_allocs = 0;
+static uint32_t heap_frees = 0;
+static uint32_t heap_task_ops[TASK_STATS_HEAP_SLOTS];
+
+/**
+ * @brief Count a heap operation against the running task
+ *
+ * Runs inside malloc/free on either core, possibly from an ISR (which is
+ * charged to the task it interrupted).
+ */
+static IRAM_ATTR void heap_count(uint32_t *total)
+{
+    UBaseType_t number = uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle());
+    if (number >= TASK_STATS_HEAP_SLOTS) {
+        number = 0;
+    }
+    __atomic_fetch_add(total, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&heap_task_ops[number], 1, __ATOMIC_RELAXED);
+}
+
+IRAM_ATTR void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps)
+{
+    (void)size;
+    (void)caps;
+    if (ptr != NULL) {
+        heap_count(&heap_allocs);
+    }
+}
+
+IRAM_ATTR void esp_heap_trace_free_hook(void *ptr)
+{
+    if (ptr != NULL) {
+        heap_count(&heap_frees);
+    }
+}
+
+static bool heap_counted(void)
+{
+    return true;
+}
+
+static uint32_t heap_ops_of(UBaseType_t number)
+{
+    return number < TASK_STATS_HEAP_SLOTS ? __atomic_load_n(&heap_task_ops[number], __ATOMIC_RELAXED) : 0;
+}
+
+#else
+
+static uint32_t heap_allocs = 0;
+static uint32_t heap_frees = 0;
+
+static bool heap_counted(void)
+{
+    return false;
+}
+
+static uint32_t heap_ops_of(UBaseType_t number)
+{
+    (void)number;
+    return 0;
+}
+
+#endif
+
+typedef struct {
+    UBaseType_t number;
+    configRUN_TIME_COUNTER_TYPE runtime;
+    uint32_t heap_ops;
+    bool stack_warned;
+} task_prev_t;
+
+// Collector state (collector task only)
+static TaskStatus_t status[TASK_STATS_MAX_TASKS];
+static task_prev_t prev[TASK_STATS_MAX_TASKS];
+static task_prev_t cur[TASK_STATS_MAX_TASKS];
+static int prev_count = 0;
+static configRUN_TIME_COUNTER_TYPE prev_total = 0;
+
+/**
+ * @brief A task as it was at the previous sample
+ * @return NULL if the task did not exist then
+ */
+static const task_prev_t *prev_find(UBaseType_t number)
+{
+    for (int i = 0; i < prev_count; i++) {
+        if (prev[i].number == number) {
+            return &prev[i];
+        }
+    }
+    return NULL;
+}
+
+static uint16_t permille(uint32_t part, uint32_t whole)
+{
+    if (whole == 0) {
+        return 0;
+    }
+    uint32_t p = (uint32_t)(((uint64_t)part * 1000 + whole / 2) / whole);
+    return (uint16_t)(p > 1000 ? 1000 : p);
+}
+
+/**
+ * @brief Sample every task and publish the deltas since the last sample
+ */
+static void task_stats_sample(void)
+{
+    static task_stats_t next;
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    // Returns 0 when there are more tasks than slots: nothing is reported
+    UBaseType_t n = uxTaskGetSystemState(status, TASK_STATS_MAX_TASKS, &total);
+
+    uint32_t elapsed = (uint32_t)(total - prev_total);
+    memset(&next, 0, sizeof(next));
+    next.enabled = true;
+    next.period_ms = prev_total ? elapsed / 1000 : 0;
+    next.cores = portNUM_PROCESSORS;
+    next.truncated = n == 0;
+    next.heap_counted = heap_counted();
+    next.heap_allocs = __atomic_load_n(&heap_allocs, __ATOMIC_RELAXED);
+    next.heap_frees = __atomic_load_n(&heap_frees, __ATOMIC_RELAXED);
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t *t = &status[i];
+        const task_prev_t *before = prev_find(t->xTaskNumber);
+        uint16_t cpu = 0;
+        if (prev_total && before) {
+            cpu = permille((uint32_t)(t->ulRunTimeCounter - before->runtime), elapsed);
+        }
+        uint32_t heap_ops = heap_ops_of(t->xTaskNumber);
+
+        BaseType_t core = xTaskGetCoreID(t->xHandle);
+        for (int c = 0; c < portNUM_PROCESSORS && c < 2; c++) {
+            if (t->xHandle == xTaskGetIdleTaskHandleForCore(c)) {
+                next.idle_permille[c] = cpu;
+            }
+        }
+
+        task_stats_entry_t *e = &next.tasks[next.count++];
+        strlcpy(e->name, t->pcTaskName, sizeof(e->name));
+        e->core = (core == tskNO_AFFINITY) ? TASK_STATS_NO_CORE : (uint8_t)core;
+        e->priority = (uint8_t)t->uxCurrentPriority;
+        e->cpu_permille = cpu;
+        e->stack_free = t->usStackHighWaterMark;   // Bytes (ESP-IDF stacks are byte arrays)
+        e->heap_total = heap_ops;
+        e->heap_ops = before ? heap_ops - before->heap_ops : 0;
+
+        cur[i] = (task_prev_t){
+            .number = t->xTaskNumber,
+            .runtime = t->ulRunTimeCounter,
+            .heap_ops = heap_ops,
+            .stack_warned = before && before->stack_warned,
+        };
+        if (e->stack_free < TASK_STATS_STACK_WARN_BYTES && !cur[i].stack_warned) {
+            cur[i].stack_warned = true;
+            ESP_LOGW(TAG, "Task %s: only %lu bytes of stack left", e->name, (unsigned long)e->stack_free);
+        }
+    }
+
+    memcpy(prev, cur, n * sizeof(prev[0]));
+    prev_count = (int)n;
+    prev_total = total;
+
+    portENTER_CRITICAL(&stats_lock);
+    memcpy(&snapshot, &next, sizeof(snapshot));
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+static void task_stats_task(void *arg)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    while (1) {
+        task_stats_sample();
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(TASK_STATS_PERIOD_MS));
+    }
+}
+
+esp_err_t task_stats_init(void)
+{
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        task_stats_task,
+        "task_stats",
+        TASK_STATS_TASK_STACK_SIZE,
+        NULL,
+        TASK_STATS_TASK_PRIORITY,
+        NULL,
+        TASK_STATS_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create collector task");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Sampling up to %d tasks every %d ms", TASK_STATS_MAX_TASKS, TASK_STATS_PERIOD_MS);
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t task_stats_init(void)
+{
+    ESP_LOGW(TAG, "FreeRTOS run-time stats are off in sdkconfig, no task stats");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif
+
+void task_stats_get(task_stats_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&stats_lock);
+    memcpy(out, &snapshot, sizeof(*out));
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+int task_stats_to_json(char *buf, size_t len)
+{
+    static task_stats_t st;     // Too big for the httpd stack next to the response
+    task_stats_get(&st);
+
+    size_t pos = 0;
+    int n = snprintf(buf, len, "{\"enabled\":%s,\"periodMs\":%lu,\"truncated\":%s,"
+                     "\"heap\":{\"counted\":%s,\"allocs\":%lu,\"frees\":%lu},\"idle\":[",
+                     st.enabled ? "true" : "false", (unsigned long)st.period_ms,
+                     st.truncated ? "true" : "false", st.heap_counted ? "true" : "false",
+                     (unsigned long)st.heap_allocs, (unsigned long)st.heap_frees);
+    pos = (n < 0) ? len : (size_t)n;
+
+    for (int c = 0; c < st.cores && pos < len; c++) {
+        n = snprintf(buf + pos, len - pos, "%s%u.%u", c ? "," : "",
+                     st.idle_permille[c] / 10, st.idle_permille[c] % 10);
+        pos = (n < 0) ? len : pos + n;
+    }
+    if (pos < len) {
+        n = snprintf(buf + pos, len - pos, "],\"tasks\":[");
+        pos = (n < 0) ? len : pos + n;
+    }
+
+    for (int i = 0; i < st.count && pos < len; i++) {
+        const task_stats_entry_t *e = &st.tasks[i];
+        n = snprintf(buf + pos, len - pos,
+                     "%s{\"name\":\"%s\",\"core\":%d,\"prio\":%u,\"cpu\":%u.%u,\"stackFree\":%lu,"
+                     "\"heapOps\":%lu,\"heapTotal\":%lu}",
+                     i ? "," : "", e->name, e->core == TASK_STATS_NO_CORE ? -1 : e->core,
+                     e->priority, e->cpu_permille / 10, e->cpu_permille % 10,
+                     (unsigned long)e->stack_free, (unsigned long)e->heap_ops,
+                     (unsigned long)e->heap_total);
+        pos = (n < 0) ? len : pos + n;
+    }
+    if (pos < len) {
+        n = snprintf(buf + pos, len - pos, "]}");
+        pos = (n < 0) ? len : pos + n;
+    }
+    return (int)pos;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file task_stats.h
+ * @brief Per-task CPU load, stack high-water marks and core idle time
+ *
+ * A low-priority collector samples the FreeRTOS run-time counters of every
+ * task once per TASK_STATS_PERIOD_MS and turns the deltas into a CPU share
+ * per task and an idle share per core, together with each task's lowest
+ * free stack since it started. Served as /api/tasks for the dashboard, so
+ * stacks can be sized and CPU hogs found on a running car.
+ *
+ * With CONFIG_CRAWLER_HEAP_COUNT the heap operations of each task are counted
+ * too, so the tasks that must not allocate once running (control loop,
+ * audio mixer, RC input) can be shown to stay at zero.
+ *
+ * Needs CONFIG_FREERTOS_USE_TRACE_FACILITY and
+ * CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS (sdkconfig.defaults); without
+ * them the collector is not started and the report says so.
+ */
+
+#ifndef TASK_STATS_H
+#define TASK_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "config.h"
+
+#define TASK_STATS_NAME_LEN     16
+#define TASK_STATS_NO_CORE      0xFF    // Task not pinned
+
+/**
+ * @brief One task over the last period
+ */
+typedef struct {
+    char name[TASK_STATS_NAME_LEN];
+    uint8_t core;               // Pinned core, or TASK_STATS_NO_CORE
+    uint8_t priority;           // Current (may be inherited)
+    uint16_t cpu_permille;      // Share of one core
+    uint32_t stack_free;        // Lowest free stack since start (bytes)
+    uint32_t heap_ops;          // Allocations + frees over the period
+    uint32_t heap_total;        // Allocations + frees since start
+} task_stats_entry_t;
+
+/**
+ * @brief Snapshot of the last complete period
+ */
+typedef struct {
+    bool enabled;               // Run-time stats compiled in and collector running
+    uint32_t period_ms;         // Length of the sampled period (0 before the first)
+    uint16_t idle_permille[2];  // Per core
+    uint8_t cores;
+    uint8_t count;              // Tasks in tasks[]
+    bool truncated;             // More tasks than TASK_STATS_MAX_TASKS
+    bool heap_counted;          // Heap hooks compiled in
+    uint32_t heap_allocs;       // Since boot, all tasks
+    uint32_t heap_frees;
+    task_stats_entry_t tasks[TASK_STATS_MAX_TASKS];
+} task_stats_t;
+
+/**
+ * @brief Start the collector task
+ * @return ESP_OK, ESP_ERR_NOT_SUPPORTED without run-time stats, ESP_ERR_NO_MEM
+ */
+esp_err_t task_stats_init(void);
+
+/**
+ * @brief Copy the latest snapshot
+ */
+void task_stats_get(task_stats_t *out);
+
+/**
+ * @brief Format the latest snapshot as a JSON object
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @return Characters written (as snprintf)
+ */
+int task_stats_to_json(char *buf, size_t len);
+
+#endif // TASK_STATS_H
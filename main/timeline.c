@@ -0,0 +1,124 @@
+/**
+ * @file timeline.c
+ * @brief Task and ISR timeline ring
+ *
+ * Both cores and their ISRs write the ring, so each writer claims a slot
+ * with an atomic increment of the head and fills it in place. The reader
+ * holds recording and waits a moment for writes in flight to land, as the
+ * flight recorder download does. Everything a writer touches is in IRAM or
+ * internal RAM: the scheduler hook and the traced ISRs also run while the
+ * flash cache is disabled.
+ */
+
+#include "timeline.h"
+
+#if CONFIG_CRAWLER_TIMELINE
+
+#include "config.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "TIMELINE";
+
+_Static_assert(sizeof(timeline_event_t) == 12, "timeline event layout must match tools/timeline-decode.js");
+_Static_assert(sizeof(timeline_file_header_t) == 24, "timeline header layout must match tools/timeline-decode.js");
+_Static_assert(sizeof(timeline_task_name_t) == 20, "timeline task name layout must match tools/timeline-decode.js");
+_Static_assert((TIMELINE_EVENTS & (TIMELINE_EVENTS - 1)) == 0, "TIMELINE_EVENTS must be a power of 2");
+_Static_assert(TIMELINE_POST_TRIGGER < TIMELINE_EVENTS, "post-trigger events must leave room for the lead-up");
+
+static timeline_event_t *ring = NULL;
+static uint32_t head = 0;                   // Events claimed since the ring started
+static volatile bool hold = false;
+static volatile bool armed = false;
+static volatile uint32_t stop_at = 0;       // Head at which an armed ring froze (0: running)
+
+esp_err_t timeline_init(void)
+{
+    if (ring) {
+        return ESP_OK;
+    }
+    ring = heap_caps_calloc(TIMELINE_EVENTS, sizeof(timeline_event_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!ring) {
+        ESP_LOGW(TAG, "No memory for the timeline ring");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Timeline tracing: %d events (%u KB)", TIMELINE_EVENTS,
+             (unsigned)(TIMELINE_EVENTS * sizeof(timeline_event_t) / 1024));
+    return ESP_OK;
+}
+
+void IRAM_ATTR timeline_record(timeline_event_type_t type, uint32_t arg)
+{
+    if (!ring || hold) {
+        return;
+    }
+    uint32_t stop = stop_at;
+    if (stop != 0 && __atomic_load_n(&head, __ATOMIC_RELAXED) >= stop) {
+        return;
+    }
+
+    uint32_t n = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+    timeline_event_t *e = &ring[n % TIMELINE_EVENTS];
+    e->t_us = (uint32_t)esp_timer_get_time();
+    e->arg = arg;
+    e->type = type;
+    e->core = xPortGetCoreID();
+}
+
+void IRAM_ATTR timeline_task_switched_in(void)
+{
+    timeline_record(TIMELINE_EV_TASK, (uint32_t)xTaskGetCurrentTaskHandle());
+}
+
+void timeline_trigger(void)
+{
+    if (!armed || stop_at != 0 || !ring) {
+        return;
+    }
+    timeline_record(TIMELINE_EV_TRIGGER, 0);
+    stop_at = __atomic_load_n(&head, __ATOMIC_RELAXED) + TIMELINE_POST_TRIGGER;
+}
+
+void timeline_arm(bool arm)
+{
+    armed = arm;
+    stop_at = 0;
+}
+
+bool timeline_is_armed(bool *triggered)
+{
+    if (triggered) {
+        *triggered = stop_at != 0;
+    }
+    return armed;
+}
+
+void timeline_set_hold(bool on)
+{
+    hold = on;
+}
+
+size_t timeline_get_span(const timeline_event_t **first, size_t *first_count,
+                         const timeline_event_t **second, size_t *second_count)
+{
+    uint32_t written = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    size_t count = written < TIMELINE_EVENTS ? written : TIMELINE_EVENTS;
+    size_t start = (written - count) % TIMELINE_EVENTS;
+
+    *first = ring + start;
+    *first_count = (start + count <= TIMELINE_EVENTS) ? count : TIMELINE_EVENTS - start;
+    *second = ring;
+    *second_count = count - *first_count;
+    return ring ? count : 0;
+}
+
+size_t timeline_capacity(void)
+{
+    return ring ? TIMELINE_EVENTS : 0;
+}
+
+#endif // CONFIG_CRAWLER_TIMELINE
@@ -0,0 +1,177 @@
+/**
+ * @file timeline.h
+ * @brief Task and ISR timeline tracing (CONFIG_CRAWLER_TIMELINE builds)
+ *
+ * Records every task switch on both cores, entry and exit of the RC
+ * capture, PPM, servo timer, I2S and light strip callbacks, and begin/end
+ * markers around the control tick, each mixer block and each WebSocket send
+ * pass into a RAM ring. /api/trace/timeline downloads the ring with the
+ * names of the running tasks; tools/timeline-decode.js turns it into a
+ * Chrome trace JSON file that Perfetto (ui.perfetto.dev) or chrome://tracing
+ * opens, one track per core for tasks, ISRs and each marker.
+ *
+ * The ring runs free and holds the last TIMELINE_EVENTS events. Armed, it
+ * freezes TIMELINE_POST_TRIGGER events after the next control loop deadline
+ * miss, so the download shows what held the loop off.
+ *
+ * Task switches come from the FreeRTOS traceTASK_SWITCHED_IN() hook, defined
+ * in timeline_hooks.h, which the project CMakeLists.txt includes in every C
+ * file so that the kernel sees it. Without the option every TIMELINE_*
+ * macro below compiles to nothing.
+ */
+
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#define TIMELINE_FILE_MAGIC     0x4E4C4D54  // "TMLN"
+#define TIMELINE_FILE_VERSION   1
+#define TIMELINE_NAME_LEN       16
+
+/**
+ * @brief Event types
+ */
+typedef enum {
+    TIMELINE_EV_TASK = 0,       // Task switched in (arg: task handle)
+    TIMELINE_EV_ISR_ENTER,      // arg: timeline_isr_t
+    TIMELINE_EV_ISR_EXIT,
+    TIMELINE_EV_MARK_BEGIN,     // arg: timeline_mark_t
+    TIMELINE_EV_MARK_END,
+    TIMELINE_EV_TRIGGER,        // Control deadline miss that froze an armed ring
+} timeline_event_type_t;
+
+/**
+ * @brief Traced interrupt callbacks (run inside the driver's ISR)
+ */
+typedef enum {
+    TIMELINE_ISR_RC_CAPTURE = 0,    // MCPWM capture edge (PWM receiver)
+    TIMELINE_ISR_RC_PPM,            // RMT receive done (PPM frame)
+    TIMELINE_ISR_SERVO_TIMER,       // Servo MCPWM timer empty (period start)
+    TIMELINE_ISR_I2S_SENT,          // I2S DMA buffer sent
+    TIMELINE_ISR_RMT_LIGHTS,        // Light strip RMT transmit done
+    TIMELINE_ISR_COUNT
+} timeline_isr_t;
+
+/**
+ * @brief Traced spans
+ */
+typedef enum {
+    TIMELINE_MARK_CONTROL = 0,      // Control tick (wake to loop end)
+    TIMELINE_MARK_MIXER,            // Mixer block (render, mix, before the I2S write)
+    TIMELINE_MARK_WS_SEND,          // WebSocket send pass (httpd task)
+    TIMELINE_MARK_COUNT
+} timeline_mark_t;
+
+/**
+ * @brief One event (wire format, little endian, 12 bytes)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t t_us;              // esp_timer time, low 32 bits
+    uint32_t arg;
+    uint8_t type;               // timeline_event_type_t
+    uint8_t core;
+    uint16_t reserved;
+} timeline_event_t;
+
+/**
+ * @brief Download header, followed by task_count names and count events
+ *        oldest first
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;             // TIMELINE_FILE_MAGIC
+    uint16_t version;           // TIMELINE_FILE_VERSION
+    uint16_t event_size;        // sizeof(timeline_event_t)
+    uint32_t count;
+    uint32_t capacity;          // Ring size in events
+    uint16_t task_count;
+    uint8_t triggered;          // Ring froze on a deadline miss
+    uint8_t reserved;
+    uint32_t uptime_ms;         // When the download started
+} timeline_file_header_t;
+
+/**
+ * @brief Task handle to name, for the tasks alive at download time
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t handle;
+    char name[TIMELINE_NAME_LEN];
+} timeline_task_name_t;
+
+#if CONFIG_CRAWLER_TIMELINE
+
+/**
+ * @brief Allocate the ring (internal RAM: ISRs write it with the flash cache off)
+ * @return ESP_OK, or ESP_ERR_NO_MEM (tracing stays off)
+ */
+esp_err_t timeline_init(void);
+
+/**
+ * @brief Record an event (any task or ISR, either core)
+ */
+void timeline_record(timeline_event_type_t type, uint32_t arg);
+
+/**
+ * @brief Scheduler hook: the current task on this core was just switched in
+ */
+void timeline_task_switched_in(void);
+
+/**
+ * @brief Control deadline missed: freeze the ring soon if it is armed
+ */
+void timeline_trigger(void);
+
+/**
+ * @brief Arm or disarm freezing on the next deadline miss
+ *
+ * Arming also restarts a frozen ring.
+ */
+void timeline_arm(bool arm);
+
+/**
+ * @brief Check whether the ring is armed, and whether it has frozen
+ */
+bool timeline_is_armed(bool *triggered);
+
+/**
+ * @brief Pause or resume recording so the ring can be read as it stands
+ */
+void timeline_set_hold(bool hold);
+
+/**
+ * @brief Get the recorded span while recording is held
+ * @param first Set to the oldest event
+ * @param first_count Events from first to the end of the ring
+ * @param second Set to the ring start (the part after the wrap)
+ * @param second_count Events at second
+ * @return Total events
+ */
+size_t timeline_get_span(const timeline_event_t **first, size_t *first_count,
+                         const timeline_event_t **second, size_t *second_count);
+
+/**
+ * @brief Ring size in events (0 if not allocated)
+ */
+size_t timeline_capacity(void);
+
+#define TIMELINE_ISR_ENTER(isr)     timeline_record(TIMELINE_EV_ISR_ENTER, (isr))
+#define TIMELINE_ISR_EXIT(isr)      timeline_record(TIMELINE_EV_ISR_EXIT, (isr))
+#define TIMELINE_MARK_BEGIN(mark)   timeline_record(TIMELINE_EV_MARK_BEGIN, (mark))
+#define TIMELINE_MARK_END(mark)     timeline_record(TIMELINE_EV_MARK_END, (mark))
+#define TIMELINE_TRIGGER()          timeline_trigger()
+
+#else
+
+#define TIMELINE_ISR_ENTER(isr)     ((void)0)
+#define TIMELINE_ISR_EXIT(isr)      ((void)0)
+#define TIMELINE_MARK_BEGIN(mark)   ((void)0)
+#define TIMELINE_MARK_END(mark)     ((void)0)
+#define TIMELINE_TRIGGER()          ((void)0)
+
+#endif // CONFIG_CRAWLER_TIMELINE
+
+#endif // TIMELINE_H
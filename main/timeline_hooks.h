@@ -0,0 +1,20 @@
+/**
+ * @file timeline_hooks.h
+ * @brief FreeRTOS trace macros for timeline tracing
+ *
+ * Included ahead of every C file in the build (project CMakeLists.txt), so
+ * the kernel's tasks.c picks the hook up. Stays empty unless
+ * CONFIG_CRAWLER_TIMELINE is set; keep it free of other includes.
+ */
+
+#pragma once
+
+#include "sdkconfig.h"
+
+#if CONFIG_CRAWLER_TIMELINE
+
+void timeline_task_switched_in(void);
+
+#define traceTASK_SWITCHED_IN()     timeline_task_switched_in()
+
+#endif
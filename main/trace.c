@@ -0,0 +1,94 @@
+/**
+ * @file trace.c
+ * @brief Flight recorder ring implementation
+ */
+
+#include "trace.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+static const char *TAG = "TRACE";
+
+_Static_assert(sizeof(trace_record_t) == 28 + 2 * SERVO_COUNT, "trace record layout must match tools/trace-decode.js");
+_Static_assert(sizeof(trace_file_header_t) == 24, "trace header layout must match tools/trace-decode.js");
+
+static trace_record_t *ring = NULL;
+static size_t capacity = 0;
+static uint32_t head = 0;               // Records written since boot (control task)
+static volatile bool hold = false;
+
+esp_err_t trace_init(void)
+{
+    ring = heap_caps_malloc(TRACE_RECORDS_SPIRAM * sizeof(trace_record_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (ring) {
+        capacity = TRACE_RECORDS_SPIRAM;
+    } else {
+        ring = heap_caps_malloc(TRACE_RECORDS_INTERNAL * sizeof(trace_record_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        capacity = ring ? TRACE_RECORDS_INTERNAL : 0;
+    }
+
+    if (!ring) {
+        ESP_LOGW(TAG, "No memory for the flight recorder");
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Flight recorder: %u records (%u KB, %s)", (unsigned)capacity,
+             (unsigned)(capacity * sizeof(trace_record_t) / 1024),
+             capacity == TRACE_RECORDS_SPIRAM ? "PSRAM" : "internal");
+    return ESP_OK;
+}
+
+void trace_record(const trace_record_t *record)
+{
+    if (!ring || hold) {
+        return;
+    }
+
+    ring[head % capacity] = *record;
+    __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+}
+
+void trace_set_hold(bool on)
+{
+    hold = on;
+}
+
+size_t trace_get_span(const trace_record_t **first, size_t *first_count,
+                      const trace_record_t **second, size_t *second_count)
+{
+    uint32_t written = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    size_t count = written < capacity ? written : capacity;
+    size_t start = (written - count) % (capacity ? capacity : 1);
+
+    *first = ring + start;
+    *first_count = (start + count <= capacity) ? count : capacity - start;
+    *second = ring;
+    *second_count = count - *first_count;
+    return count;
+}
+
+uint32_t trace_head(void)
+{
+    return __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+}
+
+bool trace_copy(uint32_t seq, trace_record_t *out, size_t count)
+{
+    uint32_t written = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    if (!ring || count > capacity || seq + count > written) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        out[i] = ring[(seq + i) % capacity];
+    }
+
+    // The slot after the newest record is the next one written: anything
+    // within a record of the writer may be torn
+    written = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    return written - seq < capacity;
+}
+
+size_t trace_capacity(void)
+{
+    return capacity;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file trace.h
+ * @brief Flight recorder: the last few minutes of control ticks
+ *
+ * The control task writes one record per tick into a fixed ring (allocated
+ * once at boot, in PSRAM when there is some), overwriting the oldest. The
+ * web server streams the ring out as /api/trace; tools/trace-decode.js
+ * turns the download into CSV.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "config.h"
+#include "esp_err.h"
+
+#define TRACE_FILE_MAGIC        0x45435254  // "TRCE"
+#define TRACE_FILE_VERSION      1
+
+#define TRACE_FLAG_FAILSAFE     (1 << 0)    // Signal lost, outputs at failsafe
+#define TRACE_FLAG_BRAKING      (1 << 1)
+#define TRACE_FLAG_SERVO_TEST   (1 << 2)    // Servos driven from the web UI
+#define TRACE_FLAG_MENU         (1 << 3)    // Settings menu open
+#define TRACE_FLAG_UI_MODE      (1 << 4)    // Steering mode forced from the web UI
+
+/**
+ * @brief One control tick (wire format, little endian, 28 + 2 * SERVO_COUNT bytes)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t t_us;              // esp_timer time, low 32 bits
+    int16_t input[RC_CHANNEL_COUNT];    // Calibrated channels (-1000..1000)
+    int16_t velocity;           // Simulated velocity
+    int16_t steer;              // Steering after expo, speed reduction and smoothing
+    uint16_t esc_pulse;         // Committed output pulses (us)
+    uint16_t servo_pulse[SERVO_COUNT];
+    uint16_t rpm;
+    uint8_t gear;
+    uint8_t modes;              // Steering mode (bits 0-1), throttle mode (bits 2-3)
+    uint8_t flags;              // TRACE_FLAG_*
+    uint8_t reserved;
+} trace_record_t;
+
+/**
+ * @brief Download header, followed by count records oldest first
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;             // TRACE_FILE_MAGIC
+    uint16_t version;           // TRACE_FILE_VERSION
+    uint16_t record_size;       // sizeof(trace_record_t)
+    uint32_t count;
+    uint32_t capacity;          // Ring size in records
+    uint16_t rate_hz;           // Control loop rate at download time
+    uint16_t reserved;
+    uint32_t uptime_ms;         // When the download started
+} trace_file_header_t;
+
+/**
+ * @brief Allocate the ring (PSRAM first, then a smaller internal one)
+ * @return ESP_OK, or ESP_ERR_NO_MEM (recording stays off)
+ */
+esp_err_t trace_init(void);
+
+/**
+ * @brief Record a tick (control task only, never blocks)
+ */
+void trace_record(const trace_record_t *record);
+
+/**
+ * @brief Pause or resume recording so the ring can be read as it stands
+ */
+void trace_set_hold(bool hold);
+
+/**
+ * @brief Get the recorded span while recording is held
+ * @param first Set to the oldest record
+ * @param first_count Records from first to the end of the ring
+ * @param second Set to the ring start (the part after the wrap), or NULL
+ * @param second_count Records at second
+ * @return Total records
+ */
+size_t trace_get_span(const trace_record_t **first, size_t *first_count,
+                      const trace_record_t **second, size_t *second_count);
+
+/**
+ * @brief Records written since boot (the sequence number of the next one)
+ */
+uint32_t trace_head(void);
+
+/**
+ * @brief Copy records by sequence number while recording continues
+ *
+ * Safe as long as the copy finishes long before the writer wraps round to
+ * them; the result is checked afterwards.
+ * @param seq Sequence number of the first record
+ * @param out Destination for count records
+ * @return false if any of them had been (or were being) overwritten
+ */
+bool trace_copy(uint32_t seq, trace_record_t *out, size_t count);
+
+/**
+ * @brief Ring size in records (0 if not allocated)
+ */
+size_t trace_capacity(void);
+
+#endif // TRACE_H
@@ -5,21 +5,40 @@
 
 #include "tuning.h"
 #include "nvs_storage.h"
+#include "steering_geometry.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include <string.h>
+#include <math.h>
 
 static const char *TAG = "TUNING";
 
-// Current tuning configuration
+// Current tuning configuration, written by the config owner only
 static tuning_config_t current_config;
 
+// Odd while the owner writes current_config (readers on other tasks retry)
+static uint32_t config_seq = 0;
+
+// Control tick length in reference ticks (Q8, 256 = PHYSICS_REF_DT_US)
+static int32_t dt_q8 = 256;
+
 // Realistic throttle state
+static int32_t velocity_q8 = 0;         // Simulated velocity in Q8 (sub-unit steps at high loop rates)
 static int16_t simulated_velocity = 0;  // Current simulated velocity (-1000 to +1000)
 static int8_t last_direction = 0;       // Last movement direction: -1=reverse, 0=neutral, 1=forward
 static bool throttle_released = true;   // Has throttle returned to neutral since stopping?
 static throttle_mode_t current_throttle_mode = THROTTLE_MODE_DIRECT; // AUX4 throttle mode
 static bool currently_braking = false;  // True when throttle opposes movement
 
+// ESC supply sag gain (Q16), written by the battery task once per ADC frame
+static volatile int32_t supply_gain_q16 = 1 << 16;
+
+static void lut_rebuild(void);
+static bool stage_take(void);
+static esp_err_t config_commit(const tuning_config_t *config);
+
 /**
  * @brief Set default tuning values
  */
@@ -42,10 +61,12 @@ void tuning_get_defaults(tuning_config_t *config)
     }
 
     // Steering geometry defaults
-    config->steering.axle_ratio[0] = TUNING_DEFAULT_AXLE1_RATIO;
-    config->steering.axle_ratio[1] = TUNING_DEFAULT_AXLE2_RATIO;
-    config->steering.axle_ratio[2] = TUNING_DEFAULT_AXLE3_RATIO;
-    config->steering.axle_ratio[3] = TUNING_DEFAULT_AXLE4_RATIO;
+    static const uint8_t default_ratios[SERVO_COUNT] = TUNING_DEFAULT_AXLE_RATIOS;
+    static const uint16_t default_pos_mm[SERVO_COUNT] = TUNING_DEFAULT_AXLE_POS_MM;
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        config->steering.axle_ratio[i] = default_ratios[i];
+        config->steering.axle_pos_mm[i] = default_pos_mm[i];
+    }
     config->steering.all_axle_rear_ratio = TUNING_DEFAULT_ALL_AXLE_REAR;
     config->steering.expo = TUNING_DEFAULT_EXPO;
     config->steering.speed_steering = TUNING_DEFAULT_SPEED_STEERING;
@@ -53,6 +74,10 @@ void tuning_get_defaults(tuning_config_t *config)
     config->steering.realistic_enabled = TUNING_DEFAULT_REALISTIC_STEER;
     config->steering.responsiveness = TUNING_DEFAULT_RESPONSIVENESS;
     config->steering.return_rate = TUNING_DEFAULT_RETURN_RATE;
+    config->steering.predict_ms = TUNING_DEFAULT_STEER_PREDICT_MS;
+    // Turning-center geometry defaults
+    config->steering.geometry_enabled = TUNING_DEFAULT_GEOMETRY;
+    config->steering.max_angle_deg = TUNING_DEFAULT_MAX_ANGLE_DEG;
 
     // ESC defaults
     config->esc.fwd_limit = TUNING_DEFAULT_FWD_LIMIT;
@@ -64,104 +89,131 @@ void tuning_get_defaults(tuning_config_t *config)
     config->esc.coast_rate = TUNING_DEFAULT_COAST_RATE;
     config->esc.brake_force = TUNING_DEFAULT_BRAKE_FORCE;
     config->esc.motor_cutoff = TUNING_DEFAULT_MOTOR_CUTOFF;
-}
 
-/**
- * @brief Migrate tuning config from old version to new version
- * Preserves all compatible settings, only new fields get defaults
- */
-static void tuning_migrate(tuning_config_t *old_config, uint32_t old_version)
-{
-    ESP_LOGI(TAG, "Migrating tuning from v%lu to v%d", (unsigned long)old_version, TUNING_VERSION);
+    // Output rate defaults
+    config->output.esc_rate_hz = TUNING_DEFAULT_ESC_RATE_HZ;
+    config->output.servo_rate_hz = TUNING_DEFAULT_SERVO_RATE_HZ;
 
-    // Get fresh defaults for new version
-    tuning_config_t new_config;
-    tuning_get_defaults(&new_config);
+    // Control loop defaults
+    config->control.loop_rate_hz = TUNING_DEFAULT_LOOP_RATE_HZ;
+}
 
-    // Copy all servo settings (these have been stable since v1)
-    for (int i = 0; i < SERVO_COUNT; i++) {
-        new_config.servos[i] = old_config->servos[i];
+uint16_t tuning_max_output_rate_hz(const tuning_config_t *config, bool servo_group)
+{
+    uint16_t longest_pulse;
+
+    if (servo_group) {
+        // Longest pulse any servo can produce (endpoint + subtrim, clamped)
+        longest_pulse = 0;
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            int max_us = config->servos[i].max_us + config->servos[i].subtrim;
+            if (max_us > SERVO_MAX_US) max_us = SERVO_MAX_US;
+            if (max_us > longest_pulse) longest_pulse = max_us;
+        }
+    } else {
+        // ESC output is clamped to the valid RC range
+        longest_pulse = RC_VALID_MAX_US;
     }
 
-    // Copy steering settings (stable since v1)
-    new_config.steering.axle_ratio[0] = old_config->steering.axle_ratio[0];
-    new_config.steering.axle_ratio[1] = old_config->steering.axle_ratio[1];
-    new_config.steering.axle_ratio[2] = old_config->steering.axle_ratio[2];
-    new_config.steering.axle_ratio[3] = old_config->steering.axle_ratio[3];
-    new_config.steering.all_axle_rear_ratio = old_config->steering.all_axle_rear_ratio;
-    new_config.steering.expo = old_config->steering.expo;
-    new_config.steering.speed_steering = old_config->steering.speed_steering;
-
-    // Copy ESC settings that exist in all versions
-    new_config.esc.fwd_limit = old_config->esc.fwd_limit;
-    new_config.esc.rev_limit = old_config->esc.rev_limit;
-    new_config.esc.subtrim = old_config->esc.subtrim;
-    new_config.esc.deadzone = old_config->esc.deadzone;
-    new_config.esc.reversed = old_config->esc.reversed;
-    new_config.esc.realistic_throttle = old_config->esc.realistic_throttle;
-    new_config.esc.coast_rate = old_config->esc.coast_rate;
+    uint32_t max_hz = 1000000 / (longest_pulse + OUTPUT_MIN_FRAME_GAP_US);
+    if (max_hz > OUTPUT_RATE_MAX_HZ) max_hz = OUTPUT_RATE_MAX_HZ;
+    return (uint16_t)max_hz;
+}
 
-    // Version-specific migrations
-    if (old_version >= 7) {
-        // v7+ has brake_force
-        new_config.esc.brake_force = old_config->esc.brake_force;
-    }
-    if (old_version >= 8) {
-        // v8+ has motor_cutoff
-        new_config.esc.motor_cutoff = old_config->esc.motor_cutoff;
-    }
-    if (old_version >= 9) {
-        // v9+ has realistic steering
-        new_config.steering.realistic_enabled = old_config->steering.realistic_enabled;
-        new_config.steering.responsiveness = old_config->steering.responsiveness;
-        new_config.steering.return_rate = old_config->steering.return_rate;
+/**
+ * @brief Clamp output and loop rates to their valid ranges
+ *
+ * Output rates are limited by what the configured pulse endpoints allow.
+ */
+static void validate_output_rates(tuning_config_t *config)
+{
+    uint16_t *rates[2] = {&config->output.esc_rate_hz, &config->output.servo_rate_hz};
+
+    for (int g = 0; g < 2; g++) {
+        uint16_t max_hz = tuning_max_output_rate_hz(config, g == 1);
+        if (*rates[g] < OUTPUT_RATE_MIN_HZ) {
+            *rates[g] = OUTPUT_RATE_MIN_HZ;
+        } else if (*rates[g] > max_hz) {
+            ESP_LOGW(TAG, "%s rate %dHz too fast for pulse endpoints, limiting to %dHz",
+                     g ? "Servo" : "ESC", *rates[g], max_hz);
+            *rates[g] = max_hz;
+        }
     }
-    // New fields in future versions will get defaults automatically
-
-    // Copy migrated config back
-    memcpy(old_config, &new_config, sizeof(tuning_config_t));
-    old_config->magic = TUNING_MAGIC;
-    old_config->version = TUNING_VERSION;
 
-    ESP_LOGI(TAG, "Migration complete");
+    if (config->control.loop_rate_hz < CONTROL_RATE_MIN_HZ) {
+        config->control.loop_rate_hz = CONTROL_RATE_MIN_HZ;
+    } else if (config->control.loop_rate_hz > CONTROL_RATE_MAX_HZ) {
+        config->control.loop_rate_hz = CONTROL_RATE_MAX_HZ;
+    }
 }
 
+// Fields kept when a tuning record of an older version is loaded
+static const nvs_field_t tuning_fields[] = {
+    NVS_FIELD(tuning_config_t, servos, 1),
+    NVS_FIELD(tuning_config_t, steering.axle_ratio, 1),
+    NVS_FIELD(tuning_config_t, steering.all_axle_rear_ratio, 1),
+    NVS_FIELD(tuning_config_t, steering.expo, 1),
+    NVS_FIELD(tuning_config_t, steering.speed_steering, 1),
+    NVS_FIELD(tuning_config_t, esc.fwd_limit, 1),
+    NVS_FIELD(tuning_config_t, esc.rev_limit, 1),
+    NVS_FIELD(tuning_config_t, esc.subtrim, 1),
+    NVS_FIELD(tuning_config_t, esc.deadzone, 1),
+    NVS_FIELD(tuning_config_t, esc.reversed, 1),
+    NVS_FIELD(tuning_config_t, esc.realistic_throttle, 1),
+    NVS_FIELD(tuning_config_t, esc.coast_rate, 1),
+    NVS_FIELD(tuning_config_t, esc.brake_force, 7),
+    NVS_FIELD(tuning_config_t, esc.motor_cutoff, 8),
+    NVS_FIELD(tuning_config_t, steering.realistic_enabled, 9),
+    NVS_FIELD(tuning_config_t, steering.responsiveness, 9),
+    NVS_FIELD(tuning_config_t, steering.return_rate, 9),
+    NVS_FIELD(tuning_config_t, output, 10),
+    NVS_FIELD(tuning_config_t, control, 11),
+    NVS_FIELD(tuning_config_t, steering.geometry_enabled, 12),
+    NVS_FIELD(tuning_config_t, steering.max_angle_deg, 12),
+    NVS_FIELD(tuning_config_t, steering.axle_pos_mm, 12),
+    NVS_FIELD(tuning_config_t, steering.predict_ms, 13),
+};
+
+static const nvs_schema_t tuning_schema = {
+    .magic = TUNING_MAGIC,
+    .version = TUNING_VERSION,
+    .size = sizeof(tuning_config_t),
+    .fields = tuning_fields,
+    .field_count = sizeof(tuning_fields) / sizeof(tuning_fields[0]),
+};
+
 esp_err_t tuning_init(tuning_config_t *config)
 {
     ESP_LOGI(TAG, "Initializing tuning system...");
 
-    // Try to load from NVS
-    esp_err_t ret = nvs_load_tuning(&current_config);
+    // Load from NVS over the defaults (older versions are migrated)
+    tuning_get_defaults(&current_config);
+    esp_err_t ret = nvs_storage_load(NVS_BLOB_TUNING, &tuning_schema, &current_config);
 
-    if (ret != ESP_OK || current_config.magic != TUNING_MAGIC) {
-        // No valid config at all - use defaults
+    if (ret != ESP_OK) {
         ESP_LOGW(TAG, "No valid tuning found, using defaults");
-        tuning_get_defaults(&current_config);
-        nvs_save_tuning(&current_config);
-    } else if (current_config.version != TUNING_VERSION) {
-        // Valid config but old version - migrate it
-        tuning_migrate(&current_config, current_config.version);
-        nvs_save_tuning(&current_config);
+        nvs_storage_save_deferred(NVS_BLOB_TUNING, &current_config, sizeof(tuning_config_t));
     } else {
-        ESP_LOGI(TAG, "Loaded tuning from NVS (version %lu)", (unsigned long)current_config.version);
+        ESP_LOGI(TAG, "Loaded tuning from NVS (version %lu)", (unsigned long)TUNING_VERSION);
     }
+    validate_output_rates(&current_config);
+    lut_rebuild();
 
     // Log summary
-    ESP_LOGI(TAG, "Servo endpoints: [%d-%d] [%d-%d] [%d-%d] [%d-%d]",
-             current_config.servos[0].min_us, current_config.servos[0].max_us,
-             current_config.servos[1].min_us, current_config.servos[1].max_us,
-             current_config.servos[2].min_us, current_config.servos[2].max_us,
-             current_config.servos[3].min_us, current_config.servos[3].max_us);
-    ESP_LOGI(TAG, "Axle ratios: %d%% %d%% %d%% %d%%, all-axle rear: %d%%",
-             current_config.steering.axle_ratio[0],
-             current_config.steering.axle_ratio[1],
-             current_config.steering.axle_ratio[2],
-             current_config.steering.axle_ratio[3],
-             current_config.steering.all_axle_rear_ratio);
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        ESP_LOGI(TAG, "Axle %d: servo [%d-%d], ratio %d%%, at %dmm", i + 1,
+                 current_config.servos[i].min_us, current_config.servos[i].max_us,
+                 current_config.steering.axle_ratio[i],
+                 current_config.steering.axle_pos_mm[i]);
+    }
+    ESP_LOGI(TAG, "All-axle rear: %d%%", current_config.steering.all_axle_rear_ratio);
     ESP_LOGI(TAG, "ESC limits: fwd=%d%% rev=%d%%, deadzone=%d",
              current_config.esc.fwd_limit,
              current_config.esc.rev_limit,
              current_config.esc.deadzone);
+    ESP_LOGI(TAG, "Output rates: ESC %dHz, servos %dHz, control loop %dHz",
+             current_config.output.esc_rate_hz, current_config.output.servo_rate_hz,
+             current_config.control.loop_rate_hz);
 
     if (config) {
         memcpy(config, &current_config, sizeof(tuning_config_t));
@@ -175,31 +227,65 @@ const tuning_config_t* tuning_get_config(void)
     return &current_config;
 }
 
+void tuning_copy_config(tuning_config_t *config)
+{
+    uint32_t seq;
+    do {
+        seq = __atomic_load_n(&config_seq, __ATOMIC_ACQUIRE);
+        memcpy(config, &current_config, sizeof(tuning_config_t));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((seq & 1) || seq != __atomic_load_n(&config_seq, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Bracket a write of current_config (owner only)
+ */
+static inline void config_write_begin(void)
+{
+    __atomic_store_n(&config_seq, config_seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void config_write_end(void)
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&config_seq, config_seq + 1, __ATOMIC_RELAXED);
+}
+
 esp_err_t tuning_set_config(const tuning_config_t *config)
 {
     if (!config) return ESP_ERR_INVALID_ARG;
 
-    memcpy(&current_config, config, sizeof(tuning_config_t));
-    current_config.magic = TUNING_MAGIC;
-    current_config.version = TUNING_VERSION;
+    esp_err_t ret = config_commit(config);
+    if (ret != ESP_OK) {
+        return ret;
+    }
 
     ESP_LOGI(TAG, "Config set: coast=%d, brake=%d, realistic=%d",
-             current_config.esc.coast_rate, current_config.esc.brake_force,
-             current_config.esc.realistic_throttle);
+             config->esc.coast_rate, config->esc.brake_force,
+             config->esc.realistic_throttle);
 
     return ESP_OK;
 }
 
 esp_err_t tuning_save(void)
 {
-    ESP_LOGI(TAG, "Saving tuning to NVS...");
-    return nvs_save_tuning(&current_config);
+    ESP_LOGI(TAG, "Queueing tuning save to NVS");
+    tuning_config_t snapshot;
+    tuning_copy_config(&snapshot);
+    return nvs_storage_save_deferred(NVS_BLOB_TUNING, &snapshot, sizeof(tuning_config_t));
 }
 
 esp_err_t tuning_reset_defaults(bool save_to_nvs)
 {
     ESP_LOGI(TAG, "Resetting tuning to defaults");
-    tuning_get_defaults(&current_config);
+    tuning_config_t defaults;
+    tuning_get_defaults(&defaults);
+
+    esp_err_t ret = config_commit(&defaults);
+    if (ret != ESP_OK) {
+        return ret;
+    }
 
     if (save_to_nvs) {
         return tuning_save();
@@ -207,6 +293,382 @@ esp_err_t tuning_reset_defaults(bool save_to_nvs)
     return ESP_OK;
 }
 
+// ============================================================================
+// Live Edits
+// ============================================================================
+
+// Tuning API keys - one entry per field, shared by GET, POST, PATCH and live edits
+#define SERVO_JSON_FIELDS(i) \
+    JSON_UINT(tuning_config_t, servos[i].min_us, "s" #i "_min"), \
+    JSON_UINT(tuning_config_t, servos[i].max_us, "s" #i "_max"), \
+    JSON_INT(tuning_config_t, servos[i].subtrim, "s" #i "_subtrim"), \
+    JSON_INT(tuning_config_t, servos[i].trim, "s" #i "_trim"), \
+    JSON_BOOL(tuning_config_t, servos[i].reversed, "s" #i "_rev")
+
+const json_field_t tuning_json_fields[] = {
+    SERVO_JSON_FIELDS(0),
+    SERVO_JSON_FIELDS(1),
+#if SERVO_COUNT > 2
+    SERVO_JSON_FIELDS(2),
+#endif
+#if SERVO_COUNT > 3
+    SERVO_JSON_FIELDS(3),
+#endif
+#if SERVO_COUNT > 4
+    SERVO_JSON_FIELDS(4),
+#endif
+
+    // Steering geometry
+    JSON_UINT(tuning_config_t, steering.axle_ratio[0], "ratio0"),
+    JSON_UINT(tuning_config_t, steering.axle_ratio[1], "ratio1"),
+#if SERVO_COUNT > 2
+    JSON_UINT(tuning_config_t, steering.axle_ratio[2], "ratio2"),
+#endif
+#if SERVO_COUNT > 3
+    JSON_UINT(tuning_config_t, steering.axle_ratio[3], "ratio3"),
+#endif
+#if SERVO_COUNT > 4
+    JSON_UINT(tuning_config_t, steering.axle_ratio[4], "ratio4"),
+#endif
+    JSON_UINT(tuning_config_t, steering.all_axle_rear_ratio, "allAxleRear"),
+    JSON_UINT(tuning_config_t, steering.expo, "expo"),
+    JSON_UINT(tuning_config_t, steering.speed_steering, "speedSteering"),
+    JSON_BOOL(tuning_config_t, steering.geometry_enabled, "geometry"),
+    JSON_UINT(tuning_config_t, steering.max_angle_deg, "maxAngle"),
+    JSON_UINT(tuning_config_t, steering.axle_pos_mm[0], "axlePos0"),
+    JSON_UINT(tuning_config_t, steering.axle_pos_mm[1], "axlePos1"),
+#if SERVO_COUNT > 2
+    JSON_UINT(tuning_config_t, steering.axle_pos_mm[2], "axlePos2"),
+#endif
+#if SERVO_COUNT > 3
+    JSON_UINT(tuning_config_t, steering.axle_pos_mm[3], "axlePos3"),
+#endif
+#if SERVO_COUNT > 4
+    JSON_UINT(tuning_config_t, steering.axle_pos_mm[4], "axlePos4"),
+#endif
+
+    // Realistic steering
+    JSON_BOOL(tuning_config_t, steering.realistic_enabled, "realisticEnabled"),
+    JSON_UINT(tuning_config_t, steering.responsiveness, "responsiveness"),
+    JSON_UINT(tuning_config_t, steering.return_rate, "returnRate"),
+    JSON_UINT(tuning_config_t, steering.predict_ms, "steerPredict"),
+
+    // ESC settings
+    JSON_UINT(tuning_config_t, esc.fwd_limit, "fwdLimit"),
+    JSON_UINT(tuning_config_t, esc.rev_limit, "revLimit"),
+    JSON_INT(tuning_config_t, esc.subtrim, "escSubtrim"),
+    JSON_UINT(tuning_config_t, esc.deadzone, "deadzone"),
+    JSON_BOOL(tuning_config_t, esc.reversed, "escRev"),
+    JSON_BOOL(tuning_config_t, esc.realistic_throttle, "realistic"),
+    JSON_UINT(tuning_config_t, esc.coast_rate, "coastRate"),
+    JSON_UINT(tuning_config_t, esc.brake_force, "brakeForce"),
+    JSON_UINT(tuning_config_t, esc.motor_cutoff, "motorCutoff"),
+
+    // Output rates (validated against endpoints in tuning_set_config)
+    JSON_UINT(tuning_config_t, output.esc_rate_hz, "escRate"),
+    JSON_UINT(tuning_config_t, output.servo_rate_hz, "servoRate"),
+    JSON_UINT(tuning_config_t, control.loop_rate_hz, "loopRate"),
+};
+
+const size_t tuning_json_field_count = sizeof(tuning_json_fields) / sizeof(tuning_json_fields[0]);
+
+
+typedef struct {
+    const json_field_t *field;
+    int32_t value;
+} live_edit_t;
+
+// Single-producer (httpd task) / single-consumer (control task) ring
+static live_edit_t live_ring[TUNING_LIVE_QUEUE_LEN];
+static uint32_t live_head = 0;          // Written by the producer only
+static uint32_t live_tail = 0;          // Written by the consumer only
+static uint32_t live_drops = 0;
+
+bool tuning_live_push(const json_field_t *field, int32_t value)
+{
+    uint32_t head = live_head;
+    uint32_t tail = __atomic_load_n(&live_tail, __ATOMIC_ACQUIRE);
+
+    if (!field || head - tail >= TUNING_LIVE_QUEUE_LEN) {
+        if (field && ++live_drops % 100 == 1) {
+            ESP_LOGW(TAG, "Live edit queue full (dropped=%lu)", (unsigned long)live_drops);
+        }
+        return false;
+    }
+
+    live_ring[head & (TUNING_LIVE_QUEUE_LEN - 1)] = (live_edit_t){ field, value };
+    __atomic_store_n(&live_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool tuning_live_apply(void)
+{
+    bool staged = stage_take();
+    uint32_t tail = live_tail;
+    uint32_t head = __atomic_load_n(&live_head, __ATOMIC_ACQUIRE);
+
+    if (tail == head) {
+        return staged;
+    }
+
+    config_write_begin();
+    while (tail != head) {
+        const live_edit_t *edit = &live_ring[tail & (TUNING_LIVE_QUEUE_LEN - 1)];
+        json_value_t value = {
+            .type = edit->field->kind == JSON_FIELD_BOOL ? JSON_VALUE_BOOL : JSON_VALUE_NUMBER,
+            .number = edit->value,
+        };
+        json_field_store(edit->field, &current_config, &value);
+        tail++;
+    }
+    __atomic_store_n(&live_tail, tail, __ATOMIC_RELEASE);
+
+    // Once per batch: a drag can queue several edits per tick
+    validate_output_rates(&current_config);
+    config_write_end();
+    lut_rebuild();
+    return true;
+}
+
+// ============================================================================
+// Staged Configs
+// ============================================================================
+
+typedef enum {
+    STAGE_IDLE = 0,             // Stage bank free
+    STAGE_BUILDING,             // Stager is filling staged_config and the stage bank
+    STAGE_READY,                // Waiting for the next control tick
+    STAGE_TAKING                // Control task is swapping it in
+} stage_state_t;
+
+static tuning_config_t staged_config;
+static uint8_t stage_state = STAGE_IDLE;
+static uint32_t stage_taken = 0;        // Configs taken by the control task so far
+
+// Task that owns current_config and the table banks: the control task once
+// it has bound. Until then (boot, host tools) changes apply in place under
+// inplace_lock; afterwards other tasks hand them over through the stage.
+static TaskHandle_t config_owner = NULL;
+static uint8_t inplace_lock = 0;
+
+#define HANDOFF_POLL_MS     5
+
+static void lut_stage_build(const tuning_config_t *cfg);
+static void lut_stage_swap(void);
+
+/**
+ * @brief Stage a config; ticket (optional) is the take count to wait past
+ */
+static bool stage_config(const tuning_config_t *config, uint32_t *ticket)
+{
+    // Claim the stage bank; a second stager (menu vs API) fails here
+    uint8_t idle = STAGE_IDLE;
+    if (!config || !__atomic_compare_exchange_n(&stage_state, &idle, STAGE_BUILDING, false,
+                                                __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return false;
+    }
+    if (ticket) {
+        // Nothing can be taken while the claim is held
+        *ticket = __atomic_load_n(&stage_taken, __ATOMIC_ACQUIRE);
+    }
+
+    memcpy(&staged_config, config, sizeof(tuning_config_t));
+    staged_config.magic = TUNING_MAGIC;
+    staged_config.version = TUNING_VERSION;
+    validate_output_rates(&staged_config);
+    lut_stage_build(&staged_config);
+
+    __atomic_store_n(&stage_state, STAGE_READY, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool tuning_stage_config(const tuning_config_t *config)
+{
+    return stage_config(config, NULL);
+}
+
+bool tuning_stage_pending(void)
+{
+    return __atomic_load_n(&stage_state, __ATOMIC_ACQUIRE) != STAGE_IDLE;
+}
+
+/**
+ * @brief Take a staged config, if one is ready (control task)
+ */
+static bool stage_take(void)
+{
+    // Claimed, so a stager that timed out can no longer withdraw it
+    uint8_t ready = STAGE_READY;
+    if (!__atomic_compare_exchange_n(&stage_state, &ready, STAGE_TAKING, false,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return false;
+    }
+
+    config_write_begin();
+    memcpy(&current_config, &staged_config, sizeof(tuning_config_t));
+    config_write_end();
+    lut_stage_swap();
+
+    __atomic_add_fetch(&stage_taken, 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&stage_state, STAGE_IDLE, __ATOMIC_RELEASE);
+    ESP_LOGI(TAG, "Staged config applied");
+    return true;
+}
+
+static bool inplace_take(void)
+{
+    uint8_t free_lock = 0;
+    return __atomic_compare_exchange_n(&inplace_lock, &free_lock, 1, false,
+                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+static void inplace_give(void)
+{
+    __atomic_store_n(&inplace_lock, 0, __ATOMIC_RELEASE);
+}
+
+void tuning_bind_control_task(void)
+{
+    // Wait out a change another task is applying in place
+    while (!inplace_take()) {
+        vTaskDelay(pdMS_TO_TICKS(HANDOFF_POLL_MS));
+    }
+    __atomic_store_n(&config_owner, xTaskGetCurrentTaskHandle(), __ATOMIC_RELEASE);
+    inplace_give();
+}
+
+/**
+ * @brief Copy a config in and rebuild the tables (owner only)
+ */
+static void config_apply(const tuning_config_t *config)
+{
+    config_write_begin();
+    memcpy(&current_config, config, sizeof(tuning_config_t));
+    current_config.magic = TUNING_MAGIC;
+    current_config.version = TUNING_VERSION;
+    validate_output_rates(&current_config);
+    config_write_end();
+    lut_rebuild();
+}
+
+/**
+ * @brief Stage a config and wait for the control task to take it
+ */
+static esp_err_t config_hand_off(const tuning_config_t *config)
+{
+    uint32_t ticket;
+    uint32_t waited_ms = 0;
+
+    while (!stage_config(config, &ticket)) {
+        if (waited_ms >= TUNING_HANDOFF_TIMEOUT_MS) {
+            ESP_LOGW(TAG, "Stage busy, config not applied");
+            return ESP_ERR_TIMEOUT;
+        }
+        vTaskDelay(pdMS_TO_TICKS(HANDOFF_POLL_MS));
+        waited_ms += HANDOFF_POLL_MS;
+    }
+
+    while (__atomic_load_n(&stage_taken, __ATOMIC_ACQUIRE) == ticket) {
+        if (waited_ms >= TUNING_HANDOFF_TIMEOUT_MS) {
+            // Withdraw it, unless the control task claimed it meanwhile
+            uint8_t ready = STAGE_READY;
+            if (__atomic_compare_exchange_n(&stage_state, &ready, STAGE_IDLE, false,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                ESP_LOGW(TAG, "Control task did not take the config, withdrawn");
+                return ESP_ERR_TIMEOUT;
+            }
+            // Claimed meanwhile: the swap is under way, wait for it
+        }
+        vTaskDelay(pdMS_TO_TICKS(HANDOFF_POLL_MS));
+        waited_ms += HANDOFF_POLL_MS;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Apply a whole config from any task
+ *
+ * The owner (or app_main before the control task binds) applies it in
+ * place; any other task hands it to the control task, so only one task
+ * ever writes current_config or swaps the table banks.
+ */
+static esp_err_t config_commit(const tuning_config_t *config)
+{
+    TaskHandle_t owner = __atomic_load_n(&config_owner, __ATOMIC_ACQUIRE);
+
+    if (owner == xTaskGetCurrentTaskHandle()) {
+        config_apply(config);
+        return ESP_OK;
+    }
+    if (owner == NULL) {
+        while (!inplace_take()) {
+            vTaskDelay(pdMS_TO_TICKS(HANDOFF_POLL_MS));
+        }
+        bool unbound = __atomic_load_n(&config_owner, __ATOMIC_ACQUIRE) == NULL;
+        if (unbound) {
+            config_apply(config);
+        }
+        inplace_give();
+        if (unbound) {
+            return ESP_OK;
+        }
+    }
+    return config_hand_off(config);
+}
+
+// ============================================================================
+// Physics Time Step
+// ============================================================================
+
+void tuning_set_dt_us(uint32_t dt_us)
+{
+    if (dt_us > CONTROL_DT_MAX_US) dt_us = CONTROL_DT_MAX_US;
+    dt_q8 = (int32_t)((dt_us * 256 + PHYSICS_REF_DT_US / 2) / PHYSICS_REF_DT_US);
+    if (dt_q8 < 1) dt_q8 = 1;
+}
+
+int32_t tuning_get_dt_q8(void)
+{
+    return dt_q8;
+}
+
+// ============================================================================
+// Supply Sag Compensation
+// ============================================================================
+
+void tuning_set_supply_gain_q16(int32_t gain_q16)
+{
+    if (gain_q16 < (1 << 16)) gain_q16 = 1 << 16;
+    if (gain_q16 > (2 << 16)) gain_q16 = 2 << 16;
+    supply_gain_q16 = gain_q16;
+}
+
+/**
+ * @brief Scale a throttle command by the supply gain (after the physics,
+ * so simulated velocity stays in stick units)
+ */
+static inline int32_t apply_supply_gain(int32_t throttle)
+{
+    int32_t gain = supply_gain_q16;
+    if (gain == (1 << 16) || throttle == 0) {
+        return throttle;
+    }
+    int32_t p = throttle * gain;
+    throttle = (p >= 0) ? (p >> 16) : -((-p) >> 16);
+    if (throttle > 1000) throttle = 1000;
+    if (throttle < -1000) throttle = -1000;
+    return throttle;
+}
+
+/**
+ * @brief Scale a per-reference-tick rate by the current dt
+ * @return Step for this tick in Q8
+ */
+static inline int32_t step_q8(int32_t rate_per_tick)
+{
+    return rate_per_tick * dt_q8;
+}
+
 // ============================================================================
 // Output Calculation Functions
 // ============================================================================
@@ -296,6 +758,7 @@ uint16_t tuning_calc_esc_pulse(int16_t throttle)
     if (current_throttle_mode == THROTTLE_MODE_REALISTIC) {
         throttle = tuning_apply_realistic_throttle(throttle);
     }
+    throttle = (int16_t)apply_supply_gain(throttle);
 
     // Calculate pulse with subtrim
     int16_t center = SERVO_CENTER_US + esc->subtrim;
@@ -318,6 +781,9 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
 {
     const esc_tuning_t *esc = &current_config.esc;
 
+    // All rates are per PHYSICS_REF_DT_US and scaled by dt below,
+    // so coast/brake feel is the same at any control loop rate
+
     // Coast rate: 0 = fast deceleration, 100 = slow deceleration (long coast)
     int16_t coast_decel = 50 - (esc->coast_rate * 45) / 100;  // 50 down to 5
     if (coast_decel < 5) coast_decel = 5;
@@ -328,14 +794,19 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
     // Base acceleration rate
     int16_t accel_rate = 20 + (100 - esc->coast_rate) / 5;  // 20-40 per tick
 
+    const int32_t coast_q8 = step_q8(coast_decel);
+    const int32_t brake_q8 = step_q8(brake_strength);
+    const int32_t accel_q8 = step_q8(accel_rate);
+    const int32_t target_q8 = (int32_t)throttle_input * 256;
+
     // Determine direction
     bool throttle_forward = (throttle_input > 0);
     bool throttle_reverse = (throttle_input < 0);
     bool throttle_neutral = (throttle_input == 0);
 
-    bool moving_forward = (simulated_velocity > 0);
-    bool moving_reverse = (simulated_velocity < 0);
-    bool stopped = (simulated_velocity == 0);
+    bool moving_forward = (velocity_q8 > 0);
+    bool moving_reverse = (velocity_q8 < 0);
+    bool stopped = (velocity_q8 == 0);
 
     // Reset braking flag - will be set if braking detected
     currently_braking = false;
@@ -348,11 +819,11 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
     // Case 1: No throttle - coast (natural deceleration only)
     if (throttle_neutral) {
         if (moving_forward) {
-            simulated_velocity -= coast_decel;
-            if (simulated_velocity < 0) simulated_velocity = 0;
+            velocity_q8 -= coast_q8;
+            if (velocity_q8 < 0) velocity_q8 = 0;
         } else if (moving_reverse) {
-            simulated_velocity += coast_decel;
-            if (simulated_velocity > 0) simulated_velocity = 0;
+            velocity_q8 += coast_q8;
+            if (velocity_q8 > 0) velocity_q8 = 0;
         }
     }
     // Case 2: Throttle opposite to movement - active braking (does NOT reverse)
@@ -361,17 +832,18 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
              (stopped && throttle_reverse && last_direction == 1) ||
              (stopped && throttle_forward && last_direction == -1)) {
         currently_braking = true;  // Set braking flag for engine sound
-        static int log_cnt = 0;
-        if (++log_cnt >= 20) {  // Log every 200ms
+        static int64_t last_log_us = 0;
+        int64_t now_us = esp_timer_get_time();
+        if (now_us - last_log_us >= 200000) {  // Log every 200ms
             ESP_LOGI(TAG, "BRAKE: vel=%d str=%d force=%d%%", simulated_velocity, brake_strength, esc->brake_force);
-            log_cnt = 0;
+            last_log_us = now_us;
         }
         if (moving_forward) {
-            simulated_velocity -= brake_strength;
-            if (simulated_velocity < 0) simulated_velocity = 0;
+            velocity_q8 -= brake_q8;
+            if (velocity_q8 < 0) velocity_q8 = 0;
         } else if (moving_reverse) {
-            simulated_velocity += brake_strength;
-            if (simulated_velocity > 0) simulated_velocity = 0;
+            velocity_q8 += brake_q8;
+            if (velocity_q8 > 0) velocity_q8 = 0;
         }
         // When stopped, velocity stays 0 (already handled above)
         // Braking does not allow direction change - must release throttle first
@@ -385,19 +857,19 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
             bool can_go_forward = moving_forward || (stopped && (throttle_released || last_direction != -1));
 
             if (can_go_forward) {
-                if (simulated_velocity < throttle_input) {
+                if (velocity_q8 < target_q8) {
                     // Accelerating
-                    simulated_velocity += accel_rate;
-                    if (simulated_velocity > throttle_input) {
-                        simulated_velocity = throttle_input;
+                    velocity_q8 += accel_q8;
+                    if (velocity_q8 > target_q8) {
+                        velocity_q8 = target_q8;
                     }
                     last_direction = 1;
                     throttle_released = false;
-                } else if (simulated_velocity > throttle_input) {
+                } else if (velocity_q8 > target_q8) {
                     // Coasting down to target
-                    simulated_velocity -= coast_decel;
-                    if (simulated_velocity < throttle_input) {
-                        simulated_velocity = throttle_input;
+                    velocity_q8 -= coast_q8;
+                    if (velocity_q8 < target_q8) {
+                        velocity_q8 = target_q8;
                     }
                 }
             }
@@ -408,17 +880,17 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
             bool can_go_reverse = moving_reverse || (stopped && (throttle_released || last_direction != 1));
 
             if (can_go_reverse) {
-                if (simulated_velocity > throttle_input) {
-                    simulated_velocity -= accel_rate;
-                    if (simulated_velocity < throttle_input) {
-                        simulated_velocity = throttle_input;
+                if (velocity_q8 > target_q8) {
+                    velocity_q8 -= accel_q8;
+                    if (velocity_q8 < target_q8) {
+                        velocity_q8 = target_q8;
                     }
                     last_direction = -1;
                     throttle_released = false;
-                } else if (simulated_velocity < throttle_input) {
-                    simulated_velocity += coast_decel;
-                    if (simulated_velocity > throttle_input) {
-                        simulated_velocity = throttle_input;
+                } else if (velocity_q8 < target_q8) {
+                    velocity_q8 += coast_q8;
+                    if (velocity_q8 > target_q8) {
+                        velocity_q8 = target_q8;
                     }
                 }
             }
@@ -431,11 +903,13 @@ int16_t tuning_apply_realistic_throttle(int16_t throttle_input)
         last_direction = 0;
     }
 
+    simulated_velocity = (int16_t)(velocity_q8 / 256);
     return simulated_velocity;
 }
 
 void tuning_reset_realistic_throttle(void)
 {
+    velocity_q8 = 0;
     simulated_velocity = 0;
     last_direction = 0;
     throttle_released = true;
@@ -451,13 +925,16 @@ int16_t tuning_get_simulated_velocity(void)
 // ============================================================================
 
 // Current smoothed steering input (single value - like a mechanical linkage)
-// All axles follow this proportionally based on their ratios
-static int16_t current_steering_input = 0;
+// All axles follow this proportionally based on their ratios. Kept in Q8 so
+// small per-tick steps at high loop rates aren't lost to rounding.
+static int32_t current_steering_q8 = 0;
 
 int16_t tuning_apply_realistic_steering(int16_t target_input)
 {
     const steering_tuning_t *steer = &current_config.steering;
 
+    // Rates below are per PHYSICS_REF_DT_US and scaled by dt
+
     // Convert responsiveness (0-100) to max movement rate per tick
     // 0 = very slow (max ~10), 100 = fast (max ~60)
     int16_t max_move_rate = 10 + (steer->responsiveness * 50) / 100;
@@ -471,10 +948,11 @@ int16_t tuning_apply_realistic_steering(int16_t target_input)
     // Threshold to consider "returning to center" (within ±50 of center)
     const int16_t center_threshold = 50;
 
-    int16_t delta = target_input - current_steering_input;
+    int32_t target_q8 = (int32_t)target_input * 256;
+    int32_t delta_q8 = target_q8 - current_steering_q8;
 
-    if (delta == 0) {
-        return current_steering_input;
+    if (delta_q8 == 0) {
+        return target_input;
     }
 
     // Determine max rate based on whether we're steering or centering
@@ -487,32 +965,33 @@ int16_t tuning_apply_realistic_steering(int16_t target_input)
 
     // Proportional rate: faster when far, slower when close (ease-in/ease-out)
     // Divisor of 20 gives good feel: at delta=1000 rate=50, at delta=100 rate=5
-    int16_t abs_delta = (delta > 0) ? delta : -delta;
-    int16_t rate = abs_delta / 20;
+    int32_t abs_delta_q8 = (delta_q8 > 0) ? delta_q8 : -delta_q8;
+    int32_t rate_q8 = abs_delta_q8 / 20;
 
-    // Clamp rate between min and max
-    if (rate > max_rate) rate = max_rate;
-    if (rate < min_rate) rate = min_rate;
+    // Clamp rate between min and max (per reference tick), then scale by dt
+    if (rate_q8 > max_rate * 256) rate_q8 = max_rate * 256;
+    if (rate_q8 < min_rate * 256) rate_q8 = min_rate * 256;
+    rate_q8 = (int32_t)(((int64_t)rate_q8 * dt_q8) >> 8);
 
     // Move toward target
-    if (delta > 0) {
-        current_steering_input += rate;
-        if (current_steering_input > target_input) {
-            current_steering_input = target_input;
+    if (delta_q8 > 0) {
+        current_steering_q8 += rate_q8;
+        if (current_steering_q8 > target_q8) {
+            current_steering_q8 = target_q8;
         }
     } else {
-        current_steering_input -= rate;
-        if (current_steering_input < target_input) {
-            current_steering_input = target_input;
+        current_steering_q8 -= rate_q8;
+        if (current_steering_q8 < target_q8) {
+            current_steering_q8 = target_q8;
         }
     }
 
-    return current_steering_input;
+    return (int16_t)(current_steering_q8 / 256);
 }
 
 void tuning_reset_realistic_steering(void)
 {
-    current_steering_input = 0;
+    current_steering_q8 = 0;
 }
 
 bool tuning_is_realistic_steering_enabled(void)
@@ -520,6 +999,63 @@ bool tuning_is_realistic_steering_enabled(void)
     return current_config.steering.realistic_enabled;
 }
 
+// ============================================================================
+// Steering Prediction
+// ============================================================================
+
+// The last two RC frames' steering inputs and edge times. Between frames
+// the input is extrapolated along the step from one to the other.
+static int16_t predict_input = 0;
+static uint32_t predict_edge_us = 0;    // 0 = no frame yet
+static int16_t predict_step = 0;        // Input change over the last frame interval
+static uint32_t predict_interval_us = 0;    // 0 = no step to extrapolate
+
+int16_t tuning_predict_steering(int16_t input, uint32_t frame_edge_us, uint32_t now_us)
+{
+    uint32_t horizon_us = current_config.steering.predict_ms * 1000u;
+    if (horizon_us > STEER_PREDICT_MAX_MS * 1000u) {
+        horizon_us = STEER_PREDICT_MAX_MS * 1000u;
+    }
+    if (horizon_us == 0) {
+        predict_edge_us = 0;
+        return input;
+    }
+
+    // A new frame, by its edge time or (if it landed between the snapshot
+    // and the edge read) by its value
+    if (frame_edge_us != predict_edge_us || input != predict_input) {
+        uint32_t interval = frame_edge_us - predict_edge_us;
+        if (predict_edge_us != 0 && interval > 0 && interval <= STEER_PREDICT_MAX_GAP_MS * 1000u) {
+            predict_step = input - predict_input;
+            predict_interval_us = interval;
+        } else if (frame_edge_us != predict_edge_us) {
+            predict_interval_us = 0;
+        }
+        predict_input = input;
+        predict_edge_us = frame_edge_us;
+    }
+    if (predict_interval_us == 0) {
+        return input;
+    }
+
+    // Run ahead by the frame's age, at most one frame interval (so never
+    // past one more step) and the horizon
+    uint32_t age = now_us - frame_edge_us;
+    if (age > predict_interval_us) age = predict_interval_us;
+    if (age > horizon_us) age = horizon_us;
+
+    int32_t predicted = input + (int32_t)predict_step * (int32_t)age / (int32_t)predict_interval_us;
+    if (predicted > 1000) predicted = 1000;
+    if (predicted < -1000) predicted = -1000;
+    return (int16_t)predicted;
+}
+
+void tuning_reset_steering_prediction(void)
+{
+    predict_edge_us = 0;
+    predict_interval_us = 0;
+}
+
 void tuning_set_throttle_mode(throttle_mode_t mode)
 {
     current_throttle_mode = mode;
@@ -560,23 +1096,31 @@ int16_t tuning_apply_expo(int16_t input)
     return (int16_t)result;
 }
 
-uint8_t tuning_get_axle_ratio(uint8_t axle_idx, steering_mode_t mode)
+/**
+ * @brief Axle ratio of a given steering config in a mode
+ */
+static uint8_t axle_ratio(const steering_tuning_t *steering, uint8_t axle_idx, steering_mode_t mode)
 {
-    if (axle_idx >= SERVO_COUNT) {
-        return 0;
-    }
+    uint8_t ratio = steering->axle_ratio[axle_idx];
 
-    uint8_t ratio = current_config.steering.axle_ratio[axle_idx];
-
-    // In all-axle mode, rear axles (2, 3) get additional reduction
-    if (mode == STEER_MODE_ALL_AXLE && (axle_idx == 2 || axle_idx == 3)) {
-        ratio = (ratio * current_config.steering.all_axle_rear_ratio) / 100;
+    // In all-axle mode, the rear group gets additional reduction
+    if (mode == STEER_MODE_ALL_AXLE &&
+        steering_geometry_axle_group(axle_idx) == AXLE_GROUP_REAR) {
+        ratio = (ratio * steering->all_axle_rear_ratio) / 100;
     }
 
     return ratio;
 }
 
-int16_t tuning_apply_speed_steering(int16_t steering)
+uint8_t tuning_get_axle_ratio(uint8_t axle_idx, steering_mode_t mode)
+{
+    if (axle_idx >= SERVO_COUNT) {
+        return 0;
+    }
+    return axle_ratio(&current_config.steering, axle_idx, mode);
+}
+
+int16_t tuning_apply_speed_steering(int16_t steering, int16_t velocity)
 {
     uint8_t speed_steering = current_config.steering.speed_steering;
 
@@ -584,9 +1128,9 @@ int16_t tuning_apply_speed_steering(int16_t steering)
         return steering;  // Feature disabled
     }
 
-    // Use simulated velocity (current output) not throttle input
+    // Use vehicle velocity (current output) not throttle input
     // This means steering stays reduced while coasting at speed
-    int16_t abs_velocity = (simulated_velocity < 0) ? -simulated_velocity : simulated_velocity;
+    int16_t abs_velocity = (velocity < 0) ? -velocity : velocity;
 
     // Calculate reduction factor based on current speed
     // At 0 velocity: no reduction (100%)
@@ -626,3 +1170,338 @@ int16_t tuning_get_motor_cutoff(void)
 {
     return current_config.esc.motor_cutoff;
 }
+
+// ============================================================================
+// Compiled Transfer Tables
+// ============================================================================
+//
+// Everything between the stick and the pulse that only depends on the config
+// is folded into tables here whenever the config changes. The per-tick path
+// is then: expo lookup -> speed scaling -> (realistic smoothing) ->
+// (geometry lookup) -> one multiply per axle. The tuning_apply_* /
+// tuning_calc_* functions above and steering_geometry_position() stay as the
+// reference implementation; tuning_lut_max_error() compares the two.
+
+#define EXPO_LUT_SEGMENTS       64      // Segments over |input| 0..1000
+#define GEOMETRY_LUT_SEGMENTS   64      // Segments over |steer| 0..1000
+
+// One servo's transfer for one steering mode:
+// pulse = center + (steer * k) >> 16, k chosen by sign of steer, then clamped
+typedef struct {
+    int32_t k_neg;              // Q16 gain used when steer < 0
+    int32_t k_pos;              // Q16 gain used when steer >= 0
+    int16_t center;
+    uint16_t min_us;
+    uint16_t max_us;
+} servo_lut_t;
+
+// ESC transfer: deadzone + limits before realistic physics, pulse map after
+typedef struct {
+    int32_t limit_neg;          // Q16 limit gain for throttle < 0 (reverse folded in)
+    int32_t limit_pos;          // Q16 limit gain for throttle > 0 (reverse folded in)
+    int32_t k_neg;              // Q16 pulse gain for throttle < 0
+    int32_t k_pos;              // Q16 pulse gain for throttle >= 0
+    int16_t center;
+    int16_t deadzone;
+} esc_lut_t;
+
+typedef struct {
+    int16_t expo[EXPO_LUT_SEGMENTS + 1];
+    bool expo_linear;
+    servo_lut_t servo[STEER_MODE_COUNT][SERVO_COUNT];
+    bool geometry;              // Servo input is the geometry position, not steer
+    int16_t geometry_pos[STEER_MODE_COUNT][SERVO_COUNT][GEOMETRY_LUT_SEGMENTS + 1];
+    esc_lut_t esc;
+} lut_bank_t;
+
+// Only the config owner (the control task) rebuilds or swaps banks, between
+// ticks, so a tick never mixes two configs: a rebuild fills the spare bank
+// and swaps it with the active one. The third bank holds the tables of a
+// staged config, built by the stager, until the control task swaps it in.
+static lut_bank_t lut_banks[3];
+static const lut_bank_t * volatile lut_active = &lut_banks[0];
+static lut_bank_t *lut_spare = &lut_banks[1];
+static lut_bank_t *lut_stage = &lut_banks[2];
+
+/**
+ * @brief Signed percent an axle follows the steering input in a mode
+ * Crab mode steers every axle at 100% (no ratios)
+ */
+static int32_t mode_axle_gain(const tuning_config_t *cfg, steering_mode_t mode, uint8_t axle)
+{
+    int32_t sign = steering_geometry_axle_sign(mode, axle);
+    if (mode == STEER_MODE_CRAB) {
+        return sign * 100;
+    }
+    return sign * axle_ratio(&cfg->steering, axle, mode);
+}
+
+/**
+ * @brief Build the expo curve table (odd-symmetric, stored for |x|)
+ */
+static void lut_build_expo(lut_bank_t *bank, const tuning_config_t *cfg)
+{
+    uint8_t expo = cfg->steering.expo;
+    bank->expo_linear = (expo == 0);
+
+    for (int i = 0; i <= EXPO_LUT_SEGMENTS; i++) {
+        double x = (1000.0 * i) / EXPO_LUT_SEGMENTS;
+        double y = (x * (100 - expo) + (x * x * x / 1e6) * expo) / 100.0;
+        if (y > 1000.0) y = 1000.0;
+        bank->expo[i] = (int16_t)lround(y);
+    }
+}
+
+/**
+ * @brief Build per-mode, per-axle steer->position curves
+ *
+ * Only when geometry is enabled and valid; otherwise the servo gains carry
+ * the axle ratios and the bank has no curves.
+ */
+static void lut_build_geometry(lut_bank_t *bank, const tuning_config_t *cfg)
+{
+    static bool warned = false;
+    const steering_tuning_t *steering = &cfg->steering;
+
+    bank->geometry = steering->geometry_enabled && steering_geometry_valid(steering);
+    if (steering->geometry_enabled && !bank->geometry) {
+        if (!warned) {
+            ESP_LOGW(TAG, "Steering geometry invalid (axle positions must increase, "
+                     "lock %d-%d deg), using axle ratios", GEOMETRY_MIN_ANGLE_DEG, GEOMETRY_MAX_ANGLE_DEG);
+            warned = true;
+        }
+        return;
+    }
+    warned = false;
+
+    if (!bank->geometry) {
+        return;
+    }
+
+    for (int m = 0; m < STEER_MODE_COUNT; m++) {
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            steering_geometry_build(steering, (steering_mode_t)m, i,
+                                    bank->geometry_pos[m][i], GEOMETRY_LUT_SEGMENTS);
+        }
+    }
+}
+
+/**
+ * @brief Build per-mode, per-servo position->pulse segments
+ */
+static void lut_build_servos(lut_bank_t *bank, const tuning_config_t *cfg)
+{
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        const servo_tuning_t *servo = &cfg->servos[i];
+
+        int32_t center = SERVO_CENTER_US + servo->subtrim + servo->trim;
+        int32_t min_us = servo->min_us + servo->subtrim;
+        int32_t max_us = servo->max_us + servo->subtrim;
+        if (min_us < SERVO_MIN_US) min_us = SERVO_MIN_US;
+        if (max_us > SERVO_MAX_US) max_us = SERVO_MAX_US;
+
+        for (int m = 0; m < STEER_MODE_COUNT; m++) {
+            servo_lut_t *lut = &bank->servo[m][i];
+            // Geometry curves are signed positions already
+            int32_t gain = bank->geometry ? 100 : mode_axle_gain(cfg, (steering_mode_t)m, i);
+            if (servo->reversed) gain = -gain;
+
+            // The side of center the servo moves to depends on the sign of
+            // the mixed position, i.e. sign(input) * sign(gain)
+            int32_t span_if_pos = max_us - center;
+            int32_t span_if_neg = center - min_us;
+            int32_t span_neg = (gain > 0) ? span_if_neg : span_if_pos;
+            int32_t span_pos = (gain > 0) ? span_if_pos : span_if_neg;
+
+            // pulse = center + input * (gain / 100) * (span / 1000)
+            lut->k_neg = (int32_t)(((int64_t)gain * span_neg * 65536) / 100000);
+            lut->k_pos = (int32_t)(((int64_t)gain * span_pos * 65536) / 100000);
+            lut->center = (int16_t)center;
+            lut->min_us = (uint16_t)min_us;
+            lut->max_us = (uint16_t)max_us;
+        }
+    }
+}
+
+/**
+ * @brief Build ESC pre-physics limits and pulse map
+ */
+static void lut_build_esc(lut_bank_t *bank, const tuning_config_t *cfg)
+{
+    const esc_tuning_t *esc = &cfg->esc;
+    esc_lut_t *lut = &bank->esc;
+
+    // Reverse swaps which limit applies to which stick direction
+    int32_t fwd = (esc->fwd_limit * 65536) / 100;
+    int32_t rev = (esc->rev_limit * 65536) / 100;
+    lut->limit_pos = esc->reversed ? -rev : fwd;
+    lut->limit_neg = esc->reversed ? -fwd : rev;
+    lut->deadzone = esc->deadzone;
+
+    int32_t center = SERVO_CENTER_US + esc->subtrim;
+    lut->center = (int16_t)center;
+    lut->k_neg = ((center - RC_DEFAULT_MIN_US) * 65536) / 1000;
+    lut->k_pos = ((RC_DEFAULT_MAX_US - center) * 65536) / 1000;
+}
+
+/**
+ * @brief Compile all tables for a config into a bank
+ */
+static void lut_build(lut_bank_t *bank, const tuning_config_t *cfg)
+{
+    lut_build_expo(bank, cfg);
+    lut_build_geometry(bank, cfg);
+    lut_build_servos(bank, cfg);
+    lut_build_esc(bank, cfg);
+}
+
+/**
+ * @brief Recompile all tables from current_config and swap them in (owner only)
+ */
+static void lut_rebuild(void)
+{
+    lut_bank_t *bank = lut_spare;
+
+    lut_build(bank, &current_config);
+
+    lut_spare = (lut_bank_t *)lut_active;
+    lut_active = bank;
+}
+
+/**
+ * @brief Compile a staged config into the stage bank (stager task)
+ */
+static void lut_stage_build(const tuning_config_t *cfg)
+{
+    lut_build(lut_stage, cfg);
+}
+
+/**
+ * @brief Make the stage bank active; the old active bank becomes the stage bank (owner only)
+ */
+static void lut_stage_swap(void)
+{
+    lut_bank_t *bank = lut_stage;
+    lut_stage = (lut_bank_t *)lut_active;
+    lut_active = bank;
+}
+
+/**
+ * @brief Q16 multiply truncating toward zero, like the integer reference
+ */
+static inline int32_t mul_q16(int32_t x, int32_t k)
+{
+    int32_t p = x * k;
+    return (p >= 0) ? (p >> 16) : -((-p) >> 16);
+}
+
+/**
+ * @brief Interpolate a table sampled over |x| 0..1000 in equal segments
+ */
+static inline int32_t lut_interp(const int16_t *table, int32_t segments, int32_t mag)
+{
+    if (mag > 1000) mag = 1000;
+
+    // Position in the table in Q8
+    int32_t pos = (mag * segments * 256) / 1000;
+    int32_t idx = pos >> 8;
+    int32_t frac = pos & 0xFF;
+    int32_t y = table[idx];
+    if (idx < segments) {
+        y += ((table[idx + 1] - y) * frac) >> 8;
+    }
+    return y;
+}
+
+int16_t tuning_lut_expo(int16_t input)
+{
+    const lut_bank_t *bank = lut_active;
+
+    if (bank->expo_linear) {
+        return input;
+    }
+
+    int32_t y = lut_interp(bank->expo, EXPO_LUT_SEGMENTS, (input < 0) ? -input : input);
+    return (int16_t)((input < 0) ? -y : y);
+}
+
+uint16_t tuning_lut_servo_pulse(steering_mode_t mode, uint8_t servo_idx, int16_t steer)
+{
+    if (mode >= STEER_MODE_COUNT || servo_idx >= SERVO_COUNT) {
+        return SERVO_CENTER_US;
+    }
+
+    const lut_bank_t *bank = lut_active;
+    const servo_lut_t *lut = &bank->servo[mode][servo_idx];
+
+    int32_t x = steer;
+    if (bank->geometry) {
+        int32_t pos = lut_interp(bank->geometry_pos[mode][servo_idx], GEOMETRY_LUT_SEGMENTS,
+                                 (steer < 0) ? -steer : steer);
+        x = (steer < 0) ? -pos : pos;
+    }
+    int32_t pulse = lut->center + mul_q16(x, (x < 0) ? lut->k_neg : lut->k_pos);
+
+    if (pulse < lut->min_us) pulse = lut->min_us;
+    if (pulse > lut->max_us) pulse = lut->max_us;
+    return (uint16_t)pulse;
+}
+
+uint16_t tuning_lut_esc_pulse(int16_t throttle)
+{
+    const esc_lut_t *lut = &lut_active->esc;
+
+    // Deadzone, then limits (reverse is folded into the limit gains)
+    int32_t t = throttle;
+    if (t > -lut->deadzone && t < lut->deadzone) {
+        t = 0;
+    } else {
+        t = mul_q16(t, (t < 0) ? lut->limit_neg : lut->limit_pos);
+    }
+
+    if (current_throttle_mode == THROTTLE_MODE_REALISTIC) {
+        t = tuning_apply_realistic_throttle((int16_t)t);
+    }
+    t = apply_supply_gain(t);
+
+    int32_t pulse = lut->center + mul_q16(t, (t < 0) ? lut->k_neg : lut->k_pos);
+
+    if (pulse < RC_DEFAULT_MIN_US) pulse = RC_DEFAULT_MIN_US;
+    if (pulse > RC_DEFAULT_MAX_US) pulse = RC_DEFAULT_MAX_US;
+    return (uint16_t)pulse;
+}
+
+uint16_t tuning_lut_max_error(void)
+{
+    const steering_tuning_t *steering = &current_config.steering;
+    bool geometry = lut_active->geometry;
+    int32_t worst = 0;
+
+    for (int32_t x = -1000; x <= 1000; x++) {
+        int32_t err = tuning_lut_expo(x) - tuning_apply_expo(x);
+        if (err < 0) err = -err;
+        if (err > worst) worst = err;
+
+        for (int m = 0; m < STEER_MODE_COUNT; m++) {
+            for (int i = 0; i < SERVO_COUNT; i++) {
+                int16_t position = geometry
+                    ? steering_geometry_position(steering, (steering_mode_t)m, i, x)
+                    : (int16_t)((x * mode_axle_gain(&current_config, (steering_mode_t)m, i)) / 100);
+                err = tuning_lut_servo_pulse((steering_mode_t)m, i, x) - tuning_calc_servo_pulse(i, position);
+                if (err < 0) err = -err;
+                if (err > worst) worst = err;
+            }
+        }
+    }
+
+    // ESC is only comparable outside realistic mode (physics is stateful)
+    if (current_throttle_mode != THROTTLE_MODE_REALISTIC) {
+        for (int32_t x = -1000; x <= 1000; x++) {
+            int32_t err = tuning_lut_esc_pulse(x) - tuning_calc_esc_pulse(x);
+            if (err < 0) err = -err;
+            if (err > worst) worst = err;
+        }
+    }
+
+    return (uint16_t)worst;
+}
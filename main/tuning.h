@@ -11,6 +11,7 @@
 
 #include "config.h"
 #include "esp_err.h"
+#include "json_config.h"
 
 /**
  * @brief Initialize tuning system
@@ -26,10 +27,25 @@ esp_err_t tuning_init(tuning_config_t *config);
  */
 const tuning_config_t* tuning_get_config(void);
 
+/**
+ * @brief Copy the current config consistently from any task
+ *
+ * The control task may be applying live edits or a staged config while
+ * another task reads; the copy is retried until it saw no write.
+ * @param config Destination
+ */
+void tuning_copy_config(tuning_config_t *config);
+
 /**
  * @brief Update tuning configuration
+ *
+ * Only the control task writes the config and swaps the tables. Called from
+ * any other task once it has bound, the config is staged and the call waits
+ * for the control task to take it at the start of its next tick.
  * @param config New configuration to apply
- * @return ESP_OK on success
+ * @return ESP_OK once applied (or claimed by the control task), or
+ *         ESP_ERR_TIMEOUT if it was not taken within TUNING_HANDOFF_TIMEOUT_MS;
+ *         it is then withdrawn and never applies
  */
 esp_err_t tuning_set_config(const tuning_config_t *config);
 
@@ -40,18 +56,115 @@ esp_err_t tuning_set_config(const tuning_config_t *config);
 esp_err_t tuning_save(void);
 
 /**
- * @brief Reset tuning to factory defaults
+ * @brief Reset tuning to factory defaults (applied like tuning_set_config)
  * @param save_to_nvs If true, also saves defaults to NVS
  * @return ESP_OK on success
  */
 esp_err_t tuning_reset_defaults(bool save_to_nvs);
 
+/**
+ * @brief Make the calling task the only writer of the config and tables
+ *
+ * Called once by the control task before its loop. Until then changes apply
+ * in place in the caller; afterwards tuning_set_config() from other tasks
+ * goes through the stage and tuning_live_apply() picks it up.
+ */
+void tuning_bind_control_task(void);
+
+// ============================================================================
+// Live Edits
+// ============================================================================
+
+/**
+ * @brief JSON keys of the tuning API, one per tuning_config_t member
+ *
+ * Live edit ids index this table, so the web UI key lists follow its order.
+ */
+extern const json_field_t tuning_json_fields[];
+extern const size_t tuning_json_field_count;
+
+/**
+ * @brief Queue a single-field edit from the web UI (never blocks)
+ *
+ * Edits are applied by tuning_live_apply() at the start of the next control
+ * tick, so the control loop never sees a half-written config. They are not
+ * saved; call tuning_save() to persist the result. One producer only (the
+ * httpd task).
+ * @param field Member of tuning_config_t to write (value saturates to its range)
+ * @param value New value
+ * @return false if the queue was full and the edit was dropped
+ */
+bool tuning_live_push(const json_field_t *field, int32_t value);
+
+/**
+ * @brief Apply queued live edits (control task, once per tick)
+ * @return true if the config changed (output rates may need reapplying)
+ */
+bool tuning_live_apply(void);
+
+/**
+ * @brief Stage a whole config to be swapped in at the next control tick
+ *
+ * Compiles the lookup tables for config into a third bank in the calling
+ * task (meant for a low-priority one); tuning_live_apply() then copies the
+ *  * config in and swaps the bank pointer, so the switch costs the control
+ * task no table rebuild. Not saved. Any task may stage; only one config is
+ * staged at a time.
+ * @param config Config to apply (rates are validated like tuning_set_config)
+ * @return false if another config is being staged or is waiting to be taken
+ */
+bool tuning_stage_config(const tuning_config_t *config);
+
+/**
+ * @brief Check whether a staged config is being built or waiting to be taken
+ */
+bool tuning_stage_pending(void);
+
 /**
  * @brief Set default tuning values
  * @param config Config struct to fill with defaults
  */
 void tuning_get_defaults(tuning_config_t *config);
 
+/**
+ * @brief Get the fastest output rate the configured pulse endpoints allow
+ *
+ * The frame period must fit the longest pulse plus OUTPUT_MIN_FRAME_GAP_US.
+ * Rates in the config are clamped to this on load and on set.
+ * @param config Config to check endpoints of
+ * @param servo_group true for the servo group, false for the ESC
+ * @return Maximum rate in Hz (capped at OUTPUT_RATE_MAX_HZ)
+ */
+uint16_t tuning_max_output_rate_hz(const tuning_config_t *config, bool servo_group);
+
+// ============================================================================
+// Physics Time Step
+// ============================================================================
+
+/**
+ * @brief Set the elapsed time since the previous control tick
+ * Realistic throttle/steering rates are defined per PHYSICS_REF_DT_US and
+ * scaled by this, so feel is independent of the control loop rate.
+ * Call once per tick before the tuning_apply_* physics functions.
+ * @param dt_us Elapsed microseconds (clamped to CONTROL_DT_MAX_US)
+ */
+void tuning_set_dt_us(uint32_t dt_us);
+
+/**
+ * @brief Set the ESC supply sag gain
+ * Applied to the throttle command after limits and realistic throttle by
+ * both tuning_calc_esc_pulse() and tuning_lut_esc_pulse(). Set by the
+ * battery task; stays 1.0 without battery sensing.
+ * @param gain_q16 Gain in Q16 (65536 = 1.0, clamped to 1.0..2.0)
+ */
+void tuning_set_supply_gain_q16(int32_t gain_q16);
+
+/**
+ * @brief Get the current tick length relative to the reference tick
+ * @return dt in Q8 (256 = one PHYSICS_REF_DT_US tick)
+ */
+int32_t tuning_get_dt_q8(void);
+
 // ============================================================================
 // Servo Output Calculation (applies tuning to raw values)
 // ============================================================================
@@ -67,7 +180,7 @@ uint16_t tuning_calc_servo_pulse(uint8_t servo_idx, int16_t position);
 
 /**
  * @brief Calculate ESC pulse with tuning applied
- * Applies limits, subtrim, deadzone, and reverse
+ * Applies limits, subtrim, deadzone, reverse and the supply sag gain
  * @param throttle Normalized throttle (-1000 to +1000)
  * @return Pulse width in microseconds
  */
@@ -102,6 +215,27 @@ int16_t tuning_apply_realistic_steering(int16_t target_input);
  */
 void tuning_reset_realistic_steering(void);
 
+/**
+ * @brief Extrapolate the steering input between RC frames
+ *
+ * A 50 Hz receiver moves the input in 20 ms steps, which a fast servo
+ * follows as a staircase. Each control tick this runs the input ahead
+ * along the last frame-to-frame step by the age of the frame, for at most
+ * steering.predict_ms and one frame interval, so the output never gets
+ * more than one step ahead of the stick. A pass-through when predict_ms
+ * is 0. Call once per tick before the expo curve.
+ * @param input Calibrated steering input (-1000 to +1000)
+ * @param frame_edge_us Edge time of the latest RC frame (rc_input_get_frame_edge_us())
+ * @param now_us Current esp_timer time (low 32 bits)
+ * @return Predicted steering input
+ */
+int16_t tuning_predict_steering(int16_t input, uint32_t frame_edge_us, uint32_t now_us);
+
+/**
+ * @brief Forget the last frames (e.g., on signal loss)
+ */
+void tuning_reset_steering_prediction(void);
+
 /**
  * @brief Check if realistic steering is enabled
  * @return true if enabled in config
@@ -132,11 +266,12 @@ uint8_t tuning_get_axle_ratio(uint8_t axle_idx, steering_mode_t mode);
 /**
  * @brief Apply speed-dependent steering reduction
  * Reduces steering at higher speeds for stability
- * Uses simulated velocity (current output) not throttle input
+ * Uses vehicle velocity (current output) not throttle input
  * @param steering Input steering value (-1000 to +1000)
+ * @param velocity Vehicle velocity from vehicle_state_t (-1000 to +1000)
  * @return Reduced steering value
  */
-int16_t tuning_apply_speed_steering(int16_t steering);
+int16_t tuning_apply_speed_steering(int16_t steering, int16_t velocity);
 
 /**
  * @brief Throttle mode selection (3-position switch)
@@ -185,5 +320,50 @@ bool tuning_is_motor_stopped(void);
  */
 int16_t tuning_get_motor_cutoff(void);
 
+// ============================================================================
+// Compiled Transfer Tables (hot path)
+// ============================================================================
+// Rebuilt automatically whenever the config changes (init, set, reset).
+// They produce the same result as the reference functions above to within
+// 2 us: integer rounding, doubled once the supply sag gain scales the ESC
+// pulse. tools/host-bench fails when a table differs by more.
+
+/**
+ * @brief Steering expo curve via table lookup
+ * Equivalent to tuning_apply_expo()
+ * @param input Input value (-1000 to +1000)
+ * @return Output value with expo applied
+ */
+int16_t tuning_lut_expo(int16_t input);
+
+/**
+ * @brief Servo pulse for an axle from the steering input via table
+ * Folds the mode's axle mix, axle ratios, reverse, endpoints, subtrim and
+ * trim into one segment per side; equivalent to tuning_get_axle_ratio() +
+ * tuning_calc_servo_pulse(). With turning-center geometry the position
+ * comes from a per-mode, per-axle curve instead of the ratio
+ * (steering_geometry_position()).
+ * @param mode Steering mode
+ * @param servo_idx Servo index (0-3)
+ * @param steer Steering input after expo/speed/realistic (-1000 to +1000)
+ * @return Pulse width in microseconds
+ */
+uint16_t tuning_lut_servo_pulse(steering_mode_t mode, uint8_t servo_idx, int16_t steer);
+
+/**
+ * @brief ESC pulse via precomputed gains
+ * Equivalent to tuning_calc_esc_pulse() (including realistic throttle)
+ * @param throttle Normalized throttle (-1000 to +1000)
+ * @return Pulse width in microseconds
+ */
+uint16_t tuning_lut_esc_pulse(int16_t throttle);
+
+/**
+ * @brief Compare the tables against the reference functions
+ * Sweeps every input for expo and every mode/servo; slow, debug use only
+ * @return Largest absolute difference found (us or input units)
+ */
+uint16_t tuning_lut_max_error(void);
+
 #endif // TUNING_H
 
@@ -1,43 +1,304 @@
 /**
  * @file udp_log.c
  * @brief UDP broadcast logging for wireless debugging
+ *
+ * The ring is a bounded multi-producer queue of fixed-size lines: each
+ * line carries a sequence number that tells producers whether it is free
+ * and the sender whether it is complete, so a producer that stalls halfway
+ * only holds back the lines after it, and a full ring never blocks anyone.
+ *
+ * Telemetry ticks come from the control task alone and use a plain
+ * single-producer ring; the same task sends them to the subscribed host.
  */
 
 #include "udp_log.h"
+#include "config.h"
+#include "tuning.h"
+#include "health.h"
+#include "esp_timer.h"
 #include "esp_log.h"
 #include "lwip/sockets.h"
 #include "lwip/netdb.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include <string.h>
+#include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
 
 static const char *TAG = "UDP_LOG";
 
 #define UDP_LOG_PORT 5555
 #define UDP_LOG_BROADCAST "255.255.255.255"
 
+_Static_assert((UDP_LOG_RING_LINES & (UDP_LOG_RING_LINES - 1)) == 0, "UDP_LOG_RING_LINES must be a power of 2");
+_Static_assert(UDP_LOG_LINE_MAX <= UDP_LOG_DATAGRAM_MAX, "a line must fit a datagram");
+_Static_assert((UDP_TELEMETRY_RING & (UDP_TELEMETRY_RING - 1)) == 0, "UDP_TELEMETRY_RING must be a power of 2");
+_Static_assert(sizeof(udp_telemetry_header_t) == 24, "telemetry header layout must match tools/udp-listen.js");
+
+#define TELEMETRY_BATCH ((UDP_LOG_DATAGRAM_MAX - sizeof(udp_telemetry_header_t)) / sizeof(trace_record_t))
+
+typedef struct {
+    uint32_t seq;               // == position: free, == position + 1: complete
+    uint16_t len;
+    char text[UDP_LOG_LINE_MAX];
+} log_line_t;
+
+static log_line_t ring[UDP_LOG_RING_LINES];
+static uint32_t ring_tail = 0;          // Next position to claim (producers, CAS)
+static uint32_t ring_head = 0;          // Next position to send (sender task only)
+static uint32_t dropped = 0;
+
 static int udp_socket = -1;
 static struct sockaddr_in broadcast_addr;
+static bool ring_ready = false;         // Line sequence numbers set (once; the ring outlives the sender)
+
+// Sender task, stopped by udp_log_deinit() when WiFi is torn down
+static TaskHandle_t sender_task = NULL;
+static volatile bool sender_stop = false;
+static vprintf_like_t serial_vprintf = NULL;    // ESP_LOG output before the redirect
+
+// Telemetry: control task -> sender task
+static trace_record_t telemetry_ring[UDP_TELEMETRY_RING];
+static uint32_t telemetry_head = 0;     // Records queued (control task)
+static uint32_t telemetry_tail = 0;     // Records sent (sender task)
+static uint32_t telemetry_dropped = 0;
+static uint32_t telemetry_divisor = 0;  // Queue every Nth tick, 0 while nobody subscribes
+static uint32_t telemetry_ticks = 0;    // Control task only
+
+// Subscription (sender task only)
+static int telemetry_socket = -1;
+static struct sockaddr_in telemetry_host;
+static int64_t telemetry_renewed_us = 0;
+static uint32_t telemetry_seq = 0;
+
+/**
+ * @brief Claim a free line, or NULL if the ring is full
+ */
+static log_line_t *line_claim(uint32_t *pos)
+{
+    uint32_t p = __atomic_load_n(&ring_tail, __ATOMIC_RELAXED);
+    while (1) {
+        log_line_t *line = &ring[p & (UDP_LOG_RING_LINES - 1)];
+        int32_t diff = (int32_t)(__atomic_load_n(&line->seq, __ATOMIC_ACQUIRE) - p);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&ring_tail, &p, p + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                *pos = p;
+                return line;
+            }
+            // p reloaded by the failed exchange
+        } else if (diff < 0) {
+            return NULL;        // Not yet sent since the last lap
+        } else {
+            p = __atomic_load_n(&ring_tail, __ATOMIC_RELAXED);
+        }
+    }
+}
 
 // Custom vprintf function for ESP_LOG redirection
 static int udp_log_vprintf(const char *fmt, va_list args)
 {
-    char buf[256];
-    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_list serial_args;
+    va_copy(serial_args, args);
+
+    uint32_t pos;
+    log_line_t *line = line_claim(&pos);
+    if (line) {
+        int len = vsnprintf(line->text, sizeof(line->text), fmt, args);
+        if (len < 0) {
+            len = 0;
+        } else if (len >= (int)sizeof(line->text)) {
+            len = sizeof(line->text) - 1;
+            line->text[len - 1] = '\n';     // Keep truncated lines apart
+        }
+        line->len = (uint16_t)len;
+        __atomic_store_n(&line->seq, pos + 1, __ATOMIC_RELEASE);
+    } else {
+        __atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);
+    }
 
     // Always print to serial too
-    vprintf(fmt, args);
+    int ret = vprintf(fmt, serial_args);
+    va_end(serial_args);
+    return ret;
+}
+
+/**
+ * @brief Append completed lines to a datagram
+ * @return Bytes in the datagram
+ */
+static size_t batch_lines(char *datagram, size_t len)
+{
+    while (1) {
+        log_line_t *line = &ring[ring_head & (UDP_LOG_RING_LINES - 1)];
+        if (__atomic_load_n(&line->seq, __ATOMIC_ACQUIRE) != ring_head + 1 ||
+            len + line->len > UDP_LOG_DATAGRAM_MAX) {
+            return len;         // Not written yet, or for the next datagram
+        }
+        memcpy(datagram + len, line->text, line->len);
+        len += line->len;
+        __atomic_store_n(&line->seq, ring_head + UDP_LOG_RING_LINES, __ATOMIC_RELEASE);
+        ring_head++;
+    }
+}
+
+// ============================================================================
+// TELEMETRY
+// ============================================================================
+
+/**
+ * @brief Read pending "TLM <hz>" subscriptions and expire a silent host
+ */
+static void telemetry_poll_subscription(void)
+{
+    char msg[16];
+    struct sockaddr_in from;
+    socklen_t from_len = sizeof(from);
+    int n;
+
+    while ((n = recvfrom(telemetry_socket, msg, sizeof(msg) - 1, MSG_DONTWAIT,
+                         (struct sockaddr *)&from, &from_len)) > 0) {
+        msg[n] = '\0';
+        from_len = sizeof(from);
+        if (strncmp(msg, "TLM ", 4) != 0) {
+            continue;
+        }
+
+        uint32_t loop_hz = tuning_get_config()->control.loop_rate_hz;
+        int hz = atoi(msg + 4);
+        uint32_t divisor = 0;
+        if (hz > 0) {
+            divisor = (uint32_t)hz >= loop_hz ? 1 : (loop_hz + hz - 1) / hz;
+        }
+
+        bool new_host = telemetry_host.sin_addr.s_addr != from.sin_addr.s_addr ||
+                        telemetry_host.sin_port != from.sin_port ||
+                        __atomic_load_n(&telemetry_divisor, __ATOMIC_RELAXED) != divisor;
+        telemetry_host = from;
+        telemetry_renewed_us = esp_timer_get_time();
+        if (new_host) {
+            telemetry_seq = 0;
+            __atomic_store_n(&telemetry_divisor, divisor, __ATOMIC_RELAXED);
+            ESP_LOGI(TAG, divisor ? "Telemetry to %s:%u at %lu Hz" : "Telemetry stopped by %s:%u",
+                     inet_ntoa(from.sin_addr), ntohs(from.sin_port), (unsigned long)(loop_hz / (divisor ? divisor : 1)));
+        }
+    }
 
-    // Send over UDP if socket is ready
-    if (udp_socket >= 0 && len > 0) {
-        sendto(udp_socket, buf, len, 0,
-               (struct sockaddr *)&broadcast_addr, sizeof(broadcast_addr));
+    if (__atomic_load_n(&telemetry_divisor, __ATOMIC_RELAXED) &&
+        esp_timer_get_time() - telemetry_renewed_us > (int64_t)UDP_TELEMETRY_TIMEOUT_MS * 1000) {
+        __atomic_store_n(&telemetry_divisor, 0, __ATOMIC_RELAXED);
+        ESP_LOGI(TAG, "Telemetry subscription expired");
     }
+}
+
+/**
+ * @brief Send queued telemetry records in full datagrams
+ */
+static void telemetry_send(char *datagram)
+{
+    uint32_t divisor = __atomic_load_n(&telemetry_divisor, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&telemetry_head, __ATOMIC_ACQUIRE);
+
+    while (telemetry_tail != head) {
+        uint32_t count = head - telemetry_tail;
+        if (count > TELEMETRY_BATCH) {
+            count = TELEMETRY_BATCH;
+        }
+
+        udp_telemetry_header_t *hdr = (udp_telemetry_header_t *)datagram;
+        *hdr = (udp_telemetry_header_t){
+            .magic = UDP_TELEMETRY_MAGIC,
+            .version = UDP_TELEMETRY_VERSION,
+            .record_size = sizeof(trace_record_t),
+            .seq = telemetry_seq++,
+            .first = telemetry_tail,
+            .count = (uint16_t)count,
+            .rate_hz = (uint16_t)(tuning_get_config()->control.loop_rate_hz / (divisor ? divisor : 1)),
+            .dropped = __atomic_load_n(&telemetry_dropped, __ATOMIC_RELAXED),
+        };
+        trace_record_t *records = (trace_record_t *)(datagram + sizeof(*hdr));
+        for (uint32_t i = 0; i < count; i++) {
+            records[i] = telemetry_ring[(telemetry_tail + i) & (UDP_TELEMETRY_RING - 1)];
+        }
+        __atomic_store_n(&telemetry_tail, telemetry_tail + count, __ATOMIC_RELEASE);
 
-    return len;
+        if (divisor) {
+            sendto(telemetry_socket, datagram, sizeof(*hdr) + count * sizeof(trace_record_t), 0,
+                   (struct sockaddr *)&telemetry_host, sizeof(telemetry_host));
+        }
+    }
+}
+
+void udp_log_telemetry(const trace_record_t *record)
+{
+    uint32_t divisor = __atomic_load_n(&telemetry_divisor, __ATOMIC_RELAXED);
+    if (divisor == 0 || ++telemetry_ticks < divisor) {
+        return;
+    }
+    telemetry_ticks = 0;
+
+    uint32_t head = telemetry_head;
+    if (head - __atomic_load_n(&telemetry_tail, __ATOMIC_ACQUIRE) >= UDP_TELEMETRY_RING) {
+        __atomic_fetch_add(&telemetry_dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    telemetry_ring[head & (UDP_TELEMETRY_RING - 1)] = *record;
+    __atomic_store_n(&telemetry_head, head + 1, __ATOMIC_RELEASE);
+}
+
+// ============================================================================
+// SENDER TASK
+// ============================================================================
+
+static void udp_log_task(void *arg)
+{
+    static char datagram[UDP_LOG_DATAGRAM_MAX];
+    uint32_t reported = 0;
+    (void)arg;
+
+    while (!sender_stop) {
+        vTaskDelay(pdMS_TO_TICKS(UDP_LOG_FLUSH_MS));
+        health_beat(HEALTH_TASK_LOG, UDP_LOG_FLUSH_MS * 1000);
+
+        size_t len = 0;
+        uint32_t lost = __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+        if (lost != reported) {
+            len = snprintf(datagram, sizeof(datagram), "[udp_log] %lu lines dropped\n",
+                           (unsigned long)(lost - reported));
+            reported = lost;
+        }
+
+        while ((len = batch_lines(datagram, len)) > 0) {
+            sendto(udp_socket, datagram, len, 0,
+                   (struct sockaddr *)&broadcast_addr, sizeof(broadcast_addr));
+            len = 0;
+        }
+
+        if (telemetry_socket >= 0) {
+            telemetry_poll_subscription();
+            telemetry_send(datagram);
+        }
+    }
+
+    // Stopped: the sockets go with the task
+    __atomic_store_n(&telemetry_divisor, 0, __ATOMIC_RELAXED);
+    if (telemetry_socket >= 0) {
+        close(telemetry_socket);
+        telemetry_socket = -1;
+    }
+    close(udp_socket);
+    udp_socket = -1;
+    sender_task = NULL;
+    vTaskDelete(NULL);
 }
 
 esp_err_t udp_log_init(void)
 {
+    if (udp_socket >= 0) {
+        return ESP_OK;
+    }
+
     // Create UDP socket
     udp_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
     if (udp_socket < 0) {
@@ -61,10 +322,80 @@ esp_err_t udp_log_init(void)
     broadcast_addr.sin_port = htons(UDP_LOG_PORT);
     broadcast_addr.sin_addr.s_addr = inet_addr(UDP_LOG_BROADCAST);
 
+    // Telemetry subscriptions arrive on their own port; logging works without
+    telemetry_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (telemetry_socket >= 0) {
+        struct sockaddr_in bind_addr = {
+            .sin_family = AF_INET,
+            .sin_port = htons(UDP_TELEMETRY_PORT),
+            .sin_addr.s_addr = htonl(INADDR_ANY),
+        };
+        if (bind(telemetry_socket, (struct sockaddr *)&bind_addr, sizeof(bind_addr)) < 0) {
+            ESP_LOGW(TAG, "Failed to bind telemetry port %d", UDP_TELEMETRY_PORT);
+            close(telemetry_socket);
+            telemetry_socket = -1;
+        }
+    }
+
+    if (!ring_ready) {
+        for (uint32_t i = 0; i < UDP_LOG_RING_LINES; i++) {
+            ring[i].seq = i;
+        }
+        ring_ready = true;
+    }
+
+    sender_stop = false;
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        udp_log_task,
+        "udp_log",
+        UDP_LOG_TASK_STACK_SIZE,
+        NULL,
+        UDP_LOG_TASK_PRIORITY,
+        &sender_task,
+        UDP_LOG_TASK_CORE
+    );
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create UDP log task");
+        sender_task = NULL;
+        close(udp_socket);
+        udp_socket = -1;
+        return ESP_FAIL;
+    }
+
     // Redirect ESP_LOG output to our custom function
-    esp_log_set_vprintf(udp_log_vprintf);
+    vprintf_like_t prev = esp_log_set_vprintf(udp_log_vprintf);
+    if (prev != udp_log_vprintf) {
+        serial_vprintf = prev;
+    }
 
-    ESP_LOGI(TAG, "UDP logging started on port %d", UDP_LOG_PORT);
+    ESP_LOGI(TAG, "UDP logging started on port %d (telemetry on %d)", UDP_LOG_PORT, UDP_TELEMETRY_PORT);
 
     return ESP_OK;
 }
+
+bool udp_log_deinit(void)
+{
+    if (sender_task == NULL) {
+        return false;
+    }
+
+    // Serial only from here; lines already in the ring wait for the next start
+    esp_log_set_vprintf(serial_vprintf ? serial_vprintf : vprintf);
+    sender_stop = true;
+    for (int i = 0; i < 4 && sender_task != NULL; i++) {
+        vTaskDelay(pdMS_TO_TICKS(UDP_LOG_FLUSH_MS));
+    }
+    if (sender_task != NULL) {
+        ESP_LOGW(TAG, "UDP log task did not stop");
+        return true;
+    }
+
+    health_unwatch(HEALTH_TASK_LOG);
+    ESP_LOGI(TAG, "UDP logging stopped");
+    return true;
+}
+
+uint32_t udp_log_dropped(void)
+{
+    return __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+}
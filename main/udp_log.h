@@ -2,12 +2,61 @@
 #define UDP_LOG_H
 
 #include "esp_err.h"
+#include "trace.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UDP_TELEMETRY_PORT      5556
+#define UDP_TELEMETRY_MAGIC     0x594D4C54  // "TLMY"
+#define UDP_TELEMETRY_VERSION   1
+
+/**
+ * @brief Telemetry datagram header, followed by count trace_record_t
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;             // UDP_TELEMETRY_MAGIC
+    uint16_t version;           // UDP_TELEMETRY_VERSION
+    uint16_t record_size;       // sizeof(trace_record_t)
+    uint32_t seq;               // Datagram number since the subscription started
+    uint32_t first;             // Number of the first record (counts every record queued)
+    uint16_t count;             // Records that follow
+    uint16_t rate_hz;           // Record rate after decimation
+    uint32_t dropped;           // Records lost to a full ring since boot
+} udp_telemetry_header_t;
 
 /**
  * @brief Initialize UDP logging
  * Broadcasts ESP_LOG messages over UDP port 5555
  * Use: nc -u -l 5555 (Linux/Mac) or similar UDP listener
+ *
+ * Logging tasks only copy the line into a lock-free ring; a low-priority
+ * task sends the ring in batched datagrams, so a log call never waits on
+ * lwIP or WiFi. Lines that find the ring full are dropped and counted.
  */
 esp_err_t udp_log_init(void);
 
+/**
+ * @brief Stop UDP logging and close its sockets (WiFi teardown)
+ *
+ * Logging goes back to serial only and the sender task exits; lines
+ * still in the ring go out after the next udp_log_init().
+ * @return true if logging was running
+ */
+bool udp_log_deinit(void);
+
+/**
+ * @brief Lines dropped because the ring was full (since boot)
+ */
+uint32_t udp_log_dropped(void);
+
+/**
+ * @brief Queue a control tick for the telemetry stream (control task, never blocks)
+ *
+ * Streams only while a host is subscribed: it sends "TLM <hz>" to
+ * UDP_TELEMETRY_PORT at least every UDP_TELEMETRY_TIMEOUT_MS and gets
+ * telemetry datagrams back at its source address, at hz or at the loop
+ * rate if that is lower. "TLM 0" unsubscribes.
+ */
+void udp_log_telemetry(const trace_record_t *record);
+
 #endif // UDP_LOG_H
@@ -0,0 +1,256 @@
+/**
+ * @file vehicle.c
+ * @brief Vehicle dynamics model: direction, braking, gearbox, load and RPM
+ *
+ * Transmission simulation (3-speed automatic) with load-dependent shift
+ * points, torque converter slip and clutch engagement, modelled as in the
+ * Rc_Engine_Sound_ESP32 reference. Engine RPM follows the drivetrain's
+ * demand with the sound profile's acceleration/deceleration rates, at the
+ * same rate the mixer uses, so the audible RPM tracks the modelled one.
+ */
+
+#include "vehicle.h"
+#include "config.h"
+#include "tuning.h"
+#include "engine_sound.h"
+
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "VEHICLE";
+
+// Gear ratios (x10): reverse, 1st, 2nd, 3rd - based on GM Turbo HydraMatic 400
+static const int16_t gear_ratios[4] = {10, 25, 15, 10};  // 1.0, 2.5, 1.5, 1.0
+
+// Clutch engaging point - below this speed, RPM follows throttle not speed
+#define CLUTCH_ENGAGING_POINT   80
+
+// Shift lockout after any gear change, and sustained high RPM that allows
+// an upshift without first settling below the shift point
+#define SHIFT_LOCKOUT_MS        800
+#define UPSHIFT_OVERRIDE_MS     2000
+
+static vehicle_state_t state = {
+    .gear = 1,
+    .target_rpm = VEHICLE_IDLE_RPM,
+    .rpm = VEHICLE_IDLE_RPM,
+};
+
+// Gearbox and RPM model state
+static int64_t last_upshift_time = 0;
+static int64_t last_downshift_time = 0;
+static bool rpm_settled_after_upshift = true;   // Must see low RPM before next upshift
+static uint32_t rpm_residue = 0;
+
+/**
+ * @brief Move the modelled RPM towards target_rpm for one tick
+ *
+ * Same law as the mixer's update_rpm(): rates are per AUDIO_RPM_STEP_FRAMES
+ * and scaled by the audio frames this tick spans.
+ */
+static void update_rpm(uint16_t max_rpm, const engine_sound_config_t *cfg)
+{
+    int32_t diff = (int32_t)state.target_rpm - (int32_t)state.rpm;
+
+    if (diff == 0) {
+        rpm_residue = 0;
+    } else {
+        int32_t frames = (int32_t)(((int64_t)tuning_get_dt_q8() * PHYSICS_REF_DT_US * AUDIO_SAMPLE_RATE) /
+                                   (256LL * 1000000));
+        int32_t distance = abs(diff);
+        int32_t rate = distance / 10;
+        int32_t min_rate = (diff > 0) ? cfg->acceleration : cfg->deceleration;
+        if (rate < min_rate) rate = min_rate;
+
+        rpm_residue += rate * frames;
+        int32_t step = rpm_residue / AUDIO_RPM_STEP_FRAMES;
+        rpm_residue %= AUDIO_RPM_STEP_FRAMES;
+        if (step > distance) step = distance;
+
+        state.rpm = (diff > 0) ? state.rpm + step : state.rpm - step;
+    }
+
+    if (state.rpm < VEHICLE_IDLE_RPM) state.rpm = VEHICLE_IDLE_RPM;
+    if (state.rpm > max_rpm) state.rpm = max_rpm;
+}
+
+/**
+ * @brief Automatic gear selection for this tick
+ */
+static void select_gear(int64_t now, uint16_t max_rpm)
+{
+    uint16_t rpm_range = max_rpm - VEHICLE_IDLE_RPM;  // Usable RPM range
+    int16_t rpm = state.rpm;
+    int16_t load = state.load;
+
+    // Load-dependent shift points (scaled to actual RPM range)
+    // Reference: upshift at 78-98% of max, downshift at 30-50% of max
+    int16_t upshift_base = VEHICLE_IDLE_RPM + (rpm_range * 78 / 100);
+    int16_t upshift_max = VEHICLE_IDLE_RPM + (rpm_range * 98 / 100);
+    int16_t upshift_point = upshift_base + ((upshift_max - upshift_base) * load / 180);
+
+    int16_t downshift_base = VEHICLE_IDLE_RPM + (rpm_range * 30 / 100);
+    int16_t downshift_max = VEHICLE_IDLE_RPM + (rpm_range * 50 / 100);
+    int16_t downshift_point = downshift_base + ((downshift_max - downshift_base) * load / 180);
+
+    // Selecting reverse or leaving it is not a shift (no clunk, no power cut)
+    if (state.reversing) {
+        // Reverse - only one gear
+        state.gear = 0;
+        return;
+    }
+    if (state.gear == 0) {
+        // Coming out of reverse, start in 1st
+        state.gear = 1;
+        return;
+    }
+
+    // Track if RPM has settled below upshift point since last upshift
+    // This prevents back-to-back upshifts when accelerating hard
+    // But after a while, allow upshift anyway (sustained high RPM)
+    bool time_override = (now - last_upshift_time) > UPSHIFT_OVERRIDE_MS;
+    if (rpm < upshift_point - 30) {  // 30 RPM hysteresis
+        rpm_settled_after_upshift = true;
+    }
+    bool lockout = (now - last_upshift_time) <= SHIFT_LOCKOUT_MS ||
+                   (now - last_downshift_time) <= SHIFT_LOCKOUT_MS;
+
+    // Upshift: High RPM + low engine load
+    if (!lockout &&
+        (rpm_settled_after_upshift || time_override) &&
+        rpm >= upshift_point &&
+        load < 10 &&
+        state.gear < 3 &&
+        !state.braking) {
+        state.gear++;
+        state.shift_seq++;
+        last_upshift_time = now;
+        rpm_settled_after_upshift = false;  // Must settle again before next upshift
+        ESP_LOGI(TAG, "Upshift to gear %d (RPM=%d, load=%d)", state.gear, rpm, load);
+        return;
+    }
+
+    // Downshift: Low RPM OR high engine load (kickdown), or braking (engine
+    // braking in lower gear). No kickdown at max RPM (engine is giving all
+    // it can), and kickdown only drops to 2nd.
+    bool at_max_rpm = (rpm >= (max_rpm - 20));
+    bool kickdown_allowed = (load > 100) && !at_max_rpm && (state.gear > 2);
+
+    if (!lockout &&
+        state.gear > 1 &&
+        (rpm <= downshift_point || kickdown_allowed || state.braking)) {
+        state.gear--;
+        state.shift_seq++;
+        last_downshift_time = now;
+        rpm_settled_after_upshift = true;  // Downshift resets upshift settle requirement
+        ESP_LOGI(TAG, "Downshift to gear %d (RPM=%d, load=%d, braking=%d, kickdown=%d)",
+                 state.gear, rpm, load, state.braking, kickdown_allowed ? 1 : 0);
+    }
+}
+
+/**
+ * @brief Drivetrain RPM demand for this tick
+ */
+static uint16_t calc_target_rpm(uint16_t max_rpm)
+{
+    int32_t rpm;
+
+    if (state.braking && state.speed < CLUTCH_ENGAGING_POINT) {
+        // Braking at very low speed - engine goes to idle
+        rpm = VEHICLE_IDLE_RPM;
+    } else if (state.speed < CLUTCH_ENGAGING_POINT) {
+        // Below clutch engaging point: RPM follows throttle (revving at low speed)
+        rpm = VEHICLE_IDLE_RPM + (state.engine_throttle * (VEHICLE_MAX_RPM - VEHICLE_IDLE_RPM) / 500);
+    } else {
+        // Clutch engaged: RPM = speed * gear ratio, plus torque converter
+        // slip when accelerating (more slip in 1st/reverse)
+        rpm = state.speed * gear_ratios[state.gear] / 10;
+        if (!state.braking) {
+            rpm += (state.gear <= 1) ? state.load * 2 : state.load;
+        }
+        if (rpm < VEHICLE_IDLE_RPM) {
+            rpm = VEHICLE_IDLE_RPM;
+        }
+    }
+
+    if (rpm > max_rpm) {
+        rpm = max_rpm;
+    }
+    return (uint16_t)rpm;
+}
+
+const vehicle_state_t *vehicle_update(const vehicle_input_t *input)
+{
+    const engine_sound_config_t *cfg = engine_sound_get_config();
+    uint16_t max_rpm = (VEHICLE_IDLE_RPM * cfg->max_rpm_percentage) / 100;
+    int64_t now = esp_timer_get_time() / 1000;
+
+    state.tick++;
+    state.throttle = input->throttle;
+    state.velocity = input->velocity;
+    state.direction = input->direction;
+    state.braking = input->braking;
+
+    int16_t abs_speed = (input->velocity < 0) ? -input->velocity : input->velocity;
+    state.speed = abs_speed / 2;  // 0-1000 -> 0-500
+    state.motor_stopped = abs_speed < tuning_get_motor_cutoff();
+
+    // Reversing: moving backwards, or stopped and accelerating into reverse
+    // (not while braking to a stop from either direction)
+    bool throttle_neutral = (input->throttle > -50 && input->throttle < 50);
+    bool stopped = (abs_speed < 50);
+    state.reversing = (input->velocity < -50) ||
+                      (stopped && input->direction == -1 && !input->braking && input->throttle < -100);
+
+    // Engine demand (0-500); throttle contributes nothing while braking
+    state.engine_throttle = 0;
+    if (!input->braking && !throttle_neutral) {
+        state.engine_throttle = abs(input->throttle) / 2;
+    }
+
+    if (!input->engine_running) {
+        // Engine off or starting: gearbox waits in 1st at idle
+        state.gear = 1;
+        state.load = 0;
+        state.target_rpm = VEHICLE_IDLE_RPM;
+        state.rpm = VEHICLE_IDLE_RPM;
+        rpm_residue = 0;
+        last_upshift_time = 0;
+        last_downshift_time = 0;
+        rpm_settled_after_upshift = true;
+        return &state;
+    }
+
+    // Engine load: high throttle + low RPM (engine struggling to accelerate)
+    if (input->braking || throttle_neutral) {
+        state.load = 0;
+    } else {
+        uint16_t rpm_range = max_rpm - VEHICLE_IDLE_RPM;
+        int32_t demand_rpm = (state.engine_throttle * rpm_range) / 500;
+        int32_t load = demand_rpm - (state.rpm - VEHICLE_IDLE_RPM);
+        if (load < 0) load = 0;
+        if (load > 180) load = 180;
+        state.load = (int16_t)load;
+    }
+
+    select_gear(now, max_rpm);
+    state.target_rpm = calc_target_rpm(max_rpm);
+    update_rpm(max_rpm, cfg);
+
+    // Debug logging every 2 seconds
+    static int64_t last_debug_log = 0;
+    if (now - last_debug_log > 2000) {
+        last_debug_log = now;
+        ESP_LOGI(TAG, "GEAR: g=%d rpm=%d->%d load=%d spd=%d thr=%d brk=%d",
+                 state.gear, state.rpm, state.target_rpm, state.load, state.speed,
+                 state.engine_throttle, state.braking ? 1 : 0);
+    }
+
+    return &state;
+}
+
+const vehicle_state_t *vehicle_get_state(void)
+{
+    return &state;
+}
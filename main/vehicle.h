@@ -0,0 +1,64 @@
+/**
+ * @file vehicle.h
+ * @brief Vehicle dynamics state shared by ESC, steering, sound and telemetry
+ *
+ * The control task computes one vehicle_state_t per tick from the throttle
+ * and velocity: direction, braking, the 3-speed automatic gearbox, engine
+ * load and RPM. Every consumer reads that same state, so the sound only
+ * shifts gears the model shifted and the trace records what was driven.
+ */
+
+#ifndef VEHICLE_H
+#define VEHICLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Engine RPM scale (normalized, shared with engine_sound.c)
+#define VEHICLE_IDLE_RPM        100
+#define VEHICLE_MAX_RPM         500
+
+/**
+ * @brief Inputs for one tick
+ */
+typedef struct {
+    int16_t throttle;       // Driver throttle (-1000 to +1000)
+    int16_t velocity;       // Simulated velocity, or throttle outside realistic mode
+    bool braking;           // Throttle against the motion (realistic mode)
+    int8_t direction;       // Last driven direction: -1, 0, 1
+    bool engine_running;    // Gearbox holds 1st at idle while the engine is off
+} vehicle_input_t;
+
+/**
+ * @brief Vehicle state for one tick (read-only for consumers)
+ */
+typedef struct {
+    uint32_t tick;              // Updates since boot
+    int16_t throttle;           // Driver throttle (-1000 to +1000)
+    int16_t velocity;           // -1000 to +1000, negative = backwards
+    int16_t speed;              // |velocity| / 2 (0-500)
+    int8_t direction;           // Last driven direction: -1, 0, 1
+    bool braking;               // Throttle against the motion
+    bool motor_stopped;         // Below the ESC motor cutoff
+    bool reversing;             // Moving backwards, or pulling away backwards
+    int16_t engine_throttle;    // Engine demand 0-500 (0 while braking or in deadband)
+    uint8_t gear;               // 0 = reverse, 1-3 = forward
+    uint8_t shift_seq;          // Bumped on every shift between forward gears
+    int16_t load;               // 0-180: demand the engine hasn't caught up with
+    uint16_t target_rpm;        // RPM the drivetrain asks for
+    uint16_t rpm;               // Modelled engine RPM, follows target_rpm
+} vehicle_state_t;
+
+/**
+ * @brief Advance the model by one control tick (control task only)
+ * @param input Inputs for this tick
+ * @return State for this tick, unchanged until the next update
+ */
+const vehicle_state_t *vehicle_update(const vehicle_input_t *input);
+
+/**
+ * @brief Get the state of the last tick (control task only)
+ */
+const vehicle_state_t *vehicle_get_state(void);
+
+#endif // VEHICLE_H
@@ -0,0 +1,326 @@
+/**
+ * @file web_bundle.c
+ * @brief Memory-mapped web UI bundle implementation
+ *
+ * Served and updated from httpd handlers only, which all run on the httpd
+ * task, so the mapping never changes under a request being sent.
+ */
+
+#include "web_bundle.h"
+#include "perf.h"
+
+#include <string.h>
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "WEB_BUNDLE";
+
+#define WEB_BUNDLE_PARTITION_LABEL      "webui"
+#define WEB_BUNDLE_PARTITION_SUBTYPE    0x41
+#define WEB_BUNDLE_ERASE_ALIGN          4096
+
+static const esp_partition_t *part = NULL;
+static const uint8_t *bundle = NULL;            // Mapped partition, NULL if invalid
+static const web_bundle_entry_t *entries = NULL;
+static uint16_t entry_count = 0;
+static uint32_t total_size = 0;
+static esp_partition_mmap_handle_t bundle_handle;
+static bool mapped = false;
+static uint32_t mount_us = 0;                   // Last map + validate
+
+// Update in progress: the magic is written last, so an interrupted upload
+// never leaves a bundle that looks valid. Sectors are erased just ahead of
+// the data, so each flash stall is one sector long and the upload streams
+// from the first byte instead of waiting for the whole range to erase.
+static uint8_t held_magic[sizeof(uint32_t)];
+static size_t update_size = 0;
+static size_t update_written = 0;
+static size_t update_erased = 0;
+static int64_t update_start_us = 0;
+static int64_t update_erase_us = 0;
+static int64_t update_write_us = 0;
+static web_bundle_upload_stats_t last_upload;
+
+/**
+ * @brief Check that a directory entry lies inside the bundle
+ */
+static bool entry_valid(const web_bundle_entry_t *e, uint32_t size)
+{
+    if (memchr(e->path, '\0', sizeof(e->path)) == NULL || e->path[0] != '/') return false;
+    if (memchr(e->etag, '\0', sizeof(e->etag)) == NULL) return false;
+    if (e->encoding > WEB_BUNDLE_GZIP) return false;
+    if (e->offset > size || e->size > size - e->offset) return false;
+    return true;
+}
+
+/**
+ * @brief Validate a mapped bundle
+ * @param magic Magic to check instead of the stored one
+ * @return NULL if valid, otherwise why not
+ */
+static const char *bundle_check(const uint8_t *base, uint32_t magic)
+{
+    const web_bundle_header_t *hdr = (const web_bundle_header_t *)base;
+
+    if (magic != WEB_BUNDLE_MAGIC) {
+        return "no bundle flashed";
+    } else if (hdr->version != WEB_BUNDLE_VERSION) {
+        return "unsupported version";
+    } else if (hdr->total_size < sizeof(*hdr) || hdr->total_size > part->size) {
+        return "bad size";
+    } else if ((uint64_t)hdr->entry_count * sizeof(web_bundle_entry_t) > hdr->total_size - sizeof(*hdr)) {
+        return "directory out of range";
+    } else if (esp_rom_crc32_le(0, base + sizeof(*hdr), hdr->total_size - sizeof(*hdr)) != hdr->crc32) {
+        return "CRC mismatch";
+    }
+
+    const web_bundle_entry_t *dir = (const web_bundle_entry_t *)(base + sizeof(*hdr));
+    for (int i = 0; i < hdr->entry_count; i++) {
+        if (!entry_valid(&dir[i], hdr->total_size)) {
+            return "bad asset entry";
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Drop the mapping
+ */
+static void bundle_unmap(void)
+{
+    if (mapped) {
+        esp_partition_munmap(bundle_handle);
+        mapped = false;
+    }
+    bundle = NULL;
+    entries = NULL;
+    entry_count = 0;
+    total_size = 0;
+}
+
+/**
+ * @brief Map the partition and publish the bundle if it is valid
+ */
+static esp_err_t bundle_map(void)
+{
+    int64_t start = esp_timer_get_time();
+    const void *map;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA,
+                                       &map, &bundle_handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to map web UI: %s", esp_err_to_name(err));
+        return err;
+    }
+    mapped = true;
+
+    const uint8_t *base = map;
+    const web_bundle_header_t *hdr = map;
+    const char *reason = bundle_check(base, hdr->magic);
+    if (reason != NULL) {
+        ESP_LOGW(TAG, "Web UI not available (%s)", reason);
+        bundle_unmap();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    bundle = base;
+    entries = (const web_bundle_entry_t *)(base + sizeof(*hdr));
+    entry_count = hdr->entry_count;
+    total_size = hdr->total_size;
+    mount_us = (uint32_t)(esp_timer_get_time() - start);
+
+    ESP_LOGI(TAG, "Web UI mapped: %u assets, %lu bytes in %lu us", entry_count,
+             (unsigned long)total_size, (unsigned long)mount_us);
+    return ESP_OK;
+}
+
+esp_err_t web_bundle_init(void)
+{
+    if (bundle != NULL) {
+        return ESP_OK;
+    }
+
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, WEB_BUNDLE_PARTITION_SUBTYPE,
+                                    WEB_BUNDLE_PARTITION_LABEL);
+    if (part == NULL) {
+        ESP_LOGW(TAG, "No web UI partition");
+        return ESP_OK;
+    }
+
+    bundle_map();
+    return ESP_OK;
+}
+
+bool web_bundle_is_loaded(void)
+{
+    return bundle != NULL;
+}
+
+const web_bundle_entry_t *web_bundle_find(const char *path, size_t len)
+{
+    if (len >= WEB_BUNDLE_PATH_LEN) {
+        return NULL;
+    }
+    for (int i = 0; i < entry_count; i++) {
+        if (strncmp(entries[i].path, path, len) == 0 && entries[i].path[len] == '\0') {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+const void *web_bundle_data(const web_bundle_entry_t *entry)
+{
+    return bundle + entry->offset;
+}
+
+int web_bundle_count(void)
+{
+    return entry_count;
+}
+
+const web_bundle_entry_t *web_bundle_get(int index)
+{
+    if (index < 0 || index >= entry_count) {
+        return NULL;
+    }
+    return &entries[index];
+}
+
+void web_bundle_get_usage(size_t *used, size_t *total)
+{
+    *used = total_size;
+    *total = part ? part->size : 0;
+}
+
+uint32_t web_bundle_get_mount_us(void)
+{
+    return mount_us;
+}
+
+const web_bundle_upload_stats_t *web_bundle_get_upload_stats(void)
+{
+    return &last_upload;
+}
+
+/**
+ * @brief Erase whole sectors until [0, end) is writable
+ */
+static esp_err_t erase_ahead(size_t end)
+{
+    if (end <= update_erased) {
+        return ESP_OK;
+    }
+    size_t to = (end + WEB_BUNDLE_ERASE_ALIGN - 1) & ~(size_t)(WEB_BUNDLE_ERASE_ALIGN - 1);
+
+    int64_t start = esp_timer_get_time();
+    perf_flash_begin();
+    esp_err_t err = esp_partition_erase_range(part, update_erased, to - update_erased);
+    perf_flash_end();
+    update_erase_us += esp_timer_get_time() - start;
+    if (err == ESP_OK) {
+        update_erased = to;
+    }
+    return err;
+}
+
+esp_err_t web_bundle_update_begin(size_t size)
+{
+    if (part == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (size < sizeof(web_bundle_header_t) || size > part->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    bundle_unmap();
+    update_size = size;
+    update_written = 0;
+    update_erased = 0;
+    update_start_us = esp_timer_get_time();
+    update_erase_us = 0;
+    update_write_us = 0;
+    memset(held_magic, 0xFF, sizeof(held_magic));
+
+    // The first sector holds the magic: from here on the partition reads as empty
+    ESP_LOGI(TAG, "Updating web UI (%u bytes)", (unsigned)size);
+    return erase_ahead(1);
+}
+
+esp_err_t web_bundle_update_write(const void *data, size_t len)
+{
+    const uint8_t *src = data;
+
+    if (len > update_size - update_written) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Hold back the magic; erased flash reads as an empty partition until then
+    while (len > 0 && update_written < sizeof(held_magic)) {
+        held_magic[update_written++] = *src++;
+        len--;
+    }
+    if (len == 0) {
+        return ESP_OK;
+    }
+
+    esp_err_t err = erase_ahead(update_written + len);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    int64_t start = esp_timer_get_time();
+    perf_flash_begin();
+    err = esp_partition_write(part, update_written, src, len);
+    perf_flash_end();
+    update_write_us += esp_timer_get_time() - start;
+    if (err == ESP_OK) {
+        update_written += len;
+    }
+    return err;
+}
+
+esp_err_t web_bundle_update_end(void)
+{
+    if (part == NULL || update_written != update_size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    const void *map;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA,
+                                       &map, &bundle_handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    uint32_t magic;
+    memcpy(&magic, held_magic, sizeof(magic));
+    const char *reason = bundle_check(map, magic);
+    esp_partition_munmap(bundle_handle);
+    if (reason != NULL) {
+        ESP_LOGE(TAG, "Uploaded web UI rejected (%s)", reason);
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    perf_flash_begin();
+    err = esp_partition_write(part, 0, held_magic, sizeof(held_magic));
+    perf_flash_end();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    uint32_t total_us = (uint32_t)(esp_timer_get_time() - update_start_us);
+    last_upload = (web_bundle_upload_stats_t){
+        .bytes = (uint32_t)update_size,
+        .total_ms = total_us / 1000,
+        .erase_ms = (uint32_t)(update_erase_us / 1000),
+        .write_ms = (uint32_t)(update_write_us / 1000),
+        .flash_kbps = (update_erase_us + update_write_us) > 0
+            ? (uint32_t)((uint64_t)update_size * 1000000 / 1024 / (update_erase_us + update_write_us)) : 0,
+    };
+    ESP_LOGI(TAG, "Web UI written: %lu bytes in %lu ms (erase %lu ms, write %lu ms, %lu KB/s flash)",
+             (unsigned long)last_upload.bytes, (unsigned long)last_upload.total_ms,
+             (unsigned long)last_upload.erase_ms, (unsigned long)last_upload.write_ms,
+             (unsigned long)last_upload.flash_kbps);
+    return bundle_map();
+}
@@ -0,0 +1,150 @@
+/**
+ * @file web_bundle.h
+ * @brief Memory-mapped web UI bundle in the "webui" flash partition
+ *
+ * The bundle is built from web/ by tools/webbundle.py and flashed with the
+ * app (idf.py flash) or uploaded from the Settings page. Every asset is
+ * stored gzipped with a strong ETag, and is sent straight from the
+ * mapping in one httpd_resp_send() - no filesystem, no copy.
+ *
+ * Layout (little endian, all offsets from the partition start):
+ *   web_bundle_header_t
+ *   web_bundle_entry_t [entry_count]       asset directory
+ *   asset data
+ */
+
+#ifndef WEB_BUNDLE_H
+#define WEB_BUNDLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#define WEB_BUNDLE_MAGIC        0x42424557  // "WEBB"
+#define WEB_BUNDLE_VERSION      1
+#define WEB_BUNDLE_PATH_LEN     24
+#define WEB_BUNDLE_ETAG_LEN     20
+
+/**
+ * @brief Asset encodings (Content-Encoding)
+ */
+typedef enum {
+    WEB_BUNDLE_IDENTITY = 0,
+    WEB_BUNDLE_GZIP = 1,
+} web_bundle_encoding_t;
+
+/**
+ * @brief Bundle header
+ */
+typedef struct {
+    uint32_t magic;             // WEB_BUNDLE_MAGIC
+    uint16_t version;           // WEB_BUNDLE_VERSION
+    uint16_t entry_count;
+    uint32_t total_size;        // Bytes including this header
+    uint32_t crc32;             // CRC-32 of bytes [sizeof(header), total_size)
+    uint32_t reserved[2];
+} web_bundle_header_t;
+
+/**
+ * @brief Asset directory entry
+ */
+typedef struct {
+    char path[WEB_BUNDLE_PATH_LEN];     // NUL-terminated request path, e.g. "/app.js"
+    char etag[WEB_BUNDLE_ETAG_LEN];     // NUL-terminated, quoted as sent
+    uint32_t offset;                    // Asset data offset
+    uint32_t size;                      // Stored (encoded) bytes
+    uint8_t encoding;                   // web_bundle_encoding_t
+    uint8_t reserved[3];
+} web_bundle_entry_t;
+
+/**
+ * @brief Timing of the last completed upload
+ */
+typedef struct {
+    uint32_t bytes;
+    uint32_t total_ms;          // update_begin to update_end, including the network
+    uint32_t erase_ms;          // Flash erase time
+    uint32_t write_ms;          // Flash write time
+    uint32_t flash_kbps;        // bytes / (erase + write), KiB per second
+} web_bundle_upload_stats_t;
+
+/**
+ * @brief Map and validate the web UI partition
+ *
+ * A missing, blank or invalid bundle is not an error: requests get 404
+ * until a bundle is uploaded.
+ * @return ESP_OK
+ */
+esp_err_t web_bundle_init(void);
+
+/**
+ * @brief Check whether a valid bundle is mapped
+ */
+bool web_bundle_is_loaded(void);
+
+/**
+ * @brief Find an asset by request path
+ * @param path Path (need not be NUL-terminated)
+ * @param len Length of path
+ * @return Entry, or NULL if not in the bundle
+ */
+const web_bundle_entry_t *web_bundle_find(const char *path, size_t len);
+
+/**
+ * @brief Mapped contents of an asset (entry->size bytes)
+ */
+const void *web_bundle_data(const web_bundle_entry_t *entry);
+
+/**
+ * @brief Number of assets in the mapped bundle
+ */
+int web_bundle_count(void);
+
+/**
+ * @brief Get an asset directory entry
+ * @param index 0 .. web_bundle_count() - 1
+ * @return Entry, or NULL if out of range
+ */
+const web_bundle_entry_t *web_bundle_get(int index);
+
+/**
+ * @brief Bundle bytes in use and partition size
+ */
+void web_bundle_get_usage(size_t *used, size_t *total);
+
+/**
+ * @brief Time the last map and CRC check of the bundle took
+ * @return Microseconds (0 if nothing valid was mapped yet)
+ */
+uint32_t web_bundle_get_mount_us(void);
+
+/**
+ * @brief Timing of the last completed upload (zeroed if none)
+ */
+const web_bundle_upload_stats_t *web_bundle_get_upload_stats(void);
+
+/**
+ * @brief Unmap the bundle and start replacing it
+ *
+ * Only the first sector is erased here; the rest is erased just ahead of
+ * the data by web_bundle_update_write(). Entries and data pointers are
+ * invalid until web_bundle_update_end().
+ * @param size Size of the new bundle
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE if it would not fit
+ */
+esp_err_t web_bundle_update_begin(size_t size);
+
+/**
+ * @brief Write the next part of the new bundle (erasing the sectors it reaches)
+ * @return ESP_OK, or the flash erase/write error
+ */
+esp_err_t web_bundle_update_write(const void *data, size_t len);
+
+/**
+ * @brief Finish an update: commit the magic once the rest checks out, remap
+ * @return ESP_OK if the new bundle is valid and mapped
+ */
+esp_err_t web_bundle_update_end(void);
+
+#endif // WEB_BUNDLE_H
@@ -8,28 +8,50 @@
 #include "version.h"
 #include "nvs_storage.h"
 #include "tuning.h"
+#include "preset.h"
 #include "calibration.h"
 #include "pwm_output.h"
 #include "engine_sound.h"
+#include "perf.h"
+#include "power.h"
+#include "battery.h"
+#include "task_stats.h"
+#include "health.h"
+#include "timeline.h"
+#include "capture.h"
+#include "trace.h"
+#include "blackbox.h"
+#include "bench.h"
+#include "stress.h"
+#include "web_bundle.h"
+#include "audio_mixer.h"
+#include "json_config.h"
+#include "rc_espnow.h"
+#include "udp_log.h"
 #include "esp_wifi.h"
+#include "esp_mac.h"
 #include "esp_event.h"
 #include "esp_log.h"
 #include "esp_http_server.h"
 #include "esp_netif.h"
-#include "esp_spiffs.h"
 #include "mdns.h"
 #include "lwip/ip4_addr.h"
 #include "esp_system.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "lwip/sockets.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/stat.h>
 
 static const char *TAG = "WEB_SERVER";
 
 static httpd_handle_t server = NULL;
-static int ws_fd = -1;
+static volatile bool ws_info_pending = false;   // Static info frame must be (re)sent
+static volatile bool ws_stress = false;         // Stress test: keyframes + capture to all clients
 static web_status_t current_status = {0};
 static char ap_ip_addr_str[16] = "192.168.4.1";
 static char sta_ip_addr_str[16] = "";
@@ -48,6 +70,16 @@ static esp_timer_handle_t sta_connect_timer = NULL;
 #define STA_MAX_RETRY 5
 #define STA_RETRY_DELAY_MS 5000
 #define STA_INITIAL_DELAY_MS 2000
+#define STA_FAST_DELAY_MS 50        // First attempt with a cached AP (no scan to wait for)
+
+// Fast reconnect: the AP from the last good connection is tried first by
+// BSSID and channel, falling back to a normal scan if that attempt fails
+static crawler_wifi_cache_t sta_cache = {0};
+static bool sta_cache_loaded = false;
+static bool sta_fast_attempt = false;   // Current attempt targets the cached AP
+static bool sta_fast_used = false;      // Last connection came from the cache
+static int64_t sta_start_us = 0;        // Start of the current connect sequence
+static uint32_t sta_connect_ms = 0;     // Start to IP for the last connection
 
 // Timer callback for delayed WiFi connect (avoids blocking event loop)
 static void sta_connect_timer_cb(void *arg) {
@@ -64,9 +96,228 @@ static bool servo_test_active = false;
 static uint32_t servo_test_timeout = 0;  // Auto-disable after timeout
 #define SERVO_TEST_TIMEOUT_MS 30000  // 30 seconds
 
-// WiFi power state
+// Servo test positions, written by the httpd task and picked up by the
+// control task on its next tick. jog_gen is odd while jog_pulses is written.
+static uint32_t jog_gen = 0;
+static uint16_t jog_pulses[SERVO_COUNT];
+static int16_t jog_values[SERVO_COUNT];     // Last stick positions (-1000..1000)
+static int jog_fd = -1;                     // Socket of the jog stream, -1 = none yet
+static uint16_t jog_seq = 0;                // Last accepted sequence number
+static uint32_t jog_stale = 0;              // Frames dropped as out of order
+
+// WiFi power state. Turning WiFi off tears the driver, netifs, mDNS and
+// httpd down; only the TCP/IP stack and the default event loop stay.
 static bool wifi_enabled = false;
 static bool wifi_initialized = false;
+static bool netif_stack_ready = false;
+static esp_event_handler_instance_t wifi_event_instance = NULL;
+static esp_event_handler_instance_t ip_event_instance = NULL;
+static bool udp_log_resume = false;         // UDP logging was on when WiFi went off
+static uint32_t wifi_freed_bytes = 0;       // Heap returned by the last teardown
+static uint32_t wifi_start_ms = 0;          // Time the last enable took
+
+// Binary status frame, little-endian and packed; decoded by decodeStatus()
+// in web/app.js, which must be updated (and the version bumped) with it.
+// A frame is a ws_frame_header_t followed by the groups flagged in its
+// mask, in group order. Keyframes carry every group; other frames only the
+// groups that are due at their rate and changed since they were last sent.
+#define WS_STATUS_FRAME_VERSION 5
+
+#define WS_FRAME_KEYFRAME       (1 << 0)
+
+#define WS_FLAG_UI_OVERRIDE     (1 << 0)
+#define WS_FLAG_SIGNAL_LOST     (1 << 1)
+#define WS_FLAG_CALIBRATED      (1 << 2)
+#define WS_FLAG_CALIBRATING     (1 << 3)
+
+typedef struct __attribute__((packed)) {
+    uint8_t version;            // WS_STATUS_FRAME_VERSION
+    uint8_t groups;             // Bit per ws_group_t present
+    uint8_t flags;              // WS_FRAME_*
+    uint8_t stage_count;        // Rows in ws_group_perf_t.prof
+    uint8_t axle_count;         // Entries in ws_group_output_t.servo and capture_sample_t.servo_pulse
+} ws_frame_header_t;
+
+typedef struct __attribute__((packed)) {
+    int16_t rc[6];              // Throttle, steering, aux1-4 (-1000 to +1000)
+    uint16_t rc_raw[6];         // Raw pulse widths
+} ws_group_input_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t esc_pulse;
+    uint16_t servo[SERVO_COUNT];  // Axle pulse widths, front to rear
+} ws_group_output_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t flags;             // WS_FLAG_*
+    uint8_t steering_mode;
+    uint8_t cal_progress;
+} ws_group_state_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t uptime_ms;
+    uint32_t heap_free;
+    uint32_t heap_min;
+    int8_t rssi;
+} ws_group_system_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t lat[3];            // Edge-to-output latency avg / p99 / max (us)
+    uint32_t overruns[2];       // Control, housekeeping loop overruns
+    uint32_t shed_events;
+    uint32_t deadline_misses;
+    uint32_t underruns;         // Audio mixer
+    uint8_t shed_level;         // Degraded-mode scheduler level
+    uint8_t dma_fill;
+    uint8_t dma_fill_min;
+    uint8_t load_pct;
+    uint8_t load_max_pct;
+    uint32_t prof[PERF_STAGE_COUNT][3];  // min / avg / max per perf_stage_t (us)
+} ws_group_perf_t;
+
+#define WS_BATTERY_PRESENT      (1 << 0)
+#define WS_BATTERY_CURRENT      (1 << 1)
+
+typedef struct __attribute__((packed)) {
+    uint16_t pack_mv;
+    uint16_t cell_mv;
+    int32_t current_ma;
+    uint16_t used_mah;
+    uint8_t level;              // battery_level_t
+    uint8_t cells;
+    uint8_t sag_gain_pct;       // ESC sag gain (100 = none)
+    uint8_t flags;              // WS_BATTERY_*
+} ws_group_battery_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t rpm;               // Modelled engine RPM
+    int16_t velocity;           // -1000 to +1000
+    uint8_t gear;               // 0 = reverse, 1-3 = forward
+} ws_group_vehicle_t;
+
+typedef enum {
+    WS_GROUP_INPUT = 0,
+    WS_GROUP_OUTPUT,
+    WS_GROUP_STATE,
+    WS_GROUP_SYSTEM,
+    WS_GROUP_PERF,
+    WS_GROUP_BATTERY,
+    WS_GROUP_VEHICLE,
+    WS_GROUP_COUNT
+} ws_group_t;
+
+typedef struct {
+    ws_group_input_t input;
+    ws_group_output_t output;
+    ws_group_state_t state;
+    ws_group_system_t system;
+    ws_group_perf_t perf;
+    ws_group_battery_t battery;
+    ws_group_vehicle_t vehicle;
+} ws_status_groups_t;
+
+// Group layout and send rate
+static const struct {
+    uint16_t offset;            // In ws_status_groups_t
+    uint16_t size;
+    uint16_t period_ms;
+} ws_groups[WS_GROUP_COUNT] = {
+    [WS_GROUP_INPUT]  = { offsetof(ws_status_groups_t, input),  sizeof(ws_group_input_t),  WEB_STATUS_PERIOD_MS },
+    [WS_GROUP_OUTPUT] = { offsetof(ws_status_groups_t, output), sizeof(ws_group_output_t), WEB_STATUS_PERIOD_MS },
+    [WS_GROUP_STATE]  = { offsetof(ws_status_groups_t, state),  sizeof(ws_group_state_t),  WEB_STATUS_PERIOD_MS },
+    [WS_GROUP_SYSTEM] = { offsetof(ws_status_groups_t, system), sizeof(ws_group_system_t), WEB_STATUS_SLOW_PERIOD_MS },
+    [WS_GROUP_PERF]   = { offsetof(ws_status_groups_t, perf),   sizeof(ws_group_perf_t),   WEB_STATUS_SLOW_PERIOD_MS },
+    [WS_GROUP_BATTERY] = { offsetof(ws_status_groups_t, battery), sizeof(ws_group_battery_t), WEB_STATUS_SLOW_PERIOD_MS },
+    [WS_GROUP_VEHICLE] = { offsetof(ws_status_groups_t, vehicle), sizeof(ws_group_vehicle_t), WEB_STATUS_PERIOD_MS },
+};
+
+// Delta encoder state (housekeeping task only)
+static ws_status_groups_t ws_groups_sent;       // Contents last sent per group
+static uint32_t ws_group_checked_ms[WS_GROUP_COUNT];
+static uint32_t ws_keyframe_ms = 0;
+
+_Static_assert(sizeof(ws_group_input_t) == 24 && sizeof(ws_group_output_t) == 10 &&
+               sizeof(ws_group_state_t) == 4 && sizeof(ws_group_system_t) == 13 &&
+               offsetof(ws_group_perf_t, prof) == 37 && sizeof(ws_group_battery_t) == 14 &&
+               sizeof(ws_group_vehicle_t) == 5,
+               "decodeStatus() in web/app.js hardcodes these sizes");
+
+// WebSocket clients: each gets a bounded queue drained by the httpd task.
+// A full queue drops its oldest frame, so a slow client only loses its own
+// telemetry; a client whose socket stays blocked is closed.
+#define WS_MAX_CLIENTS          4
+#define WS_CLIENT_QUEUE_LEN     4
+#define WS_MSG_MAX_LEN          448
+#define WS_RX_MAX_LEN           255     // Largest frame accepted from a client
+#define WS_SEND_TIMEOUT_MS      250     // Per-socket send timeout (the server's is 2 minutes for OTA)
+
+_Static_assert(sizeof(ws_frame_header_t) + sizeof(ws_status_groups_t) <= WS_MSG_MAX_LEN,
+               "a keyframe must fit a queue slot");
+
+// Capture frames carry WEB_CAPTURE_BATCH control ticks for the live graph.
+// The type byte has the high bit set so it can't be taken for a status version.
+#define WS_CAPTURE_FRAME_TYPE   0x81
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;               // WS_CAPTURE_FRAME_TYPE
+    uint8_t count;              // capture_sample_t records that follow
+    uint16_t rate_hz;           // Nominal control loop rate
+    uint32_t dropped;           // Samples lost to a full ring since boot
+} ws_capture_header_t;
+
+_Static_assert(sizeof(ws_capture_header_t) + WEB_CAPTURE_BATCH * sizeof(capture_sample_t) <= WS_MSG_MAX_LEN,
+               "a capture batch must fit a queue slot");
+
+// Live edit frames (client to server): a type byte, then ws_live_param_t
+// records. Ids index tuning_json_fields / sound_json_fields, so the web UI's
+// key lists must follow the table order. Edits are not saved until the
+// client sends {"cmd":"commit"} (tuning) or POSTs /api/sound.
+#define WS_LIVE_FRAME_TYPE      0x01
+#define WS_LIVE_TABLE_TUNING    0
+#define WS_LIVE_TABLE_SOUND     1
+
+typedef struct __attribute__((packed)) {
+    uint8_t table;              // WS_LIVE_TABLE_*
+    uint8_t id;                 // Index into the table
+    int32_t value;
+} ws_live_param_t;
+
+_Static_assert(sizeof(ws_live_param_t) == 6, "sendLive() in web/app.js hardcodes this size");
+
+// Servo jog frames (client to server): all test-mode positions, resent at
+// least every WEB_JOG_HEARTBEAT_MS. seq increases by one per frame; older
+// frames from the same socket are dropped.
+#define WS_JOG_FRAME_TYPE       0x02
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;               // WS_JOG_FRAME_TYPE
+    uint8_t reserved;
+    uint16_t seq;
+    int16_t values[SERVO_COUNT];    // Stick positions, -1000..1000
+} ws_jog_frame_t;
+
+_Static_assert(sizeof(ws_jog_frame_t) == 4 + 2 * SERVO_COUNT, "sendJog() in web/app.js sends one value per axle");
+
+typedef struct {
+    httpd_ws_type_t type;
+    uint16_t len;
+    uint8_t data[WS_MSG_MAX_LEN];
+} ws_msg_t;
+
+typedef struct {
+    int fd;                     // Socket, -1 = free slot
+    bool info_pending;          // Needs the static info frame before its next status
+    bool capture;               // Asked for per-tick capture frames
+    uint8_t head;
+    uint8_t count;
+    uint32_t dropped;           // Frames dropped because the queue was full
+    ws_msg_t queue[WS_CLIENT_QUEUE_LEN];
+} ws_client_t;
+
+static ws_client_t ws_clients[WS_MAX_CLIENTS];     // Valid once ws_mutex exists
+static SemaphoreHandle_t ws_mutex = NULL;
+static volatile bool ws_drain_queued = false;
+static volatile uint8_t ws_client_count = 0;
 
 // MIME types for common files
 static const struct {
@@ -83,6 +334,10 @@ static const struct {
     { ".svg",  "image/svg+xml" },
 };
 
+// Web UI assets come from the mapped bundle (web_bundle.h). Browsers
+// revalidate every load and get a 304 while the ETag matches.
+#define WEB_CACHE_CONTROL       "no-cache"
+
 /**
  * @brief Get MIME type for file extension
  */
@@ -99,41 +354,6 @@ static const char* get_mime_type(const char *path)
     return "text/plain";
 }
 
-/**
- * @brief Initialize SPIFFS filesystem
- */
-static esp_err_t init_spiffs(void)
-{
-    ESP_LOGI(TAG, "Initializing SPIFFS...");
-    
-    esp_vfs_spiffs_conf_t conf = {
-        .base_path = "/web",
-        .partition_label = "storage",
-        .max_files = 5,
-        .format_if_mount_failed = false
-    };
-    
-    esp_err_t ret = esp_vfs_spiffs_register(&conf);
-    if (ret != ESP_OK) {
-        if (ret == ESP_FAIL) {
-            ESP_LOGE(TAG, "Failed to mount SPIFFS");
-        } else if (ret == ESP_ERR_NOT_FOUND) {
-            ESP_LOGE(TAG, "SPIFFS partition not found");
-        } else {
-            ESP_LOGE(TAG, "SPIFFS init failed: %s", esp_err_to_name(ret));
-        }
-        return ret;
-    }
-    
-    size_t total = 0, used = 0;
-    ret = esp_spiffs_info("storage", &total, &used);
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "SPIFFS: %d KB total, %d KB used", total / 1024, used / 1024);
-    }
-    
-    return ESP_OK;
-}
-
 /**
  * @brief Get human-readable WiFi disconnect reason
  * Reason codes from ESP-IDF esp_wifi_types.h (wifi_err_reason_t)
@@ -182,6 +402,9 @@ static const char* wifi_disconnect_reason_str(uint8_t reason)
     }
 }
 
+static void sta_apply_config(bool fast);
+static void sta_remember_ap(void);
+
 /**
  * @brief WiFi event handler
  */
@@ -195,10 +418,10 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base,
                 break;
             case WIFI_EVENT_AP_STADISCONNECTED:
                 ESP_LOGI(TAG, "WiFi AP: client disconnected");
-                ws_fd = -1;
                 break;
-            case WIFI_EVENT_STA_START:
-                ESP_LOGI(TAG, "WiFi STA: started, connecting in %dms...", STA_INITIAL_DELAY_MS);
+            case WIFI_EVENT_STA_START: {
+                int delay_ms = sta_fast_attempt ? STA_FAST_DELAY_MS : STA_INITIAL_DELAY_MS;
+                ESP_LOGI(TAG, "WiFi STA: started, connecting in %dms...", delay_ms);
                 sta_retry_count = 0;
                 sta_give_up = false;
                 // Use timer to delay first connection (don't block event loop!)
@@ -209,8 +432,9 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base,
                     };
                     esp_timer_create(&timer_args, &sta_connect_timer);
                 }
-                esp_timer_start_once(sta_connect_timer, STA_INITIAL_DELAY_MS * 1000);
+                esp_timer_start_once(sta_connect_timer, delay_ms * 1000);
                 break;
+            }
             case WIFI_EVENT_STA_DISCONNECTED: {
                 wifi_event_sta_disconnected_t *event = (wifi_event_sta_disconnected_t *)event_data;
                 sta_disconnect_reason = event->reason;
@@ -218,8 +442,16 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base,
                          wifi_disconnect_reason_str(event->reason), event->reason);
                 sta_connected = false;
                 sta_ip_addr_str[0] = '\0';
-
-                if (sta_config.enabled && !sta_give_up) {
+                ws_info_pending = true;
+
+                if (sta_config.enabled && !sta_give_up && sta_fast_attempt) {
+                    // Cached AP gone or moved: scan straight away, not a retry
+                    ESP_LOGI(TAG, "WiFi STA: cached AP failed, scanning");
+                    sta_apply_config(false);
+                    if (sta_connect_timer != NULL) {
+                        esp_timer_start_once(sta_connect_timer, STA_FAST_DELAY_MS * 1000);
+                    }
+                } else if (sta_config.enabled && !sta_give_up) {
                     sta_retry_count++;
                     if (sta_retry_count <= STA_MAX_RETRY) {
                         ESP_LOGI(TAG, "WiFi STA: retry %d/%d in %dms...",
@@ -247,11 +479,60 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base,
             sta_retry_count = 0;
             sta_give_up = false;
             sta_disconnect_reason = 0;  // Clear disconnect reason on success
-            ESP_LOGI(TAG, "WiFi STA: connected, IP: %s", sta_ip_addr_str);
+            sta_connect_ms = (uint32_t)((esp_timer_get_time() - sta_start_us) / 1000);
+            sta_fast_used = sta_fast_attempt;
+            ws_info_pending = true;
+            ESP_LOGI(TAG, "WiFi STA: connected, IP: %s (%lu ms%s)", sta_ip_addr_str,
+                     (unsigned long)sta_connect_ms, sta_fast_used ? ", cached AP" : "");
+            sta_remember_ap();
         }
     }
 }
 
+/**
+ * @brief Set the STA config, targeting the cached AP when fast is true
+ *
+ * With a BSSID and channel the driver probes that one channel instead of
+ * scanning them all.
+ */
+static void sta_apply_config(bool fast)
+{
+    wifi_config_t sta_wifi_config = {0};
+    strncpy((char *)sta_wifi_config.sta.ssid, sta_config.ssid, sizeof(sta_wifi_config.sta.ssid) - 1);
+    strncpy((char *)sta_wifi_config.sta.password, sta_config.password, sizeof(sta_wifi_config.sta.password) - 1);
+    if (fast) {
+        sta_wifi_config.sta.channel = sta_cache.channel;
+        sta_wifi_config.sta.bssid_set = true;
+        memcpy(sta_wifi_config.sta.bssid, sta_cache.bssid, sizeof(sta_cache.bssid));
+    }
+    sta_fast_attempt = fast;
+
+    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &sta_wifi_config));
+}
+
+/**
+ * @brief Cache the AP just connected to, if it changed (deferred NVS write)
+ */
+static void sta_remember_ap(void)
+{
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+        return;
+    }
+    if (sta_cache.channel == ap.primary && memcmp(sta_cache.bssid, ap.bssid, sizeof(ap.bssid)) == 0 &&
+        strcmp(sta_cache.ssid, sta_config.ssid) == 0) {
+        return;
+    }
+
+    sta_cache.magic = CRAWLER_WIFI_CACHE_MAGIC;
+    strncpy(sta_cache.ssid, sta_config.ssid, WIFI_STA_SSID_MAX_LEN);
+    sta_cache.ssid[WIFI_STA_SSID_MAX_LEN] = '\0';
+    memcpy(sta_cache.bssid, ap.bssid, sizeof(ap.bssid));
+    sta_cache.channel = ap.primary;
+    nvs_save_wifi_cache(&sta_cache);
+    ESP_LOGI(TAG, "WiFi STA: cached AP " MACSTR " on channel %d", MAC2STR(ap.bssid), ap.primary);
+}
+
 /**
  * @brief Start WiFi STA mode (connect to external network)
  */
@@ -261,13 +542,15 @@ static esp_err_t wifi_start_sta(void)
         return ESP_OK;
     }
 
-    ESP_LOGI(TAG, "WiFi STA: connecting to '%s'", sta_config.ssid);
-
-    wifi_config_t sta_wifi_config = {0};
-    strncpy((char *)sta_wifi_config.sta.ssid, sta_config.ssid, sizeof(sta_wifi_config.sta.ssid) - 1);
-    strncpy((char *)sta_wifi_config.sta.password, sta_config.password, sizeof(sta_wifi_config.sta.password) - 1);
+    if (!sta_cache_loaded) {
+        nvs_load_wifi_cache(&sta_cache);
+        sta_cache_loaded = true;
+    }
+    bool fast = sta_cache.channel != 0 && strcmp(sta_cache.ssid, sta_config.ssid) == 0;
 
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &sta_wifi_config));
+    ESP_LOGI(TAG, "WiFi STA: connecting to '%s'%s", sta_config.ssid, fast ? " (cached AP)" : "");
+    sta_start_us = esp_timer_get_time();
+    sta_apply_config(fast);
 
     return ESP_OK;
 }
@@ -277,8 +560,13 @@ static esp_err_t wifi_start_sta(void)
  */
 static esp_err_t wifi_init_dual(void)
 {
-    ESP_ERROR_CHECK(esp_netif_init());
-    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    // lwIP and the default event loop can't be shut down, so they are set
+    // up once and reused when WiFi comes back
+    if (!netif_stack_ready) {
+        ESP_ERROR_CHECK(esp_netif_init());
+        ESP_ERROR_CHECK(esp_event_loop_create_default());
+        netif_stack_ready = true;
+    }
 
     // Create network interfaces
     ap_netif = esp_netif_create_default_wifi_ap();
@@ -289,9 +577,9 @@ static esp_err_t wifi_init_dual(void)
 
     // Register event handlers
     ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
-                                                        &wifi_event_handler, NULL, NULL));
+                                                        &wifi_event_handler, NULL, &wifi_event_instance));
     ESP_ERROR_CHECK(esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
-                                                        &wifi_event_handler, NULL, NULL));
+                                                        &wifi_event_handler, NULL, &ip_event_instance));
 
     // Configure AP
     wifi_config_t ap_config = {
@@ -350,66 +638,277 @@ static esp_err_t wifi_init_dual(void)
  */
 static esp_err_t file_handler(httpd_req_t *req)
 {
-    char filepath[64];
-    char uri_copy[48];
     const char *uri = req->uri;
     
     // Default to index.html
-    if (strcmp(uri, "/") == 0) {
+    if (strcmp(uri, "/") == 0 || strncmp(uri, "/?", 2) == 0) {
         uri = "/index.html";
     }
-    
-    // Copy URI with length limit
-    strncpy(uri_copy, uri, sizeof(uri_copy) - 1);
-    uri_copy[sizeof(uri_copy) - 1] = '\0';
-    
-    // Build filepath: /web + uri (max 4 + 47 = 51 chars, fits in 64)
-    snprintf(filepath, sizeof(filepath), "/web%.47s", uri_copy);
-    
-    // Check if file exists
-    struct stat st;
-    if (stat(filepath, &st) != 0) {
-        ESP_LOGW(TAG, "File not found: %s", filepath);
+    size_t uri_len = strcspn(uri, "?");     // Ignore cache-busting queries
+
+    const web_bundle_entry_t *asset = web_bundle_find(uri, uri_len);
+    if (asset == NULL) {
+        ESP_LOGW(TAG, "File not found: %.*s", (int)uri_len, uri);
         httpd_resp_send_404(req);
         return ESP_FAIL;
     }
-    
-    // Open file in binary mode
-    FILE *f = fopen(filepath, "rb");
-    if (!f) {
-        ESP_LOGE(TAG, "Failed to open: %s", filepath);
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
+
+    httpd_resp_set_hdr(req, "ETag", asset->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", WEB_CACHE_CONTROL);
+
+    // Unchanged since the browser cached it: headers only
+    char inm[64];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        strstr(inm, asset->etag) != NULL) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
     }
 
-    // Set content type
-    httpd_resp_set_type(req, get_mime_type(filepath));
+    // Assets are stored gzipped; every browser accepts gzip
+    httpd_resp_set_type(req, get_mime_type(asset->path));
+    if (asset->encoding == WEB_BUNDLE_GZIP) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
 
-    // Send file in chunks
-    char buf[1024];
-    size_t read_bytes;
-    esp_err_t ret = ESP_OK;
-    while ((read_bytes = fread(buf, 1, sizeof(buf), f)) > 0) {
-        if (httpd_resp_send_chunk(req, buf, read_bytes) != ESP_OK) {
-            ESP_LOGE(TAG, "Failed sending %s", filepath);
-            ret = ESP_FAIL;
+    // Straight from the flash mapping, one send
+    return httpd_resp_send(req, web_bundle_data(asset), asset->size);
+}
+
+// ============================================================================
+// WebSocket Clients
+// ============================================================================
+
+/**
+ * @brief Record while any client wants capture frames (caller holds ws_mutex)
+ */
+static void ws_capture_update_locked(void)
+{
+    bool wanted = ws_stress;
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        wanted |= ws_clients[i].fd >= 0 && ws_clients[i].capture;
+    }
+    capture_set_enabled(wanted);
+}
+
+void web_server_set_ws_stress(bool on)
+{
+    ws_stress = on;
+    if (ws_mutex) {
+        xSemaphoreTake(ws_mutex, portMAX_DELAY);
+        ws_capture_update_locked();
+        xSemaphoreGive(ws_mutex);
+    }
+}
+
+/**
+ * @brief Free a client slot (caller holds ws_mutex)
+ */
+static void ws_client_remove_locked(ws_client_t *c)
+{
+    ESP_LOGI(TAG, "WebSocket client %d removed (%lu frames dropped)", c->fd, (unsigned long)c->dropped);
+    c->fd = -1;
+    c->count = 0;
+    c->capture = false;
+    ws_client_count--;
+    ws_capture_update_locked();
+}
+
+/**
+ * @brief Register a newly connected WebSocket client
+ * @return false if the client table is full
+ */
+static bool ws_client_add(int fd)
+{
+    ws_client_t *slot = NULL;
+
+    xSemaphoreTake(ws_mutex, portMAX_DELAY);
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (ws_clients[i].fd == fd) {
+            slot = &ws_clients[i];      // Socket reused: start over
             break;
         }
+        if (!slot && ws_clients[i].fd < 0) {
+            slot = &ws_clients[i];
+        }
     }
-    fclose(f);
+    if (slot) {
+        if (slot->fd < 0) {
+            ws_client_count++;
+        }
+        slot->fd = fd;
+        slot->info_pending = true;
+        slot->capture = false;
+        slot->head = 0;
+        slot->count = 0;
+        slot->dropped = 0;
+        ws_capture_update_locked();
+    }
+    xSemaphoreGive(ws_mutex);
+
+    if (slot) {
+        // Don't let a stalled client block the httpd task for the OTA timeout
+        struct timeval tv = {
+            .tv_sec = WS_SEND_TIMEOUT_MS / 1000,
+            .tv_usec = (WS_SEND_TIMEOUT_MS % 1000) * 1000
+        };
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    }
+    return slot != NULL;
+}
 
-    // End chunked response (only if we haven't failed)
-    if (ret == ESP_OK) {
-        httpd_resp_send_chunk(req, NULL, 0);
+/**
+ * @brief Drop every client (WiFi turned off)
+ */
+static void ws_clients_clear(void)
+{
+    if (!ws_mutex) return;
+
+    xSemaphoreTake(ws_mutex, portMAX_DELAY);
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (ws_clients[i].fd >= 0) {
+            ws_client_remove_locked(&ws_clients[i]);
+        }
     }
-    return ret;
+    xSemaphoreGive(ws_mutex);
+}
+
+/**
+ * @brief Append a message to a client's queue (caller holds ws_mutex)
+ *
+ * A full queue drops its oldest message: the newest telemetry matters most.
+ */
+static void ws_enqueue_locked(ws_client_t *c, httpd_ws_type_t type, const void *data, size_t len)
+{
+    if (c->count == WS_CLIENT_QUEUE_LEN) {
+        c->head = (c->head + 1) % WS_CLIENT_QUEUE_LEN;
+        c->count--;
+        c->dropped++;
+    }
+    ws_msg_t *m = &c->queue[(c->head + c->count) % WS_CLIENT_QUEUE_LEN];
+    m->type = type;
+    m->len = (uint16_t)len;
+    memcpy(m->data, data, len);
+    c->count++;
+}
+
+/**
+ * @brief Send queued messages to every client (httpd task)
+ */
+static void ws_drain_work(void *arg)
+{
+    ws_msg_t msg;
+
+    ws_drain_queued = false;    // Messages queued from here on schedule another pass
+    TIMELINE_MARK_BEGIN(TIMELINE_MARK_WS_SEND);
+
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        ws_client_t *c = &ws_clients[i];
+        for (;;) {
+            xSemaphoreTake(ws_mutex, portMAX_DELAY);
+            int fd = c->fd;
+            if (fd < 0 || c->count == 0) {
+                xSemaphoreGive(ws_mutex);
+                break;
+            }
+            memcpy(&msg, &c->queue[c->head], offsetof(ws_msg_t, data) + c->queue[c->head].len);
+            c->head = (c->head + 1) % WS_CLIENT_QUEUE_LEN;
+            c->count--;
+            xSemaphoreGive(ws_mutex);
+
+            bool alive = httpd_ws_get_fd_info(server, fd) == HTTPD_WS_CLIENT_WEBSOCKET;
+            if (alive) {
+                httpd_ws_frame_t ws_pkt = {
+                    .final = true,
+                    .fragmented = false,
+                    .type = msg.type,
+                    .payload = msg.data,
+                    .len = msg.len
+                };
+                if (httpd_ws_send_frame_async(server, fd, &ws_pkt) != ESP_OK) {
+                    // Timed out or reset: the frame stream is broken either way
+                    httpd_sess_trigger_close(server, fd);
+                    alive = false;
+                }
+            }
+            if (!alive) {
+                xSemaphoreTake(ws_mutex, portMAX_DELAY);
+                if (c->fd == fd) {
+                    ws_client_remove_locked(c);
+                }
+                xSemaphoreGive(ws_mutex);
+                break;
+            }
+        }
+    }
+    TIMELINE_MARK_END(TIMELINE_MARK_WS_SEND);
 }
 
+/**
+ * @brief Hand queued messages to the httpd task unless a pass is pending
+ */
+static void ws_schedule_drain(void)
+{
+    if (ws_drain_queued) return;
+
+    ws_drain_queued = true;
+    if (httpd_queue_work(server, ws_drain_work, NULL) != ESP_OK) {
+        ws_drain_queued = false;
+    }
+}
+
+static volatile bool health_probe_queued = false;
+
+/**
+ * @brief Health probe job: runs on the httpd task between requests
+ */
+static void health_probe_work(void *arg)
+{
+    health_probe_queued = false;
+    health_beat(HEALTH_TASK_WEB, HEALTH_WEB_PROBE_MS * 1000);
+}
+
+void web_server_health_probe(void)
+{
+    if (ws_mutex == NULL || health_probe_queued) return;
+
+    // WiFi teardown stops the server under ws_mutex; a busy mutex just
+    // skips this probe rather than hold up the monitor
+    if (xSemaphoreTake(ws_mutex, 0) != pdTRUE) return;
+    if (server != NULL && wifi_enabled) {
+        health_probe_queued = true;
+        if (httpd_queue_work(server, health_probe_work, NULL) != ESP_OK) {
+            health_probe_queued = false;
+        }
+    }
+    xSemaphoreGive(ws_mutex);
+}
+
+/**
+ * @brief Turn capture frames on or off for one client
+ */
+static void ws_client_set_capture(int fd, bool on)
+{
+    xSemaphoreTake(ws_mutex, portMAX_DELAY);
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (ws_clients[i].fd == fd) {
+            ws_clients[i].capture = on;
+        }
+    }
+    ws_capture_update_locked();
+    xSemaphoreGive(ws_mutex);
+    ESP_LOGI(TAG, "WebSocket client %d capture %s", fd, on ? "on" : "off");
+}
+
+static void ws_apply_live(const uint8_t *data, size_t len);
+static void ws_apply_jog(int fd, const uint8_t *data, size_t len);
+
 /**
  * @brief Parse incoming WebSocket command
- * Format: {"cmd":"mode","v":0} or {"cmd":"aux"} to revert to AUX control
+ * Format: {"cmd":"mode","v":0}, {"cmd":"aux"} to revert to AUX control,
+ * {"cmd":"capture","on":1} to start/stop per-tick capture frames, or
+ * {"cmd":"commit"} to save tuning changed by live edits
  */
-static void parse_ws_command(const char *data, size_t len)
+static void parse_ws_command(int fd, const char *data, size_t len)
 {
     // Simple parsing - look for "cmd":"mode" and "v":N
     if (strstr(data, "\"cmd\":\"mode\"") != NULL) {
@@ -425,6 +924,11 @@ static void parse_ws_command(const char *data, size_t len)
     } else if (strstr(data, "\"cmd\":\"aux\"") != NULL) {
         ui_mode_override = false;
         ESP_LOGI(TAG, "Mode control: AUX switches");
+    } else if (strstr(data, "\"cmd\":\"capture\"") != NULL) {
+        const char *on_pos = strstr(data, "\"on\":");
+        ws_client_set_capture(fd, on_pos && atoi(on_pos + 5) != 0);
+    } else if (strstr(data, "\"cmd\":\"commit\"") != NULL) {
+        tuning_save();
     }
 }
 
@@ -434,8 +938,13 @@ static void parse_ws_command(const char *data, size_t len)
 static esp_err_t ws_handler(httpd_req_t *req)
 {
     if (req->method == HTTP_GET) {
-        ESP_LOGI(TAG, "WebSocket connected");
-        ws_fd = httpd_req_to_sockfd(req);
+        int fd = httpd_req_to_sockfd(req);
+        if (!ws_client_add(fd)) {
+            ESP_LOGW(TAG, "WebSocket client table full, closing %d", fd);
+            httpd_sess_trigger_close(req->handle, fd);
+            return ESP_OK;
+        }
+        ESP_LOGI(TAG, "WebSocket connected (%d)", fd);
         return ESP_OK;
     }
     
@@ -450,17 +959,20 @@ static esp_err_t ws_handler(httpd_req_t *req)
         return ret;
     }
     
-    // Allocate buffer and receive payload
-    if (ws_pkt.len > 0 && ws_pkt.len < 256) {
-        uint8_t *buf = malloc(ws_pkt.len + 1);
-        if (buf) {
-            ws_pkt.payload = buf;
-            ret = httpd_ws_recv_frame(req, &ws_pkt, ws_pkt.len);
-            if (ret == ESP_OK) {
-                buf[ws_pkt.len] = '\0';
-                parse_ws_command((const char *)buf, ws_pkt.len);
+    // Receive payload (httpd runs one handler at a time, so one buffer serves every client)
+    static uint8_t buf[WS_RX_MAX_LEN + 1];
+    if (ws_pkt.len > 0 && ws_pkt.len <= WS_RX_MAX_LEN) {
+        ws_pkt.payload = buf;
+        ret = httpd_ws_recv_frame(req, &ws_pkt, ws_pkt.len);
+        if (ret == ESP_OK && ws_pkt.type == HTTPD_WS_TYPE_BINARY) {
+            if (buf[0] == WS_JOG_FRAME_TYPE) {
+                ws_apply_jog(httpd_req_to_sockfd(req), buf, ws_pkt.len);
+            } else {
+                ws_apply_live(buf, ws_pkt.len);
             }
-            free(buf);
+        } else if (ret == ESP_OK) {
+            buf[ws_pkt.len] = '\0';
+            parse_ws_command(httpd_req_to_sockfd(req), (const char *)buf, ws_pkt.len);
         }
     }
     
@@ -519,11 +1031,14 @@ static esp_err_t wifi_get_handler(httpd_req_t *req)
 {
     char response[256];
     snprintf(response, sizeof(response),
-        "{\"enabled\":%s,\"connected\":%s,\"ssid\":\"%s\",\"ip\":\"%s\"}",
+        "{\"enabled\":%s,\"connected\":%s,\"ssid\":\"%s\",\"ip\":\"%s\","
+        "\"startMs\":%lu,\"freedBytes\":%lu}",
         sta_config.enabled ? "true" : "false",
         sta_connected ? "true" : "false",
         sta_config.ssid,
-        sta_ip_addr_str);
+        sta_ip_addr_str,
+        (unsigned long)wifi_start_ms,
+        (unsigned long)wifi_freed_bytes);
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_sendstr(req, response);
@@ -608,183 +1123,125 @@ static esp_err_t wifi_post_handler(httpd_req_t *req)
 }
 
 /**
- * @brief Tuning GET handler - returns current tuning config as JSON
+ * @brief Receive a whole request body
+ * @return Body length, or -1 (an error response has been sent)
  */
-static esp_err_t tuning_get_handler(httpd_req_t *req)
+static int recv_json_body(httpd_req_t *req, char *buf, size_t size)
 {
-    const tuning_config_t *cfg = tuning_get_config();
-
-    // Build JSON response - servo settings
-    char response[1024];
-    int len = snprintf(response, sizeof(response),
-        "{"
-        "\"servos\":["
-        "{\"min\":%d,\"max\":%d,\"subtrim\":%d,\"trim\":%d,\"rev\":%s},"
-        "{\"min\":%d,\"max\":%d,\"subtrim\":%d,\"trim\":%d,\"rev\":%s},"
-        "{\"min\":%d,\"max\":%d,\"subtrim\":%d,\"trim\":%d,\"rev\":%s},"
-        "{\"min\":%d,\"max\":%d,\"subtrim\":%d,\"trim\":%d,\"rev\":%s}"
-        "],"
-        "\"steering\":{"
-        "\"ratio\":[%d,%d,%d,%d],"
-        "\"allAxleRear\":%d,"
-        "\"expo\":%d,"
-        "\"speedSteering\":%d,"
-        "\"realisticEnabled\":%s,"
-        "\"responsiveness\":%d,"
-        "\"returnRate\":%d"
-        "},"
-        "\"esc\":{"
-        "\"fwdLimit\":%d,"
-        "\"revLimit\":%d,"
-        "\"subtrim\":%d,"
-        "\"deadzone\":%d,"
-        "\"rev\":%s,"
-        "\"realistic\":%s,"
-        "\"coastRate\":%d,"
-        "\"brakeForce\":%d,"
-        "\"motorCutoff\":%d"
-        "}"
-        "}",
-        cfg->servos[0].min_us, cfg->servos[0].max_us, cfg->servos[0].subtrim, cfg->servos[0].trim, cfg->servos[0].reversed ? "true" : "false",
-        cfg->servos[1].min_us, cfg->servos[1].max_us, cfg->servos[1].subtrim, cfg->servos[1].trim, cfg->servos[1].reversed ? "true" : "false",
-        cfg->servos[2].min_us, cfg->servos[2].max_us, cfg->servos[2].subtrim, cfg->servos[2].trim, cfg->servos[2].reversed ? "true" : "false",
-        cfg->servos[3].min_us, cfg->servos[3].max_us, cfg->servos[3].subtrim, cfg->servos[3].trim, cfg->servos[3].reversed ? "true" : "false",
-        cfg->steering.axle_ratio[0], cfg->steering.axle_ratio[1], cfg->steering.axle_ratio[2], cfg->steering.axle_ratio[3],
-        cfg->steering.all_axle_rear_ratio,
-        cfg->steering.expo,
-        cfg->steering.speed_steering,
-        cfg->steering.realistic_enabled ? "true" : "false",
-        cfg->steering.responsiveness,
-        cfg->steering.return_rate,
-        cfg->esc.fwd_limit,
-        cfg->esc.rev_limit,
-        cfg->esc.subtrim,
-        cfg->esc.deadzone,
-        cfg->esc.reversed ? "true" : "false",
-        cfg->esc.realistic_throttle ? "true" : "false",
-        cfg->esc.coast_rate,
-        cfg->esc.brake_force,
-        cfg->esc.motor_cutoff
-    );
+    if (req->content_len == 0 || req->content_len >= size) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, req->content_len ? "Body too large" : "No data");
+        return -1;
+    }
 
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, response, len);
-    return ESP_OK;
+    int received = 0;
+    while (received < (int)req->content_len) {
+        int ret = httpd_req_recv(req, buf + received, req->content_len - received);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Incomplete body");
+            return -1;
+        }
+        received += ret;
+    }
+    buf[received] = '\0';
+    return received;
 }
 
 /**
- * @brief Helper to parse integer from JSON
+ * @brief Object walk target for the config update handlers
  */
-static bool parse_json_int(const char *json, const char *key, int *value)
+typedef struct {
+    const json_field_t *fields;
+    size_t field_count;
+    void *config;
+    // Keys outside the table; returns false if the key is unknown
+    bool (*extra)(const char *key, size_t key_len, const json_value_t *value, void *config);
+} json_update_t;
+
+static bool json_update_member(const char *key, size_t key_len, const json_value_t *value, void *ctx)
 {
-    char search[32];
-    snprintf(search, sizeof(search), "\"%s\":", key);
-    const char *pos = strstr(json, search);
-    if (pos) {
-        pos += strlen(search);
-        while (*pos == ' ') pos++;
-        *value = atoi(pos);
-        return true;
+    json_update_t *u = (json_update_t *)ctx;
+    const json_field_t *field = json_find_field(u->fields, u->field_count, key, key_len);
+
+    if (field) {
+        if (!json_field_store(field, u->config, value)) {
+            ESP_LOGW(TAG, "Bad value for \"%.*s\"", (int)key_len, key);
+        }
+    } else if (!u->extra || !u->extra(key, key_len, value, u->config)) {
+        ESP_LOGW(TAG, "Unknown key \"%.*s\"", (int)key_len, key);
     }
-    return false;
+    return true;
 }
 
 /**
- * @brief Helper to parse boolean from JSON
+ * @brief Tuning GET handler - returns current tuning config as JSON
  */
-static bool parse_json_bool(const char *json, const char *key, bool *value)
+static esp_err_t tuning_get_handler(httpd_req_t *req)
 {
-    char search[32];
-    snprintf(search, sizeof(search), "\"%s\":", key);
-    const char *pos = strstr(json, search);
-    if (pos) {
-        pos += strlen(search);
-        while (*pos == ' ') pos++;
-        *value = (strncmp(pos, "true", 4) == 0);
-        return true;
+    tuning_config_t snapshot;
+    const tuning_config_t *cfg = &snapshot;
+    char response[1280];            // Room for AXLE_COUNT_MAX axles
+
+    tuning_copy_config(&snapshot);
+    response[0] = '{';
+    size_t len = json_write_fields(response, sizeof(response), 1,
+                                   tuning_json_fields, tuning_json_field_count, cfg);
+    if (len < sizeof(response)) {
+        int n = snprintf(response + len, sizeof(response) - len,
+                         ",\"axles\":%d,\"escRateMax\":%d,\"servoRateMax\":%d}",
+                         SERVO_COUNT,
+                         tuning_max_output_rate_hz(cfg, false),
+                         tuning_max_output_rate_hz(cfg, true));
+        len = (n < 0 || (size_t)n >= sizeof(response) - len) ? sizeof(response) : len + n;
     }
-    return false;
+    if (len >= sizeof(response)) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Response too large");
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len);
+    return ESP_OK;
 }
 
 /**
- * @brief Tuning POST handler - updates tuning config
+ * @brief Tuning POST/PATCH handler - updates only the keys present in the body
  */
 static esp_err_t tuning_post_handler(httpd_req_t *req)
 {
-    char buf[1024];
-    int received = httpd_req_recv(req, buf, sizeof(buf) - 1);
-    if (received <= 0) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No data");
+    char buf[1280];
+    int received = recv_json_body(req, buf, sizeof(buf));
+    if (received < 0) {
         return ESP_FAIL;
     }
-    buf[received] = '\0';
 
     ESP_LOGI(TAG, "Tuning update: %s", buf);
 
     // Get current config and update it
     tuning_config_t cfg;
-    memcpy(&cfg, tuning_get_config(), sizeof(tuning_config_t));
-
-    // Parse servo settings (simplified - expects flat structure)
-    int val;
-    bool bval;
-
-    // Servo 0
-    if (parse_json_int(buf, "s0_min", &val)) cfg.servos[0].min_us = val;
-    if (parse_json_int(buf, "s0_max", &val)) cfg.servos[0].max_us = val;
-    if (parse_json_int(buf, "s0_subtrim", &val)) cfg.servos[0].subtrim = val;
-    if (parse_json_int(buf, "s0_trim", &val)) cfg.servos[0].trim = val;
-    if (parse_json_bool(buf, "s0_rev", &bval)) cfg.servos[0].reversed = bval;
-
-    // Servo 1
-    if (parse_json_int(buf, "s1_min", &val)) cfg.servos[1].min_us = val;
-    if (parse_json_int(buf, "s1_max", &val)) cfg.servos[1].max_us = val;
-    if (parse_json_int(buf, "s1_subtrim", &val)) cfg.servos[1].subtrim = val;
-    if (parse_json_int(buf, "s1_trim", &val)) cfg.servos[1].trim = val;
-    if (parse_json_bool(buf, "s1_rev", &bval)) cfg.servos[1].reversed = bval;
-
-    // Servo 2
-    if (parse_json_int(buf, "s2_min", &val)) cfg.servos[2].min_us = val;
-    if (parse_json_int(buf, "s2_max", &val)) cfg.servos[2].max_us = val;
-    if (parse_json_int(buf, "s2_subtrim", &val)) cfg.servos[2].subtrim = val;
-    if (parse_json_int(buf, "s2_trim", &val)) cfg.servos[2].trim = val;
-    if (parse_json_bool(buf, "s2_rev", &bval)) cfg.servos[2].reversed = bval;
-
-    // Servo 3
-    if (parse_json_int(buf, "s3_min", &val)) cfg.servos[3].min_us = val;
-    if (parse_json_int(buf, "s3_max", &val)) cfg.servos[3].max_us = val;
-    if (parse_json_int(buf, "s3_subtrim", &val)) cfg.servos[3].subtrim = val;
-    if (parse_json_int(buf, "s3_trim", &val)) cfg.servos[3].trim = val;
-    if (parse_json_bool(buf, "s3_rev", &bval)) cfg.servos[3].reversed = bval;
-
-    // Steering geometry
-    if (parse_json_int(buf, "ratio0", &val)) cfg.steering.axle_ratio[0] = val;
-    if (parse_json_int(buf, "ratio1", &val)) cfg.steering.axle_ratio[1] = val;
-    if (parse_json_int(buf, "ratio2", &val)) cfg.steering.axle_ratio[2] = val;
-    if (parse_json_int(buf, "ratio3", &val)) cfg.steering.axle_ratio[3] = val;
-    if (parse_json_int(buf, "allAxleRear", &val)) cfg.steering.all_axle_rear_ratio = val;
-    if (parse_json_int(buf, "expo", &val)) cfg.steering.expo = val;
-    if (parse_json_int(buf, "speedSteering", &val)) cfg.steering.speed_steering = val;
-
-    // Realistic steering
-    if (parse_json_bool(buf, "realisticEnabled", &bval)) cfg.steering.realistic_enabled = bval;
-    if (parse_json_int(buf, "responsiveness", &val)) cfg.steering.responsiveness = val;
-    if (parse_json_int(buf, "returnRate", &val)) cfg.steering.return_rate = val;
-
-    // ESC settings
-    if (parse_json_int(buf, "fwdLimit", &val)) cfg.esc.fwd_limit = val;
-    if (parse_json_int(buf, "revLimit", &val)) cfg.esc.rev_limit = val;
-    if (parse_json_int(buf, "escSubtrim", &val)) cfg.esc.subtrim = val;
-    if (parse_json_int(buf, "deadzone", &val)) cfg.esc.deadzone = val;
-    if (parse_json_bool(buf, "escRev", &bval)) cfg.esc.reversed = bval;
-    if (parse_json_bool(buf, "realistic", &bval)) cfg.esc.realistic_throttle = bval;
-    if (parse_json_int(buf, "coastRate", &val)) cfg.esc.coast_rate = val;
-    if (parse_json_int(buf, "brakeForce", &val)) cfg.esc.brake_force = val;
-    if (parse_json_int(buf, "motorCutoff", &val)) cfg.esc.motor_cutoff = val;
-
-    // Apply and save
-    tuning_set_config(&cfg);
-    esp_err_t ret = tuning_save();
+    tuning_copy_config(&cfg);
+
+    json_update_t update = {
+        .fields = tuning_json_fields,
+        .field_count = tuning_json_field_count,
+        .config = &cfg,
+    };
+    if (json_walk_object(buf, received, json_update_member, &update) < 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed JSON");
+        return ESP_FAIL;
+    }
+
+    // Staged for the control task, which swaps it in and reapplies the
+    // output rates at its next tick; saved once it has been taken. A config
+    // not taken in time is withdrawn, so an error means nothing changed
+    esp_err_t ret = tuning_set_config(&cfg);
+    if (ret != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to apply tuning");
+        return ESP_FAIL;
+    }
+    ret = tuning_save();
 
     if (ret != ESP_OK) {
         httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to save tuning");
@@ -803,6 +1260,7 @@ static esp_err_t tuning_reset_handler(httpd_req_t *req)
 {
     ESP_LOGI(TAG, "Resetting tuning to defaults");
 
+    // Applied by the control task like a POST, then saved
     esp_err_t ret = tuning_reset_defaults(true);
 
     if (ret != ESP_OK) {
@@ -815,10 +1273,147 @@ static esp_err_t tuning_reset_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+// ============================================================================
+// Preset Handlers
+// ============================================================================
+
+/**
+ * @brief Presets GET handler - slot names and the active slot
+ */
+static esp_err_t presets_get_handler(httpd_req_t *req)
+{
+    char response[96 + PRESET_COUNT * (PRESET_NAME_LEN + 24)];
+    int len = snprintf(response, sizeof(response), "{\"active\":%d,\"switching\":%s,\"presets\":[",
+                       preset_get_active(), preset_is_switching() ? "true" : "false");
+
+    for (int i = 0; i < PRESET_COUNT; i++) {
+        char name[PRESET_NAME_LEN];
+        preset_get_name(i, name);
+        len += snprintf(response + len, sizeof(response) - len, "%s{\"id\":%d,\"name\":\"%s\"}",
+                        i > 0 ? "," : "", i, name);
+    }
+    len += snprintf(response + len, sizeof(response) - len, "]}");
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len);
+    return ESP_OK;
+}
+
+typedef struct {
+    int select;                 // Slot to switch to, -1 = none
+    int store;                  // Slot to overwrite with the live config, -1 = none
+    int rename;                 // Slot to rename, -1 = none
+    char name[PRESET_NAME_LEN];
+    bool has_name;
+} preset_request_t;
+
+static bool preset_request_member(const char *key, size_t key_len, const json_value_t *value, void *ctx)
+{
+    preset_request_t *r = (preset_request_t *)ctx;
+
+    if (value->type == JSON_VALUE_NUMBER) {
+        if (key_len == 6 && memcmp(key, "select", 6) == 0) r->select = value->number;
+        else if (key_len == 5 && memcmp(key, "store", 5) == 0) r->store = value->number;
+        else if (key_len == 6 && memcmp(key, "rename", 6) == 0) r->rename = value->number;
+    } else if (value->type == JSON_VALUE_STRING && key_len == 4 && memcmp(key, "name", 4) == 0) {
+        // Printable ASCII without quotes or escapes, so names go back out verbatim
+        size_t n = 0;
+        for (size_t i = 0; i < value->str_len && n < PRESET_NAME_LEN - 1; i++) {
+            char c = value->str[i];
+            if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\') {
+                r->name[n++] = c;
+            }
+        }
+        r->name[n] = '\0';
+        r->has_name = n > 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Presets POST handler - {"select":n}, {"store":n[,"name":s]} or {"rename":n,"name":s}
+ *
+ * Selecting returns at once; the switch lands a few milliseconds later
+ * (GET reports "switching" until then).
+ */
+static esp_err_t presets_post_handler(httpd_req_t *req)
+{
+    char buf[128];
+    int received = recv_json_body(req, buf, sizeof(buf));
+    if (received < 0) {
+        return ESP_FAIL;
+    }
+
+    preset_request_t r = { .select = -1, .store = -1, .rename = -1 };
+    if (json_walk_object(buf, received, preset_request_member, &r) < 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed JSON");
+        return ESP_FAIL;
+    }
+
+    esp_err_t ret = ESP_ERR_INVALID_ARG;
+    if (r.store >= 0 && r.store < PRESET_COUNT) {
+        ret = preset_store((uint8_t)r.store, r.has_name ? r.name : NULL);
+    } else if (r.rename >= 0 && r.rename < PRESET_COUNT && r.has_name) {
+        ret = preset_rename((uint8_t)r.rename, r.name);
+    } else if (r.select >= 0 && r.select < PRESET_COUNT) {
+        ret = preset_select((uint8_t)r.select);
+    }
+    if (ret != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad preset request");
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, "{\"status\":\"ok\"}");
+    return ESP_OK;
+}
+
 // ============================================================================
 // Sound Settings Handlers
 // ============================================================================
 
+// Sound API keys; "profile" and "enabled" are handled by sound_json_extra()
+static const json_field_t sound_json_fields[] = {
+    JSON_UINT(engine_sound_config_t, master_volume_level1, "masterVolumeLevel1"),
+    JSON_UINT(engine_sound_config_t, master_volume_level2, "masterVolumeLevel2"),
+    JSON_UINT(engine_sound_config_t, active_volume_level, "activeVolumeLevel"),
+    JSON_UINT(engine_sound_config_t, volume_preset_low, "volumePresetLow"),
+    JSON_UINT(engine_sound_config_t, volume_preset_medium, "volumePresetMedium"),
+    JSON_UINT(engine_sound_config_t, volume_preset_high, "volumePresetHigh"),
+    JSON_UINT(engine_sound_config_t, idle_volume, "idleVolume"),
+    JSON_UINT(engine_sound_config_t, rev_volume, "revVolume"),
+    JSON_UINT(engine_sound_config_t, knock_volume, "knockVolume"),
+    JSON_UINT(engine_sound_config_t, start_volume, "startVolume"),
+    JSON_UINT(engine_sound_config_t, max_rpm_percentage, "maxRpmPercent"),
+    JSON_UINT(engine_sound_config_t, acceleration, "acceleration"),
+    JSON_UINT(engine_sound_config_t, deceleration, "deceleration"),
+    JSON_UINT(engine_sound_config_t, rev_switch_point, "revSwitchPoint"),
+    JSON_UINT(engine_sound_config_t, idle_end_point, "idleEndPoint"),
+    JSON_UINT(engine_sound_config_t, knock_start_point, "knockStartPoint"),
+    JSON_UINT(engine_sound_config_t, knock_interval, "knockInterval"),
+    JSON_BOOL(engine_sound_config_t, jake_brake_enabled, "jakeBrakeEnabled"),
+    JSON_BOOL(engine_sound_config_t, v8_mode, "v8Mode"),
+
+    // Sound effects
+    JSON_BOOL(engine_sound_config_t, air_brake_enabled, "airBrakeEnabled"),
+    JSON_UINT(engine_sound_config_t, air_brake_volume, "airBrakeVolume"),
+    JSON_BOOL(engine_sound_config_t, reverse_beep_enabled, "reverseBeepEnabled"),
+    JSON_UINT(engine_sound_config_t, reverse_beep_volume, "reverseBeepVolume"),
+    JSON_BOOL(engine_sound_config_t, gear_shift_enabled, "gearShiftEnabled"),
+    JSON_UINT(engine_sound_config_t, gear_shift_volume, "gearShiftVolume"),
+    JSON_BOOL(engine_sound_config_t, wastegate_enabled, "wastegateEnabled"),
+    JSON_UINT(engine_sound_config_t, wastegate_volume, "wastegateVolume"),
+
+    // Horn and mode switch
+    JSON_BOOL(engine_sound_config_t, horn_enabled, "hornEnabled"),
+    JSON_UINT(engine_sound_config_t, horn_volume, "hornVolume"),
+    JSON_UINT(engine_sound_config_t, horn_type, "hornType"),
+    JSON_BOOL(engine_sound_config_t, mode_switch_sound_enabled, "modeSwitchEnabled"),
+    JSON_UINT(engine_sound_config_t, mode_switch_volume, "modeSwitchVolume"),
+};
+
+#define SOUND_JSON_FIELD_COUNT (sizeof(sound_json_fields) / sizeof(sound_json_fields[0]))
+
 /**
  * @brief Sound GET handler - returns current sound config as JSON
  */
@@ -826,106 +1421,105 @@ static esp_err_t sound_get_handler(httpd_req_t *req)
 {
     const engine_sound_config_t *cfg = engine_sound_get_config();
     sound_profile_t profile = engine_sound_get_profile();
-    const char *profile_name = sound_profiles_get_name(profile);
+    char response[1280];
 
-    // Build JSON response (increased buffer for effect settings)
-    char response[1024];
-    snprintf(response, sizeof(response),
-        "{"
-        "\"profile\":%d,"
-        "\"profileName\":\"%s\","
-        "\"masterVolumeLevel1\":%d,"
-        "\"masterVolumeLevel2\":%d,"
-        "\"activeVolumeLevel\":%d,"
-        "\"volumePresetLow\":%d,"
-        "\"volumePresetMedium\":%d,"
-        "\"volumePresetHigh\":%d,"
-        "\"currentVolumePreset\":%d,"
-        "\"idleVolume\":%d,"
-        "\"revVolume\":%d,"
-        "\"knockVolume\":%d,"
-        "\"startVolume\":%d,"
-        "\"maxRpmPercent\":%d,"
-        "\"acceleration\":%d,"
-        "\"deceleration\":%d,"
-        "\"revSwitchPoint\":%d,"
-        "\"idleEndPoint\":%d,"
-        "\"knockStartPoint\":%d,"
-        "\"knockInterval\":%d,"
-        "\"jakeBrakeEnabled\":%s,"
-        "\"v8Mode\":%s,"
-        "\"enabled\":%s,"
-        "\"rpm\":%d,"
-        "\"airBrakeEnabled\":%s,"
-        "\"airBrakeVolume\":%d,"
-        "\"reverseBeepEnabled\":%s,"
-        "\"reverseBeepVolume\":%d,"
-        "\"gearShiftEnabled\":%s,"
-        "\"gearShiftVolume\":%d,"
-        "\"wastegateEnabled\":%s,"
-        "\"wastegateVolume\":%d,"
-        "\"hornEnabled\":%s,"
-        "\"hornVolume\":%d,"
-        "\"hornType\":%d,"
-        "\"modeSwitchEnabled\":%s,"
-        "\"modeSwitchVolume\":%d"
-        "}",
-        profile,
-        profile_name,
-        cfg->master_volume_level1,
-        cfg->master_volume_level2,
-        cfg->active_volume_level,
-        cfg->volume_preset_low,
-        cfg->volume_preset_medium,
-        cfg->volume_preset_high,
+    // Live state first, then the table fields
+    int n = snprintf(response, sizeof(response),
+        "{\"profile\":%d,\"profileName\":\"%s\",\"currentVolumePreset\":%d,"
+        "\"enabled\":%s,\"rpm\":%d",
+        profile, sound_profiles_get_name(profile),
         engine_sound_get_current_volume_preset_index(),
-        cfg->idle_volume,
-        cfg->rev_volume,
-        cfg->knock_volume,
-        cfg->start_volume,
-        cfg->max_rpm_percentage,
-        cfg->acceleration,
-        cfg->deceleration,
-        cfg->rev_switch_point,
-        cfg->idle_end_point,
-        cfg->knock_start_point,
-        cfg->knock_interval,
-        cfg->jake_brake_enabled ? "true" : "false",
-        cfg->v8_mode ? "true" : "false",
         engine_sound_is_enabled() ? "true" : "false",
-        engine_sound_get_rpm(),
-        cfg->air_brake_enabled ? "true" : "false",
-        cfg->air_brake_volume,
-        cfg->reverse_beep_enabled ? "true" : "false",
-        cfg->reverse_beep_volume,
-        cfg->gear_shift_enabled ? "true" : "false",
-        cfg->gear_shift_volume,
-        cfg->wastegate_enabled ? "true" : "false",
-        cfg->wastegate_volume,
-        cfg->horn_enabled ? "true" : "false",
-        cfg->horn_volume,
-        cfg->horn_type,
-        cfg->mode_switch_sound_enabled ? "true" : "false",
-        cfg->mode_switch_volume
-    );
+        engine_sound_get_rpm());
+    size_t len = (n < 0 || (size_t)n >= sizeof(response)) ? sizeof(response) : (size_t)n;
+    len = json_write_fields(response, sizeof(response), len,
+                            sound_json_fields, SOUND_JSON_FIELD_COUNT, cfg);
+    if (len + 1 >= sizeof(response)) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Response too large");
+        return ESP_FAIL;
+    }
+    response[len++] = '}';
 
     httpd_resp_set_type(req, "application/json");
-    httpd_resp_sendstr(req, response);
+    httpd_resp_send(req, response, len);
     return ESP_OK;
 }
 
 /**
- * @brief Sound POST handler - updates sound config
+ * @brief Sound keys that act on the engine rather than a config member
+ */
+static bool sound_json_extra(const char *key, size_t key_len, const json_value_t *value, void *config)
+{
+    engine_sound_config_t *cfg = (engine_sound_config_t *)config;
+
+    if (key_len == 7 && memcmp(key, "profile", 7) == 0) {
+        // Profile change - apply it
+        if (value->type == JSON_VALUE_NUMBER && value->number >= 0 && value->number < sound_profiles_count() &&
+            sound_profiles_is_available((sound_profile_t)value->number)) {
+            engine_sound_set_profile((sound_profile_t)value->number);
+            cfg->profile = (sound_profile_t)value->number;
+        }
+        return true;
+    }
+    if (key_len == 7 && memcmp(key, "enabled", 7) == 0) {
+        if (value->type == JSON_VALUE_BOOL || value->type == JSON_VALUE_NUMBER) {
+            engine_sound_enable(value->number != 0);
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Apply a live edit frame (httpd task)
+ *
+ * Tuning edits are queued for the control task; sound edits go straight to
+ * the engine config under its mutex, as the POST handler does. Nothing is saved.
+ */
+static void ws_apply_live(const uint8_t *data, size_t len)
+{
+    engine_sound_config_t sound;
+    bool sound_changed = false;
+
+    if (len < 1 || data[0] != WS_LIVE_FRAME_TYPE) {
+        return;
+    }
+
+    for (size_t pos = 1; pos + sizeof(ws_live_param_t) <= len; pos += sizeof(ws_live_param_t)) {
+        ws_live_param_t p;
+        memcpy(&p, data + pos, sizeof(p));
+
+        if (p.table == WS_LIVE_TABLE_TUNING && p.id < tuning_json_field_count) {
+            tuning_live_push(&tuning_json_fields[p.id], p.value);
+        } else if (p.table == WS_LIVE_TABLE_SOUND && p.id < SOUND_JSON_FIELD_COUNT) {
+            const json_field_t *field = &sound_json_fields[p.id];
+            json_value_t value = {
+                .type = field->kind == JSON_FIELD_BOOL ? JSON_VALUE_BOOL : JSON_VALUE_NUMBER,
+                .number = p.value,
+            };
+            if (!sound_changed) {
+                memcpy(&sound, engine_sound_get_config(), sizeof(sound));
+                sound_changed = true;
+            }
+            json_field_store(field, &sound, &value);
+        }
+    }
+
+    if (sound_changed) {
+        engine_sound_set_config(&sound);
+    }
+}
+
+/**
+ * @brief Sound POST/PATCH handler - updates only the keys present in the body
  */
 static esp_err_t sound_post_handler(httpd_req_t *req)
 {
-    char buf[1024];  // Increased for effect settings
-    int received = httpd_req_recv(req, buf, sizeof(buf) - 1);
-    if (received <= 0) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No data");
+    char buf[1024];
+    int received = recv_json_body(req, buf, sizeof(buf));
+    if (received < 0) {
         return ESP_FAIL;
     }
-    buf[received] = '\0';
 
     ESP_LOGI(TAG, "Sound config update: %s", buf);
 
@@ -933,54 +1527,16 @@ static esp_err_t sound_post_handler(httpd_req_t *req)
     engine_sound_config_t cfg;
     memcpy(&cfg, engine_sound_get_config(), sizeof(engine_sound_config_t));
 
-    int val;
-    bool bval;
-
-    // Parse sound settings
-    if (parse_json_int(buf, "profile", &val)) {
-        // Profile change - apply it
-        if (val >= 0 && val < SOUND_PROFILE_COUNT) {
-            engine_sound_set_profile((sound_profile_t)val);
-            cfg.profile = (sound_profile_t)val;
-        }
+    json_update_t update = {
+        .fields = sound_json_fields,
+        .field_count = SOUND_JSON_FIELD_COUNT,
+        .config = &cfg,
+        .extra = sound_json_extra,
+    };
+    if (json_walk_object(buf, received, json_update_member, &update) < 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed JSON");
+        return ESP_FAIL;
     }
-    if (parse_json_int(buf, "masterVolumeLevel1", &val)) cfg.master_volume_level1 = val;
-    if (parse_json_int(buf, "masterVolumeLevel2", &val)) cfg.master_volume_level2 = val;
-    if (parse_json_int(buf, "activeVolumeLevel", &val)) cfg.active_volume_level = val;
-    if (parse_json_int(buf, "volumePresetLow", &val)) cfg.volume_preset_low = val;
-    if (parse_json_int(buf, "volumePresetMedium", &val)) cfg.volume_preset_medium = val;
-    if (parse_json_int(buf, "volumePresetHigh", &val)) cfg.volume_preset_high = val;
-    if (parse_json_int(buf, "idleVolume", &val)) cfg.idle_volume = val;
-    if (parse_json_int(buf, "revVolume", &val)) cfg.rev_volume = val;
-    if (parse_json_int(buf, "knockVolume", &val)) cfg.knock_volume = val;
-    if (parse_json_int(buf, "startVolume", &val)) cfg.start_volume = val;
-    if (parse_json_int(buf, "maxRpmPercent", &val)) cfg.max_rpm_percentage = val;
-    if (parse_json_int(buf, "acceleration", &val)) cfg.acceleration = val;
-    if (parse_json_int(buf, "deceleration", &val)) cfg.deceleration = val;
-    if (parse_json_int(buf, "revSwitchPoint", &val)) cfg.rev_switch_point = val;
-    if (parse_json_int(buf, "idleEndPoint", &val)) cfg.idle_end_point = val;
-    if (parse_json_int(buf, "knockStartPoint", &val)) cfg.knock_start_point = val;
-    if (parse_json_int(buf, "knockInterval", &val)) cfg.knock_interval = val;
-    if (parse_json_bool(buf, "jakeBrakeEnabled", &bval)) cfg.jake_brake_enabled = bval;
-    if (parse_json_bool(buf, "v8Mode", &bval)) cfg.v8_mode = bval;
-    if (parse_json_bool(buf, "enabled", &bval)) engine_sound_enable(bval);
-
-    // Parse sound effect settings
-    if (parse_json_bool(buf, "airBrakeEnabled", &bval)) cfg.air_brake_enabled = bval;
-    if (parse_json_int(buf, "airBrakeVolume", &val)) cfg.air_brake_volume = val;
-    if (parse_json_bool(buf, "reverseBeepEnabled", &bval)) cfg.reverse_beep_enabled = bval;
-    if (parse_json_int(buf, "reverseBeepVolume", &val)) cfg.reverse_beep_volume = val;
-    if (parse_json_bool(buf, "gearShiftEnabled", &bval)) cfg.gear_shift_enabled = bval;
-    if (parse_json_int(buf, "gearShiftVolume", &val)) cfg.gear_shift_volume = val;
-    if (parse_json_bool(buf, "wastegateEnabled", &bval)) cfg.wastegate_enabled = bval;
-    if (parse_json_int(buf, "wastegateVolume", &val)) cfg.wastegate_volume = val;
-
-    // Parse horn and mode switch settings
-    if (parse_json_bool(buf, "hornEnabled", &bval)) cfg.horn_enabled = bval;
-    if (parse_json_int(buf, "hornVolume", &val)) cfg.horn_volume = val;
-    if (parse_json_int(buf, "hornType", &val)) cfg.horn_type = (horn_type_t)val;
-    if (parse_json_bool(buf, "modeSwitchEnabled", &bval)) cfg.mode_switch_sound_enabled = bval;
-    if (parse_json_int(buf, "modeSwitchVolume", &val)) cfg.mode_switch_volume = val;
 
     // Ensure magic and version are set correctly before saving
     cfg.magic = SOUND_CONFIG_MAGIC;
@@ -990,7 +1546,295 @@ static esp_err_t sound_post_handler(httpd_req_t *req)
     engine_sound_set_config(&cfg);
 
     // Save to NVS
-    nvs_save_sound_config(&cfg, sizeof(engine_sound_config_t));
+    nvs_storage_save_deferred(NVS_BLOB_SOUND, &cfg, sizeof(engine_sound_config_t));
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, "{\"status\":\"ok\"}");
+    return ESP_OK;
+}
+
+/**
+ * @brief Sound profiles GET handler - returns the profiles and horns in this build
+ */
+static esp_err_t sound_profiles_handler(httpd_req_t *req)
+{
+    char response[1536];  // Sized for built-ins plus SOUND_PACK_MAX_PROFILES, and the horns
+    int len = 0;
+    bool first = true;
+
+    len += snprintf(response + len, sizeof(response) - len, "{\"profiles\":[");
+
+    int count = sound_profiles_count();
+    for (int i = 0; i < count; i++) {
+        if (!sound_profiles_is_available(i)) continue;
+        const sound_profile_def_t *profile = sound_profiles_get(i);
+        if (!first) len += snprintf(response + len, sizeof(response) - len, ",");
+        first = false;
+        len += snprintf(response + len, sizeof(response) - len,
+            "{\"id\":%d,\"name\":\"%s\",\"description\":\"%s\",\"cylinders\":%d,\"hasJakeBrake\":%s}",
+            i, profile->name, profile->description, profile->cylinder_count,
+            profile->has_jake_brake ? "true" : "false");
+        if (len >= (int)sizeof(response)) break;
+    }
+
+    // Horns compiled in or provided by the sound pack
+    first = true;
+    if (len < (int)sizeof(response)) {
+        len += snprintf(response + len, sizeof(response) - len, "],\"horns\":[");
+    }
+    for (int h = 0; h < HORN_TYPE_COUNT && len < (int)sizeof(response); h++) {
+        if (!engine_sound_horn_available(h)) continue;
+        len += snprintf(response + len, sizeof(response) - len, "%s{\"id\":%d,\"name\":\"%s\"}",
+                        first ? "" : ",", h, engine_sound_horn_name(h));
+        first = false;
+    }
+
+    if (len < (int)sizeof(response)) {
+        len += snprintf(response + len, sizeof(response) - len, "]}");
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, response);
+    return ESP_OK;
+}
+
+/**
+ * @brief Battery GET handler - pack voltage, current, level and sag gain
+ */
+static esp_err_t battery_get_handler(httpd_req_t *req)
+{
+    char response[320];
+    int len = battery_to_json(response, sizeof(response));
+    if (len >= (int)sizeof(response)) len = sizeof(response) - 1;
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len);
+    return ESP_OK;
+}
+
+/**
+ * @brief Task stats GET handler - CPU share and free stack per task, idle per
+ *        core, and heartbeat stalls of the watched tasks
+ *
+ * Polled every second by the dashboard, so the response buffer is static
+ * (httpd runs one handler at a time) rather than on the stack or heap.
+ */
+static esp_err_t tasks_get_handler(httpd_req_t *req)
+{
+    static char response[3840];
+    int len = task_stats_to_json(response, sizeof(response));
+    if (len >= (int)sizeof(response)) len = sizeof(response) - 1;
+
+    // Splice the health monitor into the top-level object
+    if (len > 0 && response[len - 1] == '}') {
+        len--;
+        len += snprintf(response + len, sizeof(response) - len, ",\"health\":");
+        if (len < (int)sizeof(response)) {
+            len += health_to_json(response + len, sizeof(response) - len);
+        }
+        if (len < (int)sizeof(response)) {
+            len += snprintf(response + len, sizeof(response) - len, "}");
+        }
+        if (len >= (int)sizeof(response)) len = sizeof(response) - 1;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len);
+    return ESP_OK;
+}
+
+/**
+ * @brief Latency histogram GET handler - min/avg/p99/max per stage
+ */
+static esp_err_t perf_get_handler(httpd_req_t *req)
+{
+    char response[2432];
+    int len = perf_to_json(response, sizeof(response));
+    if (len >= (int)sizeof(response)) len = sizeof(response) - 1;
+
+    // Splice audio buffering stats into the top-level object
+    audio_mixer_stats_t audio;
+    audio_mixer_get_stats(&audio);
+    engine_sound_cache_info_t cache;
+    engine_sound_get_cache_info(&cache);
+    if (len > 0 && response[len - 1] == '}') {
+        len--;
+        len += snprintf(response + len, sizeof(response) - len,
+            ",\"audio\":{\"lowLatency\":%s,\"bufferedUs\":%lu,\"underruns\":%lu,"
+            "\"latencyUs\":%lu,\"latencyMaxUs\":%lu,\"blockUs\":%lu,"
+            "\"dmaBuffers\":%u,\"dmaFill\":%u,\"dmaFillMin\":%u,"
+            "\"loadPct\":%u,\"loadMaxPct\":%u,"
+            "\"dsp\":%s,\"dspLoadPct\":%u,\"limitGainMinPct\":%u,"
+            "\"sampleCache\":{\"bytes\":%lu,\"flashBytes\":%lu,\"psram\":%s}}}",
+            audio.low_latency ? "true" : "false", (unsigned long)audio.buffered_us,
+            (unsigned long)audio.underruns, (unsigned long)audio.latency_us,
+            (unsigned long)audio.latency_max_us, (unsigned long)audio.block_us,
+            audio.dma_buffers, audio.dma_fill, audio.dma_fill_min,
+            audio.load_pct, audio.load_max_pct, audio.dsp ? "true" : "false",
+            audio.dsp_load_pct, audio.limit_gain_min_pct, (unsigned long)cache.bytes,
+            (unsigned long)cache.flash_bytes, cache.psram ? "true" : "false");
+        if (len >= (int)sizeof(response)) len = sizeof(response) - 1;
+    }
+
+    // Clock residency, lock holders and wake latency
+    if (len > 0 && response[len - 1] == '}') {
+        len--;
+        len += snprintf(response + len, sizeof(response) - len, ",\"power\":");
+        if (len < (int)sizeof(response)) {
+            len += power_to_json(response + len, sizeof(response) - len);
+        }
+        if (len < (int)sizeof(response)) {
+            len += snprintf(response + len, sizeof(response) - len, "}");
+        }
+        if (len >= (int)sizeof(response)) len = sizeof(response) - 1;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len);
+    return ESP_OK;
+}
+
+/**
+ * @brief Latency histogram reset handler
+ */
+static esp_err_t perf_reset_handler(httpd_req_t *req)
+{
+    perf_reset();
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, "{\"status\":\"ok\"}");
+    return ESP_OK;
+}
+
+static void ws_bench_status(void *arg);
+
+/**
+ * @brief Benchmark GET handler - cycle counts of the hot paths on this board
+ *
+ * Takes a few hundred milliseconds; refused while the motor or engine runs.
+ */
+static esp_err_t bench_get_handler(httpd_req_t *req)
+{
+    const size_t size = 4096;
+    char *response = malloc(size);
+    if (response == NULL) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+        return ESP_FAIL;
+    }
+
+    esp_err_t err = bench_run(ws_bench_status, response, size);
+    if (err == ESP_ERR_INVALID_STATE) {
+        free(response);
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_sendstr(req, "{\"error\":\"Stop the motor and engine first\"}");
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        free(response);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, esp_err_to_name(err));
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, response);
+    free(response);
+    return ESP_OK;
+}
+
+/**
+ * @brief Stress test GET handler - active run, or the report of the last one
+ */
+static esp_err_t stress_get_handler(httpd_req_t *req)
+{
+    char response[896];
+    int len = stress_to_json(response, sizeof(response));
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len < (int)sizeof(response) ? len : (int)sizeof(response) - 1);
+    return ESP_OK;
+}
+
+// Stress API keys; "pattern" and "stop" are handled by stress_request_member()
+static const json_field_t stress_json_fields[] = {
+    JSON_UINT(stress_config_t, rate_hz, "rateHz"),
+    JSON_UINT(stress_config_t, duration_s, "durationS"),
+    JSON_BOOL(stress_config_t, ws, "ws"),
+    JSON_BOOL(stress_config_t, flash, "flash"),
+    JSON_BOOL(stress_config_t, sound, "sound"),
+};
+
+typedef struct {
+    stress_config_t config;
+    bool stop;
+} stress_request_t;
+
+static bool stress_request_member(const char *key, size_t key_len, const json_value_t *value, void *ctx)
+{
+    stress_request_t *r = (stress_request_t *)ctx;
+
+    if (key_len == 4 && memcmp(key, "stop", 4) == 0) {
+        r->stop = value->type == JSON_VALUE_BOOL && value->number;
+        return true;
+    }
+    if (key_len == 7 && memcmp(key, "pattern", 7) == 0) {
+        if (value->type != JSON_VALUE_STRING) {
+            return false;
+        }
+        for (int p = 0; p < STRESS_PATTERN_COUNT; p++) {
+            const char *name = stress_pattern_name((stress_pattern_t)p);
+            if (strlen(name) == value->str_len && memcmp(name, value->str, value->str_len) == 0) {
+                r->config.pattern = (uint8_t)p;
+                return true;
+            }
+        }
+        return false;
+    }
+    const json_field_t *field = json_find_field(stress_json_fields,
+                                                sizeof(stress_json_fields) / sizeof(stress_json_fields[0]),
+                                                key, key_len);
+    return field == NULL || json_field_store(field, &r->config, value);
+}
+
+/**
+ * @brief Stress test POST handler - start a run, or {"stop":true}
+ *
+ * {"pattern":"sweep"|"step"|"auxStorm","rateHz":n,"durationS":n,
+ *  "ws":b,"flash":b,"sound":b}; omitted keys keep the defaults below.
+ */
+static esp_err_t stress_post_handler(httpd_req_t *req)
+{
+    char buf[192];
+    int received = recv_json_body(req, buf, sizeof(buf));
+    if (received < 0) {
+        return ESP_FAIL;
+    }
+
+    stress_request_t r = {
+        .config = {
+            .pattern = STRESS_PATTERN_SWEEP,
+            .rate_hz = 100,
+            .duration_s = 30,
+        },
+    };
+    if (json_walk_object(buf, received, stress_request_member, &r) < 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad stress request");
+        return ESP_FAIL;
+    }
+
+    if (r.stop) {
+        stress_stop();
+    } else {
+        esp_err_t err = stress_start(&r.config);
+        if (err == ESP_ERR_INVALID_STATE) {
+            httpd_resp_set_status(req, "409 Conflict");
+            httpd_resp_set_type(req, "application/json");
+            httpd_resp_sendstr(req, "{\"error\":\"Stop the motor, finish calibration or the running test first\"}");
+            return ESP_OK;
+        }
+        if (err != ESP_OK) {
+            httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, esp_err_to_name(err));
+            return ESP_FAIL;
+        }
+    }
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_sendstr(req, "{\"status\":\"ok\"}");
@@ -998,28 +1842,288 @@ static esp_err_t sound_post_handler(httpd_req_t *req)
 }
 
 /**
- * @brief Sound profiles GET handler - returns list of available profiles
+ * @brief RC signal quality GET handler - per-channel jitter/glitch stats
+ */
+static esp_err_t rc_stats_get_handler(httpd_req_t *req)
+{
+    char response[896];
+    int len = snprintf(response, sizeof(response), "{\"filter\":%s,\"channels\":[",
+                       RC_MEDIAN_FILTER_ENABLED ? "true" : "false");
+
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        rc_channel_stats_t st;
+        rc_input_get_stats((rc_channel_t)i, &st);
+        len += snprintf(response + len, sizeof(response) - len,
+            "%s{\"mean\":%u,\"jitter\":%u,\"interval\":%u,\"glitches\":%lu,\"pulses\":%lu}",
+            i > 0 ? "," : "", st.mean_us, st.jitter_us, st.frame_interval_us,
+            (unsigned long)st.glitch_count, (unsigned long)st.pulse_count);
+    }
+    len += snprintf(response + len, sizeof(response) - len, "]");
+
+#if RC_INPUT_BACKEND == RC_BACKEND_ESPNOW
+    rc_espnow_stats_t link;
+    rc_espnow_get_stats(&link);
+    len += snprintf(response + len, sizeof(response) - len,
+        ",\"espnow\":{\"paired\":%s,\"peer\":\"" MACSTR "\",\"frames\":%lu,\"lost\":%lu,"
+        "\"rejected\":%lu,\"failsafe\":%lu,\"interval\":%u,\"quality\":%u,\"rssi\":%d}",
+        link.paired ? "true" : "false", MAC2STR(link.peer),
+        (unsigned long)link.frames, (unsigned long)link.lost,
+        (unsigned long)link.rejected, (unsigned long)link.failsafe,
+        link.interval_us, link.link_quality, link.rssi);
+#endif
+    len += snprintf(response + len, sizeof(response) - len, "}");
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response, len);
+    return ESP_OK;
+}
+
+/**
+ * @brief RC signal quality reset handler
+ */
+static esp_err_t rc_stats_reset_handler(httpd_req_t *req)
+{
+    rc_input_reset_stats();
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, "{\"status\":\"ok\"}");
+    return ESP_OK;
+}
+
+/**
+ * @brief Send part of the trace ring in WEB_TRACE_CHUNK_BYTES pieces
+ */
+static esp_err_t trace_send_records(httpd_req_t *req, const trace_record_t *records, size_t count)
+{
+    const char *p = (const char *)records;
+    size_t left = count * sizeof(trace_record_t);
+
+    while (left > 0) {
+        size_t n = left < WEB_TRACE_CHUNK_BYTES ? left : WEB_TRACE_CHUNK_BYTES;
+        esp_err_t ret = httpd_resp_send_chunk(req, p, n);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        p += n;
+        left -= n;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Flight recorder download - trace_file_header_t + records, oldest first
+ *
+ * Recording pauses for the download so the ring can be sent in place.
+ */
+static esp_err_t trace_get_handler(httpd_req_t *req)
+{
+    if (trace_capacity() == 0) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Flight recorder not available");
+        return ESP_FAIL;
+    }
+
+    trace_set_hold(true);
+    vTaskDelay(pdMS_TO_TICKS(10));      // Let a record in progress land
+
+    const trace_record_t *first, *second;
+    size_t first_count, second_count;
+    size_t count = trace_get_span(&first, &first_count, &second, &second_count);
+
+    trace_file_header_t header = {
+        .magic = TRACE_FILE_MAGIC,
+        .version = TRACE_FILE_VERSION,
+        .record_size = sizeof(trace_record_t),
+        .count = count,
+        .capacity = trace_capacity(),
+        .rate_hz = tuning_get_config()->control.loop_rate_hz,
+        .uptime_ms = (uint32_t)(esp_timer_get_time() / 1000),
+    };
+
+    httpd_resp_set_type(req, "application/octet-stream");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"trace.bin\"");
+    esp_err_t ret = httpd_resp_send_chunk(req, (const char *)&header, sizeof(header));
+    if (ret == ESP_OK) ret = trace_send_records(req, first, first_count);
+    if (ret == ESP_OK) ret = trace_send_records(req, second, second_count);
+    if (ret == ESP_OK) ret = httpd_resp_send_chunk(req, NULL, 0);
+
+    trace_set_hold(false);
+    ESP_LOGI(TAG, "Trace download: %u records%s", (unsigned)count, ret == ESP_OK ? "" : " (aborted)");
+    return ret;
+}
+
+#if CONFIG_CRAWLER_TIMELINE
+/**
+ * @brief Timeline download - timeline_file_header_t, task names, then events
+ *        oldest first
+ *
+ * Recording pauses for the download. A ring that froze on a deadline miss
+ * stays frozen (and armed) until it is re-armed or disarmed by a POST.
+ */
+static esp_err_t timeline_get_handler(httpd_req_t *req)
+{
+    if (timeline_capacity() == 0) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Timeline ring not available");
+        return ESP_FAIL;
+    }
+
+    timeline_set_hold(true);
+    vTaskDelay(pdMS_TO_TICKS(10));      // Let events in flight land
+
+    const timeline_event_t *first, *second;
+    size_t first_count, second_count;
+    size_t count = timeline_get_span(&first, &first_count, &second, &second_count);
+
+    // Names of the tasks alive now (the ring holds handles)
+    static TaskStatus_t status[TASK_STATS_MAX_TASKS];
+    static timeline_task_name_t names[TASK_STATS_MAX_TASKS];
+    UBaseType_t task_count = uxTaskGetSystemState(status, TASK_STATS_MAX_TASKS, NULL);
+    for (UBaseType_t i = 0; i < task_count; i++) {
+        names[i].handle = (uint32_t)status[i].xHandle;
+        strncpy(names[i].name, status[i].pcTaskName, TIMELINE_NAME_LEN);
+    }
+
+    bool triggered;
+    timeline_is_armed(&triggered);
+    timeline_file_header_t header = {
+        .magic = TIMELINE_FILE_MAGIC,
+        .version = TIMELINE_FILE_VERSION,
+        .event_size = sizeof(timeline_event_t),
+        .count = count,
+        .capacity = timeline_capacity(),
+        .task_count = task_count,
+        .triggered = triggered,
+        .uptime_ms = (uint32_t)(esp_timer_get_time() / 1000),
+    };
+
+    httpd_resp_set_type(req, "application/octet-stream");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"timeline.bin\"");
+    esp_err_t ret = httpd_resp_send_chunk(req, (const char *)&header, sizeof(header));
+    if (ret == ESP_OK) ret = httpd_resp_send_chunk(req, (const char *)names, task_count * sizeof(names[0]));
+    if (ret == ESP_OK && first_count) ret = httpd_resp_send_chunk(req, (const char *)first, first_count * sizeof(*first));
+    if (ret == ESP_OK && second_count) ret = httpd_resp_send_chunk(req, (const char *)second, second_count * sizeof(*second));
+    if (ret == ESP_OK) ret = httpd_resp_send_chunk(req, NULL, 0);
+
+    timeline_set_hold(false);
+    ESP_LOGI(TAG, "Timeline download: %u events%s", (unsigned)count, ret == ESP_OK ? "" : " (aborted)");
+    return ret;
+}
+
+static bool timeline_request_member(const char *key, size_t key_len, const json_value_t *value, void *ctx)
+{
+    if (key_len == 5 && memcmp(key, "armed", 5) == 0 && value->type == JSON_VALUE_BOOL) {
+        *(int *)ctx = value->number ? 1 : 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Timeline POST handler - {"armed":true} freezes the ring on the next
+ *        control deadline miss (restarting a frozen one), false runs it free
+ *
+ * Replies with the state either way, so an empty object reads it.
+ */
+static esp_err_t timeline_post_handler(httpd_req_t *req)
+{
+    char buf[64];
+    int received = recv_json_body(req, buf, sizeof(buf));
+    if (received < 0) {
+        return ESP_FAIL;
+    }
+
+    int arm = -1;
+    if (json_walk_object(buf, received, timeline_request_member, &arm) < 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad timeline request");
+        return ESP_FAIL;
+    }
+    if (arm >= 0) {
+        timeline_arm(arm);
+    }
+
+    bool triggered;
+    bool armed = timeline_is_armed(&triggered);
+    char response[96];
+    snprintf(response, sizeof(response), "{\"available\":%s,\"armed\":%s,\"triggered\":%s}",
+             timeline_capacity() ? "true" : "false", armed ? "true" : "false",
+             triggered ? "true" : "false");
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, response);
+    return ESP_OK;
+}
+#endif // CONFIG_CRAWLER_TIMELINE
+
+/**
+ * @brief Send a stored black box event as a trace file
  */
-static esp_err_t sound_profiles_handler(httpd_req_t *req)
+static esp_err_t blackbox_send_event(httpd_req_t *req, int slot, const blackbox_header_t *event)
 {
-    char response[512];  // Sized for 3 profiles
-    int len = 0;
-
-    len += snprintf(response + len, sizeof(response) - len, "{\"profiles\":[");
+    trace_file_header_t header = {
+        .magic = TRACE_FILE_MAGIC,
+        .version = TRACE_FILE_VERSION,
+        .record_size = sizeof(trace_record_t),
+        .count = event->count,
+        .capacity = event->count,
+        .rate_hz = event->rate_hz,
+        .uptime_ms = event->uptime_ms,
+    };
+    char disposition[64];
+    snprintf(disposition, sizeof(disposition), "attachment; filename=\"blackbox-%lu-%s.bin\"",
+             (unsigned long)event->seq, blackbox_cause_name(event->cause));
+
+    httpd_resp_set_type(req, "application/octet-stream");
+    httpd_resp_set_hdr(req, "Content-Disposition", disposition);
+    esp_err_t ret = httpd_resp_send_chunk(req, (const char *)&header, sizeof(header));
+
+    trace_record_t chunk[WEB_TRACE_CHUNK_BYTES / sizeof(trace_record_t) / 4];
+    for (size_t done = 0; ret == ESP_OK && done < event->count; ) {
+        size_t n = event->count - done;
+        if (n > sizeof(chunk) / sizeof(chunk[0])) {
+            n = sizeof(chunk) / sizeof(chunk[0]);
+        }
+        ret = blackbox_read(slot, done, chunk, n);
+        if (ret == ESP_OK) ret = trace_send_records(req, chunk, n);
+        done += n;
+    }
+    if (ret == ESP_OK) ret = httpd_resp_send_chunk(req, NULL, 0);
+    return ret;
+}
 
-    for (int i = 0; i < SOUND_PROFILE_COUNT; i++) {
-        const sound_profile_def_t *profile = sound_profiles_get(i);
-        if (i > 0) len += snprintf(response + len, sizeof(response) - len, ",");
-        len += snprintf(response + len, sizeof(response) - len,
-            "{\"id\":%d,\"name\":\"%s\",\"description\":\"%s\",\"cylinders\":%d,\"hasJakeBrake\":%s}",
-            i, profile->name, profile->description, profile->cylinder_count,
-            profile->has_jake_brake ? "true" : "false");
+/**
+ * @brief Black box events - list, or one event as a trace file with ?slot=N
+ */
+static esp_err_t blackbox_get_handler(httpd_req_t *req)
+{
+    char query[32];
+    char value[8];
+    blackbox_header_t event;
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "slot", value, sizeof(value)) == ESP_OK) {
+        int slot = atoi(value);
+        if (!blackbox_get_event(slot, &event)) {
+            httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No event in slot");
+            return ESP_FAIL;
+        }
+        return blackbox_send_event(req, slot, &event);
     }
 
-    len += snprintf(response + len, sizeof(response) - len, "]}");
+    char buf[512];
+    int len = snprintf(buf, sizeof(buf), "{\"events\":[");
+    bool first = true;
+    for (int slot = 0; slot < BLACKBOX_SLOTS; slot++) {
+        if (!blackbox_get_event(slot, &event)) {
+            continue;
+        }
+        len += snprintf(buf + len, sizeof(buf) - len,
+                        "%s{\"slot\":%d,\"seq\":%lu,\"cause\":\"%s\",\"uptimeMs\":%lu,"
+                        "\"records\":%lu,\"rateHz\":%u}",
+                        first ? "" : ",", slot, (unsigned long)event.seq,
+                        blackbox_cause_name(event.cause), (unsigned long)event.uptime_ms,
+                        (unsigned long)event.count, event.rate_hz);
+        first = false;
+    }
+    snprintf(buf + len, sizeof(buf) - len, "]}");
 
     httpd_resp_set_type(req, "application/json");
-    httpd_resp_sendstr(req, response);
+    httpd_resp_sendstr(req, buf);
     return ESP_OK;
 }
 
@@ -1032,7 +2136,7 @@ static int build_calibration_response(char *buf, size_t bufsize, const char *res
     calibration_get_status(&status);
     const calibration_data_t *cal = calibration_get_data();
 
-    return snprintf(buf, bufsize,
+    int len = snprintf(buf, bufsize,
         "{%s\"step\":%d,\"channel\":%d,\"message\":\"%s\","
         "\"pulse\":%u,\"recCenter\":%u,\"recMin\":%u,\"recMax\":%u,"
         "\"valid\":%s,\"inProgress\":%s,"
@@ -1042,7 +2146,7 @@ static int build_calibration_response(char *buf, size_t bufsize, const char *res
         "{\"min\":%d,\"center\":%d,\"max\":%d,\"rev\":%s},"
         "{\"min\":%d,\"center\":%d,\"max\":%d,\"rev\":%s},"
         "{\"min\":%d,\"center\":%d,\"max\":%d,\"rev\":%s},"
-        "{\"min\":%d,\"center\":%d,\"max\":%d,\"rev\":%s}]}",
+        "{\"min\":%d,\"center\":%d,\"max\":%d,\"rev\":%s}],",
         result ? result : "",
         status.step, status.channel, status.message,
         status.current_pulse, status.recorded_center, status.recorded_min, status.recorded_max,
@@ -1054,6 +2158,23 @@ static int build_calibration_response(char *buf, size_t bufsize, const char *res
         cal->channels[3].min, cal->channels[3].center, cal->channels[3].max, cal->channels[3].reversed ? "true" : "false",
         cal->channels[4].min, cal->channels[4].center, cal->channels[4].max, cal->channels[4].reversed ? "true" : "false",
         cal->channels[5].min, cal->channels[5].center, cal->channels[5].max, cal->channels[5].reversed ? "true" : "false");
+
+    // Live capture: [min, short-term mean, max, jitter, pulses] per channel
+    len += snprintf(buf + len, bufsize - len,
+        "\"all\":%s,\"stable\":%u,\"swept\":%u,\"autoCenter\":[%u,%u,%u,%u,%u,%u],\"cap\":[",
+        status.all_channels ? "true" : "false", status.stable_mask, status.swept_mask,
+        status.auto_center[0], status.auto_center[1], status.auto_center[2],
+        status.auto_center[3], status.auto_center[4], status.auto_center[5]);
+    for (int i = 0; i < RC_CHANNEL_COUNT && len < (int)bufsize; i++) {
+        const rc_cal_capture_t *c = &status.capture[i];
+        len += snprintf(buf + len, bufsize - len, "%s[%u,%u,%u,%u,%lu]",
+                        i ? "," : "", c->min_us, c->recent_us, c->max_us, c->jitter_us,
+                        (unsigned long)c->count);
+    }
+    if (len < (int)bufsize) {
+        len += snprintf(buf + len, bufsize - len, "]}");
+    }
+    return len;
 }
 
 /**
@@ -1061,7 +2182,7 @@ static int build_calibration_response(char *buf, size_t bufsize, const char *res
  */
 static esp_err_t calibration_get_handler(httpd_req_t *req)
 {
-    char response[640];
+    char response[1024];
     build_calibration_response(response, sizeof(response), NULL);
 
     httpd_resp_set_type(req, "application/json");
@@ -1073,6 +2194,7 @@ static esp_err_t calibration_get_handler(httpd_req_t *req)
  * @brief Calibration POST handler - manual per-channel calibration
  * Actions:
  *   {"action":"start","channel":0-5}  - Start calibrating a channel
+ *   {"action":"startAll"}             - Calibrate all channels from stick movement
  *   {"action":"next"}                 - Confirm current step, move to next
  *   {"action":"cancel"}               - Cancel calibration
  *   {"action":"clear","channel":0-5}  - Clear channel calibration
@@ -1101,7 +2223,10 @@ static esp_err_t calibration_post_handler(httpd_req_t *req)
     }
 
     // Parse action
-    if (strstr(buf, "\"start\"") != NULL && channel >= 0 && channel < RC_CHANNEL_COUNT) {
+    if (strstr(buf, "\"startAll\"") != NULL) {
+        esp_err_t ret = calibration_start_all();
+        result_str = (ret == ESP_OK) ? "\"status\":\"started\"," : "\"status\":\"failed\",";
+    } else if (strstr(buf, "\"start\"") != NULL && channel >= 0 && channel < RC_CHANNEL_COUNT) {
         esp_err_t ret = calibration_start_channel((rc_channel_t)channel);
         result_str = (ret == ESP_OK) ? "\"status\":\"started\"," : "\"status\":\"failed\",";
     } else if (strstr(buf, "\"next\"") != NULL) {
@@ -1125,7 +2250,7 @@ static esp_err_t calibration_post_handler(httpd_req_t *req)
     }
 
     // Return full calibration state
-    char response[640];
+    char response[1024];
     build_calibration_response(response, sizeof(response), result_str);
 
     httpd_resp_set_type(req, "application/json");
@@ -1133,19 +2258,103 @@ static esp_err_t calibration_post_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+// ============================================================================
+// Servo Test Mode
+// ============================================================================
+
+/**
+ * @brief Publish new servo test pulses for the control task (httpd task only)
+ */
+static void jog_publish(const uint16_t pulses[SERVO_COUNT])
+{
+    uint32_t gen = jog_gen;
+    __atomic_store_n(&jog_gen, gen + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(jog_pulses, pulses, sizeof(jog_pulses));
+    __atomic_store_n(&jog_gen, gen + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Set all servos from stick positions and refresh the timeout
+ * @param timeout_ms Inactivity timeout from now
+ */
+static void jog_set_values(const int16_t values[SERVO_COUNT], uint32_t timeout_ms)
+{
+    uint16_t pulses[SERVO_COUNT];
+
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        int16_t v = values[i];
+        if (v < -1000) v = -1000;
+        if (v > 1000) v = 1000;
+        jog_values[i] = v;
+        pulses[i] = tuning_calc_servo_pulse(i, v);
+    }
+    jog_publish(pulses);
+    servo_test_timeout = (uint32_t)(esp_timer_get_time() / 1000) + timeout_ms;
+}
+
+/**
+ * @brief Enter or leave servo test mode (httpd task only)
+ */
+static void servo_test_set_active(bool active)
+{
+    if (active && !servo_test_active) {
+        // Start from where the servos are so nothing jumps
+        uint16_t pulses[SERVO_COUNT];
+        for (int i = 0; i < SERVO_COUNT; i++) {
+            pulses[i] = servo_get_pulse((servo_id_t)i);
+        }
+        jog_publish(pulses);
+    }
+    if (active) {
+        servo_test_timeout = (uint32_t)(esp_timer_get_time() / 1000) + SERVO_TEST_TIMEOUT_MS;
+    }
+    jog_fd = -1;
+    servo_test_active = active;
+}
+
+/**
+ * @brief Apply a servo jog frame (httpd task)
+ */
+static void ws_apply_jog(int fd, const uint8_t *data, size_t len)
+{
+    ws_jog_frame_t frame;
+
+    if (len < sizeof(frame) || !servo_test_active) {
+        return;
+    }
+    memcpy(&frame, data, sizeof(frame));
+
+    // A new socket starts its own sequence; on the same socket only newer frames count
+    if (fd == jog_fd && (int16_t)(frame.seq - jog_seq) <= 0) {
+        jog_stale++;
+        return;
+    }
+    int16_t values[SERVO_COUNT];
+    memcpy(values, frame.values, sizeof(values));
+    jog_fd = fd;
+    jog_seq = frame.seq;
+    jog_set_values(values, WEB_JOG_TIMEOUT_MS);
+}
+
 /**
  * @brief Servo test GET handler - returns test mode status
  */
 static esp_err_t servo_test_get_handler(httpd_req_t *req)
 {
-    char response[128];
-    snprintf(response, sizeof(response),
-        "{\"active\":%s,\"pulses\":[%u,%u,%u,%u]}",
-        servo_test_active ? "true" : "false",
-        servo_get_pulse(SERVO_AXLE_1),
-        servo_get_pulse(SERVO_AXLE_2),
-        servo_get_pulse(SERVO_AXLE_3),
-        servo_get_pulse(SERVO_AXLE_4));
+    char response[256];
+    int len = snprintf(response, sizeof(response), "{\"active\":%s,\"pulses\":[",
+                       servo_test_active ? "true" : "false");
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        len += snprintf(response + len, sizeof(response) - len, "%s%u",
+                        i ? "," : "", servo_get_pulse((servo_id_t)i));
+    }
+    len += snprintf(response + len, sizeof(response) - len, "],\"values\":[");
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        len += snprintf(response + len, sizeof(response) - len, "%s%d", i ? "," : "", jog_values[i]);
+    }
+    snprintf(response + len, sizeof(response) - len, "],\"seq\":%u,\"stale\":%lu}",
+             jog_seq, (unsigned long)jog_stale);
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_sendstr(req, response);
@@ -1154,7 +2363,9 @@ static esp_err_t servo_test_get_handler(httpd_req_t *req)
 
 /**
  * @brief Servo test POST handler - enable/disable test mode and set servo positions
- * Expects JSON: {"active":true/false} or {"servo":0-3,"pulse":1000-2000}
+ * Expects JSON: {"active":true/false} or {"servo":0..SERVO_COUNT-1,"pulse":1000-2000}.
+ * Positions take effect on the next control tick; the web UI streams them
+ * over the WebSocket instead (ws_jog_frame_t).
  */
 static esp_err_t servo_test_post_handler(httpd_req_t *req)
 {
@@ -1171,9 +2382,8 @@ static esp_err_t servo_test_post_handler(httpd_req_t *req)
     // Check for active toggle
     const char *active_pos = strstr(buf, "\"active\":");
     if (active_pos) {
-        servo_test_active = (strstr(active_pos, "true") != NULL);
+        servo_test_set_active(strstr(active_pos, "true") != NULL);
         if (servo_test_active) {
-            servo_test_timeout = (uint32_t)(esp_timer_get_time() / 1000) + SERVO_TEST_TIMEOUT_MS;
             ESP_LOGI(TAG, "Servo test mode ENABLED (30s timeout)");
         } else {
             ESP_LOGI(TAG, "Servo test mode DISABLED");
@@ -1185,13 +2395,14 @@ static esp_err_t servo_test_post_handler(httpd_req_t *req)
     const char *values_pos = strstr(buf, "\"values\":[");
     if (values_pos && servo_test_active) {
         values_pos += 10; // Skip past "\"values\":["
-        int values[4];
+        int16_t values[SERVO_COUNT];
         int count = 0;
-        while (count < 4 && *values_pos) {
+        while (count < SERVO_COUNT && *values_pos) {
             // Skip whitespace
             while (*values_pos == ' ') values_pos++;
             if (*values_pos == '-' || (*values_pos >= '0' && *values_pos <= '9')) {
-                values[count++] = atoi(values_pos);
+                int v = atoi(values_pos);
+                values[count++] = (int16_t)(v < -1000 ? -1000 : v > 1000 ? 1000 : v);
                 // Skip past this number
                 if (*values_pos == '-') values_pos++;
                 while (*values_pos >= '0' && *values_pos <= '9') values_pos++;
@@ -1201,18 +2412,9 @@ static esp_err_t servo_test_post_handler(httpd_req_t *req)
             if (*values_pos == ']') break;
         }
 
-        if (count == 4) {
-            for (int i = 0; i < 4; i++) {
-                // Clamp to valid range
-                if (values[i] < -1000) values[i] = -1000;
-                if (values[i] > 1000) values[i] = 1000;
-                // Calculate pulse using tuning
-                uint16_t pulse = tuning_calc_servo_pulse(i, values[i]);
-                servo_set_pulse((servo_id_t)i, pulse);
-            }
-            // Refresh timeout on activity
-            servo_test_timeout = (uint32_t)(esp_timer_get_time() / 1000) + SERVO_TEST_TIMEOUT_MS;
-            ESP_LOGI(TAG, "Servo test: [%d, %d, %d, %d]", values[0], values[1], values[2], values[3]);
+        if (count == SERVO_COUNT) {
+            jog_set_values(values, SERVO_TEST_TIMEOUT_MS);
+            ESP_LOGI(TAG, "Servo test: %d axle positions", count);
         }
     }
 
@@ -1227,7 +2429,10 @@ static esp_err_t servo_test_post_handler(httpd_req_t *req)
 
         if (servo_test_active && servo_idx >= 0 && servo_idx < SERVO_COUNT &&
             pulse >= SERVO_MIN_US && pulse <= SERVO_MAX_US) {
-            servo_set_pulse((servo_id_t)servo_idx, pulse);
+            uint16_t pulses[SERVO_COUNT];
+            memcpy(pulses, jog_pulses, sizeof(pulses));
+            pulses[servo_idx] = (uint16_t)pulse;
+            jog_publish(pulses);
             // Refresh timeout on activity
             servo_test_timeout = (uint32_t)(esp_timer_get_time() / 1000) + SERVO_TEST_TIMEOUT_MS;
             ESP_LOGI(TAG, "Servo %d set to %d us", servo_idx, pulse);
@@ -1245,8 +2450,10 @@ static esp_err_t servo_test_post_handler(httpd_req_t *req)
 static esp_err_t start_webserver(void)
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.stack_size = 6144;      // Increased from 4096 for file serving buffer
-    config.max_uri_handlers = 24;  // Need extra for calibration + servo test APIs
+    config.stack_size = 6144;      // Handlers build JSON responses on the stack
+    config.task_priority = HTTPD_TASK_PRIORITY;
+    config.core_id = HTTPD_TASK_CORE;
+    config.max_uri_handlers = 40;  // Need extra for calibration, servo test, perf, preset, stress + timeline APIs
     config.lru_purge_enable = true;
     config.uri_match_fn = httpd_uri_match_wildcard;
     config.recv_wait_timeout = 120;  // 2 minutes for OTA uploads (default is 5)
@@ -1254,6 +2461,17 @@ static esp_err_t start_webserver(void)
 
     ESP_LOGI(TAG, "Starting HTTP server on port %d", config.server_port);
 
+    if (ws_mutex == NULL) {
+        ws_mutex = xSemaphoreCreateMutex();
+        if (ws_mutex == NULL) {
+            ESP_LOGE(TAG, "Failed to create WebSocket client mutex");
+            return ESP_ERR_NO_MEM;
+        }
+        for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+            ws_clients[i].fd = -1;
+        }
+    }
+
     if (httpd_start(&server, &config) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start HTTP server");
         return ESP_FAIL;
@@ -1326,6 +2544,11 @@ static esp_err_t start_webserver(void)
     };
     httpd_register_uri_handler(server, &tuning_post);
 
+    // Tuning API - PATCH (same partial update as POST)
+    httpd_uri_t tuning_patch = tuning_post;
+    tuning_patch.method = HTTP_PATCH;
+    httpd_register_uri_handler(server, &tuning_patch);
+
     // Tuning reset API - POST
     httpd_uri_t tuning_reset = {
         .uri = "/api/tuning/reset",
@@ -1335,6 +2558,23 @@ static esp_err_t start_webserver(void)
     };
     httpd_register_uri_handler(server, &tuning_reset);
 
+    // Preset API - GET / POST
+    httpd_uri_t presets_get = {
+        .uri = "/api/presets",
+        .method = HTTP_GET,
+        .handler = presets_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &presets_get);
+
+    httpd_uri_t presets_post = {
+        .uri = "/api/presets",
+        .method = HTTP_POST,
+        .handler = presets_post_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &presets_post);
+
     // Calibration API - GET
     httpd_uri_t cal_get = {
         .uri = "/api/calibration",
@@ -1389,6 +2629,11 @@ static esp_err_t start_webserver(void)
     };
     httpd_register_uri_handler(server, &sound_post);
 
+    // Sound API - PATCH (same partial update as POST)
+    httpd_uri_t sound_patch = sound_post;
+    sound_patch.method = HTTP_PATCH;
+    httpd_register_uri_handler(server, &sound_patch);
+
     // Sound profiles API - GET
     httpd_uri_t sound_profiles = {
         .uri = "/api/sound/profiles",
@@ -1398,6 +2643,123 @@ static esp_err_t start_webserver(void)
     };
     httpd_register_uri_handler(server, &sound_profiles);
 
+    // Latency stats API - GET
+    httpd_uri_t perf_get = {
+        .uri = "/api/perf",
+        .method = HTTP_GET,
+        .handler = perf_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &perf_get);
+
+    // Latency stats reset API - POST
+    httpd_uri_t perf_reset_uri = {
+        .uri = "/api/perf/reset",
+        .method = HTTP_POST,
+        .handler = perf_reset_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &perf_reset_uri);
+
+    // Battery sensing API - GET
+    httpd_uri_t battery_get = {
+        .uri = "/api/battery",
+        .method = HTTP_GET,
+        .handler = battery_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &battery_get);
+
+    // Per-task CPU and stack use - GET
+    httpd_uri_t tasks_get = {
+        .uri = "/api/tasks",
+        .method = HTTP_GET,
+        .handler = tasks_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &tasks_get);
+
+    // On-device benchmark - GET
+    httpd_uri_t bench_get = {
+        .uri = "/api/bench",
+        .method = HTTP_GET,
+        .handler = bench_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &bench_get);
+
+    // Synthetic load test - GET report, POST start/stop
+    httpd_uri_t stress_get = {
+        .uri = "/api/stress",
+        .method = HTTP_GET,
+        .handler = stress_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &stress_get);
+
+    httpd_uri_t stress_post = {
+        .uri = "/api/stress",
+        .method = HTTP_POST,
+        .handler = stress_post_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &stress_post);
+
+    // RC signal quality API - GET
+    httpd_uri_t rc_stats_get = {
+        .uri = "/api/rc/stats",
+        .method = HTTP_GET,
+        .handler = rc_stats_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &rc_stats_get);
+
+    // RC signal quality reset API - POST
+    httpd_uri_t rc_stats_reset = {
+        .uri = "/api/rc/stats/reset",
+        .method = HTTP_POST,
+        .handler = rc_stats_reset_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &rc_stats_reset);
+
+    // Flight recorder download - GET
+    httpd_uri_t trace_get = {
+        .uri = "/api/trace",
+        .method = HTTP_GET,
+        .handler = trace_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &trace_get);
+
+#if CONFIG_CRAWLER_TIMELINE
+    // Task and ISR timeline - GET (download), POST (arm on deadline miss)
+    httpd_uri_t timeline_get = {
+        .uri = "/api/trace/timeline",
+        .method = HTTP_GET,
+        .handler = timeline_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &timeline_get);
+
+    httpd_uri_t timeline_post = {
+        .uri = "/api/trace/timeline",
+        .method = HTTP_POST,
+        .handler = timeline_post_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &timeline_post);
+#endif
+
+    // Black box events - GET (list, or ?slot=N download)
+    httpd_uri_t blackbox_get = {
+        .uri = "/api/blackbox",
+        .method = HTTP_GET,
+        .handler = blackbox_get_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler(server, &blackbox_get);
+
     // Static file handler (wildcard for all other requests)
     httpd_uri_t file = {
         .uri = "/*",
@@ -1414,15 +2776,11 @@ esp_err_t web_server_init(void)
 {
     ESP_LOGI(TAG, "Initializing web server...");
 
-    // Initialize SPIFFS for static files
-    esp_err_t ret = init_spiffs();
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "SPIFFS not available, web UI disabled");
-        // Continue anyway - WiFi AP still works
-    }
+    // Map the web UI bundle (a missing one only disables the pages)
+    web_bundle_init();
 
     // Load WiFi STA configuration from NVS
-    ret = nvs_load_wifi_config(&sta_config);
+    esp_err_t ret = nvs_load_wifi_config(&sta_config);
     if (ret != ESP_OK) {
         nvs_get_default_wifi_config(&sta_config);
     }
@@ -1442,75 +2800,309 @@ esp_err_t web_server_init(void)
     return ESP_OK;
 }
 
-void web_server_update_status(const web_status_t *status)
+/**
+ * @brief Format the fields that rarely change as a JSON text frame
+ *
+ * Queued on connect and whenever the WiFi STA state changes; the client
+ * merges it into every decoded status frame.
+ * Keys: fv=status frame version, v=version, b=build, wse=wifi_sta_enabled,
+ *       wsc=wifi_sta_connected, wss=wifi_sta_ssid, wsi=wifi_sta_ip,
+ *       wsr=wifi_sta_reason (disconnect reason code), wsrs=wifi_sta_reason_str,
+ *       wst=wifi_sta_connect_ms (start to IP), wsf=wifi_sta_fast (cached AP used),
+ *       boot=boot milestones (ms)
+ */
+static int ws_build_info(char *json, size_t size)
 {
-    if (status == NULL) return;
-
-    memcpy(&current_status, status, sizeof(web_status_t));
-
-    if (ws_fd < 0 || server == NULL) return;
-
-    // Build JSON status
-    // Main: t=throttle, s=steering, x1-x4=aux channels, e=esc, a1-a4=axle servos, m=mode
-    // Status: ui=ui_override, sl=signal_lost, cd=calibrated, cg=calibrating, cp=cal_progress
-    // Info: u=uptime_ms, v=version, b=build
-    // Monitor: rc=raw_pulses[6], h=heap_free, hm=heap_min, rs=rssi
-    // WiFi: wse=wifi_sta_enabled, wsc=wifi_sta_connected, wss=wifi_sta_ssid, wsi=wifi_sta_ip
-    //       wsr=wifi_sta_reason (disconnect reason code), wsrs=wifi_sta_reason_str
-
-    char json[896];
-    int len = snprintf(json, sizeof(json),
-        "{\"t\":%d,\"s\":%d,\"x1\":%d,\"x2\":%d,\"x3\":%d,\"x4\":%d,\"e\":%u,"
-        "\"a1\":%u,\"a2\":%u,\"a3\":%u,\"a4\":%u,"
-        "\"m\":%u,\"ui\":%s,\"sl\":%s,\"cd\":%s,\"cg\":%s,\"cp\":%u,"
-        "\"u\":%lu,\"v\":\"%s\",\"b\":\"%s\","
-        "\"rc\":[%u,%u,%u,%u,%u,%u],\"h\":%lu,\"hm\":%lu,\"rs\":%d,"
-        "\"wse\":%s,\"wsc\":%s,\"wss\":\"%s\",\"wsi\":\"%s\",\"wsr\":%u,\"wsrs\":\"%s\"}",
-        status->rc_throttle,
-        status->rc_steering,
-        status->rc_aux1,
-        status->rc_aux2,
-        status->rc_aux3,
-        status->rc_aux4,
-        status->esc_pulse,
-        status->servo_a1,
-        status->servo_a2,
-        status->servo_a3,
-        status->servo_a4,
-        status->steering_mode,
-        ui_mode_override ? "true" : "false",
-        status->signal_lost ? "true" : "false",
-        status->calibrated ? "true" : "false",
-        status->calibrating ? "true" : "false",
-        status->cal_progress,
-        (unsigned long)status->uptime_ms,
+    int len = snprintf(json, size,
+        "{\"type\":\"info\",\"fv\":%d,\"v\":\"%s\",\"b\":\"%s\","
+        "\"wse\":%s,\"wsc\":%s,\"wss\":\"%s\",\"wsi\":\"%s\",\"wsr\":%u,\"wsrs\":\"%s\","
+        "\"wst\":%lu,\"wsf\":%s,\"boot\":",
+        WS_STATUS_FRAME_VERSION,
         FW_VERSION,
         FW_BUILD_DATE,
-        status->rc_raw[0], status->rc_raw[1], status->rc_raw[2], status->rc_raw[3], status->rc_raw[4], status->rc_raw[5],
-        (unsigned long)status->heap_free,
-        (unsigned long)status->heap_min,
-        status->wifi_rssi,
         sta_config.enabled ? "true" : "false",
         sta_connected ? "true" : "false",
         sta_config.ssid,
         sta_ip_addr_str,
         sta_disconnect_reason,
-        sta_disconnect_reason ? wifi_disconnect_reason_str(sta_disconnect_reason) : ""
+        sta_disconnect_reason ? wifi_disconnect_reason_str(sta_disconnect_reason) : "",
+        (unsigned long)(sta_connected ? sta_connect_ms : 0),
+        sta_fast_used ? "true" : "false"
     );
 
-    httpd_ws_frame_t ws_pkt = {
-        .final = true,
-        .fragmented = false,
-        .type = HTTPD_WS_TYPE_TEXT,
-        .payload = (uint8_t*)json,
-        .len = len
+    // Boot milestones (ms), so the first frame a client gets shows startup
+    // time; left empty rather than truncated if a long SSID leaves no room
+    char boot[192];
+    int boot_len = perf_boot_to_json(boot, sizeof(boot));
+    if (len + boot_len + 2 > (int)size) {
+        boot_len = snprintf(boot, sizeof(boot), "{}");
+    }
+    if (len < (int)size) {
+        len += snprintf(json + len, size - len, "%.*s}", boot_len, boot);
+    }
+    return len < (int)size ? len : (int)size - 1;
+}
+
+/**
+ * @brief Fill one status group from the current state
+ *
+ * The slow groups are only filled when due, which keeps the perf queries
+ * off the fast path.
+ */
+static void ws_fill_group(ws_group_t g, ws_status_groups_t *cur, const web_status_t *status)
+{
+    switch (g) {
+        case WS_GROUP_INPUT:
+            cur->input = (ws_group_input_t){
+                .rc = {
+                    status->rc_throttle, status->rc_steering,
+                    status->rc_aux1, status->rc_aux2, status->rc_aux3, status->rc_aux4
+                },
+            };
+            memcpy(cur->input.rc_raw, status->rc_raw, sizeof(cur->input.rc_raw));
+            break;
+
+        case WS_GROUP_OUTPUT:
+            cur->output = (ws_group_output_t){
+                .esc_pulse = status->esc_pulse,
+            };
+            memcpy(cur->output.servo, status->servo, sizeof(cur->output.servo));
+            break;
+
+        case WS_GROUP_STATE:
+            cur->state = (ws_group_state_t){
+                .flags = (ui_mode_override ? WS_FLAG_UI_OVERRIDE : 0) |
+                         (status->signal_lost ? WS_FLAG_SIGNAL_LOST : 0) |
+                         (status->calibrated ? WS_FLAG_CALIBRATED : 0) |
+                         (status->calibrating ? WS_FLAG_CALIBRATING : 0),
+                .steering_mode = status->steering_mode,
+                .cal_progress = status->cal_progress,
+            };
+            break;
+
+        case WS_GROUP_SYSTEM:
+            cur->system = (ws_group_system_t){
+                .uptime_ms = status->uptime_ms,
+                .heap_free = status->heap_free,
+                .heap_min = status->heap_min,
+                .rssi = status->wifi_rssi,
+            };
+            break;
+
+        case WS_GROUP_PERF: {
+            ws_group_perf_t *p = &cur->perf;
+            perf_summary_t lat;
+            perf_get_summary(PERF_LAT_EDGE_TO_OUTPUT, &lat);
+            p->lat[0] = lat.avg_us;
+            p->lat[1] = lat.p99_us;
+            p->lat[2] = lat.max_us;
+            p->overruns[0] = perf_get_overruns(PERF_LOOP_CONTROL);
+            p->overruns[1] = perf_get_overruns(PERF_LOOP_HOUSEKEEPING);
+            p->shed_level = (uint8_t)perf_get_shed_level();
+            p->shed_events = perf_get_shed_events();
+            p->deadline_misses = perf_get_deadline_misses();
+
+            for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+                perf_stage_summary_t st;
+                perf_get_stage((perf_stage_t)i, &st);
+                p->prof[i][0] = st.min_us;
+                p->prof[i][1] = st.avg_us;
+                p->prof[i][2] = st.max_us;
+            }
+
+            audio_mixer_stats_t audio;
+            audio_mixer_get_stats(&audio);
+            p->underruns = audio.underruns;
+            p->dma_fill = audio.dma_fill;
+            p->dma_fill_min = audio.dma_fill_min;
+            p->load_pct = audio.load_pct;
+            p->load_max_pct = audio.load_max_pct;
+            break;
+        }
+
+        case WS_GROUP_BATTERY: {
+            battery_status_t bat;
+            battery_get_status(&bat);
+            cur->battery = (ws_group_battery_t){
+                .pack_mv = bat.pack_mv,
+                .cell_mv = bat.cell_mv,
+                .current_ma = bat.current_ma,
+                .used_mah = (uint16_t)(bat.used_mah > UINT16_MAX ? UINT16_MAX : bat.used_mah),
+                .level = (uint8_t)bat.level,
+                .cells = bat.cells,
+                .sag_gain_pct = (uint8_t)bat.sag_gain_pct,
+                .flags = (bat.present ? WS_BATTERY_PRESENT : 0) |
+                         (bat.current_present ? WS_BATTERY_CURRENT : 0),
+            };
+            break;
+        }
+
+        case WS_GROUP_VEHICLE:
+            cur->vehicle = (ws_group_vehicle_t){
+                .rpm = status->engine_rpm,
+                .velocity = status->velocity,
+                .gear = status->gear,
+            };
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Build a status update without sending it (timed by /api/bench)
+ *
+ * Info JSON plus a keyframe of every group from the last status, i.e. the
+ * work web_server_update_status() does for a new client.
+ */
+static void ws_bench_status(void *arg)
+{
+    static char json[WS_MSG_MAX_LEN];
+    static uint8_t frame[WS_MSG_MAX_LEN];
+    static ws_status_groups_t cur;
+
+    ws_build_info(json, sizeof(json));
+
+    ws_frame_header_t hdr = {
+        .version = WS_STATUS_FRAME_VERSION,
+        .flags = WS_FRAME_KEYFRAME,
+        .stage_count = PERF_STAGE_COUNT,
+        .axle_count = SERVO_COUNT,
     };
+    size_t len = sizeof(hdr);
+    for (int g = 0; g < WS_GROUP_COUNT; g++) {
+        ws_fill_group((ws_group_t)g, &cur, &current_status);
+        memcpy(frame + len, (const uint8_t *)&cur + ws_groups[g].offset, ws_groups[g].size);
+        len += ws_groups[g].size;
+        hdr.groups |= 1 << g;
+    }
+    memcpy(frame, &hdr, sizeof(hdr));
+}
 
-    esp_err_t ret = httpd_ws_send_frame_async(server, ws_fd, &ws_pkt);
-    if (ret != ESP_OK) {
-        // Client disconnected - clear the socket fd so we stop trying
-        ws_fd = -1;
+/**
+ * @brief Queue batches of captured control ticks for the clients that asked
+ *
+ * Sends once a full batch is waiting or WEB_CAPTURE_FLUSH_MS after the last
+ * send, so slow loop rates still plot smoothly.
+ */
+static void ws_send_capture(uint32_t now)
+{
+    static uint32_t last_flush_ms = 0;
+
+    if (!capture_is_enabled()) {
+        capture_discard();      // Left over from the last capture
+        return;
+    }
+    size_t avail = capture_available();
+    if (avail == 0 || (avail < WEB_CAPTURE_BATCH && (now - last_flush_ms) < WEB_CAPTURE_FLUSH_MS)) {
+        return;
+    }
+    last_flush_ms = now;
+
+    uint8_t frame[WS_MSG_MAX_LEN];
+    capture_sample_t *samples = (capture_sample_t *)(frame + sizeof(ws_capture_header_t));
+    for (int f = 0; f < WEB_CAPTURE_MAX_FRAMES; f++) {
+        size_t n = capture_read(samples, WEB_CAPTURE_BATCH);
+        if (n == 0) break;
+
+        ws_capture_header_t hdr = {
+            .type = WS_CAPTURE_FRAME_TYPE,
+            .count = (uint8_t)n,
+            .rate_hz = tuning_get_config()->control.loop_rate_hz,
+            .dropped = capture_get_dropped(),
+        };
+        memcpy(frame, &hdr, sizeof(hdr));
+        size_t len = sizeof(hdr) + n * sizeof(capture_sample_t);
+
+        xSemaphoreTake(ws_mutex, portMAX_DELAY);
+        for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+            if (ws_clients[i].fd >= 0 && (ws_clients[i].capture || ws_stress)) {
+                ws_enqueue_locked(&ws_clients[i], HTTPD_WS_TYPE_BINARY, frame, len);
+            }
+        }
+        xSemaphoreGive(ws_mutex);
+    }
+    ws_schedule_drain();
+}
+
+void web_server_update_status(const web_status_t *status)
+{
+    if (status == NULL) return;
+
+    memcpy(&current_status, status, sizeof(web_status_t));
+
+    if (server == NULL || ws_client_count == 0) return;
+
+    // Static info first, for clients that are new or missed a change.
+    // New clients also need a keyframe before deltas mean anything.
+    bool info_changed = ws_info_pending;
+    ws_info_pending = false;
+    bool new_client = false;
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        new_client |= ws_clients[i].fd >= 0 && ws_clients[i].info_pending;
+    }
+    if (info_changed || new_client) {
+        char json[WS_MSG_MAX_LEN];
+        int len = ws_build_info(json, sizeof(json));
+        xSemaphoreTake(ws_mutex, portMAX_DELAY);
+        for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+            ws_client_t *c = &ws_clients[i];
+            if (c->fd >= 0 && (c->info_pending || info_changed)) {
+                ws_enqueue_locked(c, HTTPD_WS_TYPE_TEXT, json, len);
+                c->info_pending = false;
+            }
+        }
+        xSemaphoreGive(ws_mutex);
+    }
+
+    // Periodic keyframes also repair deltas lost to full client queues
+    uint32_t now = status->uptime_ms;
+    ws_send_capture(now);
+    bool keyframe = new_client || ws_stress || (now - ws_keyframe_ms) >= WEB_STATUS_KEYFRAME_MS;
+    if (keyframe) {
+        ws_keyframe_ms = now;
+    }
+
+    static ws_status_groups_t cur;
+    uint8_t frame[WS_MSG_MAX_LEN];
+    ws_frame_header_t hdr = {
+        .version = WS_STATUS_FRAME_VERSION,
+        .flags = keyframe ? WS_FRAME_KEYFRAME : 0,
+        .stage_count = PERF_STAGE_COUNT,
+        .axle_count = SERVO_COUNT,
+    };
+    size_t len = sizeof(hdr);
+
+    for (int g = 0; g < WS_GROUP_COUNT; g++) {
+        if (!keyframe && (now - ws_group_checked_ms[g]) < ws_groups[g].period_ms) {
+            continue;
+        }
+        ws_group_checked_ms[g] = now;
+
+        ws_fill_group((ws_group_t)g, &cur, status);
+        const uint8_t *src = (const uint8_t *)&cur + ws_groups[g].offset;
+        uint8_t *sent = (uint8_t *)&ws_groups_sent + ws_groups[g].offset;
+        if (!keyframe && memcmp(src, sent, ws_groups[g].size) == 0) {
+            continue;
+        }
+        memcpy(sent, src, ws_groups[g].size);
+        memcpy(frame + len, src, ws_groups[g].size);
+        len += ws_groups[g].size;
+        hdr.groups |= 1 << g;
+    }
+
+    if (hdr.groups == 0) return;    // Nothing changed
+    memcpy(frame, &hdr, sizeof(hdr));
+
+    xSemaphoreTake(ws_mutex, portMAX_DELAY);
+    for (int i = 0; i < WS_MAX_CLIENTS; i++) {
+        if (ws_clients[i].fd >= 0) {
+            ws_enqueue_locked(&ws_clients[i], HTTPD_WS_TYPE_BINARY, frame, len);
+        }
     }
+    xSemaphoreGive(ws_mutex);
+    ws_schedule_drain();
 }
 
 const char* web_server_get_ip(void)
@@ -1572,6 +3164,7 @@ esp_err_t web_server_set_sta_config(bool enabled, const char *ssid, const char *
     // Reset retry counter when credentials change
     sta_retry_count = 0;
     sta_give_up = false;
+    ws_info_pending = true;
 
     // Apply changes
     if (need_restart) {
@@ -1613,6 +3206,21 @@ bool web_server_is_servo_test_active(void)
     return servo_test_active;
 }
 
+bool web_server_get_servo_jog(uint16_t pulses[SERVO_COUNT])
+{
+    if (!servo_test_active) {
+        return false;
+    }
+
+    uint32_t gen = __atomic_load_n(&jog_gen, __ATOMIC_ACQUIRE);
+    if (gen & 1) {
+        return false;       // Writer is mid-update (it may be preempted by us)
+    }
+    memcpy(pulses, jog_pulses, sizeof(jog_pulses));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&jog_gen, __ATOMIC_RELAXED) == gen;
+}
+
 void web_server_update_servo_test(void)
 {
     if (servo_test_active) {
@@ -1629,6 +3237,50 @@ bool web_server_wifi_is_enabled(void)
     return wifi_enabled;
 }
 
+/**
+ * @brief Undo wifi_init_dual() and start_webserver(), freeing their heap
+ *
+ * Sockets close first, while their netif is still up. The httpd and UDP
+ * log task stacks are freed by the idle task once those tasks exit.
+ */
+static void wifi_teardown(void)
+{
+    udp_log_resume = udp_log_deinit();
+
+    if (server != NULL) {
+        httpd_stop(server);
+        xSemaphoreTake(ws_mutex, portMAX_DELAY);
+        server = NULL;
+        xSemaphoreGive(ws_mutex);
+    }
+    ws_clients_clear();     // Their sockets closed with the server
+    // Jobs still queued went with the server
+    ws_drain_queued = false;
+    health_probe_queued = false;
+    health_unwatch(HEALTH_TASK_WEB);
+
+    mdns_free();
+
+    if (sta_connect_timer != NULL) {
+        esp_timer_stop(sta_connect_timer);
+        esp_timer_delete(sta_connect_timer);
+        sta_connect_timer = NULL;
+    }
+    esp_event_handler_instance_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID, wifi_event_instance);
+    esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP, ip_event_instance);
+    wifi_event_instance = NULL;
+    ip_event_instance = NULL;
+
+    esp_wifi_stop();
+    esp_wifi_deinit();
+    esp_netif_destroy_default_wifi(ap_netif);
+    esp_netif_destroy_default_wifi(sta_netif);
+    ap_netif = NULL;
+    sta_netif = NULL;
+
+    wifi_initialized = false;
+}
+
 void web_server_wifi_enable(void)
 {
     if (wifi_enabled) {
@@ -1636,20 +3288,27 @@ void web_server_wifi_enable(void)
     }
 
     ESP_LOGI(TAG, "Enabling WiFi...");
+    power_hold(POWER_LOCK_WIFI, true);
+    int64_t start_us = esp_timer_get_time();
 
     ESP_LOGI(TAG, "STA config: enabled=%d, ssid='%s'", sta_config.enabled, sta_config.ssid);
     if (!wifi_initialized) {
-        // First time - full initialization
+        // Full initialization (first time, or after a teardown)
         wifi_init_dual();
         start_webserver();
         wifi_initialized = true;
-    } else {
-        // Re-enable WiFi
-        esp_wifi_start();
+#if RC_INPUT_BACKEND == RC_BACKEND_ESPNOW
+        rc_espnow_start();
+#endif
+    }
+    if (udp_log_resume) {
+        udp_log_init();
+        udp_log_resume = false;
     }
 
     wifi_enabled = true;
-    ESP_LOGI(TAG, "WiFi enabled");
+    wifi_start_ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+    ESP_LOGI(TAG, "WiFi enabled in %lu ms", (unsigned long)wifi_start_ms);
 }
 
 void web_server_wifi_disable(void)
@@ -1658,43 +3317,45 @@ void web_server_wifi_disable(void)
         return;  // Already disabled
     }
 
+#if RC_INPUT_BACKEND == RC_BACKEND_ESPNOW
+    ESP_LOGW(TAG, "WiFi carries the ESP-NOW RC link - staying on");
+    return;
+#endif
+
     ESP_LOGI(TAG, "Disabling WiFi to save power...");
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
 
-    // Cancel any pending STA connection timer
-    if (sta_connect_timer != NULL) {
-        esp_timer_stop(sta_connect_timer);
+    // No more health probes for the server from here
+    if (ws_mutex != NULL) {
+        xSemaphoreTake(ws_mutex, portMAX_DELAY);
     }
-
-    // Stop WiFi completely (turns off radio)
-    esp_wifi_stop();
-
     wifi_enabled = false;
-    ws_fd = -1;  // WebSocket disconnected
-    sta_connected = false;
+    if (ws_mutex != NULL) {
+        xSemaphoreGive(ws_mutex);
+    }
 
-    ESP_LOGI(TAG, "WiFi disabled");
+    // Radio off and everything WiFi allocated freed
+    wifi_teardown();
+    sta_connected = false;
+    sta_ip_addr_str[0] = '\0';
+    power_hold(POWER_LOCK_WIFI, false);
+
+    // Let the idle task free the stacks of the tasks that just exited
+    vTaskDelay(pdMS_TO_TICKS(20));
+    size_t free_after = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    wifi_freed_bytes = free_after > free_before ? (uint32_t)(free_after - free_before) : 0;
+    ESP_LOGI(TAG, "WiFi disabled: %lu KB internal RAM freed (%lu KB free, largest block %lu KB)",
+             (unsigned long)(wifi_freed_bytes / 1024), (unsigned long)(free_after / 1024),
+             (unsigned long)(heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL) / 1024));
 }
 
 esp_err_t web_server_init_no_wifi(void)
 {
-    esp_err_t ret;
-
-    // Initialize SPIFFS for serving web files
-    esp_vfs_spiffs_conf_t conf = {
-        .base_path = "/web",
-        .partition_label = "storage",
-        .max_files = 5,
-        .format_if_mount_failed = false
-    };
-
-    ret = esp_vfs_spiffs_register(&conf);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to mount SPIFFS (%s)", esp_err_to_name(ret));
-        // Continue anyway - WiFi AP still works
-    }
+    // Map the web UI bundle (a missing one only disables the pages)
+    web_bundle_init();
 
     // Load WiFi STA configuration from NVS
-    ret = nvs_load_wifi_config(&sta_config);
+    esp_err_t ret = nvs_load_wifi_config(&sta_config);
     if (ret != ESP_OK) {
         nvs_get_default_wifi_config(&sta_config);
     }
@@ -22,6 +22,30 @@
 // mDNS hostname (accessible as 8x8-crawler.local)
 #define WIFI_MDNS_HOSTNAME  "8x8-crawler"
 
+// WebSocket telemetry rates: fast groups (sticks, outputs, state) are
+// checked every frame, slow ones (heap, uptime, perf) once per second, and
+// a full keyframe goes out periodically. Groups are only sent when changed.
+#define WEB_STATUS_PERIOD_MS        20      // 50Hz
+#define WEB_STATUS_SLOW_PERIOD_MS   1000
+#define WEB_STATUS_KEYFRAME_MS      5000
+
+// Capture mode (live graph): every control tick is batched into frames of
+// WEB_CAPTURE_BATCH samples, flushed at least every WEB_CAPTURE_FLUSH_MS,
+// at most WEB_CAPTURE_MAX_FRAMES per status tick (1600 samples/s at 50Hz)
+#define WEB_CAPTURE_BATCH           16
+#define WEB_CAPTURE_FLUSH_MS        100
+#define WEB_CAPTURE_MAX_FRAMES      2
+
+// Servo jog (test mode over WebSocket): the page resends its positions at
+// least every WEB_JOG_HEARTBEAT_MS; if the stream stops for WEB_JOG_TIMEOUT_MS
+// the servos go back to RC control. HTTP-only use keeps the 30 s timeout.
+#define WEB_JOG_HEARTBEAT_MS        250
+#define WEB_JOG_TIMEOUT_MS          1000
+
+// Flight recorder download (/api/trace) is sent straight from the ring in
+// chunks of this size
+#define WEB_TRACE_CHUNK_BYTES       4096
+
 /**
  * @brief Status data structure sent to web clients
  */
@@ -39,10 +63,12 @@ typedef struct {
 
     // Output values
     uint16_t esc_pulse;
-    uint16_t servo_a1;   // Axle 1 (front)
-    uint16_t servo_a2;   // Axle 2
-    uint16_t servo_a3;   // Axle 3
-    uint16_t servo_a4;   // Axle 4 (rear)
+    uint16_t servo[SERVO_COUNT];  // Axle 1 (front) to SERVO_COUNT (rear)
+
+    // Vehicle model
+    uint16_t engine_rpm;
+    int16_t velocity;
+    uint8_t gear;
 
     // System status
     uint8_t steering_mode;
@@ -123,12 +149,31 @@ void web_server_get_sta_config(crawler_wifi_config_t *config);
  */
 bool web_server_is_servo_test_active(void);
 
+/**
+ * @brief Get the servo test positions for this control tick
+ *
+ * Never blocks: if the web UI is mid-update the call fails and the servos
+ * simply hold their previous pulse for one tick.
+ * @param pulses Filled with one pulse width (us) per servo
+ * @return true if pulses was filled (servo test mode active)
+ */
+bool web_server_get_servo_jog(uint16_t pulses[SERVO_COUNT]);
+
 /**
  * @brief Update servo test timeout (call from main loop)
  * Automatically disables test mode after timeout
  */
 void web_server_update_servo_test(void);
 
+/**
+ * @brief Push the heaviest WebSocket traffic to every client (stress test)
+ *
+ * Every status update becomes a keyframe and every client gets the
+ * per-tick capture stream, whether or not it asked for it.
+ * @param on true to start, false to return to normal traffic
+ */
+void web_server_set_ws_stress(bool on);
+
 /**
  * @brief Enable WiFi (AP + optional STA)
  * Called when AUX3 button is held for 5 seconds
@@ -136,8 +181,12 @@ void web_server_update_servo_test(void);
 void web_server_wifi_enable(void);
 
 /**
- * @brief Disable WiFi completely (saves power)
+ * @brief Disable WiFi completely (saves power and heap)
  * Called when AUX3 button is held for 5 seconds while WiFi is on
+ *
+ * Stops the web server, mDNS and UDP logging and deinitializes the WiFi
+ * driver and its netifs, logging the internal RAM this frees. The next
+ * web_server_wifi_enable() sets them all up again.
  */
 void web_server_wifi_disable(void);
 
@@ -147,6 +196,14 @@ void web_server_wifi_disable(void);
  */
 bool web_server_wifi_is_enabled(void);
 
+/**
+ * @brief Queue a job to the httpd task that beats HEALTH_TASK_WEB
+ *
+ * Called by the health monitor; does nothing before the server starts or
+ * while the previous probe is still queued.
+ */
+void web_server_health_probe(void);
+
 /**
  * @brief Initialize web server without starting WiFi
  * WiFi will be started later via web_server_wifi_enable()
@@ -0,0 +1,123 @@
+/**
+ * @file ws2812.c
+ * @brief RMT encoder for WS2812 addressable LEDs
+ */
+
+#include "ws2812.h"
+#include "esp_attr.h"
+#include <stdlib.h>
+
+// WS2812 timing (in RMT ticks at 10MHz resolution)
+#define WS2812_T0H_TICKS    3   // 0.3us
+#define WS2812_T0L_TICKS    9   // 0.9us
+#define WS2812_T1H_TICKS    9   // 0.9us
+#define WS2812_T1L_TICKS    3   // 0.3us
+#define WS2812_RESET_TICKS  500 // 50us reset
+
+// WS2812 encoder
+typedef struct {
+    rmt_encoder_t base;
+    rmt_encoder_t *bytes_encoder;
+    rmt_encoder_t *copy_encoder;
+    int state;
+    rmt_symbol_word_t reset_code;
+} ws2812_encoder_t;
+
+// Encoder callbacks (encode runs from the RMT ISR, hence IRAM)
+static size_t IRAM_ATTR ws2812_encode(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
+                                      const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
+{
+    ws2812_encoder_t *ws2812_encoder = __containerof(encoder, ws2812_encoder_t, base);
+    rmt_encoder_handle_t bytes_encoder = ws2812_encoder->bytes_encoder;
+    rmt_encoder_handle_t copy_encoder = ws2812_encoder->copy_encoder;
+    rmt_encode_state_t session_state = RMT_ENCODING_RESET;
+    size_t encoded_symbols = 0;
+
+    switch (ws2812_encoder->state) {
+        case 0: // Send RGB data
+            encoded_symbols += bytes_encoder->encode(bytes_encoder, channel, primary_data, data_size, &session_state);
+            if (session_state & RMT_ENCODING_COMPLETE) {
+                ws2812_encoder->state = 1;
+            }
+            if (session_state & RMT_ENCODING_MEM_FULL) {
+                *ret_state = (rmt_encode_state_t)(session_state & (~RMT_ENCODING_COMPLETE));
+                return encoded_symbols;
+            }
+            // Fall through
+        case 1: // Send reset code
+            encoded_symbols += copy_encoder->encode(copy_encoder, channel, &ws2812_encoder->reset_code,
+                                                     sizeof(ws2812_encoder->reset_code), &session_state);
+            if (session_state & RMT_ENCODING_COMPLETE) {
+                ws2812_encoder->state = RMT_ENCODING_RESET;
+                *ret_state = RMT_ENCODING_COMPLETE;
+            }
+            if (session_state & RMT_ENCODING_MEM_FULL) {
+                *ret_state = (rmt_encode_state_t)(session_state & (~RMT_ENCODING_COMPLETE));
+            }
+            break;
+    }
+    return encoded_symbols;
+}
+
+static esp_err_t ws2812_encoder_reset(rmt_encoder_t *encoder)
+{
+    ws2812_encoder_t *ws2812_encoder = __containerof(encoder, ws2812_encoder_t, base);
+    rmt_encoder_reset(ws2812_encoder->bytes_encoder);
+    rmt_encoder_reset(ws2812_encoder->copy_encoder);
+    ws2812_encoder->state = RMT_ENCODING_RESET;
+    return ESP_OK;
+}
+
+static esp_err_t ws2812_encoder_del(rmt_encoder_t *encoder)
+{
+    ws2812_encoder_t *ws2812_encoder = __containerof(encoder, ws2812_encoder_t, base);
+    rmt_del_encoder(ws2812_encoder->bytes_encoder);
+    rmt_del_encoder(ws2812_encoder->copy_encoder);
+    free(ws2812_encoder);
+    return ESP_OK;
+}
+
+esp_err_t ws2812_new_encoder(rmt_encoder_handle_t *ret_encoder)
+{
+    ws2812_encoder_t *ws2812_encoder = calloc(1, sizeof(ws2812_encoder_t));
+    if (!ws2812_encoder) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ws2812_encoder->base.encode = ws2812_encode;
+    ws2812_encoder->base.reset = ws2812_encoder_reset;
+    ws2812_encoder->base.del = ws2812_encoder_del;
+
+    // Create bytes encoder for the LED data
+    rmt_bytes_encoder_config_t bytes_encoder_config = {
+        .bit0 = {
+            .level0 = 1,
+            .duration0 = WS2812_T0H_TICKS,
+            .level1 = 0,
+            .duration1 = WS2812_T0L_TICKS,
+        },
+        .bit1 = {
+            .level0 = 1,
+            .duration0 = WS2812_T1H_TICKS,
+            .level1 = 0,
+            .duration1 = WS2812_T1L_TICKS,
+        },
+        .flags.msb_first = true,
+    };
+    ESP_ERROR_CHECK(rmt_new_bytes_encoder(&bytes_encoder_config, &ws2812_encoder->bytes_encoder));
+
+    // Create copy encoder for the reset code
+    rmt_copy_encoder_config_t copy_encoder_config = {};
+    ESP_ERROR_CHECK(rmt_new_copy_encoder(&copy_encoder_config, &ws2812_encoder->copy_encoder));
+
+    // Reset code
+    ws2812_encoder->reset_code = (rmt_symbol_word_t){
+        .level0 = 0,
+        .duration0 = WS2812_RESET_TICKS,
+        .level1 = 0,
+        .duration1 = WS2812_RESET_TICKS,
+    };
+
+    *ret_encoder = &ws2812_encoder->base;
+    return ESP_OK;
+}
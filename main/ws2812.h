@@ -0,0 +1,24 @@
+/**
+ * @file ws2812.h
+ * @brief RMT encoder for WS2812 addressable LEDs
+ *
+ * Shared by the onboard status LED and the light strip.
+ */
+
+#ifndef WS2812_H
+#define WS2812_H
+
+#include "driver/rmt_tx.h"
+#include "esp_err.h"
+
+// RMT channel resolution the encoder's bit timings are expressed in
+#define WS2812_RESOLUTION_HZ    10000000    // 10MHz = 0.1us resolution
+
+/**
+ * @brief Create an encoder that sends GRB bytes followed by a reset code
+ * @param ret_encoder Receives the encoder handle
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if allocation fails
+ */
+esp_err_t ws2812_new_encoder(rmt_encoder_handle_t *ret_encoder);
+
+#endif // WS2812_H
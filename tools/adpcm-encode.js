@@ -0,0 +1,115 @@
+#!/usr/bin/env node
+/**
+ * IMA-ADPCM encoder for 8x8 Crawler sound headers
+ *
+ * Converts a generated 8-bit sample header (const signed char xxxSamples[])
+ * into the block format decoded by main/adpcm.c, keeping the symbol names
+ * and the rate/count/loop constants. The samples array becomes
+ * const unsigned char; reference it from the sound tables with the
+ * IMA-ADPCM format flag.
+ *
+ * Usage:
+ *   node tools/adpcm-encode.js <input.h> <output.h>
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+const BLOCK_SAMPLES = 256;   // Must match ADPCM_BLOCK_SAMPLES
+
+const STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+];
+const INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8];
+
+function clamp(v, lo, hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+/**
+ * Encode one sample; the state tracks the decoder exactly
+ */
+function encodeSample(state, target) {
+    const step = STEP_TABLE[state.index];
+    let diff = target - state.predictor;
+    let code = 0;
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step) { code |= 4; diff -= step; }
+    if (diff >= step >> 1) { code |= 2; diff -= step >> 1; }
+    if (diff >= step >> 2) { code |= 1; }
+
+    // Reconstruct exactly like adpcm_decode()
+    let delta = step >> 3;
+    if (code & 4) delta += step;
+    if (code & 2) delta += step >> 1;
+    if (code & 1) delta += step >> 2;
+    state.predictor = clamp(state.predictor + ((code & 8) ? -delta : delta), -32768, 32767);
+    state.index = clamp(state.index + INDEX_TABLE[code & 7], 0, 88);
+    return code;
+}
+
+function encode(samples) {
+    const out = [];
+    const state = { predictor: samples.length ? samples[0] << 8 : 0, index: 0 };
+
+    for (let start = 0; start < samples.length; start += BLOCK_SAMPLES) {
+        const end = Math.min(start + BLOCK_SAMPLES, samples.length);
+        out.push(state.predictor & 0xFF, (state.predictor >> 8) & 0xFF, state.index, 0);
+
+        for (let i = start; i < end; i += 2) {
+            const lo = encodeSample(state, samples[i] << 8);
+            const hi = (i + 1 < end) ? encodeSample(state, samples[i + 1] << 8) : 0;
+            out.push(lo | (hi << 4));
+        }
+    }
+    return out;
+}
+
+function main() {
+    const [input, output] = process.argv.slice(2);
+    if (!input || !output) {
+        console.error('Usage: node tools/adpcm-encode.js <input.h> <output.h>');
+        process.exit(1);
+    }
+
+    const src = fs.readFileSync(input, 'utf8');
+    const array = src.match(/const\s+signed\s+char\s+(\w+)\[\]\s*=\s*\{([\s\S]*?)\};/);
+    if (!array) {
+        console.error(`${input}: no "const signed char xxx[] = {...}" array found`);
+        process.exit(1);
+    }
+
+    // Strip //comments (some generators number the rows)
+    const body = array[2].replace(/\/\/.*$/gm, '');
+    const samples = body.split(',').map(s => s.trim()).filter(s => s.length).map(Number);
+    if (samples.some(Number.isNaN)) {
+        console.error(`${input}: could not parse sample values`);
+        process.exit(1);
+    }
+
+    const constants = src.match(/^const\s+unsigned\s+int\s+\w+\s*=\s*\d+\s*;/gm) || [];
+    const data = encode(samples);
+
+    let text = `// IMA-ADPCM (main/adpcm.h block format), ${samples.length} samples\n`;
+    text += `// Generated by tools/adpcm-encode.js from ${path.basename(input)}\n`;
+    text += constants.join('\n') + '\n';
+    text += `const unsigned char ${array[1]}[] = {\n`;
+    for (let i = 0; i < data.length; i += 16) {
+        text += data.slice(i, i + 16).join(', ') + ',\n';
+    }
+    text += '};\n';
+
+    fs.writeFileSync(output, text);
+    console.log(`${path.basename(input)}: ${samples.length} -> ${data.length} bytes ` +
+                `(${(100 * data.length / samples.length).toFixed(0)}%)`);
+}
+
+main();
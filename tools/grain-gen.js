@@ -0,0 +1,117 @@
+#!/usr/bin/env node
+/**
+ * Firing grain generator for the granular engine synth
+ *
+ * Renders a few single-firing pulses (a sharp combustion transient into
+ * damped exhaust/block resonances plus a short noise burst) and writes
+ * them as one 8-bit grain table header for sound_profiles.c. Each grain
+ * gets slightly different resonances so consecutive cylinders differ.
+ *
+ * Usage:
+ *   node tools/grain-gen.js <prefix> <output.h> [options]
+ *
+ * Options (defaults suit a large diesel V8):
+ *   --grains N       grains in the table (4)
+ *   --length N       samples per grain (384)
+ *   --rate HZ        sample rate (22050)
+ *   --body HZ        main exhaust resonance (95)
+ *   --decay MS       body resonance decay time constant (9)
+ *   --noise PCT      combustion noise level (35)
+ *   --seed N         random seed (1)
+ */
+
+const fs = require('fs');
+const path = require('path');
+
+function parseArgs(argv) {
+    const opts = { grains: 4, length: 384, rate: 22050, body: 95, decay: 9, noise: 35, seed: 1 };
+    for (let i = 0; i < argv.length; i += 2) {
+        const key = argv[i].replace(/^--/, '');
+        if (!(key in opts)) throw new Error(`Unknown option ${argv[i]}`);
+        opts[key] = Number(argv[i + 1]);
+    }
+    return opts;
+}
+
+function rng(seed) {
+    let s = seed >>> 0 || 1;
+    return () => {
+        s ^= s << 13; s >>>= 0;
+        s ^= s >>> 17;
+        s ^= s << 5; s >>>= 0;
+        return s / 0x100000000;
+    };
+}
+
+/**
+ * One firing pulse, normalised to +-1
+ */
+function renderGrain(opts, random) {
+    const n = opts.length;
+    const out = new Float64Array(n);
+    const detune = 1 + (random() - 0.5) * 0.12;
+
+    // Resonances: exhaust body, its second mode, block ring
+    const modes = [
+        { f: opts.body * detune, a: 1.0, tau: opts.decay / 1000 },
+        { f: opts.body * 2.3 * detune, a: 0.45, tau: opts.decay / 1600 },
+        { f: 720 * (1 + (random() - 0.5) * 0.2), a: 0.25, tau: 0.0025 },
+    ];
+
+    let lp = 0;
+    for (let i = 0; i < n; i++) {
+        const t = i / opts.rate;
+        let v = 0;
+        for (const m of modes) {
+            v += m.a * Math.exp(-t / m.tau) * Math.sin(2 * Math.PI * m.f * t);
+        }
+        // Low-passed noise burst for the combustion crack
+        lp += 0.35 * ((random() * 2 - 1) - lp);
+        v += (opts.noise / 100) * lp * Math.exp(-t / 0.003);
+        out[i] = v;
+    }
+
+    // Attack ramp and fade to zero so grains overlap without clicks
+    const attack = Math.round(opts.rate * 0.0006);
+    const release = Math.round(n / 4);
+    for (let i = 0; i < attack; i++) out[i] *= i / attack;
+    for (let i = 0; i < release; i++) out[n - 1 - i] *= i / release;
+
+    const peak = out.reduce((p, v) => Math.max(p, Math.abs(v)), 1e-9);
+    return out.map(v => v / peak);
+}
+
+function main() {
+    const [prefix, output, ...rest] = process.argv.slice(2);
+    if (!prefix || !output) {
+        console.error('Usage: node tools/grain-gen.js <prefix> <output.h> [options]');
+        process.exit(1);
+    }
+    const opts = parseArgs(rest);
+    const random = rng(opts.seed);
+
+    const samples = [];
+    for (let g = 0; g < opts.grains; g++) {
+        for (const v of renderGrain(opts, random)) {
+            samples.push(Math.max(-127, Math.min(127, Math.round(v * 120))));
+        }
+    }
+
+    const args = rest.length ? ' ' + rest.join(' ') : '';
+    let text = `// Firing grains for the granular engine synth\n`;
+    text += `// Generated by tools/grain-gen.js ${prefix} ${path.basename(output)}${args}\n`;
+    text += `const unsigned int ${prefix}GrainRate = ${opts.rate};\n`;
+    text += `const unsigned int ${prefix}GrainLength = ${opts.length};\n`;
+    text += `const unsigned int ${prefix}GrainCount = ${opts.grains};\n`;
+    text += `const signed char ${prefix}Grains[] = {\n`;
+    for (let i = 0; i < samples.length; i += 16) {
+        text += samples.slice(i, i + 16).join(', ') + ',\n';
+    }
+    text += '};\n';
+
+    fs.writeFileSync(output, text);
+    console.log(`${path.basename(output)}: ${opts.grains} x ${opts.length} samples ` +
+                `(${samples.length} bytes)`);
+}
+
+main();
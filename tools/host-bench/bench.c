@@ -0,0 +1,465 @@
+/**
+ * @file bench.c
+ * @brief Host microbenchmarks for the control path and table comparison
+ *
+ * Builds main/tuning.c, steering_geometry.c, rc_input.c, pwm_output.c and
+ * mode_switch.c unchanged against the shims and reports:
+ *   - the compiled tables against the reference functions, for a set of
+ *     tuning configs (inputs that differ and the largest difference)
+ *   - ns per call of each stage and of a whole control tick, table and
+ *     reference pipelines side by side
+ *   - the mode changes the button state machine makes for press sequences,
+ *     checked against the expected mode and long press
+ *
+ * Usage: control-bench [-n iterations] [-v]
+ * Exits 1 if a table differs from its reference by more than the rounding
+ * allowance (TABLE_TOLERANCE_US) or a press sequence ends in the wrong
+ * state; CTest runs it as host_bench.
+ */
+
+#include "host.h"
+#include "config.h"
+#include "tuning.h"
+#include "steering_geometry.h"
+#include "rc_input.h"
+#include "pwm_output.h"
+#include "mode_switch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_ITERATIONS  200000
+#define TABLE_TOLERANCE_US  2       // Rounding (tuning.h), doubled once the sag gain scales it
+#define TICK_US             10000   // Virtual time per pipeline tick (100Hz)
+
+static volatile int32_t sink;       // Keeps the timed calls from being optimized out
+static calibration_data_t calibration;
+
+// ============================================================================
+// Reference pipeline
+// ============================================================================
+
+/**
+ * @brief Reference axle position: the mode's axle mix or the geometry curve
+ */
+static int16_t ref_position(steering_mode_t mode, uint8_t axle, int16_t steer)
+{
+    const steering_tuning_t *steering = &tuning_get_config()->steering;
+    if (steering->geometry_enabled && steering_geometry_valid(steering)) {
+        return steering_geometry_position(steering, mode, axle, steer);
+    }
+    int32_t sign = steering_geometry_axle_sign(mode, axle);
+    int32_t gain = (mode == STEER_MODE_CRAB) ? sign * 100 : sign * tuning_get_axle_ratio(axle, mode);
+    return (int16_t)((steer * gain) / 100);
+}
+
+static void ref_servo_pulses(steering_mode_t mode, int16_t steer, uint16_t pulse[SERVO_COUNT])
+{
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        pulse[i] = tuning_calc_servo_pulse(i, ref_position(mode, i, steer));
+    }
+}
+
+static void lut_servo_pulses(steering_mode_t mode, int16_t steer, uint16_t pulse[SERVO_COUNT])
+{
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        pulse[i] = tuning_lut_servo_pulse(mode, i, steer);
+    }
+}
+
+// ============================================================================
+// Table comparison
+// ============================================================================
+
+typedef struct {
+    const char *name;
+    void (*apply)(tuning_config_t *config);
+    int32_t supply_gain_q16;
+} bench_config_t;
+
+static void cfg_defaults(tuning_config_t *c) { (void)c; }
+
+static void cfg_expo(tuning_config_t *c)
+{
+    c->steering.expo = 70;
+    c->steering.speed_steering = 50;
+}
+
+static void cfg_trims(tuning_config_t *c)
+{
+    static const int16_t subtrim[AXLE_COUNT_MAX] = { 30, -45, 12, -7, 22 };
+    static const int16_t trim[AXLE_COUNT_MAX] = { -20, 15, 0, 40, -33 };
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        c->servos[i].subtrim = subtrim[i];
+        c->servos[i].trim = trim[i];
+        c->servos[i].min_us = 1000 + i * 35;
+        c->servos[i].max_us = 2000 - i * 20;
+        c->servos[i].reversed = (i & 1) != 0;
+    }
+    c->steering.axle_ratio[1] = 73;
+    c->steering.axle_ratio[SERVO_COUNT - 1] = 41;
+    c->steering.all_axle_rear_ratio = 66;
+}
+
+static void cfg_geometry(tuning_config_t *c)
+{
+    c->steering.geometry_enabled = true;
+    c->steering.max_angle_deg = 35;
+}
+
+static void cfg_esc(tuning_config_t *c)
+{
+    c->esc.reversed = true;
+    c->esc.fwd_limit = 80;
+    c->esc.rev_limit = 45;
+    c->esc.deadzone = 40;
+    c->esc.subtrim = 25;
+}
+
+static const bench_config_t configs[] = {
+    { "defaults",       cfg_defaults, 1 << 16 },
+    { "expo+speed",     cfg_expo,     1 << 16 },
+    { "trims+reverse",  cfg_trims,    1 << 16 },
+    { "geometry",       cfg_geometry, 1 << 16 },
+    { "esc limits",     cfg_esc,      1 << 16 },
+    { "esc sag x1.2",   cfg_esc,      (1 << 16) * 6 / 5 },
+};
+
+typedef struct {
+    uint32_t inputs;
+    uint32_t differ;
+    int32_t worst;
+} diff_t;
+
+static void diff_add(diff_t *d, int32_t a, int32_t b)
+{
+    int32_t err = a - b;
+    if (err < 0) err = -err;
+    d->inputs++;
+    if (err) d->differ++;
+    if (err > d->worst) d->worst = err;
+}
+
+static void apply_config(const bench_config_t *bc)
+{
+    tuning_config_t config;
+    tuning_get_defaults(&config);
+    bc->apply(&config);
+    tuning_set_config(&config);
+    tuning_set_throttle_mode(THROTTLE_MODE_DIRECT);
+    tuning_set_supply_gain_q16(bc->supply_gain_q16);
+}
+
+/**
+ * @brief Compare every table against its reference for each config
+ * @return Largest difference seen (us or stick units)
+ */
+static int32_t compare_tables(void)
+{
+    int32_t worst = 0;
+
+    printf("Tables vs reference (differing inputs / largest difference)\n");
+    printf("  %-16s %-18s %-18s %-18s\n", "config", "expo", "servos", "esc");
+    for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+        apply_config(&configs[c]);
+        diff_t expo = {0}, servo = {0}, esc = {0};
+
+        for (int32_t x = -1000; x <= 1000; x++) {
+            diff_add(&expo, tuning_lut_expo(x), tuning_apply_expo(x));
+            for (int m = 0; m < STEER_MODE_COUNT; m++) {
+                uint16_t ref[SERVO_COUNT], lut[SERVO_COUNT];
+                ref_servo_pulses((steering_mode_t)m, x, ref);
+                lut_servo_pulses((steering_mode_t)m, x, lut);
+                for (int i = 0; i < SERVO_COUNT; i++) {
+                    diff_add(&servo, lut[i], ref[i]);
+                }
+            }
+            diff_add(&esc, tuning_lut_esc_pulse(x), tuning_calc_esc_pulse(x));
+        }
+
+        const diff_t *d[3] = { &expo, &servo, &esc };
+        printf("  %-16s", configs[c].name);
+        for (int i = 0; i < 3; i++) {
+            char cell[32];
+            if (d[i]->differ == 0) {
+                snprintf(cell, sizeof(cell), "bit-exact");
+            } else {
+                snprintf(cell, sizeof(cell), "%lu/%lu, %ld",
+                         (unsigned long)d[i]->differ, (unsigned long)d[i]->inputs, (long)d[i]->worst);
+            }
+            printf(" %-18s", cell);
+            if (d[i]->worst > worst) worst = d[i]->worst;
+        }
+        printf("\n");
+
+        // Cross-check with the firmware's own sweep
+        uint16_t fw = tuning_lut_max_error();
+        if (fw > worst) worst = fw;
+    }
+    tuning_set_supply_gain_q16(1 << 16);
+    return worst;
+}
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Stick input for iteration i: a sweep that visits most of the range
+ */
+static inline int16_t sweep(uint32_t i)
+{
+    return (int16_t)((int32_t)((i * 7919u) % 2001u) - 1000);
+}
+
+#define BENCH(label, iterations, body) do {                                 \
+        uint64_t start_ = now_ns();                                         \
+        for (uint32_t i = 0; i < (iterations); i++) {                       \
+            body;                                                           \
+        }                                                                   \
+        double ns_ = (double)(now_ns() - start_) / (iterations);            \
+        printf("  %-34s %8.1f ns\n", label, ns_);                           \
+    } while (0)
+
+/**
+ * @brief Publish one frame of sticks as the serial/PPM/ESP-NOW backends do
+ */
+static void publish_sticks(int16_t throttle, int16_t steering)
+{
+    uint16_t pulses[RC_CHANNEL_COUNT] = {
+        (uint16_t)(1500 + throttle / 2), (uint16_t)(1500 + steering / 2),
+        1000, 1000, 1000, 1000,
+    };
+    rc_input_publish_frame(pulses, RC_CHANNEL_COUNT);
+}
+
+/**
+ * @brief One control tick with the compiled tables (as control_process)
+ */
+static int32_t tick_tables(steering_mode_t mode)
+{
+    rc_frame_t frame;
+    rc_input_get_all_calibrated(&calibration, &frame);
+
+    output_frame_t out = { .update_esc = true, .update_servos = true };
+    out.esc_pulse = tuning_lut_esc_pulse(frame.ch[RC_CH_THROTTLE].value);
+    int16_t steer = tuning_lut_expo(frame.ch[RC_CH_STEERING].value);
+    steer = tuning_apply_speed_steering(steer, frame.ch[RC_CH_THROTTLE].value);
+    steer = tuning_apply_realistic_steering(steer);
+    lut_servo_pulses(mode, steer, out.servo_pulse);
+    pwm_output_commit(&out);
+    return out.esc_pulse + out.servo_pulse[0];
+}
+
+/**
+ * @brief One control tick with the reference functions
+ */
+static int32_t tick_reference(steering_mode_t mode)
+{
+    rc_frame_t frame;
+    rc_input_get_all_calibrated(&calibration, &frame);
+
+    output_frame_t out = { .update_esc = true, .update_servos = true };
+    out.esc_pulse = tuning_calc_esc_pulse(frame.ch[RC_CH_THROTTLE].value);
+    int16_t steer = tuning_apply_expo(frame.ch[RC_CH_STEERING].value);
+    steer = tuning_apply_speed_steering(steer, frame.ch[RC_CH_THROTTLE].value);
+    steer = tuning_apply_realistic_steering(steer);
+    ref_servo_pulses(mode, steer, out.servo_pulse);
+    pwm_output_commit(&out);
+    return out.esc_pulse + out.servo_pulse[0];
+}
+
+static void run_benchmarks(uint32_t n)
+{
+    apply_config(&configs[1]);      // Expo on, so the expo table isn't the linear shortcut
+
+    printf("\nStages (ns per call, %lu calls)\n", (unsigned long)n);
+    BENCH("tuning_apply_expo", n, sink += tuning_apply_expo(sweep(i)));
+    BENCH("tuning_lut_expo", n, sink += tuning_lut_expo(sweep(i)));
+    BENCH("servo pulses x4 (reference)", n, {
+        uint16_t p[SERVO_COUNT];
+        ref_servo_pulses(STEER_MODE_ALL_AXLE, sweep(i), p);
+        sink += p[3];
+    });
+    BENCH("servo pulses x4 (tables)", n, {
+        uint16_t p[SERVO_COUNT];
+        lut_servo_pulses(STEER_MODE_ALL_AXLE, sweep(i), p);
+        sink += p[3];
+    });
+    BENCH("tuning_calc_esc_pulse", n, sink += tuning_calc_esc_pulse(sweep(i)));
+    BENCH("tuning_lut_esc_pulse", n, sink += tuning_lut_esc_pulse(sweep(i)));
+    BENCH("tuning_apply_speed_steering", n, sink += tuning_apply_speed_steering(sweep(i), sweep(i + 1)));
+
+    tuning_set_throttle_mode(THROTTLE_MODE_REALISTIC);
+    BENCH("tuning_apply_realistic_throttle", n, sink += tuning_apply_realistic_throttle(sweep(i >> 6)));
+    tuning_set_throttle_mode(THROTTLE_MODE_DIRECT);
+    BENCH("tuning_apply_realistic_steering", n, sink += tuning_apply_realistic_steering(sweep(i >> 6)));
+
+    BENCH("value_to_pulse", n, sink += value_to_pulse(sweep(i), SERVO_MIN_US, SERVO_CENTER_US, SERVO_MAX_US));
+    BENCH("pulse_to_value", n, sink += pulse_to_value(1000 + (i % 1001), 1000, 1500, 2000));
+
+    publish_sticks(300, -200);
+    BENCH("rc_input_get_calibrated", n, {
+        rc_channel_data_t d;
+        rc_input_get_calibrated(RC_CH_STEERING, &calibration.channels[RC_CH_STEERING], &d);
+        sink += d.value;
+    });
+    BENCH("rc_input_get_all_calibrated", n, {
+        rc_frame_t f;
+        rc_input_get_all_calibrated(&calibration, &f);
+        sink += f.ch[RC_CH_STEERING].value;
+    });
+    BENCH("capture ISR (edge pair)", n, {
+        uint32_t t = i * 80000u;
+        host_capture_edge(RC_CH_STEERING, true, t);
+        host_capture_edge(RC_CH_STEERING, false, t + 80u * (1000u + (i % 1000u)));
+    });
+    BENCH("mode_switch_update", n, mode_switch_update(((i >> 4) & 7) == 0));
+
+    printf("\nControl tick (rc frame -> mixing -> PWM commit)\n");
+    BENCH("tick, reference functions", n, {
+        if ((i & 63) == 0) publish_sticks(sweep(i), sweep(i + 3));
+        sink += tick_reference(STEER_MODE_ALL_AXLE);
+    });
+    BENCH("tick, compiled tables", n, {
+        if ((i & 63) == 0) publish_sticks(sweep(i), sweep(i + 3));
+        sink += tick_tables(STEER_MODE_ALL_AXLE);
+    });
+}
+
+// ============================================================================
+// Mode button
+// ============================================================================
+
+/**
+ * @brief Feed a press sequence into the state machine at 100Hz
+ * @param presses Number of short presses (100ms down, 150ms up)
+ * @param hold_ms Length of the last press (long press if above threshold)
+ */
+static steering_mode_t press_sequence(steering_mode_t start, int presses, int hold_ms)
+{
+    mode_switch_set_mode(start);
+    for (int p = 0; p < presses; p++) {
+        int down_ms = (p == presses - 1) ? hold_ms : 100;
+        for (int t = 0; t < down_ms; t += 10, host_time_us += TICK_US) mode_switch_update(true);
+        for (int t = 0; t < 150; t += 10, host_time_us += TICK_US) mode_switch_update(false);
+    }
+    for (int t = 0; t < 1000; t += 10, host_time_us += TICK_US) mode_switch_update(false);
+    return mode_switch_get_mode();
+}
+
+static int longpress_count = 0;
+
+static void on_longpress(void)
+{
+    longpress_count++;
+}
+
+/**
+ * @brief Run press sequences and check the resulting mode
+ * @return Number of sequences that ended in the wrong mode or long-press state
+ */
+static int run_mode_switch(void)
+{
+    static const char *names[STEER_MODE_COUNT] = {
+        [STEER_MODE_FRONT] = "front", [STEER_MODE_REAR] = "rear",
+        [STEER_MODE_ALL_AXLE] = "all-axle", [STEER_MODE_CRAB] = "crab",
+    };
+    static const struct {
+        steering_mode_t start;
+        int presses;
+        int hold_ms;
+        steering_mode_t expect;
+        bool expect_longpress;
+    } seqs[] = {
+        { STEER_MODE_FRONT, 1, 100, STEER_MODE_ALL_AXLE, false },
+        { STEER_MODE_ALL_AXLE, 1, 100, STEER_MODE_FRONT, false },
+        { STEER_MODE_FRONT, 2, 100, STEER_MODE_CRAB, false },
+        { STEER_MODE_FRONT, 3, 100, STEER_MODE_REAR, false },
+        { STEER_MODE_CRAB, 1, 100, STEER_MODE_FRONT, false },
+        { STEER_MODE_REAR, 2, 100, STEER_MODE_CRAB, false },
+        // A long press opens the menu and never changes the mode
+        { STEER_MODE_FRONT, 1, 2000, STEER_MODE_FRONT, true },
+        { STEER_MODE_ALL_AXLE, 2, 2000, STEER_MODE_ALL_AXLE, true },
+    };
+    int failures = 0;
+
+    mode_switch_set_longpress_callback(on_longpress, 1500);
+    printf("\nMode button (100Hz updates)\n");
+    for (size_t s = 0; s < sizeof(seqs) / sizeof(seqs[0]); s++) {
+        int before = longpress_count;
+        steering_mode_t end = press_sequence(seqs[s].start, seqs[s].presses, seqs[s].hold_ms);
+        bool longpress = longpress_count > before;
+        bool ok = end == seqs[s].expect && longpress == seqs[s].expect_longpress;
+        printf("  %-9s + %d %-7s%-11s -> %s%s%s\n", names[seqs[s].start], seqs[s].presses,
+               seqs[s].presses > 1 ? "presses" : "press", seqs[s].hold_ms > 100 ? " (held 2s)" : "",
+               names[end], longpress ? " + long press" : "", ok ? "" : "  FAIL");
+        if (!ok) {
+            printf("    expected %s%s\n", names[seqs[s].expect],
+                   seqs[s].expect_longpress ? " + long press" : "");
+            failures++;
+        }
+    }
+    return failures;
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv)
+{
+    uint32_t iterations = DEFAULT_ITERATIONS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-v") == 0) {
+            host_log_verbose = 1;
+        } else {
+            fprintf(stderr, "Usage: %s [-n iterations] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (iterations == 0) iterations = 1;
+
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        calibration.channels[i] = (channel_calibration_t){
+            .min = RC_DEFAULT_MIN_US, .center = RC_DEFAULT_CENTER_US,
+            .max = RC_DEFAULT_MAX_US, .deadzone = DEFAULT_DEADZONE_US,
+        };
+    }
+    calibration.calibrated = true;
+
+    host_time_us = 1000000;
+    ESP_ERROR_CHECK(tuning_init(NULL));
+    ESP_ERROR_CHECK(pwm_output_init());
+    ESP_ERROR_CHECK(rc_input_init());
+    mode_switch_init();
+    tuning_set_dt_us(TICK_US);
+
+    int32_t worst = compare_tables();
+    run_benchmarks(iterations);
+    int mode_failures = run_mode_switch();
+
+    int ret = 0;
+    if (worst > TABLE_TOLERANCE_US) {
+        printf("\nTables differ from the reference by up to %ld (allowed %d)\n",
+               (long)worst, TABLE_TOLERANCE_US);
+        ret = 1;
+    }
+    if (mode_failures > 0) {
+        printf("\n%d mode button sequence%s ended in the wrong state\n",
+               mode_failures, mode_failures > 1 ? "s" : "");
+        ret = 1;
+    }
+    return ret;
+}
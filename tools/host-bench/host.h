@@ -0,0 +1,27 @@
+/**
+ * @file host.h
+ * @brief Bench <-> shim interface for the host build
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+extern int64_t host_time_us;
+extern int host_log_verbose;
+
+/**
+ * @brief Deliver a capture edge to the callback rc_input registered
+ * @param channel Capture channel (creation order = rc_channel_t)
+ * @param rising true for a rising edge
+ * @param ticks Capture timer value (MCPWM_CAPTURE_RESOLUTION_HZ)
+ */
+void host_capture_edge(int channel, bool rising, uint32_t ticks);
+
+/**
+ * @brief Last value written to an MCPWM comparator
+ * @param index Creation order: ESC first, then the servos
+ * @return Compare ticks (us), 0 if none written
+ */
+uint32_t host_compare_value(int index);
@@ -0,0 +1,32 @@
+/**
+ * @file host.h
+ * @brief Renderer <-> shim interface for the host build
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "perf.h"
+
+extern int64_t host_time_us;
+extern int host_log_verbose;
+
+/**
+ * @brief Restart the esp_random() sequence
+ * @param seed Non-zero seed (0 selects the default)
+ */
+void host_random_seed(uint32_t seed);
+
+/**
+ * @brief Clear the per-stage totals collected by perf_stage_end()
+ */
+void host_perf_reset(void);
+
+/**
+ * @brief Get the total time spent in a stage since the last reset
+ * @param stage Stage ID
+ * @param calls Output: number of timed blocks (may be NULL)
+ * @return Nanoseconds
+ */
+uint64_t host_perf_stage_ns(perf_stage_t stage, uint32_t *calls);
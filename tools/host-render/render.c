@@ -0,0 +1,506 @@
+/**
+ * @file render.c
+ * @brief Offline renderer and benchmark for the engine sound mixer
+ *
+ * Links the firmware's engine_sound.c and vehicle.c unchanged against host
+ * shims, drives them from a throttle/speed trace on a virtual clock and writes the result
+ * as a WAV file, or times every profile through the trace (--bench).
+ *
+ * Trace format (CSV, '#' starts a comment), values interpolated linearly:
+ *     time_ms,throttle,speed[,event]
+ * Events fire when playback reaches their row: start, stop, horn_on,
+ * horn_off, jake_on, jake_off.
+ */
+
+#include "host.h"
+#include "config.h"
+#include "engine_sound.h"
+#include "vehicle.h"
+#include "sounds/sound_profiles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#define UPDATE_PERIOD_US    10000   // Control loop rate the fades are tuned for
+#define MAX_TRACE_POINTS    4096
+#define TAIL_MAX_US         5000000 // Longest shutdown we wait for after the trace
+
+typedef struct {
+    uint32_t time_ms;
+    int16_t throttle;
+    int16_t speed;
+    char event[16];
+} trace_point_t;
+
+typedef struct {
+    trace_point_t points[MAX_TRACE_POINTS];
+    int count;
+} trace_t;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t render_ns;
+    int16_t peak;
+    uint32_t clipped;
+} render_result_t;
+
+static trace_t trace;
+
+// Start, idle, pull away, cruise with horn, brake, reverse, stop
+static const char *default_trace =
+    "0,0,0,start\n"
+    "3000,0,0\n"
+    "3500,300,0\n"
+    "7000,1000,800\n"
+    "9000,1000,1000,horn_on\n"
+    "10000,1000,1000,horn_off\n"
+    "10500,-600,900\n"
+    "13000,-600,0\n"
+    "13500,0,0\n"
+    "14500,-500,0\n"
+    "17000,-500,-500\n"
+    "18000,0,-100\n"
+    "19000,0,0,stop\n";
+
+// ============================================================================
+// TRACE
+// ============================================================================
+
+/**
+ * @brief Parse one trace line
+ * @return true if the line held a point
+ */
+static bool parse_line(char *line, trace_point_t *pt)
+{
+    char *hash = strchr(line, '#');
+    if (hash) *hash = '\0';
+
+    unsigned long t;
+    int throttle, speed;
+    char event[16] = "";
+    int n = sscanf(line, " %lu , %d , %d , %15[a-z_]", &t, &throttle, &speed, event);
+    if (n < 3) {
+        return false;
+    }
+
+    pt->time_ms = (uint32_t)t;
+    pt->throttle = (int16_t)(throttle < -1000 ? -1000 : throttle > 1000 ? 1000 : throttle);
+    pt->speed = (int16_t)(speed < -1000 ? -1000 : speed > 1000 ? 1000 : speed);
+    strcpy(pt->event, event);
+    return true;
+}
+
+/**
+ * @brief Load the trace from text (one point per line, ascending time)
+ */
+static bool trace_parse(const char *text)
+{
+    trace.count = 0;
+    while (*text && trace.count < MAX_TRACE_POINTS) {
+        char line[256];
+        size_t len = strcspn(text, "\n");
+        if (len >= sizeof(line)) len = sizeof(line) - 1;
+        memcpy(line, text, len);
+        line[len] = '\0';
+        text += strcspn(text, "\n");
+        if (*text) text++;
+
+        trace_point_t pt;
+        if (!parse_line(line, &pt)) {
+            continue;
+        }
+        if (trace.count > 0 && pt.time_ms < trace.points[trace.count - 1].time_ms) {
+            fprintf(stderr, "trace: time goes backwards at %lu ms\n", (unsigned long)pt.time_ms);
+            return false;
+        }
+        trace.points[trace.count++] = pt;
+    }
+    return trace.count > 0;
+}
+
+/**
+ * @brief Read a whole trace file into memory and parse it
+ */
+static bool trace_load(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char *text = malloc((size_t)size + 1);
+    if (!text) {
+        fclose(f);
+        return false;
+    }
+    size_t got = fread(text, 1, (size_t)size, f);
+    text[got] = '\0';
+    fclose(f);
+
+    bool ok = trace_parse(text);
+    free(text);
+    return ok;
+}
+
+/**
+ * @brief Interpolate throttle and speed at a trace time
+ */
+static void trace_sample(uint32_t time_ms, int16_t *throttle, int16_t *speed)
+{
+    const trace_point_t *pts = trace.points;
+    int i = 0;
+    while (i + 1 < trace.count && pts[i + 1].time_ms <= time_ms) {
+        i++;
+    }
+    if (i + 1 >= trace.count || time_ms <= pts[i].time_ms) {
+        *throttle = pts[i].throttle;
+        *speed = pts[i].speed;
+        return;
+    }
+
+    int32_t span = (int32_t)(pts[i + 1].time_ms - pts[i].time_ms);
+    int32_t pos = (int32_t)(time_ms - pts[i].time_ms);
+    *throttle = (int16_t)(pts[i].throttle + (pts[i + 1].throttle - pts[i].throttle) * pos / span);
+    *speed = (int16_t)(pts[i].speed + (pts[i + 1].speed - pts[i].speed) * pos / span);
+}
+
+/**
+ * @brief Apply a trace event to the engine
+ */
+static void trace_event(const char *event)
+{
+    if (strcmp(event, "start") == 0) {
+        engine_sound_start();
+    } else if (strcmp(event, "stop") == 0) {
+        engine_sound_stop();
+    } else if (strcmp(event, "horn_on") == 0) {
+        engine_sound_set_horn(true);
+    } else if (strcmp(event, "horn_off") == 0) {
+        engine_sound_set_horn(false);
+    } else if (strcmp(event, "jake_on") == 0) {
+        engine_sound_set_jake_brake(true);
+    } else if (strcmp(event, "jake_off") == 0) {
+        engine_sound_set_jake_brake(false);
+    } else if (event[0]) {
+        fprintf(stderr, "trace: unknown event '%s'\n", event);
+    }
+}
+
+/**
+ * @brief Derive the vehicle model inputs the control loop would pass
+ */
+static void vehicle_input(int16_t throttle, int16_t speed, vehicle_input_t *in)
+{
+    static int8_t direction = 0;
+
+    if (speed > 50) {
+        direction = 1;
+    } else if (speed < -50) {
+        direction = -1;
+    } else if (throttle > 50) {
+        direction = 1;
+    } else if (throttle < -50) {
+        direction = -1;
+    }
+    in->throttle = throttle;
+    in->velocity = speed;
+    in->direction = direction;
+    in->braking = (speed > 50 && throttle < -50) || (speed < -50 && throttle > 50);
+    in->engine_running = engine_sound_get_state() == ENGINE_RUNNING;
+}
+
+// ============================================================================
+// RENDERING
+// ============================================================================
+
+/**
+ * @brief Write a 16-bit mono WAV header
+ */
+static void wav_write_header(FILE *f, uint32_t frames)
+{
+    uint32_t data_bytes = frames * 2;
+    uint8_t h[44];
+    uint32_t rate = AUDIO_SAMPLE_RATE;
+    uint32_t byte_rate = rate * 2;
+
+    memcpy(h, "RIFF", 4);
+    uint32_t riff = 36 + data_bytes;
+    memcpy(h + 4, &riff, 4);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    uint32_t fmt_len = 16;
+    uint16_t format = 1, channels = 1, align = 2, bits = 16;
+    memcpy(h + 16, &fmt_len, 4);
+    memcpy(h + 20, &format, 2);
+    memcpy(h + 22, &channels, 2);
+    memcpy(h + 24, &rate, 4);
+    memcpy(h + 28, &byte_rate, 4);
+    memcpy(h + 32, &align, 2);
+    memcpy(h + 34, &bits, 2);
+    memcpy(h + 36, "data", 4);
+    memcpy(h + 40, &data_bytes, 4);
+    fwrite(h, 1, sizeof(h), f);
+}
+
+/**
+ * @brief Wall-clock nanoseconds
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Play the trace through the engine, one mixer block at a time
+ *
+ * Mirrors the mixer task: both buses are summed and saturated exactly as
+ * mix_buses() does with no UI ducking. After the last point the renderer
+ * keeps going until the shutdown sequence has gone silent.
+ *
+ * @param out WAV file to write samples to (NULL to discard)
+ * @param max_us Stop after this much audio (0 = trace length)
+ */
+static void render_trace(FILE *out, uint64_t max_us, render_result_t *result)
+{
+    static int32_t engine_bus[AUDIO_BLOCK_FRAMES];
+    static int32_t effects_bus[AUDIO_BLOCK_FRAMES];
+    static int16_t pcm[AUDIO_BLOCK_FRAMES];
+
+    uint64_t end_us = (uint64_t)trace.points[trace.count - 1].time_ms * 1000;
+    if (max_us) end_us = max_us;
+
+    int next_event = 0;
+    int64_t next_update_us = 0;
+    memset(result, 0, sizeof(*result));
+    host_time_us = 0;
+
+    for (;;) {
+        host_time_us = (int64_t)(result->frames * 1000000ull / AUDIO_SAMPLE_RATE);
+        bool after_trace = (uint64_t)host_time_us >= end_us;
+        if (after_trace && (max_us || engine_sound_get_state() == ENGINE_OFF ||
+                            (uint64_t)host_time_us >= end_us + TAIL_MAX_US)) {
+            break;
+        }
+
+        // Control loop ticks that fall inside this block run before it
+        while (next_update_us <= host_time_us) {
+            uint32_t t_ms = (uint32_t)(next_update_us / 1000);
+            while (next_event < trace.count && trace.points[next_event].time_ms <= t_ms) {
+                trace_event(trace.points[next_event].event);
+                next_event++;
+            }
+            int16_t throttle, speed;
+            trace_sample(t_ms, &throttle, &speed);
+            vehicle_input_t in;
+            vehicle_input(throttle, speed, &in);
+            engine_sound_update(vehicle_update(&in));
+            next_update_us += UPDATE_PERIOD_US;
+        }
+
+        memset(engine_bus, 0, sizeof(engine_bus));
+        memset(effects_bus, 0, sizeof(effects_bus));
+
+        uint64_t t0 = now_ns();
+        engine_sound_render(engine_bus, effects_bus, AUDIO_BLOCK_FRAMES);
+        result->render_ns += now_ns() - t0;
+
+        for (int i = 0; i < AUDIO_BLOCK_FRAMES; i++) {
+            int32_t mix = engine_bus[i] + effects_bus[i];
+            if (mix > 32767) { mix = 32767; result->clipped++; }
+            if (mix < -32768) { mix = -32768; result->clipped++; }
+            pcm[i] = (int16_t)mix;
+            int16_t mag = (int16_t)(mix < 0 ? (mix == -32768 ? 32767 : -mix) : mix);
+            if (mag > result->peak) result->peak = mag;
+        }
+        if (out) {
+            fwrite(pcm, sizeof(int16_t), AUDIO_BLOCK_FRAMES, out);
+        }
+        result->frames += AUDIO_BLOCK_FRAMES;
+    }
+}
+
+/**
+ * @brief Force the engine off between benchmark runs
+ */
+static void engine_reset(void)
+{
+    engine_sound_set_horn(false);
+    engine_sound_set_jake_brake(false);
+    if (engine_sound_get_state() != ENGINE_OFF) {
+        static int32_t engine_bus[AUDIO_BLOCK_FRAMES];
+        static int32_t effects_bus[AUDIO_BLOCK_FRAMES];
+        engine_sound_stop();
+        for (int i = 0; i < 2000 && engine_sound_get_state() != ENGINE_OFF; i++) {
+            engine_sound_render(engine_bus, effects_bus, AUDIO_BLOCK_FRAMES);
+        }
+    }
+}
+
+/**
+ * @brief Print time per rendered second for one perf stage
+ */
+static void print_stage(const char *label, perf_stage_t stage, double audio_s)
+{
+    uint32_t calls;
+    uint64_t ns = host_perf_stage_ns(stage, &calls);
+    printf("  %-8s %8.1f us/s audio  (%lu blocks)\n", label,
+           audio_s > 0 ? ns / 1000.0 / audio_s : 0.0, (unsigned long)calls);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: engine-render [-p profile] [-t trace.csv] [-o out.wav] [-s seconds]\n"
+            "                     [--seed N] [--bench] [--list] [-v]\n"
+            "  -p        Profile index or name, e.g. \"MAN TGX\" (default 0)\n"
+            "  -t        Throttle/speed trace (default: built-in drive cycle)\n"
+            "  -o        Output WAV (default engine.wav)\n"
+            "  -s        Render only this many seconds\n"
+            "  --bench   Time every profile through the trace, no WAV output\n");
+}
+
+/**
+ * @brief Resolve a profile given by index or name
+ * @return Profile ID, or -1 if unknown
+ */
+static int find_profile(const char *arg)
+{
+    char *end;
+    long idx = strtol(arg, &end, 10);
+    if (*end == '\0') {
+        return (idx >= 0 && idx < sound_profiles_count()) ? (int)idx : -1;
+    }
+    for (int i = 0; i < sound_profiles_count(); i++) {
+        const sound_profile_def_t *p = sound_profiles_get((sound_profile_t)i);
+        if (p && strcasecmp(p->name, arg) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *profile_arg = NULL;
+    const char *trace_path = NULL;
+    const char *out_path = "engine.wav";
+    double seconds = 0;
+    bool bench = false;
+    bool list = false;
+    uint32_t seed = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(a, "-p") == 0 && has_value) {
+            profile_arg = argv[++i];
+        } else if (strcmp(a, "-t") == 0 && has_value) {
+            trace_path = argv[++i];
+        } else if (strcmp(a, "-o") == 0 && has_value) {
+            out_path = argv[++i];
+        } else if (strcmp(a, "-s") == 0 && has_value) {
+            seconds = atof(argv[++i]);
+        } else if (strcmp(a, "--seed") == 0 && has_value) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--bench") == 0) {
+            bench = true;
+        } else if (strcmp(a, "--list") == 0) {
+            list = true;
+        } else if (strcmp(a, "-v") == 0) {
+            host_log_verbose = 1;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    if (list) {
+        for (int i = 0; i < sound_profiles_count(); i++) {
+            const sound_profile_def_t *p = sound_profiles_get((sound_profile_t)i);
+            printf("%2d  %-12s %s\n", i, p->name, p->description);
+        }
+        return 0;
+    }
+
+    if (!(trace_path ? trace_load(trace_path) : trace_parse(default_trace))) {
+        fprintf(stderr, "No usable trace points\n");
+        return 1;
+    }
+
+    host_random_seed(seed);
+    if (engine_sound_init() != ESP_OK) {
+        fprintf(stderr, "engine_sound_init failed\n");
+        return 1;
+    }
+
+    uint64_t max_us = (uint64_t)(seconds * 1e6);
+
+    if (bench) {
+        printf("%d profiles, %d-frame blocks @ %d Hz\n",
+               sound_profiles_count(), AUDIO_BLOCK_FRAMES, AUDIO_SAMPLE_RATE);
+        for (int i = 0; i < sound_profiles_count(); i++) {
+            engine_reset();
+            engine_sound_set_profile((sound_profile_t)i);
+            host_random_seed(seed);
+            host_perf_reset();
+
+            render_result_t r;
+            render_trace(NULL, max_us, &r);
+
+            double audio_s = (double)r.frames / AUDIO_SAMPLE_RATE;
+            double render_s = r.render_ns / 1e9;
+            printf("%-12s %6.1f s audio  %10.0f samples/s  %7.1fx realtime  peak %5d  clipped %lu\n",
+                   sound_profiles_get((sound_profile_t)i)->name, audio_s,
+                   render_s > 0 ? r.frames / render_s : 0.0,
+                   render_s > 0 ? audio_s / render_s : 0.0,
+                   r.peak, (unsigned long)r.clipped);
+            print_stage("engine", PERF_STAGE_AUDIO_ENGINE, audio_s);
+            print_stage("effects", PERF_STAGE_AUDIO_EFFECTS, audio_s);
+            print_stage("horn", PERF_STAGE_AUDIO_HORN, audio_s);
+        }
+        engine_sound_deinit();
+        return 0;
+    }
+
+    if (profile_arg) {
+        int id = find_profile(profile_arg);
+        if (id < 0) {
+            fprintf(stderr, "Unknown profile '%s' (see --list)\n", profile_arg);
+            return 1;
+        }
+        engine_sound_set_profile((sound_profile_t)id);
+    }
+
+    FILE *out = fopen(out_path, "wb");
+    if (!out) {
+        perror(out_path);
+        return 1;
+    }
+    wav_write_header(out, 0);
+
+    render_result_t r;
+    render_trace(out, max_us, &r);
+
+    fseek(out, 0, SEEK_SET);
+    wav_write_header(out, (uint32_t)r.frames);
+    fclose(out);
+
+    printf("%s: %s, %.2f s, peak %d, %lu clipped samples\n", out_path,
+           sound_profiles_get_name(engine_sound_get_profile()), (double)r.frames / AUDIO_SAMPLE_RATE,
+           r.peak, (unsigned long)r.clipped);
+
+    engine_sound_deinit();
+    return 0;
+}
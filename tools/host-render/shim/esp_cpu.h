@@ -0,0 +1,10 @@
+/**
+ * @file esp_cpu.h
+ * @brief Host shim: the "cycle counter" counts nanoseconds
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+uint32_t esp_cpu_get_cycle_count(void);
@@ -0,0 +1,19 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Host shim: capability allocations come from malloc
+ */
+
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA          (1 << 0)
+#define MALLOC_CAP_INTERNAL     (1 << 1)
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_SPIRAM       (1 << 3)
+
+static inline void *heap_caps_malloc(size_t size, unsigned caps)
+{
+    // No PSRAM on the host, like a board without it
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : malloc(size);
+}
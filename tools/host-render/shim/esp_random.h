@@ -0,0 +1,10 @@
+/**
+ * @file esp_random.h
+ * @brief Host shim: deterministic random numbers, so renders are repeatable
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+uint32_t esp_random(void);
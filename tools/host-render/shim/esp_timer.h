@@ -0,0 +1,15 @@
+/**
+ * @file esp_timer.h
+ * @brief Host shim: esp_timer time is the renderer's virtual audio clock
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+extern int64_t host_time_us;
+
+static inline int64_t esp_timer_get_time(void)
+{
+    return host_time_us;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file task.h
+ * @brief Host shim: no scheduler; delays return at once, notifications are
+ * dropped and tasks cannot be created
+ */
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return NULL;
+}
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdPASS;
+}
+
+static inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken)
+{
+    (void)task;
+    if (woken) *woken = pdFALSE;
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    (void)clear;
+    (void)ticks;
+    return 0;
+}
+
+typedef void (*TaskFunction_t)(void *arg);
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                                 void *arg, UBaseType_t priority, TaskHandle_t *handle,
+                                                 BaseType_t core)
+{
+    (void)fn;
+    (void)name;
+    (void)stack;
+    (void)arg;
+    (void)priority;
+    (void)core;
+    if (handle) *handle = NULL;
+    return pdFAIL;
+}
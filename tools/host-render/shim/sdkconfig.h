@@ -0,0 +1,25 @@
+/**
+ * @file sdkconfig.h
+ * @brief Host shim: only the sound content options are set (all of it, as
+ *        in the Kconfig defaults)
+ */
+
+#pragma once
+
+#define CONFIG_CRAWLER_SOUND_PROFILE_CAT3408    1
+#define CONFIG_CRAWLER_SOUND_PROFILE_UNIMOG     1
+#define CONFIG_CRAWLER_SOUND_PROFILE_MANTGX     1
+#define CONFIG_CRAWLER_SOUND_PROFILE_SYNTH_V8   1
+#define CONFIG_CRAWLER_SOUND_HORN_TRUCK         1
+#define CONFIG_CRAWLER_SOUND_HORN_MANTGE        1
+#define CONFIG_CRAWLER_SOUND_HORN_CUCARACHA     1
+#define CONFIG_CRAWLER_SOUND_HORN_2TONE         1
+#define CONFIG_CRAWLER_SOUND_HORN_DIXIE         1
+#define CONFIG_CRAWLER_SOUND_HORN_PETERBILT     1
+#define CONFIG_CRAWLER_SOUND_HORN_OUTLAW        1
+#define CONFIG_CRAWLER_SOUND_AIR_BRAKE          1
+#define CONFIG_CRAWLER_SOUND_REVERSE_BEEP       1
+#define CONFIG_CRAWLER_SOUND_GEAR_SHIFT         1
+#define CONFIG_CRAWLER_SOUND_WASTEGATE          1
+#define CONFIG_CRAWLER_SOUND_MODE_SWITCH        1
+#define CONFIG_CRAWLER_SOUND_MENU_PROMPTS       1
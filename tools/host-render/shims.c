@@ -0,0 +1,161 @@
+/**
+ * @file shims.c
+ * @brief Host stand-ins for the firmware modules engine_sound.c links against
+ *
+ * Time is virtual (advanced by the renderer per rendered block), random
+ * numbers are a fixed-seed xorshift so renders are bit-for-bit repeatable,
+ * and the vehicle model is fed from the trace instead of the ESC model.
+ */
+
+#include "host.h"
+#include "nvs_storage.h"
+#include "tuning.h"
+#include "audio_mixer.h"
+#include "sound_pack.h"
+#include "perf.h"
+#include "bench.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include "freertos/semphr.h"
+#include "esp_cpu.h"
+#include "esp_random.h"
+
+int64_t host_time_us = 0;
+int host_log_verbose = 0;
+
+static uint64_t stage_ns[PERF_STAGE_COUNT];
+static uint32_t stage_calls[PERF_STAGE_COUNT];
+static uint32_t random_state = 0x2545F491u;
+
+// ============================================================================
+// ESP-IDF
+// ============================================================================
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    return code == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+uint32_t esp_random(void)
+{
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state = x;
+    return x;
+}
+
+void host_random_seed(uint32_t seed)
+{
+    random_state = seed ? seed : 0x2545F491u;
+}
+
+uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    static int dummy;
+    return &dummy;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    (void)sem;
+}
+
+// ============================================================================
+// FIRMWARE MODULES
+// ============================================================================
+
+esp_err_t nvs_storage_save_deferred(nvs_blob_t blob, const void *data, size_t len)
+{
+    (void)blob;
+    (void)data;
+    (void)len;
+    return ESP_OK;
+}
+
+esp_err_t nvs_storage_load(nvs_blob_t blob, const nvs_schema_t *schema, void *config)
+{
+    // Nothing stored: config keeps the defaults
+    (void)blob;
+    (void)schema;
+    (void)config;
+    return ESP_ERR_NOT_FOUND;
+}
+
+int32_t tuning_get_dt_q8(void)
+{
+    return 256;     // The renderer calls engine_sound_update() every reference tick
+}
+
+int16_t tuning_get_motor_cutoff(void)
+{
+    return TUNING_DEFAULT_MOTOR_CUTOFF;
+}
+
+void audio_mixer_wake(void)
+{
+}
+
+bool sound_pack_find(const char *name, sound_pack_clip_t *clip)
+{
+    (void)name;
+    (void)clip;
+    return false;
+}
+
+int sound_pack_profile_count(void)
+{
+    return 0;
+}
+
+const sound_profile_def_t *sound_pack_get_profile(int index)
+{
+    (void)index;
+    return NULL;
+}
+
+void bench_measure(bench_fn_t fn, void *arg, uint32_t runs, bench_stat_t *stat)
+{
+    // engine_sound_bench_mix() is firmware-only; the renderer times blocks itself
+    (void)fn;
+    (void)arg;
+    *stat = (bench_stat_t){ .runs = runs };
+}
+
+// ============================================================================
+// PERF
+// ============================================================================
+
+void perf_stage_end(perf_stage_t stage, uint32_t start_cycles)
+{
+    if (stage >= PERF_STAGE_COUNT) {
+        return;
+    }
+    stage_ns[stage] += (uint32_t)(perf_cycles() - start_cycles);
+    stage_calls[stage]++;
+}
+
+void host_perf_reset(void)
+{
+    for (int i = 0; i < PERF_STAGE_COUNT; i++) {
+        stage_ns[i] = 0;
+        stage_calls[i] = 0;
+    }
+}
+
+uint64_t host_perf_stage_ns(perf_stage_t stage, uint32_t *calls)
+{
+    if (calls) {
+        *calls = stage_calls[stage];
+    }
+    return stage_ns[stage];
+}
@@ -0,0 +1,38 @@
+/**
+ * @file host.h
+ * @brief Replay <-> shim interface for the host build
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "trace.h"
+
+extern int64_t host_time_us;
+extern int host_log_verbose;
+
+/**
+ * @brief Start a PWM period now (fires the timers' TEZ callbacks)
+ *
+ * Called before each tick so a commit never lands in the guard window
+ * before the next period, where it would spin on a clock that only the
+ * replay advances.
+ */
+void host_pwm_period_start(void);
+
+/**
+ * @brief Set what the web UI was doing on the recorded tick
+ *
+ * The mode override and servo jog are served back to control.c from the
+ * recording, since they came from outside the control path.
+ * @param rec Recorded tick (flags, modes and servo pulses are used)
+ */
+void host_set_web_state(const trace_record_t *rec);
+
+/**
+ * @brief Take the record control.c produced on the last tick
+ * @param out Receives the record
+ * @return false if no record was produced since the last call
+ */
+bool host_take_record(trace_record_t *out);
@@ -0,0 +1,441 @@
+/**
+ * @file replay.c
+ * @brief Replays a flight recorder trace through the control tick on the host
+ *
+ * Links the firmware's control.c, tuning, mode switch, menu, vehicle model
+ * and engine sound unchanged against host shims, feeds the recorded RC
+ * channels to control_process() tick by tick on a virtual clock (mixing the
+ * engine sound alongside, so engine start/stop completes as on the car) and
+ * diffs the record each tick produces against the recorded one: output
+ * pulses, steering, velocity, RPM, gear, modes and flags.
+ *
+ * Input is an /api/trace or black box download (trace_file_header_t, then
+ * the records). Replays only match when the tuning matches the car's, so
+ * pass the /api/tuning response it was recorded with (--tuning). A trace
+ * that starts mid-session can disagree for its first ticks while the
+ * smoothing state catches up; --skip leaves them out of the diff, and
+ * --engine-on starts the engine first (the trace does not record whether
+ * it was running). -o writes
+ * the replayed records as a new download, to re-baseline a reference trace
+ * after an intended behaviour change.
+ */
+
+#include "host.h"
+#include "config.h"
+#include "control.h"
+#include "tuning.h"
+#include "json_config.h"
+#include "pwm_output.h"
+#include "mode_switch.h"
+#include "menu.h"
+#include "engine_sound.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_TUNING_JSON     4096
+#define PREROLL_MAX_US      5000000     // Longest engine start we wait for before the trace
+
+typedef enum {
+    FIELD_ESC = 0,
+    FIELD_SERVO,
+    FIELD_STEER,
+    FIELD_VELOCITY,
+    FIELD_RPM,
+    FIELD_GEAR,
+    FIELD_MODES,
+    FIELD_FLAGS,
+    FIELD_COUNT
+} field_t;
+
+static const char *field_names[FIELD_COUNT] = {
+    "esc", "servo", "steer", "velocity", "rpm", "gear", "modes", "flags"
+};
+
+typedef struct {
+    uint32_t ticks;
+    uint32_t diffed;
+    uint32_t mismatched_ticks;
+    uint32_t mismatches[FIELD_COUNT];
+    uint64_t control_ns;
+    uint64_t audio_ns;
+    uint32_t audio_blocks;
+} replay_result_t;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// ============================================================================
+// INPUT
+// ============================================================================
+
+/**
+ * @brief Load a trace download
+ * @param count Receives the number of records
+ * @param hdr_out Receives the header
+ * @return Records (malloc'd), or NULL after printing why
+ */
+static trace_record_t *trace_load(const char *path, size_t *count, trace_file_header_t *hdr_out)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+
+    trace_file_header_t hdr;
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1 || hdr.magic != TRACE_FILE_MAGIC) {
+        fprintf(stderr, "%s: not a trace download\n", path);
+        fclose(f);
+        return NULL;
+    }
+    if (hdr.version != TRACE_FILE_VERSION || hdr.record_size != sizeof(trace_record_t)) {
+        fprintf(stderr, "%s: trace v%u with %u-byte records, expected v%d with %zu\n", path,
+                hdr.version, hdr.record_size, TRACE_FILE_VERSION, sizeof(trace_record_t));
+        fclose(f);
+        return NULL;
+    }
+
+    trace_record_t *recs = malloc((hdr.count ? hdr.count : 1) * sizeof(trace_record_t));
+    if (!recs) {
+        fclose(f);
+        return NULL;
+    }
+    // A download cut short still replays up to where it ends
+    *count = fread(recs, sizeof(trace_record_t), hdr.count, f);
+    fclose(f);
+    if (*count < hdr.count) {
+        fprintf(stderr, "%s: %zu of %u records (truncated)\n", path, *count, (unsigned)hdr.count);
+    }
+    *hdr_out = hdr;
+    return recs;
+}
+
+/**
+ * @brief Write records as a trace download
+ */
+static bool trace_save(const char *path, const trace_file_header_t *hdr,
+                       const trace_record_t *recs, size_t count)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    trace_file_header_t out = *hdr;
+    out.count = (uint32_t)count;
+    bool ok = fwrite(&out, sizeof(out), 1, f) == 1 &&
+              fwrite(recs, sizeof(trace_record_t), count, f) == count;
+    ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        fprintf(stderr, "%s: write failed\n", path);
+    }
+    return ok;
+}
+
+static bool tuning_member(const char *key, size_t key_len, const json_value_t *value, void *ctx)
+{
+    // Keys outside the table (escRateMax, ...) are read-only extras
+    const json_field_t *field = json_find_field(tuning_json_fields, tuning_json_field_count, key, key_len);
+    if (field) {
+        json_field_store(field, ctx, value);
+    }
+    return true;
+}
+
+/**
+ * @brief Apply a saved /api/tuning response on top of the defaults
+ */
+static bool tuning_load(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    static char json[MAX_TUNING_JSON];
+    size_t len = fread(json, 1, sizeof(json), f);
+    fclose(f);
+
+    tuning_config_t cfg;
+    memcpy(&cfg, tuning_get_config(), sizeof(cfg));
+    if (len == sizeof(json) || json_walk_object(json, len, tuning_member, &cfg) < 0) {
+        fprintf(stderr, "%s: not a tuning JSON object\n", path);
+        return false;
+    }
+    tuning_set_config(&cfg);
+    return true;
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+/**
+ * @brief Mix audio blocks until the audio clock reaches the virtual time
+ */
+static void audio_catch_up(uint64_t *frames, replay_result_t *result)
+{
+    static int32_t engine_bus[AUDIO_BLOCK_FRAMES];
+    static int32_t effects_bus[AUDIO_BLOCK_FRAMES];
+
+    while ((int64_t)(*frames * 1000000ull / AUDIO_SAMPLE_RATE) < host_time_us) {
+        uint64_t t0 = now_ns();
+        engine_sound_render(engine_bus, effects_bus, AUDIO_BLOCK_FRAMES);
+        result->audio_ns += now_ns() - t0;
+        result->audio_blocks++;
+        *frames += AUDIO_BLOCK_FRAMES;
+    }
+}
+
+/**
+ * @brief Build the frame control_process() saw from a recorded tick
+ */
+static void frame_from_record(const trace_record_t *rec, rc_frame_t *frame)
+{
+    memset(frame, 0, sizeof(*frame));
+    bool lost = (rec->flags & TRACE_FLAG_FAILSAFE) != 0;
+    for (int i = 0; i < RC_CHANNEL_COUNT; i++) {
+        frame->ch[i].value = rec->input[i];
+        frame->ch[i].signal_lost = lost;
+    }
+}
+
+static void print_mismatch(uint32_t index, const trace_record_t *want, const trace_record_t *got)
+{
+    printf("tick %6lu @ %8.3f s:", (unsigned long)index, want->t_us / 1e6);
+    if (want->esc_pulse != got->esc_pulse) {
+        printf(" esc %u/%u", want->esc_pulse, got->esc_pulse);
+    }
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        if (want->servo_pulse[i] != got->servo_pulse[i]) {
+            printf(" servo%d %u/%u", i, want->servo_pulse[i], got->servo_pulse[i]);
+        }
+    }
+    if (want->steer != got->steer) printf(" steer %d/%d", want->steer, got->steer);
+    if (want->velocity != got->velocity) printf(" velocity %d/%d", want->velocity, got->velocity);
+    if (want->rpm != got->rpm) printf(" rpm %u/%u", want->rpm, got->rpm);
+    if (want->gear != got->gear) printf(" gear %u/%u", want->gear, got->gear);
+    if (want->modes != got->modes) printf(" modes %02x/%02x", want->modes, got->modes);
+    if (want->flags != got->flags) printf(" flags %02x/%02x", want->flags, got->flags);
+    printf("  (recorded/replayed)\n");
+}
+
+/**
+ * @brief Compare a replayed tick with the recording
+ * @return true if every field matched (RPM within rpm_tol)
+ */
+static bool diff_record(const trace_record_t *want, const trace_record_t *got,
+                        int rpm_tol, replay_result_t *result)
+{
+    bool field_bad[FIELD_COUNT] = {
+        [FIELD_ESC] = want->esc_pulse != got->esc_pulse,
+        [FIELD_STEER] = want->steer != got->steer,
+        [FIELD_VELOCITY] = want->velocity != got->velocity,
+        [FIELD_RPM] = abs((int)want->rpm - (int)got->rpm) > rpm_tol,
+        [FIELD_GEAR] = want->gear != got->gear,
+        [FIELD_MODES] = want->modes != got->modes,
+        [FIELD_FLAGS] = want->flags != got->flags,
+    };
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        field_bad[FIELD_SERVO] |= want->servo_pulse[i] != got->servo_pulse[i];
+    }
+
+    bool ok = true;
+    for (int f = 0; f < FIELD_COUNT; f++) {
+        if (field_bad[f]) {
+            result->mismatches[f]++;
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Run every record through control_process() and diff the results
+ * @param skip Leading ticks left out of the diff
+ * @param show Mismatching ticks to print
+ * @param engine_on Start the engine before the first tick
+ * @param rebase Overwrite each record with the replayed one
+ */
+static void replay(trace_record_t *recs, size_t count, uint32_t skip, int rpm_tol,
+                   uint32_t show, bool engine_on, bool rebase, replay_result_t *result)
+{
+    memset(result, 0, sizeof(*result));
+    uint64_t audio_frames = 0;
+    host_time_us = 0;
+
+    // Join a running engine: start it and let the start sound finish first
+    if (engine_on) {
+        engine_sound_start();
+        while (engine_sound_get_state() != ENGINE_RUNNING && host_time_us < PREROLL_MAX_US) {
+            host_time_us += 1000000 * AUDIO_BLOCK_FRAMES / AUDIO_SAMPLE_RATE;
+            audio_catch_up(&audio_frames, result);
+        }
+    }
+    if (count > 0) {
+        mode_switch_set_mode((steering_mode_t)(recs[0].modes & 0x03));
+    }
+
+    uint32_t prev_t_us = count > 0 ? recs[0].t_us : 0;
+    for (size_t i = 0; i < count; i++) {
+        const trace_record_t *want = &recs[i];
+
+        // Recorded times are the low 32 bits; deltas survive the wrap
+        uint32_t dt_us = want->t_us - prev_t_us;
+        prev_t_us = want->t_us;
+        host_time_us += dt_us;
+        audio_catch_up(&audio_frames, result);
+
+        // As the control task: elapsed time and live edits, then the tick
+        tuning_set_dt_us(dt_us);
+        tuning_live_apply();
+
+        rc_frame_t frame;
+        frame_from_record(want, &frame);
+        host_set_web_state(want);
+        host_pwm_period_start();
+
+        uint64_t t0 = now_ns();
+        control_process(&frame);
+        result->control_ns += now_ns() - t0;
+        result->ticks++;
+
+        trace_record_t got;
+        if (!host_take_record(&got)) {
+            continue;
+        }
+        got.t_us = want->t_us;
+        if (i >= skip) {
+            result->diffed++;
+            if (!diff_record(want, &got, rpm_tol, result)) {
+                if (result->mismatched_ticks < show) {
+                    print_mismatch((uint32_t)i, want, &got);
+                }
+                result->mismatched_ticks++;
+            }
+        }
+        if (rebase) {
+            recs[i] = got;
+        }
+    }
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: control-replay [options] trace.bin\n"
+            "  --tuning FILE  /api/tuning response the trace was recorded with\n"
+            "  -p PROFILE     Sound profile index (RPM/gear follow its gearbox)\n"
+            "  --engine-on    The engine was running when the trace starts\n"
+            "  --skip N       Leave the first N ticks out of the diff\n"
+            "  --rpm-tol N    Accept RPM within N of the recording\n"
+            "  --show N       Print the first N mismatching ticks (default 10)\n"
+            "  -o FILE        Write the replayed records as a trace download\n"
+            "  -v             Firmware info logs\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *trace_path = NULL;
+    const char *tuning_path = NULL;
+    const char *out_path = NULL;
+    int profile = -1;
+    uint32_t skip = 0;
+    uint32_t show = 10;
+    int rpm_tol = 0;
+    bool engine_on = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(a, "--tuning") == 0 && has_value) {
+            tuning_path = argv[++i];
+        } else if (strcmp(a, "-p") == 0 && has_value) {
+            profile = atoi(argv[++i]);
+        } else if (strcmp(a, "--skip") == 0 && has_value) {
+            skip = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "--rpm-tol") == 0 && has_value) {
+            rpm_tol = atoi(argv[++i]);
+        } else if (strcmp(a, "--show") == 0 && has_value) {
+            show = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(a, "-o") == 0 && has_value) {
+            out_path = argv[++i];
+        } else if (strcmp(a, "--engine-on") == 0) {
+            engine_on = true;
+        } else if (strcmp(a, "-v") == 0) {
+            host_log_verbose = 1;
+        } else if (a[0] != '-' && !trace_path) {
+            trace_path = a;
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (!trace_path) {
+        usage();
+        return 2;
+    }
+
+    size_t count = 0;
+    trace_file_header_t hdr;
+    trace_record_t *recs = trace_load(trace_path, &count, &hdr);
+    if (!recs) {
+        return 1;
+    }
+
+    // Boot order of app_main() for the modules the tick uses
+    ESP_ERROR_CHECK(pwm_output_init());
+    ESP_ERROR_CHECK(tuning_init(NULL));
+    if (tuning_path && !tuning_load(tuning_path)) {
+        free(recs);
+        return 1;
+    }
+    mode_switch_init();
+    menu_init();
+    if (engine_sound_init() != ESP_OK) {
+        fprintf(stderr, "engine_sound_init failed\n");
+        free(recs);
+        return 1;
+    }
+    if (profile >= 0 && engine_sound_set_profile((sound_profile_t)profile) != ESP_OK) {
+        fprintf(stderr, "Unknown profile %d\n", profile);
+        free(recs);
+        return 1;
+    }
+    control_set_state(APP_STATE_RUNNING);
+
+    replay_result_t r;
+    replay(recs, count, skip, rpm_tol, show, engine_on, out_path != NULL, &r);
+    if (out_path && !trace_save(out_path, &hdr, recs, count)) {
+        engine_sound_deinit();
+        free(recs);
+        return 1;
+    }
+
+    double span_s = count > 1 ? (uint32_t)(recs[count - 1].t_us - recs[0].t_us) / 1e6 : 0.0;
+    printf("%s: %lu ticks over %.1f s, %lu diffed, %lu mismatched\n", trace_path,
+           (unsigned long)r.ticks, span_s, (unsigned long)r.diffed, (unsigned long)r.mismatched_ticks);
+    for (int f = 0; f < FIELD_COUNT; f++) {
+        if (r.mismatches[f]) {
+            printf("  %-8s %lu ticks\n", field_names[f], (unsigned long)r.mismatches[f]);
+        }
+    }
+    printf("control_process  %8.0f ns/tick\n", r.ticks ? (double)r.control_ns / r.ticks : 0.0);
+    printf("engine mix       %8.0f ns/block (%d frames)\n",
+           r.audio_blocks ? (double)r.audio_ns / r.audio_blocks : 0.0, AUDIO_BLOCK_FRAMES);
+
+    engine_sound_deinit();
+    free(recs);
+    return r.mismatched_ticks ? 1 : 0;
+}
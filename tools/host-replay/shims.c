@@ -0,0 +1,457 @@
+/**
+ * @file shims.c
+ * @brief Host stand-ins for the drivers and modules control.c links against
+ *
+ * The MCPWM outputs are inert apart from the period-start callback (the
+ * committed pulses are read back from the trace record control.c produces),
+ * the web UI state comes from the recording, the recorders keep only the
+ * last record, and prompts and beeps are silent. Time is virtual (host_time_us) and random numbers are a
+ * fixed-seed xorshift, so replays are repeatable.
+ */
+
+#include "host.h"
+#include "nvs_storage.h"
+#include "preset.h"
+#include "web_server.h"
+#include "capture.h"
+#include "blackbox.h"
+#include "udp_log.h"
+#include "sound.h"
+#include "audio_mixer.h"
+#include "sound_pack.h"
+#include "perf.h"
+#include "health.h"
+#include "dshot.h"
+#include "bench.h"
+#include "driver/mcpwm_prelude.h"
+#include "driver/ledc.h"
+
+#include <string.h>
+#include <time.h>
+#include "freertos/semphr.h"
+#include "esp_cpu.h"
+#include "esp_random.h"
+
+#define HOST_MAX_HANDLES    8
+
+int64_t host_time_us = 0;
+int host_log_verbose = 0;
+
+struct host_mcpwm_timer {
+    mcpwm_timer_event_cb_t on_empty;
+    void *user_data;
+};
+struct host_mcpwm_oper { int unused; };
+struct host_mcpwm_gen { int unused; };
+struct host_mcpwm_cmpr { int unused; };
+
+static struct host_mcpwm_timer timers[HOST_MAX_HANDLES];
+static struct host_mcpwm_oper opers[HOST_MAX_HANDLES];
+static struct host_mcpwm_gen gens[HOST_MAX_HANDLES];
+static struct host_mcpwm_cmpr cmprs[HOST_MAX_HANDLES];
+static int timer_count, oper_count, gen_count, cmpr_count;
+
+static uint32_t random_state = 0x2545F491u;
+static trace_record_t web_rec;
+static trace_record_t last_rec;
+static bool have_rec;
+
+/**
+ * @brief Hand out the next slot of a handle array
+ */
+#define HOST_NEW(array, count, out) do {                                    \
+        if ((count) >= HOST_MAX_HANDLES) return ESP_ERR_NO_MEM;             \
+        *(out) = &(array)[(count)++];                                       \
+        return ESP_OK;                                                      \
+    } while (0)
+
+// ============================================================================
+// ESP-IDF
+// ============================================================================
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    return code == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+uint32_t esp_random(void)
+{
+    uint32_t x = random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state = x;
+    return x;
+}
+
+uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    static int dummy;
+    return &dummy;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    (void)sem;
+}
+
+// ============================================================================
+// MCPWM
+// ============================================================================
+
+esp_err_t mcpwm_new_timer(const mcpwm_timer_config_t *config, mcpwm_timer_handle_t *ret_timer)
+{
+    (void)config;
+    HOST_NEW(timers, timer_count, ret_timer);
+}
+
+esp_err_t mcpwm_timer_enable(mcpwm_timer_handle_t timer)
+{
+    (void)timer;
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_timer_start_stop(mcpwm_timer_handle_t timer, mcpwm_timer_start_stop_cmd_t command)
+{
+    (void)timer;
+    (void)command;
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_timer_set_period(mcpwm_timer_handle_t timer, uint32_t period_ticks)
+{
+    (void)timer;
+    (void)period_ticks;
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_timer_register_event_callbacks(mcpwm_timer_handle_t timer,
+                                               const mcpwm_timer_event_callbacks_t *cbs, void *user_data)
+{
+    timer->on_empty = cbs->on_empty;
+    timer->user_data = user_data;
+    return ESP_OK;
+}
+
+void host_pwm_period_start(void)
+{
+    static const mcpwm_timer_event_data_t edata = { 0 };
+    for (int i = 0; i < timer_count; i++) {
+        if (timers[i].on_empty) {
+            timers[i].on_empty(&timers[i], &edata, timers[i].user_data);
+        }
+    }
+}
+
+esp_err_t mcpwm_new_operator(const mcpwm_operator_config_t *config, mcpwm_oper_handle_t *ret_oper)
+{
+    (void)config;
+    HOST_NEW(opers, oper_count, ret_oper);
+}
+
+esp_err_t mcpwm_operator_connect_timer(mcpwm_oper_handle_t oper, mcpwm_timer_handle_t timer)
+{
+    (void)oper;
+    (void)timer;
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_new_comparator(mcpwm_oper_handle_t oper, const mcpwm_comparator_config_t *config,
+                               mcpwm_cmpr_handle_t *ret_cmpr)
+{
+    (void)oper;
+    (void)config;
+    HOST_NEW(cmprs, cmpr_count, ret_cmpr);
+}
+
+esp_err_t mcpwm_comparator_set_compare_value(mcpwm_cmpr_handle_t cmpr, uint32_t cmp_ticks)
+{
+    (void)cmpr;
+    (void)cmp_ticks;
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_new_generator(mcpwm_oper_handle_t oper, const mcpwm_generator_config_t *config,
+                              mcpwm_gen_handle_t *ret_gen)
+{
+    (void)oper;
+    (void)config;
+    HOST_NEW(gens, gen_count, ret_gen);
+}
+
+esp_err_t mcpwm_generator_set_action_on_timer_event(mcpwm_gen_handle_t gen,
+                                                    mcpwm_gen_timer_event_action_t ev_act)
+{
+    (void)gen;
+    (void)ev_act;
+    return ESP_OK;
+}
+
+esp_err_t mcpwm_generator_set_action_on_compare_event(mcpwm_gen_handle_t gen,
+                                                      mcpwm_gen_compare_event_action_t ev_act)
+{
+    (void)gen;
+    (void)ev_act;
+    return ESP_OK;
+}
+
+// ============================================================================
+// LEDC (auxiliary outputs; none fitted on the host)
+// ============================================================================
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t *timer_conf)
+{
+    (void)timer_conf;
+    return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t *ledc_conf)
+{
+    (void)ledc_conf;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty)
+{
+    (void)speed_mode;
+    (void)channel;
+    (void)duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    (void)speed_mode;
+    (void)channel;
+    return ESP_OK;
+}
+
+// ============================================================================
+// WEB UI (from the recording)
+// ============================================================================
+
+void host_set_web_state(const trace_record_t *rec)
+{
+    web_rec = *rec;
+}
+
+bool web_server_get_mode_override(uint8_t *mode)
+{
+    if (!(web_rec.flags & TRACE_FLAG_UI_MODE)) {
+        return false;
+    }
+    *mode = web_rec.modes & 0x03;
+    return true;
+}
+
+bool web_server_is_servo_test_active(void)
+{
+    return (web_rec.flags & TRACE_FLAG_SERVO_TEST) != 0;
+}
+
+bool web_server_get_servo_jog(uint16_t pulses[SERVO_COUNT])
+{
+    for (int i = 0; i < SERVO_COUNT; i++) {
+        pulses[i] = web_rec.servo_pulse[i];
+    }
+    return true;
+}
+
+bool web_server_wifi_is_enabled(void)
+{
+    return false;
+}
+
+// ============================================================================
+// RECORDERS
+// ============================================================================
+
+void trace_record(const trace_record_t *record)
+{
+    last_rec = *record;
+    have_rec = true;
+}
+
+bool host_take_record(trace_record_t *out)
+{
+    if (!have_rec) {
+        return false;
+    }
+    *out = last_rec;
+    have_rec = false;
+    return true;
+}
+
+void blackbox_mirror(const trace_record_t *record)
+{
+    (void)record;
+}
+
+void blackbox_trigger(blackbox_cause_t cause)
+{
+    (void)cause;
+}
+
+void udp_log_telemetry(const trace_record_t *record)
+{
+    (void)record;
+}
+
+bool capture_is_enabled(void)
+{
+    return false;
+}
+
+bool capture_record(const capture_sample_t *sample)
+{
+    (void)sample;
+    return false;
+}
+
+// ============================================================================
+// FIRMWARE MODULES
+// ============================================================================
+
+esp_err_t dshot_init(int gpio)
+{
+    // ESC_PROTOCOL is PWM on the host; never reached
+    (void)gpio;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t dshot_write(uint16_t pulse_us)
+{
+    (void)pulse_us;
+    return ESP_ERR_INVALID_STATE;
+}
+
+bool dshot_get_velocity(int16_t *velocity)
+{
+    // No ESC telemetry: the model keeps the recorded input path
+    (void)velocity;
+    return false;
+}
+
+esp_err_t nvs_storage_save_deferred(nvs_blob_t blob, const void *data, size_t len)
+{
+    (void)blob;
+    (void)data;
+    (void)len;
+    return ESP_OK;
+}
+
+esp_err_t nvs_storage_load(nvs_blob_t blob, const nvs_schema_t *schema, void *config)
+{
+    // Nothing stored: config keeps the defaults (the replay applies --tuning itself)
+    (void)blob;
+    (void)schema;
+    (void)config;
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t preset_select(uint8_t index)
+{
+    // Recordings hold the live config; a menu preset switch changes nothing here
+    (void)index;
+    return ESP_OK;
+}
+
+uint8_t preset_get_active(void)
+{
+    return 0;
+}
+
+bool preset_get_name(uint8_t index, char *name)
+{
+    (void)index;
+    name[0] = '\0';
+    return false;
+}
+
+uint32_t rc_input_get_frame_edge_us(void)
+{
+    return (uint32_t)host_time_us;
+}
+
+esp_err_t sound_play_prompt(const int8_t *samples, uint32_t sample_count,
+                            uint32_t sample_rate, uint8_t volume, bool barge_in)
+{
+    (void)samples;
+    (void)sample_count;
+    (void)sample_rate;
+    (void)volume;
+    (void)barge_in;
+    return ESP_OK;
+}
+
+esp_err_t sound_play_mode_beep(steering_mode_t mode)
+{
+    (void)mode;
+    return ESP_OK;
+}
+
+void audio_mixer_wake(void)
+{
+}
+
+bool sound_pack_find(const char *name, sound_pack_clip_t *clip)
+{
+    (void)name;
+    (void)clip;
+    return false;
+}
+
+int sound_pack_profile_count(void)
+{
+    return 0;
+}
+
+const sound_profile_def_t *sound_pack_get_profile(int index)
+{
+    (void)index;
+    return NULL;
+}
+
+void bench_measure(bench_fn_t fn, void *arg, uint32_t runs, bench_stat_t *stat)
+{
+    // engine_sound_bench_mix() is firmware-only
+    (void)fn;
+    (void)arg;
+    *stat = (bench_stat_t){ .runs = runs };
+}
+
+// ============================================================================
+// PERF
+// ============================================================================
+
+void perf_mark_loop_entry(uint32_t edge_us)
+{
+    (void)edge_us;
+}
+
+void perf_mark_output(void)
+{
+}
+
+void perf_stage_end(perf_stage_t stage, uint32_t start_cycles)
+{
+    (void)stage;
+    (void)start_cycles;
+}
+
+// ============================================================================
+// HEALTH
+// ============================================================================
+
+// Replayed ticks never stall
+bool health_failsafe_active(void)
+{
+    return false;
+}
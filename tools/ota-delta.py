@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""
+Delta OTA builder for 8x8 Crawler
+
+Encodes a new app image as COPY ops against the image running on the
+crawler plus DATA ops for the bytes that changed, in the format applied by
+main/ota_delta.c. Sound tables and other unchanged data turn into a few
+COPY ops even when the linker moved them, so a typical update uploads only
+the rewritten code. Upload the result from the Settings page like a
+firmware image; the crawler checks that it runs the source image first and
+verifies the patched image's SHA-256 before booting it.
+
+Keep the .bin of every release you flash: it is the source for the next
+delta.
+
+Usage:
+  ota-delta.py [--gzip] running.bin new.bin out.delta
+"""
+
+import argparse
+import gzip
+import hashlib
+import struct
+
+# Must match main/ota_delta.h
+MAGIC = 0x41544C44      # "DLTA"
+VERSION = 1
+HEADER = struct.Struct('<IHHII32s32s')
+OP = struct.Struct('<II')
+OP_COPY = 0x80000000
+
+BLOCK = 32              # Match granularity: shorter runs stay DATA
+CHUNK = 256             # Bytes compared at once when growing a match
+
+
+def index_source(source):
+    """Map every aligned BLOCK of the source to its first offset"""
+    index = {}
+    for pos in range(0, len(source) - BLOCK + 1, BLOCK):
+        index.setdefault(source[pos:pos + BLOCK], pos)
+    return index
+
+
+def match_length(source, s, target, t):
+    """Length of the common run at source[s:] and target[t:]"""
+    n = 0
+    limit = min(len(source) - s, len(target) - t)
+    while n + CHUNK <= limit and source[s + n:s + n + CHUNK] == target[t + n:t + n + CHUNK]:
+        n += CHUNK
+    while n < limit and source[s + n] == target[t + n]:
+        n += 1
+    return n
+
+
+def encode(source, target):
+    """Yield ('copy', offset, length) and ('data', bytes) ops"""
+    index = index_source(source)
+    literal_start = 0
+    t = 0
+    while t + BLOCK <= len(target):
+        s = index.get(target[t:t + BLOCK])
+        if s is None:
+            t += 1
+            continue
+
+        # Grow the match backwards into the pending literal, then forwards
+        back = 0
+        while back < t - literal_start and back < s and source[s - back - 1] == target[t - back - 1]:
+            back += 1
+        length = back + match_length(source, s, target, t)
+        s -= back
+        t -= back
+
+        if t > literal_start:
+            yield ('data', target[literal_start:t])
+        yield ('copy', s, length)
+        t += length
+        literal_start = t
+
+    if literal_start < len(target):
+        yield ('data', target[literal_start:])
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Build a delta OTA image')
+    ap.add_argument('--gzip', action='store_true', help='Also gzip the delta (inflated on the crawler)')
+    ap.add_argument('source', help='App image running on the crawler')
+    ap.add_argument('target', help='New app image')
+    ap.add_argument('out', help='Delta to write')
+    args = ap.parse_args()
+
+    with open(args.source, 'rb') as f:
+        source = f.read()
+    with open(args.target, 'rb') as f:
+        target = f.read()
+
+    body = bytearray()
+    copied = 0
+    for op in encode(source, target):
+        if op[0] == 'copy':
+            body += OP.pack(op[2] | OP_COPY, op[1])
+            copied += op[2]
+        else:
+            body += OP.pack(len(op[1]), 0)
+            body += op[1]
+
+    header = HEADER.pack(MAGIC, VERSION, 0, len(source), len(target),
+                         hashlib.sha256(source).digest(), hashlib.sha256(target).digest())
+    delta = header + bytes(body)
+    if args.gzip:
+        delta = gzip.compress(delta, compresslevel=9, mtime=0)
+
+    with open(args.out, 'wb') as f:
+        f.write(delta)
+    print(f'{args.out}: {len(delta)} bytes for a {len(target)} byte image '
+          f'({100 * copied // max(len(target), 1)}% copied from the running image)')
+
+
+if __name__ == '__main__':
+    main()
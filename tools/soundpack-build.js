@@ -0,0 +1,230 @@
+#!/usr/bin/env node
+/**
+ * Sound pack builder for 8x8 Crawler
+ *
+ * Packs WAV files (converted by tools/wav2asset.py, the same path the
+ * firmware build uses) or generated sample headers (8-bit PCM or
+ * tools/adpcm-encode.js output) into the image read by main/sound_pack.c, then flash it to the
+ * "sounds" partition without rebuilding the firmware:
+ *
+ *   node tools/soundpack-build.js pack.json sounds.bin
+ *   parttool.py write_partition --partition-name sounds --input sounds.bin
+ *
+ * Manifest (paths relative to the manifest file):
+ *   {
+ *     "profiles": [
+ *       { "name": "Scania V8", "description": "Swedish V8 truck", "cylinders": 8,
+ *         "idle": "scania/idle.h", "rev": "scania/rev.h", "knock": "scania/knock.h",
+ *         "start": "scania/start.h", "jake_brake": "scania/jake.h" }
+ *     ],
+ *     "horns": { "horn_dixie": "horns/dixie.wav" },
+ *     "rate": 22050
+ *   }
+ *
+ * "rate" (optional) resamples WAV clips; loop points come from the WAV
+ * 'smpl' chunk or the header LoopBegin/LoopEnd constants.
+ *
+ * Profile clips idle, rev, knock and start are required (idle and knock
+ * must be PCM); jake_brake, shifting and wastegate are optional. Horn keys
+ * are the pack names in engine_sound.c horn_clips[].
+ */
+
+const fs = require('fs');
+const path = require('path');
+const { execFileSync } = require('child_process');
+
+// Must match main/sound_pack.h and main/adpcm.h
+const MAGIC = 0x50444E53;
+const VERSION = 1;
+const HEADER_SIZE = 32;
+const ENTRY_SIZE = 48;
+const PROFILE_SIZE = 88;
+const NAME_LEN = 24;
+const DESC_LEN = 48;
+const NO_CLIP = 0xFFFF;
+const MAX_PROFILES = 8;
+const FORMAT_PCM8 = 0;
+const FORMAT_IMA_ADPCM = 1;
+const ADPCM_BLOCK_SAMPLES = 256;
+const ADPCM_BLOCK_BYTES = 132;
+const CLIP_FIELDS = ['idle', 'rev', 'knock', 'start', 'jake_brake', 'shifting', 'wastegate'];
+const REQUIRED_FIELDS = ['idle', 'rev', 'knock', 'start'];
+
+function fail(msg) {
+    console.error(msg);
+    process.exit(1);
+}
+
+function crc32(buf) {
+    let crc = 0xFFFFFFFF;
+    for (let i = 0; i < buf.length; i++) {
+        crc ^= buf[i];
+        for (let k = 0; k < 8; k++) {
+            crc = (crc >>> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return (crc ^ 0xFFFFFFFF) >>> 0;
+}
+
+function constant(src, suffix) {
+    const m = src.match(new RegExp(`const\\s+unsigned\\s+int\\s+\\w*${suffix}\\s*=\\s*(\\d+)\\s*;`));
+    return m ? Number(m[1]) : undefined;
+}
+
+/**
+ * Convert a WAV file with tools/wav2asset.py
+ */
+function loadWav(file, rate) {
+    const args = [path.join(__dirname, 'wav2asset.py'), '--json', file];
+    if (rate) args.push('--rate', String(rate));
+    let out;
+    try {
+        out = execFileSync(process.platform === 'win32' ? 'python' : 'python3', args, { encoding: 'utf8' });
+    } catch (e) {
+        fail(`${file}: wav2asset.py failed`);
+    }
+    const clip = JSON.parse(out);
+    const data = Buffer.from(clip.samples, 'base64');
+    return {
+        file,
+        format: FORMAT_PCM8,
+        data,
+        count: data.length,
+        rate: clip.rate,
+        loopBegin: clip.loop_begin,
+        loopEnd: clip.loop_end,
+    };
+}
+
+/**
+ * Parse a WAV or sample header into { format, data, count, rate, loopBegin, loopEnd }
+ */
+function loadClip(file, wavRate) {
+    if (path.extname(file).toLowerCase() === '.wav') {
+        return loadWav(file, wavRate);
+    }
+    const src = fs.readFileSync(file, 'utf8');
+    const array = src.match(/const\s+(signed|unsigned)\s+char\s+\w+\[\]\s*=\s*\{([\s\S]*?)\};/);
+    if (!array) fail(`${file}: no sample array found`);
+
+    const values = array[2].replace(/\/\/.*$/gm, '').split(',')
+        .map(s => s.trim()).filter(s => s.length).map(Number);
+    if (values.some(Number.isNaN)) fail(`${file}: could not parse sample values`);
+
+    const format = array[1] === 'unsigned' ? FORMAT_IMA_ADPCM : FORMAT_PCM8;
+    const count = constant(src, 'SampleCount') ?? values.length;
+    const rate = constant(src, 'SampleRate');
+    if (!rate) fail(`${file}: no SampleRate constant`);
+
+    if (format === FORMAT_IMA_ADPCM) {
+        const rest = count % ADPCM_BLOCK_SAMPLES;
+        const expect = Math.floor(count / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES +
+                       (rest ? 4 + Math.ceil(rest / 2) : 0);
+        if (values.length !== expect) fail(`${file}: ${values.length} ADPCM bytes, expected ${expect}`);
+    } else if (values.length !== count) {
+        fail(`${file}: ${values.length} samples, SampleCount says ${count}`);
+    }
+
+    return {
+        file,
+        format,
+        data: Buffer.from(values.map(v => v & 0xFF)),
+        count,
+        rate,
+        loopBegin: constant(src, 'LoopBegin') ?? 0,
+        loopEnd: constant(src, 'LoopEnd') ?? 0,
+    };
+}
+
+function writeString(buf, offset, str, len, what) {
+    const bytes = Buffer.from(str || '', 'utf8');
+    if (bytes.length >= len) fail(`${what} "${str}" is longer than ${len - 1} bytes`);
+    bytes.copy(buf, offset);
+}
+
+function main() {
+    const [manifestPath, output] = process.argv.slice(2);
+    if (!manifestPath || !output) fail('Usage: node tools/soundpack-build.js <pack.json> <sounds.bin>');
+
+    const manifest = JSON.parse(fs.readFileSync(manifestPath, 'utf8'));
+    const dir = path.dirname(manifestPath);
+    const profiles = manifest.profiles || [];
+    const horns = manifest.horns || {};
+    if (profiles.length > MAX_PROFILES) fail(`At most ${MAX_PROFILES} profiles`);
+
+    // Clip directory; the same file used twice is stored once
+    const entries = [];
+    const byFile = new Map();
+    function addClip(rel, name) {
+        const file = path.resolve(dir, rel);
+        if (!byFile.has(file)) {
+            byFile.set(file, entries.length);
+            entries.push({ name, clip: loadClip(file, manifest.rate) });
+        }
+        return byFile.get(file);
+    }
+
+    const profileRecords = profiles.map((p, pi) => {
+        const rec = { p, clips: {} };
+        for (const field of CLIP_FIELDS) {
+            if (!p[field]) {
+                if (REQUIRED_FIELDS.includes(field)) fail(`Profile ${pi}: missing "${field}"`);
+                rec.clips[field] = NO_CLIP;
+                continue;
+            }
+            rec.clips[field] = addClip(p[field], `p${pi}_${field}`);
+            const fmt = entries[rec.clips[field]].clip.format;
+            if ((field === 'idle' || field === 'knock') && fmt !== FORMAT_PCM8) {
+                fail(`Profile ${pi}: "${field}" must be PCM`);
+            }
+        }
+        return rec;
+    });
+    for (const [name, rel] of Object.entries(horns)) {
+        // Horns are looked up by name, so each gets its own entry
+        const file = path.resolve(dir, rel);
+        byFile.delete(file);
+        addClip(rel, name);
+    }
+
+    // Layout: header, directory, profiles, then 4-byte aligned clip data
+    let offset = HEADER_SIZE + entries.length * ENTRY_SIZE + profileRecords.length * PROFILE_SIZE;
+    for (const e of entries) {
+        offset = (offset + 3) & ~3;
+        e.offset = offset;
+        offset += e.clip.data.length;
+    }
+    const image = Buffer.alloc(offset);
+
+    entries.forEach((e, i) => {
+        const o = HEADER_SIZE + i * ENTRY_SIZE;
+        writeString(image, o, e.name, NAME_LEN, 'Clip name');
+        image.writeUInt32LE(e.offset, o + 24);
+        image.writeUInt32LE(e.clip.count, o + 28);
+        image.writeUInt32LE(e.clip.rate, o + 32);
+        image.writeUInt32LE(e.clip.loopBegin, o + 36);
+        image.writeUInt32LE(e.clip.loopEnd, o + 40);
+        image.writeUInt8(e.clip.format, o + 44);
+        e.clip.data.copy(image, e.offset);
+    });
+
+    profileRecords.forEach((r, i) => {
+        const o = HEADER_SIZE + entries.length * ENTRY_SIZE + i * PROFILE_SIZE;
+        writeString(image, o, r.p.name, NAME_LEN, 'Profile name');
+        writeString(image, o + NAME_LEN, r.p.description, DESC_LEN, 'Profile description');
+        CLIP_FIELDS.forEach((field, k) => image.writeUInt16LE(r.clips[field], o + 72 + k * 2));
+        image.writeUInt8(r.p.cylinders || 6, o + 86);
+    });
+
+    image.writeUInt32LE(MAGIC, 0);
+    image.writeUInt16LE(VERSION, 4);
+    image.writeUInt16LE(entries.length, 6);
+    image.writeUInt16LE(profileRecords.length, 8);
+    image.writeUInt32LE(image.length, 12);
+    image.writeUInt32LE(crc32(image.subarray(HEADER_SIZE)), 16);
+
+    fs.writeFileSync(output, image);
+    console.log(`${output}: ${entries.length} clips, ${profileRecords.length} profiles, ${image.length} bytes`);
+}
+
+main();
@@ -0,0 +1,220 @@
+#!/usr/bin/env node
+/**
+ * Timeline Decoder for 8x8 Crawler
+ *
+ * Turns a /api/trace/timeline download (CONFIG_CRAWLER_TIMELINE builds) into
+ * Chrome trace event JSON, which ui.perfetto.dev and chrome://tracing open.
+ * Each core is a process with a track for the running task, one for the
+ * traced ISR callbacks and one per marker (control tick, mixer block,
+ * WebSocket send). A deadline miss that froze an armed ring is an instant
+ * event across all tracks.
+ *
+ * Usage:
+ *   node tools/timeline-decode.js <timeline.bin | http://192.168.4.1/api/trace/timeline> [out.json]
+ *
+ * Without out.json the JSON goes to stdout. The layout follows
+ * timeline_file_header_t / timeline_task_name_t / timeline_event_t in
+ * main/timeline.h.
+ */
+
+const fs = require('fs');
+
+const MAGIC = 0x4E4C4D54;   // "TMLN"
+const VERSION = 1;
+const HEADER_SIZE = 24;
+const NAME_SIZE = 20;
+const NAME_LEN = 16;
+const EVENT_SIZE = 12;
+
+const EV_TASK = 0;
+const EV_ISR_ENTER = 1;
+const EV_ISR_EXIT = 2;
+const EV_MARK_BEGIN = 3;
+const EV_MARK_END = 4;
+const EV_TRIGGER = 5;
+
+// timeline_isr_t and timeline_mark_t
+const ISR_NAMES = ['rc capture', 'rc ppm', 'servo timer', 'i2s sent', 'rmt lights'];
+const MARK_NAMES = ['control tick', 'mixer block', 'ws send'];
+
+const TID_TASKS = 0;
+const TID_ISRS = 1;
+const TID_MARKS = 10;
+
+async function load(source) {
+    if (/^https?:\/\//.test(source)) {
+        const res = await fetch(source);
+        if (!res.ok) throw new Error(`${source}: HTTP ${res.status}`);
+        return Buffer.from(await res.arrayBuffer());
+    }
+    return fs.readFileSync(source);
+}
+
+function decode(buf) {
+    if (buf.length < HEADER_SIZE || buf.readUInt32LE(0) !== MAGIC) {
+        throw new Error('Not a timeline download');
+    }
+    const header = {
+        version: buf.readUInt16LE(4),
+        eventSize: buf.readUInt16LE(6),
+        count: buf.readUInt32LE(8),
+        capacity: buf.readUInt32LE(12),
+        taskCount: buf.readUInt16LE(16),
+        triggered: buf.readUInt8(18) !== 0,
+        uptimeMs: buf.readUInt32LE(20)
+    };
+    if (header.version !== VERSION) {
+        throw new Error(`Unsupported timeline version ${header.version}`);
+    }
+    if (header.eventSize !== EVENT_SIZE) {
+        throw new Error(`Unsupported event size ${header.eventSize}`);
+    }
+
+    const tasks = new Map();
+    let p = HEADER_SIZE;
+    for (let i = 0; i < header.taskCount && p + NAME_SIZE <= buf.length; i++, p += NAME_SIZE) {
+        const raw = buf.subarray(p + 4, p + 4 + NAME_LEN);
+        const end = raw.indexOf(0);
+        tasks.set(buf.readUInt32LE(p), raw.subarray(0, end < 0 ? NAME_LEN : end).toString('latin1'));
+    }
+
+    // Events hold the low 32 bits of the microsecond clock. The two cores
+    // claim slots a little out of time order, so only a large step back
+    // is a wrap.
+    const events = [];
+    let wraps = 0;
+    let prevT = null;
+    const available = Math.floor((buf.length - p) / EVENT_SIZE);
+    for (let n = 0; n < Math.min(header.count, available); n++, p += EVENT_SIZE) {
+        const t = buf.readUInt32LE(p);
+        if (prevT !== null && t < prevT && prevT - t > 0x80000000) wraps++;
+        prevT = t;
+        events.push({
+            t: wraps * 4294967296 + t,
+            arg: buf.readUInt32LE(p + 4),
+            type: buf.readUInt8(p + 8),
+            core: buf.readUInt8(p + 9)
+        });
+    }
+    events.sort((a, b) => a.t - b.t);
+    return { header, tasks, events };
+}
+
+function taskName(tasks, handle) {
+    return tasks.get(handle) || `task 0x${handle.toString(16).padStart(8, '0')}`;
+}
+
+function toChromeTrace({ header, tasks, events }) {
+    const out = [];
+    const t0 = events.length ? events[0].t : 0;
+    const tEnd = events.length ? events[events.length - 1].t - t0 : 0;
+    const cores = new Set(events.map(e => e.core));
+
+    for (const core of cores) {
+        out.push({ name: 'process_name', ph: 'M', pid: core, args: { name: `Core ${core}` } });
+        out.push({ name: 'process_sort_index', ph: 'M', pid: core, args: { sort_index: core } });
+        out.push({ name: 'thread_name', ph: 'M', pid: core, tid: TID_TASKS, args: { name: 'Tasks' } });
+        out.push({ name: 'thread_name', ph: 'M', pid: core, tid: TID_ISRS, args: { name: 'ISRs' } });
+        MARK_NAMES.forEach((name, i) => {
+            out.push({ name: 'thread_name', ph: 'M', pid: core, tid: TID_MARKS + i, args: { name } });
+        });
+    }
+
+    // Running task per core becomes complete slices; spans are B/E pairs,
+    // with ends whose begin fell off the ring dropped and open ones closed
+    // at the last event
+    const running = new Map();      // core -> { name, ts }
+    const open = new Map();         // "core/tid" -> [names]
+    const begin = (pid, tid, name, ts) => {
+        const key = `${pid}/${tid}`;
+        if (!open.has(key)) open.set(key, []);
+        open.get(key).push(name);
+        out.push({ name, ph: 'B', pid, tid, ts });
+    };
+    const end = (pid, tid, ts) => {
+        const stack = open.get(`${pid}/${tid}`);
+        if (stack && stack.length) {
+            out.push({ name: stack.pop(), ph: 'E', pid, tid, ts });
+        }
+    };
+
+    for (const e of events) {
+        const ts = e.t - t0;
+        switch (e.type) {
+            case EV_TASK: {
+                const prev = running.get(e.core);
+                if (prev) {
+                    out.push({ name: prev.name, ph: 'X', pid: e.core, tid: TID_TASKS, ts: prev.ts, dur: ts - prev.ts });
+                }
+                running.set(e.core, { name: taskName(tasks, e.arg), ts });
+                break;
+            }
+            case EV_ISR_ENTER:
+                begin(e.core, TID_ISRS, ISR_NAMES[e.arg] || `isr ${e.arg}`, ts);
+                break;
+            case EV_ISR_EXIT:
+                end(e.core, TID_ISRS, ts);
+                break;
+            case EV_MARK_BEGIN:
+                begin(e.core, TID_MARKS + e.arg, MARK_NAMES[e.arg] || `mark ${e.arg}`, ts);
+                break;
+            case EV_MARK_END:
+                end(e.core, TID_MARKS + e.arg, ts);
+                break;
+            case EV_TRIGGER:
+                out.push({ name: 'deadline miss', ph: 'i', s: 'g', pid: e.core, tid: TID_MARKS, ts });
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (const [core, prev] of running) {
+        out.push({ name: prev.name, ph: 'X', pid: core, tid: TID_TASKS, ts: prev.ts, dur: tEnd - prev.ts });
+    }
+    for (const [key, stack] of open) {
+        const [pid, tid] = key.split('/').map(Number);
+        while (stack.length) {
+            out.push({ name: stack.pop(), ph: 'E', pid, tid, ts: tEnd });
+        }
+    }
+
+    return {
+        traceEvents: out,
+        displayTimeUnit: 'ms',
+        metadata: {
+            source: '8x8 crawler /api/trace/timeline',
+            uptimeMs: header.uptimeMs,
+            triggered: header.triggered
+        }
+    };
+}
+
+async function main() {
+    const [source, out] = process.argv.slice(2);
+    if (!source) {
+        console.error('Usage: node tools/timeline-decode.js <timeline.bin | url> [out.json]');
+        process.exit(1);
+    }
+
+    const timeline = decode(await load(source));
+    const { header, tasks, events } = timeline;
+    const span = events.length ? (events[events.length - 1].t - events[0].t) / 1000 : 0;
+    console.error(`${events.length}/${header.capacity} events, ${span.toFixed(1)} ms, ${tasks.size} tasks named, ` +
+                  `${header.triggered ? 'frozen on a deadline miss' : 'free running'}, ` +
+                  `downloaded at ${(header.uptimeMs / 1000).toFixed(1)} s uptime`);
+
+    const json = JSON.stringify(toChromeTrace(timeline));
+    if (out) {
+        fs.writeFileSync(out, json);
+    } else {
+        process.stdout.write(json + '\n');
+    }
+}
+
+if (require.main === module) {
+    main().catch((err) => {
+        console.error(err.message);
+        process.exit(1);
+    });
+}
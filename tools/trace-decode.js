@@ -0,0 +1,167 @@
+#!/usr/bin/env node
+/**
+ * Flight Recorder Decoder for 8x8 Crawler
+ *
+ * Turns a /api/trace download into CSV (one row per control tick).
+ *
+ * Usage:
+ *   node tools/trace-decode.js <trace.bin | http://192.168.4.1/api/trace> [out.csv]
+ *
+ * Without out.csv the CSV goes to stdout. The layout follows
+ * trace_file_header_t / trace_record_t in main/trace.h. The record decoder
+ * is shared with tools/udp-listen.js (telemetry).
+ */
+
+const fs = require('fs');
+
+const MAGIC = 0x45435254;   // "TRCE"
+const VERSION = 1;
+const HEADER_SIZE = 24;
+const RECORD_FIXED_SIZE = 28;   // trace_record_t without the servo pulses
+const RC_CHANNELS = 6;
+const AXLE_COUNT_MAX = 5;
+
+const STEERING_MODES = ['front', 'rear', 'all-axle', 'crab'];
+const THROTTLE_MODES = ['direct', 'neutral', 'realistic'];
+const FLAGS = [
+    [1 << 0, 'failsafe'],
+    [1 << 1, 'braking'],
+    [1 << 2, 'servo-test'],
+    [1 << 3, 'menu'],
+    [1 << 4, 'ui-mode']
+];
+
+async function load(source) {
+    if (/^https?:\/\//.test(source)) {
+        const res = await fetch(source);
+        if (!res.ok) throw new Error(`${source}: HTTP ${res.status}`);
+        return Buffer.from(await res.arrayBuffer());
+    }
+    return fs.readFileSync(source);
+}
+
+/**
+ * Servo pulses per record (the build's AXLE_COUNT) for a record size, or 0
+ * if the size is not one of the known layouts
+ */
+function recordServos(recordSize) {
+    const n = (recordSize - RECORD_FIXED_SIZE) / 2;
+    return Number.isInteger(n) && n >= 2 && n <= AXLE_COUNT_MAX ? n : 0;
+}
+
+/**
+ * Decode one trace_record_t at offset p. clock carries the microsecond
+ * wrap count across calls ({ wraps: 0, prevT: null } to start).
+ */
+function decodeRecord(buf, p, clock, servos) {
+    const t = buf.readUInt32LE(p);
+    if (clock.prevT !== null && t < clock.prevT) clock.wraps++;
+    clock.prevT = t;
+
+    const input = [];
+    for (let i = 0; i < RC_CHANNELS; i++) input.push(buf.readInt16LE(p + 4 + i * 2));
+    let q = p + 4 + RC_CHANNELS * 2;
+    const velocity = buf.readInt16LE(q);
+    const steer = buf.readInt16LE(q + 2);
+    const esc = buf.readUInt16LE(q + 4);
+    q += 6;
+    const servo = [];
+    for (let i = 0; i < servos; i++) servo.push(buf.readUInt16LE(q + i * 2));
+    q += servos * 2;
+    const rpm = buf.readUInt16LE(q);
+    const gear = buf.readUInt8(q + 2);
+    const modes = buf.readUInt8(q + 3);
+    const flags = buf.readUInt8(q + 4);
+
+    return {
+        t: (clock.wraps * 4294967296 + t) / 1e6,
+        input, velocity, steer, esc, servo, rpm, gear,
+        steeringMode: STEERING_MODES[modes & 0x03],
+        throttleMode: THROTTLE_MODES[(modes >> 2) & 0x03] || '?',
+        flags: FLAGS.filter(([bit]) => flags & bit).map(([, name]) => name).join('|')
+    };
+}
+
+function decode(buf) {
+    if (buf.length < HEADER_SIZE || buf.readUInt32LE(0) !== MAGIC) {
+        throw new Error('Not a flight recorder download');
+    }
+    const header = {
+        version: buf.readUInt16LE(4),
+        recordSize: buf.readUInt16LE(6),
+        count: buf.readUInt32LE(8),
+        capacity: buf.readUInt32LE(12),
+        rateHz: buf.readUInt16LE(16),
+        uptimeMs: buf.readUInt32LE(20)
+    };
+    if (header.version !== VERSION) {
+        throw new Error(`Unsupported trace version ${header.version}`);
+    }
+    header.servos = recordServos(header.recordSize);
+    if (!header.servos) {
+        throw new Error(`Unsupported record size ${header.recordSize}`);
+    }
+
+    // Records hold the low 32 bits of the microsecond clock: unwrap them
+    const rows = [];
+    const clock = { wraps: 0, prevT: null };
+    const available = Math.floor((buf.length - HEADER_SIZE) / header.recordSize);
+    for (let n = 0; n < Math.min(header.count, available); n++) {
+        rows.push(decodeRecord(buf, HEADER_SIZE + n * header.recordSize, clock, header.servos));
+    }
+    return { header, rows };
+}
+
+function csvHeader(servos) {
+    return [
+        'time_s', 'throttle', 'steering', 'aux1', 'aux2', 'aux3', 'aux4',
+        'velocity', 'steer', 'esc_us', ...Array.from({ length: servos }, (_, i) => `servo${i + 1}_us`),
+        'rpm', 'gear', 'steering_mode', 'throttle_mode', 'flags'
+    ].join(',');
+}
+
+function csvRow(r, t0) {
+    return [
+        (r.t - t0).toFixed(6), ...r.input, r.velocity, r.steer, r.esc, ...r.servo,
+        r.rpm, r.gear, r.steeringMode, r.throttleMode, r.flags
+    ].join(',');
+}
+
+function toCsv({ header, rows }) {
+    const t0 = rows.length ? rows[0].t : 0;
+    const lines = [csvHeader(header.servos)];
+    for (const r of rows) {
+        lines.push(csvRow(r, t0));
+    }
+    return lines.join('\n') + '\n';
+}
+
+async function main() {
+    const [source, out] = process.argv.slice(2);
+    if (!source) {
+        console.error('Usage: node tools/trace-decode.js <trace.bin | url> [out.csv]');
+        process.exit(1);
+    }
+
+    const trace = decode(await load(source));
+    const { header, rows } = trace;
+    const span = rows.length ? rows[rows.length - 1].t - rows[0].t : 0;
+    console.error(`${rows.length}/${header.capacity} records, ${span.toFixed(1)} s, ` +
+                  `loop ${header.rateHz} Hz, downloaded at ${(header.uptimeMs / 1000).toFixed(1)} s uptime`);
+
+    const csv = toCsv(trace);
+    if (out) {
+        fs.writeFileSync(out, csv);
+    } else {
+        process.stdout.write(csv);
+    }
+}
+
+module.exports = { recordServos, decodeRecord, csvHeader, csvRow };
+
+if (require.main === module) {
+    main().catch((err) => {
+        console.error(err.message);
+        process.exit(1);
+    });
+}
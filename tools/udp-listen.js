@@ -2,42 +2,141 @@
 /**
  * UDP Log Listener for 8x8 Crawler
  *
- * Listens for ESP32 log messages broadcast over UDP.
+ * Listens for ESP32 log messages broadcast over UDP, or subscribes to the
+ * binary telemetry stream (one trace record per control tick).
  *
  * Usage:
  *   node tools/udp-listen.js [port]
+ *   node tools/udp-listen.js --telemetry <crawler-ip> [hz] [out.csv]
  *
- * Default port: 5555
+ * Default port: 5555. Telemetry is requested from port 5556 at 100 Hz by
+ * default; rows go to stdout, or to out.csv with a progress line instead.
+ * The layout follows udp_telemetry_header_t in main/udp_log.h.
  *
  * Note: Connect to the 8x8-Crawler WiFi network first.
  */
 
 const dgram = require('dgram');
+const fs = require('fs');
+const { recordServos, decodeRecord, csvHeader, csvRow } = require('./trace-decode');
 
-const PORT = parseInt(process.argv[2]) || 5555;
-const server = dgram.createSocket('udp4');
+const TELEMETRY_PORT = 5556;
+const TELEMETRY_MAGIC = 0x594D4C54;    // "TLMY"
+const TELEMETRY_VERSION = 1;
+const TELEMETRY_HEADER_SIZE = 24;
+const TELEMETRY_RENEW_MS = 2000;       // Crawler drops the subscription after 5 s
 
-server.on('error', (err) => {
-    console.error(`Server error:\n${err.stack}`);
-    server.close();
-});
+function listenLogs(port) {
+    const server = dgram.createSocket('udp4');
 
-server.on('message', (msg, rinfo) => {
-    // Print message without extra newline (ESP logs usually include one)
-    const text = msg.toString('utf8');
-    process.stdout.write(text);
-    if (!text.endsWith('\n')) {
-        process.stdout.write('\n');
+    server.on('error', (err) => {
+        console.error(`Server error:\n${err.stack}`);
+        server.close();
+    });
+
+    server.on('message', (msg, rinfo) => {
+        // Print message without extra newline (ESP logs usually include one)
+        const text = msg.toString('utf8');
+        process.stdout.write(text);
+        if (!text.endsWith('\n')) {
+            process.stdout.write('\n');
+        }
+    });
+
+    server.on('listening', () => {
+        const address = server.address();
+        console.log(`=== UDP Log Listener ===`);
+        console.log(`Listening on port ${address.port}`);
+        console.log(`Connect to 8x8-Crawler WiFi to receive logs`);
+        console.log(`Press Ctrl+C to exit`);
+        console.log(`========================\n`);
+    });
+
+    server.bind(port);
+}
+
+function listenTelemetry(host, hz, out) {
+    const socket = dgram.createSocket('udp4');
+    const sink = out ? fs.createWriteStream(out) : process.stdout;
+    const clock = { wraps: 0, prevT: null };
+    let t0 = null;
+    let nextSeq = null;
+    let nextRecord = null;
+    let rows = 0;
+    let headerWritten = false;
+    let lostDatagrams = 0;
+    let gapRecords = 0;
+    let dropped = 0;
+
+    const subscribe = (rate) => socket.send(`TLM ${rate}`, TELEMETRY_PORT, host);
+
+    socket.on('error', (err) => {
+        console.error(`Socket error:\n${err.stack}`);
+        socket.close();
+    });
+
+    socket.on('message', (msg) => {
+        if (msg.length < TELEMETRY_HEADER_SIZE || msg.readUInt32LE(0) !== TELEMETRY_MAGIC) return;
+        const recordSize = msg.readUInt16LE(6);
+        const servos = recordServos(recordSize);
+        if (msg.readUInt16LE(4) !== TELEMETRY_VERSION || !servos) {
+            console.error('Unsupported telemetry format, update tools/');
+            process.exit(1);
+        }
+        if (!headerWritten) {
+            sink.write(csvHeader(servos) + '\n');     // Column count follows the build's axles
+            headerWritten = true;
+        }
+        const seq = msg.readUInt32LE(8);
+        const first = msg.readUInt32LE(12);
+        const count = msg.readUInt16LE(16);
+        dropped = msg.readUInt32LE(20);
+
+        // Datagrams lost on the air show up as holes in seq and first
+        if (nextSeq !== null && seq > nextSeq) lostDatagrams += seq - nextSeq;
+        if (nextRecord !== null && first > nextRecord) gapRecords += first - nextRecord;
+        nextSeq = seq + 1;
+        nextRecord = first + count;
+
+        for (let n = 0; n < count && TELEMETRY_HEADER_SIZE + (n + 1) * recordSize <= msg.length; n++) {
+            const r = decodeRecord(msg, TELEMETRY_HEADER_SIZE + n * recordSize, clock, servos);
+            if (t0 === null) t0 = r.t;
+            sink.write(csvRow(r, t0) + '\n');
+            rows++;
+        }
+    });
+
+    socket.on('listening', () => {
+        subscribe(hz);
+        setInterval(() => subscribe(hz), TELEMETRY_RENEW_MS);
+        if (out) {
+            setInterval(() => {
+                process.stderr.write(`\r${rows} rows, ${gapRecords} missed ` +
+                                     `(${lostDatagrams} datagrams lost, ${dropped} dropped on the crawler)`);
+            }, 1000);
+        }
+        console.error(`Telemetry from ${host}:${TELEMETRY_PORT} at ${hz} Hz, Ctrl+C to stop`);
+    });
+
+    process.on('SIGINT', () => {
+        subscribe(0);
+        setTimeout(() => {
+            console.error(`\n${rows} rows received`);
+            if (out) sink.end();
+            process.exit(0);
+        }, 100);
+    });
+
+    socket.bind();
+}
+
+const args = process.argv.slice(2);
+if (args[0] === '--telemetry') {
+    if (!args[1]) {
+        console.error('Usage: node tools/udp-listen.js --telemetry <crawler-ip> [hz] [out.csv]');
+        process.exit(1);
     }
-});
-
-server.on('listening', () => {
-    const address = server.address();
-    console.log(`=== UDP Log Listener ===`);
-    console.log(`Listening on port ${address.port}`);
-    console.log(`Connect to 8x8-Crawler WiFi to receive logs`);
-    console.log(`Press Ctrl+C to exit`);
-    console.log(`========================\n`);
-});
-
-server.bind(PORT);
+    listenTelemetry(args[1], parseInt(args[2]) || 100, args[3]);
+} else {
+    listenLogs(parseInt(args[0]) || 5555);
+}
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+WAV to binary sound asset converter for 8x8 Crawler
+
+Converts WAV files into raw signed 8-bit PCM blobs for EMBED_FILES /
+target_add_binary_data, plus a header with the rate, count and loop
+constants the firmware references. Replaces hand-generated C array
+headers; run from main/CMakeLists.txt at build time.
+
+The conversion matches generate-tts-sounds.ps1: mono 16-bit to 8-bit,
+nearest-sample resampling and optional silence trimming. Loop points come
+from the WAV 'smpl' chunk when present, otherwise the whole clip.
+
+Usage:
+  wav2asset.py --out-dir DIR --header NAME.h [--prefix P] [--rate HZ]
+               [--trim THRESHOLD] input.wav ...
+  wav2asset.py --json [--rate HZ] [--trim THRESHOLD] input.wav
+
+Each input.wav becomes DIR/input.pcm, embedded as
+_binary_input_pcm_start. The header defines <P><name>Samples,
+<P><name>SampleRate, <P><name>SampleCount, <P><name>LoopBegin and
+<P><name>LoopEnd. --json prints one clip (base64 samples) for
+tools/soundpack-build.js.
+"""
+
+import argparse
+import base64
+import json
+import os
+import struct
+import sys
+
+
+def read_wav(path):
+    """Return (rate, samples int8 list, loop_begin, loop_end or None)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[0:4] != b'RIFF' or data[8:12] != b'WAVE':
+        sys.exit(f'{path}: not a RIFF/WAVE file')
+
+    fmt = None
+    pcm = None
+    loop = None
+    pos = 12
+    while pos + 8 <= len(data):
+        cid, size = struct.unpack_from('<4sI', data, pos)
+        body = data[pos + 8:pos + 8 + size]
+        if cid == b'fmt ':
+            fmt = struct.unpack_from('<HHIIHH', body)
+        elif cid == b'data':
+            pcm = body
+        elif cid == b'smpl' and len(body) >= 60 and struct.unpack_from('<I', body, 28)[0] > 0:
+            start, end = struct.unpack_from('<II', body, 44)
+            loop = (start, end + 1)
+        pos += 8 + size + (size & 1)
+
+    if fmt is None or pcm is None:
+        sys.exit(f'{path}: missing fmt or data chunk')
+    tag, channels, rate, _, _, bits = fmt
+    if tag != 1 or bits not in (8, 16):
+        sys.exit(f'{path}: only 8/16-bit PCM is supported')
+
+    # First channel only, like the PowerShell generator
+    frame = channels * bits // 8
+    samples = []
+    for i in range(0, len(pcm) - frame + 1, frame):
+        if bits == 16:
+            s = round(struct.unpack_from('<h', pcm, i)[0] / 256)
+        else:
+            s = pcm[i] - 128
+        samples.append(max(-128, min(127, s)))
+    return rate, samples, loop
+
+
+def convert(path, target_rate, threshold):
+    """Return clip dict with rate, samples, loop_begin, loop_end"""
+    rate, samples, loop = read_wav(path)
+
+    if target_rate and rate != target_rate:
+        ratio = rate / target_rate
+        samples = [samples[int(i * ratio)] for i in range(int(len(samples) / ratio))]
+        if loop:
+            loop = (int(loop[0] / ratio), int(loop[1] / ratio))
+        rate = target_rate
+
+    # Trimming would move the loop points, so looped clips are kept whole
+    if threshold is not None and loop is None:
+        loud = [i for i, s in enumerate(samples) if abs(s) > threshold]
+        if loud:
+            start = max(0, loud[0] - int(rate * 0.02))
+            end = min(len(samples) - 1, loud[-1] + int(rate * 0.05))
+            samples = samples[start:end + 1]
+
+    loop_begin, loop_end = loop if loop else (0, len(samples))
+    return {
+        'rate': rate,
+        'samples': samples,
+        'loop_begin': min(loop_begin, len(samples)),
+        'loop_end': min(loop_end, len(samples)),
+    }
+
+
+def write_if_changed(path, content):
+    """Keep timestamps stable so unchanged assets don't trigger rebuilds"""
+    mode = 'wb' if isinstance(content, bytes) else 'w'
+    try:
+        with open(path, 'rb' if mode == 'wb' else 'r') as f:
+            if f.read() == content:
+                return
+    except OSError:
+        pass
+    with open(path, mode) as f:
+        f.write(content)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Convert WAV files to embedded sound assets')
+    ap.add_argument('inputs', nargs='+')
+    ap.add_argument('--out-dir')
+    ap.add_argument('--header')
+    ap.add_argument('--prefix', default='')
+    ap.add_argument('--rate', type=int, default=0, help='resample to this rate')
+    ap.add_argument('--trim', type=int, default=None, help='silence threshold (0-127)')
+    ap.add_argument('--json', action='store_true')
+    args = ap.parse_args()
+
+    if args.json:
+        clip = convert(args.inputs[0], args.rate, args.trim)
+        clip['samples'] = base64.b64encode(bytes(s & 0xFF for s in clip['samples'])).decode()
+        print(json.dumps(clip))
+        return
+
+    if not args.out_dir or not args.header:
+        ap.error('--out-dir and --header are required')
+    os.makedirs(args.out_dir, exist_ok=True)
+
+    guard = os.path.basename(args.header).upper().replace('.', '_').replace('-', '_')
+    lines = [
+        '// Generated by tools/wav2asset.py - do not edit',
+        f'#ifndef {guard}',
+        f'#define {guard}',
+        '',
+        '#include <stdint.h>',
+        '',
+    ]
+    for path in sorted(args.inputs):
+        name = os.path.splitext(os.path.basename(path))[0]
+        clip = convert(path, args.rate, args.trim)
+        write_if_changed(os.path.join(args.out_dir, name + '.pcm'),
+                         bytes(s & 0xFF for s in clip['samples']))
+
+        var = args.prefix + name
+        sym = f'_binary_{name}_pcm_start'
+        lines += [
+            f'extern const int8_t {sym}[];',
+            f'#define {var}Samples     ((const signed char *){sym})',
+            f'#define {var}SampleRate  {clip["rate"]}u',
+            f'#define {var}SampleCount {len(clip["samples"])}u',
+            f'#define {var}LoopBegin   {clip["loop_begin"]}u',
+            f'#define {var}LoopEnd     {clip["loop_end"]}u',
+            '',
+        ]
+    lines += [f'#endif // {guard}', '']
+    write_if_changed(args.header, '\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+Web UI bundle builder for 8x8 Crawler
+
+Packs every file in web/ into the image read by main/web_bundle.c: a
+header, an asset directory and the gzipped contents, each with a strong
+ETag (content hash). The firmware maps the "webui" partition and sends
+each asset straight from flash. Run from the top-level CMakeLists.txt at
+build time; the output can also be uploaded from the Settings page.
+
+Output is deterministic (gzip mtime 0), so unchanged assets keep their
+ETag across builds and browsers keep their cached copies.
+
+Usage:
+  webbundle.py --out webui.bin web/file ...
+"""
+
+import argparse
+import binascii
+import gzip
+import hashlib
+import os
+import struct
+
+# Must match main/web_bundle.h
+MAGIC = 0x42424557      # "WEBB"
+VERSION = 1
+PATH_LEN = 24
+ETAG_LEN = 20
+HEADER = struct.Struct('<IHHII8x')
+ENTRY = struct.Struct(f'<{PATH_LEN}s{ETAG_LEN}sIIB3x')
+ENCODING_IDENTITY = 0
+ENCODING_GZIP = 1
+ALIGN = 4
+
+
+def write_if_changed(path, content):
+    """Keep timestamps stable so unchanged bundles don't trigger reflashing"""
+    try:
+        with open(path, 'rb') as f:
+            if f.read() == content:
+                return
+    except OSError:
+        pass
+    with open(path, 'wb') as f:
+        f.write(content)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Pack web UI assets into a flash bundle')
+    ap.add_argument('--out', required=True, help='Bundle image to write')
+    ap.add_argument('inputs', nargs='+', help='Web assets')
+    args = ap.parse_args()
+
+    assets = []
+    for path in sorted(args.inputs):
+        name = '/' + os.path.basename(path)
+        if len(name) >= PATH_LEN:
+            ap.error(f'{name}: name too long for the bundle directory')
+        with open(path, 'rb') as f:
+            data = f.read()
+
+        etag = '"' + hashlib.sha256(data).hexdigest()[:16] + '"'
+        packed = gzip.compress(data, compresslevel=9, mtime=0)
+        if len(packed) < len(data):
+            assets.append((name, etag, ENCODING_GZIP, packed))
+        else:
+            assets.append((name, etag, ENCODING_IDENTITY, data))
+
+    offset = HEADER.size + ENTRY.size * len(assets)
+    directory = b''
+    blobs = b''
+    for name, etag, encoding, data in assets:
+        pad = -(offset + len(blobs)) % ALIGN
+        blobs += b'\0' * pad
+        directory += ENTRY.pack(name.encode(), etag.encode(), offset + len(blobs), len(data), encoding)
+        blobs += data
+
+    body = directory + blobs
+    total = HEADER.size + len(body)
+    header = HEADER.pack(MAGIC, VERSION, len(assets), total, binascii.crc32(body) & 0xFFFFFFFF)
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.out)), exist_ok=True)
+    write_if_changed(args.out, header + body)
+
+
+if __name__ == '__main__':
+    main()
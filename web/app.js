@@ -14,6 +14,8 @@ import { SoundPage } from './sound.js';
 let ws = null;
 let reconnectTimer = null;
 let currentPage = null;
+let captureWanted = false;
+let renderFrame = null;
 const RECONNECT_DELAY = 2000;
 
 // Shared state accessible by all pages
@@ -36,6 +38,174 @@ const pages = {
 // WEBSOCKET
 // =============================================================================
 
+// Binary status frame layout (ws_frame_header_t + groups in main/web_server.c)
+const STATUS_FRAME_VERSION = 5;
+const STATUS_HEADER_SIZE = 5;
+const FRAME_KEYFRAME = 1;
+
+// Steered axles of the firmware build (ws_frame_header_t.axle_count), also
+// sizes the capture samples
+let axleCount = 4;
+
+// Group decoders in ws_group_t order: [size(hdr), decode(dv, offset, out, hdr)]
+const STATUS_GROUPS = [
+    // Input: sticks + raw pulses
+    [() => 24, (dv, o, d) => {
+        d.t = dv.getInt16(o, true);
+        d.s = dv.getInt16(o + 2, true);
+        d.x1 = dv.getInt16(o + 4, true);
+        d.x2 = dv.getInt16(o + 6, true);
+        d.x3 = dv.getInt16(o + 8, true);
+        d.x4 = dv.getInt16(o + 10, true);
+        d.rc = [];
+        for (let i = 0; i < 6; i++) d.rc.push(dv.getUint16(o + 12 + i * 2, true));
+    }],
+    // Output: ESC + axle servos
+    [(h) => 2 + h.axles * 2, (dv, o, d, h) => {
+        d.e = dv.getUint16(o, true);
+        d.sv = [];
+        for (let i = 0; i < h.axles; i++) d.sv.push(dv.getUint16(o + 2 + i * 2, true));
+    }],
+    // State: flags, mode, calibration progress
+    [() => 4, (dv, o, d) => {
+        const flags = dv.getUint16(o, true);
+        d.ui = !!(flags & 1);
+        d.sl = !!(flags & 2);
+        d.cd = !!(flags & 4);
+        d.cg = !!(flags & 8);
+        d.m = dv.getUint8(o + 2);
+        d.cp = dv.getUint8(o + 3);
+    }],
+    // System: uptime, heap, RSSI
+    [() => 13, (dv, o, d) => {
+        d.u = dv.getUint32(o, true);
+        d.h = dv.getUint32(o + 4, true);
+        d.hm = dv.getUint32(o + 8, true);
+        d.rs = dv.getInt8(o + 12);
+    }],
+    // Perf: latency, loops, scheduler, audio, stage profile
+    [(h) => 37 + h.stages * 12, (dv, o, d, h) => {
+        const u32 = (x) => dv.getUint32(o + x, true);
+        d.lat = [u32(0), u32(4), u32(8)];
+        d.ovr = [u32(12), u32(16)];
+        d.shd = [dv.getUint8(o + 32), u32(20), u32(24)];
+        d.aud = [u32(28), dv.getUint8(o + 33), dv.getUint8(o + 34), dv.getUint8(o + 35), dv.getUint8(o + 36)];
+        d.prof = [];
+        for (let i = 0; i < h.stages; i++) {
+            const p = 37 + i * 12;
+            d.prof.push([u32(p), u32(p + 4), u32(p + 8)]);
+        }
+    }],
+    // Battery: pack/cell mV, current, used mAh, level, cells, sag gain, flags
+    [() => 14, (dv, o, d) => {
+        const flags = dv.getUint8(o + 13);
+        d.bat = {
+            mv: dv.getUint16(o, true),
+            cell: dv.getUint16(o + 2, true),
+            ma: dv.getInt32(o + 4, true),
+            mah: dv.getUint16(o + 8, true),
+            level: dv.getUint8(o + 10),
+            cells: dv.getUint8(o + 11),
+            gain: dv.getUint8(o + 12),
+            present: !!(flags & 1),
+            current: !!(flags & 2)
+        };
+    }],
+    // Vehicle: engine RPM, velocity, gear
+    [() => 5, (dv, o, d) => {
+        d.rpm = dv.getUint16(o, true);
+        d.vel = dv.getInt16(o + 2, true);
+        d.gr = dv.getUint8(o + 4);
+    }]
+];
+
+// Live edit frame layout (ws_live_param_t in main/web_server.c)
+const LIVE_FRAME_TYPE = 0x01;
+const LIVE_PARAM_SIZE = 6;
+export const LIVE_TABLE_TUNING = 0;
+export const LIVE_TABLE_SOUND = 1;
+
+// Servo jog frame layout (ws_jog_frame_t in main/web_server.c)
+const JOG_FRAME_TYPE = 0x02;
+export const JOG_HEARTBEAT_MS = 250;   // WEB_JOG_HEARTBEAT_MS
+
+// Capture frame layout (ws_capture_header_t + capture_sample_t[] in main/)
+const CAPTURE_FRAME_TYPE = 0x81;
+const CAPTURE_HEADER_SIZE = 8;
+const captureSampleSize = () => 18 + axleCount * 2;
+
+/**
+ * Decode a batch of per-tick control samples
+ */
+function decodeCapture(buffer) {
+    const dv = new DataView(buffer);
+    const count = dv.getUint8(1);
+    const size = captureSampleSize();
+    const tail = 14 + axleCount * 2;   // rpm, gear, flags after the servos
+    if (dv.byteLength < CAPTURE_HEADER_SIZE + count * size) {
+        console.warn('Truncated capture frame');
+        return null;
+    }
+
+    const samples = [];
+    for (let i = 0; i < count; i++) {
+        const o = CAPTURE_HEADER_SIZE + i * size;
+        const flags = dv.getUint8(o + tail + 3);
+        samples.push({
+            t: dv.getUint32(o, true),
+            thr: dv.getInt16(o + 4, true),
+            str: dv.getInt16(o + 6, true),
+            vel: dv.getInt16(o + 8, true),
+            steer: dv.getInt16(o + 10, true),
+            esc: dv.getUint16(o + 12, true),
+            servo: Array.from({ length: axleCount }, (_, a) => dv.getUint16(o + 14 + a * 2, true)),
+            rpm: dv.getUint16(o + tail, true),
+            gear: dv.getUint8(o + tail + 2),
+            brake: !!(flags & 1),
+            neutral: !!(flags & 2)
+        });
+    }
+    return { rate: dv.getUint16(2, true), dropped: dv.getUint32(4, true), samples };
+}
+
+// Fields sent once on connect and when WiFi state changes (JSON "info" frame)
+let staticInfo = {};
+
+/**
+ * Decode a binary status frame into the status object the pages expect
+ * (same keys as the former JSON status). Delta frames only carry the
+ * groups that changed, so they are applied on top of the previous status.
+ */
+function decodeStatus(buffer, previous) {
+    const dv = new DataView(buffer);
+    if (dv.byteLength < STATUS_HEADER_SIZE || dv.getUint8(0) !== STATUS_FRAME_VERSION) {
+        console.warn('Unsupported status frame');
+        return null;
+    }
+
+    const groups = dv.getUint8(1);
+    const keyframe = (dv.getUint8(2) & FRAME_KEYFRAME) !== 0;
+    const hdr = { stages: dv.getUint8(3), axles: dv.getUint8(4) };
+    axleCount = hdr.axles;
+    if (!keyframe && !previous) {
+        return null;    // Wait for the keyframe
+    }
+
+    const data = keyframe ? {} : Object.assign({}, previous);
+    let offset = STATUS_HEADER_SIZE;
+    for (let g = 0; g < STATUS_GROUPS.length; g++) {
+        if (!(groups & (1 << g))) continue;
+        const [size, decode] = STATUS_GROUPS[g];
+        if (offset + size(hdr) > dv.byteLength) {
+            console.warn('Truncated status frame');
+            return null;
+        }
+        decode(dv, offset, data, hdr);
+        offset += size(hdr);
+    }
+    return data;
+}
+
 function connect() {
     if (reconnectTimer) {
         clearTimeout(reconnectTimer);
@@ -49,6 +219,9 @@ function connect() {
         state.connected = true;
         updateConnectionStatus(true);
         console.log('WebSocket connected');
+        if (captureWanted) {
+            sendMessage({ cmd: 'capture', on: 1 });
+        }
     };
 
     ws.onclose = () => {
@@ -63,24 +236,63 @@ function connect() {
         ws.close();
     };
 
+    ws.binaryType = 'arraybuffer';
+
     ws.onmessage = (event) => {
         try {
-            const data = JSON.parse(event.data);
-            state.status = data;
-
-            // Update sidebar info
-            updateSidebarInfo(data);
-
-            // Notify current page
-            if (currentPage && currentPage.onData) {
-                currentPage.onData(data);
+            let data;
+            if (event.data instanceof ArrayBuffer &&
+                new Uint8Array(event.data)[0] === CAPTURE_FRAME_TYPE) {
+                // Capture batch: only the live graph wants these
+                const batch = decodeCapture(event.data);
+                if (batch && currentPage && currentPage.onCapture) {
+                    currentPage.onCapture(batch);
+                }
+                return;
             }
+            if (event.data instanceof ArrayBuffer) {
+                // Telemetry frame: merge in the static info fields
+                const frame = decodeStatus(event.data, state.status);
+                if (!frame) return;
+                data = Object.assign(frame, staticInfo);
+            } else {
+                const msg = JSON.parse(event.data);
+                if (msg.type === 'info') {
+                    delete msg.type;
+                    staticInfo = msg;
+                    data = Object.assign({}, state.status, staticInfo);
+                } else {
+                    data = msg;
+                }
+            }
+            state.status = data;
+            scheduleRender();
         } catch (e) {
             console.error('Failed to parse message:', e);
         }
     };
 }
 
+// Status frames can arrive faster than the display refreshes. Each one is
+// decoded into state.status as it comes in, and the page is updated from
+// the latest state once per animation frame (not at all while hidden).
+function scheduleRender() {
+    if (renderFrame) return;
+    renderFrame = requestAnimationFrame(() => {
+        renderFrame = null;
+        const data = state.status;
+        if (!data) return;
+
+        // Update sidebar info
+        updateSidebarInfo(data);
+
+        // Notify current page
+        if (currentPage && currentPage.onData) {
+            currentPage.onData(data);
+        }
+    });
+}
+
 function updateConnectionStatus(connected) {
     const el = document.getElementById('conn');
     if (connected) {
@@ -100,47 +312,86 @@ function updateSidebarInfo(data) {
         const mins = Math.floor(secs / 60);
         const hours = Math.floor(mins / 60);
         if (hours > 0) {
-            uptimeEl.textContent = hours + 'h ' + (mins % 60) + 'm';
+            setText(uptimeEl, hours + 'h ' + (mins % 60) + 'm');
         } else if (mins > 0) {
-            uptimeEl.textContent = mins + 'm ' + (secs % 60) + 's';
+            setText(uptimeEl, mins + 'm ' + (secs % 60) + 's');
         } else {
-            uptimeEl.textContent = secs + 's';
+            setText(uptimeEl, secs + 's');
         }
     }
 
     // Signal status (JSON key: sl=signal_lost)
     const signalEl = document.getElementById('sidebar-signal');
     if (signalEl && data.sl !== undefined) {
-        signalEl.textContent = data.sl ? 'LOST' : 'OK';
+        setText(signalEl, data.sl ? 'LOST' : 'OK');
         signalEl.className = 'status ' + (data.sl ? 'err' : 'ok');
     }
 
     // Firmware version in header (JSON key: v=version)
     const versionEl = document.getElementById('header-version');
     if (versionEl && data.v) {
-        versionEl.textContent = 'v' + data.v;
+        setText(versionEl, 'v' + data.v);
     }
 
     // WiFi STA status (JSON keys: wsc=connected, wsi=ip)
     const wifiRow = document.getElementById('sidebar-wifi-row');
     const wifiIpEl = document.getElementById('sidebar-wifi-ip');
     if (wifiRow && wifiIpEl) {
-        if (data.wsc && data.wsi) {
-            wifiRow.style.display = 'flex';
-            wifiIpEl.textContent = data.wsi;
-        } else {
-            wifiRow.style.display = 'none';
-        }
+        const display = data.wsc && data.wsi ? 'flex' : 'none';
+        if (wifiRow.style.display !== display) wifiRow.style.display = display;
+        if (data.wsc && data.wsi) setText(wifiIpEl, data.wsi);
     }
 }
 
-// Export for pages that need to send data
+// Write text only when it differs, so an unchanged value costs no DOM
+// mutation (and no style/layout work) at the status frame rate
+export function setText(el, text) {
+    if (el && el.textContent !== text) el.textContent = text;
+}
+
 export function sendMessage(data) {
     if (ws && ws.readyState === WebSocket.OPEN) {
         ws.send(JSON.stringify(data));
     }
 }
 
+// Apply one config field now without saving it (ids index the firmware's
+// field tables). Returns false if the socket is down and nothing was sent
+export function sendLive(table, id, value) {
+    if (!ws || ws.readyState !== WebSocket.OPEN || id < 0) {
+        return false;
+    }
+    const buf = new ArrayBuffer(1 + LIVE_PARAM_SIZE);
+    const view = new DataView(buf);
+    view.setUint8(0, LIVE_FRAME_TYPE);
+    view.setUint8(1, table);
+    view.setUint8(2, id);
+    view.setInt32(3, value, true);
+    ws.send(buf);
+    return true;
+}
+
+// Stream servo test positions (-1000..1000 per axle). Returns false if the
+// socket is down and nothing was sent
+export function sendJog(seq, values) {
+    if (!ws || ws.readyState !== WebSocket.OPEN) {
+        return false;
+    }
+    const buf = new ArrayBuffer(4 + 2 * values.length);
+    const view = new DataView(buf);
+    view.setUint8(0, JOG_FRAME_TYPE);
+    view.setUint16(2, seq & 0xffff, true);
+    values.forEach((v, i) => view.setInt16(4 + i * 2, v, true));
+    ws.send(buf);
+    return true;
+}
+
+// Start/stop per-tick capture frames (kept across reconnects)
+export function setCapture(on) {
+    captureWanted = on;
+    sendMessage({ cmd: 'capture', on: on ? 1 : 0 });
+}
+
 // =============================================================================
 // ROUTER
 // =============================================================================
@@ -1,4 +1,4 @@
-// Calibration Page - Manual per-channel RC calibration
+// Calibration Page - Per-channel or all-channel RC calibration
 
 const CHANNEL_NAMES = ['Throttle', 'Steering', 'Aux1', 'Aux2', 'Aux3', 'Aux4'];
 
@@ -17,7 +17,8 @@ export class CalibrationPage {
                     <h2>Calibration Wizard</h2>
                     <div id="cal-wizard">
                         <div class="cal-idle" id="cal-idle">
-                            <p>Select a channel below to calibrate it.</p>
+                            <p>Select a channel below to calibrate it, or calibrate every channel from stick movement.</p>
+                            <button id="cal-all-btn" class="btn btn-primary">Calibrate All</button>
                         </div>
                         <div class="cal-active" id="cal-active" style="display:none">
                             <div class="cal-channel-name" id="cal-channel-name">-</div>
@@ -26,6 +27,7 @@ export class CalibrationPage {
                                 <span class="label">Current:</span>
                                 <span class="cal-pulse" id="cal-pulse">1500</span>
                                 <span class="unit">us</span>
+                                <span class="cal-jitter" id="cal-jitter"></span>
                             </div>
                             <div class="cal-recorded" id="cal-recorded"></div>
                             <div class="cal-wizard-buttons">
@@ -79,6 +81,8 @@ export class CalibrationPage {
             channelName: document.getElementById('cal-channel-name'),
             stepMsg: document.getElementById('cal-step-msg'),
             pulse: document.getElementById('cal-pulse'),
+            jitter: document.getElementById('cal-jitter'),
+            allBtn: document.getElementById('cal-all-btn'),
             recorded: document.getElementById('cal-recorded'),
             nextBtn: document.getElementById('cal-next-btn'),
             cancelBtn: document.getElementById('cal-cancel-btn'),
@@ -106,6 +110,7 @@ export class CalibrationPage {
         }
 
         // Wizard buttons
+        this.elements.allBtn.addEventListener('click', () => this.startAll());
         this.elements.nextBtn.addEventListener('click', () => this.nextStep());
         this.elements.cancelBtn.addEventListener('click', () => this.cancel());
         this.elements.clearAllBtn.addEventListener('click', () => this.clearAll());
@@ -134,12 +139,15 @@ export class CalibrationPage {
         }
 
         // Update wizard view
-        if (data.inProgress && data.channel >= 0) {
+        if (data.inProgress && data.all) {
+            this.updateAllUI(data);
+        } else if (data.inProgress && data.channel >= 0) {
             this.elements.idleView.style.display = 'none';
             this.elements.activeView.style.display = 'block';
             this.elements.channelName.textContent = CHANNEL_NAMES[data.channel];
             this.elements.stepMsg.textContent = data.message;
             this.elements.pulse.textContent = data.pulse;
+            this.elements.jitter.textContent = this.jitterText(data, data.channel);
 
             // Show recorded values
             let recorded = '';
@@ -166,12 +174,63 @@ export class CalibrationPage {
             for (let i = 0; i < 6; i++) {
                 this.elements.calButtons[i].disabled = false;
             }
+            this.elements.allBtn.disabled = false;
 
             // Stop polling when idle
             this.stopPolling();
         }
     }
 
+    jitterText(data, channel) {
+        const cap = data.cap && data.cap[channel];
+        if (!cap || !cap[4]) return '';
+        const steady = (data.stable >> channel) & 1;
+        return `\u00b1${cap[3]} us ${steady ? '(steady)' : '(moving)'}`;
+    }
+
+    updateAllUI(data) {
+        this.elements.idleView.style.display = 'none';
+        this.elements.activeView.style.display = 'block';
+        this.elements.channelName.textContent = 'All Channels';
+        this.elements.stepMsg.textContent = data.message;
+        this.elements.pulse.textContent = data.pulse;
+        this.elements.jitter.textContent = '';
+
+        // Step 5: settling on centers, step 6: sweeping (captured range per channel)
+        const sweeping = data.step === 6;
+        for (let i = 0; i < 6 && data.cap && i < data.cap.length; i++) {
+            const [min, recent, max, jitter, count] = data.cap[i];
+            let text = '-';
+            if (count && sweeping) {
+                const swept = (data.swept >> i) & 1;
+                text = `${min}-${max} us ${swept ? '\u2713' : ''}`;
+            } else if (count) {
+                const steady = (data.stable >> i) & 1;
+                text = `${recent} \u00b1${jitter} us ${steady ? '\u2713' : ''}`;
+            }
+            this.elements.rawValues[i].textContent = text;
+            this.elements.calButtons[i].disabled = true;
+        }
+        this.elements.allBtn.disabled = true;
+
+        this.elements.recorded.textContent = sweeping ? 'Centers recorded' : '';
+        this.elements.nextBtn.textContent = sweeping ? 'Finish' : 'Next';
+    }
+
+    startAll() {
+        fetch('/api/calibration', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({ action: 'startAll' })
+        })
+        .then(r => r.json())
+        .then(data => {
+            this.updateUI(data);
+            this.startPolling();
+        })
+        .catch(err => console.error('Failed to start calibration:', err));
+    }
+
     startChannel(channel) {
         fetch('/api/calibration', {
             method: 'POST',
@@ -253,8 +312,8 @@ export class CalibrationPage {
     }
 
     onData(data) {
-        // Update live raw values from WebSocket data
-        if (data.rc) {
+        // Update live raw values from WebSocket data (capture ranges while calibrating all)
+        if (data.rc && !(this.data && this.data.all && this.data.inProgress)) {
             for (let i = 0; i < 6 && i < data.rc.length; i++) {
                 this.elements.rawValues[i].textContent = data.rc[i] + ' us';
             }
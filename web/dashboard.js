@@ -1,9 +1,19 @@
 // Dashboard Page - Real-time vehicle status and controls
-import { sendMessage } from './app.js';
+import { sendMessage, setText } from './app.js';
+import { drawBars, barsHeight, drawVehicle, drawRpmGauge } from './gauges.js';
 
+const TASKS_POLL_MS = 1000;         // TASK_STATS_PERIOD_MS
+const STACK_WARN_BYTES = 1024;
+const STACK_LOW_BYTES = 512;        // TASK_STATS_STACK_WARN_BYTES
+const MAX_RPM = 500;                // VEHICLE_MAX_RPM
+
+const RC_ROWS = ['THR', 'STR', 'AUX1', 'AUX2', 'AUX3', 'AUX4'];
+const outRows = (axles) => ['ESC', ...Array.from({ length: axles }, (_, i) => 'A' + (i + 1))];
+
+// Per axle group (AXLE_GROUPS in main/config.h)
 const MODE_DESCRIPTIONS = [
-    'Axles 1-2 steer, 3-4 fixed',
-    'Axles 3-4 steer, 1-2 fixed',
+    'Front axles steer, rear fixed',
+    'Rear axles steer, front fixed',
     'All axles steer in coordination',
     'All axles steer same direction'
 ];
@@ -11,6 +21,9 @@ const MODE_DESCRIPTIONS = [
 export class DashboardPage {
     constructor() {
         this.elements = {};
+        this.tasksTimer = null;
+        this.resizeObserver = null;
+        this.drawn = {};            // Inputs of each canvas when last drawn
     }
 
     render() {
@@ -37,7 +50,7 @@ export class DashboardPage {
                             <button class="mode-btn" data-m="1">Rear</button>
                             <button class="mode-btn aux-btn" id="aux-mode">AUX</button>
                         </div>
-                        <div class="mode-desc" id="mode-desc">Axles 1-2 steer, 3-4 fixed</div>
+                        <div class="mode-desc" id="mode-desc">Front axles steer, rear fixed</div>
 
                         <h3 class="section-title">System</h3>
                         <div class="stats-row">
@@ -57,56 +70,30 @@ export class DashboardPage {
                                 <span class="stat-label">RSSI</span>
                                 <span class="stat-value" id="stat-rssi">-</span>
                             </div>
+                            <div class="stat-item">
+                                <span class="stat-label">Latency</span>
+                                <span class="stat-value" id="stat-latency">-</span>
+                            </div>
+                            <div class="stat-item">
+                                <span class="stat-label">Audio Load</span>
+                                <span class="stat-value" id="stat-audio">-</span>
+                            </div>
+                            <div class="stat-item">
+                                <span class="stat-label">Battery</span>
+                                <span class="stat-value" id="stat-battery">-</span>
+                            </div>
+                            <div class="stat-item">
+                                <span class="stat-label">CPU Idle</span>
+                                <span class="stat-value" id="stat-idle">-</span>
+                            </div>
                         </div>
                     </div>
 
                     <div class="card">
                         <h2>VEHICLE STATUS</h2>
                         <div class="vehicle-container">
-                            <svg viewBox="0 0 240 320" class="vehicle-svg">
-                                <rect x="70" y="20" width="100" height="280" rx="10" class="vehicle-body"/>
-                                <polygon points="120,35 110,50 130,50" class="direction-arrow"/>
-
-                                <g class="axle" id="axle1-g">
-                                    <rect x="50" y="38" width="12" height="28" rx="2" class="wheel" id="wheel1l"/>
-                                    <rect x="178" y="38" width="12" height="28" rx="2" class="wheel" id="wheel1r"/>
-                                    <line x1="70" y1="52" x2="62" y2="52" class="axle-line"/>
-                                    <line x1="170" y1="52" x2="178" y2="52" class="axle-line"/>
-                                    <text x="120" y="57" class="axle-label">A1</text>
-                                    <text x="28" y="57" class="axle-value" id="a1-val">1500</text>
-                                </g>
-
-                                <g class="axle" id="axle2-g">
-                                    <rect x="50" y="103" width="12" height="28" rx="2" class="wheel" id="wheel2l"/>
-                                    <rect x="178" y="103" width="12" height="28" rx="2" class="wheel" id="wheel2r"/>
-                                    <line x1="70" y1="117" x2="62" y2="117" class="axle-line"/>
-                                    <line x1="170" y1="117" x2="178" y2="117" class="axle-line"/>
-                                    <text x="120" y="122" class="axle-label">A2</text>
-                                    <text x="28" y="122" class="axle-value" id="a2-val">1500</text>
-                                </g>
-
-                                <g class="axle" id="axle3-g">
-                                    <rect x="50" y="183" width="12" height="28" rx="2" class="wheel" id="wheel3l"/>
-                                    <rect x="178" y="183" width="12" height="28" rx="2" class="wheel" id="wheel3r"/>
-                                    <line x1="70" y1="197" x2="62" y2="197" class="axle-line"/>
-                                    <line x1="170" y1="197" x2="178" y2="197" class="axle-line"/>
-                                    <text x="120" y="202" class="axle-label">A3</text>
-                                    <text x="28" y="202" class="axle-value" id="a3-val">1500</text>
-                                </g>
-
-                                <g class="axle" id="axle4-g">
-                                    <rect x="50" y="248" width="12" height="28" rx="2" class="wheel" id="wheel4l"/>
-                                    <rect x="178" y="248" width="12" height="28" rx="2" class="wheel" id="wheel4r"/>
-                                    <line x1="70" y1="262" x2="62" y2="262" class="axle-line"/>
-                                    <line x1="170" y1="262" x2="178" y2="262" class="axle-line"/>
-                                    <text x="120" y="267" class="axle-label">A4</text>
-                                    <text x="28" y="267" class="axle-value" id="a4-val">1500</text>
-                                </g>
-
-                                <rect x="90" y="140" width="60" height="40" rx="5" class="esc-box"/>
-                                <text x="120" y="155" class="esc-label">ESC</text>
-                                <text x="120" y="172" class="esc-value" id="esc-val">1500</text>
-                            </svg>
+                            <canvas id="vehicle-canvas" class="vehicle-canvas"></canvas>
+                            <canvas id="rpm-canvas" class="rpm-canvas"></canvas>
                         </div>
                     </div>
                 </div>
@@ -115,56 +102,7 @@ export class DashboardPage {
                 <div class="dash-row">
                     <div class="card">
                         <h2>RC INPUT</h2>
-                        <div class="io-grid">
-                            <div class="io-row">
-                                <span class="io-label">THR</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="rc-thr-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="rc-thr">0</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">STR</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="rc-str-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="rc-str">0</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">AUX1</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="rc-aux1-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="rc-aux1">0</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">AUX2</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="rc-aux2-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="rc-aux2">0</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">AUX3</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="rc-aux3-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="rc-aux3">0</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">AUX4</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="rc-aux4-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="rc-aux4">0</span>
-                            </div>
-                        </div>
+                        <canvas id="rc-canvas" class="bars-canvas"></canvas>
                         <div class="rc-raw">
                             Raw: <span id="rc-ch1">-</span> <span id="rc-ch2">-</span> <span id="rc-ch3">-</span> <span id="rc-ch4">-</span> <span id="rc-ch5">-</span> <span id="rc-ch6">-</span> µs
                         </div>
@@ -172,107 +110,66 @@ export class DashboardPage {
 
                     <div class="card">
                         <h2>SERVO OUTPUT</h2>
-                        <div class="io-grid">
-                            <div class="io-row">
-                                <span class="io-label">ESC</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="out-esc-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="out-esc">1500</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">A1</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="out-a1-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="out-a1">1500</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">A2</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="out-a2-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="out-a2">1500</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">A3</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="out-a3-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="out-a3">1500</span>
-                            </div>
-                            <div class="io-row">
-                                <span class="io-label">A4</span>
-                                <div class="io-bar-wrap">
-                                    <div class="io-bar" id="out-a4-bar"></div>
-                                    <div class="io-center"></div>
-                                </div>
-                                <span class="io-value" id="out-a4">1500</span>
-                            </div>
-                        </div>
+                        <canvas id="out-canvas" class="bars-canvas"></canvas>
                     </div>
                 </div>
+
+                <!-- Row 3: Tasks -->
+                <div class="card">
+                    <h2>TASKS</h2>
+                    <table class="task-table">
+                        <thead>
+                            <tr><th>Task</th><th>Core</th><th>Prio</th><th>CPU</th><th>Stack free</th><th>Heap ops</th></tr>
+                        </thead>
+                        <tbody id="task-rows">
+                            <tr><td colspan="6">-</td></tr>
+                        </tbody>
+                    </table>
+                    <h2>HEALTH <span id="health-note" class="health-note"></span></h2>
+                    <table class="task-table">
+                        <thead>
+                            <tr><th>Task</th><th>Period</th><th>Gap</th><th>Max gap</th><th>Stalls</th><th>Worst</th></tr>
+                        </thead>
+                        <tbody id="health-rows">
+                            <tr><td colspan="6">-</td></tr>
+                        </tbody>
+                    </table>
+                </div>
             </div>
         `;
     }
 
     init() {
         this.elements = {
-            aux1: document.getElementById('aux1-st'),
-            aux2: document.getElementById('aux2-st'),
-            aux3: document.getElementById('aux3-st'),
-            aux4: document.getElementById('aux4-st'),
+            aux: [1, 2, 3, 4].map(i => document.getElementById('aux' + i + '-st')),
             modeDesc: document.getElementById('mode-desc'),
-            esc: document.getElementById('esc-val'),
-            axles: [
-                document.getElementById('a1-val'),
-                document.getElementById('a2-val'),
-                document.getElementById('a3-val'),
-                document.getElementById('a4-val')
-            ],
-            wheels: [
-                [document.getElementById('wheel1l'), document.getElementById('wheel1r')],
-                [document.getElementById('wheel2l'), document.getElementById('wheel2r')],
-                [document.getElementById('wheel3l'), document.getElementById('wheel3r')],
-                [document.getElementById('wheel4l'), document.getElementById('wheel4r')]
-            ],
+            modeButtons: Array.from(document.querySelectorAll('.mode-btn[data-m]')),
             heap: document.getElementById('stat-heap'),
             heapMin: document.getElementById('stat-heap-min'),
             uptime: document.getElementById('stat-uptime'),
             rssi: document.getElementById('stat-rssi'),
-            // RC inputs
-            rcThr: document.getElementById('rc-thr'),
-            rcThrBar: document.getElementById('rc-thr-bar'),
-            rcStr: document.getElementById('rc-str'),
-            rcStrBar: document.getElementById('rc-str-bar'),
-            rcAux1: document.getElementById('rc-aux1'),
-            rcAux1Bar: document.getElementById('rc-aux1-bar'),
-            rcAux2: document.getElementById('rc-aux2'),
-            rcAux2Bar: document.getElementById('rc-aux2-bar'),
-            rcAux3: document.getElementById('rc-aux3'),
-            rcAux3Bar: document.getElementById('rc-aux3-bar'),
-            rcAux4: document.getElementById('rc-aux4'),
-            rcAux4Bar: document.getElementById('rc-aux4-bar'),
-            ch1: document.getElementById('rc-ch1'),
-            ch2: document.getElementById('rc-ch2'),
-            ch3: document.getElementById('rc-ch3'),
-            ch4: document.getElementById('rc-ch4'),
-            ch5: document.getElementById('rc-ch5'),
-            ch6: document.getElementById('rc-ch6'),
-            // Servo outputs
-            outEsc: document.getElementById('out-esc'),
-            outEscBar: document.getElementById('out-esc-bar'),
-            outAxles: [
-                { val: document.getElementById('out-a1'), bar: document.getElementById('out-a1-bar') },
-                { val: document.getElementById('out-a2'), bar: document.getElementById('out-a2-bar') },
-                { val: document.getElementById('out-a3'), bar: document.getElementById('out-a3-bar') },
-                { val: document.getElementById('out-a4'), bar: document.getElementById('out-a4-bar') }
-            ]
+            latency: document.getElementById('stat-latency'),
+            audio: document.getElementById('stat-audio'),
+            battery: document.getElementById('stat-battery'),
+            idle: document.getElementById('stat-idle'),
+            taskRows: document.getElementById('task-rows'),
+            healthRows: document.getElementById('health-rows'),
+            healthNote: document.getElementById('health-note'),
+            rawRc: [1, 2, 3, 4, 5, 6].map(i => document.getElementById('rc-ch' + i)),
+            // Canvases
+            vehicle: document.getElementById('vehicle-canvas'),
+            rpm: document.getElementById('rpm-canvas'),
+            rcBars: document.getElementById('rc-canvas'),
+            outBars: document.getElementById('out-canvas')
         };
+        this.elements.rcBars.style.height = barsHeight(RC_ROWS.length) + 'px';
+        this.outRows = outRows(4);
+        this.elements.outBars.style.height = barsHeight(this.outRows.length) + 'px';
+
+        // Redraw everything at the new size with the next status frame
+        this.resizeObserver = new ResizeObserver(() => { this.drawn = {}; });
+        [this.elements.vehicle, this.elements.rpm, this.elements.rcBars, this.elements.outBars]
+            .forEach(c => this.resizeObserver.observe(c));
 
         const modesContainer = document.getElementById('modes');
         modesContainer.addEventListener('click', (e) => {
@@ -286,166 +183,166 @@ export class DashboardPage {
                 sendMessage({ cmd: 'mode', v: mode });
             }
         });
+
+        this.pollTasks();
+        this.tasksTimer = setInterval(() => this.pollTasks(), TASKS_POLL_MS);
     }
 
-    onData(data) {
+    pollTasks() {
+        fetch('/api/tasks')
+            .then(r => r.json())
+            .then(data => this.updateTasks(data))
+            .catch(err => console.error('Task stats error:', err));
+    }
+
+    // Per-task CPU share of one core and lowest free stack, busiest first
+    updateTasks(data) {
         const el = this.elements;
-        if (!el.aux1) return;
-
-        // AUX channels
-        if (data.x1 !== undefined) {
-            const aux1On = data.x1 > 200;
-            el.aux1.textContent = aux1On ? 'ON' : 'OFF';
-            el.aux1.className = 'aux-val ' + (aux1On ? 'aux-on' : 'aux-off');
-            if (el.rcAux1) {
-                el.rcAux1.textContent = data.x1;
-                this.updateRcBar(el.rcAux1Bar, data.x1);
-            }
-        }
-        if (data.x2 !== undefined) {
-            const aux2On = data.x2 > 200;
-            el.aux2.textContent = aux2On ? 'ON' : 'OFF';
-            el.aux2.className = 'aux-val ' + (aux2On ? 'aux-on' : 'aux-off');
-            if (el.rcAux2) {
-                el.rcAux2.textContent = data.x2;
-                this.updateRcBar(el.rcAux2Bar, data.x2);
-            }
-        }
-        if (data.x3 !== undefined) {
-            const aux3On = data.x3 > 200;
-            el.aux3.textContent = aux3On ? 'ON' : 'OFF';
-            el.aux3.className = 'aux-val ' + (aux3On ? 'aux-on' : 'aux-off');
-            if (el.rcAux3) {
-                el.rcAux3.textContent = data.x3;
-                this.updateRcBar(el.rcAux3Bar, data.x3);
-            }
-        }
-        if (data.x4 !== undefined) {
-            const aux4On = data.x4 > 200;
-            el.aux4.textContent = aux4On ? 'ON' : 'OFF';
-            el.aux4.className = 'aux-val ' + (aux4On ? 'aux-on' : 'aux-off');
-            if (el.rcAux4) {
-                el.rcAux4.textContent = data.x4;
-                this.updateRcBar(el.rcAux4Bar, data.x4);
-            }
+        if (!el.taskRows) return;
+        if (data.health) this.updateHealth(data.health);
+
+        if (!data.enabled) {
+            el.idle.textContent = 'n/a';
+            el.taskRows.innerHTML = '<tr><td colspan="6">Run-time stats are off in this build</td></tr>';
+            return;
         }
+        el.idle.textContent = data.idle.map((pct, core) => 'C' + core + ' ' + Math.round(pct) + '%').join(' ');
+
+        const tasks = data.tasks.slice().sort((a, b) => b.cpu - a.cpu || a.name.localeCompare(b.name));
+        el.taskRows.innerHTML = tasks.map(t => {
+            const stackClass = t.stackFree < STACK_LOW_BYTES ? 'err' : t.stackFree < STACK_WARN_BYTES ? 'warn' : '';
+            // Allocations + frees in the last period (total since boot in the tooltip)
+            const heap = data.heap.counted
+                ? '<td class="' + (t.heapOps > 0 ? 'warn' : '') + '" title="' + t.heapTotal + ' since boot">' + t.heapOps + '/s</td>'
+                : '<td>-</td>';
+            return '<tr><td>' + t.name + '</td><td>' + (t.core < 0 ? '-' : t.core) + '</td><td>' + t.prio +
+                '</td><td>' + t.cpu.toFixed(1) + '%</td><td class="' + stackClass + '">' + t.stackFree + ' B</td>' +
+                heap + '</tr>';
+        }).join('') + (data.truncated ? '<tr><td colspan="6">Too many tasks to list</td></tr>' : '');
+    }
+
+    // Heartbeat gap per watched task: now, longest since boot, and the
+    // strongest response a stall has drawn (late, shed, failsafe)
+    updateHealth(h) {
+        const el = this.elements;
+        const ms = us => (us / 1000).toFixed(us < 10000 ? 1 : 0) + ' ms';
+        const notes = [];
+        if (h.failsafe) notes.push('control stall failsafe');
+        if (h.outputTrips) notes.push('output deadline tripped ' + h.outputTrips + 'x');
+        if (h.lastReset) notes.push('last reset: ' + h.lastReset.task + ' stalled ' + h.lastReset.gapMs + ' ms');
+        el.healthNote.textContent = notes.join(', ');
+
+        el.healthRows.innerHTML = h.tasks.map(t => {
+            const late = t.worst === 'late' ? 'warn' : t.worst !== 'ok' ? 'err' : '';
+            return '<tr><td>' + t.name + '</td><td>' + ms(t.periodUs) + '</td><td class="' +
+                (t.grade !== 'ok' ? 'err' : '') + '">' + ms(t.gapUs) + '</td><td>' + ms(t.maxGapUs) +
+                '</td><td>' + t.stalls + '</td><td class="' + late + '">' + t.worst + '</td></tr>';
+        }).join('') || '<tr><td colspan="6">No task has beaten yet</td></tr>';
+    }
+
+    // Called once per animation frame with the latest merged status. Text
+    // is only written when it changes, and each canvas is only redrawn when
+    // one of its inputs did.
+    onData(data) {
+        const el = this.elements;
+        if (!el.vehicle) return;
+
+        // AUX channel switches
+        const aux = [data.x1, data.x2, data.x3, data.x4];
+        aux.forEach((v, i) => {
+            if (v === undefined) return;
+            const on = v > 200;
+            setText(el.aux[i], on ? 'ON' : 'OFF');
+            setClass(el.aux[i], 'aux-val ' + (on ? 'aux-on' : 'aux-off'));
+        });
 
         // Steering mode
-        if (data.m !== undefined) {
-            this.updateModeButtons(data.m);
-            el.modeDesc.textContent = MODE_DESCRIPTIONS[data.m] || '';
+        if (data.m !== undefined && data.m !== this.drawn.mode) {
+            this.drawn.mode = data.m;
+            el.modeButtons.forEach(btn => {
+                btn.classList.toggle('active', parseInt(btn.dataset.m) === data.m);
+            });
+            setText(el.modeDesc, MODE_DESCRIPTIONS[data.m] || '');
         }
 
-        // ESC value
-        if (data.e !== undefined) {
-            el.esc.textContent = data.e;
-            if (el.outEsc) {
-                el.outEsc.textContent = data.e;
-                this.updateServoBar(el.outEscBar, data.e);
-            }
+        const servos = data.sv || [];
+        const esc = data.e !== undefined ? data.e : 1500;
+
+        // Vehicle view: axle servos and ESC
+        if (this.changed('vehicle', [esc, ...servos])) {
+            drawVehicle(el.vehicle, servos, esc);
         }
 
-        // Axle servo values
-        const servos = [data.a1, data.a2, data.a3, data.a4];
-        for (let i = 0; i < 4; i++) {
-            if (servos[i] !== undefined) {
-                if (el.axles[i]) el.axles[i].textContent = servos[i];
-                this.updateWheelStyle(i, servos[i]);
-                if (el.outAxles[i]) {
-                    el.outAxles[i].val.textContent = servos[i];
-                    this.updateServoBar(el.outAxles[i].bar, servos[i]);
-                }
-            }
+        // Engine RPM and gear
+        if (data.rpm !== undefined && this.changed('rpm', [data.rpm, data.gr, data.vel])) {
+            drawRpmGauge(el.rpm, data.rpm, MAX_RPM, data.gr, data.vel);
+        }
+
+        // RC calibrated values (-1000..1000)
+        const rc = [data.t, data.s, ...aux];
+        if (this.changed('rc', rc)) {
+            drawBars(el.rcBars, RC_ROWS.map((label, i) => {
+                const v = rc[i] || 0;
+                return { label, value: v, min: -1000, max: 1000, center: 0, text: String(v), near: 50, far: 500 };
+            }));
         }
 
-        // RC calibrated values
-        if (data.t !== undefined && el.rcThr) {
-            el.rcThr.textContent = data.t;
-            this.updateRcBar(el.rcThrBar, data.t);
+        // Outputs (us)
+        const outs = [esc, ...servos];
+        if (servos.length && outs.length !== this.outRows.length) {
+            this.outRows = outRows(servos.length);
+            el.outBars.style.height = barsHeight(this.outRows.length) + 'px';
         }
-        if (data.s !== undefined && el.rcStr) {
-            el.rcStr.textContent = data.s;
-            this.updateRcBar(el.rcStrBar, data.s);
+        if (this.changed('out', outs)) {
+            drawBars(el.outBars, this.outRows.map((label, i) => {
+                const v = outs[i] || 1500;
+                return { label, value: v, min: 1000, max: 2000, center: 1500, text: String(v), near: 20, far: 200 };
+            }));
         }
 
         // Raw RC
-        if (data.rc && el.ch1) {
-            el.ch1.textContent = data.rc[0] || '-';
-            el.ch2.textContent = data.rc[1] || '-';
-            el.ch3.textContent = data.rc[2] || '-';
-            el.ch4.textContent = data.rc[3] || '-';
-            el.ch5.textContent = data.rc[4] || '-';
-            el.ch6.textContent = data.rc[5] || '-';
+        if (data.rc) {
+            el.rawRc.forEach((span, i) => setText(span, String(data.rc[i] || '-')));
         }
 
         // System stats
-        if (data.h !== undefined && el.heap) el.heap.textContent = this.formatBytes(data.h);
-        if (data.hm !== undefined && el.heapMin) el.heapMin.textContent = this.formatBytes(data.hm);
-        if (data.u !== undefined && el.uptime) el.uptime.textContent = this.formatUptime(data.u);
-        if (data.rs !== undefined && el.rssi) el.rssi.textContent = data.rs + ' dBm';
-    }
-
-    updateModeButtons(activeMode) {
-        const buttons = document.querySelectorAll('.mode-btn[data-m]');
-        buttons.forEach(btn => {
-            const m = parseInt(btn.dataset.m);
-            btn.classList.toggle('active', m === activeMode);
-        });
-    }
-
-    updateWheelStyle(axleIndex, value) {
-        const wheels = this.elements.wheels[axleIndex];
-        if (!wheels) return;
-
-        const deviation = value - 1500;
-        const maxDeviation = 500;
-        const maxAngle = 30;
-
-        let angle = (deviation / maxDeviation) * maxAngle;
-        angle = Math.max(-maxAngle, Math.min(maxAngle, angle));
-
-        wheels.forEach(wheel => {
-            wheel.style.transform = `rotate(${angle}deg)`;
-            if (angle < -2) {
-                wheel.style.fill = 'var(--accent-blue)';
-            } else if (angle > 2) {
-                wheel.style.fill = 'var(--accent-magenta)';
+        if (data.h !== undefined) setText(el.heap, this.formatBytes(data.h));
+        if (data.hm !== undefined) setText(el.heapMin, this.formatBytes(data.hm));
+        if (data.u !== undefined) setText(el.uptime, this.formatUptime(data.u));
+        if (data.rs !== undefined) setText(el.rssi, data.rs + ' dBm');
+        // Edge-to-output latency: avg / p99 (us -> ms)
+        if (data.lat) {
+            setText(el.latency, (data.lat[0] / 1000).toFixed(1) + ' / ' + (data.lat[1] / 1000).toFixed(1) + ' ms');
+        }
+        // Audio mixer: avg / max load, lowest DMA fill, underruns
+        if (data.aud) {
+            setText(el.audio, data.aud[3] + ' / ' + data.aud[4] + '%, fill ' + data.aud[2] +
+                (data.aud[0] ? ', ' + data.aud[0] + ' xrun' : ''));
+        }
+        // Battery: pack voltage, per-cell, current, sag gain (levels: battery_level_t)
+        if (data.bat) {
+            const b = data.bat;
+            if (!b.present || !b.cells) {
+                setText(el.battery, b.present ? 'No pack' : '-');
+                setClass(el.battery, 'stat-value');
             } else {
-                wheel.style.fill = '#444';
+                setText(el.battery, (b.mv / 1000).toFixed(2) + ' V ' + b.cells + 'S (' +
+                    (b.cell / 1000).toFixed(2) + ')' +
+                    (b.current ? ', ' + (b.ma / 1000).toFixed(1) + ' A ' + b.mah + ' mAh' : '') +
+                    (b.gain > 100 ? ', +' + (b.gain - 100) + '%' : ''));
+                setClass(el.battery, 'stat-value' + (b.level === 3 ? ' err' : b.level === 2 ? ' warn' : ''));
             }
-        });
-    }
-
-    updateServoBar(barEl, value) {
-        if (!barEl) return;
-        // Map 1000-2000 to 0-100%
-        const pct = Math.max(0, Math.min(100, ((value - 1000) / 1000) * 100));
-        barEl.style.width = pct + '%';
-
-        const deviation = Math.abs(value - 1500);
-        if (deviation < 20) {
-            barEl.style.background = 'var(--accent-green)';
-        } else if (deviation < 200) {
-            barEl.style.background = 'var(--accent-blue)';
-        } else {
-            barEl.style.background = 'var(--accent-orange)';
         }
     }
 
-    updateRcBar(barEl, value) {
-        if (!barEl) return;
-        // Map -1000 to 1000 -> 0% to 100%
-        const pct = Math.max(0, Math.min(100, 50 + (value / 20)));
-        barEl.style.width = pct + '%';
-
-        const deviation = Math.abs(value);
-        if (deviation < 50) {
-            barEl.style.background = 'var(--accent-green)';
-        } else if (deviation < 500) {
-            barEl.style.background = 'var(--accent-blue)';
-        } else {
-            barEl.style.background = 'var(--accent-orange)';
+    // True (and remembered) if a canvas's inputs differ from its last draw
+    changed(key, values) {
+        const prev = this.drawn[key];
+        if (prev && prev.length === values.length && prev.every((v, i) => v === values[i])) {
+            return false;
         }
+        this.drawn[key] = values;
+        return true;
     }
 
     formatBytes(bytes) {
@@ -465,5 +362,18 @@ export class DashboardPage {
         return secs + 's';
     }
 
-    destroy() {}
+    destroy() {
+        if (this.tasksTimer) {
+            clearInterval(this.tasksTimer);
+            this.tasksTimer = null;
+        }
+        if (this.resizeObserver) {
+            this.resizeObserver.disconnect();
+            this.resizeObserver = null;
+        }
+    }
+}
+
+function setClass(el, className) {
+    if (el && el.className !== className) el.className = className;
 }
@@ -0,0 +1,263 @@
+// Canvas gauges for the dashboard
+// Drawn from the latest status once per animation frame, so fast telemetry
+// costs a few canvas calls per frame instead of restyling DOM nodes (and
+// re-running layout) for every message.
+
+// Theme colors (the :root custom properties in style.css)
+let colors = null;
+
+export function themeColors() {
+    if (!colors) {
+        const css = getComputedStyle(document.documentElement);
+        const get = (name) => css.getPropertyValue(name).trim();
+        colors = {
+            input: get('--bg-input'),
+            border: get('--border-color'),
+            text: get('--text-primary'),
+            textDim: get('--text-secondary'),
+            green: get('--accent-green'),
+            blue: get('--accent-blue'),
+            orange: get('--accent-orange'),
+            red: get('--accent-red'),
+            magenta: get('--accent-magenta')
+        };
+    }
+    return colors;
+}
+
+/**
+ * Match a canvas backing store to its CSS size and the device pixel ratio.
+ * Returns the 2D context scaled to CSS pixels, or null if the canvas is not
+ * laid out. Cheap when nothing changed; call it at the start of each draw.
+ */
+export function fitCanvas(canvas) {
+    const dpr = window.devicePixelRatio || 1;
+    const w = canvas.clientWidth;
+    const h = canvas.clientHeight;
+    if (!w || !h) return null;
+
+    if (canvas.width !== Math.round(w * dpr) || canvas.height !== Math.round(h * dpr)) {
+        canvas.width = Math.round(w * dpr);
+        canvas.height = Math.round(h * dpr);
+    }
+    const ctx = canvas.getContext('2d');
+    ctx.setTransform(dpr, 0, 0, dpr, 0, 0);
+    ctx.clearRect(0, 0, w, h);
+    return { ctx, w, h };
+}
+
+// Bar rows: label | track with center mark | value
+const BAR_ROW = 22;
+const BAR_HEIGHT = 16;
+const BAR_LABEL_W = 40;
+const BAR_VALUE_W = 48;
+
+export function barsHeight(rows) {
+    return rows * BAR_ROW - (BAR_ROW - BAR_HEIGHT);
+}
+
+/**
+ * Horizontal bars, one row per entry:
+ * { label, value, min, max, center, text, near, far }
+ * The fill runs from min to value; it is green within `near` of center,
+ * blue within `far`, orange beyond.
+ */
+export function drawBars(canvas, rows) {
+    const view = fitCanvas(canvas);
+    if (!view) return;
+    const { ctx, w } = view;
+    const c = themeColors();
+    const trackW = w - BAR_LABEL_W - BAR_VALUE_W;
+
+    ctx.font = '600 11px sans-serif';
+    ctx.textBaseline = 'middle';
+    rows.forEach((row, i) => {
+        const y = i * BAR_ROW;
+        const mid = y + BAR_HEIGHT / 2;
+
+        ctx.fillStyle = c.textDim;
+        ctx.textAlign = 'left';
+        ctx.fillText(row.label, 0, mid);
+
+        ctx.fillStyle = c.input;
+        ctx.fillRect(BAR_LABEL_W, y, trackW, BAR_HEIGHT);
+
+        const frac = Math.max(0, Math.min(1, (row.value - row.min) / (row.max - row.min)));
+        const dev = Math.abs(row.value - row.center);
+        ctx.fillStyle = dev < row.near ? c.green : dev < row.far ? c.blue : c.orange;
+        ctx.fillRect(BAR_LABEL_W, y, trackW * frac, BAR_HEIGHT);
+
+        ctx.fillStyle = 'rgba(255, 255, 255, 0.3)';
+        ctx.fillRect(BAR_LABEL_W + Math.round(trackW / 2), y, 1, BAR_HEIGHT);
+
+        ctx.fillStyle = c.text;
+        ctx.textAlign = 'right';
+        ctx.font = '11px monospace';
+        ctx.fillText(row.text, w, mid);
+        ctx.font = '600 11px sans-serif';
+    });
+}
+
+// Vehicle top view, laid out in a 240 x 320 box (the former SVG). Axle
+// rows by axle count, kept clear of the ESC box in the middle.
+const AXLE_Y = {
+    2: [70, 250],
+    3: [52, 210, 262],
+    4: [52, 117, 197, 262],
+    5: [48, 96, 200, 244, 288]
+};
+const WHEEL_MAX_ANGLE = 30;
+
+/**
+ * Vehicle outline with each axle's wheels turned by its servo pulse
+ * (1000-2000us -> -30..30 degrees) and the ESC pulse in the middle
+ */
+export function drawVehicle(canvas, servos, esc) {
+    const view = fitCanvas(canvas);
+    if (!view) return;
+    const { ctx, w, h } = view;
+    const c = themeColors();
+
+    const scale = Math.min(w / 240, h / 320);
+    ctx.save();
+    ctx.translate((w - 240 * scale) / 2, (h - 320 * scale) / 2);
+    ctx.scale(scale, scale);
+
+    // Body and direction arrow
+    ctx.fillStyle = c.border;
+    ctx.strokeStyle = '#4a6a9e';
+    ctx.lineWidth = 2;
+    roundRect(ctx, 70, 20, 100, 280, 10);
+    ctx.fill();
+    ctx.stroke();
+    ctx.fillStyle = c.green;
+    ctx.beginPath();
+    ctx.moveTo(120, 35);
+    ctx.lineTo(110, 50);
+    ctx.lineTo(130, 50);
+    ctx.fill();
+
+    ctx.textBaseline = 'middle';
+    (AXLE_Y[servos.length] || AXLE_Y[4]).forEach((y, i) => {
+        const pulse = servos[i] || 1500;
+        const angle = Math.max(-WHEEL_MAX_ANGLE, Math.min(WHEEL_MAX_ANGLE,
+            (pulse - 1500) / 500 * WHEEL_MAX_ANGLE));
+
+        ctx.strokeStyle = '#666';
+        ctx.lineWidth = 2;
+        ctx.beginPath();
+        ctx.moveTo(62, y);
+        ctx.lineTo(70, y);
+        ctx.moveTo(170, y);
+        ctx.lineTo(178, y);
+        ctx.stroke();
+
+        const fill = angle < -2 ? c.blue : angle > 2 ? c.magenta : '#444';
+        for (const x of [56, 184]) {
+            ctx.save();
+            ctx.translate(x, y);
+            ctx.rotate(angle * Math.PI / 180);
+            ctx.fillStyle = fill;
+            ctx.strokeStyle = '#666';
+            ctx.lineWidth = 1;
+            roundRect(ctx, -6, -14, 12, 28, 2);
+            ctx.fill();
+            ctx.stroke();
+            ctx.restore();
+        }
+
+        ctx.fillStyle = c.textDim;
+        ctx.font = 'bold 12px sans-serif';
+        ctx.textAlign = 'center';
+        ctx.fillText('A' + (i + 1), 120, y);
+
+        ctx.fillStyle = c.green;
+        ctx.font = '10px monospace';
+        ctx.textAlign = 'right';
+        ctx.fillText(String(pulse), 40, y);
+    });
+
+    // ESC box
+    ctx.fillStyle = '#1a1a2e';
+    ctx.strokeStyle = c.green;
+    ctx.lineWidth = 2;
+    roundRect(ctx, 90, 140, 60, 40, 5);
+    ctx.fill();
+    ctx.stroke();
+    ctx.textAlign = 'center';
+    ctx.fillStyle = c.textDim;
+    ctx.font = '12px sans-serif';
+    ctx.fillText('ESC', 120, 152);
+    ctx.fillStyle = c.green;
+    ctx.font = 'bold 14px monospace';
+    ctx.fillText(String(esc), 120, 170);
+
+    ctx.restore();
+}
+
+// RPM dial: 240 degree sweep starting bottom left
+const DIAL_START = Math.PI * 0.833;
+const DIAL_SWEEP = Math.PI * 1.333;
+const GEAR_NAMES = ['R', '1', '2', '3'];
+
+/**
+ * Engine RPM dial with the gear in the middle; the last 15% of the sweep
+ * is the red zone
+ */
+export function drawRpmGauge(canvas, rpm, maxRpm, gear, velocity) {
+    const view = fitCanvas(canvas);
+    if (!view) return;
+    const { ctx, w, h } = view;
+    const c = themeColors();
+
+    const r = Math.min(w / 2 - 8, (h - 30) / 1.8);   // Room for the text below the hub
+    const cx = w / 2;
+    const cy = r + 8;
+    const frac = Math.max(0, Math.min(1, rpm / maxRpm));
+
+    ctx.lineCap = 'butt';
+    ctx.lineWidth = 10;
+    ctx.strokeStyle = c.input;
+    ctx.beginPath();
+    ctx.arc(cx, cy, r, DIAL_START, DIAL_START + DIAL_SWEEP);
+    ctx.stroke();
+
+    ctx.strokeStyle = 'rgba(255, 68, 68, 0.35)';
+    ctx.beginPath();
+    ctx.arc(cx, cy, r, DIAL_START + DIAL_SWEEP * 0.85, DIAL_START + DIAL_SWEEP);
+    ctx.stroke();
+
+    ctx.strokeStyle = frac > 0.85 ? c.red : frac > 0.6 ? c.orange : c.green;
+    ctx.beginPath();
+    ctx.arc(cx, cy, r, DIAL_START, DIAL_START + DIAL_SWEEP * frac);
+    ctx.stroke();
+
+    // Needle
+    const a = DIAL_START + DIAL_SWEEP * frac;
+    ctx.strokeStyle = c.text;
+    ctx.lineWidth = 2;
+    ctx.beginPath();
+    ctx.moveTo(cx, cy);
+    ctx.lineTo(cx + Math.cos(a) * (r - 14), cy + Math.sin(a) * (r - 14));
+    ctx.stroke();
+
+    ctx.textAlign = 'center';
+    ctx.textBaseline = 'middle';
+    ctx.fillStyle = c.text;
+    ctx.font = 'bold 20px monospace';
+    ctx.fillText(GEAR_NAMES[gear] || '-', cx, cy + r * 0.45);
+    ctx.fillStyle = c.textDim;
+    ctx.font = '11px monospace';
+    ctx.fillText(rpm + ' rpm', cx, cy + r * 0.75);
+    ctx.fillText('vel ' + velocity, cx, cy + r * 0.75 + 14);
+}
+
+function roundRect(ctx, x, y, w, h, r) {
+    ctx.beginPath();
+    ctx.moveTo(x + r, y);
+    ctx.arcTo(x + w, y, x + w, y + h, r);
+    ctx.arcTo(x + w, y + h, x, y + h, r);
+    ctx.arcTo(x, y + h, x, y, r);
+    ctx.arcTo(x, y, x + w, y, r);
+    ctx.closePath();
+}
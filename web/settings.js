@@ -1,4 +1,4 @@
-// Settings Page - WiFi, OTA updates, SPIFFS management
+// Settings Page - WiFi, OTA updates, Web UI management, black box
 
 export class SettingsPage {
     constructor() {
@@ -44,33 +44,50 @@ export class SettingsPage {
                             <span class="label">Current Version:</span>
                             <span class="value" id="fw-version">-</span>
                         </div>
-                        <input type="file" id="ota-file" accept=".bin"/>
+                        <div class="row">
+                            <span class="label">Boot Time:</span>
+                            <span class="value" id="fw-boot">-</span>
+                        </div>
+                        <input type="file" id="ota-file" accept=".bin,.gz,.delta"/>
                         <button id="ota-btn" class="btn btn-primary">Upload Firmware</button>
                         <div class="progress" id="ota-progress">
                             <div class="progress-bar" id="ota-bar"></div>
                         </div>
                         <div class="status-text" id="ota-status"></div>
+                        <div class="hint">Upload build/8x8_crawler.bin.gz (or the plain .bin): the compressed image uploads several times faster. A .delta from tools/ota-delta.py is smaller still.</div>
                     </div>
                 </div>
 
                 <!-- Web UI Update Card -->
                 <div class="card">
                     <h2>Web UI Update</h2>
-                    <div class="spiffs-container">
+                    <div class="webui-container">
                         <div class="row">
                             <span class="label">Storage:</span>
-                            <span class="value" id="spiffs-usage">-</span>
+                            <span class="value" id="webui-usage">-</span>
+                        </div>
+                        <div class="webui-files" id="webui-files">
+                            <div class="webui-empty">Loading...</div>
                         </div>
-                        <div class="spiffs-files" id="spiffs-files">
-                            <div class="spiffs-empty">Loading...</div>
+                        <input type="file" id="webui-file" accept=".bin"/>
+                        <button id="webui-btn" class="btn btn-primary">Upload Bundle</button>
+                        <div class="progress" id="webui-progress">
+                            <div class="progress-bar" id="webui-bar"></div>
                         </div>
-                        <input type="file" id="spiffs-file" multiple accept=".html,.css,.js,.json,.ico,.svg"/>
-                        <button id="spiffs-btn" class="btn btn-primary">Upload Files</button>
-                        <div class="progress" id="spiffs-progress">
-                            <div class="progress-bar" id="spiffs-bar"></div>
+                        <div class="status-text" id="webui-status"></div>
+                        <div class="hint">Upload build/webui.bin (every page packed by the firmware build). Refresh page after upload.</div>
+                    </div>
+                </div>
+
+                <!-- Black Box Card -->
+                <div class="card">
+                    <h2>Black Box</h2>
+                    <div class="blackbox-container">
+                        <div class="webui-files" id="blackbox-events">
+                            <div class="webui-empty">Loading...</div>
                         </div>
-                        <div class="status-text" id="spiffs-status"></div>
-                        <div class="hint">Upload web files (html, css, js). Refresh page after upload.</div>
+                        <button id="blackbox-refresh-btn" class="btn btn-secondary">Refresh</button>
+                        <div class="hint">The last seconds before each failsafe, panic, watchdog or brownout reset. Decode downloads with tools/trace-decode.js.</div>
                     </div>
                 </div>
 
@@ -101,19 +118,23 @@ export class SettingsPage {
             wifiSaveBtn: document.getElementById('wifi-save-btn'),
             // OTA
             fwVersion: document.getElementById('fw-version'),
+            fwBoot: document.getElementById('fw-boot'),
             otaFile: document.getElementById('ota-file'),
             otaBtn: document.getElementById('ota-btn'),
             otaProgress: document.getElementById('ota-progress'),
             otaBar: document.getElementById('ota-bar'),
             otaStatus: document.getElementById('ota-status'),
-            // SPIFFS
-            spiffsUsage: document.getElementById('spiffs-usage'),
-            spiffsFiles: document.getElementById('spiffs-files'),
-            spiffsFile: document.getElementById('spiffs-file'),
-            spiffsBtn: document.getElementById('spiffs-btn'),
-            spiffsProgress: document.getElementById('spiffs-progress'),
-            spiffsBar: document.getElementById('spiffs-bar'),
-            spiffsStatus: document.getElementById('spiffs-status'),
+            // Web UI
+            webuiUsage: document.getElementById('webui-usage'),
+            webuiFiles: document.getElementById('webui-files'),
+            webuiFile: document.getElementById('webui-file'),
+            webuiBtn: document.getElementById('webui-btn'),
+            webuiProgress: document.getElementById('webui-progress'),
+            webuiBar: document.getElementById('webui-bar'),
+            webuiStatus: document.getElementById('webui-status'),
+            // Black box
+            blackboxEvents: document.getElementById('blackbox-events'),
+            blackboxRefreshBtn: document.getElementById('blackbox-refresh-btn'),
             // System
             restartBtn: document.getElementById('restart-btn'),
             bootloaderBtn: document.getElementById('bootloader-btn')
@@ -122,13 +143,15 @@ export class SettingsPage {
         // Event handlers
         this.elements.wifiSaveBtn.addEventListener('click', () => this.saveWifiConfig());
         this.elements.otaBtn.addEventListener('click', () => this.uploadFirmware());
-        this.elements.spiffsBtn.addEventListener('click', () => this.uploadSpiffsFiles());
+        this.elements.webuiBtn.addEventListener('click', () => this.uploadWebUiBundle());
+        this.elements.blackboxRefreshBtn.addEventListener('click', () => this.loadBlackbox());
         this.elements.restartBtn.addEventListener('click', () => this.restartDevice());
         this.elements.bootloaderBtn.addEventListener('click', () => this.enterBootloader());
 
         // Load initial data
         this.loadWifiConfig();
-        this.loadSpiffsFiles();
+        this.loadWebUiFiles();
+        this.loadBlackbox();
     }
 
     onData(data) {
@@ -137,6 +160,13 @@ export class SettingsPage {
             this.elements.fwVersion.textContent = data.v + (data.b ? ' (build ' + data.b + ')' : '');
         }
 
+        // Boot milestones in ms since start (JSON key: boot, from the info frame)
+        if (data.boot && data.boot.ready !== undefined && this.elements.fwBoot) {
+            this.elements.fwBoot.textContent = data.boot.ready + ' ms';
+            this.elements.fwBoot.title = Object.entries(data.boot)
+                .map(([name, ms]) => name + ' ' + ms + ' ms').join('\n');
+        }
+
         // Update WiFi status from WebSocket (JSON keys: wse=enabled, wsc=connected, wsi=ip)
         if (data.wse !== undefined || data.wsc !== undefined) {
             this.updateWifiStatusFromWs(data);
@@ -148,7 +178,10 @@ export class SettingsPage {
         if (!el.wifiConnStatus) return;
 
         if (data.wsc && data.wsi) {
-            el.wifiConnStatus.textContent = 'Connected';
+            // wst=start to IP (ms), wsf=reconnected to the cached AP without a scan
+            el.wifiConnStatus.textContent = data.wst
+                ? 'Connected in ' + (data.wst / 1000).toFixed(1) + ' s' + (data.wsf ? ' (cached AP)' : '')
+                : 'Connected';
             el.wifiConnStatus.className = 'status ok';
             el.wifiIpRow.style.display = 'flex';
             el.wifiIp.textContent = data.wsi;
@@ -253,8 +286,8 @@ export class SettingsPage {
             return;
         }
 
-        if (!file.name.endsWith('.bin')) {
-            this.setOtaStatus('Invalid file type. Please select a .bin file', 'error');
+        if (!/\.(bin|delta)(\.gz)?$/.test(file.name)) {
+            this.setOtaStatus('Invalid file type. Please select a .bin, .bin.gz or .delta file', 'error');
             return;
         }
 
@@ -304,11 +337,11 @@ export class SettingsPage {
     }
 
     // =========================================================================
-    // SPIFFS File Management
+    // Web UI File Management
     // =========================================================================
 
-    loadSpiffsFiles() {
-        fetch('/api/spiffs')
+    loadWebUiFiles() {
+        fetch('/api/webui')
             .then(r => r.json())
             .then(data => {
                 const el = this.elements;
@@ -316,96 +349,124 @@ export class SettingsPage {
                 // Storage usage
                 const usedKB = (data.used / 1024).toFixed(1);
                 const totalKB = (data.total / 1024).toFixed(1);
-                const pct = Math.round((data.used / data.total) * 100);
-                el.spiffsUsage.textContent = usedKB + ' / ' + totalKB + ' KB (' + pct + '%)';
+                const pct = data.total ? Math.round((data.used / data.total) * 100) : 0;
+                el.webuiUsage.textContent = usedKB + ' / ' + totalKB + ' KB (' + pct + '%)';
+                el.webuiUsage.title = 'Mapped in ' + data.mountUs + ' us' +
+                    (data.lastUpload && data.lastUpload.bytes ?
+                        ', last upload: erase ' + data.lastUpload.eraseMs + ' ms, write ' +
+                        data.lastUpload.writeMs + ' ms of ' + data.lastUpload.totalMs + ' ms' : '');
 
                 // File list
                 let html = '';
                 if (data.files && data.files.length > 0) {
                     data.files.forEach(f => {
-                        const size = f.size < 1024 ? f.size + ' B' : (f.size / 1024).toFixed(1) + ' KB';
-                        html += '<div class="spiffs-file-row">' +
-                            '<span class="spiffs-filename">' + f.name + '</span>' +
-                            '<span class="spiffs-filesize">' + size + '</span>' +
+                        const size = (f.size < 1024 ? f.size + ' B' : (f.size / 1024).toFixed(1) + ' KB') +
+                            (f.gzip ? ' gz' : '');
+                        html += '<div class="webui-file-row">' +
+                            '<span class="webui-filename">' + f.name + '</span>' +
+                            '<span class="webui-filesize">' + size + '</span>' +
                             '</div>';
                     });
                 } else {
-                    html = '<div class="spiffs-empty">No files</div>';
+                    html = '<div class="webui-empty">No files</div>';
                 }
-                el.spiffsFiles.innerHTML = html;
+                el.webuiFiles.innerHTML = html;
             })
             .catch(err => {
-                console.error('Failed to load SPIFFS files:', err);
-                this.elements.spiffsFiles.innerHTML = '<div class="spiffs-empty">Failed to load</div>';
+                console.error('Failed to load web UI files:', err);
+                this.elements.webuiFiles.innerHTML = '<div class="webui-empty">Failed to load</div>';
             });
     }
 
-    uploadSpiffsFiles() {
+    uploadWebUiBundle() {
         const el = this.elements;
-        const files = el.spiffsFile.files;
+        const file = el.webuiFile.files[0];
 
-        if (files.length === 0) {
-            this.setSpiffsStatus('Please select files to upload', 'error');
+        if (!file) {
+            this.setWebUiStatus('Please select a web UI bundle', 'error');
             return;
         }
 
-        const fileList = Array.from(files).map(f => f.name).join(', ');
-        if (!confirm('Upload ' + files.length + ' file(s)?\n\n' + fileList)) {
+        if (!confirm('Replace the web UI with ' + file.name + '?\n\nPages are unavailable until the upload completes.')) {
             return;
         }
 
-        el.spiffsBtn.disabled = true;
-        el.spiffsProgress.classList.add('active');
-
-        let uploaded = 0;
-        const total = files.length;
+        el.webuiBtn.disabled = true;
+        el.webuiProgress.classList.add('active');
+        el.webuiBar.style.width = '0%';
+        this.setWebUiStatus('Uploading ' + file.name + '...', '');
 
-        const uploadNext = (index) => {
-            if (index >= total) {
-                this.setSpiffsStatus('Uploaded ' + uploaded + ' file(s). Refresh to see changes.', 'success');
-                el.spiffsBtn.disabled = false;
-                el.spiffsProgress.classList.remove('active');
-                el.spiffsFile.value = '';
-                this.loadSpiffsFiles();
-                return;
-            }
-
-            const file = files[index];
-            this.setSpiffsStatus('Uploading ' + file.name + '...', '');
-            el.spiffsBar.style.width = ((index / total) * 100) + '%';
+        const done = () => {
+            el.webuiBtn.disabled = false;
+            el.webuiProgress.classList.remove('active');
+        };
 
-            const xhr = new XMLHttpRequest();
-            xhr.open('POST', '/api/spiffs?file=' + encodeURIComponent(file.name), true);
+        const xhr = new XMLHttpRequest();
+        xhr.open('POST', '/api/webui', true);
 
-            xhr.onload = () => {
-                if (xhr.status === 200) {
-                    uploaded++;
-                    uploadNext(index + 1);
-                } else {
-                    this.setSpiffsStatus('Failed to upload ' + file.name, 'error');
-                    el.spiffsBtn.disabled = false;
-                    el.spiffsProgress.classList.remove('active');
-                }
-            };
+        xhr.upload.onprogress = (e) => {
+            if (e.lengthComputable) {
+                el.webuiBar.style.width = ((e.loaded / e.total) * 100) + '%';
+            }
+        };
 
-            xhr.onerror = () => {
-                this.setSpiffsStatus('Network error uploading ' + file.name, 'error');
-                el.spiffsBtn.disabled = false;
-                el.spiffsProgress.classList.remove('active');
-            };
+        xhr.onload = () => {
+            done();
+            if (xhr.status === 200) {
+                let msg = 'Web UI updated. Refresh to see changes.';
+                try {
+                    const r = JSON.parse(xhr.responseText);
+                    msg += ' (' + (r.totalMs / 1000).toFixed(1) + ' s, flash ' + r.flashKBps + ' KB/s)';
+                } catch (e) {}
+                this.setWebUiStatus(msg, 'success');
+                el.webuiFile.value = '';
+                this.loadWebUiFiles();
+            } else {
+                this.setWebUiStatus('Upload failed: ' + (xhr.responseText || xhr.status), 'error');
+            }
+        };
 
-            xhr.send(file);
+        xhr.onerror = () => {
+            done();
+            this.setWebUiStatus('Network error uploading ' + file.name, 'error');
         };
 
-        uploadNext(0);
+        xhr.send(file);
     }
 
-    setSpiffsStatus(message, type) {
-        const el = this.elements.spiffsStatus;
+    setWebUiStatus(message, type) {
+        const el = this.elements.webuiStatus;
         el.textContent = message;
         el.className = 'status-text' + (type ? ' ' + type : '');
     }
 
+    // =========================================================================
+    // Black Box
+    // =========================================================================
+
+    loadBlackbox() {
+        fetch('/api/blackbox')
+            .then(r => r.json())
+            .then(data => {
+                const events = (data.events || []).sort((a, b) => b.seq - a.seq);
+                let html = '';
+                events.forEach(e => {
+                    const seconds = (e.records / (e.rateHz || 1)).toFixed(1);
+                    const uptime = (e.uptimeMs / 1000).toFixed(1);
+                    html += '<div class="webui-file-row">' +
+                        '<span class="webui-filename">#' + e.seq + ' ' + e.cause + ' at ' + uptime + ' s</span>' +
+                        '<a class="webui-filesize" href="/api/blackbox?slot=' + e.slot + '" download>' +
+                        seconds + ' s</a>' +
+                        '</div>';
+                });
+                this.elements.blackboxEvents.innerHTML = html || '<div class="webui-empty">No events</div>';
+            })
+            .catch(err => {
+                console.error('Failed to load black box:', err);
+                this.elements.blackboxEvents.innerHTML = '<div class="webui-empty">Failed to load</div>';
+            });
+    }
+
     // =========================================================================
     // System Controls
     // =========================================================================
@@ -1,9 +1,25 @@
 // Sound Settings Page - Engine sound configuration
 
+import { sendLive, LIVE_TABLE_SOUND } from './app.js';
+
+// Live edit ids: the order of sound_json_fields in main/web_server.c
+const LIVE_KEYS = [
+    'masterVolumeLevel1', 'masterVolumeLevel2', 'activeVolumeLevel',
+    'volumePresetLow', 'volumePresetMedium', 'volumePresetHigh',
+    'idleVolume', 'revVolume', 'knockVolume', 'startVolume',
+    'maxRpmPercent', 'acceleration', 'deceleration',
+    'revSwitchPoint', 'idleEndPoint', 'knockStartPoint', 'knockInterval',
+    'jakeBrakeEnabled', 'v8Mode',
+    'airBrakeEnabled', 'airBrakeVolume', 'reverseBeepEnabled', 'reverseBeepVolume',
+    'gearShiftEnabled', 'gearShiftVolume', 'wastegateEnabled', 'wastegateVolume',
+    'hornEnabled', 'hornVolume', 'hornType', 'modeSwitchEnabled', 'modeSwitchVolume'
+];
+
 export class SoundPage {
     constructor() {
         this.elements = {};
         this.profiles = [];
+        this.horns = [];
         this.config = null;
     }
 
@@ -180,15 +196,7 @@ export class SoundPage {
                         </div>
                         <div class="row" style="margin-top: 8px; margin-bottom: 8px;">
                             <span class="label">Horn Type</span>
-                            <select id="horn-type" class="select">
-                                <option value="0">Truck Horn</option>
-                                <option value="1">MAN TGE Horn</option>
-                                <option value="2">La Cucaracha</option>
-                                <option value="3">Two-Tone</option>
-                                <option value="4">Dixie</option>
-                                <option value="5">Peterbilt</option>
-                                <option value="6">Outlaw</option>
-                            </select>
+                            <select id="horn-type" class="select"></select>
                         </div>
                         <div class="effect-row">
                             <label class="toggle-inline">
@@ -315,26 +323,26 @@ export class SoundPage {
         };
 
         // Setup slider value displays
-        this.setupSlider('idleVolume', '%');
-        this.setupSlider('revVolume', '%');
-        this.setupSlider('knockVolume', '%');
-        this.setupSlider('startVolume', '%');
-        this.setupSlider('maxRpm', '%');
-        this.setupSlider('acceleration', '');
-        this.setupSlider('deceleration', '');
+        this.setupSlider('idleVolume', '%', 'idleVolume');
+        this.setupSlider('revVolume', '%', 'revVolume');
+        this.setupSlider('knockVolume', '%', 'knockVolume');
+        this.setupSlider('startVolume', '%', 'startVolume');
+        this.setupSlider('maxRpm', '%', 'maxRpmPercent');
+        this.setupSlider('acceleration', '', 'acceleration');
+        this.setupSlider('deceleration', '', 'deceleration');
         // Sound effects
-        this.setupSlider('airBrakeVolume', '%');
-        this.setupSlider('reverseBeepVolume', '%');
-        this.setupSlider('gearShiftVolume', '%');
-        this.setupSlider('wastegateVolume', '%');
+        this.setupSlider('airBrakeVolume', '%', 'airBrakeVolume');
+        this.setupSlider('reverseBeepVolume', '%', 'reverseBeepVolume');
+        this.setupSlider('gearShiftVolume', '%', 'gearShiftVolume');
+        this.setupSlider('wastegateVolume', '%', 'wastegateVolume');
         // Horn & Mode Switch
-        this.setupSlider('hornVolume', '%');
-        this.setupSlider('modeSwitchVolume', '%');
+        this.setupSlider('hornVolume', '%', 'hornVolume');
+        this.setupSlider('modeSwitchVolume', '%', 'modeSwitchVolume');
         // Advanced
-        this.setupSlider('revSwitch', '');
-        this.setupSlider('idleEnd', '');
-        this.setupSlider('knockStart', '');
-        this.setupSlider('knockInterval', '');
+        this.setupSlider('revSwitch', '', 'revSwitchPoint');
+        this.setupSlider('idleEnd', '', 'idleEndPoint');
+        this.setupSlider('knockStart', '', 'knockStartPoint');
+        this.setupSlider('knockInterval', '', 'knockInterval');
 
         // Volume preset state
         this.currentPreset = 1;  // 0=Low, 1=Medium, 2=High
@@ -358,12 +366,14 @@ export class SoundPage {
         this.loadConfig();
     }
 
-    setupSlider(name, suffix) {
+    // Show the value while dragging and apply it live (Save persists it)
+    setupSlider(name, suffix, key) {
         const slider = this.elements[name];
         const valEl = this.elements[name + 'Val'];
         if (slider && valEl) {
             slider.addEventListener('input', () => {
                 valEl.textContent = slider.value + suffix;
+                sendLive(LIVE_TABLE_SOUND, LIVE_KEYS.indexOf(key), parseInt(slider.value));
             });
         }
     }
@@ -420,7 +430,9 @@ export class SoundPage {
             .then(r => r.json())
             .then(data => {
                 this.profiles = data.profiles || [];
+                this.horns = data.horns || [];
                 this.updateProfileSelect();
+                this.updateHornSelect();
             })
             .catch(err => console.error('Failed to load profiles:', err));
     }
@@ -442,6 +454,22 @@ export class SoundPage {
         }
     }
 
+    // Only the horns this build has (compiled in or from the sound pack)
+    updateHornSelect() {
+        const select = this.elements.hornType;
+        select.innerHTML = '';
+        this.horns.forEach(h => {
+            const opt = document.createElement('option');
+            opt.value = h.id;
+            opt.textContent = h.name;
+            select.appendChild(opt);
+        });
+
+        if (this.config) {
+            select.value = this.config.hornType;
+        }
+    }
+
     updateProfileDesc() {
         const id = parseInt(this.elements.profile.value);
         const profile = this.profiles.find(p => p.id === id);
@@ -540,7 +568,7 @@ export class SoundPage {
 
     onData(data) {
         // Update RPM display from WebSocket data if available
-        // (would need to add rpm to status JSON in main.c)
+        // (would need to add rpm to the status frame in web_server.c)
     }
 
     saveConfig() {
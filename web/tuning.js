@@ -1,10 +1,57 @@
 // Tuning Page - Servo endpoints, steering geometry, ESC settings
 
+import { setCapture, sendLive, sendMessage, sendJog, LIVE_TABLE_TUNING, JOG_HEARTBEAT_MS } from './app.js';
+
+// Rows are rendered for AXLE_COUNT_MAX axles (main/config.h); the ones past
+// the build's axle count ("axles" in /api/tuning) are hidden
+const AXLE_COUNT_MAX = 5;
+const AXLE_NAMES = ['Axle 1 (Front)', 'Axle 2', 'Axle 3', 'Axle 4', 'Axle 5'];
+const AXLE_DEFAULT_RATIO = [100, 70, 70, 100, 100];
+const AXLE_DEFAULT_POS = [0, 125, 290, 415, 500];
+const axleIds = (count) => Array.from({ length: count }, (_, i) => i);
+
+// Live edit ids: the order of tuning_json_fields in main/tuning.c
+function liveKeys(axles) {
+    const ids = axleIds(axles);
+    return [
+        ...ids.flatMap(i => [`s${i}_min`, `s${i}_max`, `s${i}_subtrim`, `s${i}_trim`, `s${i}_rev`]),
+        ...ids.map(i => `ratio${i}`), 'allAxleRear', 'expo', 'speedSteering',
+        'geometry', 'maxAngle', ...ids.map(i => `axlePos${i}`),
+        'realisticEnabled', 'responsiveness', 'returnRate', 'steerPredict',
+        'fwdLimit', 'revLimit', 'escSubtrim', 'deadzone', 'escRev', 'realistic',
+        'coastRate', 'brakeForce', 'motorCutoff',
+        'escRate', 'servoRate', 'loopRate'
+    ];
+}
+
+// Live graph: seconds of capture shown, and the traces per view
+// ([label, color, value(sample)] on the -1000..1000 stick scale)
+const GRAPH_WINDOW_S = 5;
+const GRAPH_VIEWS = {
+    throttle: [
+        ['Throttle', '#00aaff', (x) => x.thr],
+        ['Velocity', '#00ff88', (x) => x.vel],
+        ['ESC', '#ffaa00', (x) => x.esc ? (x.esc - 1500) * 2 : 0],
+        ['RPM', '#ff00ff', (x) => x.rpm * 2 - 1000]
+    ],
+    steering: [
+        ['Steering', '#00aaff', (x) => x.str],
+        ['Smoothed', '#00ff88', (x) => x.steer],
+        ['Front axle', '#ffaa00', (x) => x.servo[0] ? (x.servo[0] - 1500) * 2 : 0],
+        ['Rear axle', '#ff00ff', (x) => {
+            const p = x.servo[x.servo.length - 1];
+            return p ? (p - 1500) * 2 : 0;
+        }]
+    ]
+};
+
 export class TuningPage {
     constructor() {
         this.elements = {};
         this.config = null;
+        this.presets = [];
         this.toastTimer = null;
+        this.graph = { samples: [], timeUs: 0, lastT: null, frame: null };
     }
 
     render() {
@@ -13,14 +60,25 @@ export class TuningPage {
                 <!-- Toast notification -->
                 <div class="toast" id="toast"></div>
 
+                <!-- Presets Card -->
+                <div class="card">
+                    <h2>Presets</h2>
+                    <div class="tuning-group">
+                        <select id="preset-select" class="select"></select>
+                        <input type="text" id="preset-name" maxlength="15" placeholder="Preset name">
+                        <div class="tuning-actions">
+                            <button id="preset-load" class="btn btn-primary">Switch</button>
+                            <button id="preset-store" class="btn btn-secondary">Save Current Here</button>
+                        </div>
+                        <div class="hint">Each preset holds a full tuning and sound setup in RAM. Switching takes effect at the next control tick without touching flash; it can also be done from the menu or a 3-position switch (PRESET_AUX_CHANNEL). Edits after a switch change the live setup only - save them back into a preset to keep them there.</div>
+                    </div>
+                </div>
+
                 <!-- Axle Servo Cards -->
                 <div class="card">
                     <h2>Axle Servos</h2>
                     <div class="servo-grid">
-                        ${this.renderServoCard(0, 'Axle 1 (Front)')}
-                        ${this.renderServoCard(1, 'Axle 2')}
-                        ${this.renderServoCard(2, 'Axle 3')}
-                        ${this.renderServoCard(3, 'Axle 4 (Rear)')}
+                        ${axleIds(AXLE_COUNT_MAX).map(i => this.renderServoCard(i, AXLE_NAMES[i])).join('')}
                     </div>
                 </div>
 
@@ -28,10 +86,8 @@ export class TuningPage {
                 <div class="card">
                     <h2>Steering Geometry</h2>
                     <div class="tuning-group">
-                        ${this.renderSliderRow('ratio0', 'Axle 1 Ratio', 0, 100, 100, '%')}
-                        ${this.renderSliderRow('ratio1', 'Axle 2 Ratio', 0, 100, 70, '%')}
-                        ${this.renderSliderRow('ratio2', 'Axle 3 Ratio', 0, 100, 70, '%')}
-                        ${this.renderSliderRow('ratio3', 'Axle 4 Ratio', 0, 100, 100, '%')}
+                        ${axleIds(AXLE_COUNT_MAX).map(i =>
+                            this.renderSliderRow(`ratio${i}`, `Axle ${i + 1} Ratio`, 0, 100, AXLE_DEFAULT_RATIO[i], '%')).join('')}
                         ${this.renderSliderRow('all-axle-rear', 'All-Axle Rear', 0, 100, 80, '%')}
                         ${this.renderSliderRow('expo', 'Steering Expo', 0, 100, 0, '%')}
                         ${this.renderSliderRow('speed-steering', 'Speed Steering', 0, 100, 0, '%')}
@@ -39,6 +95,24 @@ export class TuningPage {
                     </div>
                 </div>
 
+                <!-- Turning-Center Geometry Card -->
+                <div class="card">
+                    <h2>Turning-Center Geometry</h2>
+                    <div class="tuning-group">
+                        <div class="tuning-row">
+                            <label>Use Axle Positions</label>
+                            <label class="toggle">
+                                <input type="checkbox" id="geometry"/>
+                                <span class="toggle-slider"></span>
+                            </label>
+                        </div>
+                        ${this.renderSliderRow('max-angle', 'Max Wheel Angle', 5, 45, 30, '°')}
+                        ${axleIds(AXLE_COUNT_MAX).map(i =>
+                            this.renderSliderRow(`axle-pos${i}`, `Axle ${i + 1} Position`, 0, 1000, AXLE_DEFAULT_POS[i], 'mm')).join('')}
+                        <div class="hint">When enabled, every axle is angled to turn around one point, replacing the axle ratios: front steer turns around the middle of the axles that stay straight (the rear bogie on an 8x8), rear steer likewise, and All-Axle sets the point between the first and last axle. Measure positions from axle 1, increasing towards the rear. Set each servo's endpoints so full throw is the max wheel angle.</div>
+                    </div>
+                </div>
+
                 <!-- Realistic Steering Card -->
                 <div class="card">
                     <h2>Realistic Steering</h2>
@@ -55,6 +129,8 @@ export class TuningPage {
                         <div class="hint">How fast servos move. 0% = very slow/heavy, 100% = instant response.</div>
                         ${this.renderSliderRow('steer-return-rate', 'Return Rate', 0, 100, 70, '%')}
                         <div class="hint">How fast steering returns to center when released. 0% = slow, 100% = fast.</div>
+                        ${this.renderSliderRow('steer-predict', 'Frame Prediction', 0, 40, 0, 'ms')}
+                        <div class="hint">Runs the steering ahead between receiver frames so fast servos move smoothly instead of in steps. Set it to about one receiver frame (20 ms at 50 Hz). 0 = off. Works with or without realistic mode.</div>
                     </div>
                 </div>
 
@@ -97,6 +173,54 @@ export class TuningPage {
                     </div>
                 </div>
 
+                <!-- Live Graph Card -->
+                <div class="card card-wide">
+                    <h2>Live Graph</h2>
+                    <div class="tuning-group">
+                        <div class="tuning-row">
+                            <label>Capture</label>
+                            <label class="toggle">
+                                <input type="checkbox" id="graph-capture"/>
+                                <span class="toggle-slider"></span>
+                            </label>
+                            <select id="graph-view" class="select">
+                                <option value="throttle">Throttle</option>
+                                <option value="steering">Steering</option>
+                            </select>
+                        </div>
+                        <canvas id="graph-canvas" class="capture-graph" width="800" height="240"></canvas>
+                        <div class="graph-legend" id="graph-legend"></div>
+                        <div class="hint" id="graph-info">Records every control loop tick while enabled. Use it to see the effect of coast rate, brake force and realistic steering.</div>
+                    </div>
+                </div>
+
+                <!-- Output Rate Card -->
+                <div class="card">
+                    <h2>Output Rate</h2>
+                    <div class="tuning-group">
+                        <div class="tuning-row">
+                            <label>ESC Rate</label>
+                            <select id="out-esc-rate" class="select">
+                                ${this.renderRateOptions()}
+                            </select>
+                        </div>
+                        <div class="tuning-row">
+                            <label>Servo Rate</label>
+                            <select id="out-servo-rate" class="select">
+                                ${this.renderRateOptions()}
+                            </select>
+                        </div>
+                        <div class="hint">PWM frame rate per group. Most ESCs need 50Hz; digital servos respond faster at 333Hz. Rates too fast for the configured endpoints are disabled.</div>
+                        <div class="tuning-row">
+                            <label>Control Loop</label>
+                            <select id="out-loop-rate" class="select">
+                                ${[100, 200, 400, 500].map(hz => `<option value="${hz}">${hz} Hz</option>`).join('')}
+                            </select>
+                        </div>
+                        <div class="hint">How often inputs are processed. Faster means lower latency; throttle and steering feel stays the same.</div>
+                    </div>
+                </div>
+
                 <!-- Servo Test Mode Card -->
                 <div class="card">
                     <h2>Servo Test</h2>
@@ -108,12 +232,10 @@ export class TuningPage {
                                 <span class="toggle-slider"></span>
                             </label>
                         </div>
-                        <div class="hint" id="servo-test-hint">Enable to manually control servos. Auto-disables after 30 seconds of inactivity.</div>
+                        <div class="hint" id="servo-test-hint">Enable to manually control servos. Auto-disables if this page stops sending.</div>
                         <div id="servo-test-controls" style="display:none">
-                            ${this.renderSliderRow('servo-test-0', 'Axle 1 (Front)', -1000, 1000, 0, '')}
-                            ${this.renderSliderRow('servo-test-1', 'Axle 2', -1000, 1000, 0, '')}
-                            ${this.renderSliderRow('servo-test-2', 'Axle 3', -1000, 1000, 0, '')}
-                            ${this.renderSliderRow('servo-test-3', 'Axle 4 (Rear)', -1000, 1000, 0, '')}
+                            ${axleIds(AXLE_COUNT_MAX).map(i =>
+                                this.renderSliderRow(`servo-test-${i}`, AXLE_NAMES[i], -1000, 1000, 0, '')).join('')}
                             <div class="tuning-actions">
                                 <button id="servo-test-center" class="btn btn-secondary">Center All</button>
                             </div>
@@ -131,6 +253,10 @@ export class TuningPage {
         `;
     }
 
+    renderRateOptions() {
+        return [50, 100, 200, 333].map(hz => `<option value="${hz}">${hz} Hz</option>`).join('');
+    }
+
     renderSliderRow(id, label, min, max, value, suffix) {
         return `
             <div class="tuning-row">
@@ -189,6 +315,11 @@ export class TuningPage {
             expoNum: document.getElementById('expo-num'),
             speedSteering: document.getElementById('speed-steering'),
             speedSteeringNum: document.getElementById('speed-steering-num'),
+            geometry: document.getElementById('geometry'),
+            maxAngle: document.getElementById('max-angle'),
+            maxAngleNum: document.getElementById('max-angle-num'),
+            axlePos: [],
+            axlePosNum: [],
             escFwd: document.getElementById('esc-fwd'),
             escFwdNum: document.getElementById('esc-fwd-num'),
             escRev: document.getElementById('esc-rev'),
@@ -211,20 +342,45 @@ export class TuningPage {
             steerResponsivenessNum: document.getElementById('steer-responsiveness-num'),
             steerReturnRate: document.getElementById('steer-return-rate'),
             steerReturnRateNum: document.getElementById('steer-return-rate-num'),
+            steerPredict: document.getElementById('steer-predict'),
+            steerPredictNum: document.getElementById('steer-predict-num'),
+            // Output rate elements
+            escRate: document.getElementById('out-esc-rate'),
+            servoRate: document.getElementById('out-servo-rate'),
+            loopRate: document.getElementById('out-loop-rate'),
             resetBtn: document.getElementById('tuning-reset'),
+            presetSelect: document.getElementById('preset-select'),
+            presetName: document.getElementById('preset-name'),
+            presetLoad: document.getElementById('preset-load'),
+            presetStore: document.getElementById('preset-store'),
             // Servo test elements
             servoTestActive: document.getElementById('servo-test-active'),
             servoTestControls: document.getElementById('servo-test-controls'),
             servoTestHint: document.getElementById('servo-test-hint'),
             servoTestCenter: document.getElementById('servo-test-center'),
-            servoTest: []
+            servoTest: [],
+            // Live graph elements
+            graphCapture: document.getElementById('graph-capture'),
+            graphView: document.getElementById('graph-view'),
+            graphCanvas: document.getElementById('graph-canvas'),
+            graphLegend: document.getElementById('graph-legend'),
+            graphInfo: document.getElementById('graph-info')
         };
 
-        // Debounce timer for auto-save
+        // Servo jog stream: sequence number and heartbeat timer
+        this.jogSeq = 0;
+        this.jogTimer = null;
+        this.jogPostAt = 0;
+
+        // Debounce timer for auto-save; set when a live edit couldn't be sent
         this.saveTimer = null;
+        this.liveMissed = false;
+
+        // Axles of this build, set from /api/tuning
+        this.axles = 4;
 
         // Collect servo elements
-        for (let i = 0; i < 4; i++) {
+        for (let i = 0; i < AXLE_COUNT_MAX; i++) {
             this.elements.servos[i] = {
                 min: document.getElementById(`s${i}-min`),
                 max: document.getElementById(`s${i}-max`),
@@ -236,49 +392,64 @@ export class TuningPage {
             };
 
             // Bidirectional sync for servo subtrim
-            this.syncSliderAndInput(this.elements.servos[i].subtrim, this.elements.servos[i].subtrimNum);
+            this.syncSliderAndInput(this.elements.servos[i].subtrim, this.elements.servos[i].subtrimNum, `s${i}_subtrim`);
             // Bidirectional sync for servo trim
-            this.syncSliderAndInput(this.elements.servos[i].trim, this.elements.servos[i].trimNum);
+            this.syncSliderAndInput(this.elements.servos[i].trim, this.elements.servos[i].trimNum, `s${i}_trim`);
 
-            this.elements.servos[i].min.addEventListener('change', () => this.scheduleAutoSave());
-            this.elements.servos[i].max.addEventListener('change', () => this.scheduleAutoSave());
-            this.elements.servos[i].rev.addEventListener('change', () => this.scheduleAutoSave());
+            this.bindLive(this.elements.servos[i].min, `s${i}_min`);
+            this.bindLive(this.elements.servos[i].max, `s${i}_max`);
+            this.bindLive(this.elements.servos[i].rev, `s${i}_rev`);
         }
 
         // Collect ratio elements
-        for (let i = 0; i < 4; i++) {
+        for (let i = 0; i < AXLE_COUNT_MAX; i++) {
             this.elements.ratio[i] = document.getElementById(`ratio${i}`);
             this.elements.ratioNum[i] = document.getElementById(`ratio${i}-num`);
-            this.syncSliderAndInput(this.elements.ratio[i], this.elements.ratioNum[i]);
+            this.syncSliderAndInput(this.elements.ratio[i], this.elements.ratioNum[i], `ratio${i}`);
         }
 
         // Sync slider/input pairs for steering geometry
-        this.syncSliderAndInput(this.elements.allAxleRear, this.elements.allAxleRearNum);
-        this.syncSliderAndInput(this.elements.expo, this.elements.expoNum);
-        this.syncSliderAndInput(this.elements.speedSteering, this.elements.speedSteeringNum);
+        this.syncSliderAndInput(this.elements.allAxleRear, this.elements.allAxleRearNum, 'allAxleRear');
+        this.syncSliderAndInput(this.elements.expo, this.elements.expoNum, 'expo');
+        this.syncSliderAndInput(this.elements.speedSteering, this.elements.speedSteeringNum, 'speedSteering');
+
+        // Turning-center geometry
+        this.bindLive(this.elements.geometry, 'geometry');
+        this.syncSliderAndInput(this.elements.maxAngle, this.elements.maxAngleNum, 'maxAngle');
+        for (let i = 0; i < AXLE_COUNT_MAX; i++) {
+            this.elements.axlePos[i] = document.getElementById(`axle-pos${i}`);
+            this.elements.axlePosNum[i] = document.getElementById(`axle-pos${i}-num`);
+            this.syncSliderAndInput(this.elements.axlePos[i], this.elements.axlePosNum[i], `axlePos${i}`);
+        }
 
         // Sync slider/input pairs for realistic steering
-        this.syncSliderAndInput(this.elements.steerResponsiveness, this.elements.steerResponsivenessNum);
-        this.syncSliderAndInput(this.elements.steerReturnRate, this.elements.steerReturnRateNum);
-        this.elements.steerRealistic.addEventListener('change', () => this.scheduleAutoSave());
+        this.syncSliderAndInput(this.elements.steerResponsiveness, this.elements.steerResponsivenessNum, 'responsiveness');
+        this.syncSliderAndInput(this.elements.steerReturnRate, this.elements.steerReturnRateNum, 'returnRate');
+        this.syncSliderAndInput(this.elements.steerPredict, this.elements.steerPredictNum, 'steerPredict');
+        this.bindLive(this.elements.steerRealistic, 'realisticEnabled');
 
         // Sync slider/input pairs for ESC
-        this.syncSliderAndInput(this.elements.escFwd, this.elements.escFwdNum);
-        this.syncSliderAndInput(this.elements.escRev, this.elements.escRevNum);
-        this.syncSliderAndInput(this.elements.escSubtrim, this.elements.escSubtrimNum);
-        this.syncSliderAndInput(this.elements.escDeadzone, this.elements.escDeadzoneNum);
+        this.syncSliderAndInput(this.elements.escFwd, this.elements.escFwdNum, 'fwdLimit');
+        this.syncSliderAndInput(this.elements.escRev, this.elements.escRevNum, 'revLimit');
+        this.syncSliderAndInput(this.elements.escSubtrim, this.elements.escSubtrimNum, 'escSubtrim');
+        this.syncSliderAndInput(this.elements.escDeadzone, this.elements.escDeadzoneNum, 'deadzone');
 
-        this.elements.escReversed.addEventListener('change', () => this.scheduleAutoSave());
+        this.bindLive(this.elements.escReversed, 'escRev');
 
         // Sync slider/input pairs for realistic throttle
-        this.syncSliderAndInput(this.elements.escCoast, this.elements.escCoastNum);
-        this.syncSliderAndInput(this.elements.escBrake, this.elements.escBrakeNum);
-        this.syncSliderAndInput(this.elements.escMotorCutoff, this.elements.escMotorCutoffNum);
+        this.syncSliderAndInput(this.elements.escCoast, this.elements.escCoastNum, 'coastRate');
+        this.syncSliderAndInput(this.elements.escBrake, this.elements.escBrakeNum, 'brakeForce');
+        this.syncSliderAndInput(this.elements.escMotorCutoff, this.elements.escMotorCutoffNum, 'motorCutoff');
+
+        this.bindLive(this.elements.escRealistic, 'realistic');
 
-        this.elements.escRealistic.addEventListener('change', () => this.scheduleAutoSave());
+        // Output rate selects
+        this.bindLive(this.elements.escRate, 'escRate');
+        this.bindLive(this.elements.servoRate, 'servoRate');
+        this.bindLive(this.elements.loopRate, 'loopRate');
 
         // Servo test mode - collect elements and setup
-        for (let i = 0; i < 4; i++) {
+        for (let i = 0; i < AXLE_COUNT_MAX; i++) {
             this.elements.servoTest[i] = {
                 slider: document.getElementById(`servo-test-${i}`),
                 num: document.getElementById(`servo-test-${i}-num`)
@@ -298,31 +469,63 @@ export class TuningPage {
         this.elements.servoTestActive.addEventListener('change', () => this.toggleServoTest());
         this.elements.servoTestCenter.addEventListener('click', () => this.centerAllServos());
 
+        // Live graph
+        this.elements.graphCapture.addEventListener('change', () => {
+            setCapture(this.elements.graphCapture.checked);
+        });
+        this.elements.graphView.addEventListener('change', () => this.updateGraphLegend());
+        this.updateGraphLegend();
+
         // Button handlers
         this.elements.resetBtn.addEventListener('click', () => this.resetConfig());
+        this.elements.presetSelect.addEventListener('change', () => {
+            const preset = this.presets[parseInt(this.elements.presetSelect.value)];
+            this.elements.presetName.value = preset ? preset.name : '';
+        });
+        this.elements.presetLoad.addEventListener('click', () => this.selectPreset());
+        this.elements.presetStore.addEventListener('click', () => this.storePreset());
+        this.loadPresets();
 
         // Load initial config
+        this.setAxleCount(this.axles);
         this.loadConfig();
         this.loadServoTestState();
     }
 
-    // Sync slider and number input bidirectionally
-    syncSliderAndInput(slider, numInput) {
+    // Sync slider and number input bidirectionally, applying edits live
+    syncSliderAndInput(slider, numInput, key) {
         slider.addEventListener('input', () => {
             numInput.value = slider.value;
-            this.scheduleAutoSave();
+            this.liveEdit(key, parseInt(slider.value));
         });
         numInput.addEventListener('input', () => {
             slider.value = numInput.value;
-            this.scheduleAutoSave();
+            this.liveEdit(key, parseInt(numInput.value));
         });
     }
 
+    // Apply a checkbox, select or number input live when it changes
+    bindLive(el, key) {
+        el.addEventListener('change', () => {
+            this.liveEdit(key, el.type === 'checkbox' ? (el.checked ? 1 : 0) : parseInt(el.value));
+        });
+    }
+
+    // Send one field over the WebSocket (applied next control tick), then
+    // commit once editing pauses. Falls back to a full POST when offline
+    liveEdit(key, value) {
+        if (!Number.isNaN(value) && !sendLive(LIVE_TABLE_TUNING, this.liveKeys.indexOf(key), value)) {
+            this.liveMissed = true;
+        }
+        this.scheduleAutoSave();
+    }
+
     loadConfig() {
         fetch('/api/tuning')
             .then(r => r.json())
             .then(data => {
                 this.config = data;
+                this.setAxleCount(data.axles || 4);
                 this.applyConfig(data);
             })
             .catch(err => {
@@ -331,115 +534,106 @@ export class TuningPage {
             });
     }
 
+    // Show the rows of the build's axles and hide the rest
+    setAxleCount(axles) {
+        this.axles = Math.min(axles, AXLE_COUNT_MAX);
+        this.liveKeys = liveKeys(this.axles);
+        for (let i = 0; i < AXLE_COUNT_MAX; i++) {
+            const display = i < this.axles ? '' : 'none';
+            this.elements.servos[i].min.closest('.servo-card').style.display = display;
+            this.elements.ratio[i].closest('.tuning-row').style.display = display;
+            this.elements.axlePos[i].closest('.tuning-row').style.display = display;
+            this.elements.servoTest[i].slider.closest('.tuning-row').style.display = display;
+        }
+    }
+
     applyConfig(data) {
-        // Apply servo settings from nested structure: data.servos[i]
-        if (data.servos) {
-            for (let i = 0; i < 4; i++) {
-                const s = this.elements.servos[i];
-                const srv = data.servos[i];
-                if (srv) {
-                    if (srv.min !== undefined) s.min.value = srv.min;
-                    if (srv.max !== undefined) s.max.value = srv.max;
-                    if (srv.subtrim !== undefined) {
-                        s.subtrim.value = srv.subtrim;
-                        s.subtrimNum.value = srv.subtrim;
-                    }
-                    if (srv.trim !== undefined) {
-                        s.trim.value = srv.trim;
-                        s.trimNum.value = srv.trim;
-                    }
-                    if (srv.rev !== undefined) s.rev.checked = srv.rev;
-                }
-            }
+        // Flat keys, the same ones saveConfig() posts back
+        const setPair = (slider, num, value) => {
+            if (value === undefined) return;
+            slider.value = value;
+            num.value = value;
+        };
+        const setCheck = (box, value) => {
+            if (value !== undefined) box.checked = value;
+        };
+
+        // Servo settings
+        for (let i = 0; i < this.axles; i++) {
+            const s = this.elements.servos[i];
+            if (data[`s${i}_min`] !== undefined) s.min.value = data[`s${i}_min`];
+            if (data[`s${i}_max`] !== undefined) s.max.value = data[`s${i}_max`];
+            setPair(s.subtrim, s.subtrimNum, data[`s${i}_subtrim`]);
+            setPair(s.trim, s.trimNum, data[`s${i}_trim`]);
+            setCheck(s.rev, data[`s${i}_rev`]);
         }
 
-        // Apply steering settings from data.steering
-        if (data.steering) {
-            if (data.steering.ratio) {
-                for (let i = 0; i < 4; i++) {
-                    if (data.steering.ratio[i] !== undefined) {
-                        this.elements.ratio[i].value = data.steering.ratio[i];
-                        this.elements.ratioNum[i].value = data.steering.ratio[i];
-                    }
-                }
-            }
-            if (data.steering.allAxleRear !== undefined) {
-                this.elements.allAxleRear.value = data.steering.allAxleRear;
-                this.elements.allAxleRearNum.value = data.steering.allAxleRear;
-            }
-            if (data.steering.expo !== undefined) {
-                this.elements.expo.value = data.steering.expo;
-                this.elements.expoNum.value = data.steering.expo;
-            }
-            if (data.steering.speedSteering !== undefined) {
-                this.elements.speedSteering.value = data.steering.speedSteering;
-                this.elements.speedSteeringNum.value = data.steering.speedSteering;
-            }
-            // Realistic steering settings
-            if (data.steering.realisticEnabled !== undefined) {
-                this.elements.steerRealistic.checked = data.steering.realisticEnabled;
-            }
-            if (data.steering.responsiveness !== undefined) {
-                this.elements.steerResponsiveness.value = data.steering.responsiveness;
-                this.elements.steerResponsivenessNum.value = data.steering.responsiveness;
-            }
-            if (data.steering.returnRate !== undefined) {
-                this.elements.steerReturnRate.value = data.steering.returnRate;
-                this.elements.steerReturnRateNum.value = data.steering.returnRate;
-            }
+        // Steering settings
+        for (let i = 0; i < this.axles; i++) {
+            setPair(this.elements.ratio[i], this.elements.ratioNum[i], data[`ratio${i}`]);
+        }
+        setPair(this.elements.allAxleRear, this.elements.allAxleRearNum, data.allAxleRear);
+        setPair(this.elements.expo, this.elements.expoNum, data.expo);
+        setPair(this.elements.speedSteering, this.elements.speedSteeringNum, data.speedSteering);
+        setCheck(this.elements.geometry, data.geometry);
+        setPair(this.elements.maxAngle, this.elements.maxAngleNum, data.maxAngle);
+        for (let i = 0; i < this.axles; i++) {
+            setPair(this.elements.axlePos[i], this.elements.axlePosNum[i], data[`axlePos${i}`]);
+        }
+        setCheck(this.elements.steerRealistic, data.realisticEnabled);
+        setPair(this.elements.steerResponsiveness, this.elements.steerResponsivenessNum, data.responsiveness);
+        setPair(this.elements.steerReturnRate, this.elements.steerReturnRateNum, data.returnRate);
+        setPair(this.elements.steerPredict, this.elements.steerPredictNum, data.steerPredict);
+
+        // ESC settings
+        setPair(this.elements.escFwd, this.elements.escFwdNum, data.fwdLimit);
+        setPair(this.elements.escRev, this.elements.escRevNum, data.revLimit);
+        setPair(this.elements.escSubtrim, this.elements.escSubtrimNum, data.escSubtrim);
+        setPair(this.elements.escDeadzone, this.elements.escDeadzoneNum, data.deadzone);
+        setCheck(this.elements.escReversed, data.escRev);
+        setCheck(this.elements.escRealistic, data.realistic);
+        setPair(this.elements.escCoast, this.elements.escCoastNum, data.coastRate);
+        setPair(this.elements.escBrake, this.elements.escBrakeNum, data.brakeForce);
+        setPair(this.elements.escMotorCutoff, this.elements.escMotorCutoffNum, data.motorCutoff);
+
+        // Output rates
+        this.applyRateSelect(this.elements.escRate, data.escRate, data.escRateMax);
+        this.applyRateSelect(this.elements.servoRate, data.servoRate, data.servoRateMax);
+        if (data.loopRate !== undefined) {
+            this.elements.loopRate.value = data.loopRate;
         }
+    }
 
-        // Apply ESC settings from data.esc
-        if (data.esc) {
-            if (data.esc.fwdLimit !== undefined) {
-                this.elements.escFwd.value = data.esc.fwdLimit;
-                this.elements.escFwdNum.value = data.esc.fwdLimit;
-            }
-            if (data.esc.revLimit !== undefined) {
-                this.elements.escRev.value = data.esc.revLimit;
-                this.elements.escRevNum.value = data.esc.revLimit;
-            }
-            if (data.esc.subtrim !== undefined) {
-                this.elements.escSubtrim.value = data.esc.subtrim;
-                this.elements.escSubtrimNum.value = data.esc.subtrim;
-            }
-            if (data.esc.deadzone !== undefined) {
-                this.elements.escDeadzone.value = data.esc.deadzone;
-                this.elements.escDeadzoneNum.value = data.esc.deadzone;
-            }
-            if (data.esc.rev !== undefined) {
-                this.elements.escReversed.checked = data.esc.rev;
-            }
-            if (data.esc.realistic !== undefined) {
-                this.elements.escRealistic.checked = data.esc.realistic;
-            }
-            if (data.esc.coastRate !== undefined) {
-                this.elements.escCoast.value = data.esc.coastRate;
-                this.elements.escCoastNum.value = data.esc.coastRate;
-            }
-            if (data.esc.brakeForce !== undefined) {
-                this.elements.escBrake.value = data.esc.brakeForce;
-                this.elements.escBrakeNum.value = data.esc.brakeForce;
-            }
-            if (data.esc.motorCutoff !== undefined) {
-                this.elements.escMotorCutoff.value = data.esc.motorCutoff;
-                this.elements.escMotorCutoffNum.value = data.esc.motorCutoff;
-            }
+    // Select a rate and disable options the pulse endpoints can't fit
+    applyRateSelect(select, rate, maxRate) {
+        for (const opt of select.options) {
+            opt.disabled = maxRate !== undefined && parseInt(opt.value) > maxRate;
         }
+        if (rate !== undefined) select.value = rate;
     }
 
     scheduleAutoSave() {
         if (this.saveTimer) {
             clearTimeout(this.saveTimer);
         }
-        this.saveTimer = setTimeout(() => this.saveConfig(), 500);
+        this.saveTimer = setTimeout(() => this.commitConfig(), 500);
+    }
+
+    commitConfig() {
+        if (this.liveMissed) {
+            this.liveMissed = false;
+            this.saveConfig();
+            return;
+        }
+        sendMessage({ cmd: 'commit' });
+        this.showToast('Saved', 'success');
     }
 
     saveConfig() {
         const config = {};
 
         // Gather servo settings
-        for (let i = 0; i < 4; i++) {
+        for (let i = 0; i < this.axles; i++) {
             const s = this.elements.servos[i];
             config[`s${i}_min`] = parseInt(s.min.value);
             config[`s${i}_max`] = parseInt(s.max.value);
@@ -449,17 +643,23 @@ export class TuningPage {
         }
 
         // Gather steering settings
-        for (let i = 0; i < 4; i++) {
+        for (let i = 0; i < this.axles; i++) {
             config[`ratio${i}`] = parseInt(this.elements.ratio[i].value);
         }
         config.allAxleRear = parseInt(this.elements.allAxleRear.value);
         config.expo = parseInt(this.elements.expo.value);
         config.speedSteering = parseInt(this.elements.speedSteering.value);
+        config.geometry = this.elements.geometry.checked;
+        config.maxAngle = parseInt(this.elements.maxAngle.value);
+        for (let i = 0; i < this.axles; i++) {
+            config[`axlePos${i}`] = parseInt(this.elements.axlePos[i].value);
+        }
 
         // Gather realistic steering settings
         config.realisticEnabled = this.elements.steerRealistic.checked;
         config.responsiveness = parseInt(this.elements.steerResponsiveness.value);
         config.returnRate = parseInt(this.elements.steerReturnRate.value);
+        config.steerPredict = parseInt(this.elements.steerPredict.value);
 
         // Gather ESC settings
         config.fwdLimit = parseInt(this.elements.escFwd.value);
@@ -474,6 +674,11 @@ export class TuningPage {
         config.brakeForce = parseInt(this.elements.escBrake.value);
         config.motorCutoff = parseInt(this.elements.escMotorCutoff.value);
 
+        // Gather output rates
+        config.escRate = parseInt(this.elements.escRate.value);
+        config.servoRate = parseInt(this.elements.servoRate.value);
+        config.loopRate = parseInt(this.elements.loopRate.value);
+
         fetch('/api/tuning', {
             method: 'POST',
             headers: { 'Content-Type': 'application/json' },
@@ -489,6 +694,63 @@ export class TuningPage {
         });
     }
 
+    loadPresets() {
+        return fetch('/api/presets')
+            .then(r => r.json())
+            .then(data => {
+                this.presets = data.presets;
+                const select = this.elements.presetSelect;
+                select.replaceChildren(...data.presets.map(p =>
+                    new Option(`${p.id + 1}. ${p.name}${p.id === data.active ? ' (active)' : ''}`, p.id)));
+                select.value = data.active;
+                this.elements.presetName.value = data.presets[data.active].name;
+                return data;
+            })
+            .catch(err => console.error('Failed to load presets:', err));
+    }
+
+    postPreset(body) {
+        return fetch('/api/presets', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify(body)
+        }).then(r => {
+            if (!r.ok) throw new Error(r.statusText);
+            return r.json();
+        });
+    }
+
+    // The switch lands a few ms later; reload the sliders once it has
+    selectPreset() {
+        const id = parseInt(this.elements.presetSelect.value);
+        this.postPreset({ select: id })
+            .then(() => new Promise(resolve => setTimeout(resolve, 100)))
+            .then(() => this.loadPresets())
+            .then(() => {
+                this.loadConfig();
+                this.showToast(`Switched to ${this.presets[id].name}`, 'success');
+            })
+            .catch(err => {
+                console.error('Failed to switch preset:', err);
+                this.showToast('Failed to switch preset', 'error');
+            });
+    }
+
+    storePreset() {
+        const id = parseInt(this.elements.presetSelect.value);
+        const name = this.elements.presetName.value.trim();
+        if (!confirm(`Overwrite preset ${id + 1} with the current tuning and sound settings?`)) {
+            return;
+        }
+        this.postPreset(name ? { store: id, name } : { store: id })
+            .then(() => this.loadPresets())
+            .then(() => this.showToast('Preset saved', 'success'))
+            .catch(err => {
+                console.error('Failed to save preset:', err);
+                this.showToast('Failed to save preset', 'error');
+            });
+    }
+
     resetConfig() {
         if (!confirm('Reset all tuning settings to factory defaults?\n\nThis cannot be undone.')) {
             return;
@@ -536,6 +798,90 @@ export class TuningPage {
         // Could update live preview here if needed
     }
 
+    // =========================================================================
+    // Live Graph
+    // =========================================================================
+
+    onCapture(batch) {
+        const g = this.graph;
+        for (const sample of batch.samples) {
+            // Device time is 32-bit microseconds: accumulate deltas across wraps
+            if (g.lastT !== null) {
+                g.timeUs += (sample.t - g.lastT) >>> 0;
+            }
+            g.lastT = sample.t;
+            sample.time = g.timeUs;
+            g.samples.push(sample);
+        }
+
+        const cutoff = g.timeUs - GRAPH_WINDOW_S * 1e6;
+        let first = 0;
+        while (first < g.samples.length && g.samples[first].time < cutoff) first++;
+        if (first > 0) g.samples.splice(0, first);
+
+        this.elements.graphInfo.textContent =
+            `${batch.rate} Hz loop, ${g.samples.length} samples shown, ${batch.dropped} dropped since boot`;
+
+        if (!g.frame) {
+            g.frame = requestAnimationFrame(() => {
+                g.frame = null;
+                this.drawGraph();
+            });
+        }
+    }
+
+    updateGraphLegend() {
+        const traces = GRAPH_VIEWS[this.elements.graphView.value];
+        this.elements.graphLegend.innerHTML = traces
+            .map(([label, color]) => `<span style="color:${color}">&#9632; ${label}</span>`)
+            .join('');
+        this.drawGraph();
+    }
+
+    drawGraph() {
+        const canvas = this.elements.graphCanvas;
+        const ctx = canvas.getContext('2d');
+        const w = canvas.width;
+        const h = canvas.height;
+        const samples = this.graph.samples;
+
+        ctx.clearRect(0, 0, w, h);
+
+        // Grid: center line and +-50%, one vertical per second
+        ctx.strokeStyle = '#2a3a5e';
+        ctx.lineWidth = 1;
+        ctx.beginPath();
+        for (const v of [-500, 0, 500]) {
+            const y = h / 2 - (v / 1000) * (h / 2);
+            ctx.moveTo(0, y);
+            ctx.lineTo(w, y);
+        }
+        for (let t = 1; t < GRAPH_WINDOW_S; t++) {
+            const x = (t / GRAPH_WINDOW_S) * w;
+            ctx.moveTo(x, 0);
+            ctx.lineTo(x, h);
+        }
+        ctx.stroke();
+
+        if (samples.length < 2) return;
+
+        const end = samples[samples.length - 1].time;
+        const span = GRAPH_WINDOW_S * 1e6;
+        for (const [, color, value] of GRAPH_VIEWS[this.elements.graphView.value]) {
+            ctx.strokeStyle = color;
+            ctx.lineWidth = 1.5;
+            ctx.beginPath();
+            samples.forEach((sample, i) => {
+                const x = w - ((end - sample.time) / span) * w;
+                const v = Math.max(-1000, Math.min(1000, value(sample)));
+                const y = h / 2 - (v / 1000) * (h / 2);
+                if (i === 0) ctx.moveTo(x, y);
+                else ctx.lineTo(x, y);
+            });
+            ctx.stroke();
+        }
+    }
+
     // =========================================================================
     // Servo Test Mode
     // =========================================================================
@@ -546,8 +892,9 @@ export class TuningPage {
             .then(data => {
                 this.elements.servoTestActive.checked = data.active;
                 this.updateServoTestUI(data.active);
+                this.setJogStream(data.active);
                 if (data.values) {
-                    for (let i = 0; i < 4; i++) {
+                    for (let i = 0; i < this.axles; i++) {
                         this.elements.servoTest[i].slider.value = data.values[i] || 0;
                         this.elements.servoTest[i].num.value = data.values[i] || 0;
                     }
@@ -559,6 +906,7 @@ export class TuningPage {
     toggleServoTest() {
         const active = this.elements.servoTestActive.checked;
         this.updateServoTestUI(active);
+        this.setJogStream(active);
 
         // Send enable/disable command
         fetch('/api/servo', {
@@ -572,22 +920,42 @@ export class TuningPage {
             // Revert UI on error
             this.elements.servoTestActive.checked = !active;
             this.updateServoTestUI(!active);
+            this.setJogStream(!active);
         });
     }
 
     updateServoTestUI(active) {
         this.elements.servoTestControls.style.display = active ? 'block' : 'none';
         this.elements.servoTestHint.textContent = active
-            ? 'Test mode active. RC input is ignored. Auto-disables after 30s of inactivity.'
-            : 'Enable to manually control servos. Auto-disables after 30 seconds of inactivity.';
+            ? 'Test mode active. RC input is ignored until you turn it off or leave this page.'
+            : 'Enable to manually control servos. Auto-disables if this page stops sending.';
+    }
+
+    // While test mode is on, resend the positions as a heartbeat; if it stops
+    // (page closed, link lost) the firmware hands the servos back to RC
+    setJogStream(on) {
+        if (this.jogTimer) {
+            clearInterval(this.jogTimer);
+            this.jogTimer = null;
+        }
+        if (on) {
+            this.jogTimer = setInterval(() => this.sendServoTest(), JOG_HEARTBEAT_MS);
+        }
     }
 
     sendServoTest() {
         const values = [];
-        for (let i = 0; i < 4; i++) {
-            values.push(parseInt(this.elements.servoTest[i].slider.value));
+        for (let i = 0; i < this.axles; i++) {
+            values.push(parseInt(this.elements.servoTest[i].slider.value) || 0);
         }
 
+        this.jogSeq = (this.jogSeq + 1) & 0xffff;
+        if (sendJog(this.jogSeq, values)) return;
+
+        // No WebSocket: fall back to HTTP, at most once per heartbeat period
+        const now = Date.now();
+        if (now - this.jogPostAt < JOG_HEARTBEAT_MS) return;
+        this.jogPostAt = now;
         fetch('/api/servo', {
             method: 'POST',
             headers: { 'Content-Type': 'application/json' },
@@ -597,7 +965,7 @@ export class TuningPage {
     }
 
     centerAllServos() {
-        for (let i = 0; i < 4; i++) {
+        for (let i = 0; i < this.axles; i++) {
             this.elements.servoTest[i].slider.value = 0;
             this.elements.servoTest[i].num.value = 0;
         }
@@ -607,5 +975,10 @@ export class TuningPage {
     destroy() {
         if (this.saveTimer) clearTimeout(this.saveTimer);
         if (this.toastTimer) clearTimeout(this.toastTimer);
+        this.setJogStream(false);
+        if (this.graph.frame) cancelAnimationFrame(this.graph.frame);
+        if (this.elements.graphCapture && this.elements.graphCapture.checked) {
+            setCapture(false);
+        }
     }
 }